@@ -55,6 +55,7 @@
 
 STATIC CPU_MP_DATA  mCpuMpData;
 STATIC BOOLEAN      mNonBlockingModeAllowed;
+STATIC BOOLEAN      mTurnOffParkedAps;
 UINT64              *gApStacksBase;
 UINT64              *gProcessorIDs;
 CONST UINT64        gApStackSize = AP_STACK_SIZE;
@@ -70,6 +71,8 @@ IsCurrentProcessorBSP (
 
 /** Turns on the specified core using PSCI and executes the user-supplied
     function that's been configured via a previous call to SetApProcedure.
+    If the core is already waiting for work in ApProcedure, it is woken up
+    instead.
 
     @param ProcessorIndex The index of the core to turn on.
 
@@ -91,6 +94,13 @@ DispatchCpu (
 
   mCpuMpData.CpuData[ProcessorIndex].State = CpuStateBusy;
 
+  if (mCpuMpData.CpuData[ProcessorIndex].Parked) {
+    /* Publish the procedure and the new state, then wake the AP up */
+    ArmDataSynchronizationBarrier ();
+    ArmCallSEV ();
+    return EFI_SUCCESS;
+  }
+
   /* Turn the AP on */
   if (sizeof (Args.Arg0) == sizeof (UINT32)) {
     Args.Arg0 = ARM_SMC_ID_PSCI_CPU_ON_AARCH32;
@@ -1289,6 +1299,7 @@ MpServicesInitialize (
   EFI_STATUS  Status;
   UINTN       Index;
   EFI_EVENT   ReadyToBootEvent;
+  EFI_EVENT   ExitBootServicesEvent;
   BOOLEAN     IsBsp;
 
   //
@@ -1379,6 +1390,15 @@ MpServicesInitialize (
              );
   ASSERT_EFI_ERROR (Status);
 
+  Status = gBS->CreateEvent (
+                  EVT_SIGNAL_EXIT_BOOT_SERVICES,
+                  TPL_CALLBACK,
+                  ExitBootServicesSignaled,
+                  NULL,
+                  &ExitBootServicesEvent
+                  );
+  ASSERT_EFI_ERROR (Status);
+
   return EFI_SUCCESS;
 }
 
@@ -1402,6 +1422,50 @@ ReadyToBootSignaled (
   mNonBlockingModeAllowed = FALSE;
 }
 
+/**
+  Event notification function called when ExitBootServices() is invoked.
+  It turns off the APs that are waiting for work, so that the OS can turn
+  them on with PSCI.
+
+  @param  Event     Event whose notification function is being invoked.
+  @param  Context   The pointer to the notification function's context,
+                    which is implementation-dependent.
+
+**/
+STATIC
+VOID
+EFIAPI
+ExitBootServicesSignaled (
+  IN  EFI_EVENT  Event,
+  IN  VOID       *Context
+  )
+{
+  ARM_SMC_ARGS  Args;
+  UINTN         Index;
+
+  mTurnOffParkedAps = TRUE;
+  ArmDataSynchronizationBarrier ();
+  ArmCallSEV ();
+
+  for (Index = 0; Index < mCpuMpData.NumberOfProcessors; Index++) {
+    if (!mCpuMpData.CpuData[Index].Parked) {
+      continue;
+    }
+
+    do {
+      if (sizeof (Args.Arg0) == sizeof (UINT32)) {
+        Args.Arg0 = ARM_SMC_ID_PSCI_AFFINITY_INFO_AARCH32;
+      } else {
+        Args.Arg0 = ARM_SMC_ID_PSCI_AFFINITY_INFO_AARCH64;
+      }
+
+      Args.Arg1 = gProcessorIDs[Index];
+      Args.Arg2 = 0;
+      ArmCallSmc (&Args);
+    } while (Args.Arg0 == ARM_SMC_ID_PSCI_AFFINITY_INFO_ON);
+  }
+}
+
 /** Initialize multi-processor support.
 
   @param ImageHandle  Image handle.
@@ -1536,14 +1600,12 @@ ApProcedure (
   EFI_AP_PROCEDURE  UserApProcedure;
   VOID              *UserApParameter;
   UINTN             ProcessorIndex;
+  CPU_AP_DATA       *CpuData;
 
   ProcessorIndex = 0;
 
   WhoAmI (&mMpServicesProtocol, &ProcessorIndex);
-
-  /* Fetch the user-supplied procedure and parameter to execute */
-  UserApProcedure = mCpuMpData.CpuData[ProcessorIndex].Procedure;
-  UserApParameter = mCpuMpData.CpuData[ProcessorIndex].Parameter;
+  CpuData = &mCpuMpData.CpuData[ProcessorIndex];
 
   InitializeCpuExceptionHandlers (NULL);
   RegisterCpuInterruptHandler (EXCEPT_AARCH64_SYNCHRONOUS_EXCEPTIONS, ApExceptionHandler);
@@ -1551,11 +1613,36 @@ ApProcedure (
   RegisterCpuInterruptHandler (EXCEPT_AARCH64_FIQ, ApExceptionHandler);
   RegisterCpuInterruptHandler (EXCEPT_AARCH64_SERROR, ApExceptionHandler);
 
-  UserApProcedure (UserApParameter);
+  while (TRUE) {
+    /* Fetch the user-supplied procedure and parameter to execute */
+    UserApProcedure = CpuData->Procedure;
+    UserApParameter = CpuData->Parameter;
 
-  mCpuMpData.CpuData[ProcessorIndex].State = CpuStateFinished;
+    UserApProcedure (UserApParameter);
 
-  ArmDataMemoryBarrier ();
+    //
+    // Rather than turning the AP off, keep it waiting for the BSP to hand it
+    // the next procedure, so that DispatchCpu () only has to update its state
+    // and send an event. Parked must be visible before the BSP can see the
+    // Finished state and dispatch the AP again.
+    //
+    CpuData->Parked = TRUE;
+    ArmDataMemoryBarrier ();
+    CpuData->State = CpuStateFinished;
+    ArmDataMemoryBarrier ();
+
+    while ((CpuData->State != CpuStateBusy) && !mTurnOffParkedAps) {
+      ArmCallWFE ();
+      ArmDataMemoryBarrier ();
+    }
+
+    if (mTurnOffParkedAps) {
+      break;
+    }
+
+    CpuData->Parked = FALSE;
+    ArmDataMemoryBarrier ();
+  }
 
   /* Since we're finished with this AP, turn it off */
   Args.Arg0 = ARM_SMC_ID_PSCI_CPU_OFF;
@@ -30,6 +30,9 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 //  Idle ----> Ready ----> Busy ----> Finished ----> Idle
 //       [BSP]       [BSP]      [AP]           [BSP]
 //
+// Once an AP has run a procedure, it stays on and waits for the BSP to move
+// it to the Busy state again, rather than being turned off.
+//
 typedef enum {
   CpuStateIdle,
   CpuStateReady,
@@ -53,6 +56,7 @@ typedef struct {
   UINTN                        TimeTaken;
   BOOLEAN                      TimeoutActive;
   BOOLEAN                      *SingleApFinished;
+  BOOLEAN                      Parked;
 } CPU_AP_DATA;
 
 //
@@ -342,4 +346,22 @@ ReadyToBootSignaled (
   IN  VOID       *Context
   );
 
+/**
+  Event notification function called when ExitBootServices() is invoked.
+  It turns off the APs that are waiting for work, so that the OS can turn
+  them on with PSCI.
+
+  @param  Event     Event whose notification function is being invoked.
+  @param  Context   The pointer to the notification function's context,
+                    which is implementation-dependent.
+
+**/
+STATIC
+VOID
+EFIAPI
+ExitBootServicesSignaled (
+  IN  EFI_EVENT  Event,
+  IN  VOID       *Context
+  );
+
 #endif /* MP_SERVICES_INTERNAL_H_ */
@@ -79,6 +79,7 @@ MmCommunication2Communicate (
   ARM_SMC_ARGS               CommunicateSmcArgs;
   EFI_STATUS                 Status;
   UINTN                      BufferSize;
+  BOOLEAN                    InPlace;
 
   Status     = EFI_ACCESS_DENIED;
   BufferSize = 0;
@@ -145,8 +146,16 @@ MmCommunication2Communicate (
   // Cookie
   CommunicateSmcArgs.Arg1 = 0;
 
+  //
+  // A caller which builds its message in the non-secure buffer itself does not
+  // need the payload to be copied there and back.
+  //
+  InPlace = (BOOLEAN)(CommBufferVirtual == (VOID *)(UINTN)mNsCommBuffMemRegion.VirtualBase);
+
   // Copy Communication Payload
-  CopyMem ((VOID *)mNsCommBuffMemRegion.VirtualBase, CommBufferVirtual, BufferSize);
+  if (!InPlace) {
+    CopyMem ((VOID *)mNsCommBuffMemRegion.VirtualBase, CommBufferVirtual, BufferSize);
+  }
 
   // comm_buffer_address (64-bit physical address)
   CommunicateSmcArgs.Arg2 = (UINTN)mNsCommBuffMemRegion.PhysicalBase;
@@ -159,6 +168,11 @@ MmCommunication2Communicate (
 
   switch (CommunicateSmcArgs.Arg0) {
     case ARM_SMC_MM_RET_SUCCESS:
+      if (InPlace) {
+        Status = EFI_SUCCESS;
+        break;
+      }
+
       ZeroMem (CommBufferVirtual, BufferSize);
       // On successful return, the size of data being returned is inferred from
       // MessageLength + Header.
@@ -217,6 +217,10 @@ UpdateRegionMappingRecursive (
   VOID        *TranslationTable;
   EFI_STATUS  Status;
   BOOLEAN     NextTableIsLive;
+  BOOLEAN     DeferTlbMaintenance;
+  UINTN       UpdatedEntryCount;
+  UINT64      *UpdatedEntry;
+  UINT64      UpdatedRegionStart;
 
   ASSERT (((RegionStart | RegionEnd) & EFI_PAGE_MASK) == 0);
 
@@ -234,6 +238,18 @@ UpdateRegionMappingRecursive (
     AttributeClearMask
     ));
 
+  //
+  // Block and page entries of a live table that keep their output address
+  // do not need a break-before-make sequence, so when the MMU is on, they are
+  // all updated first and the TLB maintenance is done once for the table
+  // rather than once for each entry.
+  //
+  DeferTlbMaintenance = TableIsLive && ArmMmuEnabled ();
+  UpdatedEntryCount   = 0;
+  UpdatedEntry        = NULL;
+  UpdatedRegionStart  = 0;
+  Status              = EFI_SUCCESS;
+
   for ( ; RegionStart < RegionEnd; RegionStart = BlockEnd) {
     BlockEnd = MIN (RegionEnd, (RegionStart | BlockMask) + 1);
     Entry    = &PageTable[(RegionStart >> (64 - BlockShift)) & (TT_ENTRY_COUNT - 1)];
@@ -274,7 +290,8 @@ UpdateRegionMappingRecursive (
         //
         TranslationTable = AllocatePages (1);
         if (TranslationTable == NULL) {
-          return EFI_OUT_OF_RESOURCES;
+          Status = EFI_OUT_OF_RESOURCES;
+          break;
         }
 
         if (!ArmMmuEnabled ()) {
@@ -308,7 +325,7 @@ UpdateRegionMappingRecursive (
             // by it, and so we only have to free the page we allocated here.
             //
             FreePages (TranslationTable, 1);
-            return Status;
+            break;
           }
         }
 
@@ -342,7 +359,7 @@ UpdateRegionMappingRecursive (
           FreePageTablesRecursive (TranslationTable, Level + 1);
         }
 
-        return Status;
+        break;
       }
 
       if (!IsTableEntry (*Entry, Level)) {
@@ -361,11 +378,32 @@ UpdateRegionMappingRecursive (
       EntryValue |= (Level == 3) ? TT_TYPE_BLOCK_ENTRY_LEVEL3
                                  : TT_TYPE_BLOCK_ENTRY;
 
-      ReplaceTableEntry (Entry, EntryValue, RegionStart, BlockMask, FALSE);
+      if (!TableIsLive) {
+        //
+        // The table is not reachable by the page table walker yet, so none
+        // of its entries can be held in the TLBs.
+        //
+        *Entry = EntryValue;
+      } else if (DeferTlbMaintenance) {
+        *Entry = EntryValue;
+        if (UpdatedEntryCount++ == 0) {
+          UpdatedEntry       = Entry;
+          UpdatedRegionStart = RegionStart;
+        }
+      } else {
+        ReplaceTableEntry (Entry, EntryValue, RegionStart, BlockMask, FALSE);
+      }
     }
   }
 
-  return EFI_SUCCESS;
+  if (UpdatedEntryCount == 1) {
+    ArmUpdateTranslationTableEntry (UpdatedEntry, (VOID *)(UINTN)UpdatedRegionStart);
+  } else if (UpdatedEntryCount > 1) {
+    ArmDataSynchronizationBarrier ();
+    ArmInvalidateTlb ();
+  }
+
+  return Status;
 }
 
 STATIC
@@ -713,6 +751,12 @@ ArmConfigureMmu (
     MAIR_ATTR (TT_ATTR_INDX_MEMORY_WRITE_BACK, MAIR_ATTR_NORMAL_MEMORY_WRITE_BACK)
     );
 
+  //
+  // The new translation tables were populated without TLB maintenance, so
+  // make sure the page table walker observes them, and if the MMU is already
+  // on, drop what the TLBs still hold from the tables they replace.
+  //
+  ArmDataSynchronizationBarrier ();
   ArmSetTTBR0 (TranslationTable);
 
   if (!ArmMmuEnabled ()) {
@@ -722,6 +766,8 @@ ArmConfigureMmu (
     ArmEnableDataCache ();
 
     ArmEnableMmu ();
+  } else {
+    ArmInvalidateTlb ();
   }
 
   return EFI_SUCCESS;
@@ -539,6 +539,7 @@ ScanSections32 (
   }
   assert (mCoffFile != NULL);
   memset(mCoffFile, 0, mCoffOffset);
+  mCoffFileSize = mCoffOffset;
 
   //
   // Fill headers.
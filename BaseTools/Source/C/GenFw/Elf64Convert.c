@@ -93,6 +93,7 @@ typedef Elf64_Dyn Elf_Dyn;
 STATIC Elf_Ehdr *mEhdr;
 STATIC Elf_Shdr *mShdrBase;
 STATIC Elf_Phdr *mPhdrBase;
+STATIC Elf_Shdr *mStrtabShdr;
 
 //
 // GOT information
@@ -102,6 +103,7 @@ STATIC UINT32   mGOTShindex = 0;
 STATIC UINT32   *mGOTCoffEntries = NULL;
 STATIC UINT32   mGOTMaxCoffEntries = 0;
 STATIC UINT32   mGOTNumCoffEntries = 0;
+STATIC UINT8    *mGOTCoffEntryMap = NULL;
 
 //
 // Coff information
@@ -197,6 +199,7 @@ InitializeElf64 (
   VerboseMsg ("Update Header Pointers");
   mShdrBase  = (Elf_Shdr *)((UINT8 *)mEhdr + mEhdr->e_shoff);
   mPhdrBase = (Elf_Phdr *)((UINT8 *)mEhdr + mEhdr->e_phoff);
+  mStrtabShdr = NULL;
 
   //
   // Create COFF Section offset buffer and zero.
@@ -329,9 +332,17 @@ FindStrtabShdr (
   )
 {
   UINT32 i;
+
+  //
+  // The string table is looked up for every symbol name, so remember it.
+  //
+  if (mStrtabShdr != NULL) {
+    return mStrtabShdr;
+  }
   for (i = 0; i < mEhdr->e_shnum; i++) {
     Elf_Shdr *shdr = GetShdrByIndex(i);
     if (IsStrtabShdr(shdr)) {
+      mStrtabShdr = shdr;
       return shdr;
     }
   }
@@ -440,8 +451,9 @@ FindElfGOTSectionFromGOTEntryElfRva (
 //
 // Stores locations of GOT entries in COFF image.
 //   Returns TRUE if GOT entry is new.
-//   Simple implementation as number of GOT
-//   entries is expected to be low.
+//   A bitmap of the bytes of the section hosting
+//   the GOT tells the entries already seen, as a
+//   large module refers to thousands of them.
 //
 
 STATIC
@@ -450,14 +462,26 @@ AccumulateCoffGOTEntries (
   UINT32 GOTCoffEntry
   )
 {
-  UINT32 i;
-  if (mGOTCoffEntries != NULL) {
-    for (i = 0; i < mGOTNumCoffEntries; i++) {
-      if (mGOTCoffEntries[i] == GOTCoffEntry) {
-        return FALSE;
-      }
+  UINT32 Index;
+
+  assert (mGOTShdr != NULL);
+  if (mGOTCoffEntryMap == NULL) {
+    mGOTCoffEntryMap = (UINT8*)calloc((size_t)((mGOTShdr->sh_size + 7) / 8), 1);
+    if (mGOTCoffEntryMap == NULL) {
+      Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
     }
+    assert (mGOTCoffEntryMap != NULL);
+  }
+  Index = GOTCoffEntry - mCoffSectionsOffset[mGOTShindex];
+  if (Index >= mGOTShdr->sh_size) {
+    Error (NULL, 0, 3000, "Invalid", "AccumulateCoffGOTEntries: GOT entry 0x%08X is outside of the GOT section.", GOTCoffEntry);
+    exit(EXIT_FAILURE);
   }
+  if ((mGOTCoffEntryMap[Index / 8] & (1 << (Index % 8))) != 0) {
+    return FALSE;
+  }
+  mGOTCoffEntryMap[Index / 8] |= (UINT8)(1 << (Index % 8));
+
   if (mGOTCoffEntries == NULL) {
     mGOTCoffEntries = (UINT32*)malloc(5 * sizeof *mGOTCoffEntries);
     if (mGOTCoffEntries == NULL) {
@@ -528,6 +552,8 @@ EmitGOTRelocations (
   mGOTCoffEntries = NULL;
   mGOTMaxCoffEntries = 0;
   mGOTNumCoffEntries = 0;
+  free(mGOTCoffEntryMap);
+  mGOTCoffEntryMap = NULL;
 }
 //
 // RISC-V 64 specific Elf WriteSection function.
@@ -1123,6 +1149,7 @@ ScanSections64 (
   }
   assert (mCoffFile != NULL);
   memset(mCoffFile, 0, mCoffOffset);
+  mCoffFileSize = mCoffOffset;
 
   //
   // Fill headers.
@@ -33,6 +33,11 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 //
 UINT8 *mCoffFile = NULL;
 
+//
+// Allocated size of the Coff file in memory.
+//
+UINT32 mCoffFileSize = 0;
+
 //
 // COFF relocation data
 //
@@ -77,6 +82,9 @@ CoffAddFixup(
   UINT8  Type
   )
 {
+  UINT32  Required;
+  UINT32  NewSize;
+
   if (mCoffBaseRel == NULL
       || mCoffBaseRel->VirtualAddress != (Offset & ~0xfff)) {
     if (mCoffBaseRel != NULL) {
@@ -92,18 +100,25 @@ CoffAddFixup(
         CoffAddFixupEntry (0);
     }
 
-    mCoffFile = realloc (
-      mCoffFile,
-      mCoffOffset + sizeof(EFI_IMAGE_BASE_RELOCATION) + 2 * MAX_COFF_ALIGNMENT
-      );
-    if (mCoffFile == NULL) {
-      Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    //
+    // Grow the buffer geometrically, so that a large image does not need one
+    // reallocation per relocated page. The bytes past mCoffOffset are zeroed
+    // when they are allocated and only written by CoffAddFixupEntry().
+    //
+    Required = mCoffOffset + sizeof(EFI_IMAGE_BASE_RELOCATION) + 2 * MAX_COFF_ALIGNMENT;
+    if (Required > mCoffFileSize) {
+      NewSize = mCoffFileSize * 2;
+      if (NewSize < Required) {
+        NewSize = Required;
+      }
+      mCoffFile = realloc (mCoffFile, NewSize);
+      if (mCoffFile == NULL) {
+        Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+      }
+      assert (mCoffFile != NULL);
+      memset (mCoffFile + mCoffFileSize, 0, NewSize - mCoffFileSize);
+      mCoffFileSize = NewSize;
     }
-    assert (mCoffFile != NULL);
-    memset (
-      mCoffFile + mCoffOffset, 0,
-      sizeof(EFI_IMAGE_BASE_RELOCATION) + 2 * MAX_COFF_ALIGNMENT
-      );
 
     mCoffBaseRel = (EFI_IMAGE_BASE_RELOCATION*)(mCoffFile + mCoffOffset);
     mCoffBaseRel->VirtualAddress = Offset & ~0xfff;
@@ -44,6 +44,7 @@ static CONVERTER_TYPE mConType = NoConverter;
 
 UINT64 mDictionarySize = 28;
 UINT64 mCompressionMode = 2;
+UINT64 mNumThreads = 2;
 
 #define UTILITY_NAME "LzmaCompress"
 #define UTILITY_MAJOR_VERSION 0
@@ -65,6 +66,9 @@ void PrintHelp(char *buffer)
              "  --debug [0-9]: set debug level\n"
              "  -a: set compression mode 0 = fast, 1 = normal, default: 1 (normal)\n"
              "  d: sets Dictionary size - [0, 27], default: 24 (16MB)\n"
+             "  --threads N: set number of encoder threads - [1, 2], default: 2\n"
+             "    The match finder runs in its own thread, the output is identical\n"
+             "    for any number of threads.\n"
              "  --version: display the program version and exit\n"
              "  -h, --help: display this help text\n"
              );
@@ -296,6 +300,18 @@ int main2(int numArgs, const char *args[], char *rs)
       } else {
         return PrintError(rs, kInvalidParamValMessage);
       }
+    } else if (strcmp(args[param], "--threads") == 0) {
+      if (numArgs < (param + 2)) {
+        return PrintUserError(rs);
+      }
+      AsciiStringToUint64(args[param + 1],FALSE,&mNumThreads);
+      if ((mNumThreads == 1)||(mNumThreads == 2)){
+        props.numThreads = (int)mNumThreads;
+        param++;
+        continue;
+      } else {
+        return PrintError(rs, kInvalidParamValMessage);
+      }
     } else if (strcmp(args[param], "d") == 0) {
       AsciiStringToUint64(args[param + 1],FALSE,&mDictionarySize);
       if (mDictionarySize <= 27) {
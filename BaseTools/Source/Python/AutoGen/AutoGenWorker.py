@@ -208,6 +208,7 @@ class AutoGenWorkerInProcess(mp.Process):
             GlobalData.gUseHashCache = self.data_pipe.Get("UseHashCache")
             GlobalData.gBinCacheSource = self.data_pipe.Get("BinCacheSource")
             GlobalData.gBinCacheDest = self.data_pipe.Get("BinCacheDest")
+            GlobalData.gBinCacheSourceUrl = self.data_pipe.Get("BinCacheSourceUrl")
             GlobalData.gPlatformHashFile = self.data_pipe.Get("PlatformHashFile")
             GlobalData.gModulePreMakeCacheStatus = dict()
             GlobalData.gModuleMakeCacheStatus = dict()
@@ -1613,6 +1613,12 @@ class TopLevelMakefile(BuildFile):
             ExtraOption += " --no-genfds-multi-thread"
         if GlobalData.gIgnoreSource:
             ExtraOption += " --ignore-sources"
+        if GlobalData.gUseHashCache:
+            ExtraOption += " --hash"
+            if GlobalData.gBinCacheDest:
+                ExtraOption += " --binary-destination " + GlobalData.gBinCacheDest
+            if GlobalData.gBinCacheSource:
+                ExtraOption += " --binary-source " + GlobalData.gBinCacheSource
 
         for pcd in GlobalData.BuildOptionPcd:
             if pcd[2]:
@@ -0,0 +1,209 @@
+## @file
+# Create ninja build files to schedule the module builds of a platform
+#
+# Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+# SPDX-License-Identifier: BSD-2-Clause-Patent
+#
+
+## Import Modules
+#
+from __future__ import absolute_import
+import Common.LongFilePathOs as os
+import sys
+from Common.Misc import SaveFileOnChange, TemplateString
+
+## Name of the ninja file of the platform and of each module
+NINJA_FILE_NAME = "build.ninja"
+
+## Name of the depfile which lists the header files a module includes
+NINJA_DEP_FILE_NAME = "ninja.d"
+
+## Escape a path so that it can be used in a build statement of a ninja file
+#
+#   @param      Path    The path to escape
+#
+#   @retval     string  The escaped path
+#
+def NinjaEscapePath(Path):
+    return Path.replace('$', '$$').replace(' ', '$ ').replace(':', '$:')
+
+## Escape a path so that it can be used in a depfile read by ninja
+#
+#   @param      Path    The path to escape
+#
+#   @retval     string  The escaped path
+#
+def DepfileEscapePath(Path):
+    return Path.replace('$', '$$').replace(' ', '\\ ').replace('#', '\\#')
+
+## Return the output files of a module, that is the final build targets of its makefile
+#
+#   @param      ModuleAutoGen   Object of ModuleAutoGen class
+#
+#   @retval     list            The paths of the output files
+#
+def GetNinjaOutputList(ModuleAutoGen):
+    OutputList = [str(T.Target) for T in ModuleAutoGen.CodaTargetList]
+    if not OutputList:
+        # A module without build rules, like one with a custom makefile, builds every time
+        OutputList = [os.path.join(ModuleAutoGen.MakeFileDir, ModuleAutoGen.Name + ".always")]
+    return OutputList
+
+## ModuleNinjaFile class
+#
+#  This class encapsules the ninja file of a module. It contains a single build
+#  statement which runs the makefile of the module when any of its inputs, the
+#  outputs of the libraries it links, or the headers listed in its depfile change.
+#  The rule used by the statement is defined in the ninja file of the platform.
+#
+class ModuleNinjaFile(object):
+    _TEMPLATE_ = TemplateString('''\
+#
+# DO NOT EDIT
+# This file is auto-generated by build utility
+#
+# Abstract:
+#
+#   Auto-generated ninja file for building module ${module_file} [${arch}]
+#
+
+build ${BEGIN}${output} ${END}: make_module |${BEGIN} ${input}${END}
+  dir = ${module_build_directory}
+  makefile = ${makefile_path}
+  desc = Building ${module_file} [${arch}]
+''')
+
+    ## Constructor of ModuleNinjaFile
+    #
+    #   @param  ModuleAutoGen   Object of ModuleAutoGen class
+    #   @param  MakefilePath    The path of the makefile of the module
+    #
+    def __init__(self, ModuleAutoGen, MakefilePath):
+        self._AutoGenObject = ModuleAutoGen
+        self.MakefilePath = MakefilePath
+
+    @property
+    def _TemplateDict(self):
+        MyAgo = self._AutoGenObject
+
+        InputList = [MyAgo.MetaFile.Path, self.MakefilePath]
+        InputList.extend(F.Path for F in MyAgo.SourceFileList)
+        InputList.extend(F.Path for F in MyAgo.AutoGenFileList)
+        if not MyAgo.IsLibrary:
+            for LibraryAutoGen in MyAgo.LibraryAutoGenList:
+                if not LibraryAutoGen.IsBinaryModule:
+                    InputList.extend(GetNinjaOutputList(LibraryAutoGen))
+
+        return {
+            "module_file"               : MyAgo.MetaFile.File,
+            "arch"                      : MyAgo.Arch,
+            "output"                    : [NinjaEscapePath(F) for F in GetNinjaOutputList(MyAgo)],
+            "input"                     : [NinjaEscapePath(F) for F in sorted(set(InputList))],
+            "module_build_directory"    : MyAgo.MakeFileDir.replace('$', '$$'),
+            "makefile_path"             : self.MakefilePath.replace('$', '$$'),
+        }
+
+    ## Create the ninja file of the module
+    #
+    #   @retval TRUE     The ninja file is created or re-created successfully.
+    #   @retval FALSE    The ninja file exists and is the same as the one to be generated.
+    #
+    def Generate(self):
+        FileContent = self._TEMPLATE_.Replace(self._TemplateDict)
+        return SaveFileOnChange(os.path.join(self._AutoGenObject.MakeFileDir, NINJA_FILE_NAME), FileContent, False)
+
+## PlatformNinjaFile class
+#
+#  This class encapsules the ninja file which builds all modules of a platform
+#  for all architectures in one build graph. It defines the rule which runs the
+#  makefile of a module and includes the ninja file of every module.
+#
+class PlatformNinjaFile(object):
+    _TEMPLATE_ = TemplateString('''\
+#
+# DO NOT EDIT
+# This file is auto-generated by build utility
+#
+# Abstract:
+#
+#   Auto-generated ninja file for building the modules of platform ${platform_name}
+#
+
+ninja_required_version = 1.3
+
+make = ${make_command}
+target = ${make_target}
+
+rule make_module
+  command = ${module_command}
+  description = $desc
+  depfile = $dir${separator}${dep_file_name}
+  restat = 1
+
+${BEGIN}subninja ${module_ninja_file}
+${END}''')
+
+    ## command of the rule, which runs the makefile of a module in its build directory
+    _MODULE_COMMAND_ = {
+        "win32" :   'cmd /c cd /d "$dir" && $make -f "$makefile" $target',
+        "posix" :   'cd "$dir" && $make -f "$makefile" $target'
+    }
+
+    ## directory separator
+    _SEP_ = {
+        "win32" :   "\\",
+        "posix" :   "/"
+    }
+
+    ## Constructor of PlatformNinjaFile
+    #
+    #   @param  Workspace   Object of WorkspaceAutoGen class
+    #   @param  Target      The target of the module makefiles to build
+    #
+    def __init__(self, Workspace, Target):
+        self._AutoGenObject = Workspace.AutoGenObjectList[0]
+        self.Workspace = Workspace
+        self.Target = Target
+
+        if sys.platform == "win32":
+            self._Platform = "win32"
+        else:
+            self._Platform = "posix"
+
+    @property
+    def _TemplateDict(self):
+        PlatformAutoGen = self._AutoGenObject
+
+        MakeCommand = []
+        for Item in PlatformAutoGen.BuildCommand:
+            if ' ' in Item:
+                Item = '"%s"' % Item
+            MakeCommand.append(Item)
+
+        NinjaFileList = []
+        for Pa in self.Workspace.AutoGenObjectList:
+            DirList = Pa.DataPipe.Get("LibraryBuildDirectoryList") + Pa.DataPipe.Get("ModuleBuildDirectoryList")
+            for Dir in DirList:
+                NinjaFile = os.path.join(Dir, NINJA_FILE_NAME)
+                if os.path.exists(NinjaFile) and NinjaFile not in NinjaFileList:
+                    NinjaFileList.append(NinjaFile)
+
+        return {
+            "platform_name"     : PlatformAutoGen.Name,
+            "make_command"      : " ".join(MakeCommand).replace('$', '$$'),
+            "make_target"       : self.Target,
+            "module_command"    : self._MODULE_COMMAND_[self._Platform],
+            "separator"         : self._SEP_[self._Platform],
+            "dep_file_name"     : NINJA_DEP_FILE_NAME,
+            "module_ninja_file" : [NinjaEscapePath(F) for F in NinjaFileList],
+        }
+
+    ## Create the ninja file of the platform
+    #
+    #   @retval     string  The path of the ninja file
+    #
+    def Generate(self):
+        FileContent = self._TEMPLATE_.Replace(self._TemplateDict)
+        FilePath = os.path.join(self.Workspace.BuildDir, NINJA_FILE_NAME)
+        SaveFileOnChange(FilePath, FileContent, False)
+        return FilePath
@@ -20,7 +20,7 @@ from Common import GlobalData
 from Common import EdkLogger
 import Common.LongFilePathOs as os
 
-DATABASE_VERSION = 7
+DATABASE_VERSION = 8
 
 gPcdDatabaseAutoGenC = TemplateString("""
 //
@@ -1547,6 +1547,15 @@ def CreatePcdDatabasePhaseSpecificAutoGen (Platform, DynamicPcdList, Phase):
         Dict['LOCAL_TOKEN_NUMBER']            = NumberOfLocalTokens
 
     if NumberOfExTokens != 0:
+        #
+        # Sort the EXMAPPING_TABLE by token space guid index and then by dynamic-ex token number,
+        # so that the PCD Driver/PEIM can binary search it. This is required from DATABASE_VERSION 8 on.
+        #
+        ExMapTable = sorted(zip(Dict['EXMAPPING_TABLE_EXTOKEN'], Dict['EXMAPPING_TABLE_LOCAL_TOKEN'], Dict['EXMAPPING_TABLE_GUID_INDEX']),
+                            key=lambda Item: (GetIntegerValue(Item[2]), GetIntegerValue(Item[0])))
+        Dict['EXMAPPING_TABLE_EXTOKEN']     = [Item[0] for Item in ExMapTable]
+        Dict['EXMAPPING_TABLE_LOCAL_TOKEN'] = [Item[1] for Item in ExMapTable]
+        Dict['EXMAPPING_TABLE_GUID_INDEX']  = [Item[2] for Item in ExMapTable]
         Dict['EXMAP_TABLE_EMPTY']    = 'FALSE'
         Dict['EXMAPPING_TABLE_SIZE'] = str(NumberOfExTokens) + 'U'
         Dict['EX_TOKEN_NUMBER']      = str(NumberOfExTokens) + 'U'
@@ -11,6 +11,7 @@ import Common.LongFilePathOs as os
 from Common.BuildToolError import *
 from Common.Misc import SaveFileOnChange, PathClass
 from Common.Misc import TemplateString
+from AutoGen.GenNinja import GetNinjaOutputList, DepfileEscapePath, NINJA_DEP_FILE_NAME
 import sys
 gIsFileMap = {}
 
@@ -74,6 +75,12 @@ ${END}
     def CreateDepsTarget(self):
         SaveFileOnChange(os.path.join(self.makefile_folder,"deps_target"),"\n".join([item +":" for item in self.DepsCollection]),False)
 
+    def CreateNinjaDepfile(self):
+        """ Generate the depfile ninja reads to rebuild the module when one of its included files changes """
+        target = DepfileEscapePath(GetNinjaOutputList(self.module_autogen)[0])
+        deps = [DepfileEscapePath(item) for item in self.DepsCollection]
+        SaveFileOnChange(os.path.join(self.makefile_folder,NINJA_DEP_FILE_NAME)," \\\n  ".join([target +":"] + deps) + "\n",False)
+
     @cached_property
     def deps_files(self):
         """ Get all .deps file under module build folder. """
@@ -19,12 +19,14 @@ import hashlib
 from . import InfSectionParser
 from . import GenC
 from . import GenMake
+from . import GenNinja
 from . import GenDepex
 from io import BytesIO
 from GenPatchPcdTable.GenPatchPcdTable import parsePcdInfoFromMapFile
 from Workspace.MetaFileCommentParser import UsageList
 from .GenPcdDb import CreatePcdDatabaseCode
 from Common.caching import cached_class_function
+from Common.RemoteBinCache import RemoteBinCache, FetchBinCacheFile
 from AutoGen.ModuleAutoGenHelper import PlatformInfo,WorkSpaceInfo
 import json
 import tempfile
@@ -1700,6 +1702,9 @@ class ModuleAutoGen(AutoGen):
         # Create ModuleHashPair file to support multiple version cache together
         ModuleHashPair = path.join(FileDir, self.Name + ".ModuleHashPair")
         ModuleHashPairList = [] # tuple list: [tuple(PreMakefileHash, MakeHash)]
+        if GlobalData.gBinCacheDestUrl:
+            # Keep the pairs other builds uploaded to the remote cache
+            RemoteBinCache(GlobalData.gBinCacheDestUrl, GlobalData.gBinCacheDest).Fetch(ModuleHashPair, True)
         if os.path.exists(ModuleHashPair):
             with open(ModuleHashPair, 'r') as f:
                 ModuleHashPairList = json.load(f)
@@ -1725,6 +1730,49 @@ class ModuleAutoGen(AutoGen):
                     self.CacheCopyFile(FileDir, self.BuildDir, File)
                 else:
                     self.CacheCopyFile(CacheFileDir, self.BuildDir, File)
+
+        # Save the list of the cached files, with which a remote cache is restored
+        # without listing its directories
+        CacheFileList = {"Module": [], "Ffs": []}
+        for Key, Dir in (("Module", CacheFileDir), ("Ffs", CacheFfsDir)):
+            for Root, Dirs, Files in os.walk(Dir):
+                for File in Files:
+                    CacheFileList[Key].append(os.path.relpath(path.join(Root, File), Dir))
+        try:
+            with open(LongFilePath(path.join(FileDir, self.Name + ".CacheFileList." + MakeHashStr)), 'w') as f:
+                json.dump(CacheFileList, f, indent=2)
+        except:
+            EdkLogger.quiet("[cache warning]: fail to save CacheFileList file for module:%s[%s]" % (self.MetaFile.Path, self.Arch))
+
+    ## Download the cached build result of the module from a remote cache
+    #
+    #   @param      ModuleCacheDir      The cache directory of the module in gBinCacheSource
+    #   @param      MakeHash            The MakeHash of the build result
+    #   @param      SourceHashDir       The directory of the build result
+    #   @param      SourceFfsHashDir    The directory of the FFS files of the build result
+    #
+    #   @retval     True                The build result is downloaded
+    #
+    def FetchCacheFiles(self, ModuleCacheDir, MakeHash, SourceHashDir, SourceFfsHashDir):
+        if not GlobalData.gBinCacheSourceUrl:
+            return True
+
+        CacheFileList_FilePath = path.join(ModuleCacheDir, self.Name + ".CacheFileList." + MakeHash)
+        try:
+            FetchBinCacheFile(CacheFileList_FilePath)
+            with open(LongFilePath(CacheFileList_FilePath), 'r') as f:
+                CacheFileList = json.load(f)
+        except:
+            EdkLogger.quiet("[cache error]: fail to load CacheFileList file: %s" % CacheFileList_FilePath)
+            return False
+
+        for Key, Dir in (("Module", SourceHashDir), ("Ffs", SourceFfsHashDir)):
+            for File in CacheFileList.get(Key, []):
+                if not FetchBinCacheFile(path.join(Dir, File)):
+                    EdkLogger.quiet("[cache error]: fail to download cached file %s" % path.join(Dir, File))
+                    return False
+        return True
+
     ## Create makefile for the module and its dependent libraries
     #
     #   @param      CreateLibraryMakeFile   Flag indicating if or not the makefiles of
@@ -1746,6 +1794,12 @@ class ModuleAutoGen(AutoGen):
             for f in self.AutoGenDepSet:
                 FileSet.add (f.Path)
 
+            # a missing AutoGen file has to be created again
+            for f in self.AutoGenFileList:
+                FileSet.add (f.Path)
+
+            FileSet.add (os.path.join(self.MakeFileDir, GenNinja.NINJA_FILE_NAME))
+
             if os.path.exists (self.TimeStampPath):
                 os.remove (self.TimeStampPath)
 
@@ -1776,11 +1830,13 @@ class ModuleAutoGen(AutoGen):
             EdkLogger.debug(EdkLogger.DEBUG_9, "Skipped the generation of makefile for module %s [%s]" %
                             (self.Name, self.Arch))
 
-        CreateTimeStamp()
-
         MakefileType = Makefile._FileType
         MakefileName = Makefile._FILE_NAME_[MakefileType]
         MakefilePath = os.path.join(self.MakeFileDir, MakefileName)
+        GenNinja.ModuleNinjaFile(self, MakefilePath).Generate()
+
+        CreateTimeStamp()
+
         FilePath = path.join(self.BuildDir, self.Name + ".makefile")
         SaveFileOnChange(FilePath, MakefilePath, False)
 
@@ -1812,6 +1868,14 @@ class ModuleAutoGen(AutoGen):
             for LibraryAutoGen in self.LibraryAutoGenList:
                 LibraryAutoGen.CreateCodeFile()
 
+        # CanSkip uses timestamps to determine whether the AutoGen files are up to date.
+        # The PCD database of the PCD driver depends on all modules, so it is always created.
+        if self.PcdIsDriver == '' and self.CanSkip():
+            EdkLogger.debug(EdkLogger.DEBUG_9, "Skipped the generation of AutoGen files for module %s [%s]" %
+                            (self.Name, self.Arch))
+            self.IsCodeFileCreated = True
+            return []
+
         self.LibraryAutoGenList
         AutoGenList = []
         IgoredAutoGenList = []
@@ -2171,6 +2235,7 @@ class ModuleAutoGen(AutoGen):
 
         ModuleHashPairList = [] # tuple list: [tuple(PreMakefileHash, MakeHash)]
         ModuleHashPair = path.join(ModuleCacheDir, self.Name + ".ModuleHashPair")
+        FetchBinCacheFile(ModuleHashPair, True)
         try:
             with open(LongFilePath(ModuleHashPair), 'r') as f:
                 ModuleHashPairList = json.load(f)
@@ -2188,6 +2253,7 @@ class ModuleAutoGen(AutoGen):
             PreMakeHashFileList_FilePah = path.join(ModuleCacheDir, self.Name + ".PreMakeHashFileList." + PreMakefileHash)
             MakeHashFileList_FilePah = path.join(ModuleCacheDir, self.Name + ".MakeHashFileList." + MakeHash)
 
+            FetchBinCacheFile(MakeHashFileList_FilePah)
             try:
                 with open(LongFilePath(MakeHashFileList_FilePah), 'r') as f:
                     MakeHashFileList = json.load(f)
@@ -2208,6 +2274,7 @@ class ModuleAutoGen(AutoGen):
                 # Convert to path start with cache source dir
                 RelativePath = os.path.relpath(HashChainFile, self.WorkspaceDir)
                 NewFilePath = os.path.join(GlobalData.gBinCacheSource, RelativePath)
+                FetchBinCacheFile(NewFilePath)
                 if self.CheckHashChainFile(NewFilePath):
                     GlobalData.gHashChainStatus[HashChainFile] = True
                     # Save the module self HashFile for GenPreMakefileHashList later usage
@@ -2221,6 +2288,9 @@ class ModuleAutoGen(AutoGen):
             if HashMiss:
                 continue
 
+            if not self.FetchCacheFiles(ModuleCacheDir, MakeHash, SourceHashDir, SourceFfsHashDir):
+                continue
+
             # PreMakefile cache hit, restore the module build result
             for root, dir, files in os.walk(SourceHashDir):
                 for f in files:
@@ -2331,6 +2401,7 @@ class ModuleAutoGen(AutoGen):
 
         ModuleHashPairList = [] # tuple list: [tuple(PreMakefileHash, MakeHash)]
         ModuleHashPair = path.join(ModuleCacheDir, self.Name + ".ModuleHashPair")
+        FetchBinCacheFile(ModuleHashPair, True)
         try:
             with open(LongFilePath(ModuleHashPair), 'r') as f:
                 ModuleHashPairList = json.load(f)
@@ -2348,6 +2419,7 @@ class ModuleAutoGen(AutoGen):
             PreMakeHashFileList_FilePah = path.join(ModuleCacheDir, self.Name + ".PreMakeHashFileList." + PreMakefileHash)
             MakeHashFileList_FilePah = path.join(ModuleCacheDir, self.Name + ".MakeHashFileList." + MakeHash)
 
+            FetchBinCacheFile(PreMakeHashFileList_FilePah)
             try:
                 with open(LongFilePath(PreMakeHashFileList_FilePah), 'r') as f:
                     PreMakeHashFileList = json.load(f)
@@ -2368,6 +2440,7 @@ class ModuleAutoGen(AutoGen):
                 # Convert to path start with cache source dir
                 RelativePath = os.path.relpath(HashChainFile, self.WorkspaceDir)
                 NewFilePath = os.path.join(GlobalData.gBinCacheSource, RelativePath)
+                FetchBinCacheFile(NewFilePath)
                 if self.CheckHashChainFile(NewFilePath):
                     GlobalData.gHashChainStatus[HashChainFile] = True
                 else:
@@ -2378,6 +2451,9 @@ class ModuleAutoGen(AutoGen):
             if HashMiss:
                 continue
 
+            if not self.FetchCacheFiles(ModuleCacheDir, MakeHash, SourceHashDir, SourceFfsHashDir):
+                continue
+
             # PreMakefile cache hit, restore the module build result
             for root, dir, files in os.walk(SourceHashDir):
                 for f in files:
@@ -192,8 +192,7 @@ def CreateHFile(BaseName, UniObjectClass, IsCompatibleMode, UniGenCFlag):
 # @param Array:      The array need to be formatted
 #
 def CreateBinBuffer(BinBuffer, Array):
-    for Item in Array:
-        BinBuffer.write(pack("B", int(Item, 16)))
+    BinBuffer.write(bytes(int(Item, 16) for Item in Array))
 
 ## Create a formatted string all items in an array
 #
@@ -457,12 +456,13 @@ def CreateCFileEnd():
 # @param UniObjectClass   A UniObjectClass instance
 # @param IsCompatibleMode Compatible Mode
 # @param FilterInfo       Platform language filter information
+# @param UniBinBuffer     Buffer to also store the binary string packages, or None
 #
 # @retval CFile:          A string of complete .c file
 #
-def CreateCFile(BaseName, UniObjectClass, IsCompatibleMode, FilterInfo):
+def CreateCFile(BaseName, UniObjectClass, IsCompatibleMode, FilterInfo, UniBinBuffer = None):
     CFile = ''
-    CFile = WriteLine(CFile, CreateCFileContent(BaseName, UniObjectClass, IsCompatibleMode, None, FilterInfo))
+    CFile = WriteLine(CFile, CreateCFileContent(BaseName, UniObjectClass, IsCompatibleMode, UniBinBuffer, FilterInfo))
     CFile = WriteLine(CFile, CreateCFileEnd())
     return "".join(CFile)
 
@@ -565,8 +565,8 @@ def GetStringFiles(UniFilList, SourceFileList, IncludeList, IncludePathList, Ski
     HFile = CreateHFile(BaseName, Uni, IsCompatibleMode, UniGenCFlag)
     CFile = None
     if IsCompatibleMode or UniGenCFlag:
-        CFile = CreateCFile(BaseName, Uni, IsCompatibleMode, FilterInfo)
-    if UniGenBinBuffer:
+        CFile = CreateCFile(BaseName, Uni, IsCompatibleMode, FilterInfo, UniGenBinBuffer)
+    elif UniGenBinBuffer:
         CreateCFileContent(BaseName, Uni, IsCompatibleMode, UniGenBinBuffer, FilterInfo)
 
     return HFile, CFile
@@ -50,12 +50,7 @@ gIncludePattern = re.compile("^#include +[\"<]+([^\"< >]+)[>\"]+$", re.MULTILINE
 # @retval List:  The formatted hex list
 #
 def UniToHexList(Uni):
-    List = []
-    for Item in Uni:
-        Temp = '%04X' % ord(Item)
-        List.append('0x' + Temp[2:4])
-        List.append('0x' + Temp[0:2])
-    return List
+    return ['0x%02X' % Item for Item in Uni.encode('utf-16-le')]
 
 LangConvTable = {'eng':'en', 'fra':'fr', \
                  'aar':'aa', 'abk':'ab', 'ave':'ae', 'afr':'af', 'aka':'ak', 'amh':'am', \
@@ -168,7 +163,6 @@ codecs.register(Ucs2Search)
 class StringDefClassObject(object):
     def __init__(self, Name = None, Value = None, Referenced = False, Token = None, UseOtherLangDef = ''):
         self.StringName = ''
-        self.StringNameByteList = []
         self.StringValue = ''
         self.StringValueByteList = ''
         self.Token = 0
@@ -178,7 +172,6 @@ class StringDefClassObject(object):
 
         if Name is not None:
             self.StringName = Name
-            self.StringNameByteList = UniToHexList(Name)
         if Value is not None:
             self.StringValue = Value + u'\x00'        # Add a NULL at string tail
             self.StringValueByteList = UniToHexList(self.StringValue)
@@ -899,6 +899,10 @@ class WorkspaceAutoGen(AutoGen):
             FdsCommandDict["quiet"] = True
 
         FdsCommandDict["GenfdsMultiThread"] = GlobalData.gEnableGenfdsMultiThread
+        if GlobalData.gUseHashCache:
+            FdsCommandDict["UseHashCache"] = True
+            FdsCommandDict["BinCacheDest"] = GlobalData.gBinCacheDest
+            FdsCommandDict["BinCacheSource"] = GlobalData.gBinCacheSource
         if GlobalData.gIgnoreSource:
             FdsCommandDict["IgnoreSources"] = True
 
@@ -33,6 +33,7 @@ from Common.Uefi.Capsule.FmpCapsuleHeader  import FmpCapsuleHeaderClass
 from Common.Uefi.Capsule.FmpAuthHeader     import FmpAuthHeaderClass
 from Common.Uefi.Capsule.CapsuleDependency import CapsuleDependencyClass
 from Common.Edk2.Capsule.FmpPayloadHeader  import FmpPayloadHeaderClass
+from Common.Edk2.Capsule.FmpDeltaPayload   import FmpDeltaPayloadClass
 
 #
 # Globals for help information
@@ -1111,6 +1112,10 @@ if __name__ == '__main__':
     parser.add_argument ("--debug", dest = 'Debug', type = int, metavar = '[0-9]', choices = range (0, 10), default = 0,
                          help = "Set debug level")
     parser.add_argument ("--update-image-index", dest = 'UpdateImageIndex', type = ValidateUnsignedInteger, default = 0x01, help = "unique number identifying the firmware image within the device ")
+    parser.add_argument ("--delta-base", dest = 'DeltaBaseFile', type = argparse.FileType('rb'),
+                         help = "Encode the payload as a delta against this image, which must be the image currently in the firmware device.")
+    parser.add_argument ("--delta-block-size", dest = 'DeltaBlockSize', type = ValidateUnsignedInteger, default = 0x1000,
+                         help = "Size in bytes of the blocks of a delta payload.  Default is 0x1000.")
 
     #
     # Parse command line arguments
@@ -1134,6 +1139,26 @@ if __name__ == '__main__':
             print ('GenerateCapsule: error: can not read binary input file {File}'.format (File = args.InputFile.name))
             sys.exit (1)
 
+    #
+    # Replace the binary input file by a delta payload against the current image
+    #
+    if args.DeltaBaseFile:
+        if not args.Encode or args.JsonFile:
+            print ('GenerateCapsule: error: --delta-base requires --encode without --json-file')
+            sys.exit (1)
+        FmpDeltaPayload = FmpDeltaPayloadClass ()
+        try:
+            FmpDeltaPayload.BaseImage = args.DeltaBaseFile.read ()
+            args.DeltaBaseFile.close ()
+            FmpDeltaPayload.BlockSize = args.DeltaBlockSize
+            FmpDeltaPayload.Payload   = Buffer
+            Buffer = FmpDeltaPayload.Encode ()
+            if args.Verbose:
+                FmpDeltaPayload.DumpInfo ()
+        except:
+            print ('GenerateCapsule: error: can not encode delta payload against {File}'.format (File = args.DeltaBaseFile.name))
+            sys.exit (1)
+
     #
     # Create objects
     #
@@ -0,0 +1,91 @@
+## @file
+# Module that encodes a firmware image as a delta payload against the image
+# currently in the firmware device. The delta payload is processed by FmpDxe
+# in the FmpDevicePkg when PcdFmpDeviceDeltaPayloadEnable is TRUE.
+#
+# Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+# SPDX-License-Identifier: BSD-2-Clause-Patent
+#
+
+'''
+FmpDeltaPayload
+'''
+
+import struct
+import hashlib
+
+def _SIGNATURE_32 (A, B, C, D):
+    return struct.unpack ('=I',bytearray (A + B + C + D, 'ascii'))[0]
+
+class FmpDeltaPayloadClass (object):
+    #
+    # typedef struct {
+    #   UINT32  Signature;
+    #   UINT32  HeaderSize;
+    #   UINT32  BlockSize;
+    #   UINT32  BlockCount;
+    #   UINT64  BaseImageSize;
+    #   UINT64  TargetImageSize;
+    #   UINT8   BaseImageDigest[32];
+    #   UINT8   TargetImageDigest[32];
+    # } FMP_DELTA_PAYLOAD_HEADER;
+    #
+    # typedef struct {
+    #   UINT32  BlockIndex;
+    # } FMP_DELTA_PAYLOAD_BLOCK;
+    #
+    # #define FMP_DELTA_PAYLOAD_SIGNATURE SIGNATURE_32 ('F', 'D', 'L', '1')
+    #
+    _StructFormat      = '<IIIIQQ32s32s'
+    _StructSize        = struct.calcsize (_StructFormat)
+    _BlockStructFormat = '<I'
+
+    _FMP_DELTA_PAYLOAD_SIGNATURE = _SIGNATURE_32 ('F', 'D', 'L', '1')
+
+    def __init__ (self):
+        self._Valid     = False
+        self.BlockSize  = 0x1000
+        self.BlockCount = 0
+        self.BaseImage  = b''
+        self.Payload    = b''
+
+    def Encode (self):
+        if self.BlockSize == 0 or self.BlockSize > 0xFFFFFFFF or len (self.Payload) == 0:
+            raise ValueError
+
+        #
+        # Only keep the blocks which differ from the base image. The bytes
+        # beyond the end of the base image read as erased flash.
+        #
+        BaseImage = self.BaseImage[:len (self.Payload)]
+        BaseImage += b'\xff' * (len (self.Payload) - len (BaseImage))
+        Blocks = []
+        for Offset in range (0, len (self.Payload), self.BlockSize):
+            Block = self.Payload[Offset:Offset + self.BlockSize]
+            if Block != BaseImage[Offset:Offset + self.BlockSize]:
+                Blocks.append (struct.pack (self._BlockStructFormat, Offset // self.BlockSize) + Block)
+        if len (Blocks) > 0xFFFFFFFF:
+            raise ValueError
+        self.BlockCount = len (Blocks)
+
+        FmpDeltaPayloadHeader = struct.pack (
+                                         self._StructFormat,
+                                         self._FMP_DELTA_PAYLOAD_SIGNATURE,
+                                         self._StructSize,
+                                         self.BlockSize,
+                                         self.BlockCount,
+                                         len (self.BaseImage),
+                                         len (self.Payload),
+                                         hashlib.sha256 (self.BaseImage).digest (),
+                                         hashlib.sha256 (self.Payload).digest ()
+                                         )
+        self._Valid = True
+        return FmpDeltaPayloadHeader + b''.join (Blocks)
+
+    def DumpInfo (self):
+        if not self._Valid:
+            raise ValueError
+        print ('FMP_DELTA_PAYLOAD_HEADER.BlockSize        = {BlockSize:08X}'.format (BlockSize = self.BlockSize))
+        print ('FMP_DELTA_PAYLOAD_HEADER.BlockCount       = {BlockCount:08X}'.format (BlockCount = self.BlockCount))
+        print ('FMP_DELTA_PAYLOAD_HEADER.BaseImageSize    = {Size:016X}'.format (Size = len (self.BaseImage)))
+        print ('FMP_DELTA_PAYLOAD_HEADER.TargetImageSize  = {Size:016X}'.format (Size = len (self.Payload)))
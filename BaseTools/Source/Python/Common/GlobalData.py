@@ -78,6 +78,10 @@ gBuildDirectory = ''
 # The relative default database file path
 #
 gDatabasePath = ".cache/build.db"
+#
+# The relative default directory of the parsed INF and DEC files
+#
+gMetaFileCachePath = ".cache/MetaFile"
 
 #
 # Build flag for binary build
@@ -105,6 +109,10 @@ gConditionalPcds = []
 gUseHashCache = None
 gBinCacheDest = None
 gBinCacheSource = None
+# URL of the remote cache, when gBinCacheSource or gBinCacheDest is its local mirror
+gBinCacheSourceUrl = None
+gBinCacheDestUrl = None
+gUseNinja = False
 gPlatformHash = None
 gPlatformHashFile = None
 gPackageHash = None
@@ -41,6 +41,9 @@ def makedirs(name, mode=0o777):
 def rename(old, new):
     return os.rename(LongFilePath(old), LongFilePath(new))
 
+def replace(old, new):
+    return os.replace(LongFilePath(old), LongFilePath(new))
+
 def chdir(path):
     return os.chdir(LongFilePath(path))
 
@@ -0,0 +1,153 @@
+## @file
+# Share the binary cache of --binary-source and --binary-destination through an HTTP server
+#
+# The remote cache has the same layout as a cache directory. The build works on a
+# local mirror of it: the files of the cache are downloaded into the mirror when
+# they are read, and the files the build adds to the mirror are uploaded with an
+# HTTP PUT request. So a file server which accepts PUT, or an S3 compatible object
+# store, can hold the cache.
+#
+# Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+# SPDX-License-Identifier: BSD-2-Clause-Patent
+#
+
+## Import Modules
+#
+from __future__ import absolute_import
+import os
+import hashlib
+import json
+from urllib.request import Request, urlopen
+from urllib.error import HTTPError
+from urllib.parse import quote
+import Common.EdkLogger as EdkLogger
+import Common.GlobalData as GlobalData
+from Common.LongFilePathSupport import LongFilePath
+
+## Seconds to wait for the server before the cache is considered unavailable
+REMOTE_BIN_CACHE_TIMEOUT = 30
+
+## Name of the file which records the files of the mirror already uploaded
+REMOTE_BIN_CACHE_INDEX = ".RemoteBinCacheIndex"
+
+## Return True if the cache location of --binary-source or --binary-destination is an URL
+#
+#   @param  Location    The value of the option
+#
+def IsRemoteBinCache(Location):
+    return Location.lower().startswith(("http://", "https://"))
+
+## Return the directory of the local mirror of a remote cache
+#
+#   @param  Url         The URL of the remote cache
+#
+def GetRemoteBinCacheMirror(Url):
+    return os.path.join(GlobalData.gConfDirectory, ".cache", "BinCache", hashlib.md5(Url.encode('utf-8')).hexdigest())
+
+## RemoteBinCache class
+#
+#  This class transfers the files between a remote cache and its local mirror.
+#
+class RemoteBinCache(object):
+    ## Constructor
+    #
+    #   @param  Url         The URL of the remote cache
+    #   @param  MirrorDir   The directory of the local mirror
+    #
+    def __init__(self, Url, MirrorDir):
+        self.Url = Url.rstrip('/')
+        self.MirrorDir = MirrorDir
+
+    def _GetUrl(self, FilePath):
+        return self.Url + '/' + quote(os.path.relpath(FilePath, self.MirrorDir).replace(os.sep, '/'))
+
+    ## Download a file of the remote cache into the local mirror
+    #
+    #   @param  FilePath    The path of the file in the local mirror
+    #   @param  Refresh     Download the file even if the mirror has it, for the
+    #                       files which are updated in place like ModuleHashPair
+    #
+    #   @retval True        The file is in the local mirror
+    #   @retval False       The file is not in the cache
+    #
+    def Fetch(self, FilePath, Refresh=False):
+        if os.path.exists(FilePath) and not Refresh:
+            return True
+
+        try:
+            with urlopen(self._GetUrl(FilePath), timeout=REMOTE_BIN_CACHE_TIMEOUT) as Response:
+                Content = Response.read()
+        except HTTPError as X:
+            if X.code == 404:
+                return False
+            EdkLogger.quiet("[cache warning]: fail to download %s: %s" % (self._GetUrl(FilePath), X))
+            return os.path.exists(FilePath)
+        except Exception as X:
+            EdkLogger.quiet("[cache warning]: fail to download %s: %s" % (self._GetUrl(FilePath), X))
+            return os.path.exists(FilePath)
+
+        # Write a temporary file first, so that a concurrent reader never sees a partial file
+        TempPath = "%s.%d.tmp" % (FilePath, os.getpid())
+        try:
+            if not os.path.exists(os.path.dirname(FilePath)):
+                os.makedirs(os.path.dirname(FilePath))
+            with open(LongFilePath(TempPath), 'wb') as File:
+                File.write(Content)
+            os.replace(TempPath, FilePath)
+        except Exception as X:
+            EdkLogger.quiet("[cache warning]: fail to save %s: %s" % (FilePath, X))
+            return False
+        return True
+
+    ## Upload the files of the local mirror which are new or changed since the last upload
+    #
+    def Upload(self):
+        IndexPath = os.path.join(self.MirrorDir, REMOTE_BIN_CACHE_INDEX)
+        Index = {}
+        try:
+            with open(LongFilePath(IndexPath), 'r') as File:
+                Index = json.load(File)
+        except Exception:
+            pass
+
+        Count = 0
+        for Root, Dirs, Files in os.walk(self.MirrorDir):
+            for Name in Files:
+                FilePath = os.path.join(Root, Name)
+                if FilePath == IndexPath or Name.endswith('.tmp'):
+                    continue
+                Stat = os.stat(FilePath)
+                Key = os.path.relpath(FilePath, self.MirrorDir)
+                if Index.get(Key) == [Stat.st_size, Stat.st_mtime]:
+                    continue
+                try:
+                    with open(LongFilePath(FilePath), 'rb') as File:
+                        Content = File.read()
+                    Req = Request(self._GetUrl(FilePath), data=Content, method='PUT')
+                    Req.add_header('Content-Type', 'application/octet-stream')
+                    with urlopen(Req, timeout=REMOTE_BIN_CACHE_TIMEOUT):
+                        pass
+                except Exception as X:
+                    EdkLogger.quiet("[cache warning]: fail to upload %s: %s" % (self._GetUrl(FilePath), X))
+                    continue
+                Index[Key] = [Stat.st_size, Stat.st_mtime]
+                Count += 1
+
+        try:
+            with open(LongFilePath(IndexPath), 'w') as File:
+                json.dump(Index, File)
+        except Exception as X:
+            EdkLogger.quiet("[cache warning]: fail to save %s: %s" % (IndexPath, X))
+        EdkLogger.quiet("[cache Summary]: %d files uploaded to %s" % (Count, self.Url))
+
+## Make sure a file of --binary-source is available before it is read
+#
+#   @param  FilePath    The path of the file in gBinCacheSource
+#   @param  Refresh     Download the file again if gBinCacheSource is a mirror
+#
+#   @retval True        The file exists
+#
+def FetchBinCacheFile(FilePath, Refresh=False):
+    if not GlobalData.gBinCacheSourceUrl:
+        return os.path.exists(FilePath)
+    return RemoteBinCache(GlobalData.gBinCacheSourceUrl, GlobalData.gBinCacheSource).Fetch(FilePath, Refresh)
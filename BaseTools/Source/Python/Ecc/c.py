@@ -26,6 +26,7 @@ AllIncludeFileListDict = {}
 IncludePathListDict = {}
 ComplexTypeDict = {}
 SUDict = {}
+TableIDDict = {}
 IgnoredKeywordList = ['EFI_ERROR']
 
 def GetIgnoredDirListPattern():
@@ -555,6 +556,13 @@ def GetTableID(FullFileName, ErrorMsgList=None):
     if ErrorMsgList is None:
         ErrorMsgList = []
 
+    #
+    # The File table does not change once the checks start, and every check
+    # of a file looks the same file up.
+    #
+    if FullFileName in TableIDDict:
+        return TableIDDict[FullFileName]
+
     Db = GetDB()
     SqlStatement = """ select ID
                        from File
@@ -571,6 +579,7 @@ def GetTableID(FullFileName, ErrorMsgList=None):
     if FileID == -1:
         ErrorMsgList.append('NO file ID found in DB for file %s' % FullFileName)
         return - 1
+    TableIDDict[FullFileName] = FileID
     return FileID
 
 def GetIncludeFileList(FullFileName):
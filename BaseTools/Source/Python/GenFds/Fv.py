@@ -12,9 +12,12 @@
 from __future__ import absolute_import
 import Common.LongFilePathOs as os
 import subprocess
+import multiprocessing
+from concurrent.futures import ThreadPoolExecutor
 from io import BytesIO
 from struct import *
 from . import FfsFileStatement
+from .FvImageSection import FvImageSection
 from .GenFdsGlobalVariable import GenFdsGlobalVariable
 from Common.Misc import SaveFileOnChange, PackGUID
 from Common.LongFilePathSupport import CopyLongFilePath
@@ -118,13 +121,41 @@ class FV (object):
                                             TAB_LINE_BREAK)
 
         # Process Modules in FfsList
+        FfsWorkList = []
         for FfsFile in self.FfsList:
             if Flag:
                 if isinstance(FfsFile, FfsFileStatement.FileStatement):
                     continue
             if GenFdsGlobalVariable.EnableGenfdsMultiThread and GenFdsGlobalVariable.ModuleFile and GenFdsGlobalVariable.ModuleFile.Path.find(os.path.normpath(FfsFile.InfFileName)) == -1:
                 continue
-            FileName = FfsFile.GenFfs(MacroDict, FvParentAddr=BaseAddress, IsMakefile=Flag, FvName=self.UiFvName)
+            FfsWorkList.append(FfsFile)
+
+        #
+        # The FILE statements which don't contain an FV or FD only run GenSec, the
+        # GUIDed section tools and GenFfs on their own output directory, so they are
+        # generated concurrently first. The others, and the modules, are generated
+        # afterwards in this thread, because a nested FV changes the state of
+        # GenFdsGlobalVariable for the FV being generated.
+        #
+        FileNameDict = {}
+        ParallelList = []
+        if not Flag and GenFdsGlobalVariable.EnableGenfdsMultiThread:
+            ParallelList = [FfsFile for FfsFile in FfsWorkList if self._IsIndependentFfs(FfsFile)]
+        if len(ParallelList) > 1:
+            with ThreadPoolExecutor(max_workers=min(len(ParallelList), multiprocessing.cpu_count())) as Executor:
+                FutureDict = {}
+                for FfsFile in ParallelList:
+                    FutureDict[id(FfsFile)] = Executor.submit(FfsFile.GenFfs, dict(MacroDict), FvParentAddr=BaseAddress, IsMakefile=Flag, FvName=self.UiFvName)
+                for FfsFile in ParallelList:
+                    FileNameDict[id(FfsFile)] = FutureDict[id(FfsFile)].result()
+
+        for FfsFile in FfsWorkList:
+            if id(FfsFile) in FileNameDict:
+                continue
+            FileNameDict[id(FfsFile)] = FfsFile.GenFfs(MacroDict, FvParentAddr=BaseAddress, IsMakefile=Flag, FvName=self.UiFvName)
+
+        for FfsFile in FfsWorkList:
+            FileName = FileNameDict[id(FfsFile)]
             FfsFileList.append(FileName)
             if not Flag:
                 self.FvInfFile.append("EFI_FILE_NAME = " + \
@@ -256,6 +287,27 @@ class FV (object):
                             return True
         return False
 
+    ## _IsIndependentFfs()
+    #
+    #   Check whether a file of the FV can be generated concurrently with the others
+    #
+    #   @param  FfsFile     The FILE statement or INF statement of the FV
+    #   @retval True        The file contains no FV nor FD
+    #
+    @staticmethod
+    def _IsIndependentFfs(FfsFile):
+        if not isinstance(FfsFile, FfsFileStatement.FileStatement):
+            return False
+        if FfsFile.FvName or FfsFile.FdName:
+            return False
+        SectionList = list(FfsFile.SectionList)
+        while SectionList:
+            Section = SectionList.pop()
+            if isinstance(Section, FvImageSection):
+                return False
+            SectionList.extend(getattr(Section, 'SectionList', []))
+        return True
+
     ## _InitializeInf()
     #
     #   Initialize the inf file to create FV
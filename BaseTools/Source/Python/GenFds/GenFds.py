@@ -94,6 +94,10 @@ def resetFdsGlobalVariable():
     GenFdsGlobalVariable.CopyList   = []
     GenFdsGlobalVariable.ModuleFile = ''
     GenFdsGlobalVariable.EnableGenfdsMultiThread = True
+    GenFdsGlobalVariable.SectionCacheDir = ''
+    GenFdsGlobalVariable.SectionCacheSource = ''
+    GenFdsGlobalVariable.SectionCacheDest = ''
+    GenFdsGlobalVariable.SectionToolDigest = {}
 
     GenFdsGlobalVariable.LargeFileInFvFlags = []
     GenFdsGlobalVariable.EFI_FIRMWARE_FILE_SYSTEM3_GUID = '5473C07A-3DCB-4dca-BD6F-1E9689E7349A'
@@ -308,6 +312,13 @@ def GenFdsApi(FdsCommandDict, WorkSpaceDataBase=None):
                 EdkLogger.error("GenFds", FILE_NOT_FOUND, ExtraData=OutputDir)
             GenFdsGlobalVariable.OutputDirDict[Key] = OutputDir
 
+        if FdsCommandDict.get("UseHashCache"):
+            GenFdsGlobalVariable.SectionCacheDir = os.path.join(GenFdsGlobalVariable.OutputDirDict[ArchList[0]], 'GenFdsCache')
+            if FdsCommandDict.get("BinCacheSource"):
+                GenFdsGlobalVariable.SectionCacheSource = os.path.join(os.path.normpath(FdsCommandDict.get("BinCacheSource")), 'GenFdsCache')
+            if FdsCommandDict.get("BinCacheDest"):
+                GenFdsGlobalVariable.SectionCacheDest = os.path.join(os.path.normpath(FdsCommandDict.get("BinCacheDest")), 'GenFdsCache')
+
         """ Parse Fdf file, has to place after build Workspace as FDF may contain macros from DSC file """
         if WorkSpaceDataBase:
             FdfParserObj = GlobalData.gFdfParser
@@ -407,6 +418,9 @@ def OptionsToCommandDict(Options):
     FdsCommandDict["debug"] = Options.debug
     FdsCommandDict["Workspace"] = Options.Workspace
     FdsCommandDict["GenfdsMultiThread"] = not Options.NoGenfdsMultiThread
+    FdsCommandDict["UseHashCache"] = Options.UseHashCache
+    FdsCommandDict["BinCacheDest"] = Options.BinCacheDest
+    FdsCommandDict["BinCacheSource"] = Options.BinCacheSource
     FdsCommandDict["fdf_file"] = [PathClass(Options.filename)] if Options.filename else []
     FdsCommandDict["build_target"] = Options.BuildTarget
     FdsCommandDict["toolchain_tag"] = Options.ToolChain
@@ -465,6 +479,9 @@ def myOptionParser():
     Parser.add_option("--pcd", action="append", dest="OptionPcd", help="Set PCD value by command line. Format: \"PcdName=Value\" ")
     Parser.add_option("--genfds-multi-thread", action="store_true", dest="GenfdsMultiThread", default=True, help="Enable GenFds multi thread to generate ffs file.")
     Parser.add_option("--no-genfds-multi-thread", action="store_true", dest="NoGenfdsMultiThread", default=False, help="Disable GenFds multi thread to generate ffs file.")
+    Parser.add_option("--hash", action="store_true", dest="UseHashCache", default=False, help="Enable hash-based caching of compressed and GUIDed sections.")
+    Parser.add_option("--binary-destination", action="store", type="string", dest="BinCacheDest", help="Also store cached sections in the specified directory.")
+    Parser.add_option("--binary-source", action="store", type="string", dest="BinCacheSource", help="Also consume cached sections from the specified directory.")
 
     Options, _ = Parser.parse_args()
     return Options
@@ -14,14 +14,16 @@ from __future__ import absolute_import
 
 import Common.LongFilePathOs as os
 import sys
+import hashlib
+import shutil
 from sys import stdout
 from subprocess import PIPE,Popen
-from struct import Struct
+from struct import Struct, pack
 from array import array
 
 from Common.BuildToolError import COMMAND_FAILURE,GENFDS_ERROR
 from Common import EdkLogger
-from Common.Misc import SaveFileOnChange
+from Common.Misc import SaveFileOnChange, PackGUID
 
 from Common.TargetTxtClassObject import TargetTxtDict
 from Common.ToolDefClassObject import ToolDefDict,gDefaultToolsDefFile
@@ -74,6 +76,17 @@ class GenFdsGlobalVariable:
     ModuleFile = ''
     EnableGenfdsMultiThread = True
 
+    #
+    # Content-addressed cache of section tool outputs, enabled by --hash.
+    # SectionCacheDir is the local cache under the build output directory,
+    # SectionCacheSource and SectionCacheDest are the GenFds parts of the
+    # --binary-source and --binary-destination caches.
+    #
+    SectionCacheDir = ''
+    SectionCacheSource = ''
+    SectionCacheDest = ''
+    SectionToolDigest = {}
+
     #
     # The list whose element are flags to indicate if large FFS or SECTION files exist in FV.
     # At the beginning of each generation of FV, false flag is appended to the list,
@@ -89,6 +102,45 @@ class GenFdsGlobalVariable:
 
     SectionHeader = Struct("3B 1B")
 
+    #
+    # The leaf sections and the FFS files are built in GenFds rather than by
+    # GenSec and GenFfs when they need nothing more than a header, to save the
+    # start of a process for each of them. The other cases are left to the tools.
+    #
+    LeafSectionTypeDict = {
+        'EFI_SECTION_PE32'                  : 0x10,
+        'EFI_SECTION_PIC'                   : 0x11,
+        'EFI_SECTION_TE'                    : 0x12,
+        'EFI_SECTION_DXE_DEPEX'             : 0x13,
+        'EFI_SECTION_COMPATIBILITY16'       : 0x16,
+        'EFI_SECTION_FIRMWARE_VOLUME_IMAGE' : 0x17,
+        'EFI_SECTION_RAW'                   : 0x19,
+        'EFI_SECTION_PEI_DEPEX'             : 0x1B,
+        'EFI_SECTION_SMM_DEPEX'             : 0x1C
+    }
+    FfsFileTypeDict = {
+        'EFI_FV_FILETYPE_RAW'                   : 0x01,
+        'EFI_FV_FILETYPE_FREEFORM'              : 0x02,
+        'EFI_FV_FILETYPE_SECURITY_CORE'         : 0x03,
+        'EFI_FV_FILETYPE_PEI_CORE'              : 0x04,
+        'EFI_FV_FILETYPE_DXE_CORE'              : 0x05,
+        'EFI_FV_FILETYPE_PEIM'                  : 0x06,
+        'EFI_FV_FILETYPE_DRIVER'                : 0x07,
+        'EFI_FV_FILETYPE_COMBINED_PEIM_DRIVER'  : 0x08,
+        'EFI_FV_FILETYPE_APPLICATION'           : 0x09,
+        'EFI_FV_FILETYPE_SMM'                   : 0x0A,
+        'EFI_FV_FILETYPE_FIRMWARE_VOLUME_IMAGE' : 0x0B,
+        'EFI_FV_FILETYPE_COMBINED_SMM_DXE'      : 0x0C,
+        'EFI_FV_FILETYPE_SMM_CORE'              : 0x0D,
+        'EFI_FV_FILETYPE_MM_STANDALONE'         : 0x0E,
+        'EFI_FV_FILETYPE_MM_CORE_STANDALONE'    : 0x0F
+    }
+    # Alignments accepted by GenFfs -a, the index is the value of the FFS attribute
+    FfsAlignNameList = ["8", "16", "128", "512", "1K", "4K", "32K", "64K", "128K", "256K",
+                        "512K", "1M", "2M", "4M", "8M", "16M"]
+    # Section types GenFfs counts as an image of the file
+    ImageSectionTypeList = [0x01, 0x02, 0x10, 0x12, 0x17]
+
     # FvName, FdName, CapName in FDF, Image file name
     ImageBinDict = {}
 
@@ -516,11 +568,129 @@ class GenFdsGlobalVariable:
                     GenFdsGlobalVariable.SecCmdList.append(' '.join(Cmd).strip())
             elif GenFdsGlobalVariable.NeedsUpdate(Output, list(Input) + [CommandFile]):
                 GenFdsGlobalVariable.DebugLogger(EdkLogger.DEBUG_5, "%s needs update because of newer %s" % (Output, Input))
-                GenFdsGlobalVariable.CallExternalTool(Cmd, "Failed to generate section")
+                #
+                # Only compression sections are worth caching, the other GenSec
+                # operations are cheaper than hashing their input.
+                #
+                CacheKey = None
+                if CompressionType:
+                    CacheKey = GenFdsGlobalVariable.GetSectionCacheKey(Input, Cmd[0], Cmd[1:Cmd.index("-o")])
+                if (Type in GenFdsGlobalVariable.LeafSectionTypeDict and len(Input) == 1 and
+                    not (Guid or DummyFile or GuidHdrLen or GuidAttr or InputAlign)):
+                    GenFdsGlobalVariable.GenerateLeafSection(Output, Input[0], GenFdsGlobalVariable.LeafSectionTypeDict[Type])
+                elif not GenFdsGlobalVariable.RestoreSectionCache(Output, CacheKey):
+                    GenFdsGlobalVariable.CallExternalTool(Cmd, "Failed to generate section")
+                    GenFdsGlobalVariable.SaveSectionCache(Output, CacheKey)
                 if (os.path.getsize(Output) >= GenFdsGlobalVariable.LARGE_FILE_SIZE and
                     GenFdsGlobalVariable.LargeFileInFvFlags):
                     GenFdsGlobalVariable.LargeFileInFvFlags[-1] = True
 
+    ## GenerateLeafSection()
+    #
+    #   Generate a leaf section the same way as GenSec, by adding the common
+    #   section header in front of the content of the input file.
+    #
+    #   @param  Output      The section file to generate
+    #   @param  Input       The file with the content of the section
+    #   @param  Type        The value of the section type
+    #
+    @staticmethod
+    def GenerateLeafSection(Output, Input, Type):
+        try:
+            with open(Input, "rb") as Fd:
+                Content = Fd.read()
+        except IOError:
+            EdkLogger.error("GenFds", FILE_OPEN_FAILURE, "Error opening file", ExtraData=Input)
+
+        Len = len(Content) + 4
+        if Len >= GenFdsGlobalVariable.LARGE_FILE_SIZE:
+            Header = pack('<4BI', 0xff, 0xff, 0xff, Type, Len + 4)
+        else:
+            Header = GenFdsGlobalVariable.SectionHeader.pack(Len & 0xff, (Len >> 8) & 0xff, (Len >> 16) & 0xff, Type)
+
+        try:
+            with open(Output, "wb") as Fd:
+                Fd.write(Header)
+                Fd.write(Content)
+        except IOError as X:
+            EdkLogger.error("GenFds", FILE_CREATE_FAILURE, ExtraData='IOError %s' % X)
+
+    ## GenerateFfsInProcess()
+    #
+    #   Generate an FFS file the same way as GenFfs, when none of the input
+    #   sections requires an alignment, so no pad section has to be inserted.
+    #
+    #   @param  Output      The FFS file to generate
+    #   @param  Input       The list of the section files of the FFS file
+    #   @param  Type        The FFS file type string
+    #   @param  Guid        The name GUID of the FFS file
+    #   @param  Fixed       The file has the FFS_ATTRIB_FIXED attribute
+    #   @param  CheckSum    The file has the FFS_ATTRIB_CHECKSUM attribute
+    #   @param  Align       The alignment of the file, a value accepted by GenFfs -a
+    #
+    #   @retval True        The FFS file is generated
+    #   @retval False       The parameters need GenFfs
+    #
+    @staticmethod
+    def GenerateFfsInProcess(Output, Input, Type, Guid, Fixed, CheckSum, Align):
+        if Type not in GenFdsGlobalVariable.FfsFileTypeDict or not Input:
+            return False
+        try:
+            FileGuid = PackGUID(Guid.split('-'))
+        except (IndexError, ValueError):
+            return False
+        FfsAlign = 0
+        if Align and Align not in ("1", "2", "4"):
+            if Align not in GenFdsGlobalVariable.FfsAlignNameList:
+                return False
+            FfsAlign = GenFdsGlobalVariable.FfsAlignNameList.index(Align)
+        FileType = GenFdsGlobalVariable.FfsFileTypeDict[Type]
+
+        Body = bytearray()
+        ImageSectionNum = 0
+        for File in Input:
+            Body.extend(bytes((4 - len(Body) % 4) % 4))
+            try:
+                with open(File, "rb") as Fd:
+                    Content = Fd.read()
+            except IOError:
+                EdkLogger.error("GenFds", FILE_OPEN_FAILURE, "Error opening file", ExtraData=File)
+            if len(Content) > 3 and Content[3] in GenFdsGlobalVariable.ImageSectionTypeList:
+                ImageSectionNum += 1
+            Body.extend(Content)
+
+        if FileType in (0x03, 0x04, 0x05) and ImageSectionNum != 1:
+            EdkLogger.error("GenFds", GENFDS_ERROR, "Fv File type %s must have one and only one Pe or Te section, but %u Pe/Te section are input" % (Type, ImageSectionNum),
+                            ExtraData=Output)
+        if FileType in (0x06, 0x07, 0x08, 0x09) and ImageSectionNum < 1:
+            EdkLogger.error("GenFds", GENFDS_ERROR, "Fv File type %s must have at least one Pe or Te section, but no Pe/Te section is input" % Type,
+                            ExtraData=Output)
+
+        # FFS_ATTRIB_FIXED, FFS_ATTRIB_CHECKSUM, FFS_ATTRIB_LARGE_FILE and FFS_ATTRIB_DATA_ALIGNMENT2
+        Attributes = (0x04 if Fixed else 0) | (0x40 if CheckSum else 0) | ((FfsAlign & 0x7) << 3)
+        if FfsAlign >= 8:
+            Attributes |= 0x02
+        Size = len(Body) + 24
+        if Size >= GenFdsGlobalVariable.LARGE_FILE_SIZE:
+            Attributes |= 0x01
+            Header = bytearray(FileGuid + pack('<4B3BBQ', 0, 0, FileType, Attributes, 0, 0, 0, 0, len(Body) + 32))
+        else:
+            Header = bytearray(FileGuid + pack('<4B3BB', 0, 0, FileType, Attributes, Size & 0xff, (Size >> 8) & 0xff, (Size >> 16) & 0xff, 0))
+
+        # The checksums and the state are zero when the header checksum is calculated
+        Header[16] = (0x100 - sum(Header) & 0xff) & 0xff
+        Header[17] = (0x100 - sum(Body) & 0xff) & 0xff if CheckSum else 0xAA
+        # EFI_FILE_HEADER_CONSTRUCTION, EFI_FILE_HEADER_VALID and EFI_FILE_DATA_VALID
+        Header[23] = 0x07
+
+        try:
+            with open(Output, "wb") as Fd:
+                Fd.write(Header)
+                Fd.write(Body)
+        except IOError as X:
+            EdkLogger.error("GenFds", FILE_CREATE_FAILURE, ExtraData='IOError %s' % X)
+        return True
+
     @staticmethod
     def GetAlignment (AlignString):
         if not AlignString:
@@ -572,6 +742,8 @@ class GenFdsGlobalVariable:
         else:
             if not GenFdsGlobalVariable.NeedsUpdate(Output, list(Input) + [CommandFile]):
                 return
+            if not any(SectionAlign or []) and GenFdsGlobalVariable.GenerateFfsInProcess(Output, Input, Type, Guid, Fixed, CheckSum, Align):
+                return
             GenFdsGlobalVariable.CallExternalTool(Cmd, "Failed to generate FFS")
 
     @staticmethod
@@ -700,7 +872,107 @@ class GenFdsGlobalVariable:
             if " ".join(Cmd).strip() not in GenFdsGlobalVariable.SecCmdList:
                 GenFdsGlobalVariable.SecCmdList.append(" ".join(Cmd).strip())
         else:
+            CacheKey = GenFdsGlobalVariable.GetSectionCacheKey(Input, ToolPath, Options.split(' '))
+            if GenFdsGlobalVariable.RestoreSectionCache(Output, CacheKey):
+                if returnValue != []:
+                    returnValue[0] = 0
+                return
             GenFdsGlobalVariable.CallExternalTool(Cmd, "Failed to call " + ToolPath, returnValue)
+            if returnValue == [] or returnValue[0] == 0:
+                GenFdsGlobalVariable.SaveSectionCache(Output, CacheKey)
+
+    ## Compute the section cache key of a tool run
+    #
+    #   The key covers the tool binary, its options and the content of all
+    #   input files, so the names and time stamps of the inputs do not matter.
+    #
+    #   @param  Input           Path list of input files
+    #   @param  ToolPath        Tool used to generate the output
+    #   @param  Options         Option list passed to the tool
+    #
+    #   @retval string          SHA-256 key of the tool run
+    #   @retval None            if the section cache is disabled
+    #
+    @staticmethod
+    def GetSectionCacheKey(Input, ToolPath, Options):
+        if not GenFdsGlobalVariable.SectionCacheDir:
+            return None
+
+        if ToolPath not in GenFdsGlobalVariable.SectionToolDigest:
+            ToolDigest = hashlib.sha256(ToolPath.encode('utf-8'))
+            ToolFile = shutil.which(ToolPath)
+            if ToolFile:
+                with open(ToolFile, 'rb') as Fd:
+                    ToolDigest.update(Fd.read())
+            GenFdsGlobalVariable.SectionToolDigest[ToolPath] = ToolDigest.hexdigest()
+
+        Key = hashlib.sha256(GenFdsGlobalVariable.SectionToolDigest[ToolPath].encode('utf-8'))
+        Key.update(' '.join(Options).strip().encode('utf-8'))
+        for File in Input:
+            if not os.path.isfile(File):
+                return None
+            with open(File, 'rb') as Fd:
+                Key.update(hashlib.sha256(Fd.read()).digest())
+        return Key.hexdigest()
+
+    ## Copy a file into the section cache directory
+    #
+    #   The file is written under a temporary name and renamed, so concurrent
+    #   builds sharing the cache never see a partial entry.
+    #
+    @staticmethod
+    def _StoreSectionCacheFile(CacheDir, File, CacheKey):
+        CacheFile = os.path.join(CacheDir, CacheKey[:2], CacheKey)
+        if os.path.exists(CacheFile):
+            return
+        try:
+            CreateDirectory(os.path.dirname(CacheFile))
+            TempFile = CacheFile + '.tmp'
+            shutil.copyfile(File, TempFile)
+            os.rename(TempFile, CacheFile)
+        except EnvironmentError as X:
+            GenFdsGlobalVariable.DebugLogger(EdkLogger.DEBUG_5, "Failed to cache %s: %s" % (File, X))
+
+    ## Restore the output of a tool run from the section cache
+    #
+    #   @param  Output          Path of output file
+    #   @param  CacheKey        Key returned by GetSectionCacheKey()
+    #
+    #   @retval True            if Output was restored from the cache
+    #   @retval False           if the cache has no entry for CacheKey
+    #
+    @staticmethod
+    def RestoreSectionCache(Output, CacheKey):
+        if not CacheKey:
+            return False
+        for CacheDir in (GenFdsGlobalVariable.SectionCacheDir, GenFdsGlobalVariable.SectionCacheSource):
+            if not CacheDir:
+                continue
+            CacheFile = os.path.join(CacheDir, CacheKey[:2], CacheKey)
+            if not os.path.isfile(CacheFile):
+                continue
+            CreateDirectory(os.path.dirname(Output))
+            shutil.copyfile(CacheFile, Output)
+            GenFdsGlobalVariable.DebugLogger(EdkLogger.DEBUG_5, "%s restored from section cache %s" % (Output, CacheFile))
+            if CacheDir != GenFdsGlobalVariable.SectionCacheDir:
+                GenFdsGlobalVariable._StoreSectionCacheFile(GenFdsGlobalVariable.SectionCacheDir, Output, CacheKey)
+            if GenFdsGlobalVariable.SectionCacheDest:
+                GenFdsGlobalVariable._StoreSectionCacheFile(GenFdsGlobalVariable.SectionCacheDest, Output, CacheKey)
+            return True
+        return False
+
+    ## Save the output of a tool run into the section cache
+    #
+    #   @param  Output          Path of output file
+    #   @param  CacheKey        Key returned by GetSectionCacheKey()
+    #
+    @staticmethod
+    def SaveSectionCache(Output, CacheKey):
+        if not CacheKey or not os.path.isfile(Output):
+            return
+        GenFdsGlobalVariable._StoreSectionCacheFile(GenFdsGlobalVariable.SectionCacheDir, Output, CacheKey)
+        if GenFdsGlobalVariable.SectionCacheDest:
+            GenFdsGlobalVariable._StoreSectionCacheFile(GenFdsGlobalVariable.SectionCacheDest, Output, CacheKey)
 
     @staticmethod
     def CallExternalTool (cmd, errorMess, returnValue=[]):
@@ -253,12 +253,13 @@ class MetaFileParser(object):
 
     def StartParse(self):
         if not self._Finished:
-            if self._RawTable.IsIntegrity():
+            if self._RawTable.IsIntegrity() or self._RawTable.LoadCache():
                 self._Finished = True
             else:
                 self._Table = self._RawTable
                 self._PostProcessed = False
                 self.Start()
+                self._RawTable.SaveCache()
     ## Data parser for the common format in different type of file
     #
     #   The common format in the meatfile is like
@@ -10,18 +10,48 @@
 #
 from __future__ import absolute_import
 import uuid
+import pickle
+from hashlib import md5
 
+import Common.LongFilePathOs as os
 import Common.EdkLogger as EdkLogger
+import Common.GlobalData as GlobalData
 from Common.BuildToolError import FORMAT_INVALID
+from Common.LongFilePathSupport import OpenLongFilePath as open
 
 from CommonDataClass.DataClass import MODEL_FILE_DSC, MODEL_FILE_DEC, MODEL_FILE_INF, \
                                       MODEL_FILE_OTHERS
 from Common.DataType import *
 
+## Get the signature of the parser sources
+#
+# The records in the on-disk metadata cache are only valid for the parser that
+# produced them, so the sources of the parser are part of the cache key.
+#
+# @retval   The digest of the parser sources, or None if they cannot be read
+#
+def GetParserSignature():
+    global _ParserSignature
+    if _ParserSignature is None:
+        Signature = md5()
+        try:
+            for Name in ('MetaFileParser.py', 'MetaFileTable.py'):
+                with open(os.path.join(os.path.dirname(__file__), Name), 'rb') as File:
+                    Signature.update(File.read())
+        except:
+            _ParserSignature = ''
+        else:
+            _ParserSignature = Signature.hexdigest()
+    return _ParserSignature
+
+_ParserSignature = None
+
 class MetaFileTable():
     # TRICK: use file ID as the part before '.'
     _ID_STEP_ = 1
     _ID_MAX_ = 99999999
+    # the records can be kept in the on-disk metadata cache
+    _CACHE_ = False
 
     ## Constructor
     def __init__(self, DB, MetaFile, FileType, Temporary, FromItem=None):
@@ -40,6 +70,7 @@ class MetaFileTable():
                         FromItem])
         self.FileId = len(DB.TblFile)
         self.ID = self.FileId * 10**8
+        self._CacheKey = None
         if Temporary:
             self.TableName = "_%s_%s_%s" % (FileType, len(DB.TblFile), uuid.uuid4().hex)
         else:
@@ -64,6 +95,91 @@ class MetaFileTable():
     def GetAll(self):
         return [item for item in self.CurrentContent if item[0] >= 0 and item[-1]>=0]
 
+    ## Get the key of the table in the on-disk metadata cache
+    #
+    # The key covers the path and the content of the meta file, the global macros
+    # the parser checks the file against, and the sources of the parser.
+    #
+    # @retval   The key, or None if the records of the table cannot be cached
+    #
+    def _GetCacheKey(self):
+        if not self._CACHE_ or not os.path.isabs(GlobalData.gMetaFileCachePath):
+            return None
+        # the usage check reports its findings while parsing
+        if GlobalData.gOptions and GlobalData.gOptions.CheckUsage:
+            return None
+        if not GetParserSignature():
+            return None
+        try:
+            with open(str(self.MetaFile), 'rb') as File:
+                Content = File.read()
+        except:
+            return None
+        Key = md5(GetParserSignature().encode())
+        Key.update(self.MetaFile.Path.encode())
+        Key.update(Content)
+        Key.update(str(sorted(GlobalData.gGlobalDefines.items())).encode())
+        return Key.hexdigest()
+
+    def _GetCacheFile(self):
+        return os.path.join(GlobalData.gMetaFileCachePath, md5(self.MetaFile.Path.encode()).hexdigest())
+
+    ## Move the record IDs that are based on the file ID of another parse
+    #
+    # The file ID depends on the order the files are parsed in, so the IDs that
+    # start from it have to follow the file ID of the current parse.
+    #
+    def _MoveRecords(self, Records, Base):
+        Offset = self.FileId * 10**8 - Base
+        if Offset == 0:
+            return Records
+        Result = []
+        for Record in Records:
+            Record = list(Record)
+            if Record[0] >= Base:
+                Record[0] += Offset
+            if Record[7] >= Base:
+                Record[7] += Offset
+            Result.append(Record)
+        return Result
+
+    ## Restore the records of the table from the on-disk metadata cache
+    #
+    # @retval True      The records are restored and are complete
+    # @retval False     The meta file has to be parsed
+    #
+    def LoadCache(self):
+        self._CacheKey = self._GetCacheKey()
+        if self._CacheKey is None:
+            return False
+        try:
+            with open(self._GetCacheFile(), 'rb') as File:
+                Key, Base, Content = pickle.load(File)
+        except:
+            return False
+        if Key != self._CacheKey or not Content or Content[-1][0] >= 0:
+            return False
+        self.CurrentContent = self._MoveRecords(Content, Base)
+        self.ID = max(Record[0] for Record in self.CurrentContent)
+        return True
+
+    ## Save the records of the table to the on-disk metadata cache
+    def SaveCache(self):
+        if self._CacheKey is None or not self.IsIntegrity():
+            return
+        CacheFile = self._GetCacheFile()
+        TempFile = "%s.%s" % (CacheFile, uuid.uuid4().hex)
+        try:
+            if not os.path.exists(GlobalData.gMetaFileCachePath):
+                os.makedirs(GlobalData.gMetaFileCachePath)
+            with open(TempFile, 'wb') as File:
+                pickle.dump((self._CacheKey, self.FileId * 10**8, self.CurrentContent), File, pickle.HIGHEST_PROTOCOL)
+            os.replace(TempFile, CacheFile)
+        except Exception as Exc:
+            EdkLogger.debug(EdkLogger.DEBUG_5, str(Exc))
+            if os.path.exists(TempFile):
+                os.remove(TempFile)
+
 ## Python class representation of table storing module data
 class ModuleTable(MetaFileTable):
     _COLUMN_ = '''
@@ -83,6 +199,7 @@ class ModuleTable(MetaFileTable):
         '''
     # used as table end flag, in case the changes to database is not committed to db file
     _DUMMY_ = [-1, -1, '====', '====', '====', '====', '====', -1, -1, -1, -1, -1, -1]
+    _CACHE_ = True
 
     ## Constructor
     def __init__(self, Db, MetaFile, Temporary):
@@ -176,6 +293,7 @@ class PackageTable(MetaFileTable):
         '''
     # used as table end flag, in case the changes to database is not committed to db file
     _DUMMY_ = [-1, -1, '====', '====', '====', '====', '====', -1, -1, -1, -1, -1, -1]
+    _CACHE_ = True
 
     ## Constructor
     def __init__(self, Cursor, MetaFile, Temporary):
@@ -35,6 +35,7 @@ from AutoGen.WorkspaceAutoGen import WorkspaceAutoGen
 from AutoGen.AutoGenWorker import AutoGenWorkerInProcess,AutoGenManager,\
     LogAgent
 from AutoGen import GenMake
+from AutoGen import GenNinja
 from Common import Misc as Utils
 
 from Common.TargetTxtClassObject import TargetTxtDict
@@ -61,6 +62,7 @@ from AutoGen.DataPipe import MemoryDataPipe
 from AutoGen.ModuleAutoGenHelper import WorkSpaceInfo, PlatformInfo
 from GenFds.FdfParser import FdfParser
 from AutoGen.IncludesAutoGen import IncludesAutoGen
+from Common.RemoteBinCache import RemoteBinCache, IsRemoteBinCache, GetRemoteBinCacheMirror
 from GenFds.GenFds import resetFdsGlobalVariable
 from AutoGen.AutoGen import CalculatePriorityValue
 
@@ -271,17 +273,28 @@ def LaunchCommand(Command, WorkingDir,ModuleAuto = None):
 
         EdkLogger.error("build", COMMAND_FAILURE, ExtraData="%s [%s]" % (Command, WorkingDir))
     if ModuleAuto:
-        iau = IncludesAutoGen(WorkingDir,ModuleAuto)
-        if ModuleAuto.ToolChainFamily == TAB_COMPILER_MSFT:
-            iau.CreateDepsFileForMsvc(Proc.ProcOut)
-        else:
-            iau.UpdateDepsFileforNonMsvc()
-        iau.UpdateDepsFileforTrim()
-        iau.CreateModuleDeps()
-        iau.CreateDepsInclude()
-        iau.CreateDepsTarget()
+        UpdateModuleDeps(WorkingDir, ModuleAuto, Proc.ProcOut)
     return "%dms" % (int(round((time.time() - BeginTime) * 1000)))
 
+## Update the dependency files of a module after its makefile is run
+#
+# @param  WorkingDir            The build directory of the module
+# @param  ModuleAuto            The ModuleAutoGen object of the module
+# @param  ProcOut               The output of the make command, which has the
+#                               /showIncludes messages of MSVC
+#
+def UpdateModuleDeps(WorkingDir, ModuleAuto, ProcOut):
+    iau = IncludesAutoGen(WorkingDir,ModuleAuto)
+    if ModuleAuto.ToolChainFamily == TAB_COMPILER_MSFT:
+        iau.CreateDepsFileForMsvc(ProcOut)
+    else:
+        iau.UpdateDepsFileforNonMsvc()
+    iau.UpdateDepsFileforTrim()
+    iau.CreateModuleDeps()
+    iau.CreateDepsInclude()
+    iau.CreateDepsTarget()
+    iau.CreateNinjaDepfile()
+
 ## The smallest unit that can be built in multi-thread build mode
 #
 # This is the base class of build unit. The "Obj" parameter must provide
@@ -746,6 +759,7 @@ class Build():
         GlobalData.gUseHashCache = BuildOptions.UseHashCache
         GlobalData.gBinCacheDest   = BuildOptions.BinCacheDest
         GlobalData.gBinCacheSource = BuildOptions.BinCacheSource
+        GlobalData.gUseNinja = BuildOptions.UseNinja
         GlobalData.gEnableGenfdsMultiThread = not BuildOptions.NoGenfdsMultiThread
         GlobalData.gDisableIncludePathCheck = BuildOptions.DisableIncludePathCheck
 
@@ -758,7 +772,13 @@ class Build():
         if GlobalData.gBinCacheDest and GlobalData.gBinCacheSource:
             EdkLogger.error("build", OPTION_NOT_SUPPORTED, ExtraData="--binary-destination can not be used together with --binary-source.")
 
-        if GlobalData.gBinCacheSource:
+        if GlobalData.gUseNinja and GlobalData.gUseHashCache:
+            EdkLogger.error("build", OPTION_NOT_SUPPORTED, ExtraData="--ninja can not be used together with --hash.")
+
+        if GlobalData.gBinCacheSource and IsRemoteBinCache(GlobalData.gBinCacheSource):
+            GlobalData.gBinCacheSourceUrl = GlobalData.gBinCacheSource
+            GlobalData.gBinCacheSource = GetRemoteBinCacheMirror(GlobalData.gBinCacheSourceUrl)
+        elif GlobalData.gBinCacheSource:
             BinCacheSource = os.path.normpath(GlobalData.gBinCacheSource)
             if not os.path.isabs(BinCacheSource):
                 BinCacheSource = mws.join(self.WorkspaceDir, BinCacheSource)
@@ -767,7 +787,10 @@ class Build():
             if GlobalData.gBinCacheSource is not None:
                 EdkLogger.error("build", OPTION_VALUE_INVALID, ExtraData="Invalid value of option --binary-source.")
 
-        if GlobalData.gBinCacheDest:
+        if GlobalData.gBinCacheDest and IsRemoteBinCache(GlobalData.gBinCacheDest):
+            GlobalData.gBinCacheDestUrl = GlobalData.gBinCacheDest
+            GlobalData.gBinCacheDest = GetRemoteBinCacheMirror(GlobalData.gBinCacheDestUrl)
+        elif GlobalData.gBinCacheDest:
             BinCacheDest = os.path.normpath(GlobalData.gBinCacheDest)
             if not os.path.isabs(BinCacheDest):
                 BinCacheDest = mws.join(self.WorkspaceDir, BinCacheDest)
@@ -777,6 +800,7 @@ class Build():
                 EdkLogger.error("build", OPTION_VALUE_INVALID, ExtraData="Invalid value of option --binary-destination.")
 
         GlobalData.gDatabasePath = os.path.normpath(os.path.join(GlobalData.gConfDirectory, GlobalData.gDatabasePath))
+        GlobalData.gMetaFileCachePath = os.path.normpath(os.path.join(GlobalData.gConfDirectory, GlobalData.gMetaFileCachePath))
         if not os.path.exists(os.path.join(GlobalData.gConfDirectory, '.cache')):
             os.makedirs(os.path.join(GlobalData.gConfDirectory, '.cache'))
         self.Db = BuildDB
@@ -2126,6 +2150,29 @@ class Build():
             self.Fdf = None
         return BuildModules
 
+    ## Build the modules of all architectures of a platform in one ninja build graph
+    #
+    #   @param  Wa      The WorkspaceAutoGen object of the platform
+    #
+    def _NinjaBuildModules(self, Wa):
+        Target = self.Target
+        if Target in [None, "", "all"]:
+            Target = "tbuild"
+        NinjaFile = GenNinja.PlatformNinjaFile(Wa, Target).Generate()
+        LaunchCommand(["ninja", "-f", NinjaFile, "-j", str(self.ThreadNumber)], Wa.BuildDir)
+
+        # ninja only runs the makefiles of the modules which are out of date, but
+        # the dependency files of every module are checked as they are cheap to update
+        ModuleSet = set()
+        for Ma in self.BuildModules:
+            if not Ma.IsBinaryModule:
+                ModuleSet.add(Ma)
+            for La in Ma.LibraryAutoGenList:
+                if not La.IsBinaryModule:
+                    ModuleSet.add(La)
+        for Ma in ModuleSet:
+            UpdateModuleDeps(Ma.MakeFileDir, Ma, [])
+
     ## Build a platform in multi-thread mode
     #
     def PerformAutoGen(self,BuildTarget,ToolChain):
@@ -2288,28 +2335,35 @@ class Build():
                     EdkLogger.quiet("[cache Summary]: PreMakecache miss num: %s " % len(self.PreMakeCacheMiss))
                     EdkLogger.quiet("[cache Summary]: Makecache miss num: %s " % len(self.MakeCacheMiss))
 
-                for Arch in Wa.ArchList:
+                if GlobalData.gUseNinja and Pa.ToolChainFamily == TAB_COMPILER_MSFT:
+                    EdkLogger.warn("build", "--ninja is not supported by the %s tool chain family, the modules are built one by one." % TAB_COMPILER_MSFT)
+                if GlobalData.gUseNinja and Pa.ToolChainFamily != TAB_COMPILER_MSFT:
                     MakeStart = time.time()
-                    for Ma in set(self.BuildModules):
-                        # Generate build task for the module
-                        if not Ma.IsBinaryModule:
-                            Bt = BuildTask.New(ModuleMakeUnit(Ma, Pa.BuildCommand,self.Target))
-                        # Break build if any build thread has error
+                    self._NinjaBuildModules(Wa)
+                    self.MakeTime += int(round((time.time() - MakeStart)))
+                else:
+                    for Arch in Wa.ArchList:
+                        MakeStart = time.time()
+                        for Ma in set(self.BuildModules):
+                            # Generate build task for the module
+                            if not Ma.IsBinaryModule:
+                                Bt = BuildTask.New(ModuleMakeUnit(Ma, Pa.BuildCommand,self.Target))
+                            # Break build if any build thread has error
+                            if BuildTask.HasError():
+                                # we need a full version of makefile for platform
+                                ExitFlag.set()
+                                BuildTask.WaitForComplete()
+                                Pa.CreateMakeFile(False)
+                                EdkLogger.error("build", BUILD_ERROR, "Failed to build module", ExtraData=GlobalData.gBuildingModule)
+                            # Start task scheduler
+                            if not BuildTask.IsOnGoing():
+                                BuildTask.StartScheduler(self.ThreadNumber, ExitFlag)
+
+                        # in case there's an interruption. we need a full version of makefile for platform
+
                         if BuildTask.HasError():
-                            # we need a full version of makefile for platform
-                            ExitFlag.set()
-                            BuildTask.WaitForComplete()
-                            Pa.CreateMakeFile(False)
                             EdkLogger.error("build", BUILD_ERROR, "Failed to build module", ExtraData=GlobalData.gBuildingModule)
-                        # Start task scheduler
-                        if not BuildTask.IsOnGoing():
-                            BuildTask.StartScheduler(self.ThreadNumber, ExitFlag)
-
-                    # in case there's an interruption. we need a full version of makefile for platform
-
-                    if BuildTask.HasError():
-                        EdkLogger.error("build", BUILD_ERROR, "Failed to build module", ExtraData=GlobalData.gBuildingModule)
-                    self.MakeTime += int(round((time.time() - MakeStart)))
+                        self.MakeTime += int(round((time.time() - MakeStart)))
 
                 MakeContiue = time.time()
                 #
@@ -2504,6 +2558,8 @@ class Build():
             Module.GenPreMakefileHashList()
             Module.GenMakefileHashList()
             Module.CopyModuleToCache()
+        if GlobalData.gBinCacheDestUrl:
+            RemoteBinCache(GlobalData.gBinCacheDestUrl, GlobalData.gBinCacheDest).Upload()
 
     def GenLocalPreMakeCache(self):
         for Module in self.PreMakeCacheMiss:
@@ -61,4 +61,52 @@ WrapPkcs7Data (
   OUT UINTN        *WrapDataSize
   );
 
+/**
+  Calculate the hash that identifies the signer certificate chains of a
+  PKCS#7 signed data for a trusted certificate.
+
+  @param[in]  Pkcs7        Pointer to the PKCS7 object of the signed data.
+  @param[in]  TrustedCert  Pointer to a trusted/root certificate encoded in DER.
+  @param[in]  CertLength   Length of the trusted certificate in bytes.
+  @param[out] ChainHash    Buffer of SHA256_DIGEST_SIZE bytes to receive the hash.
+
+  @retval TRUE   The hash is calculated.
+  @retval FALSE  The hash cannot be calculated, or the cache is not supported.
+
+**/
+BOOLEAN
+Pkcs7GetChainHash (
+  IN  VOID         *Pkcs7,
+  IN  CONST UINT8  *TrustedCert,
+  IN  UINTN        CertLength,
+  OUT UINT8        *ChainHash
+  );
+
+/**
+  Check whether the signer certificate chains identified by a hash have been
+  verified.
+
+  @param[in]  ChainHash    The hash returned by Pkcs7GetChainHash().
+
+  @retval TRUE   The signer certificate chains have been verified.
+  @retval FALSE  The signer certificate chains have not been verified.
+
+**/
+BOOLEAN
+Pkcs7IsChainVerified (
+  IN CONST UINT8  *ChainHash
+  );
+
+/**
+  Record that the signer certificate chains identified by a hash have been
+  verified.
+
+  @param[in]  ChainHash    The hash returned by Pkcs7GetChainHash().
+
+**/
+VOID
+Pkcs7SetChainVerified (
+  IN CONST UINT8  *ChainHash
+  );
+
 #endif
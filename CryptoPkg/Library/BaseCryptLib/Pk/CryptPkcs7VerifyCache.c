@@ -0,0 +1,144 @@
+/** @file
+  Cache of PKCS#7 signer certificate chains that have been verified.
+
+  Caution: This module requires additional review when modified.
+  This library will have external input - signature.
+  This external input must be validated carefully to avoid security issue like
+  buffer overflow, integer overflow.
+
+  Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "InternalCryptLib.h"
+
+#include <openssl/x509.h>
+#include <openssl/pkcs7.h>
+
+#define PKCS7_CHAIN_CACHE_SIZE  16
+
+//
+// Hashes of the signer certificate chains which have been verified, the
+// oldest entry is replaced when the cache is full.
+//
+GLOBAL_REMOVE_IF_UNREFERENCED UINT8  mPkcs7ChainCache[PKCS7_CHAIN_CACHE_SIZE][SHA256_DIGEST_SIZE];
+GLOBAL_REMOVE_IF_UNREFERENCED UINTN  mPkcs7ChainCacheCount = 0;
+
+/**
+  Calculate the hash that identifies the signer certificate chains of a
+  PKCS#7 signed data for a trusted certificate.
+
+  The hash covers the trusted certificate and the DER encoding of all signer
+  certificates, so it only matches another PKCS#7 signed data when the same
+  certificates sign it and the same certificate is trusted.
+
+  @param[in]  Pkcs7        Pointer to the PKCS7 object of the signed data.
+  @param[in]  TrustedCert  Pointer to a trusted/root certificate encoded in DER.
+  @param[in]  CertLength   Length of the trusted certificate in bytes.
+  @param[out] ChainHash    Buffer of SHA256_DIGEST_SIZE bytes to receive the hash.
+
+  @retval TRUE   The hash is calculated.
+  @retval FALSE  The hash cannot be calculated.
+
+**/
+BOOLEAN
+Pkcs7GetChainHash (
+  IN  VOID         *Pkcs7,
+  IN  CONST UINT8  *TrustedCert,
+  IN  UINTN        CertLength,
+  OUT UINT8        *ChainHash
+  )
+{
+  STACK_OF (X509)  *Signers;
+  VOID             *HashCtx;
+  UINT8            *Der;
+  INTN             DerLength;
+  INTN             Index;
+  BOOLEAN          Status;
+
+  Status  = FALSE;
+  Signers = NULL;
+
+  HashCtx = AllocatePool (Sha256GetContextSize ());
+  if (HashCtx == NULL) {
+    return FALSE;
+  }
+
+  if (!Sha256Init (HashCtx) || !Sha256Update (HashCtx, TrustedCert, CertLength)) {
+    goto _Exit;
+  }
+
+  Signers = PKCS7_get0_signers ((PKCS7 *)Pkcs7, NULL, PKCS7_BINARY);
+  if ((Signers == NULL) || (sk_X509_num (Signers) <= 0)) {
+    goto _Exit;
+  }
+
+  for (Index = 0; Index < sk_X509_num (Signers); Index++) {
+    Der       = NULL;
+    DerLength = i2d_X509 (sk_X509_value (Signers, (int)Index), &Der);
+    if (DerLength <= 0) {
+      goto _Exit;
+    }
+
+    Status = Sha256Update (HashCtx, Der, (UINTN)DerLength);
+    OPENSSL_free (Der);
+    if (!Status) {
+      goto _Exit;
+    }
+  }
+
+  Status = Sha256Final (HashCtx, ChainHash);
+
+_Exit:
+  sk_X509_free (Signers);
+  FreePool (HashCtx);
+
+  return Status;
+}
+
+/**
+  Check whether the signer certificate chains identified by a hash have been
+  verified.
+
+  @param[in]  ChainHash    The hash returned by Pkcs7GetChainHash().
+
+  @retval TRUE   The signer certificate chains have been verified.
+  @retval FALSE  The signer certificate chains have not been verified.
+
+**/
+BOOLEAN
+Pkcs7IsChainVerified (
+  IN CONST UINT8  *ChainHash
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < MIN (mPkcs7ChainCacheCount, PKCS7_CHAIN_CACHE_SIZE); Index++) {
+    if (CompareMem (mPkcs7ChainCache[Index], ChainHash, SHA256_DIGEST_SIZE) == 0) {
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
+
+/**
+  Record that the signer certificate chains identified by a hash have been
+  verified.
+
+  @param[in]  ChainHash    The hash returned by Pkcs7GetChainHash().
+
+**/
+VOID
+Pkcs7SetChainVerified (
+  IN CONST UINT8  *ChainHash
+  )
+{
+  CopyMem (
+    mPkcs7ChainCache[mPkcs7ChainCacheCount % PKCS7_CHAIN_CACHE_SIZE],
+    ChainHash,
+    SHA256_DIGEST_SIZE
+    );
+  mPkcs7ChainCacheCount++;
+}
@@ -0,0 +1,70 @@
+/** @file
+  Cache of PKCS#7 signer certificate chains which does not provide real
+  capabilities, every signer certificate chain is verified.
+
+  Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "InternalCryptLib.h"
+
+/**
+  Calculate the hash that identifies the signer certificate chains of a
+  PKCS#7 signed data for a trusted certificate.
+
+  Return FALSE to indicate this interface is not supported.
+
+  @param[in]  Pkcs7        Pointer to the PKCS7 object of the signed data.
+  @param[in]  TrustedCert  Pointer to a trusted/root certificate encoded in DER.
+  @param[in]  CertLength   Length of the trusted certificate in bytes.
+  @param[out] ChainHash    Buffer of SHA256_DIGEST_SIZE bytes to receive the hash.
+
+  @retval FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+Pkcs7GetChainHash (
+  IN  VOID         *Pkcs7,
+  IN  CONST UINT8  *TrustedCert,
+  IN  UINTN        CertLength,
+  OUT UINT8        *ChainHash
+  )
+{
+  return FALSE;
+}
+
+/**
+  Check whether the signer certificate chains identified by a hash have been
+  verified.
+
+  Return FALSE to indicate this interface is not supported.
+
+  @param[in]  ChainHash    The hash returned by Pkcs7GetChainHash().
+
+  @retval FALSE  This interface is not supported.
+
+**/
+BOOLEAN
+Pkcs7IsChainVerified (
+  IN CONST UINT8  *ChainHash
+  )
+{
+  return FALSE;
+}
+
+/**
+  Record that the signer certificate chains identified by a hash have been
+  verified.
+
+  This interface is not supported, nothing is recorded.
+
+  @param[in]  ChainHash    The hash returned by Pkcs7GetChainHash().
+
+**/
+VOID
+Pkcs7SetChainVerified (
+  IN CONST UINT8  *ChainHash
+  )
+{
+}
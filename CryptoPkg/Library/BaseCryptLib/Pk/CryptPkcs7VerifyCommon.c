@@ -791,6 +791,9 @@ Pkcs7Verify (
   CONST UINT8  *Temp;
   UINTN        SignedDataSize;
   BOOLEAN      Wrapped;
+  UINT8        ChainHash[SHA256_DIGEST_SIZE];
+  BOOLEAN      ChainHashValid;
+  INT32        Flags;
 
   //
   // Check input parameters.
@@ -906,10 +909,26 @@ Pkcs7Verify (
   //
   X509_STORE_set_purpose (CertStore, X509_PURPOSE_ANY);
 
+  //
+  // The result of the certificate chain verification only depends on the
+  // signer certificates and the trusted certificate, because time checks are
+  // disabled and any purpose is accepted. Skip the chain verification of
+  // signer certificates that have already been verified for this trusted
+  // certificate, the signatures are still verified.
+  //
+  Flags          = PKCS7_BINARY;
+  ChainHashValid = Pkcs7GetChainHash (Pkcs7, TrustedCert, CertLength, ChainHash);
+  if (ChainHashValid && Pkcs7IsChainVerified (ChainHash)) {
+    Flags |= PKCS7_NOVERIFY;
+  }
+
   //
   // Verifies the PKCS#7 signedData structure
   //
-  Status = (BOOLEAN)PKCS7_verify (Pkcs7, NULL, CertStore, DataBio, NULL, PKCS7_BINARY);
+  Status = (BOOLEAN)PKCS7_verify (Pkcs7, NULL, CertStore, DataBio, NULL, Flags);
+  if (Status && ChainHashValid && ((Flags & PKCS7_NOVERIFY) == 0)) {
+    Pkcs7SetChainVerified (ChainHash);
+  }
 
 _Exit:
   //
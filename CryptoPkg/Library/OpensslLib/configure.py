@@ -337,6 +337,22 @@ def update_MSFT_asm_format(asm, filelist):
         for file_index in range(len(filelist)):
             filelist[file_index] = filelist[file_index].replace('.s', '.nasm')
 
+def accel_sources(archcc, srclist):
+    """ Split source file list into asm and c files for accel configs """
+    (arch, cc) = archcc.split('-')
+    asm = list(map(lambda x: f'{x} | {cc}', filter(is_asm, srclist)))
+    update_MSFT_asm_format(archcc, asm)
+    return (asm, list(filter(lambda x: not is_asm(x), srclist)))
+
+def update_accel_inf(inf, sources, defines):
+    """ Update inf file of an accel config for all architectures """
+    ia32accel = sources['IA32'] + sources['IA32-MSFT'] + sources['IA32-GCC']
+    x64accel = sources['X64'] + sources['X64-MSFT'] + sources['X64-GCC']
+    update_inf(inf, ia32accel, 'IA32', defines['IA32'])
+    update_inf(inf, x64accel, 'X64', defines['X64'])
+    aarch64accel = sources['AARCH64'] + sources['AARCH64-GCC']
+    update_inf(inf, aarch64accel, 'AARCH64', defines['AARCH64'])
+
 def main():
     # prepare
     os.chdir(os.path.dirname(os.path.abspath(__file__)))
@@ -352,6 +368,7 @@ def main():
             inf = 'OpensslLibAccel.inf'
             hdr = 'configuration-noec.h'
         sources = {}
+        cryptosources = {}
         defines = {}
         for asm in [ 'UEFI-IA32-MSFT', 'UEFI-IA32-GCC',
                      'UEFI-X64-MSFT', 'UEFI-X64-GCC',
@@ -366,19 +383,16 @@ def main():
                         os.path.join(opensslgendir, 'include', 'openssl', hdr))
             openssl_run_make(openssldir, 'distclean')
 
-            srclist = libcrypto_sources(cfg, archcc) + libssl_sources(cfg, archcc)
-            sources[archcc] = list(map(lambda x: f'{x} | {cc}', filter(is_asm, srclist)))
-            update_MSFT_asm_format(archcc, sources[archcc])
-            sources[arch] = list(filter(lambda x: not is_asm(x), srclist))
+            cryptolist = libcrypto_sources(cfg, archcc)
+            srclist = cryptolist + libssl_sources(cfg, archcc)
+            (sources[archcc], sources[arch]) = accel_sources(archcc, srclist)
+            (cryptosources[archcc], cryptosources[arch]) = accel_sources(archcc, cryptolist)
             defines[arch] = cfg['unified_info']['defines']['libcrypto']
             defines[arch] = list(filter(asm_filter_fn, defines[arch]))
 
-        ia32accel = sources['IA32'] + sources['IA32-MSFT'] + sources['IA32-GCC']
-        x64accel = sources['X64'] + sources['X64-MSFT'] + sources['X64-GCC']
-        update_inf(inf, ia32accel, 'IA32', defines['IA32'])
-        update_inf(inf, x64accel, 'X64', defines['X64'])
-        aarch64accel = sources['AARCH64'] + sources['AARCH64-GCC']
-        update_inf(inf, aarch64accel, 'AARCH64', defines['AARCH64'])
+        update_accel_inf(inf, sources, defines)
+        if not ec:
+            update_accel_inf('OpensslLibCryptoAccel.inf', cryptosources, defines)
 
     # noaccel - ec enabled
     openssl_configure(openssldir, 'UEFI', ec = True);
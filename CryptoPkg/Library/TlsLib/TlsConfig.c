@@ -1112,6 +1112,75 @@ TlsSetEcCurve (
   return EFI_SUCCESS;
 }
 
+/**
+  Sets a session to be resumed by the specified TLS connection.
+
+  This function sets a session, as returned by TlsGetSession() for an earlier
+  TLS connection, to be resumed when the TLS connection is established. The
+  session is only used with the server name it was established with, which
+  must have been set with TlsSetVerifyHost() first. If the server declines
+  to resume the session, a full handshake is performed.
+
+  @param[in]  Tls                Pointer to the TLS object.
+  @param[in]  Data               Pointer to the session data.
+  @param[in]  DataSize           Size of the session data in bytes.
+
+  @retval  EFI_SUCCESS           The session was set successfully.
+  @retval  EFI_INVALID_PARAMETER The parameters are invalid.
+  @retval  EFI_ACCESS_DENIED     The session was established with another server name.
+  @retval  EFI_UNSUPPORTED       The session can't be resumed by the TLS connection.
+
+**/
+EFI_STATUS
+EFIAPI
+TlsSetSession (
+  IN     VOID   *Tls,
+  IN     UINT8  *Data,
+  IN     UINTN  DataSize
+  )
+{
+  TLS_CONNECTION  *TlsConn;
+  SSL_SESSION     *Session;
+  CONST UINT8     *Buffer;
+  CONST CHAR8     *SessionHostName;
+  CONST CHAR8     *HostName;
+  EFI_STATUS      Status;
+
+  TlsConn = (TLS_CONNECTION *)Tls;
+
+  if ((TlsConn == NULL) || (TlsConn->Ssl == NULL) || (Data == NULL) ||
+      (DataSize == 0) || (DataSize > MAX_INT32))
+  {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Buffer  = Data;
+  Session = d2i_SSL_SESSION (NULL, &Buffer, (long)DataSize);
+  if (Session == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // Resuming a session skips the verification of the server certificate, only
+  // allow it for the server the session was verified with.
+  //
+  SessionHostName = SSL_SESSION_get0_hostname (Session);
+  HostName        = SSL_get_servername (TlsConn->Ssl, TLSEXT_NAMETYPE_host_name);
+  if ((SessionHostName == NULL) || (HostName == NULL) ||
+      (AsciiStrCmp (SessionHostName, HostName) != 0))
+  {
+    Status = EFI_ACCESS_DENIED;
+  } else if (SSL_set_session (TlsConn->Ssl, Session) != 1) {
+    Status = EFI_UNSUPPORTED;
+  } else {
+    Status = EFI_SUCCESS;
+  }
+
+  SSL_SESSION_free (Session);
+
+  return Status;
+}
+
 /**
   Gets the protocol version used by the specified TLS connection.
 
@@ -1589,3 +1658,92 @@ TlsGetExportKey (
            ) == 1 ?
          EFI_SUCCESS : EFI_PROTOCOL_ERROR;
 }
+
+/**
+  Gets the session used by the specified TLS connection.
+
+  This function returns the session used by the specified TLS connection in
+  serialized form, so that a later TLS connection to the same server can
+  resume it with TlsSetSession(). With TLS 1.3, the session can only be
+  resumed once the session ticket the server sends after the handshake has
+  been received.
+
+  @param[in]      Tls            Pointer to the TLS object.
+  @param[out]     Data           Pointer to the buffer to hold the session data.
+  @param[in,out]  DataSize       On input, the size of Data buffer in bytes.
+                                 On output, the size of the session data.
+
+  @retval  EFI_SUCCESS           The session data was returned successfully.
+  @retval  EFI_INVALID_PARAMETER The parameters are invalid.
+  @retval  EFI_NOT_FOUND         The session can't be resumed.
+  @retval  EFI_BUFFER_TOO_SMALL  The Data buffer is too small to hold the session data.
+  @retval  EFI_OUT_OF_RESOURCES  Memory allocation failed.
+  @retval  EFI_PROTOCOL_ERROR    Some other error occurred.
+
+**/
+EFI_STATUS
+EFIAPI
+TlsGetSession (
+  IN     VOID   *Tls,
+  OUT    VOID   *Data,
+  IN OUT UINTN  *DataSize
+  )
+{
+  TLS_CONNECTION  *TlsConn;
+  SSL_SESSION     *Session;
+  CONST CHAR8     *HostName;
+  UINT8           *Buffer;
+  INTN            Length;
+  EFI_STATUS      Status;
+
+  TlsConn = (TLS_CONNECTION *)Tls;
+
+  if ((TlsConn == NULL) || (TlsConn->Ssl == NULL) || (DataSize == NULL) ||
+      ((Data == NULL) && (*DataSize != 0)))
+  {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Session = SSL_get_session (TlsConn->Ssl);
+  if ((Session == NULL) || !SSL_SESSION_is_resumable (Session)) {
+    return EFI_NOT_FOUND;
+  }
+
+  //
+  // The server doesn't have to acknowledge the server name, record it in the
+  // session for TlsSetSession() to check.
+  //
+  Session = SSL_SESSION_dup (Session);
+  if (Session == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  HostName = SSL_get_servername (TlsConn->Ssl, TLSEXT_NAMETYPE_host_name);
+  if ((SSL_SESSION_get0_hostname (Session) == NULL) && (HostName != NULL) &&
+      (SSL_SESSION_set1_hostname (Session, HostName) != 1))
+  {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto ON_EXIT;
+  }
+
+  Length = i2d_SSL_SESSION (Session, NULL);
+  if (Length <= 0) {
+    Status = EFI_PROTOCOL_ERROR;
+    goto ON_EXIT;
+  }
+
+  if (*DataSize < (UINTN)Length) {
+    *DataSize = (UINTN)Length;
+    Status    = EFI_BUFFER_TOO_SMALL;
+    goto ON_EXIT;
+  }
+
+  Buffer    = Data;
+  *DataSize = (UINTN)i2d_SSL_SESSION (Session, &Buffer);
+  Status    = EFI_SUCCESS;
+
+ON_EXIT:
+  SSL_SESSION_free (Session);
+
+  return Status;
+}
@@ -378,6 +378,37 @@ TlsSetEcCurve (
   return EFI_UNSUPPORTED;
 }
 
+/**
+  Sets a session to be resumed by the specified TLS connection.
+
+  This function sets a session, as returned by TlsGetSession() for an earlier
+  TLS connection, to be resumed when the TLS connection is established. The
+  session is only used with the server name it was established with, which
+  must have been set with TlsSetVerifyHost() first. If the server declines
+  to resume the session, a full handshake is performed.
+
+  @param[in]  Tls                Pointer to the TLS object.
+  @param[in]  Data               Pointer to the session data.
+  @param[in]  DataSize           Size of the session data in bytes.
+
+  @retval  EFI_SUCCESS           The session was set successfully.
+  @retval  EFI_INVALID_PARAMETER The parameters are invalid.
+  @retval  EFI_ACCESS_DENIED     The session was established with another server name.
+  @retval  EFI_UNSUPPORTED       The session can't be resumed by the TLS connection.
+
+**/
+EFI_STATUS
+EFIAPI
+TlsSetSession (
+  IN     VOID   *Tls,
+  IN     UINT8  *Data,
+  IN     UINTN  DataSize
+  )
+{
+  ASSERT (FALSE);
+  return EFI_UNSUPPORTED;
+}
+
 /**
   Gets the protocol version used by the specified TLS connection.
 
@@ -736,3 +767,37 @@ TlsGetExportKey (
   ASSERT (FALSE);
   return EFI_UNSUPPORTED;
 }
+
+/**
+  Gets the session used by the specified TLS connection.
+
+  This function returns the session used by the specified TLS connection in
+  serialized form, so that a later TLS connection to the same server can
+  resume it with TlsSetSession(). With TLS 1.3, the session can only be
+  resumed once the session ticket the server sends after the handshake has
+  been received.
+
+  @param[in]      Tls            Pointer to the TLS object.
+  @param[out]     Data           Pointer to the buffer to hold the session data.
+  @param[in,out]  DataSize       On input, the size of Data buffer in bytes.
+                                 On output, the size of the session data.
+
+  @retval  EFI_SUCCESS           The session data was returned successfully.
+  @retval  EFI_INVALID_PARAMETER The parameters are invalid.
+  @retval  EFI_NOT_FOUND         The session can't be resumed.
+  @retval  EFI_BUFFER_TOO_SMALL  The Data buffer is too small to hold the session data.
+  @retval  EFI_OUT_OF_RESOURCES  Memory allocation failed.
+  @retval  EFI_PROTOCOL_ERROR    Some other error occurred.
+
+**/
+EFI_STATUS
+EFIAPI
+TlsGetSession (
+  IN     VOID   *Tls,
+  OUT    VOID   *Data,
+  IN OUT UINTN  *DataSize
+  )
+{
+  ASSERT (FALSE);
+  return EFI_UNSUPPORTED;
+}
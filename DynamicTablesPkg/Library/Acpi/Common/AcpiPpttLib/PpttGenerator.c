@@ -147,27 +147,19 @@ GetPpttNodeReferencedByToken (
 
   ASSERT (NodeIndexer != NULL);
 
-  DEBUG ((
-    DEBUG_INFO,
-    "PPTT: Node Indexer: SearchToken = %p\n",
-    SearchToken
-    ));
-
+  // This function is called for every parent, cache and private resource
+  // reference, so it does not print the nodes it goes through. With
+  // hundreds of Processor Hierarchy nodes printing them takes longer than
+  // building the table.
   while (NodeCount-- != 0) {
-    DEBUG ((
-      DEBUG_INFO,
-      "PPTT: Node Indexer: NodeIndexer->Token = %p. Offset = %d\n",
-      NodeIndexer->Token,
-      NodeIndexer->Offset
-      ));
-
     if (NodeIndexer->Token == SearchToken) {
       *IndexedNodeFound = NodeIndexer;
       Status            = EFI_SUCCESS;
       DEBUG ((
-        DEBUG_INFO,
-        "PPTT: Node Indexer: Token = %p. Found, Status = %r\n",
+        DEBUG_VERBOSE,
+        "PPTT: Node Indexer: Token = %p. Offset = %d. Found, Status = %r\n",
         SearchToken,
+        NodeIndexer->Offset,
         Status
         ));
       return Status;
@@ -214,7 +206,7 @@ DetectCyclesInTopology (
 
   while (NodesRemaining != 0) {
     DEBUG ((
-      DEBUG_INFO,
+      DEBUG_VERBOSE,
       "INFO: PPTT: Cycle detection for element with index %d\n",
       Generator->ProcTopologyStructCount - NodesRemaining
       ));
@@ -224,7 +216,7 @@ DetectCyclesInTopology (
     // Walk the topology tree
     while (CycleDetector->TopologyParent != NULL) {
       DEBUG ((
-        DEBUG_INFO,
+        DEBUG_VERBOSE,
         "INFO: PPTT: %p -> %p\n",
         CycleDetector->Token,
         CycleDetector->TopologyParent->Token
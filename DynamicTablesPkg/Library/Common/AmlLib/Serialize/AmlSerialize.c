@@ -190,33 +190,23 @@ AmlSerializeTree (
     return EFI_INVALID_PARAMETER;
   }
 
-  // Compute the total size of the AML blob.
-  Status = AmlComputeSize (
-             (CONST AML_NODE_HEADER *)RootNode,
-             &TableSize
-             );
-  if (EFI_ERROR (Status)) {
-    ASSERT (0);
-    return Status;
-  }
-
-  // Add the size of the ACPI header.
-  TableSize += (UINT32)sizeof (EFI_ACPI_DESCRIPTION_HEADER);
-
-  // Check the size against the SDT header.
-  // The Length field in the SDT Header is updated if the tree has
-  // been modified.
-  if (TableSize != RootNode->SdtHeader->Length) {
+  // The Length field in the SDT Header is updated when the tree is
+  // modified, so the size of the table is known without walking the tree.
+  // The size is checked once the tree has been serialized.
+  TableSize = RootNode->SdtHeader->Length;
+  if (TableSize < sizeof (EFI_ACPI_DESCRIPTION_HEADER)) {
     ASSERT (0);
     return EFI_INVALID_PARAMETER;
   }
 
   // Buffer is not big enough, or NULL.
-  if ((TableSize < *BufferSize) || (Buffer == NULL)) {
+  if ((*BufferSize < TableSize) || (Buffer == NULL)) {
     *BufferSize = TableSize;
     return EFI_SUCCESS;
   }
 
+  *BufferSize = TableSize;
+
   // Initialize the stream to the TableSize that is needed.
   Status = AmlStreamInit (
              &FStream,
@@ -252,13 +242,19 @@ AmlSerializeTree (
     return Status;
   }
 
+  // Check the size of the serialized tree against the SDT header.
+  if (AmlStreamGetIndex (&FStream) != TableSize) {
+    ASSERT (0);
+    return EFI_INVALID_PARAMETER;
+  }
+
   // Update the checksum.
   return AcpiPlatformChecksum ((EFI_ACPI_DESCRIPTION_HEADER *)Buffer);
 }
 
 /** Serialize an AML definition block.
 
-  This functions allocates memory with the "AllocateZeroPool ()"
+  This functions allocates memory with the "AllocatePool ()"
   function. This memory is used to serialize the AML tree and is
   returned in the Table.
 
@@ -303,7 +299,8 @@ AmlSerializeDefinitionBlock (
     return Status;
   }
 
-  TableBuffer = (UINT8 *)AllocateZeroPool (TableSize);
+  // The whole buffer is written when the tree is serialized.
+  TableBuffer = (UINT8 *)AllocatePool (TableSize);
   if (TableBuffer == NULL) {
     DEBUG ((
       DEBUG_ERROR,
@@ -404,6 +404,14 @@ DynamicPlatRepoFinalise (
     }
   } // for
 
+  // Sort the token mapper so that objects can be looked up by token
+  // with a binary search.
+  Status = TokenMapperSortObjects (&This->TokenMapper);
+  if (EFI_ERROR (Status)) {
+    ASSERT (0);
+    goto error_handler;
+  }
+
   return EFI_SUCCESS;
 
 error_handler:
@@ -10,6 +10,7 @@
     - Obj or OBJ - Object
 **/
 
+#include <Library/BaseLib.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
 #include <Library/MemoryAllocationLib.h>
@@ -102,7 +103,8 @@ TokenMapperGetObject (
   )
 {
   UINTN                 Index;
-  UINTN                 MaxCount;
+  UINTN                 Low;
+  UINTN                 High;
   TOKEN_MAP_DESCRIPTOR  *TokenMapDesc;
 
   // Nothing to do.
@@ -119,22 +121,30 @@ TokenMapperGetObject (
     return EFI_INVALID_PARAMETER;
   }
 
-  TokenMapDesc = TokenMapper->TokenDescArray;
-  MaxCount     = TokenMapper->MaxTokenDescCount;
-  for (Index = 0; Index < MaxCount; Index++) {
-    if ((TokenMapDesc->CmObjDesc.ObjectId == ObjectId)  &&
-        (TokenMapDesc->Token == Token))
-    {
-      CopyMem (
-        CmObjDesc,
-        &TokenMapDesc->CmObjDesc,
-        sizeof (CM_OBJ_DESCRIPTOR)
-        );
-      return EFI_SUCCESS;
+  // The descriptors are sorted by token, see TokenMapperSortObjects().
+  // Tokens are unique, so the search can stop at the first match.
+  Low  = 0;
+  High = TokenMapper->ItemCount;
+  while (Low < High) {
+    Index        = Low + (High - Low) / 2;
+    TokenMapDesc = &TokenMapper->TokenDescArray[Index];
+    if (TokenMapDesc->Token < Token) {
+      Low = Index + 1;
+    } else if (TokenMapDesc->Token > Token) {
+      High = Index;
+    } else {
+      if (TokenMapDesc->CmObjDesc.ObjectId == ObjectId) {
+        CopyMem (
+          CmObjDesc,
+          &TokenMapDesc->CmObjDesc,
+          sizeof (CM_OBJ_DESCRIPTOR)
+          );
+        return EFI_SUCCESS;
+      }
+
+      break;
     }
-
-    TokenMapDesc++;
-  } // for
+  } // while
 
 exit_handler:
   DEBUG ((
@@ -147,6 +157,79 @@ exit_handler:
   return EFI_NOT_FOUND;
 }
 
+/** Compare the tokens of two TOKEN_MAP_DESCRIPTOR.
+
+  @param [in] Buffer1   Pointer to the first TOKEN_MAP_DESCRIPTOR.
+  @param [in] Buffer2   Pointer to the second TOKEN_MAP_DESCRIPTOR.
+
+  @retval  <0   The token of Buffer1 is lower than the token of Buffer2.
+  @retval   0   The tokens are equal.
+  @retval  >0   The token of Buffer1 is greater than the token of Buffer2.
+**/
+STATIC
+INTN
+EFIAPI
+TokenMapperCompareToken (
+  IN  CONST VOID  *Buffer1,
+  IN  CONST VOID  *Buffer2
+  )
+{
+  CM_OBJECT_TOKEN  Token1;
+  CM_OBJECT_TOKEN  Token2;
+
+  Token1 = ((CONST TOKEN_MAP_DESCRIPTOR *)Buffer1)->Token;
+  Token2 = ((CONST TOKEN_MAP_DESCRIPTOR *)Buffer2)->Token;
+
+  if (Token1 < Token2) {
+    return -1;
+  } else if (Token1 > Token2) {
+    return 1;
+  }
+
+  return 0;
+}
+
+/** Sort the CmObjDesc of a TokenMapper by token.
+
+  This must be called once all the objects have been added,
+  and before TokenMapperGetObject() is called.
+
+  @param [in] TokenMapper   The TokenMapper instance.
+
+  @retval EFI_SUCCESS             The function completed successfully.
+  @retval EFI_INVALID_PARAMETER   A parameter is invalid.
+**/
+EFI_STATUS
+EFIAPI
+TokenMapperSortObjects (
+  IN  TOKEN_MAPPER  *TokenMapper
+  )
+{
+  TOKEN_MAP_DESCRIPTOR  TempDesc;
+
+  // Nothing to do.
+  if ((TokenMapper != NULL) && (TokenMapper->ItemCount == 0)) {
+    return EFI_SUCCESS;
+  }
+
+  if ((TokenMapper == NULL) ||
+      (TokenMapper->TokenDescArray == NULL))
+  {
+    ASSERT (0);
+    return EFI_INVALID_PARAMETER;
+  }
+
+  QuickSort (
+    TokenMapper->TokenDescArray,
+    TokenMapper->ItemCount,
+    sizeof (TOKEN_MAP_DESCRIPTOR),
+    TokenMapperCompareToken,
+    &TempDesc
+    );
+
+  return EFI_SUCCESS;
+}
+
 /** Initialise a TokenMapper.
 
   @param [in] TokenMapper       The TokenMapper to initialise.
@@ -91,6 +91,22 @@ TokenMapperGetObject (
   OUT CM_OBJ_DESCRIPTOR  *CmObjDesc
   );
 
+/** Sort the CmObjDesc of a TokenMapper by token.
+
+  This must be called once all the objects have been added,
+  and before TokenMapperGetObject() is called.
+
+  @param [in] TokenMapper   The TokenMapper instance.
+
+  @retval EFI_SUCCESS             The function completed successfully.
+  @retval EFI_INVALID_PARAMETER   A parameter is invalid.
+**/
+EFI_STATUS
+EFIAPI
+TokenMapperSortObjects (
+  IN  TOKEN_MAPPER  *TokenMapper
+  );
+
 /** Initialise a TokenMapper.
 
   @param [in] TokenMapper       The TokenMapper to initialise.
@@ -483,6 +483,7 @@ FdtCountCondNodeInBranch (
 {
   EFI_STATUS  Status;
   INT32       CurrNode;
+  INT32       Depth;
 
   if ((Fdt == NULL)         ||
       (NodeChecker == NULL) ||
@@ -492,22 +493,28 @@ FdtCountCondNodeInBranch (
     return EFI_INVALID_PARAMETER;
   }
 
+  // Walk the branch once, keeping track of the depth relative to the
+  // branch, rather than calling FdtGetNextCondNodeInBranch() for each
+  // node: it has to find the depth of its input node again from the
+  // start of the branch, which makes the count quadratic.
   *NodeCount = 0;
   CurrNode   = FdtBranch;
+  Depth      = 0;
   while (TRUE) {
-    Status = FdtGetNextCondNodeInBranch (
+    Status = FdtGetNextCondNode (
                Fdt,
-               FdtBranch,
+               &CurrNode,
+               &Depth,
                NodeChecker,
-               Context,
-               &CurrNode
+               Context
                );
     if (EFI_ERROR (Status)  &&
         (Status != EFI_NOT_FOUND))
     {
       ASSERT (0);
       return Status;
-    } else if (Status == EFI_NOT_FOUND) {
+    } else if ((Status == EFI_NOT_FOUND) || (Depth <= 0)) {
+      // No more matching node, or the node found is not in the branch.
       break;
     }
 
@@ -37,9 +37,39 @@ FatFreeODir (
     FatFreeDirEnt (DirEnt);
   }
 
+  FreePool (ODir->LongNameHashTable);
   FreePool (ODir);
 }
 
+/**
+
+  Release the least recently used cached directories until the directory cache
+  holds at most MaxCount directories and MaxEntryCount directory entries.
+
+  @param  Volume                - FAT file system volume.
+  @param  MaxCount              - The maximum number of cached directories to keep.
+  @param  MaxEntryCount         - The maximum number of cached directory entries to keep.
+
+**/
+STATIC
+VOID
+FatTrimODirCache (
+  IN FAT_VOLUME  *Volume,
+  IN UINTN       MaxCount,
+  IN UINTN       MaxEntryCount
+  )
+{
+  FAT_ODIR  *ODir;
+
+  while ((Volume->DirCacheCount > MaxCount) || (Volume->DirCacheEntryCount > MaxEntryCount)) {
+    ODir = ODIR_FROM_DIRCACHELINK (Volume->DirCacheList.BackLink);
+    RemoveEntryList (&ODir->DirCacheLink);
+    Volume->DirCacheCount--;
+    Volume->DirCacheEntryCount -= ODir->HashEntryCount;
+    FatFreeODir (ODir);
+  }
+}
+
 /**
 
   Allocate the directory structure.
@@ -56,6 +86,19 @@ FatAllocateODir (
   FAT_ODIR  *ODir;
 
   ODir = AllocateZeroPool (sizeof (FAT_ODIR));
+  if ((ODir != NULL) && EFI_ERROR (FatAllocateHashTable (ODir))) {
+    FreePool (ODir);
+    ODir = NULL;
+  }
+
+  if ((ODir == NULL) && (OFile->Volume->DirCacheCount > 0)) {
+    //
+    // Give the memory of the cached directories back and try again
+    //
+    FatTrimODirCache (OFile->Volume, 0, 0);
+    return FatAllocateODir (OFile);
+  }
+
   if (ODir != NULL) {
     //
     // Initialize the directory entry list
@@ -86,34 +129,28 @@ FatDiscardODir (
 
   Volume = OFile->Volume;
   ODir   = OFile->ODir;
-  if (!OFile->DirEnt->Invalid) {
+  if (OFile->DirEnt->Invalid) {
     //
-    // If OFile does not represent a deleted file, then we will cache the directory
-    // We use OFile's first cluster as the directory's tag
+    // Release ODir Structure
     //
-    ODir->DirCacheTag = OFile->FileCluster;
-    InsertHeadList (&Volume->DirCacheList, &ODir->DirCacheLink);
-    if (Volume->DirCacheCount == FAT_MAX_DIR_CACHE_COUNT) {
-      //
-      // Replace the least recent used directory
-      //
-      ODir = ODIR_FROM_DIRCACHELINK (Volume->DirCacheList.BackLink);
-      RemoveEntryList (&ODir->DirCacheLink);
-    } else {
-      //
-      // No need to find a replace
-      //
-      Volume->DirCacheCount++;
-      ODir = NULL;
-    }
+    FatFreeODir (ODir);
+    return;
   }
 
   //
-  // Release ODir Structure
+  // If OFile does not represent a deleted file, then we will cache the directory
+  // We use OFile's first cluster as the directory's tag
   //
-  if (ODir != NULL) {
-    FatFreeODir (ODir);
-  }
+  ODir->DirCacheTag = OFile->FileCluster;
+  InsertHeadList (&Volume->DirCacheList, &ODir->DirCacheLink);
+  Volume->DirCacheCount++;
+  Volume->DirCacheEntryCount += ODir->HashEntryCount;
+
+  //
+  // Replace the least recent used directories. The directory just cached
+  // is kept even if it alone holds more entries than the cache limit.
+  //
+  FatTrimODirCache (Volume, FAT_MAX_DIR_CACHE_COUNT, MAX (FAT_MAX_DIR_CACHE_ENTRY, ODir->HashEntryCount));
 }
 
 /**
@@ -149,6 +186,7 @@ FatRequestODir (
     if (CurrentODir->DirCacheTag == DirCacheTag) {
       RemoveEntryList (&CurrentODir->DirCacheLink);
       Volume->DirCacheCount--;
+      Volume->DirCacheEntryCount -= CurrentODir->HashEntryCount;
       ODir = CurrentODir;
       break;
     }
@@ -176,12 +214,5 @@ FatCleanupODirCache (
   IN FAT_VOLUME  *Volume
   )
 {
-  FAT_ODIR  *ODir;
-
-  while (Volume->DirCacheCount > 0) {
-    ODir = ODIR_FROM_DIRCACHELINK (Volume->DirCacheList.BackLink);
-    RemoveEntryList (&ODir->DirCacheLink);
-    FatFreeODir (ODir);
-    Volume->DirCacheCount--;
-  }
+  FatTrimODirCache (Volume, 0, 0);
 }
@@ -8,6 +8,79 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include "Fat.h"
 
+/**
+
+  Exchange the cache page with the image on the disk
+
+  @param  Volume                - FAT file system volume.
+  @param  DataType              - Indicate the cache type.
+  @param  IoMode                - Indicate whether to load this page from disk or store this page to disk.
+  @param  CacheTag              - The Cache Tag for the current cache page.
+  @param  Task                    point to task instance.
+
+  @retval EFI_SUCCESS           - Cache page exchanged successfully.
+  @return Others                - An error occurred when exchanging cache page.
+
+**/
+STATIC
+EFI_STATUS
+FatExchangeCachePage (
+  IN FAT_VOLUME       *Volume,
+  IN CACHE_DATA_TYPE  DataType,
+  IN IO_MODE          IoMode,
+  IN CACHE_TAG        *CacheTag,
+  IN FAT_TASK         *Task
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       GroupNo;
+  UINTN       PageNo;
+  UINTN       WriteCount;
+  UINTN       RealSize;
+  UINT64      EntryPos;
+  UINT64      MaxSize;
+  DISK_CACHE  *DiskCache;
+  VOID        *PageAddress;
+  UINT8       PageAlignment;
+
+  DiskCache     = &Volume->DiskCache[DataType];
+  PageNo        = CacheTag->PageNo;
+  GroupNo       = PageNo & DiskCache->GroupMask;
+  PageAlignment = DiskCache->PageAlignment;
+  PageAddress   = DiskCache->CacheBase + (GroupNo << PageAlignment);
+  EntryPos      = DiskCache->BaseAddress + LShiftU64 (PageNo, PageAlignment);
+  RealSize      = CacheTag->RealSize;
+  if (IoMode == ReadDisk) {
+    RealSize = (UINTN)1 << PageAlignment;
+    MaxSize  = DiskCache->LimitAddress - EntryPos;
+    if (MaxSize < RealSize) {
+      DEBUG ((DEBUG_INFO, "FatDiskIo: Cache Page OutBound occurred! \n"));
+      RealSize = (UINTN)MaxSize;
+    }
+  }
+
+  WriteCount = 1;
+  if ((DataType == CacheFat) && (IoMode == WriteDisk)) {
+    WriteCount = Volume->NumFats;
+  }
+
+  do {
+    //
+    // Only fat table writing will execute more than once
+    //
+    Status = FatDiskIo (Volume, IoMode, EntryPos, RealSize, PageAddress, Task);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    EntryPos += Volume->FatSize;
+  } while (--WriteCount > 0);
+
+  CacheTag->Dirty    = FALSE;
+  CacheTag->RealSize = RealSize;
+  return EFI_SUCCESS;
+}
+
 /**
 
   This function is used by the Data Cache.
@@ -18,6 +91,9 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
   When this function is called by read command, if any entry in this range
   is dirty, it means that the relative info directly read from media is older than
   than the info in the cache; So need to update the relative info in the Buffer.
+  A non-blocking read only completes after this function returns and would
+  overwrite the Buffer, so in that case the dirty entries are written back to
+  the disk instead, before the read is submitted.
 
   @param  Volume                - FAT file system volume.
   @param  IoMode                - This function is called by read command or write command
@@ -25,18 +101,24 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
   @param  EndPageNo             - Last PageNo to be checked in the cache.
   @param  Buffer                - The user buffer need to update. Only when doing the read command
                           and there is dirty cache in the cache range, this parameter will be used.
+  @param  Task                    point to task instance.
+
+  @retval EFI_SUCCESS           - The cache range is flushed successfully.
+  @return Others                - An error occurred when writing back a dirty cache page.
 
 **/
 STATIC
-VOID
+EFI_STATUS
 FatFlushDataCacheRange (
   IN  FAT_VOLUME  *Volume,
   IN  IO_MODE     IoMode,
   IN  UINTN       StartPageNo,
   IN  UINTN       EndPageNo,
-  OUT UINT8       *Buffer
+  OUT UINT8       *Buffer,
+  IN  FAT_TASK    *Task
   )
 {
+  EFI_STATUS  Status;
   UINTN       PageNo;
   UINTN       GroupNo;
   UINTN       GroupMask;
@@ -62,7 +144,12 @@ FatFlushDataCacheRange (
       // be updated with the cache's dirty data.
       //
       if (IoMode == ReadDisk) {
-        if (CacheTag->Dirty) {
+        if (CacheTag->Dirty && (Task != NULL)) {
+          Status = FatExchangeCachePage (Volume, CacheData, WriteDisk, CacheTag, NULL);
+          if (EFI_ERROR (Status)) {
+            return Status;
+          }
+        } else if (CacheTag->Dirty) {
           CopyMem (
             Buffer + ((PageNo - StartPageNo) << PageAlignment),
             BaseAddress + (GroupNo << PageAlignment),
@@ -77,79 +164,102 @@ FatFlushDataCacheRange (
       }
     }
   }
+
+  return EFI_SUCCESS;
 }
 
 /**
 
-  Exchange the cache page with the image on the disk
+  Load the data cache page PageNo from the disk, together with the pages
+  following it when the data cache is being missed sequentially.
+
+  The read-ahead window doubles on every sequential miss up to
+  FAT_DATACACHE_READ_AHEAD_MAX_COUNT pages, and falls back to a single page on
+  the first random access. Consecutive pages map to consecutive cache groups,
+  so the whole window is loaded with a single disk access. The window never
+  wraps around the cache, runs past the volume or evicts a dirty page.
 
   @param  Volume                - FAT file system volume.
-  @param  DataType              - Indicate the cache type.
-  @param  IoMode                - Indicate whether to load this page from disk or store this page to disk.
-  @param  CacheTag              - The Cache Tag for the current cache page.
-  @param  Task                    point to task instance.
+  @param  PageNo                - PageNo to load into the cache.
 
-  @retval EFI_SUCCESS           - Cache page exchanged successfully.
-  @return Others                - An error occurred when exchanging cache page.
+  @retval EFI_SUCCESS           - The cache pages are loaded successfully.
+  @return other                 - An error occurred when accessing data.
 
 **/
 STATIC
 EFI_STATUS
-FatExchangeCachePage (
-  IN FAT_VOLUME       *Volume,
-  IN CACHE_DATA_TYPE  DataType,
-  IN IO_MODE          IoMode,
-  IN CACHE_TAG        *CacheTag,
-  IN FAT_TASK         *Task
+FatReadDataCachePages (
+  IN FAT_VOLUME  *Volume,
+  IN UINTN       PageNo
   )
 {
   EFI_STATUS  Status;
+  DISK_CACHE  *DiskCache;
+  CACHE_TAG   *CacheTag;
   UINTN       GroupNo;
-  UINTN       PageNo;
-  UINTN       WriteCount;
-  UINTN       RealSize;
+  UINTN       PageCount;
+  UINTN       PageSize;
+  UINTN       ReadSize;
+  UINTN       Index;
   UINT64      EntryPos;
   UINT64      MaxSize;
-  DISK_CACHE  *DiskCache;
-  VOID        *PageAddress;
   UINT8       PageAlignment;
 
-  DiskCache     = &Volume->DiskCache[DataType];
-  PageNo        = CacheTag->PageNo;
+  DiskCache     = &Volume->DiskCache[CacheData];
   GroupNo       = PageNo & DiskCache->GroupMask;
   PageAlignment = DiskCache->PageAlignment;
-  PageAddress   = DiskCache->CacheBase + (GroupNo << PageAlignment);
+  PageSize      = (UINTN)1 << PageAlignment;
   EntryPos      = DiskCache->BaseAddress + LShiftU64 (PageNo, PageAlignment);
-  RealSize      = CacheTag->RealSize;
-  if (IoMode == ReadDisk) {
-    RealSize = (UINTN)1 << PageAlignment;
-    MaxSize  = DiskCache->LimitAddress - EntryPos;
-    if (MaxSize < RealSize) {
-      DEBUG ((DEBUG_INFO, "FatDiskIo: Cache Page OutBound occurred! \n"));
-      RealSize = (UINTN)MaxSize;
+  MaxSize       = DiskCache->LimitAddress - EntryPos;
+
+  if ((PageNo == DiskCache->NextPageNo) && (DiskCache->ReadAheadCount > 0)) {
+    PageCount = MIN (DiskCache->ReadAheadCount * 2, FAT_DATACACHE_READ_AHEAD_MAX_COUNT);
+  } else {
+    PageCount = 1;
+  }
+
+  DiskCache->ReadAheadCount = PageCount;
+
+  PageCount = MIN (PageCount, DiskCache->GroupMask + 1 - GroupNo);
+  for (Index = 1; Index < PageCount; Index++) {
+    if (LShiftU64 (Index, PageAlignment) >= MaxSize) {
+      break;
+    }
+
+    CacheTag = &DiskCache->CacheTag[GroupNo + Index];
+    if ((CacheTag->RealSize > 0) && (CacheTag->Dirty || (CacheTag->PageNo == PageNo + Index))) {
+      break;
     }
   }
 
-  WriteCount = 1;
-  if ((DataType == CacheFat) && (IoMode == WriteDisk)) {
-    WriteCount = Volume->NumFats;
+  PageCount = Index;
+  ReadSize  = PageCount << PageAlignment;
+  if (MaxSize < ReadSize) {
+    if (PageCount == 1) {
+      DEBUG ((DEBUG_INFO, "FatDiskIo: Cache Page OutBound occurred! \n"));
+    }
+
+    ReadSize = (UINTN)MaxSize;
   }
 
-  do {
-    //
-    // Only fat table writing will execute more than once
-    //
-    Status = FatDiskIo (Volume, IoMode, EntryPos, RealSize, PageAddress, Task);
+  Status = FatDiskIo (Volume, ReadDisk, EntryPos, ReadSize, DiskCache->CacheBase + (GroupNo << PageAlignment), NULL);
+
+  for (Index = 0; Index < PageCount; Index++) {
+    CacheTag         = &DiskCache->CacheTag[GroupNo + Index];
+    CacheTag->PageNo = PageNo + Index;
+    CacheTag->Dirty  = FALSE;
     if (EFI_ERROR (Status)) {
-      return Status;
+      //
+      // None of the pages in the window can be trusted after a failed read
+      //
+      CacheTag->RealSize = 0;
+    } else {
+      CacheTag->RealSize = MIN (PageSize, ReadSize - (Index << PageAlignment));
     }
+  }
 
-    EntryPos += Volume->FatSize;
-  } while (--WriteCount > 0);
-
-  CacheTag->Dirty    = FALSE;
-  CacheTag->RealSize = RealSize;
-  return EFI_SUCCESS;
+  DiskCache->NextPageNo = PageNo + PageCount;
+  return Status;
 }
 
 /**
@@ -198,6 +308,10 @@ FatGetCachePage (
   //
   // Load new data from disk;
   //
+  if (CacheDataType == CacheData) {
+    return FatReadDataCachePages (Volume, PageNo);
+  }
+
   CacheTag->PageNo = PageNo;
   Status           = FatExchangeCachePage (Volume, CacheDataType, ReadDisk, CacheTag, NULL);
 
@@ -216,6 +330,7 @@ FatGetCachePage (
   @param  Offset                - The starting byte of cache page.
   @param  Length                - The number of bytes that is read or written
   @param  Buffer                - Buffer containing cache data.
+  @param  Task                    point to task instance.
 
   @retval EFI_SUCCESS           - The data was accessed correctly.
   @return Others                - An error occurred when accessing unaligned cache page.
@@ -230,7 +345,8 @@ FatAccessUnalignedCachePage (
   IN     UINTN            PageNo,
   IN     UINTN            Offset,
   IN     UINTN            Length,
-  IN OUT VOID             *Buffer
+  IN OUT VOID             *Buffer,
+  IN     FAT_TASK         *Task
   )
 {
   EFI_STATUS  Status;
@@ -243,7 +359,26 @@ FatAccessUnalignedCachePage (
   DiskCache = &Volume->DiskCache[CacheDataType];
   GroupNo   = PageNo & DiskCache->GroupMask;
   CacheTag  = &DiskCache->CacheTag[GroupNo];
-  Status    = FatGetCachePage (Volume, CacheDataType, PageNo, CacheTag);
+
+  if ((Task != NULL) && (IoMode == ReadDisk) && (CacheDataType == CacheData) &&
+      ((CacheTag->RealSize == 0) || (CacheTag->PageNo != PageNo)))
+  {
+    //
+    // A non-blocking read that misses the cache is queued to the disk for just
+    // the requested bytes instead of loading the whole page synchronously. The
+    // page is not in the cache, so the disk holds its latest content.
+    //
+    return FatDiskIo (
+             Volume,
+             ReadDisk,
+             DiskCache->BaseAddress + LShiftU64 (PageNo, DiskCache->PageAlignment) + Offset,
+             Length,
+             Buffer,
+             Task
+             );
+  }
+
+  Status = FatGetCachePage (Volume, CacheDataType, PageNo, CacheTag);
   if (!EFI_ERROR (Status)) {
     Source      = DiskCache->CacheBase + (GroupNo << DiskCache->PageAlignment) + Offset;
     Destination = Buffer;
@@ -329,7 +464,7 @@ FatAccessCache (
       Length = BufferSize;
     }
 
-    Status = FatAccessUnalignedCachePage (Volume, CacheDataType, IoMode, PageNo, UnderRun, Length, Buffer);
+    Status = FatAccessUnalignedCachePage (Volume, CacheDataType, IoMode, PageNo, UnderRun, Length, Buffer, Task);
     if (EFI_ERROR (Status)) {
       return Status;
     }
@@ -361,7 +496,11 @@ FatAccessCache (
     // If these access data over laps the relative cache range, these cache pages need
     // to be updated.
     //
-    FatFlushDataCacheRange (Volume, IoMode, PageNo, OverRunPageNo, Buffer);
+    Status = FatFlushDataCacheRange (Volume, IoMode, PageNo, OverRunPageNo, Buffer, Task);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
     Buffer     += AlignedSize;
     BufferSize -= AlignedSize;
   }
@@ -374,7 +513,7 @@ FatAccessCache (
     //
     // Last read is not a complete page
     //
-    Status = FatAccessUnalignedCachePage (Volume, CacheDataType, IoMode, OverRunPageNo, 0, OverRun, Buffer);
+    Status = FatAccessUnalignedCachePage (Volume, CacheDataType, IoMode, OverRunPageNo, 0, OverRun, Buffer, Task);
   }
 
   return Status;
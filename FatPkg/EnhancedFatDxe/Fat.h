@@ -84,6 +84,11 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define FAT_FATCACHE_GROUP_MIN_COUNT      1
 #define FAT_FATCACHE_GROUP_MAX_COUNT      16
 
+//
+// Maximum number of data cache pages loaded by one sequential read-ahead
+//
+#define FAT_DATACACHE_READ_AHEAD_MAX_COUNT  16
+
 //
 // Used in 8.3 generation algorithm
 //
@@ -103,8 +108,11 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define LC_ISO_639_2_ENTRY_SIZE  3
 #define MAX_LANG_CODE_SIZE       100
 
-#define FAT_MAX_DIR_CACHE_COUNT  8
+#define FAT_MAX_DIR_CACHE_COUNT  64
+#define FAT_MAX_DIR_CACHE_ENTRY  0x8000
 #define FAT_MAX_DIRENTRY_COUNT   0xFFFF
+#define FAT_MIN_EXTENT_COUNT     8
+#define FAT_MAX_EXTENT_COUNT     0x1000
 typedef CHAR8 LC_ISO_639_2;
 
 //
@@ -155,14 +163,17 @@ typedef struct {
   BOOLEAN      Dirty;
   UINT8        PageAlignment;
   UINTN        GroupMask;
+  UINTN        NextPageNo;       // page following the last read-ahead window
+  UINTN        ReadAheadCount;   // pages loaded by the last read-ahead window
   CACHE_TAG    CacheTag[FAT_DATACACHE_GROUP_COUNT];
 } DISK_CACHE;
 
 //
-// Hash table size
+// Hash table size, the tables of a directory double in size whenever the
+// directory holds more entries than the tables have buckets
 //
-#define HASH_TABLE_SIZE  0x400
-#define HASH_TABLE_MASK  (HASH_TABLE_SIZE - 1)
+#define HASH_TABLE_MIN_SIZE  0x80
+#define HASH_TABLE_MAX_SIZE  0x10000
 
 //
 // The directory entry for opened directory
@@ -195,8 +206,10 @@ struct _FAT_ODIR {
   BOOLEAN       EndOfDir;                     // Indicate whether we have reached the end of the directory
   LIST_ENTRY    DirCacheLink;                 // Linked in Volume->DirCacheList when discarded
   UINTN         DirCacheTag;                  // The identification of the directory when in directory cache
-  FAT_DIRENT    *LongNameHashTable[HASH_TABLE_SIZE];
-  FAT_DIRENT    *ShortNameHashTable[HASH_TABLE_SIZE];
+  FAT_DIRENT    **LongNameHashTable;
+  FAT_DIRENT    **ShortNameHashTable;
+  UINTN         HashTableSize;                // Number of buckets in each hash table
+  UINTN         HashEntryCount;               // Number of directory entries in the hash tables
 };
 
 typedef struct {
@@ -228,6 +241,15 @@ typedef struct {
   LIST_ENTRY            Link;
 } FAT_SUBTASK;
 
+//
+// A run of contiguous clusters in the cluster chain of a file
+//
+typedef struct {
+  UINTN    FileCluster;                       // Index of the first cluster of the run in the file
+  UINTN    DiskCluster;                       // First cluster of the run on the disk
+  UINTN    ClusterCount;
+} FAT_EXTENT;
+
 //
 // FAT_OFILE - Each opened file
 //
@@ -271,6 +293,15 @@ struct _FAT_OFILE {
   UINT64        PosDisk;        // on the disk
   UINTN         PosRem;         // remaining in this disk run
   //
+  // The extent map of the cluster chain, built lazily from the start of the
+  // chain by FatOFilePosition, and discarded when the chain is truncated.
+  // ExtentComplete is set once the map reaches the end of the chain.
+  //
+  FAT_EXTENT    *Extents;
+  UINTN         ExtentCount;
+  UINTN         ExtentCapacity;
+  BOOLEAN       ExtentComplete;
+  //
   // The opened parent, full path length and currently opened child files
   //
   FAT_OFILE     *Parent;
@@ -368,6 +399,7 @@ struct _FAT_VOLUME {
   //
   LIST_ENTRY                         DirCacheList;
   UINTN                              DirCacheCount;
+  UINTN                              DirCacheEntryCount;
 
   //
   // Disk Cache for this volume
@@ -1800,6 +1832,21 @@ FatShortNameHashSearch (
   IN CHAR8     *ShortNameString
   );
 
+/**
+
+  Allocate the hash tables of a directory.
+
+  @param  ODir                  - The directory.
+
+  @retval EFI_SUCCESS           - The hash tables are allocated.
+  @retval EFI_OUT_OF_RESOURCES  - Not enough memory for the hash tables.
+
+**/
+EFI_STATUS
+FatAllocateHashTable (
+  IN FAT_ODIR  *ODir
+  );
+
 /**
 
   Insert directory entry to hash table.
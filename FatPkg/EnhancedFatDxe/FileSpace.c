@@ -407,6 +407,11 @@ FatShrinkEof (
   OFile->FileLastCluster    = LastCluster;
   OFile->Dirty              = TRUE;
   //
+  // The clusters past the new end of file are freed, discard the extent map
+  //
+  OFile->ExtentCount    = 0;
+  OFile->ExtentComplete = FALSE;
+  //
   // Free the remaining cluster chain
   //
   return FatFreeClusters (Volume, Cluster);
@@ -536,8 +541,12 @@ FatGrowEof (
     }
   }
 
-  OFile->FileSize = (UINTN)NewSizeInBytes;
-  OFile->Dirty    = TRUE;
+  //
+  // New clusters are only appended, the extent map is still valid but may continue
+  //
+  OFile->ExtentComplete = FALSE;
+  OFile->FileSize       = (UINTN)NewSizeInBytes;
+  OFile->Dirty          = TRUE;
   return EFI_SUCCESS;
 
 Done:
@@ -545,6 +554,186 @@ Done:
   return Status;
 }
 
+/**
+
+  Extend the extent map of OFile until it covers the cluster ClusterIndex of
+  the file, or until it reaches the end of the cluster chain.
+
+  @param  OFile                 - The open file.
+  @param  ClusterIndex          - The index of the cluster in the file to cover.
+
+  @retval EFI_SUCCESS           - The map covers ClusterIndex or the whole chain.
+  @retval EFI_OUT_OF_RESOURCES  - The map cannot grow any more.
+  @retval EFI_VOLUME_CORRUPTED  - Cluster chain corrupt.
+
+**/
+STATIC
+EFI_STATUS
+FatExtendExtentMap (
+  IN FAT_OFILE  *OFile,
+  IN UINTN      ClusterIndex
+  )
+{
+  FAT_VOLUME  *Volume;
+  FAT_EXTENT  *Extent;
+  FAT_EXTENT  *NewExtents;
+  UINTN       NewCapacity;
+  UINTN       Cluster;
+  UINTN       Index;
+
+  Volume = OFile->Volume;
+
+  while (!OFile->ExtentComplete) {
+    if (OFile->ExtentCount == 0) {
+      Extent  = NULL;
+      Index   = 0;
+      Cluster = OFile->FileCluster;
+    } else {
+      Extent = &OFile->Extents[OFile->ExtentCount - 1];
+      Index  = Extent->FileCluster + Extent->ClusterCount;
+      if (Index > ClusterIndex) {
+        break;
+      }
+
+      Cluster = FatGetFatEntry (Volume, Extent->DiskCluster + Extent->ClusterCount - 1);
+    }
+
+    if ((Extent != NULL) && FAT_END_OF_FAT_CHAIN (Cluster)) {
+      OFile->ExtentComplete = TRUE;
+      break;
+    }
+
+    if ((Cluster < FAT_MIN_CLUSTER) || (Cluster > Volume->MaxCluster + 1)) {
+      DEBUG ((DEBUG_INIT | DEBUG_ERROR, "FatExtendExtentMap: cluster chain corrupt\n"));
+      return EFI_VOLUME_CORRUPTED;
+    }
+
+    if ((Extent != NULL) && (Cluster == Extent->DiskCluster + Extent->ClusterCount)) {
+      Extent->ClusterCount++;
+      continue;
+    }
+
+    if (OFile->ExtentCount == OFile->ExtentCapacity) {
+      if (OFile->ExtentCapacity >= FAT_MAX_EXTENT_COUNT) {
+        return EFI_OUT_OF_RESOURCES;
+      }
+
+      NewCapacity = MAX (OFile->ExtentCapacity * 2, FAT_MIN_EXTENT_COUNT);
+      NewExtents  = ReallocatePool (
+                      OFile->ExtentCapacity * sizeof (FAT_EXTENT),
+                      NewCapacity * sizeof (FAT_EXTENT),
+                      OFile->Extents
+                      );
+      if (NewExtents == NULL) {
+        return EFI_OUT_OF_RESOURCES;
+      }
+
+      OFile->Extents        = NewExtents;
+      OFile->ExtentCapacity = NewCapacity;
+    }
+
+    Extent               = &OFile->Extents[OFile->ExtentCount];
+    Extent->FileCluster  = Index;
+    Extent->DiskCluster  = Cluster;
+    Extent->ClusterCount = 1;
+    OFile->ExtentCount++;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+
+  Seek OFile to requested position with the extent map of the file, and
+  calculate the number of consecutive clusters from the position in the file.
+
+  @param  OFile                 - The open file.
+  @param  Position              - The file's position which will be accessed.
+  @param  PosLimit              - The maximum length current reading/writing may access
+  @param  Run                   - Return the number of consecutive bytes from Position.
+
+  @retval EFI_SUCCESS           - Set the info successfully.
+  @retval EFI_OUT_OF_RESOURCES  - The extent map cannot cover Position.
+  @retval EFI_VOLUME_CORRUPTED  - Cluster chain corrupt.
+
+**/
+STATIC
+EFI_STATUS
+FatExtentPosition (
+  IN  FAT_OFILE  *OFile,
+  IN  UINTN      Position,
+  IN  UINTN      PosLimit,
+  OUT UINTN      *Run
+  )
+{
+  EFI_STATUS  Status;
+  FAT_VOLUME  *Volume;
+  FAT_EXTENT  *Extent;
+  UINTN       ClusterIndex;
+  UINTN       Cluster;
+  UINTN       ClusterCount;
+  UINTN       StartPos;
+  UINTN       Low;
+  UINTN       High;
+  UINTN       Mid;
+
+  Volume       = OFile->Volume;
+  ClusterIndex = Position >> Volume->ClusterAlignment;
+  StartPos     = Position - (Position & (Volume->ClusterSize - 1));
+
+  Status = FatExtendExtentMap (OFile, ClusterIndex);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  //
+  // Find the extent holding the position
+  //
+  Low  = 0;
+  High = OFile->ExtentCount;
+  while (Low < High) {
+    Mid = (Low + High) / 2;
+    if (OFile->Extents[Mid].FileCluster + OFile->Extents[Mid].ClusterCount <= ClusterIndex) {
+      Low = Mid + 1;
+    } else {
+      High = Mid;
+    }
+  }
+
+  if (Low == OFile->ExtentCount) {
+    DEBUG ((DEBUG_INIT | DEBUG_ERROR, "FatExtentPosition: cluster chain corrupt\n"));
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  //
+  // The last extent of an incomplete map may continue, extend it as far as needed
+  //
+  Extent       = &OFile->Extents[Low];
+  ClusterCount = Extent->FileCluster + Extent->ClusterCount - ClusterIndex;
+  while ((Low == OFile->ExtentCount - 1) && !OFile->ExtentComplete &&
+         (ClusterCount < (MAX_UINTN >> Volume->ClusterAlignment)) &&
+         ((ClusterCount << Volume->ClusterAlignment) - (Position - StartPos) < PosLimit))
+  {
+    if (EFI_ERROR (FatExtendExtentMap (OFile, Extent->FileCluster + Extent->ClusterCount))) {
+      break;
+    }
+
+    Extent       = &OFile->Extents[Low];
+    ClusterCount = Extent->FileCluster + Extent->ClusterCount - ClusterIndex;
+  }
+
+  Cluster        = Extent->DiskCluster + (ClusterIndex - Extent->FileCluster);
+  OFile->PosDisk = Volume->FirstClusterPos +
+                   LShiftU64 (Cluster - FAT_MIN_CLUSTER, Volume->ClusterAlignment) +
+                   Position - StartPos;
+  OFile->FileCurrentCluster = Cluster;
+  OFile->Position           = StartPos;
+
+  ClusterCount = MIN (ClusterCount, MAX_UINTN >> Volume->ClusterAlignment);
+  *Run         = (ClusterCount << Volume->ClusterAlignment) - (Position - StartPos);
+  return EFI_SUCCESS;
+}
+
 /**
 
   Seek OFile to requested position, and calculate the number of
@@ -565,6 +754,7 @@ FatOFilePosition (
   IN UINTN      PosLimit
   )
 {
+  EFI_STATUS  Status;
   FAT_VOLUME  *Volume;
   UINTN       ClusterSize;
   UINTN       Cluster;
@@ -584,6 +774,18 @@ FatOFilePosition (
     OFile->PosDisk = Volume->RootPos + Position;
     Run            = OFile->FileSize - Position;
   } else {
+    Status = FatExtentPosition (OFile, Position, PosLimit, &Run);
+    if (Status != EFI_OUT_OF_RESOURCES) {
+      if (EFI_ERROR (Status)) {
+        return Status;
+      }
+
+      OFile->PosRem = Run;
+      return EFI_SUCCESS;
+    }
+
+    //
+    // The extent map cannot cover the position, fall back to running the chain.
     //
     // Run the file's cluster chain to find the current position
     // If possible, run from the current cluster rather than
@@ -14,7 +14,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
   @param  LongNameString        - The long name string to be hashed.
 
-  @return HashValue.
+  @return HashValue, which is to be masked with the size of the hash table.
 
 **/
 STATIC
@@ -34,7 +34,7 @@ FatHashLongName (
     );
   FatStrUpr (UpCasedLongFileName);
   gBS->CalculateCrc32 (UpCasedLongFileName, StrSize (UpCasedLongFileName), &HashValue);
-  return (HashValue & HASH_TABLE_MASK);
+  return HashValue;
 }
 
 /**
@@ -43,7 +43,7 @@ FatHashLongName (
 
   @param  ShortNameString       - The short name string to be hashed.
 
-  @return HashValue
+  @return HashValue, which is to be masked with the size of the hash table.
 
 **/
 STATIC
@@ -55,7 +55,93 @@ FatHashShortName (
   UINT32  HashValue;
 
   gBS->CalculateCrc32 (ShortNameString, FAT_NAME_LEN, &HashValue);
-  return (HashValue & HASH_TABLE_MASK);
+  return HashValue;
+}
+
+/**
+
+  Allocate the hash tables of a directory.
+
+  @param  ODir                  - The directory.
+
+  @retval EFI_SUCCESS           - The hash tables are allocated.
+  @retval EFI_OUT_OF_RESOURCES  - Not enough memory for the hash tables.
+
+**/
+EFI_STATUS
+FatAllocateHashTable (
+  IN FAT_ODIR  *ODir
+  )
+{
+  FAT_DIRENT  **HashTable;
+
+  //
+  // Both tables share one allocation, the short name table follows the long name table
+  //
+  HashTable = AllocateZeroPool (2 * HASH_TABLE_MIN_SIZE * sizeof (FAT_DIRENT *));
+  if (HashTable == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  ODir->LongNameHashTable  = HashTable;
+  ODir->ShortNameHashTable = HashTable + HASH_TABLE_MIN_SIZE;
+  ODir->HashTableSize      = HASH_TABLE_MIN_SIZE;
+  ODir->HashEntryCount     = 0;
+  return EFI_SUCCESS;
+}
+
+/**
+
+  Double the size of the hash tables of a directory, so that the hash chains
+  stay short in large directories. The current tables are kept when there is
+  not enough memory for larger ones.
+
+  @param  ODir                  - The directory.
+
+**/
+STATIC
+VOID
+FatGrowHashTable (
+  IN FAT_ODIR  *ODir
+  )
+{
+  FAT_DIRENT  **HashTable;
+  FAT_DIRENT  **LongNameHashTable;
+  FAT_DIRENT  **ShortNameHashTable;
+  FAT_DIRENT  *DirEnt;
+  FAT_DIRENT  *NextDirEnt;
+  UINTN       NewSize;
+  UINTN       Index;
+  UINT32      HashTableIndex;
+
+  NewSize   = ODir->HashTableSize * 2;
+  HashTable = AllocateZeroPool (2 * NewSize * sizeof (FAT_DIRENT *));
+  if (HashTable == NULL) {
+    return;
+  }
+
+  LongNameHashTable  = HashTable;
+  ShortNameHashTable = HashTable + NewSize;
+  for (Index = 0; Index < ODir->HashTableSize; Index++) {
+    for (DirEnt = ODir->ShortNameHashTable[Index]; DirEnt != NULL; DirEnt = NextDirEnt) {
+      NextDirEnt                         = DirEnt->ShortNameForwardLink;
+      HashTableIndex                     = FatHashShortName (DirEnt->Entry.FileName) & (NewSize - 1);
+      DirEnt->ShortNameForwardLink       = ShortNameHashTable[HashTableIndex];
+      ShortNameHashTable[HashTableIndex] = DirEnt;
+    }
+
+    for (DirEnt = ODir->LongNameHashTable[Index]; DirEnt != NULL; DirEnt = NextDirEnt) {
+      NextDirEnt                        = DirEnt->LongNameForwardLink;
+      HashTableIndex                    = FatHashLongName (DirEnt->FileString) & (NewSize - 1);
+      DirEnt->LongNameForwardLink       = LongNameHashTable[HashTableIndex];
+      LongNameHashTable[HashTableIndex] = DirEnt;
+    }
+  }
+
+  FreePool (ODir->LongNameHashTable);
+  ODir->LongNameHashTable  = LongNameHashTable;
+  ODir->ShortNameHashTable = ShortNameHashTable;
+  ODir->HashTableSize      = NewSize;
 }
 
 /**
@@ -76,7 +162,7 @@ FatLongNameHashSearch (
 {
   FAT_DIRENT  **PreviousHashNode;
 
-  for (PreviousHashNode   = &ODir->LongNameHashTable[FatHashLongName (LongNameString)];
+  for (PreviousHashNode   = &ODir->LongNameHashTable[FatHashLongName (LongNameString) & (ODir->HashTableSize - 1)];
        *PreviousHashNode != NULL;
        PreviousHashNode   = &(*PreviousHashNode)->LongNameForwardLink
        )
@@ -107,7 +193,7 @@ FatShortNameHashSearch (
 {
   FAT_DIRENT  **PreviousHashNode;
 
-  for (PreviousHashNode   = &ODir->ShortNameHashTable[FatHashShortName (ShortNameString)];
+  for (PreviousHashNode   = &ODir->ShortNameHashTable[FatHashShortName (ShortNameString) & (ODir->HashTableSize - 1)];
        *PreviousHashNode != NULL;
        PreviousHashNode   = &(*PreviousHashNode)->ShortNameForwardLink
        )
@@ -140,17 +226,22 @@ FatInsertToHashTable (
   //
   // Insert hash table index for short name
   //
-  HashTableIndex               = FatHashShortName (DirEnt->Entry.FileName);
+  HashTableIndex               = FatHashShortName (DirEnt->Entry.FileName) & (ODir->HashTableSize - 1);
   HashTable                    = ODir->ShortNameHashTable;
   DirEnt->ShortNameForwardLink = HashTable[HashTableIndex];
   HashTable[HashTableIndex]    = DirEnt;
   //
   // Insert hash table index for long name
   //
-  HashTableIndex              = FatHashLongName (DirEnt->FileString);
+  HashTableIndex              = FatHashLongName (DirEnt->FileString) & (ODir->HashTableSize - 1);
   HashTable                   = ODir->LongNameHashTable;
   DirEnt->LongNameForwardLink = HashTable[HashTableIndex];
   HashTable[HashTableIndex]   = DirEnt;
+
+  ODir->HashEntryCount++;
+  if ((ODir->HashEntryCount > ODir->HashTableSize) && (ODir->HashTableSize < HASH_TABLE_MAX_SIZE)) {
+    FatGrowHashTable (ODir);
+  }
 }
 
 /**
@@ -169,4 +260,5 @@ FatDeleteFromHashTable (
 {
   *FatShortNameHashSearch (ODir, DirEnt->Entry.FileName) = DirEnt->ShortNameForwardLink;
   *FatLongNameHashSearch (ODir, DirEnt->FileString)      = DirEnt->LongNameForwardLink;
+  ODir->HashEntryCount--;
 }
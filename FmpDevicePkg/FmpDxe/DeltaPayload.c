@@ -0,0 +1,208 @@
+/** @file
+  Rebuilds a firmware image from a delta payload and the current image of the
+  firmware device.
+
+  Caution: This module requires additional review when modified.
+  This module will have external input - capsule image.
+  This external input must be validated carefully to avoid security issue like
+  buffer overflow, integer overflow.
+
+  Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "FmpDxe.h"
+#include <FmpDeltaPayload.h>
+
+/**
+  Check if a payload is a delta payload.
+
+  @param[in]  Payload      Points to the payload, with all the headers stripped off.
+  @param[in]  PayloadSize  Size, in bytes, of the payload.
+
+  @retval TRUE   The payload is a delta payload.
+  @retval FALSE  The payload is a full image, or delta payloads are not enabled.
+
+**/
+BOOLEAN
+IsDeltaPayload (
+  IN CONST VOID  *Payload,
+  IN UINTN       PayloadSize
+  )
+{
+  if (!FeaturePcdGet (PcdFmpDeviceDeltaPayloadEnable)) {
+    return FALSE;
+  }
+
+  if (PayloadSize < sizeof (FMP_DELTA_PAYLOAD_HEADER)) {
+    return FALSE;
+  }
+
+  return (BOOLEAN)(ReadUnaligned32 ((CONST UINT32 *)Payload) == FMP_DELTA_PAYLOAD_SIGNATURE);
+}
+
+/**
+  Rebuild the firmware image described by a delta payload.  The current image
+  is read from the firmware device with FmpDeviceGetImage(), the blocks of the
+  delta payload are applied to it, and the result is checked against the
+  digest of the delta payload.
+
+  Caution: This function may receive untrusted input.
+
+  @param[in]  Payload            Points to the delta payload, with all the
+                                 headers stripped off.
+  @param[in]  PayloadSize        Size, in bytes, of the delta payload.
+  @param[out] Image              On success, the rebuilt firmware image. It
+                                 must be freed by the caller with FreePool().
+  @param[out] ImageSize          On success, the size of the rebuilt image.
+  @param[out] LastAttemptStatus  The last attempt status to report in case of
+                                 error.
+
+  @retval EFI_SUCCESS             The firmware image is rebuilt.
+  @retval EFI_ABORTED             The delta payload is malformed, or the current
+                                  image cannot be read.
+  @retval EFI_SECURITY_VIOLATION  The current image or the rebuilt image does
+                                  not match its digest.
+  @retval EFI_OUT_OF_RESOURCES    No memory for the rebuilt image.
+
+**/
+EFI_STATUS
+ExpandDeltaPayload (
+  IN  CONST VOID  *Payload,
+  IN  UINTN       PayloadSize,
+  OUT VOID        **Image,
+  OUT UINTN       *ImageSize,
+  OUT UINT32      *LastAttemptStatus
+  )
+{
+  EFI_STATUS                Status;
+  FMP_DELTA_PAYLOAD_HEADER  Header;
+  UINT8                     Digest[SHA256_DIGEST_SIZE];
+  UINT8                     *Buffer;
+  UINTN                     BufferSize;
+  UINTN                     BaseSize;
+  UINTN                     TargetSize;
+  UINTN                     Offset;
+  UINTN                     Index;
+  UINT64                    BlockOffset;
+  UINTN                     BlockLength;
+
+  *Image     = NULL;
+  *ImageSize = 0;
+
+  CopyMem (&Header, Payload, sizeof (Header));
+  if ((Header.HeaderSize < sizeof (Header)) || (Header.HeaderSize > PayloadSize) ||
+      (Header.BlockSize == 0) || (Header.TargetImageSize == 0) ||
+      (Header.BaseImageSize > MAX_UINTN) || (Header.TargetImageSize > MAX_UINTN))
+  {
+    DEBUG ((DEBUG_ERROR, "FmpDxe(%s): ExpandDeltaPayload() - Invalid delta payload header.\n", mImageIdName));
+    *LastAttemptStatus = LAST_ATTEMPT_STATUS_DRIVER_ERROR_INVALID_DELTA_PAYLOAD;
+    return EFI_ABORTED;
+  }
+
+  BaseSize   = (UINTN)Header.BaseImageSize;
+  TargetSize = (UINTN)Header.TargetImageSize;
+
+  //
+  // The current image is read straight into the buffer of the target image,
+  // which is then patched in place.
+  //
+  Status = FmpDeviceGetSize (&BufferSize);
+  if (EFI_ERROR (Status) || (BufferSize != BaseSize)) {
+    DEBUG ((DEBUG_ERROR, "FmpDxe(%s): ExpandDeltaPayload() - Current image size does not match the delta payload.\n", mImageIdName));
+    *LastAttemptStatus = LAST_ATTEMPT_STATUS_DRIVER_ERROR_DELTA_GET_IMAGE;
+    return EFI_ABORTED;
+  }
+
+  BufferSize = MAX (BaseSize, TargetSize);
+  Buffer     = AllocatePool (BufferSize);
+  if (Buffer == NULL) {
+    *LastAttemptStatus = LAST_ATTEMPT_STATUS_ERROR_INSUFFICIENT_RESOURCES;
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = FmpDeviceGetImage (Buffer, &BaseSize);
+  if (EFI_ERROR (Status) || (BaseSize != (UINTN)Header.BaseImageSize)) {
+    DEBUG ((DEBUG_ERROR, "FmpDxe(%s): ExpandDeltaPayload() - FmpDeviceGetImage() failed %r.\n", mImageIdName, Status));
+    *LastAttemptStatus = LAST_ATTEMPT_STATUS_DRIVER_ERROR_DELTA_GET_IMAGE;
+    Status             = EFI_ABORTED;
+    goto Done;
+  }
+
+  if (!Sha256HashAll (Buffer, BaseSize, Digest) ||
+      (CompareMem (Digest, Header.BaseImageDigest, sizeof (Digest)) != 0))
+  {
+    DEBUG ((DEBUG_ERROR, "FmpDxe(%s): ExpandDeltaPayload() - Current image does not match the delta payload.\n", mImageIdName));
+    *LastAttemptStatus = LAST_ATTEMPT_STATUS_DRIVER_ERROR_DELTA_BASE_MISMATCH;
+    Status             = EFI_SECURITY_VIOLATION;
+    goto Done;
+  }
+
+  if (TargetSize > BaseSize) {
+    SetMem (Buffer + BaseSize, TargetSize - BaseSize, 0xFF);
+  }
+
+  //
+  // Apply the blocks that changed
+  //
+  Offset = Header.HeaderSize;
+  for (Index = 0; Index < Header.BlockCount; Index++) {
+    if (PayloadSize - Offset < sizeof (FMP_DELTA_PAYLOAD_BLOCK)) {
+      break;
+    }
+
+    BlockOffset = MultU64x32 (ReadUnaligned32 ((CONST UINT32 *)((CONST UINT8 *)Payload + Offset)), Header.BlockSize);
+    Offset     += sizeof (FMP_DELTA_PAYLOAD_BLOCK);
+    if (BlockOffset >= TargetSize) {
+      break;
+    }
+
+    BlockLength = (UINTN)MIN ((UINT64)Header.BlockSize, TargetSize - BlockOffset);
+    if (PayloadSize - Offset < BlockLength) {
+      break;
+    }
+
+    CopyMem (Buffer + (UINTN)BlockOffset, (CONST UINT8 *)Payload + Offset, BlockLength);
+    Offset += BlockLength;
+  }
+
+  if ((Index != Header.BlockCount) || (Offset != PayloadSize)) {
+    DEBUG ((DEBUG_ERROR, "FmpDxe(%s): ExpandDeltaPayload() - Invalid block record %d.\n", mImageIdName, Index));
+    *LastAttemptStatus = LAST_ATTEMPT_STATUS_DRIVER_ERROR_INVALID_DELTA_PAYLOAD;
+    Status             = EFI_ABORTED;
+    goto Done;
+  }
+
+  //
+  // Verify the rebuilt image before it is handed to the FmpDeviceLib.
+  //
+  if (!Sha256HashAll (Buffer, TargetSize, Digest) ||
+      (CompareMem (Digest, Header.TargetImageDigest, sizeof (Digest)) != 0))
+  {
+    DEBUG ((DEBUG_ERROR, "FmpDxe(%s): ExpandDeltaPayload() - Rebuilt image does not match the delta payload.\n", mImageIdName));
+    *LastAttemptStatus = LAST_ATTEMPT_STATUS_DRIVER_ERROR_DELTA_TARGET_MISMATCH;
+    Status             = EFI_SECURITY_VIOLATION;
+    goto Done;
+  }
+
+  DEBUG ((
+    DEBUG_INFO,
+    "FmpDxe(%s): ExpandDeltaPayload() - Rebuilt 0x%lx bytes image from %d blocks.\n",
+    mImageIdName,
+    (UINT64)TargetSize,
+    Header.BlockCount
+    ));
+  *Image     = Buffer;
+  *ImageSize = TargetSize;
+  Buffer     = NULL;
+  Status     = EFI_SUCCESS;
+
+Done:
+  if (Buffer != NULL) {
+    FreePool (Buffer);
+  }
+
+  return Status;
+}
@@ -95,6 +95,12 @@ EFI_GUID  *mLockGuid = NULL;
 ///
 EFI_FIRMWARE_MANAGEMENT_UPDATE_IMAGE_PROGRESS  mProgressFunc = NULL;
 
+///
+/// Offset in PcdFmpDevicePkcs7CertBufferXdr of the certificate that
+/// authenticated the last image, or MAX_UINTN if none did yet.
+///
+UINTN  mLastAuthenticationKeyOffset = MAX_UINTN;
+
 ///
 /// Null-terminated Unicode string retrieved from PcdFmpDeviceImageIdName.
 ///
@@ -750,6 +756,10 @@ GetAllHeaderSize (
 
                                  LAST_ATTEMPT_STATUS_FMP_DEPENDENCY_CHECK_LIB_MIN_ERROR_CODE_VALUE to
                                  LAST_ATTEMPT_STATUS_FMP_DEPENDENCY_CHECK_LIB_MAX_ERROR_CODE_VALUE
+  @param[out] ExpandedImage      Optional pointer to receive the firmware image rebuilt from a delta
+                                 payload, if the image is valid for update and carries one.  It is set
+                                 to NULL otherwise.  The caller must free it with FreePool().
+  @param[out] ExpandedImageSize  Optional pointer to receive the size of ExpandedImage in bytes.
 
   @retval EFI_SUCCESS            The image was successfully checked.
   @retval EFI_ABORTED            The operation is aborted.
@@ -766,13 +776,17 @@ CheckTheImageInternal (
   IN  CONST VOID                        *Image,
   IN  UINTN                             ImageSize,
   OUT UINT32                            *ImageUpdatable,
-  OUT UINT32                            *LastAttemptStatus
+  OUT UINT32                            *LastAttemptStatus,
+  OUT VOID                              **ExpandedImage      OPTIONAL,
+  OUT UINTN                             *ExpandedImageSize   OPTIONAL
   )
 {
   EFI_STATUS                        Status;
   UINT32                            LocalLastAttemptStatus;
   FIRMWARE_MANAGEMENT_PRIVATE_DATA  *Private;
   UINTN                             RawSize;
+  VOID                              *RawImage;
+  VOID                              *DeltaImage;
   VOID                              *FmpPayloadHeader;
   UINTN                             FmpPayloadSize;
   UINT32                            Version;
@@ -782,13 +796,16 @@ CheckTheImageInternal (
   VOID                              *PublicKeyData;
   UINTN                             PublicKeyDataLength;
   UINT8                             *PublicKeyDataXdr;
+  UINT8                             *PublicKeyDataXdrStart;
   UINT8                             *PublicKeyDataXdrEnd;
+  UINTN                             KeyOffset;
   EFI_FIRMWARE_IMAGE_DEP            *Dependencies;
   UINT32                            DependenciesSize;
 
   Status                 = EFI_SUCCESS;
   LocalLastAttemptStatus = LAST_ATTEMPT_STATUS_SUCCESS;
   RawSize                = 0;
+  DeltaImage             = NULL;
   FmpPayloadHeader       = NULL;
   FmpPayloadSize         = 0;
   Version                = 0;
@@ -797,6 +814,10 @@ CheckTheImageInternal (
   Dependencies           = NULL;
   DependenciesSize       = 0;
 
+  if (ExpandedImage != NULL) {
+    *ExpandedImage = NULL;
+  }
+
   if (!FeaturePcdGet (PcdFmpDeviceStorageAccessEnable)) {
     return EFI_UNSUPPORTED;
   }
@@ -867,9 +888,29 @@ CheckTheImageInternal (
     LocalLastAttemptStatus = LAST_ATTEMPT_STATUS_DRIVER_ERROR_INVALID_CERTIFICATE;
   } else {
     //
-    // Try each key from PcdFmpDevicePkcs7CertBufferXdr
+    // Try the certificate that authenticated the last image first. Updates
+    // are normally signed with the same certificate, and every certificate
+    // tried in vain costs another pass over the whole image.
+    //
+    Status                = EFI_SECURITY_VIOLATION;
+    PublicKeyDataXdrStart = PublicKeyDataXdr;
+    KeyOffset             = mLastAuthenticationKeyOffset;
+    if ((KeyOffset != MAX_UINTN) && (KeyOffset + sizeof (UINT32) <= (UINTN)(PublicKeyDataXdrEnd - PublicKeyDataXdrStart))) {
+      PublicKeyDataLength = SwapBytes32 (*(UINT32 *)(PublicKeyDataXdrStart + KeyOffset));
+      if (PublicKeyDataLength <= (UINTN)(PublicKeyDataXdrEnd - PublicKeyDataXdrStart) - KeyOffset - sizeof (UINT32)) {
+        Status = AuthenticateFmpImage (
+                   (EFI_FIRMWARE_IMAGE_AUTHENTICATION *)Image,
+                   ImageSize,
+                   PublicKeyDataXdrStart + KeyOffset + sizeof (UINT32),
+                   PublicKeyDataLength
+                   );
+      }
+    }
+
+    //
+    // Try each other key from PcdFmpDevicePkcs7CertBufferXdr
     //
-    for (Index = 1; PublicKeyDataXdr < PublicKeyDataXdrEnd; Index++) {
+    for (Index = 1; EFI_ERROR (Status) && (PublicKeyDataXdr < PublicKeyDataXdrEnd); Index++) {
       Index++;
       DEBUG (
         (DEBUG_INFO,
@@ -894,6 +935,7 @@ CheckTheImageInternal (
       //
       // Read key length stored in big-endian format
       //
+      KeyOffset           = (UINTN)(PublicKeyDataXdr - PublicKeyDataXdrStart);
       PublicKeyDataLength = SwapBytes32 (*(UINT32 *)(PublicKeyDataXdr));
       //
       // Point to the start of the key data
@@ -910,14 +952,17 @@ CheckTheImageInternal (
       }
 
       PublicKeyData = PublicKeyDataXdr;
-      Status        = AuthenticateFmpImage (
-                        (EFI_FIRMWARE_IMAGE_AUTHENTICATION *)Image,
-                        ImageSize,
-                        PublicKeyData,
-                        PublicKeyDataLength
-                        );
-      if (!EFI_ERROR (Status)) {
-        break;
+      if (KeyOffset != mLastAuthenticationKeyOffset) {
+        Status = AuthenticateFmpImage (
+                   (EFI_FIRMWARE_IMAGE_AUTHENTICATION *)Image,
+                   ImageSize,
+                   PublicKeyData,
+                   PublicKeyDataLength
+                   );
+        if (!EFI_ERROR (Status)) {
+          mLastAuthenticationKeyOffset = KeyOffset;
+          break;
+        }
       }
 
       PublicKeyDataXdr += PublicKeyDataLength;
@@ -1038,12 +1083,27 @@ CheckTheImageInternal (
     goto cleanup;
   }
 
-  RawSize = ImageSize - AllHeaderSize;
+  RawImage = ((UINT8 *)Image) + AllHeaderSize;
+  RawSize  = ImageSize - AllHeaderSize;
+
+  //
+  // Rebuild the full firmware image if the payload is a delta against the
+  // image currently in the firmware device
+  //
+  if (IsDeltaPayload (RawImage, RawSize)) {
+    Status = ExpandDeltaPayload (RawImage, RawSize, &DeltaImage, &RawSize, LastAttemptStatus);
+    if (EFI_ERROR (Status)) {
+      *ImageUpdatable = IMAGE_UPDATABLE_INVALID;
+      goto cleanup;
+    }
+
+    RawImage = DeltaImage;
+  }
 
   //
   // FmpDeviceLib CheckImage function to do any specific checks
   //
-  Status = FmpDeviceCheckImageWithStatus ((((UINT8 *)Image) + AllHeaderSize), RawSize, ImageUpdatable, LastAttemptStatus);
+  Status = FmpDeviceCheckImageWithStatus (RawImage, RawSize, ImageUpdatable, LastAttemptStatus);
   if (EFI_ERROR (Status)) {
     // The image cannot be valid if an error occurred checking the image
     if (*ImageUpdatable == IMAGE_UPDATABLE_VALID) {
@@ -1076,6 +1136,17 @@ CheckTheImageInternal (
   }
 
 cleanup:
+  if (DeltaImage != NULL) {
+    if ((ExpandedImage != NULL) && !EFI_ERROR (Status) && (*ImageUpdatable == IMAGE_UPDATABLE_VALID)) {
+      *ExpandedImage = DeltaImage;
+      if (ExpandedImageSize != NULL) {
+        *ExpandedImageSize = RawSize;
+      }
+    } else {
+      FreePool (DeltaImage);
+    }
+  }
+
   return Status;
 }
 
@@ -1112,7 +1183,7 @@ CheckTheImage (
 {
   UINT32  LastAttemptStatus;
 
-  return CheckTheImageInternal (This, ImageIndex, Image, ImageSize, ImageUpdatable, &LastAttemptStatus);
+  return CheckTheImageInternal (This, ImageIndex, Image, ImageSize, ImageUpdatable, &LastAttemptStatus, NULL, NULL);
 }
 
 /**
@@ -1187,6 +1258,10 @@ SetTheImage (
   UINT32                            LowestSupportedVersion;
   EFI_FIRMWARE_IMAGE_DEP            *Dependencies;
   UINT32                            DependenciesSize;
+  VOID                              *ExpandedImage;
+  UINTN                             ExpandedImageSize;
+  CONST VOID                        *Payload;
+  UINTN                             PayloadSize;
 
   Status            = EFI_SUCCESS;
   Private           = NULL;
@@ -1200,6 +1275,8 @@ SetTheImage (
   LastAttemptStatus = LAST_ATTEMPT_STATUS_ERROR_UNSUCCESSFUL;
   Dependencies      = NULL;
   DependenciesSize  = 0;
+  ExpandedImage     = NULL;
+  ExpandedImageSize = 0;
 
   if (!FeaturePcdGet (PcdFmpDeviceStorageAccessEnable)) {
     return EFI_UNSUPPORTED;
@@ -1242,7 +1319,7 @@ SetTheImage (
   //
   // Call check image to verify the image
   //
-  Status = CheckTheImageInternal (This, ImageIndex, Image, ImageSize, &Updateable, &LastAttemptStatus);
+  Status = CheckTheImageInternal (This, ImageIndex, Image, ImageSize, &Updateable, &LastAttemptStatus, &ExpandedImage, &ExpandedImageSize);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "FmpDxe(%s): SetTheImage() - Check The Image failed with %r.\n", mImageIdName, Status));
     goto cleanup;
@@ -1394,6 +1471,17 @@ SetTheImage (
     goto cleanup;
   }
 
+  //
+  // A delta payload has been rebuilt into the full image by CheckTheImageInternal()
+  //
+  if (ExpandedImage != NULL) {
+    Payload     = ExpandedImage;
+    PayloadSize = ExpandedImageSize;
+  } else {
+    Payload     = ((UINT8 *)Image) + AllHeaderSize;
+    PayloadSize = ImageSize - AllHeaderSize;
+  }
+
   //
   // Indicate that control is handed off to FmpDeviceLib
   //
@@ -1403,8 +1491,8 @@ SetTheImage (
   // Copy the requested image to the firmware using the FmpDeviceLib
   //
   Status = FmpDeviceSetImageWithStatus (
-             (((UINT8 *)Image) + AllHeaderSize),
-             ImageSize - AllHeaderSize,
+             Payload,
+             PayloadSize,
              VendorCode,
              FmpDxeProgress,
              IncomingFwVersion,
@@ -1472,6 +1560,10 @@ SetTheImage (
 cleanup:
   mProgressFunc = NULL;
 
+  if (ExpandedImage != NULL) {
+    FreePool (ExpandedImage);
+  }
+
   if (Private != NULL) {
     DEBUG ((DEBUG_INFO, "FmpDxe(%s): SetTheImage() LastAttemptStatus: %u.\n", mImageIdName, LastAttemptStatus));
     SetLastAttemptStatusInVariable (Private, LastAttemptStatus);
@@ -100,6 +100,56 @@ DetectTestKey (
   VOID
   );
 
+/**
+  Check if a payload is a delta payload.
+
+  @param[in]  Payload      Points to the payload, with all the headers stripped off.
+  @param[in]  PayloadSize  Size, in bytes, of the payload.
+
+  @retval TRUE   The payload is a delta payload.
+  @retval FALSE  The payload is a full image, or delta payloads are not enabled.
+
+**/
+BOOLEAN
+IsDeltaPayload (
+  IN CONST VOID  *Payload,
+  IN UINTN       PayloadSize
+  );
+
+/**
+  Rebuild the firmware image described by a delta payload.  The current image
+  is read from the firmware device with FmpDeviceGetImage(), the blocks of the
+  delta payload are applied to it, and the result is checked against the
+  digest of the delta payload.
+
+  Caution: This function may receive untrusted input.
+
+  @param[in]  Payload            Points to the delta payload, with all the
+                                 headers stripped off.
+  @param[in]  PayloadSize        Size, in bytes, of the delta payload.
+  @param[out] Image              On success, the rebuilt firmware image. It
+                                 must be freed by the caller with FreePool().
+  @param[out] ImageSize          On success, the size of the rebuilt image.
+  @param[out] LastAttemptStatus  The last attempt status to report in case of
+                                 error.
+
+  @retval EFI_SUCCESS             The firmware image is rebuilt.
+  @retval EFI_ABORTED             The delta payload is malformed, or the current
+                                  image cannot be read.
+  @retval EFI_SECURITY_VIOLATION  The current image or the rebuilt image does
+                                  not match its digest.
+  @retval EFI_OUT_OF_RESOURCES    No memory for the rebuilt image.
+
+**/
+EFI_STATUS
+ExpandDeltaPayload (
+  IN  CONST VOID  *Payload,
+  IN  UINTN       PayloadSize,
+  OUT VOID        **Image,
+  OUT UINTN       *ImageSize,
+  OUT UINT32      *LastAttemptStatus
+  );
+
 /**
   Returns information about the current firmware image(s) of the device.
 
@@ -0,0 +1,48 @@
+/** @file
+  Defines the delta payload format of FmpDevicePkg.
+
+  A delta payload can take the place of the firmware image in an FMP capsule.
+  It starts with FMP_DELTA_PAYLOAD_HEADER followed by BlockCount records. Each
+  record is made of an FMP_DELTA_PAYLOAD_BLOCK followed by the new contents of
+  the block, which are BlockSize bytes long, or less for the last block of the
+  target image.
+
+  The target image is rebuilt from the image currently stored in the firmware
+  device: the blocks without a record keep their current contents, and the
+  bytes beyond the end of the current image that are not covered by a record
+  are set to 0xFF. Both the current image and the rebuilt image are checked
+  against the SHA-256 digests of the header.
+
+  Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef __FMP_DELTA_PAYLOAD_H__
+#define __FMP_DELTA_PAYLOAD_H__
+
+#define FMP_DELTA_PAYLOAD_SIGNATURE  SIGNATURE_32 ('F', 'D', 'L', '1')
+
+#define FMP_DELTA_PAYLOAD_DIGEST_SIZE  32
+
+#pragma pack(1)
+
+typedef struct {
+  UINT32    Signature;
+  UINT32    HeaderSize;
+  UINT32    BlockSize;
+  UINT32    BlockCount;
+  UINT64    BaseImageSize;
+  UINT64    TargetImageSize;
+  UINT8     BaseImageDigest[FMP_DELTA_PAYLOAD_DIGEST_SIZE];
+  UINT8     TargetImageDigest[FMP_DELTA_PAYLOAD_DIGEST_SIZE];
+} FMP_DELTA_PAYLOAD_HEADER;
+
+typedef struct {
+  UINT32    BlockIndex;
+} FMP_DELTA_PAYLOAD_BLOCK;
+
+#pragma pack()
+
+#endif
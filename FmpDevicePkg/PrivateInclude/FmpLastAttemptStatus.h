@@ -53,6 +53,10 @@ enum LAST_ATTEMPT_STATUS_EXPANDED_ERROR_LIST {
   LAST_ATTEMPT_STATUS_DRIVER_ERROR_DEVICE_LOCKED,
   LAST_ATTEMPT_STATUS_DRIVER_ERROR_IMAGE_AUTH_FAILURE,
   LAST_ATTEMPT_STATUS_DRIVER_ERROR_PROTOCOL_ARG_MISSING,
+  LAST_ATTEMPT_STATUS_DRIVER_ERROR_INVALID_DELTA_PAYLOAD,
+  LAST_ATTEMPT_STATUS_DRIVER_ERROR_DELTA_GET_IMAGE,
+  LAST_ATTEMPT_STATUS_DRIVER_ERROR_DELTA_BASE_MISMATCH,
+  LAST_ATTEMPT_STATUS_DRIVER_ERROR_DELTA_TARGET_MISMATCH,
 
   ///
   /// Last attempt status codes used in FmpDependencyLib
@@ -9,6 +9,8 @@
 #include <Library/BaseLib.h>
 #include <Library/DebugLib.h>
 #include <Library/PcdLib.h>
+#include <Library/PerformanceLib.h>
+#include <Library/PrintLib.h>
 #include <Library/FspWrapperApiLib.h>
 #include <Library/FspWrapperPlatformLib.h>
 #include <FspEas.h>
@@ -321,6 +323,7 @@ FspWrapperMultiPhaseHandler (
   FSP_MULTI_PHASE_GET_NUMBER_OF_PHASES_PARAMS  FspMultiPhaseGetNumber;
   UINT32                                       Index;
   UINT32                                       NumOfPhases;
+  CHAR8                                        PhaseToken[32];
 
   //
   // Query FSP for the number of phases supported.
@@ -347,6 +350,22 @@ FspWrapperMultiPhaseHandler (
     //
     FspWrapperPlatformMultiPhaseHandler (FspHobListPtr, ComponentIndex, Index);
 
+    //
+    // Record the time spent in each phase, including its variable requests.
+    //
+    PhaseToken[0] = '\0';
+    if (LogPerformanceMeasurementEnabled (PERF_GENERAL_TYPE)) {
+      AsciiSPrint (
+        PhaseToken,
+        sizeof (PhaseToken),
+        "%a MultiPhase%d",
+        (ComponentIndex == FspMultiPhaseMemInitApiIndex) ? "FspM" : "FspS",
+        Index
+        );
+    }
+
+    PERF_INMODULE_BEGIN (PhaseToken);
+
     FspMultiPhaseParams.MultiPhaseAction   = EnumMultiPhaseExecutePhase;
     FspMultiPhaseParams.PhaseIndex         = Index;
     FspMultiPhaseParams.MultiPhaseParamPtr = NULL;
@@ -359,6 +378,8 @@ FspWrapperMultiPhaseHandler (
       FspWrapperVariableRequestHandler (FspHobListPtr, ComponentIndex);
     }
 
+    PERF_INMODULE_END (PhaseToken);
+
     //
     // Reset the system if FSP API returned FSP_STATUS_RESET_REQUIRED status
     //
@@ -638,6 +638,45 @@ DumpMemoryProfileMemoryRange (
   return (VOID *)Descriptor;
 }
 
+/**
+  Dump memory profile pool cache information.
+
+  @param[in] PoolCacheInfo      Pointer to memory profile pool cache information.
+
+  @return Pointer to the end of memory profile pool cache information buffer.
+
+**/
+VOID *
+DumpMemoryProfilePoolCacheInfo (
+  IN MEMORY_PROFILE_POOL_CACHE_INFO  *PoolCacheInfo
+  )
+{
+  UINTN  TypeIndex;
+
+  if (PoolCacheInfo->Header.Signature != MEMORY_PROFILE_POOL_CACHE_INFO_SIGNATURE) {
+    return NULL;
+  }
+
+  Print (L"MEMORY_PROFILE_POOL_CACHE_INFO\n");
+  Print (L"  Signature                     - 0x%08x\n", PoolCacheInfo->Header.Signature);
+  Print (L"  Length                        - 0x%04x\n", PoolCacheInfo->Header.Length);
+  Print (L"  Revision                      - 0x%04x\n", PoolCacheInfo->Header.Revision);
+  Print (L"  CacheDepth                    - 0x%08x\n", PoolCacheInfo->CacheDepth);
+  Print (L"  MaxCachedSize                 - 0x%08x\n", PoolCacheInfo->MaxCachedSize);
+  for (TypeIndex = 0; TypeIndex < EfiMaxMemoryType; TypeIndex++) {
+    if ((PoolCacheInfo->AllocateHitCountByType[TypeIndex] != 0) ||
+        (PoolCacheInfo->AllocateMissCountByType[TypeIndex] != 0))
+    {
+      Print (L"  AllocateHitCount[0x%02x]        - 0x%016lx (%a)\n", TypeIndex, PoolCacheInfo->AllocateHitCountByType[TypeIndex], mMemoryTypeString[TypeIndex]);
+      Print (L"  AllocateMissCount[0x%02x]       - 0x%016lx (%a)\n", TypeIndex, PoolCacheInfo->AllocateMissCountByType[TypeIndex], mMemoryTypeString[TypeIndex]);
+      Print (L"  FreeHitCount[0x%02x]            - 0x%016lx (%a)\n", TypeIndex, PoolCacheInfo->FreeHitCountByType[TypeIndex], mMemoryTypeString[TypeIndex]);
+      Print (L"  FreeMissCount[0x%02x]           - 0x%016lx (%a)\n", TypeIndex, PoolCacheInfo->FreeMissCountByType[TypeIndex], mMemoryTypeString[TypeIndex]);
+    }
+  }
+
+  return (VOID *)((UINTN)PoolCacheInfo + PoolCacheInfo->Header.Length);
+}
+
 /**
   Scan memory profile by Signature.
 
@@ -695,9 +734,10 @@ DumpMemoryProfile (
   IN BOOLEAN           IsForSmm
   )
 {
-  MEMORY_PROFILE_CONTEXT       *Context;
-  MEMORY_PROFILE_FREE_MEMORY   *FreeMemory;
-  MEMORY_PROFILE_MEMORY_RANGE  *MemoryRange;
+  MEMORY_PROFILE_CONTEXT          *Context;
+  MEMORY_PROFILE_FREE_MEMORY      *FreeMemory;
+  MEMORY_PROFILE_MEMORY_RANGE     *MemoryRange;
+  MEMORY_PROFILE_POOL_CACHE_INFO  *PoolCacheInfo;
 
   Context = (MEMORY_PROFILE_CONTEXT *)ScanMemoryProfileBySignature (ProfileBuffer, ProfileSize, MEMORY_PROFILE_CONTEXT_SIGNATURE);
   if (Context != NULL) {
@@ -713,6 +753,11 @@ DumpMemoryProfile (
   if (MemoryRange != NULL) {
     DumpMemoryProfileMemoryRange (MemoryRange);
   }
+
+  PoolCacheInfo = (MEMORY_PROFILE_POOL_CACHE_INFO *)ScanMemoryProfileBySignature (ProfileBuffer, ProfileSize, MEMORY_PROFILE_POOL_CACHE_INFO_SIGNATURE);
+  if (PoolCacheInfo != NULL) {
+    DumpMemoryProfilePoolCacheInfo (PoolCacheInfo);
+  }
 }
 
 /**
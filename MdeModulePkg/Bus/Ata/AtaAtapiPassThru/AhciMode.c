@@ -2200,6 +2200,76 @@ AhciPacketCommandExecute (
   return Status;
 }
 
+/**
+  Allocate the command tables used for native command queuing, one for each
+  command slot. Failing to allocate them is not fatal, the HBA is then used
+  without native command queuing.
+
+  @param  PciIo                 The PCI IO protocol instance.
+  @param  AhciRegisters         The pointer to the EFI_AHCI_REGISTERS.
+  @param  MaxCommandSlotNumber  The number of command slots per port.
+  @param  Support64Bit          Whether the HBA supports 64-bit addressing.
+
+**/
+VOID
+AhciCreateNcqCommandTable (
+  IN     EFI_PCI_IO_PROTOCOL  *PciIo,
+  IN OUT EFI_AHCI_REGISTERS   *AhciRegisters,
+  IN     UINT8                MaxCommandSlotNumber,
+  IN     BOOLEAN              Support64Bit
+  )
+{
+  EFI_STATUS            Status;
+  UINTN                 Bytes;
+  VOID                  *Buffer;
+  UINT64                MaxNcqCommandTableSize;
+  EFI_PHYSICAL_ADDRESS  AhciNcqCommandTablePciAddr;
+
+  AhciRegisters->NcqSlotNumber = 0;
+
+  Buffer                 = NULL;
+  MaxNcqCommandTableSize = MaxCommandSlotNumber * sizeof (AHCI_NCQ_COMMAND_TABLE);
+  Status                 = PciIo->AllocateBuffer (
+                                    PciIo,
+                                    AllocateAnyPages,
+                                    EfiBootServicesData,
+                                    EFI_SIZE_TO_PAGES ((UINTN)MaxNcqCommandTableSize),
+                                    &Buffer,
+                                    0
+                                    );
+  if (EFI_ERROR (Status)) {
+    return;
+  }
+
+  ZeroMem (Buffer, (UINTN)MaxNcqCommandTableSize);
+  Bytes = (UINTN)MaxNcqCommandTableSize;
+
+  Status = PciIo->Map (
+                    PciIo,
+                    EfiPciIoOperationBusMasterCommonBuffer,
+                    Buffer,
+                    &Bytes,
+                    &AhciNcqCommandTablePciAddr,
+                    &AhciRegisters->MapNcqCommandTable
+                    );
+  if (!EFI_ERROR (Status) &&
+      ((Bytes != MaxNcqCommandTableSize) || (!Support64Bit && (AhciNcqCommandTablePciAddr > 0x100000000ULL))))
+  {
+    PciIo->Unmap (PciIo, AhciRegisters->MapNcqCommandTable);
+    Status = EFI_OUT_OF_RESOURCES;
+  }
+
+  if (EFI_ERROR (Status)) {
+    PciIo->FreeBuffer (PciIo, EFI_SIZE_TO_PAGES ((UINTN)MaxNcqCommandTableSize), Buffer);
+    return;
+  }
+
+  AhciRegisters->AhciNcqCommandTable        = Buffer;
+  AhciRegisters->AhciNcqCommandTablePciAddr = (AHCI_NCQ_COMMAND_TABLE *)(UINTN)AhciNcqCommandTablePciAddr;
+  AhciRegisters->MaxNcqCommandTableSize     = MaxNcqCommandTableSize;
+  AhciRegisters->NcqSlotNumber              = MaxCommandSlotNumber;
+}
+
 /**
   Allocate transfer-related data struct which is used at AHCI mode.
 
@@ -2410,6 +2480,10 @@ AhciCreateTransferDescriptor (
 
   AhciRegisters->AhciCommandTablePciAddr = (EFI_AHCI_COMMAND_TABLE *)(UINTN)AhciCommandTablePciAddr;
 
+  if ((Capability & EFI_AHCI_CAP_SNCQ) != 0) {
+    AhciCreateNcqCommandTable (PciIo, AhciRegisters, MaxCommandSlotNumber, Support64Bit);
+  }
+
   return EFI_SUCCESS;
   //
   // Map error or unable to map the whole CmdList buffer into a contiguous region.
@@ -2512,6 +2586,305 @@ AhciReadLogExt (
            );
 }
 
+/**
+  Start or poll a native queued (FPDMA) data transfer on specific port.
+
+  In non-blocking mode, each call issues the command in a free command slot if
+  it isn't issued yet, and checks whether it has completed. Several queued
+  commands may be in flight on a port at the same time, each in its own
+  command slot, and the command is complete when the device has cleared both
+  the PxSACT and the PxCI bit of its slot. If any queued command fails, all
+  queued commands in flight are aborted.
+
+  @param[in]       Instance            The ATA_ATAPI_PASS_THRU_INSTANCE protocol instance.
+  @param[in]       AhciRegisters       The pointer to the EFI_AHCI_REGISTERS.
+  @param[in]       Port                The number of port.
+  @param[in]       PortMultiplier      The number of port multiplier.
+  @param[in]       Read                The transfer direction.
+  @param[in]       AtaCommandBlock     The EFI_ATA_COMMAND_BLOCK data.
+  @param[in, out]  AtaStatusBlock      The EFI_ATA_STATUS_BLOCK data.
+  @param[in, out]  MemoryAddr          The pointer to the data buffer.
+  @param[in]       DataCount           The data count to be transferred.
+  @param[in]       Timeout             The timeout value of data transfer, uses 100ns as a unit.
+  @param[in]       Task                Optional. Pointer to the ATA_NONBLOCK_TASK
+                                       used by non-blocking mode.
+
+  @retval EFI_NOT_READY       The command is not issued or not completed yet.
+  @retval EFI_DEVICE_ERROR    The FPDMA data transfer abort with error occurs.
+  @retval EFI_TIMEOUT         The operation is time out.
+  @retval EFI_BAD_BUFFER_SIZE The data buffer can't be mapped.
+  @retval EFI_SUCCESS         The FPDMA data transfer executes successfully.
+
+**/
+EFI_STATUS
+EFIAPI
+AhciFpdmaTransfer (
+  IN     ATA_ATAPI_PASS_THRU_INSTANCE  *Instance,
+  IN     EFI_AHCI_REGISTERS            *AhciRegisters,
+  IN     UINT8                         Port,
+  IN     UINT8                         PortMultiplier,
+  IN     BOOLEAN                       Read,
+  IN     EFI_ATA_COMMAND_BLOCK         *AtaCommandBlock,
+  IN OUT EFI_ATA_STATUS_BLOCK          *AtaStatusBlock,
+  IN OUT VOID                          *MemoryAddr,
+  IN     UINT32                        DataCount,
+  IN     UINT64                        Timeout,
+  IN     ATA_NONBLOCK_TASK             *Task OPTIONAL
+  )
+{
+  EFI_STATUS                     Status;
+  EFI_PHYSICAL_ADDRESS           PhyAddr;
+  UINTN                          MapLength;
+  EFI_PCI_IO_PROTOCOL_OPERATION  Flag;
+  EFI_AHCI_COMMAND_FIS           CFis;
+  EFI_AHCI_COMMAND_LIST          CmdList;
+  EFI_PCI_IO_PROTOCOL            *PciIo;
+  EFI_TPL                        OldTpl;
+  ATA_NONBLOCK_TASK              BlockingTask;
+  AHCI_NCQ_COMMAND_TABLE         *CommandTable;
+  UINT8                          SlotNumber;
+  UINT8                          Slot;
+  UINT32                         SlotBit;
+  UINT32                         PrdtIndex;
+  UINTN                          RemainedData;
+  DATA_64                        Data64;
+  UINT32                         Offset;
+  UINT32                         PortInterrupt;
+  UINT32                         PortActive;
+  UINT32                         PortTfd;
+  UINT8                          LogData[512];
+
+  PciIo = Instance->PciIo;
+
+  if ((PciIo == NULL) || (AhciRegisters->NcqSlotNumber == 0)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (Task == NULL) {
+    //
+    // Before starting the Blocking BlockIO operation, push to finish all non-blocking
+    // BlockIO tasks, then run the command in slot 0 as a single-entry queue.
+    //
+    OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+    while (!IsListEmpty (&Instance->NonBlockingTaskList)) {
+      AsyncNonBlockingTransferRoutine (NULL, Instance);
+      //
+      // Stall for 100us.
+      //
+      MicroSecondDelay (100);
+    }
+
+    gBS->RestoreTPL (OldTpl);
+
+    ZeroMem (&BlockingTask, sizeof (ATA_NONBLOCK_TASK));
+    BlockingTask.QueueDepth   = 1;
+    BlockingTask.RetryTimes   = DivU64x32 (Timeout, 1000) + 1;
+    BlockingTask.InfiniteWait = (BOOLEAN)(Timeout == 0);
+    do {
+      Status = AhciFpdmaTransfer (
+                 Instance,
+                 AhciRegisters,
+                 Port,
+                 PortMultiplier,
+                 Read,
+                 AtaCommandBlock,
+                 AtaStatusBlock,
+                 MemoryAddr,
+                 DataCount,
+                 Timeout,
+                 &BlockingTask
+                 );
+      if (Status == EFI_NOT_READY) {
+        //
+        // Stall for 100us.
+        //
+        MicroSecondDelay (100);
+      }
+    } while (Status == EFI_NOT_READY);
+
+    return Status;
+  }
+
+  if (!Task->IsStart) {
+    //
+    // Wait for the queued commands of another port to drain, and for a free
+    // command slot within the queue depth of the device.
+    //
+    if ((AhciRegisters->NcqActiveSlots != 0) && (AhciRegisters->NcqPort != Port)) {
+      return EFI_NOT_READY;
+    }
+
+    SlotNumber = MIN (AhciRegisters->NcqSlotNumber, Task->QueueDepth);
+    for (Slot = 0; Slot < SlotNumber; Slot++) {
+      if ((AhciRegisters->NcqActiveSlots & ((UINT32)1 << Slot)) == 0) {
+        break;
+      }
+    }
+
+    if (Slot == SlotNumber) {
+      return EFI_NOT_READY;
+    }
+
+    if (Read) {
+      Flag = EfiPciIoOperationBusMasterWrite;
+    } else {
+      Flag = EfiPciIoOperationBusMasterRead;
+    }
+
+    MapLength = DataCount;
+    Status    = PciIo->Map (
+                         PciIo,
+                         Flag,
+                         MemoryAddr,
+                         &MapLength,
+                         &PhyAddr,
+                         &Task->Map
+                         );
+    if (EFI_ERROR (Status) || (DataCount != MapLength)) {
+      if (!EFI_ERROR (Status)) {
+        PciIo->Unmap (PciIo, Task->Map);
+      }
+
+      Task->Map = NULL;
+      return EFI_BAD_BUFFER_SIZE;
+    }
+
+    //
+    // The command tag goes to bits 7:3 of the sector count, the sector count
+    // itself is in the features registers. Unlike the other ATA commands,
+    // BIT7 of the device register is FUA and is taken from the command block.
+    //
+    AhciBuildCommandFis (&CFis, AtaCommandBlock);
+    CFis.AhciCFisSecCount = (UINT8)(Slot << 3);
+    CFis.AhciCFisDevHead  = (UINT8)(AtaCommandBlock->AtaDeviceHead | BIT6);
+    CFis.AhciCFisPmNum    = PortMultiplier;
+
+    CommandTable = &AhciRegisters->AhciNcqCommandTable[Slot];
+    ZeroMem (CommandTable, sizeof (AHCI_NCQ_COMMAND_TABLE));
+    CopyMem (&CommandTable->CommandFis, &CFis, sizeof (EFI_AHCI_COMMAND_FIS));
+
+    ZeroMem (&CmdList, sizeof (EFI_AHCI_COMMAND_LIST));
+    CmdList.AhciCmdCfl   = EFI_AHCI_FIS_REGISTER_H2D_LENGTH / 4;
+    CmdList.AhciCmdW     = Read ? 0 : 1;
+    CmdList.AhciCmdPmp   = PortMultiplier;
+    CmdList.AhciCmdPrdtl = (UINT32)DivU64x32 (((UINT64)DataCount + EFI_AHCI_MAX_DATA_PER_PRDT - 1), EFI_AHCI_MAX_DATA_PER_PRDT);
+    ASSERT (CmdList.AhciCmdPrdtl <= AHCI_NCQ_MAX_PRDT);
+
+    RemainedData = (UINTN)DataCount;
+    for (PrdtIndex = 0; PrdtIndex < CmdList.AhciCmdPrdtl; PrdtIndex++) {
+      if (RemainedData < EFI_AHCI_MAX_DATA_PER_PRDT) {
+        CommandTable->PrdtTable[PrdtIndex].AhciPrdtDbc = (UINT32)RemainedData - 1;
+      } else {
+        CommandTable->PrdtTable[PrdtIndex].AhciPrdtDbc = EFI_AHCI_MAX_DATA_PER_PRDT - 1;
+      }
+
+      Data64.Uint64                                   = PhyAddr;
+      CommandTable->PrdtTable[PrdtIndex].AhciPrdtDba  = Data64.Uint32.Lower32;
+      CommandTable->PrdtTable[PrdtIndex].AhciPrdtDbau = Data64.Uint32.Upper32;
+      RemainedData                                   -= EFI_AHCI_MAX_DATA_PER_PRDT;
+      PhyAddr                                        += EFI_AHCI_MAX_DATA_PER_PRDT;
+    }
+
+    if (CmdList.AhciCmdPrdtl > 0) {
+      CommandTable->PrdtTable[CmdList.AhciCmdPrdtl - 1].AhciPrdtIoc = 1;
+    }
+
+    Data64.Uint64        = (UINT64)(UINTN)&AhciRegisters->AhciNcqCommandTablePciAddr[Slot];
+    CmdList.AhciCmdCtba  = Data64.Uint32.Lower32;
+    CmdList.AhciCmdCtbau = Data64.Uint32.Upper32;
+    CopyMem (&AhciRegisters->AhciCmdList[Slot], &CmdList, sizeof (EFI_AHCI_COMMAND_LIST));
+
+    //
+    // Start the port for the first command of the queue.
+    //
+    if (AhciRegisters->NcqActiveSlots == 0) {
+      AhciClearPortStatus (PciIo, Port);
+      AhciEnableFisReceive (PciIo, Port, Timeout);
+
+      Offset = EFI_AHCI_PORT_START + Port * EFI_AHCI_PORT_REG_WIDTH + EFI_AHCI_PORT_CMD;
+      AhciAndReg (PciIo, Offset, (UINT32) ~(EFI_AHCI_PORT_CMD_DLAE | EFI_AHCI_PORT_CMD_ATAPI));
+      AhciOrReg (PciIo, Offset, EFI_AHCI_PORT_CMD_ST);
+      AhciRegisters->NcqPort = Port;
+    }
+
+    DEBUG ((DEBUG_VERBOSE, "Starting command for FPDMA transfer in slot %d:\n", Slot));
+    AhciPrintCommandBlock (AtaCommandBlock, DEBUG_VERBOSE);
+
+    //
+    // PxSACT and PxCI ignore the bits written as 0. Write only the bit of
+    // this slot, as writing back a bit the device has just cleared would
+    // issue that command again.
+    //
+    SlotBit = (UINT32)1 << Slot;
+    Offset  = EFI_AHCI_PORT_START + Port * EFI_AHCI_PORT_REG_WIDTH + EFI_AHCI_PORT_SACT;
+    AhciWriteReg (PciIo, Offset, SlotBit);
+    Offset = EFI_AHCI_PORT_START + Port * EFI_AHCI_PORT_REG_WIDTH + EFI_AHCI_PORT_CI;
+    AhciWriteReg (PciIo, Offset, SlotBit);
+
+    AhciRegisters->NcqActiveSlots |= SlotBit;
+    Task->Slot                     = Slot;
+    Task->IsStart                  = TRUE;
+  }
+
+  SlotBit       = (UINT32)1 << Task->Slot;
+  Offset        = EFI_AHCI_PORT_START + Port * EFI_AHCI_PORT_REG_WIDTH + EFI_AHCI_PORT_IS;
+  PortInterrupt = AhciReadReg (PciIo, Offset);
+  if ((PortInterrupt & EFI_AHCI_PORT_IS_ERROR_MASK) != 0) {
+    DEBUG ((DEBUG_ERROR, "AHCI: Error interrupt reported PxIS: %X\n", PortInterrupt));
+    Status = EFI_DEVICE_ERROR;
+  } else {
+    Offset      = EFI_AHCI_PORT_START + Port * EFI_AHCI_PORT_REG_WIDTH + EFI_AHCI_PORT_SACT;
+    PortActive  = AhciReadReg (PciIo, Offset);
+    Offset      = EFI_AHCI_PORT_START + Port * EFI_AHCI_PORT_REG_WIDTH + EFI_AHCI_PORT_CI;
+    PortActive |= AhciReadReg (PciIo, Offset);
+    if ((PortActive & SlotBit) == 0) {
+      Status = EFI_SUCCESS;
+    } else if (!Task->InfiniteWait && (Task->RetryTimes == 0)) {
+      Status = EFI_TIMEOUT;
+    } else {
+      Task->RetryTimes--;
+      return EFI_NOT_READY;
+    }
+  }
+
+  AhciRegisters->NcqActiveSlots &= ~SlotBit;
+  AhciDumpPortStatus (PciIo, AhciRegisters, Port, AtaStatusBlock);
+
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed to execute command for FPDMA transfer:\n"));
+    AhciPrintCommandBlock (AtaCommandBlock, DEBUG_ERROR);
+    AhciPrintStatusBlock (AtaStatusBlock, DEBUG_ERROR);
+    AtaStatusBlock->AtaStatus |= BIT0;
+
+    //
+    // Stopping the port aborts all queued commands in flight. Reset the port
+    // if the device is still busy, and read the NCQ Command Error log to take
+    // the device out of its error state.
+    //
+    AhciStopCommand (PciIo, Port, Timeout);
+    AhciRegisters->NcqActiveSlots = 0;
+
+    Offset  = EFI_AHCI_PORT_START + Port * EFI_AHCI_PORT_REG_WIDTH + EFI_AHCI_PORT_TFD;
+    PortTfd = AhciReadReg (PciIo, Offset);
+    if ((PortTfd & (EFI_AHCI_PORT_TFD_BSY | EFI_AHCI_PORT_TFD_DRQ)) != 0) {
+      AhciResetPort (PciIo, Port);
+    }
+
+    AhciClearPortStatus (PciIo, Port);
+    AhciReadLogExt (PciIo, AhciRegisters, Port, PortMultiplier, LogData, 0x10, 0x00);
+  }
+
+  PciIo->Unmap (PciIo, Task->Map);
+  Task->Map = NULL;
+
+  if (AhciRegisters->NcqActiveSlots == 0) {
+    AhciStopCommand (PciIo, Port, Timeout);
+    AhciDisableFisReceive (PciIo, Port, Timeout);
+  }
+
+  return Status;
+}
+
 /**
   Enable DEVSLP of the disk if supported.
 
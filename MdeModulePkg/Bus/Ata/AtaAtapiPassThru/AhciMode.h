@@ -14,6 +14,7 @@
 #define EFI_AHCI_CAPABILITY_OFFSET  0x0000
 #define   EFI_AHCI_CAP_SAM          BIT18
 #define   EFI_AHCI_CAP_SSS          BIT27
+#define   EFI_AHCI_CAP_SNCQ         BIT30
 #define   EFI_AHCI_CAP_S64A         BIT31
 #define EFI_AHCI_GHC_OFFSET         0x0004
 #define   EFI_AHCI_GHC_RESET        BIT0
@@ -286,6 +287,22 @@ typedef struct {
   EFI_AHCI_COMMAND_PRDT     PrdtTable[65535];     // The scatter/gather list for data transfer
 } EFI_AHCI_COMMAND_TABLE;
 
+//
+// The number of PRDT entries in the command table of a native queued command.
+// 64 entries of 4MB cover the largest FPDMA transfer of 65536 4KB sectors.
+//
+#define AHCI_NCQ_MAX_PRDT  64
+
+//
+// Command table of one command slot used for native command queuing
+//
+typedef struct {
+  EFI_AHCI_COMMAND_FIS      CommandFis;       // A software constructed FIS.
+  EFI_AHCI_ATAPI_COMMAND    AtapiCmd;         // 12 or 16 bytes ATAPI cmd.
+  UINT8                     Reserved[0x30];
+  EFI_AHCI_COMMAND_PRDT     PrdtTable[AHCI_NCQ_MAX_PRDT]; // The scatter/gather list for data transfer
+} AHCI_NCQ_COMMAND_TABLE;
+
 //
 // Received FIS structure
 //
@@ -325,6 +342,19 @@ typedef struct {
   VOID                      *MapRFis;
   VOID                      *MapCmdList;
   VOID                      *MapCommandTable;
+  //
+  // Native command queuing resource, one command table per command slot.
+  // NcqSlotNumber is 0 if the HBA doesn't support native command queuing.
+  // As the command list is shared by all ports, queued commands can only
+  // be in flight on one port (NcqPort) at a time.
+  //
+  AHCI_NCQ_COMMAND_TABLE    *AhciNcqCommandTable;
+  AHCI_NCQ_COMMAND_TABLE    *AhciNcqCommandTablePciAddr;
+  UINT64                    MaxNcqCommandTableSize;
+  VOID                      *MapNcqCommandTable;
+  UINT8                     NcqSlotNumber;
+  UINT8                     NcqPort;
+  UINT32                    NcqActiveSlots;
 } EFI_AHCI_REGISTERS;
 
 /**
@@ -369,6 +369,38 @@ AtaPassThruPassThruExecute (
                      Task
                      );
           break;
+        case EFI_ATA_PASS_THRU_PROTOCOL_FPDMA:
+          if (Packet->InTransferLength != 0) {
+            Status = AhciFpdmaTransfer (
+                       Instance,
+                       &Instance->AhciRegisters,
+                       (UINT8)Port,
+                       (UINT8)PortMultiplierPort,
+                       TRUE,
+                       Packet->Acb,
+                       Packet->Asb,
+                       Packet->InDataBuffer,
+                       Packet->InTransferLength,
+                       Packet->Timeout,
+                       Task
+                       );
+          } else {
+            Status = AhciFpdmaTransfer (
+                       Instance,
+                       &Instance->AhciRegisters,
+                       (UINT8)Port,
+                       (UINT8)PortMultiplierPort,
+                       FALSE,
+                       Packet->Acb,
+                       Packet->Asb,
+                       Packet->OutDataBuffer,
+                       Packet->OutTransferLength,
+                       Packet->Timeout,
+                       Task
+                       );
+          }
+
+          break;
         default:
           return EFI_UNSUPPORTED;
       }
@@ -409,13 +441,22 @@ AsyncNonBlockingTransferRoutine (
   //
   // Get the Tasks from the Tasks List and execute it, until there is
   // no task in the list or the device is busy with task (EFI_NOT_READY).
+  // A native queued command that is issued doesn't hold up the tasks
+  // behind it, so that further queued commands can be issued in other
+  // command slots.
   //
-  while (TRUE) {
-    if (!IsListEmpty (EntryHeader)) {
-      Entry = GetFirstNode (EntryHeader);
-      Task  = ATA_NON_BLOCK_TASK_FROM_ENTRY (Entry);
-    } else {
-      return;
+  Entry = GetFirstNode (EntryHeader);
+  while (!IsNull (EntryHeader, Entry)) {
+    Task  = ATA_NON_BLOCK_TASK_FROM_ENTRY (Entry);
+    Entry = GetNextNode (EntryHeader, Entry);
+
+    //
+    // No other command can be issued while native queued commands are in flight.
+    //
+    if ((Task->Packet->Protocol != EFI_ATA_PASS_THRU_PROTOCOL_FPDMA) &&
+        (Instance->AhciRegisters.NcqActiveSlots != 0))
+    {
+      break;
     }
 
     Status = AtaPassThruPassThruExecute (
@@ -440,6 +481,10 @@ AsyncNonBlockingTransferRoutine (
     // is not finished yet. Otherwise the operation is successful.
     //
     if (Status == EFI_NOT_READY) {
+      if ((Task->Packet->Protocol == EFI_ATA_PASS_THRU_PROTOCOL_FPDMA) && Task->IsStart) {
+        continue;
+      }
+
       break;
     } else {
       RemoveEntryList (&Task->Link);
@@ -952,6 +997,18 @@ AtaAtapiPassThruStop (
   //
   if (Instance->Mode == EfiAtaAhciMode) {
     AhciRegisters = &Instance->AhciRegisters;
+    if (AhciRegisters->NcqSlotNumber != 0) {
+      PciIo->Unmap (
+               PciIo,
+               AhciRegisters->MapNcqCommandTable
+               );
+      PciIo->FreeBuffer (
+               PciIo,
+               EFI_SIZE_TO_PAGES ((UINTN)AhciRegisters->MaxNcqCommandTableSize),
+               AhciRegisters->AhciNcqCommandTable
+               );
+    }
+
     PciIo->Unmap (
              PciIo,
              AhciRegisters->MapCommandTable
@@ -1153,6 +1210,13 @@ DestroyAsynTaskList (
   EFI_TPL            OldTpl;
 
   OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  //
+  // Stop the port to abort the native queued commands in flight.
+  //
+  if (Instance->AhciRegisters.NcqActiveSlots != 0) {
+    AhciStopCommand (Instance->PciIo, Instance->AhciRegisters.NcqPort, ATA_ATAPI_TIMEOUT);
+  }
+
   if (!IsListEmpty (&Instance->NonBlockingTaskList)) {
     //
     // Free the Subtask list.
@@ -1166,6 +1230,13 @@ DestroyAsynTaskList (
       Task     = ATA_NON_BLOCK_TASK_FROM_ENTRY (DelEntry);
 
       RemoveEntryList (DelEntry);
+      //
+      // Native queued commands in flight have been aborted, unmap their buffers.
+      //
+      if ((Task->Packet->Protocol == EFI_ATA_PASS_THRU_PROTOCOL_FPDMA) && (Task->Map != NULL)) {
+        Instance->PciIo->Unmap (Instance->PciIo, Task->Map);
+      }
+
       if (IsSigEvent) {
         Task->Packet->Asb->AtaStatus = 0x01;
         gBS->SignalEvent (Task->Event);
@@ -1175,6 +1246,7 @@ DestroyAsynTaskList (
     }
   }
 
+  Instance->AhciRegisters.NcqActiveSlots = 0;
   gBS->RestoreTPL (OldTpl);
 }
 
@@ -1296,6 +1368,7 @@ AtaPassThruPassThru (
   ATA_NONBLOCK_TASK             *Task;
   EFI_TPL                       OldTpl;
   UINT32                        BlockSize;
+  UINT8                         QueueDepth;
 
   Instance = ATA_PASS_THRU_PRIVATE_DATA_FROM_THIS (This);
 
@@ -1328,6 +1401,23 @@ AtaPassThruPassThru (
   DeviceInfo     = ATA_ATAPI_DEVICE_INFO_FROM_THIS (Node);
   IdentifyData   = DeviceInfo->IdentifyData;
   MaxSectorCount = 0x100;
+
+  //
+  // Native queued commands need the support of both the AHCI HBA and the device.
+  // Per SATA spec, word76 bit8 indicates NCQ support and word75 bits 4:0 is the
+  // maximum queue depth minus 1.
+  //
+  QueueDepth = 1;
+  if (Packet->Protocol == EFI_ATA_PASS_THRU_PROTOCOL_FPDMA) {
+    if ((Instance->Mode != EfiAtaAhciMode) || (Instance->AhciRegisters.NcqSlotNumber == 0) ||
+        ((IdentifyData->AtaData.serial_ata_capabilities & BIT8) == 0))
+    {
+      return EFI_UNSUPPORTED;
+    }
+
+    QueueDepth = (UINT8)((IdentifyData->AtaData.queue_depth & 0x1F) + 1);
+  }
+
   if ((IdentifyData->AtaData.command_set_supported_83 & (BIT10 | BIT15 | BIT14)) == 0x4400) {
     Capacity = *((UINT64 *)IdentifyData->AtaData.maximum_lba_for_48bit_addressing);
     if (Capacity > 0xFFFFFFF) {
@@ -1393,6 +1483,7 @@ AtaPassThruPassThru (
     Task->Packet         = Packet;
     Task->Event          = Event;
     Task->IsStart        = FALSE;
+    Task->QueueDepth     = QueueDepth;
     Task->RetryTimes     = DivU64x32 (Packet->Timeout, 1000) + 1;
     if (Packet->Timeout == 0) {
       Task->InfiniteWait = TRUE;
@@ -139,6 +139,8 @@ struct _ATA_NONBLOCK_TASK {
   VOID                                *TableMap;       // Pointer to PRD table map.
   EFI_ATA_DMA_PRD                     *MapBaseAddress; //  Pointer to range Base address for Map.
   UINTN                               PageCount;       //  The page numbers used by PCIO freebuffer.
+  UINT8                               QueueDepth;      //  The NCQ queue depth of the device.
+  UINT8                               Slot;            //  The command slot of a queued command.
 };
 
 //
@@ -1148,6 +1150,45 @@ AhciDmaTransfer (
   IN     ATA_NONBLOCK_TASK             *Task
   );
 
+/**
+  Start or poll a native queued (FPDMA) data transfer on specific port.
+
+  @param[in]       Instance            The ATA_ATAPI_PASS_THRU_INSTANCE protocol instance.
+  @param[in]       AhciRegisters       The pointer to the EFI_AHCI_REGISTERS.
+  @param[in]       Port                The number of port.
+  @param[in]       PortMultiplier      The number of port multiplier.
+  @param[in]       Read                The transfer direction.
+  @param[in]       AtaCommandBlock     The EFI_ATA_COMMAND_BLOCK data.
+  @param[in, out]  AtaStatusBlock      The EFI_ATA_STATUS_BLOCK data.
+  @param[in, out]  MemoryAddr          The pointer to the data buffer.
+  @param[in]       DataCount           The data count to be transferred.
+  @param[in]       Timeout             The timeout value of data transfer, uses 100ns as a unit.
+  @param[in]       Task                Optional. Pointer to the ATA_NONBLOCK_TASK
+                                       used by non-blocking mode.
+
+  @retval EFI_NOT_READY       The command is not issued or not completed yet.
+  @retval EFI_DEVICE_ERROR    The FPDMA data transfer abort with error occurs.
+  @retval EFI_TIMEOUT         The operation is time out.
+  @retval EFI_BAD_BUFFER_SIZE The data buffer can't be mapped.
+  @retval EFI_SUCCESS         The FPDMA data transfer executes successfully.
+
+**/
+EFI_STATUS
+EFIAPI
+AhciFpdmaTransfer (
+  IN     ATA_ATAPI_PASS_THRU_INSTANCE  *Instance,
+  IN     EFI_AHCI_REGISTERS            *AhciRegisters,
+  IN     UINT8                         Port,
+  IN     UINT8                         PortMultiplier,
+  IN     BOOLEAN                       Read,
+  IN     EFI_ATA_COMMAND_BLOCK         *AtaCommandBlock,
+  IN OUT EFI_ATA_STATUS_BLOCK          *AtaStatusBlock,
+  IN OUT VOID                          *MemoryAddr,
+  IN     UINT32                        DataCount,
+  IN     UINT64                        Timeout,
+  IN     ATA_NONBLOCK_TASK             *Task OPTIONAL
+  );
+
 /**
   Start a PIO data transfer on specific port.
 
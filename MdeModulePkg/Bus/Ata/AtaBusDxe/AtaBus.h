@@ -114,6 +114,10 @@ typedef struct {
 
   BOOLEAN                                  UdmaValid;
   BOOLEAN                                  Lba48Bit;
+  //
+  // Whether non-blocking transfers are issued as native queued commands
+  //
+  BOOLEAN                                  NcqValid;
 
   //
   // Cached data for ATA identify data
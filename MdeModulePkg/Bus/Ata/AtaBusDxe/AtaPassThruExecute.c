@@ -19,11 +19,13 @@
 
 #include "AtaBus.h"
 
-#define ATA_CMD_TRUST_NON_DATA     0x5B
-#define ATA_CMD_TRUST_RECEIVE      0x5C
-#define ATA_CMD_TRUST_RECEIVE_DMA  0x5D
-#define ATA_CMD_TRUST_SEND         0x5E
-#define ATA_CMD_TRUST_SEND_DMA     0x5F
+#define ATA_CMD_TRUST_NON_DATA      0x5B
+#define ATA_CMD_TRUST_RECEIVE       0x5C
+#define ATA_CMD_TRUST_RECEIVE_DMA   0x5D
+#define ATA_CMD_TRUST_SEND          0x5E
+#define ATA_CMD_TRUST_SEND_DMA      0x5F
+#define ATA_CMD_READ_FPDMA_QUEUED   0x60
+#define ATA_CMD_WRITE_FPDMA_QUEUED  0x61
 
 //
 // Look up table (UdmaValid, IsWrite) for EFI_ATA_PASS_THRU_CMD_PROTOCOL
@@ -319,6 +321,18 @@ IdentifyAtaDevice (
     }
   }
 
+  //
+  // Check whether native command queuing is supported per WORD 76 (Serial ATA
+  // capabilities) bit 8. The queued commands are DMA commands with 48-bit LBA.
+  //
+  AtaDevice->NcqValid = FALSE;
+  if (AtaDevice->UdmaValid &&
+      (IdentifyData->serial_ata_capabilities != 0xFFFF) &&
+      ((IdentifyData->serial_ata_capabilities & BIT8) != 0))
+  {
+    AtaDevice->NcqValid = TRUE;
+  }
+
   Capacity = GetAtapi6Capacity (AtaDevice);
   if (Capacity > MAX_28BIT_ADDRESSING_CAPACITY) {
     //
@@ -432,6 +446,92 @@ DiscoverAtaDevice (
   return Status;
 }
 
+/**
+  Transfer data from/to ATA device with a native queued command.
+
+  This function performs one non-blocking ATA pass through transaction with
+  READ/WRITE FPDMA QUEUED, so that the host controller can have several of
+  them in flight on the device at the same time.
+
+  @param[in, out]  AtaDevice       The ATA child device involved for the operation.
+  @param[in, out]  TaskPacket      Pointer to a Pass Thru Command Packet.
+  @param[in, out]  Buffer          The pointer to the current transaction buffer.
+  @param[in]       StartLba        The starting logical block address to be accessed.
+  @param[in]       TransferLength  The block number or sector count of the transfer.
+  @param[in]       IsWrite         Indicates whether it is a write operation.
+  @param[in]       Event           The Event to be signaled when the request is completed.
+
+  @retval EFI_SUCCESS       The data transfer is issued successfully.
+  @retval EFI_UNSUPPORTED   The ATA pass through doesn't support native queued commands.
+  @return others            Some error occurs when transferring data.
+
+**/
+EFI_STATUS
+QueuedTransferAtaDevice (
+  IN OUT ATA_DEVICE                        *AtaDevice,
+  IN OUT EFI_ATA_PASS_THRU_COMMAND_PACKET  *TaskPacket,
+  IN OUT VOID                              *Buffer,
+  IN EFI_LBA                               StartLba,
+  IN UINT32                                TransferLength,
+  IN BOOLEAN                               IsWrite,
+  IN EFI_EVENT                             Event
+  )
+{
+  EFI_STATUS                        Status;
+  EFI_ATA_COMMAND_BLOCK             *Acb;
+  EFI_ATA_PASS_THRU_COMMAND_PACKET  *Packet;
+
+  //
+  // Prepare for ATA command block. The sector count is in the features
+  // registers, the command tag in the sector count register is assigned
+  // by the ATA pass through.
+  //
+  Acb                     = ZeroMem (&AtaDevice->Acb, sizeof (EFI_ATA_COMMAND_BLOCK));
+  Acb->AtaCommand         = IsWrite ? ATA_CMD_WRITE_FPDMA_QUEUED : ATA_CMD_READ_FPDMA_QUEUED;
+  Acb->AtaFeatures        = (UINT8)TransferLength;
+  Acb->AtaFeaturesExp     = (UINT8)(TransferLength >> 8);
+  Acb->AtaSectorNumber    = (UINT8)StartLba;
+  Acb->AtaCylinderLow     = (UINT8)RShiftU64 (StartLba, 8);
+  Acb->AtaCylinderHigh    = (UINT8)RShiftU64 (StartLba, 16);
+  Acb->AtaSectorNumberExp = (UINT8)RShiftU64 (StartLba, 24);
+  Acb->AtaCylinderLowExp  = (UINT8)RShiftU64 (StartLba, 32);
+  Acb->AtaCylinderHighExp = (UINT8)RShiftU64 (StartLba, 40);
+  Acb->AtaDeviceHead      = BIT6;
+
+  //
+  // Prepare for ATA pass through packet.
+  //
+  Packet = ZeroMem (TaskPacket, sizeof (EFI_ATA_PASS_THRU_COMMAND_PACKET));
+  if (IsWrite) {
+    Packet->OutDataBuffer     = Buffer;
+    Packet->OutTransferLength = TransferLength;
+  } else {
+    Packet->InDataBuffer     = Buffer;
+    Packet->InTransferLength = TransferLength;
+  }
+
+  Packet->Protocol = EFI_ATA_PASS_THRU_PROTOCOL_FPDMA;
+  Packet->Length   = EFI_ATA_PASS_THRU_LENGTH_SECTOR_COUNT;
+  Packet->Timeout  = EFI_TIMER_PERIOD_SECONDS (DivU64x32 (MultU64x32 (TransferLength, AtaDevice->BlockMedia.BlockSize), 2100000) + 31);
+
+  Status = AtaDevicePassThru (AtaDevice, TaskPacket, Event);
+  if (Status == EFI_UNSUPPORTED) {
+    //
+    // Release the status block and command block of the packet, so that it
+    // can be assembled again for a non-queued command.
+    //
+    if (Packet->Asb != NULL) {
+      FreeAlignedBuffer (Packet->Asb, sizeof (EFI_ATA_STATUS_BLOCK));
+    }
+
+    if (Packet->Acb != NULL) {
+      FreePool (Packet->Acb);
+    }
+  }
+
+  return Status;
+}
+
 /**
   Transfer data from ATA device.
 
@@ -469,9 +569,23 @@ TransferAtaDevice (
   IN EFI_EVENT                             Event OPTIONAL
   )
 {
+  EFI_STATUS                        Status;
   EFI_ATA_COMMAND_BLOCK             *Acb;
   EFI_ATA_PASS_THRU_COMMAND_PACKET  *Packet;
 
+  //
+  // Issue non-blocking transfers as native queued commands if possible. If the
+  // ATA pass through doesn't support them, don't try again for this device.
+  //
+  if ((TaskPacket != NULL) && AtaDevice->NcqValid) {
+    Status = QueuedTransferAtaDevice (AtaDevice, TaskPacket, Buffer, StartLba, TransferLength, IsWrite, Event);
+    if (Status != EFI_UNSUPPORTED) {
+      return Status;
+    }
+
+    AtaDevice->NcqValid = FALSE;
+  }
+
   //
   // Ensure AtaDevice->UdmaValid, AtaDevice->Lba48Bit and IsWrite are valid boolean values
   //
@@ -806,7 +920,12 @@ AccessAtaDevice (
   if ((Token != NULL) && (Token->Event != NULL)) {
     OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
 
-    if (!IsListEmpty (&AtaDevice->AtaSubTaskList)) {
+    //
+    // Without native command queuing, the device executes one command at a
+    // time, so a request waits till the sub tasks of the previous one are done.
+    // With it, the sub tasks of several requests are in flight together.
+    //
+    if (!AtaDevice->NcqValid && !IsListEmpty (&AtaDevice->AtaSubTaskList)) {
       AtaTask = AllocateZeroPool (sizeof (ATA_BUS_ASYN_TASK));
       if (AtaTask == NULL) {
         gBS->RestoreTPL (OldTpl);
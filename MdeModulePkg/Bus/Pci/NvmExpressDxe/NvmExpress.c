@@ -716,6 +716,42 @@ ProcessAsyncTaskList (
                  &Data
                  );
   }
+
+  //
+  // Stop polling while there is nothing outstanding. The monitor is re-armed
+  // by NvmeArmAsyncTimer() when new asynchronous work is queued.
+  //
+  if (IsListEmpty (&Private->UnsubmittedSubtasks) &&
+      IsListEmpty (&Private->AsyncPassThruQueue))
+  {
+    gBS->SetTimer (Private->TimerEvent, TimerCancel, 0);
+    Private->TimerArmed = FALSE;
+  }
+}
+
+/**
+  Re-arm the asynchronous I/O completion monitor after new work is queued.
+
+  The caller must be running at TPL_NOTIFY.
+
+  @param[in]  Private   The pointer to the NVME_CONTROLLER_PRIVATE_DATA data
+                        structure.
+
+**/
+VOID
+NvmeArmAsyncTimer (
+  IN NVME_CONTROLLER_PRIVATE_DATA  *Private
+  )
+{
+  EFI_STATUS  Status;
+
+  if (Private->TimerArmed) {
+    return;
+  }
+
+  Status = gBS->SetTimer (Private->TimerEvent, TimerPeriodic, NVME_HC_ASYNC_TIMER);
+  ASSERT_EFI_ERROR (Status);
+  Private->TimerArmed = !EFI_ERROR (Status);
 }
 
 /**
@@ -1083,6 +1119,8 @@ NvmExpressDriverBindingStart (
       goto Exit;
     }
 
+    Private->TimerArmed = TRUE;
+
     Status = gBS->InstallMultipleProtocolInterfaces (
                     &Controller,
                     &gEfiNvmExpressPassThruProtocolGuid,
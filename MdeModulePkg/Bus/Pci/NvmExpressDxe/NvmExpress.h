@@ -163,6 +163,7 @@ struct _NVME_CONTROLLER_PRIVATE_DATA {
   // For Non-blocking operations.
   //
   EFI_EVENT      TimerEvent;
+  BOOLEAN        TimerArmed;
   LIST_ENTRY     AsyncPassThruQueue;
   LIST_ENTRY     UnsubmittedSubtasks;
 };
@@ -723,6 +724,35 @@ NvmeDumpStatus (
   IN NVME_CQ  *Cq
   );
 
+/**
+  Call back function when the timer event is signaled.
+
+  @param[in]  Event     The Event this notify function registered to.
+  @param[in]  Context   Pointer to the context data registered to the
+                        Event.
+
+**/
+VOID
+EFIAPI
+ProcessAsyncTaskList (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  );
+
+/**
+  Re-arm the asynchronous I/O completion monitor after new work is queued.
+
+  The caller must be running at TPL_NOTIFY.
+
+  @param[in]  Private   The pointer to the NVME_CONTROLLER_PRIVATE_DATA data
+                        structure.
+
+**/
+VOID
+NvmeArmAsyncTimer (
+  IN NVME_CONTROLLER_PRIVATE_DATA  *Private
+  );
+
 /**
   Register the shutdown notification through the ResetNotification protocol.
 
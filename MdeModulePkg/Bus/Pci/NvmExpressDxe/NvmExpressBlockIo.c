@@ -9,6 +9,30 @@
 
 #include "NvmExpress.h"
 
+/**
+  Transfer some blocks with several commands kept in flight at once.
+
+  @param  Device        The pointer to the NVME_DEVICE_PRIVATE_DATA data
+                        structure.
+  @param  Buffer        The buffer used to store the data transferred.
+  @param  Lba           The start block number.
+  @param  Blocks        Total block number to be transferred.
+  @param  IsWrite       Indicates it is a write operation.
+
+  @retval EFI_SUCCESS   Data are transferred.
+  @retval Others        Fail to transfer all the data.
+
+**/
+STATIC
+EFI_STATUS
+NvmePipelinedTransfer (
+  IN     NVME_DEVICE_PRIVATE_DATA  *Device,
+  IN OUT VOID                      *Buffer,
+  IN     UINT64                    Lba,
+  IN     UINTN                     Blocks,
+  IN     BOOLEAN                   IsWrite
+  );
+
 /**
   Read some sectors from the device.
 
@@ -195,6 +219,14 @@ NvmeRead (
     MaxTransferBlocks = 1024;
   }
 
+  //
+  // A request spanning several commands goes through the asynchronous I/O
+  // queue, so the device works on all of them instead of one at a time.
+  //
+  if (Blocks > MaxTransferBlocks) {
+    return NvmePipelinedTransfer (Device, Buffer, Lba, Blocks, FALSE);
+  }
+
   while (Blocks > 0) {
     if (Blocks > MaxTransferBlocks) {
       Status = ReadSectors (Device, (UINT64)(UINTN)Buffer, Lba, MaxTransferBlocks);
@@ -281,6 +313,14 @@ NvmeWrite (
     MaxTransferBlocks = 1024;
   }
 
+  //
+  // A request spanning several commands goes through the asynchronous I/O
+  // queue, so the device works on all of them instead of one at a time.
+  //
+  if (Blocks > MaxTransferBlocks) {
+    return NvmePipelinedTransfer (Device, Buffer, Lba, Blocks, TRUE);
+  }
+
   while (Blocks > 0) {
     if (Blocks > MaxTransferBlocks) {
       Status = WriteSectors (Device, (UINT64)(UINTN)Buffer, Lba, MaxTransferBlocks);
@@ -528,6 +568,7 @@ AsyncReadSectors (
   OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
   InsertTailList (&Private->UnsubmittedSubtasks, &Subtask->Link);
   Request->UnsubmittedSubtaskNum++;
+  NvmeArmAsyncTimer (Private);
   gBS->RestoreTPL (OldTpl);
 
   return EFI_SUCCESS;
@@ -670,6 +711,7 @@ AsyncWriteSectors (
   OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
   InsertTailList (&Private->UnsubmittedSubtasks, &Subtask->Link);
   Request->UnsubmittedSubtaskNum++;
+  NvmeArmAsyncTimer (Private);
   gBS->RestoreTPL (OldTpl);
 
   return EFI_SUCCESS;
@@ -813,6 +855,13 @@ NvmeAsyncRead (
     }
   }
 
+  //
+  // Submit the queued subtasks now instead of on the next timer tick.
+  //
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  ProcessAsyncTaskList (NULL, Private);
+  gBS->RestoreTPL (OldTpl);
+
   DEBUG ((
     DEBUG_BLKIO,
     "%a: Lba = 0x%08Lx, Original = 0x%08Lx, "
@@ -941,6 +990,13 @@ NvmeAsyncWrite (
     }
   }
 
+  //
+  // Submit the queued subtasks now instead of on the next timer tick.
+  //
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  ProcessAsyncTaskList (NULL, Private);
+  gBS->RestoreTPL (OldTpl);
+
   DEBUG ((
     DEBUG_BLKIO,
     "%a: Lba = 0x%08Lx, Original = 0x%08Lx, "
@@ -956,6 +1012,76 @@ NvmeAsyncWrite (
   return Status;
 }
 
+/**
+  Transfer some blocks with several commands kept in flight at once.
+
+  The request is split into subtasks on the asynchronous I/O queue. The queue
+  is then drained directly rather than from the periodic timer, so each
+  completion is reaped and the next subtask submitted without waiting for a
+  timer tick.
+
+  @param  Device        The pointer to the NVME_DEVICE_PRIVATE_DATA data
+                        structure.
+  @param  Buffer        The buffer used to store the data transferred.
+  @param  Lba           The start block number.
+  @param  Blocks        Total block number to be transferred.
+  @param  IsWrite       Indicates it is a write operation.
+
+  @retval EFI_SUCCESS   Data are transferred.
+  @retval Others        Fail to transfer all the data.
+
+**/
+STATIC
+EFI_STATUS
+NvmePipelinedTransfer (
+  IN     NVME_DEVICE_PRIVATE_DATA  *Device,
+  IN OUT VOID                      *Buffer,
+  IN     UINT64                    Lba,
+  IN     UINTN                     Blocks,
+  IN     BOOLEAN                   IsWrite
+  )
+{
+  EFI_STATUS           Status;
+  EFI_BLOCK_IO2_TOKEN  Token;
+  EFI_TPL              OldTpl;
+
+  Token.TransactionStatus = EFI_SUCCESS;
+  Status                  = gBS->CreateEvent (0, TPL_CALLBACK, NULL, NULL, &Token.Event);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  if (IsWrite) {
+    Status = NvmeAsyncWrite (Device, Buffer, Lba, Blocks, &Token);
+  } else {
+    Status = NvmeAsyncRead (Device, Buffer, Lba, Blocks, &Token);
+  }
+
+  if (!EFI_ERROR (Status)) {
+    while (gBS->CheckEvent (Token.Event) == EFI_NOT_READY) {
+      OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+      ProcessAsyncTaskList (NULL, Device->Controller);
+      gBS->RestoreTPL (OldTpl);
+    }
+
+    Status = Token.TransactionStatus;
+  }
+
+  gBS->CloseEvent (Token.Event);
+
+  DEBUG ((
+    DEBUG_BLKIO,
+    "%a: Lba = 0x%08Lx, Blocks = 0x%08Lx, IsWrite = %d, Status = %r\n",
+    __func__,
+    Lba,
+    (UINT64)Blocks,
+    IsWrite,
+    Status
+    ));
+
+  return Status;
+}
+
 /**
   Reset the Block Device.
 
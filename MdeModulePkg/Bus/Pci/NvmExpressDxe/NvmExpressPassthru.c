@@ -770,6 +770,7 @@ NvmExpressPassThru (
 
     OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
     InsertTailList (&Private->AsyncPassThruQueue, &AsyncRequest->Link);
+    NvmeArmAsyncTimer (Private);
     gBS->RestoreTPL (OldTpl);
 
     return EFI_SUCCESS;
@@ -840,6 +841,8 @@ NvmExpressPassThru (
       goto EXIT;
     }
 
+    Private->TimerArmed = FALSE;
+
     //
     // Reset the NVMe controller.
     //
@@ -852,6 +855,8 @@ NvmExpressPassThru (
         //
         Status = gBS->SetTimer (Private->TimerEvent, TimerPeriodic, NVME_HC_ASYNC_TIMER);
         if (!EFI_ERROR (Status)) {
+          Private->TimerArmed = TRUE;
+
           //
           // Return EFI_TIMEOUT to indicate a timeout occurs for NVMe PassThru command.
           //
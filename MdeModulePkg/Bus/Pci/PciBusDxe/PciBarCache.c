@@ -0,0 +1,257 @@
+/** @file
+  Cache of PCI BAR probe results for PCI Bus module.
+
+  Probing a BAR takes two config space writes and a read at TPL_HIGH_LEVEL.
+  When PcdPciBarProbeCacheEnable is TRUE, the values read back are saved in
+  a variable at ReadyToBoot and reused on the next boot for devices whose
+  identity has not changed.
+
+Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "PciBus.h"
+
+#define PCI_BAR_CACHE_VARIABLE_NAME  L"PciBarCache"
+
+typedef struct {
+  UINT32    Segment;
+  UINT8     Bus;
+  UINT8     Device;
+  UINT8     Function;
+  UINT8     Offset;
+  UINT16    VendorId;
+  UINT16    DeviceId;
+  UINT8     RevisionId;
+  UINT8     ClassCode[3];
+  UINT32    BarLengthValue;
+} PCI_BAR_CACHE_ENTRY;
+
+#define PCI_BAR_CACHE_KEY_SIZE  OFFSET_OF (PCI_BAR_CACHE_ENTRY, BarLengthValue)
+
+BOOLEAN              mPciBarCacheLoaded      = FALSE;
+PCI_BAR_CACHE_ENTRY  *mPciBarCache           = NULL;
+UINTN                mPciBarCacheCount       = 0;
+UINTN                mPciBarCacheNext        = 0;
+PCI_BAR_CACHE_ENTRY  *mPciBarCacheNew        = NULL;
+UINTN                mPciBarCacheNewCount    = 0;
+UINTN                mPciBarCacheNewMaxCount = 0;
+
+/**
+  Save the BAR probe results of this boot if they differ from the cached ones.
+
+  @param  Event                 The triggered event.
+  @param  Context               Context for this event.
+
+**/
+VOID
+EFIAPI
+PciBarCacheSave (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  EFI_STATUS  Status;
+
+  gBS->CloseEvent (Event);
+
+  if ((mPciBarCacheNewCount == mPciBarCacheCount) &&
+      ((mPciBarCacheCount == 0) ||
+       (CompareMem (mPciBarCacheNew, mPciBarCache, mPciBarCacheCount * sizeof (PCI_BAR_CACHE_ENTRY)) == 0)))
+  {
+    return;
+  }
+
+  //
+  // Failing to save only impacts performance of the next boot.
+  //
+  Status = gRT->SetVariable (
+                  PCI_BAR_CACHE_VARIABLE_NAME,
+                  &gEfiCallerIdGuid,
+                  EFI_VARIABLE_BOOTSERVICE_ACCESS | EFI_VARIABLE_NON_VOLATILE,
+                  mPciBarCacheNewCount * sizeof (PCI_BAR_CACHE_ENTRY),
+                  mPciBarCacheNew
+                  );
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_WARN, "PciBus: Failed to save the BAR probe cache - %r\n", Status));
+  }
+}
+
+/**
+  Load the BAR probe results of the previous boot, and arrange for the
+  results of this boot to be saved.
+
+**/
+VOID
+PciBarCacheLoad (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       Size;
+  EFI_EVENT   Event;
+
+  mPciBarCacheLoaded = TRUE;
+
+  GetVariable2 (PCI_BAR_CACHE_VARIABLE_NAME, &gEfiCallerIdGuid, (VOID **)&mPciBarCache, &Size);
+  if ((mPciBarCache != NULL) && ((Size % sizeof (PCI_BAR_CACHE_ENTRY)) != 0)) {
+    FreePool (mPciBarCache);
+    mPciBarCache = NULL;
+  }
+
+  if (mPciBarCache != NULL) {
+    mPciBarCacheCount = Size / sizeof (PCI_BAR_CACHE_ENTRY);
+  }
+
+  Status = EfiCreateEventReadyToBootEx (TPL_CALLBACK, PciBarCacheSave, NULL, &Event);
+  ASSERT_EFI_ERROR (Status);
+}
+
+/**
+  Check whether BAR probe results of the device may be cached.
+
+  @param PciIoDevice       A pointer to the PCI_IO_DEVICE.
+  @param Offset            The offset of the BAR.
+  @param Key               Returns the cache entry key of the BAR.
+
+  @retval TRUE             The BAR probe results may be cached.
+  @retval FALSE            The BAR probe results may not be cached.
+
+**/
+BOOLEAN
+PciBarCacheGetKey (
+  IN  PCI_IO_DEVICE        *PciIoDevice,
+  IN  UINTN                Offset,
+  OUT PCI_BAR_CACHE_ENTRY  *Key
+  )
+{
+  //
+  // Resizable BARs report a different size depending on their control
+  // register, which is reprogrammed during enumeration.
+  //
+  if (!PcdGetBool (PcdPciBarProbeCacheEnable) || (PciIoDevice->ResizableBarOffset != 0)) {
+    return FALSE;
+  }
+
+  if (!mPciBarCacheLoaded) {
+    PciBarCacheLoad ();
+  }
+
+  ZeroMem (Key, sizeof (*Key));
+  Key->Segment    = PciIoDevice->PciRootBridgeIo->SegmentNumber;
+  Key->Bus        = PciIoDevice->BusNumber;
+  Key->Device     = PciIoDevice->DeviceNumber;
+  Key->Function   = PciIoDevice->FunctionNumber;
+  Key->Offset     = (UINT8)Offset;
+  Key->VendorId   = PciIoDevice->Pci.Hdr.VendorId;
+  Key->DeviceId   = PciIoDevice->Pci.Hdr.DeviceId;
+  Key->RevisionId = PciIoDevice->Pci.Hdr.RevisionID;
+  CopyMem (Key->ClassCode, PciIoDevice->Pci.Hdr.ClassCode, sizeof (Key->ClassCode));
+  return TRUE;
+}
+
+/**
+  Look up the value read back from a BAR after all ones were written to it
+  on the previous boot.
+
+  The cached value is only used when PcdPciBarProbeCacheEnable is TRUE and
+  the device at the same location reports the same vendor ID, device ID,
+  revision ID and class code as it did then.
+
+  @param PciIoDevice       A pointer to the PCI_IO_DEVICE.
+  @param Offset            The offset of the BAR.
+  @param BarLengthValue    The cached BAR length value returned.
+
+  @retval TRUE             The BAR length value was found in the cache.
+  @retval FALSE            The BAR has to be probed.
+
+**/
+BOOLEAN
+PciBarCacheLookup (
+  IN  PCI_IO_DEVICE  *PciIoDevice,
+  IN  UINTN          Offset,
+  OUT UINT32         *BarLengthValue
+  )
+{
+  PCI_BAR_CACHE_ENTRY  Key;
+  UINTN                Count;
+  UINTN                Index;
+
+  if (!PciBarCacheGetKey (PciIoDevice, Offset, &Key)) {
+    return FALSE;
+  }
+
+  //
+  // BARs are probed in the same order on every boot, so start searching
+  // right after the previous hit.
+  //
+  Index = mPciBarCacheNext;
+  for (Count = 0; Count < mPciBarCacheCount; Count++) {
+    if (Index >= mPciBarCacheCount) {
+      Index = 0;
+    }
+
+    if (CompareMem (&mPciBarCache[Index], &Key, PCI_BAR_CACHE_KEY_SIZE) == 0) {
+      *BarLengthValue  = mPciBarCache[Index].BarLengthValue;
+      mPciBarCacheNext = Index + 1;
+      return TRUE;
+    }
+
+    Index++;
+  }
+
+  return FALSE;
+}
+
+/**
+  Record the value read back from a BAR after all ones were written to it,
+  so that the next boot can skip probing the BAR.
+
+  @param PciIoDevice       A pointer to the PCI_IO_DEVICE.
+  @param Offset            The offset of the BAR.
+  @param BarLengthValue    The BAR length value.
+
+**/
+VOID
+PciBarCacheRecord (
+  IN PCI_IO_DEVICE  *PciIoDevice,
+  IN UINTN          Offset,
+  IN UINT32         BarLengthValue
+  )
+{
+  PCI_BAR_CACHE_ENTRY  Key;
+  PCI_BAR_CACHE_ENTRY  *NewCache;
+  UINTN                Index;
+
+  if (!PciBarCacheGetKey (PciIoDevice, Offset, &Key)) {
+    return;
+  }
+
+  //
+  // The same BAR may be probed again, e.g. when the bus is re-enumerated.
+  //
+  for (Index = mPciBarCacheNewCount; Index > 0; Index--) {
+    if (CompareMem (&mPciBarCacheNew[Index - 1], &Key, PCI_BAR_CACHE_KEY_SIZE) == 0) {
+      mPciBarCacheNew[Index - 1].BarLengthValue = BarLengthValue;
+      return;
+    }
+  }
+
+  if (mPciBarCacheNewCount == mPciBarCacheNewMaxCount) {
+    NewCache = ReallocatePool (
+                 mPciBarCacheNewMaxCount * sizeof (PCI_BAR_CACHE_ENTRY),
+                 (mPciBarCacheNewMaxCount + 64) * sizeof (PCI_BAR_CACHE_ENTRY),
+                 mPciBarCacheNew
+                 );
+    if (NewCache == NULL) {
+      return;
+    }
+
+    mPciBarCacheNew          = NewCache;
+    mPciBarCacheNewMaxCount += 64;
+  }
+
+  Key.BarLengthValue                      = BarLengthValue;
+  mPciBarCacheNew[mPciBarCacheNewCount++] = Key;
+}
@@ -0,0 +1,51 @@
+/** @file
+  Cache of PCI BAR probe results for PCI Bus module.
+
+Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef _EFI_PCI_BAR_CACHE_H_
+#define _EFI_PCI_BAR_CACHE_H_
+
+/**
+  Look up the value read back from a BAR after all ones were written to it
+  on the previous boot.
+
+  The cached value is only used when PcdPciBarProbeCacheEnable is TRUE and
+  the device at the same location reports the same vendor ID, device ID,
+  revision ID and class code as it did then.
+
+  @param PciIoDevice       A pointer to the PCI_IO_DEVICE.
+  @param Offset            The offset of the BAR.
+  @param BarLengthValue    The cached BAR length value returned.
+
+  @retval TRUE             The BAR length value was found in the cache.
+  @retval FALSE            The BAR has to be probed.
+
+**/
+BOOLEAN
+PciBarCacheLookup (
+  IN  PCI_IO_DEVICE  *PciIoDevice,
+  IN  UINTN          Offset,
+  OUT UINT32         *BarLengthValue
+  );
+
+/**
+  Record the value read back from a BAR after all ones were written to it,
+  so that the next boot can skip probing the BAR.
+
+  @param PciIoDevice       A pointer to the PCI_IO_DEVICE.
+  @param Offset            The offset of the BAR.
+  @param BarLengthValue    The BAR length value.
+
+**/
+VOID
+PciBarCacheRecord (
+  IN PCI_IO_DEVICE  *PciIoDevice,
+  IN UINTN          Offset,
+  IN UINT32         BarLengthValue
+  );
+
+#endif
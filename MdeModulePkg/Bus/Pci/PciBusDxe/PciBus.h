@@ -36,6 +36,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/ReportStatusCodeLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiRuntimeServicesTableLib.h>
 #include <Library/DevicePathLib.h>
 #include <Library/PcdLib.h>
 
@@ -78,6 +79,7 @@ typedef enum {
 #include "PciOptionRomSupport.h"
 #include "PciPowerManagement.h"
 #include "PciHotPlugSupport.h"
+#include "PciBarCache.h"
 #include "PciLib.h"
 
 #define VGABASE1   0x3B0
@@ -262,3 +262,71 @@ LocatePciExpressCapabilityRegBlock (
 
   return EFI_NOT_FOUND;
 }
+
+/**
+  Locate the register blocks of several PciExpress capabilities with a single
+  walk of the extended capability list.
+
+  @param PciIoDevice       A pointer to the PCI_IO_DEVICE.
+  @param CapIds            The capability IDs.
+  @param Offsets           Returned offsets of the first register block of
+                           each capability ID, or 0 if there is none.
+  @param Count             The number of entries in CapIds and Offsets.
+
+  @retval EFI_SUCCESS      The extended capability list has been walked.
+  @retval EFI_UNSUPPORTED  Pci device does not support capability.
+
+**/
+EFI_STATUS
+LocatePciExpressCapabilityRegBlocks (
+  IN  PCI_IO_DEVICE  *PciIoDevice,
+  IN  CONST UINT16   *CapIds,
+  OUT UINT32         *Offsets,
+  IN  UINTN          Count
+  )
+{
+  EFI_STATUS  Status;
+  UINT32      CapabilityPtr;
+  UINT32      CapabilityEntry;
+  UINTN       Index;
+  UINTN       Found;
+
+  ZeroMem (Offsets, Count * sizeof (UINT32));
+
+  //
+  // To check the capability of this device supports
+  //
+  if (!PciIoDevice->IsPciExp) {
+    return EFI_UNSUPPORTED;
+  }
+
+  Found         = 0;
+  CapabilityPtr = EFI_PCIE_CAPABILITY_BASE_OFFSET;
+  while ((CapabilityPtr != 0) && (Found < Count)) {
+    //
+    // Mask it to DWORD alignment per PCI spec
+    //
+    CapabilityPtr &= 0xFFC;
+    Status         = PciIoDevice->PciIo.Pci.Read (
+                                              &PciIoDevice->PciIo,
+                                              EfiPciIoWidthUint32,
+                                              CapabilityPtr,
+                                              1,
+                                              &CapabilityEntry
+                                              );
+    if (EFI_ERROR (Status) || (CapabilityEntry == MAX_UINT32)) {
+      break;
+    }
+
+    for (Index = 0; Index < Count; Index++) {
+      if ((Offsets[Index] == 0) && (CapIds[Index] == (UINT16)CapabilityEntry)) {
+        Offsets[Index] = CapabilityPtr;
+        Found++;
+      }
+    }
+
+    CapabilityPtr = (CapabilityEntry >> 20) & 0xFFF;
+  }
+
+  return EFI_SUCCESS;
+}
@@ -131,6 +131,28 @@ LocatePciExpressCapabilityRegBlock (
   OUT UINT32            *NextRegBlock OPTIONAL
   );
 
+/**
+  Locate the register blocks of several PciExpress capabilities with a single
+  walk of the extended capability list.
+
+  @param PciIoDevice       A pointer to the PCI_IO_DEVICE.
+  @param CapIds            The capability IDs.
+  @param Offsets           Returned offsets of the first register block of
+                           each capability ID, or 0 if there is none.
+  @param Count             The number of entries in CapIds and Offsets.
+
+  @retval EFI_SUCCESS      The extended capability list has been walked.
+  @retval EFI_UNSUPPORTED  Pci device does not support capability.
+
+**/
+EFI_STATUS
+LocatePciExpressCapabilityRegBlocks (
+  IN  PCI_IO_DEVICE  *PciIoDevice,
+  IN  CONST UINT16   *CapIds,
+  OUT UINT32         *Offsets,
+  IN  UINTN          Count
+  );
+
 /**
   Macro that reads command register.
 
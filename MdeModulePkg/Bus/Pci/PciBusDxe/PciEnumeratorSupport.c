@@ -875,23 +875,27 @@ BarExisted (
   //
   PciIo->Pci.Read (PciIo, EfiPciIoWidthUint32, (UINT8)Offset, 1, &OriginalValue);
 
-  //
-  // Raise TPL to high level to disable timer interrupt while the BAR is probed
-  //
-  OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+  if (!PciBarCacheLookup (PciIoDevice, Offset, &Value)) {
+    //
+    // Raise TPL to high level to disable timer interrupt while the BAR is probed
+    //
+    OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
 
-  PciIo->Pci.Write (PciIo, EfiPciIoWidthUint32, (UINT8)Offset, 1, &gAllOne);
-  PciIo->Pci.Read (PciIo, EfiPciIoWidthUint32, (UINT8)Offset, 1, &Value);
+    PciIo->Pci.Write (PciIo, EfiPciIoWidthUint32, (UINT8)Offset, 1, &gAllOne);
+    PciIo->Pci.Read (PciIo, EfiPciIoWidthUint32, (UINT8)Offset, 1, &Value);
 
-  //
-  // Write back the original value
-  //
-  PciIo->Pci.Write (PciIo, EfiPciIoWidthUint32, (UINT8)Offset, 1, &OriginalValue);
+    //
+    // Write back the original value
+    //
+    PciIo->Pci.Write (PciIo, EfiPciIoWidthUint32, (UINT8)Offset, 1, &OriginalValue);
 
-  //
-  // Restore TPL to its original level
-  //
-  gBS->RestoreTPL (OldTpl);
+    //
+    // Restore TPL to its original level
+    //
+    gBS->RestoreTPL (OldTpl);
+  }
+
+  PciBarCacheRecord (PciIoDevice, Offset, Value);
 
   if (BarLengthValue != NULL) {
     *BarLengthValue = Value;
@@ -2154,6 +2158,24 @@ IsRootBridge (
   }
 }
 
+///
+/// The PciExpress extended capabilities located by CreatePciIoDevice(),
+/// in the order of the PCI_EXT_CAP_INDEX values.
+///
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT16  mPciExpressExtCapIds[] = {
+  EFI_PCIE_CAPABILITY_ID_ARI,
+  EFI_PCIE_CAPABILITY_ID_SRIOV,
+  EFI_PCIE_CAPABILITY_ID_MRIOV,
+  PCI_EXPRESS_EXTENDED_CAPABILITY_RESIZABLE_BAR_ID
+};
+
+typedef enum {
+  PciExtCapIndexAri,
+  PciExtCapIndexSrIov,
+  PciExtCapIndexMrIov,
+  PciExtCapIndexResizableBar
+} PCI_EXT_CAP_INDEX;
+
 /**
   Create and initialize general PCI I/O device instance for
   PCI device/bridge device/hotplug bridge device.
@@ -2179,6 +2201,7 @@ CreatePciIoDevice (
   PCI_IO_DEVICE        *PciIoDevice;
   EFI_PCI_IO_PROTOCOL  *PciIo;
   EFI_STATUS           Status;
+  UINT32               ExtCapOffsets[ARRAY_SIZE (mPciExpressExtCapIds)];
 
   PciIoDevice = AllocateZeroPool (sizeof (PCI_IO_DEVICE));
   if (PciIoDevice == NULL) {
@@ -2256,6 +2279,17 @@ CreatePciIoDevice (
     return NULL;
   }
 
+  //
+  // Walk the extended capability list once for all capabilities used below,
+  // instead of once per capability.
+  //
+  LocatePciExpressCapabilityRegBlocks (
+    PciIoDevice,
+    mPciExpressExtCapIds,
+    ExtCapOffsets,
+    ARRAY_SIZE (mPciExpressExtCapIds)
+    );
+
   //
   // Check if device's parent is not Root Bridge
   //
@@ -2263,13 +2297,8 @@ CreatePciIoDevice (
     //
     // Check if the device is an ARI device.
     //
-    Status = LocatePciExpressCapabilityRegBlock (
-               PciIoDevice,
-               EFI_PCIE_CAPABILITY_ID_ARI,
-               &PciIoDevice->AriCapabilityOffset,
-               NULL
-               );
-    if (!EFI_ERROR (Status)) {
+    PciIoDevice->AriCapabilityOffset = ExtCapOffsets[PciExtCapIndexAri];
+    if (PciIoDevice->AriCapabilityOffset != 0) {
       //
       // We need to enable ARI feature before calculate BusReservation,
       // because FirstVFOffset and VFStride may change after that.
@@ -2328,13 +2357,8 @@ CreatePciIoDevice (
   //
 
   if (PcdGetBool (PcdSrIovSupport)) {
-    Status = LocatePciExpressCapabilityRegBlock (
-               PciIoDevice,
-               EFI_PCIE_CAPABILITY_ID_SRIOV,
-               &PciIoDevice->SrIovCapabilityOffset,
-               NULL
-               );
-    if (!EFI_ERROR (Status)) {
+    PciIoDevice->SrIovCapabilityOffset = ExtCapOffsets[PciExtCapIndexSrIov];
+    if (PciIoDevice->SrIovCapabilityOffset != 0) {
       UINT32  SupportedPageSize;
       UINT16  VFStride;
       UINT16  FirstVFOffset;
@@ -2450,26 +2474,16 @@ CreatePciIoDevice (
   }
 
   if (PcdGetBool (PcdMrIovSupport)) {
-    Status = LocatePciExpressCapabilityRegBlock (
-               PciIoDevice,
-               EFI_PCIE_CAPABILITY_ID_MRIOV,
-               &PciIoDevice->MrIovCapabilityOffset,
-               NULL
-               );
-    if (!EFI_ERROR (Status)) {
+    PciIoDevice->MrIovCapabilityOffset = ExtCapOffsets[PciExtCapIndexMrIov];
+    if (PciIoDevice->MrIovCapabilityOffset != 0) {
       DEBUG ((DEBUG_INFO, " MR-IOV: CapOffset = 0x%x\n", PciIoDevice->MrIovCapabilityOffset));
     }
   }
 
   PciIoDevice->ResizableBarOffset = 0;
   if (PcdGetBool (PcdPcieResizableBarSupport)) {
-    Status = LocatePciExpressCapabilityRegBlock (
-               PciIoDevice,
-               PCI_EXPRESS_EXTENDED_CAPABILITY_RESIZABLE_BAR_ID,
-               &PciIoDevice->ResizableBarOffset,
-               NULL
-               );
-    if (!EFI_ERROR (Status)) {
+    PciIoDevice->ResizableBarOffset = ExtCapOffsets[PciExtCapIndexResizableBar];
+    if (PciIoDevice->ResizableBarOffset != 0) {
       PCI_EXPRESS_EXTENDED_CAPABILITIES_RESIZABLE_BAR_CONTROL  ResizableBarControl;
       UINT32                                                   Offset;
       Offset = PciIoDevice->ResizableBarOffset + sizeof (PCI_EXPRESS_EXTENDED_CAPABILITIES_HEADER)
@@ -165,59 +165,61 @@ ProcessAsyncTaskList (
   Private = (SD_MMC_HC_PRIVATE_DATA *)Context;
 
   //
-  // Check if the first entry in the async I/O queue is done or not.
+  // Check if the first entry in the async I/O queue is done or not. Once it
+  // is, start the next entry right away rather than at the next timer tick,
+  // as the requests of one BlockIo2 transfer are all queued up front.
   //
-  Status = EFI_SUCCESS;
-  Trb    = NULL;
-  Link   = GetFirstNode (&Private->Queue);
-  if (!IsNull (&Private->Queue, Link)) {
+  while (TRUE) {
+    Status = EFI_SUCCESS;
+    Link   = GetFirstNode (&Private->Queue);
+    if (IsNull (&Private->Queue, Link)) {
+      return;
+    }
+
     Trb = SD_MMC_HC_TRB_FROM_THIS (Link);
     if (!Private->Slot[Trb->Slot].MediaPresent) {
       Status = EFI_NO_MEDIA;
-      goto Done;
-    }
+    } else {
+      if (!Trb->Started) {
+        //
+        // Check whether the cmd/data line is ready for transfer.
+        //
+        Status = SdMmcCheckTrbEnv (Private, Trb);
+        if (!EFI_ERROR (Status)) {
+          Trb->Started = TRUE;
+          Status       = SdMmcExecTrb (Private, Trb);
+        }
+      }
 
-    if (!Trb->Started) {
-      //
-      // Check whether the cmd/data line is ready for transfer.
-      //
-      Status = SdMmcCheckTrbEnv (Private, Trb);
       if (!EFI_ERROR (Status)) {
-        Trb->Started = TRUE;
-        Status       = SdMmcExecTrb (Private, Trb);
-        if (EFI_ERROR (Status)) {
-          goto Done;
-        }
-      } else {
-        goto Done;
+        Status = SdMmcCheckTrbResult (Private, Trb);
       }
     }
 
-    Status = SdMmcCheckTrbResult (Private, Trb);
-  }
+    if (Status == EFI_NOT_READY) {
+      Packet = Trb->Packet;
+      if (Packet->Timeout == 0) {
+        InfiniteWait = TRUE;
+      } else {
+        InfiniteWait = FALSE;
+      }
 
-Done:
-  if ((Trb != NULL) && (Status == EFI_NOT_READY)) {
-    Packet = Trb->Packet;
-    if (Packet->Timeout == 0) {
-      InfiniteWait = TRUE;
-    } else {
-      InfiniteWait = FALSE;
-    }
+      if ((!InfiniteWait) && (Trb->Timeout-- == 0)) {
+        RemoveEntryList (Link);
+        Trb->Packet->TransactionStatus = EFI_TIMEOUT;
+        TrbEvent                       = Trb->Event;
+        SdMmcFreeTrb (Trb);
+        DEBUG ((DEBUG_VERBOSE, "ProcessAsyncTaskList(): Signal Event %p EFI_TIMEOUT\n", TrbEvent));
+        gBS->SignalEvent (TrbEvent);
+      }
 
-    if ((!InfiniteWait) && (Trb->Timeout-- == 0)) {
-      RemoveEntryList (Link);
-      Trb->Packet->TransactionStatus = EFI_TIMEOUT;
-      TrbEvent                       = Trb->Event;
-      SdMmcFreeTrb (Trb);
-      DEBUG ((DEBUG_VERBOSE, "ProcessAsyncTaskList(): Signal Event %p EFI_TIMEOUT\n", TrbEvent));
-      gBS->SignalEvent (TrbEvent);
+      return;
+    } else if ((Status == EFI_CRC_ERROR) && (Trb->Retries > 0)) {
+      Trb->Retries--;
+      Trb->Started = FALSE;
       return;
     }
-  } else if ((Trb != NULL) && (Status == EFI_CRC_ERROR) && (Trb->Retries > 0)) {
-    Trb->Retries--;
-    Trb->Started = FALSE;
-  } else if ((Trb != NULL)) {
+
     RemoveEntryList (Link);
     Trb->Packet->TransactionStatus = Status;
     TrbEvent                       = Trb->Event;
@@ -225,8 +227,6 @@ Done:
     DEBUG ((DEBUG_VERBOSE, "ProcessAsyncTaskList(): Signal Event %p with %r\n", TrbEvent, Status));
     gBS->SignalEvent (TrbEvent);
   }
-
-  return;
 }
 
 /**
@@ -205,6 +205,34 @@ XhcFreeUrb (
   FreePool (Urb);
 }
 
+/**
+  Calculate the TD Size field of a Normal TRB, that is the number of packets
+  of the TD which remain to be transferred after the TRB.
+
+  @param  Urb           The URB the TRB belongs to.
+  @param  TransferLen   The length of the URB data up to and including the TRB.
+
+  @return The TD Size value.
+
+**/
+UINT32
+XhcTdSize (
+  IN URB    *Urb,
+  IN UINTN  TransferLen
+  )
+{
+  UINTN  MaxPacket;
+  UINTN  Packets;
+
+  MaxPacket = Urb->Ep.MaxPacket;
+  if ((MaxPacket == 0) || (TransferLen >= Urb->DataLen)) {
+    return 0;
+  }
+
+  Packets = (Urb->DataLen + MaxPacket - 1) / MaxPacket - TransferLen / MaxPacket;
+  return (UINT32)MIN (Packets, 31);
+}
+
 /**
   Create a transfer TRB.
 
@@ -233,6 +261,7 @@ XhcCreateTransferTrb (
   EFI_PHYSICAL_ADDRESS           PhyAddr;
   VOID                           *Map;
   EFI_STATUS                     Status;
+  LINK_TRB                       *LinkTrb;
 
   SlotId = XhcBusDevAddrToSlotId (Xhc, Urb->Ep.BusAddr);
   if (SlotId == 0) {
@@ -386,38 +415,61 @@ XhcCreateTransferTrb (
 
     case ED_BULK_OUT:
     case ED_BULK_IN:
+      //
+      // Build the whole bulk transfer as a single TD of chained Normal TRBs.
+      // Only the last TRB interrupts on completion; a short packet on any of
+      // them ends the TD and is reported through its ISP flag, so a large
+      // transfer costs one transfer event instead of one per 64KB.
+      //
       TotalLen = 0;
       Len      = 0;
       TrbNum   = 0;
       TrbStart = (TRB *)(UINTN)EPRing->RingEnqueue;
       while (TotalLen < Urb->DataLen) {
-        if ((TotalLen + 0x10000) >= Urb->DataLen) {
-          Len = Urb->DataLen - TotalLen;
-        } else {
-          Len = 0x10000;
-        }
+        //
+        // A TRB data buffer shall not span a 64KB boundary.
+        //
+        PhyAddr = (EFI_PHYSICAL_ADDRESS)(UINTN)Urb->DataPhy + TotalLen;
+        Len     = MIN (Urb->DataLen - TotalLen, (UINTN)(0x10000 - (PhyAddr & 0xFFFF)));
 
         TrbStart                      = (TRB *)(UINTN)EPRing->RingEnqueue;
-        TrbStart->TrbNormal.TRBPtrLo  = XHC_LOW_32BIT ((UINT8 *)Urb->DataPhy + TotalLen);
-        TrbStart->TrbNormal.TRBPtrHi  = XHC_HIGH_32BIT ((UINT8 *)Urb->DataPhy + TotalLen);
+        TrbStart->TrbNormal.TRBPtrLo  = XHC_LOW_32BIT (PhyAddr);
+        TrbStart->TrbNormal.TRBPtrHi  = XHC_HIGH_32BIT (PhyAddr);
         TrbStart->TrbNormal.Length    = (UINT32)Len;
-        TrbStart->TrbNormal.TDSize    = 0;
+        TrbStart->TrbNormal.TDSize    = XhcTdSize (Urb, TotalLen + Len);
         TrbStart->TrbNormal.IntTarget = 0;
         TrbStart->TrbNormal.ISP       = 1;
-        TrbStart->TrbNormal.IOC       = 1;
         TrbStart->TrbNormal.Type      = TRB_TYPE_NORMAL;
+        if ((TotalLen + Len) < Urb->DataLen) {
+          TrbStart->TrbNormal.CH = 1;
+        } else {
+          TrbStart->TrbNormal.IOC = 1;
+        }
+
         //
         // Update the cycle bit
         //
         TrbStart->TrbNormal.CycleBit = EPRing->RingPCS & BIT0;
 
+        //
+        // A Link TRB inside a TD shall have its chain flag set as well.
+        //
+        LinkTrb = (LINK_TRB *)((TRB_TEMPLATE *)TrbStart + 1);
+        if (LinkTrb->Type == TRB_TYPE_LINK) {
+          LinkTrb->CH = TrbStart->TrbNormal.CH;
+        }
+
         XhcSyncTrsRing (Xhc, EPRing);
         TrbNum++;
         TotalLen += Len;
       }
 
-      Urb->TrbNum = TrbNum;
-      Urb->TrbEnd = (TRB_TEMPLATE *)(UINTN)TrbStart;
+      //
+      // No event is generated for the first TRB of a chained TD.
+      //
+      Urb->StartDone = TRUE;
+      Urb->TrbNum    = TrbNum;
+      Urb->TrbEnd    = (TRB_TEMPLATE *)(UINTN)TrbStart;
       break;
 
     case ED_INTERRUPT_OUT:
@@ -1114,11 +1166,13 @@ XhcCheckUrbResult (
   UINT32                High;
   UINT32                Low;
   EFI_PHYSICAL_ADDRESS  PhyAddr;
+  TRB_TEMPLATE          *EvtDequeue;
 
   ASSERT ((Xhc != NULL) && (Urb != NULL));
 
-  Status   = EFI_SUCCESS;
-  AsyncUrb = NULL;
+  Status     = EFI_SUCCESS;
+  AsyncUrb   = NULL;
+  EvtDequeue = Xhc->EventRing.EventRingDequeue;
 
   if (Urb->Finished) {
     goto EXIT;
@@ -1218,9 +1272,21 @@ XhcCheckUrbResult (
         }
 
         TRBType = (UINT8)(TRBPtr->Type);
-        if ((TRBType == TRB_TYPE_DATA_STAGE) ||
-            (TRBType == TRB_TYPE_NORMAL) ||
-            (TRBType == TRB_TYPE_ISOCH))
+        if ((TRBType == TRB_TYPE_NORMAL) && (CheckedUrb->Ep.Type == XHC_BULK_TRANSFER)) {
+          //
+          // A bulk URB is a single chained TD which reports the last TRB only,
+          // or the TRB a short packet ended the TD on. Everything before
+          // that TRB has been transferred.
+          //
+          PhyAddr                = (EFI_PHYSICAL_ADDRESS)(((TRANSFER_TRB_NORMAL *)TRBPtr)->TRBPtrLo | LShiftU64 ((UINT64)((TRANSFER_TRB_NORMAL *)TRBPtr)->TRBPtrHi, 32));
+          CheckedUrb->Completed  = (UINTN)(PhyAddr - (EFI_PHYSICAL_ADDRESS)(UINTN)CheckedUrb->DataPhy);
+          CheckedUrb->Completed += (((TRANSFER_TRB_NORMAL *)TRBPtr)->Length - EvtTrb->Length);
+          if (((TRANSFER_TRB_NORMAL *)TRBPtr)->CH != 0) {
+            CheckedUrb->EndDone = TRUE;
+          }
+        } else if ((TRBType == TRB_TYPE_DATA_STAGE) ||
+                   (TRBType == TRB_TYPE_NORMAL) ||
+                   (TRBType == TRB_TYPE_ISOCH))
         {
           CheckedUrb->Completed += (((TRANSFER_TRB_NORMAL *)TRBPtr)->Length - EvtTrb->Length);
         }
@@ -1253,6 +1319,14 @@ XhcCheckUrbResult (
 
 EXIT:
 
+  //
+  // Nothing to tell the controller if no event has been consumed, which is
+  // the common case while polling for a transfer to finish.
+  //
+  if (Xhc->EventRing.EventRingDequeue == EvtDequeue) {
+    return Urb->Finished;
+  }
+
   //
   // Advance event ring to last available entry
   //
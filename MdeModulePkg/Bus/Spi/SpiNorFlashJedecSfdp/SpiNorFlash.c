@@ -510,6 +510,15 @@ LfReadData (
   Instance             = SPI_NOR_FLASH_FROM_THIS (This);
   MaximumTransferBytes = Instance->SpiIo->MaximumTransferBytes;
 
+  //
+  // Check not WIP. A read does not start a write, so the status is only
+  // polled once before the read transactions.
+  //
+  Status = WaitNotWip (Instance, FixedPcdGet32 (PcdSpiNorFlashOperationDelayMicroseconds), FixedPcdGet32 (PcdSpiNorFlashFixedTimeoutRetryCount));
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
   CurrentBuffer = Buffer;
   Length        = 0;
   for (ByteCounter = 0; ByteCounter < LengthInBytes;) {
@@ -521,12 +530,6 @@ LfReadData (
       Length = MaximumTransferBytes;
     }
 
-    // Check not WIP
-    Status = WaitNotWip (Instance, FixedPcdGet32 (PcdSpiNorFlashOperationDelayMicroseconds), FixedPcdGet32 (PcdSpiNorFlashFixedTimeoutRetryCount));
-    if (EFI_ERROR (Status)) {
-      break;
-    }
-
     TransactionBufferLength = FillWriteBuffer (
                                 Instance,
                                 SPI_FLASH_READ,
@@ -642,6 +645,15 @@ ReadData (
   DEBUG ((DEBUG_VERBOSE, "     Supported erase address bytes by device: 0x%02x.\n", Instance->SfdpBasicFlash->AddressBytes));
   DEBUG ((DEBUG_VERBOSE, "        (00: 3-Byte, 01: 3 or 4-Byte. 10: 4-Byte)\n"));
 
+  //
+  // Check not WIP. A read does not start a write, so the status is only
+  // polled once before the read transactions.
+  //
+  Status = WaitNotWip (Instance, FixedPcdGet32 (PcdSpiNorFlashOperationDelayMicroseconds), FixedPcdGet32 (PcdSpiNorFlashFixedTimeoutRetryCount));
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
   CurrentBuffer = Buffer;
   Length        = 0;
   for (ByteCounter = 0; ByteCounter < LengthInBytes;) {
@@ -653,12 +665,6 @@ ReadData (
       Length = MaximumTransferBytes;
     }
 
-    // Check not WIP
-    Status = WaitNotWip (Instance, FixedPcdGet32 (PcdSpiNorFlashOperationDelayMicroseconds), FixedPcdGet32 (PcdSpiNorFlashFixedTimeoutRetryCount));
-    if (EFI_ERROR (Status)) {
-      break;
-    }
-
     TransactionBufferLength = FillWriteBuffer (
                                 Instance,
                                 FastReadInstruction,
@@ -67,7 +67,8 @@ UFS_PASS_THRU_PRIVATE_DATA  gUfsPassThruTemplate = {
   {                               // Queue
     NULL,
     NULL
-  }
+  },
+  0                               // QueuedSlotsMap
 };
 
 EFI_DRIVER_BINDING_PROTOCOL  gUfsPassThruDriverBinding = {
@@ -75,6 +75,12 @@ typedef struct _UFS_PASS_THRU_PRIVATE_DATA {
   //
   EFI_EVENT                             TimerEvent;
   LIST_ENTRY                            Queue;
+  //
+  // Slots of the transfer request list owned by the requests in Queue. The
+  // doorbell of a slot is cleared as soon as its request completes, so the
+  // slot must not be reused until the timer has retrieved the response.
+  //
+  UINT32                                QueuedSlotsMap;
 } UFS_PASS_THRU_PRIVATE_DATA;
 
 #define UFS_PASS_THRU_TRANS_REQ_SIG  SIGNATURE_32 ('U', 'F', 'S', 'T')
@@ -732,6 +732,11 @@ UfsFindAvailableSlotInTrl (
     return Status;
   }
 
+  //
+  // The slots of the queued async requests stay busy until they are reaped.
+  //
+  Data |= Private->QueuedSlotsMap;
+
   Nutrs = (UINT8)((Private->UfsHcInfo.Capabilities & UFS_HC_CAP_NUTRS) + 1);
 
   for (Index = 0; Index < Nutrs; Index++) {
@@ -1550,8 +1555,9 @@ UfsExecScsiCmds (
   // Insert the async SCSI cmd to the Async I/O list
   //
   if (Event != NULL) {
-    OldTpl                = gBS->RaiseTPL (TPL_NOTIFY);
-    TransReq->CallerEvent = Event;
+    OldTpl                   = gBS->RaiseTPL (TPL_NOTIFY);
+    TransReq->CallerEvent    = Event;
+    Private->QueuedSlotsMap |= BIT0 << TransReq->Slot;
     InsertTailList (&Private->Queue, &TransReq->TransferList);
     gBS->RestoreTPL (OldTpl);
   }
@@ -2247,6 +2253,8 @@ SignalCallerEvent (
 
   UfsStopExecCmd (Private, TransReq->Slot);
 
+  Private->QueuedSlotsMap &= ~(UINT32)(BIT0 << TransReq->Slot);
+
   UfsReconcileDataTransferBuffer (Private, TransReq);
 
   if (TransReq->CmdDescMapping != NULL) {
@@ -2289,28 +2297,23 @@ ProcessAsyncTaskList (
   UTP_RESPONSE_UPIU                           *Response;
   UINT16                                      SenseDataLen;
   UINT32                                      ResTranCount;
-  UINT32                                      SlotsMap;
   UINT32                                      Value;
   EFI_STATUS                                  Status;
 
-  Private  = (UFS_PASS_THRU_PRIVATE_DATA *)Context;
-  SlotsMap = 0;
+  Private = (UFS_PASS_THRU_PRIVATE_DATA *)Context;
 
   //
-  // Check the entries in the async I/O queue are done or not.
+  // Check the entries in the async I/O queue are done or not. Each queued
+  // request owns its own slot, so a single read of the doorbell register
+  // tells which of them completed.
   //
   if (!IsListEmpty (&Private->Queue)) {
+    Status = UfsMmioRead32 (Private, UFS_HC_UTRLDBR_OFFSET, &Value);
+
     BASE_LIST_FOR_EACH_SAFE (Entry, NextEntry, &Private->Queue) {
       TransReq = UFS_PASS_THRU_TRANS_REQ_FROM_THIS (Entry);
       Packet   = TransReq->Packet;
 
-      if ((SlotsMap & (BIT0 << TransReq->Slot)) != 0) {
-        return;
-      }
-
-      SlotsMap |= BIT0 << TransReq->Slot;
-
-      Status = UfsMmioRead32 (Private, UFS_HC_UTRLDBR_OFFSET, &Value);
       if (EFI_ERROR (Status)) {
         //
         // TODO: Should find/add a proper host adapter return status for this
@@ -793,6 +793,33 @@ UsbBootDetectMedia (
   return Status;
 }
 
+/**
+  Get the maximum number of bytes a single read or write command carries.
+
+  @param  UsbMass                The USB mass storage device to access
+
+  @return The maximum number of bytes carried per command.
+
+**/
+UINT32
+UsbBootGetMaxCarrySize (
+  IN  USB_MASS_DEVICE  *UsbMass
+  )
+{
+  USB_BOT_PROTOCOL  *UsbBot;
+
+  if (UsbMass->Transport->Protocol == USB_MASS_STORE_BOT) {
+    UsbBot = (USB_BOT_PROTOCOL *)UsbMass->Context;
+    if ((UsbBot->BulkInEndpoint->MaxPacketSize >= USB_SUPER_SPEED_BULK_MAX_PACKET) &&
+        (UsbBot->BulkOutEndpoint->MaxPacketSize >= USB_SUPER_SPEED_BULK_MAX_PACKET))
+    {
+      return USB_BOOT_MAX_CARRY_SIZE_SUPER_SPEED;
+    }
+  }
+
+  return USB_BOOT_MAX_CARRY_SIZE;
+}
+
 /**
   Read or write some blocks from the device.
 
@@ -824,7 +851,7 @@ UsbBootReadWriteBlocks (
   UINT32                      Timeout;
 
   BlockSize = UsbMass->BlockIoMedia.BlockSize;
-  CountMax  = USB_BOOT_MAX_CARRY_SIZE / BlockSize;
+  CountMax  = UsbBootGetMaxCarrySize (UsbMass) / BlockSize;
   Status    = EFI_SUCCESS;
 
   while (TotalBlock > 0) {
@@ -910,7 +937,7 @@ UsbBootReadWriteBlocks16 (
   UINT32      Timeout;
 
   BlockSize = UsbMass->BlockIoMedia.BlockSize;
-  CountMax  = USB_BOOT_MAX_CARRY_SIZE / BlockSize;
+  CountMax  = UsbBootGetMaxCarrySize (UsbMass) / BlockSize;
   Status    = EFI_SUCCESS;
 
   while (TotalBlock > 0) {
@@ -63,6 +63,15 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 //
 #define USB_BOOT_MAX_CARRY_SIZE  SIZE_64KB
 
+//
+// Max carried size of a BOT device attached at SuperSpeed or faster, which
+// is recognized by a bulk endpoint max packet size of at least 1024 bytes.
+// Each command costs a CBW and a CSW round trip besides the data, so a
+// large carry size is what lets such devices reach their bandwidth.
+//
+#define USB_BOOT_MAX_CARRY_SIZE_SUPER_SPEED  SIZE_1MB
+#define USB_SUPER_SPEED_BULK_MAX_PACKET      1024
+
 //
 // Retry mass command times, set by experience
 //
@@ -275,6 +284,19 @@ UsbBootReadBlocks (
   OUT UINT8            *Buffer
   );
 
+/**
+  Get the maximum number of bytes a single read or write command carries.
+
+  @param  UsbMass                The USB mass storage device to access
+
+  @return The maximum number of bytes carried per command.
+
+**/
+UINT32
+UsbBootGetMaxCarrySize (
+  IN  USB_MASS_DEVICE  *UsbMass
+  );
+
 /**
   Read or write some blocks from the device.
 
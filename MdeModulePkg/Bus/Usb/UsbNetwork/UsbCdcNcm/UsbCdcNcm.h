@@ -32,8 +32,10 @@ typedef struct {
   EFI_MAC_ADDRESS                MacAddress;
   UINT16                         BulkOutSequence;
   UINT8                          *BulkBuffer;
-  UINT8                          TotalDatagram;
-  UINT8                          NowDatagram;
+  UINTN                          BulkDataLength;
+  UINT16                         NdpIndex;
+  UINT16                         TotalDatagram;
+  UINT16                         NowDatagram;
 } USB_ETHERNET_DRIVER;
 
 #define USB_NCM_DRIVER_VERSION         1
@@ -225,87 +225,104 @@ UsbEthNcmReceive (
   USB_ETHERNET_DRIVER          *UsbEthDriver;
   EFI_USB_IO_PROTOCOL          *UsbIo;
   UINT32                       TransStatus;
-  UINT8                        Index;
   UINTN                        BulkDataLength;
-  UINTN                        TotalLength;
+  UINT16                       NdpIndex;
   USB_NCM_TRANSFER_HEADER_16   *Nth;
   USB_NCM_DATAGRAM_POINTER_16  *Ndp;
   USB_NCM_DATA_GRAM            *Datagram;
 
   UsbEthDriver = USB_ETHERNET_DEV_FROM_THIS (This);
-  TotalLength  = 0;
-
-  if (UsbEthDriver->TotalDatagram == UsbEthDriver->NowDatagram) {
-    Status = gBS->HandleProtocol (
-                    UsbEthDriver->UsbCdcDataHandle,
-                    &gEfiUsbIoProtocolGuid,
-                    (VOID **)&UsbIo
-                    );
-    if (EFI_ERROR (Status)) {
-      return Status;
-    }
 
-    if (UsbEthDriver->BulkInEndpoint == 0) {
-      GetEndpoint (UsbIo, UsbEthDriver);
-    }
+  while (TRUE) {
+    if (UsbEthDriver->TotalDatagram == UsbEthDriver->NowDatagram) {
+      //
+      // All the datagrams of the current NDP are delivered. Move to the next
+      // NDP of the NTB, or receive a new NTB when there is none. Only forward
+      // links are followed so that a malformed NTB cannot loop.
+      //
+      NdpIndex = 0;
+      if (UsbEthDriver->NdpIndex != 0) {
+        Ndp = (USB_NCM_DATAGRAM_POINTER_16 *)(UsbEthDriver->BulkBuffer + UsbEthDriver->NdpIndex);
+        if (Ndp->NextNdpIndex > UsbEthDriver->NdpIndex) {
+          NdpIndex = Ndp->NextNdpIndex;
+        }
+      }
 
-    BulkDataLength = USB_NCM_MAX_NTB_SIZE;
-    SetMem (UsbEthDriver->BulkBuffer, BulkDataLength, 0);
-    UsbEthDriver->NowDatagram   = 0;
-    UsbEthDriver->TotalDatagram = 0;
-
-    Status = UsbIo->UsbBulkTransfer (
-                      UsbIo,
-                      UsbEthDriver->BulkInEndpoint,
-                      UsbEthDriver->BulkBuffer,
-                      &BulkDataLength,
-                      USB_ETHERNET_BULK_TIMEOUT,
-                      &TransStatus
-                      );
-    if (EFI_ERROR (Status)) {
-      return Status;
-    }
+      UsbEthDriver->NdpIndex      = 0;
+      UsbEthDriver->NowDatagram   = 0;
+      UsbEthDriver->TotalDatagram = 0;
+
+      if (NdpIndex == 0) {
+        Status = gBS->HandleProtocol (
+                        UsbEthDriver->UsbCdcDataHandle,
+                        &gEfiUsbIoProtocolGuid,
+                        (VOID **)&UsbIo
+                        );
+        if (EFI_ERROR (Status)) {
+          return Status;
+        }
 
-    Nth                         = (USB_NCM_TRANSFER_HEADER_16 *)UsbEthDriver->BulkBuffer;
-    Ndp                         = (USB_NCM_DATAGRAM_POINTER_16 *)((UINT8 *)UsbEthDriver->BulkBuffer + Nth->NdpIndex);
-    Datagram                    = (USB_NCM_DATA_GRAM *)((UINT8 *)Ndp + sizeof (USB_NCM_DATAGRAM_POINTER_16));
-    UsbEthDriver->TotalDatagram = (UINT8)((Ndp->Length - 8) / 4 - 1);
+        if (UsbEthDriver->BulkInEndpoint == 0) {
+          GetEndpoint (UsbIo, UsbEthDriver);
+        }
 
-    for (Index = 0; Index < UsbEthDriver->TotalDatagram; Index++) {
-      TotalLength += Datagram->DatagramLength;
-      Datagram     = (USB_NCM_DATA_GRAM *)((UINT8 *)Datagram + sizeof (USB_NCM_DATA_GRAM));
-    }
+        BulkDataLength = USB_NCM_MAX_NTB_SIZE;
+        Status         = UsbIo->UsbBulkTransfer (
+                                  UsbIo,
+                                  UsbEthDriver->BulkInEndpoint,
+                                  UsbEthDriver->BulkBuffer,
+                                  &BulkDataLength,
+                                  USB_ETHERNET_BULK_TIMEOUT,
+                                  &TransStatus
+                                  );
+        if (EFI_ERROR (Status)) {
+          return Status;
+        }
 
-    if (TotalLength < USB_ETHERNET_FRAME_SIZE) {
-      Datagram = (USB_NCM_DATA_GRAM *)((UINT8 *)Ndp + sizeof (USB_NCM_DATAGRAM_POINTER_16));
+        Nth = (USB_NCM_TRANSFER_HEADER_16 *)UsbEthDriver->BulkBuffer;
+        if ((BulkDataLength < sizeof (USB_NCM_TRANSFER_HEADER_16)) || (Nth->Signature != USB_NCM_NTH_SIGN_16)) {
+          return EFI_DEVICE_ERROR;
+        }
 
-      TotalLength = 0;
-      for (Index = 0; Index < UsbEthDriver->TotalDatagram; Index++) {
-        CopyMem ((UINT8 *)Packet + TotalLength, (UINT8 *)UsbEthDriver->BulkBuffer + Datagram->DatagramIndex, Datagram->DatagramLength);
-        TotalLength += Datagram->DatagramLength;
-        Datagram     = (USB_NCM_DATA_GRAM *)((UINT8 *)Datagram + sizeof (USB_NCM_DATA_GRAM));
+        UsbEthDriver->BulkDataLength = BulkDataLength;
+        NdpIndex                     = Nth->NdpIndex;
       }
 
-      *PacketLength             = TotalLength;
-      UsbEthDriver->NowDatagram = UsbEthDriver->TotalDatagram;
-    } else {
-      UsbEthDriver->NowDatagram++;
+      Ndp = (USB_NCM_DATAGRAM_POINTER_16 *)(UsbEthDriver->BulkBuffer + NdpIndex);
+      if ((NdpIndex < sizeof (USB_NCM_TRANSFER_HEADER_16)) ||
+          ((UINTN)NdpIndex + sizeof (USB_NCM_DATAGRAM_POINTER_16) > UsbEthDriver->BulkDataLength) ||
+          (Ndp->Length < USB_NCM_NDP_LENGTH) ||
+          ((UINTN)NdpIndex + Ndp->Length > UsbEthDriver->BulkDataLength))
+      {
+        return EFI_DEVICE_ERROR;
+      }
 
-      Datagram = (USB_NCM_DATA_GRAM *)((UINT8 *)Ndp + sizeof (USB_NCM_DATAGRAM_POINTER_16));
-      CopyMem (Packet, (UINT8 *)UsbEthDriver->BulkBuffer + Datagram->DatagramIndex, Datagram->DatagramLength);
-      *PacketLength = Datagram->DatagramLength;
+      UsbEthDriver->NdpIndex      = NdpIndex;
+      UsbEthDriver->TotalDatagram = (UINT16)((Ndp->Length - sizeof (USB_NCM_DATAGRAM_POINTER_16)) / sizeof (USB_NCM_DATA_GRAM));
     }
 
-    return Status;
-  } else {
+    //
+    // Deliver the datagrams of the NTB one by one, each as its own frame.
+    //
+    Ndp      = (USB_NCM_DATAGRAM_POINTER_16 *)(UsbEthDriver->BulkBuffer + UsbEthDriver->NdpIndex);
+    Datagram = (USB_NCM_DATA_GRAM *)((UINT8 *)Ndp + sizeof (USB_NCM_DATAGRAM_POINTER_16)) + UsbEthDriver->NowDatagram;
     UsbEthDriver->NowDatagram++;
 
-    Nth      = (USB_NCM_TRANSFER_HEADER_16 *)UsbEthDriver->BulkBuffer;
-    Ndp      = (USB_NCM_DATAGRAM_POINTER_16 *)((UINT8 *)UsbEthDriver->BulkBuffer + Nth->NdpIndex);
-    Datagram = (USB_NCM_DATA_GRAM *)((UINT8 *)Ndp + sizeof (USB_NCM_DATAGRAM_POINTER_16));
-    Datagram = (USB_NCM_DATA_GRAM *)((UINT8 *)Datagram + sizeof (USB_NCM_DATA_GRAM) * (UsbEthDriver->NowDatagram - 1));
+    if ((Datagram->DatagramIndex == 0) || (Datagram->DatagramLength == 0)) {
+      //
+      // The null entry terminates the datagram list of the NDP.
+      //
+      UsbEthDriver->NowDatagram = UsbEthDriver->TotalDatagram;
+      continue;
+    }
+
+    if (((UINTN)Datagram->DatagramIndex + Datagram->DatagramLength > UsbEthDriver->BulkDataLength) ||
+        (Datagram->DatagramLength > *PacketLength))
+    {
+      continue;
+    }
 
-    CopyMem (Packet, (UINT8 *)UsbEthDriver->BulkBuffer + Datagram->DatagramIndex, Datagram->DatagramLength);
+    CopyMem (Packet, UsbEthDriver->BulkBuffer + Datagram->DatagramIndex, Datagram->DatagramLength);
     *PacketLength = Datagram->DatagramLength;
 
     return EFI_SUCCESS;
@@ -241,7 +241,8 @@ CoreGetDepexSectionAndPreProccess (
   UINT32                         AuthenticationStatus;
   EFI_FIRMWARE_VOLUME2_PROTOCOL  *Fv;
 
-  Fv = DriverEntry->Fv;
+  Fv                            = DriverEntry->Fv;
+  DriverEntry->DepexUnsatisfied = FALSE;
 
   //
   // Grab Depex info, it will never be free'ed.
@@ -552,9 +553,22 @@ CoreDispatcher (
       }
 
       if (DriverEntry->Dependent) {
+        if (DriverEntry->DepexUnsatisfied &&
+            (DriverEntry->DepexGeneration == gProtocolDatabaseGeneration))
+        {
+          //
+          // No protocol has come or gone since the Depex evaluated to FALSE
+          //
+          continue;
+        }
+
         if (CoreIsSchedulable (DriverEntry)) {
+          DriverEntry->DepexUnsatisfied = FALSE;
           CoreInsertOnScheduledQueueWhileProcessingBeforeAndAfter (DriverEntry);
           ReadyToRun = TRUE;
+        } else {
+          DriverEntry->DepexUnsatisfied = TRUE;
+          DriverEntry->DepexGeneration  = gProtocolDatabaseGeneration;
         }
       } else {
         if (DriverEntry->Unrequested) {
@@ -991,6 +1005,97 @@ GetFvUsedSize (
   return FALSE;
 }
 
+/**
+  Read a firmware volume image section straight into a buffer that meets the
+  alignment required by the firmware volume header.
+
+  Only the volume header is read first, which returns the size of the section
+  and the required alignment. The whole section is then read into aligned
+  pages, so the volume does not need to be read into pool and copied again.
+
+  @param  Fv                    The FIRMWARE_VOLUME protocol installed on the FV.
+  @param  FileName              The file name guid specified.
+  @param  SectionInstance       The instance of the firmware volume image section.
+  @param  AlignedBuffer         Returns the buffer allocated by AllocateAlignedPages().
+  @param  BufferSize            Returns the size of the firmware volume image.
+  @param  AuthenticationStatus  Returns the authentication status of the section.
+
+  @retval EFI_SUCCESS           The firmware volume image was read into AlignedBuffer.
+  @retval Others                The firmware volume image was not read.
+
+**/
+STATIC
+EFI_STATUS
+CoreReadAlignedFvImageSection (
+  IN  EFI_FIRMWARE_VOLUME2_PROTOCOL  *Fv,
+  IN  EFI_GUID                       *FileName,
+  IN  UINTN                          SectionInstance,
+  OUT VOID                           **AlignedBuffer,
+  OUT UINTN                          *BufferSize,
+  OUT UINT32                         *AuthenticationStatus
+  )
+{
+  EFI_STATUS                  Status;
+  EFI_FIRMWARE_VOLUME_HEADER  FvHeader;
+  VOID                        *HeaderBuffer;
+  UINTN                       HeaderSize;
+  UINT32                      FvAlignment;
+
+  *AlignedBuffer = NULL;
+  HeaderBuffer   = &FvHeader;
+  HeaderSize     = sizeof (FvHeader);
+  Status         = Fv->ReadSection (
+                         Fv,
+                         FileName,
+                         EFI_SECTION_FIRMWARE_VOLUME_IMAGE,
+                         SectionInstance,
+                         &HeaderBuffer,
+                         &HeaderSize,
+                         AuthenticationStatus
+                         );
+  if (Status != EFI_WARN_BUFFER_TOO_SMALL) {
+    //
+    // The section does not exist or is no larger than a volume header
+    //
+    return EFI_ERROR (Status) ? Status : EFI_UNSUPPORTED;
+  }
+
+  //
+  // A weakly aligned volume is left to the caller, which keeps it in place.
+  //
+  if ((ReadUnaligned32 (&FvHeader.Attributes) & EFI_FVB2_WEAK_ALIGNMENT) == EFI_FVB2_WEAK_ALIGNMENT) {
+    return EFI_UNSUPPORTED;
+  }
+
+  FvAlignment = 1 << ((ReadUnaligned32 (&FvHeader.Attributes) & EFI_FVB2_ALIGNMENT) >> 16);
+  if (FvAlignment < 8) {
+    FvAlignment = 8;
+  }
+
+  *AlignedBuffer = AllocateAlignedPages (EFI_SIZE_TO_PAGES (HeaderSize), (UINTN)FvAlignment);
+  if (*AlignedBuffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  *BufferSize = HeaderSize;
+  Status      = Fv->ReadSection (
+                      Fv,
+                      FileName,
+                      EFI_SECTION_FIRMWARE_VOLUME_IMAGE,
+                      SectionInstance,
+                      AlignedBuffer,
+                      BufferSize,
+                      AuthenticationStatus
+                      );
+  if (Status != EFI_SUCCESS) {
+    FreeAlignedPages (*AlignedBuffer, EFI_SIZE_TO_PAGES (HeaderSize));
+    *AlignedBuffer = NULL;
+    return EFI_ERROR (Status) ? Status : EFI_UNSUPPORTED;
+  }
+
+  return EFI_SUCCESS;
+}
+
 /**
   Get Fv image(s) from the FV through file name, and produce FVB protocol for every Fv image(s).
 
@@ -1034,15 +1139,26 @@ CoreProcessFvImageFile (
     Buffer        = NULL;
     BufferSize    = 0;
     AlignedBuffer = NULL;
-    Status        = Fv->ReadSection (
-                          Fv,
-                          FileName,
-                          SectionType,
-                          Index,
-                          &Buffer,
-                          &BufferSize,
-                          &AuthenticationStatus
-                          );
+    Status        = CoreReadAlignedFvImageSection (
+                      Fv,
+                      FileName,
+                      Index,
+                      &AlignedBuffer,
+                      &BufferSize,
+                      &AuthenticationStatus
+                      );
+    if (EFI_ERROR (Status)) {
+      Status = Fv->ReadSection (
+                     Fv,
+                     FileName,
+                     SectionType,
+                     Index,
+                     &Buffer,
+                     &BufferSize,
+                     &AuthenticationStatus
+                     );
+    }
+
     if (!EFI_ERROR (Status)) {
       //
       // Evaluate the authentication status of the Firmware Volume through
@@ -1067,20 +1183,28 @@ CoreProcessFvImageFile (
             FreePool (Buffer);
           }
 
+          if (AlignedBuffer != NULL) {
+            FreeAlignedPages (AlignedBuffer, EFI_SIZE_TO_PAGES (BufferSize));
+          }
+
           break;
         }
       }
 
       //
       // FvImage should be at its required alignment.
+      // CoreReadAlignedFvImageSection() has already taken care of it when
+      // AlignedBuffer is returned.
       //
-      FvHeader = (EFI_FIRMWARE_VOLUME_HEADER *)Buffer;
+      FvHeader = (EFI_FIRMWARE_VOLUME_HEADER *)((AlignedBuffer != NULL) ? AlignedBuffer : Buffer);
       //
       // If EFI_FVB2_WEAK_ALIGNMENT is set in the volume header then the first byte of the volume
       // can be aligned on any power-of-two boundary. A weakly aligned volume can not be moved from
       // its initial linked location and maintain its alignment.
       //
-      if ((ReadUnaligned32 (&FvHeader->Attributes) & EFI_FVB2_WEAK_ALIGNMENT) != EFI_FVB2_WEAK_ALIGNMENT) {
+      if ((AlignedBuffer == NULL) &&
+          ((ReadUnaligned32 (&FvHeader->Attributes) & EFI_FVB2_WEAK_ALIGNMENT) != EFI_FVB2_WEAK_ALIGNMENT))
+      {
         //
         // Get FvHeader alignment
         //
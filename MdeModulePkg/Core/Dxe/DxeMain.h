@@ -45,10 +45,12 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Protocol/HiiPackageList.h>
 #include <Protocol/SmmBase2.h>
 #include <Protocol/PeCoffImageEmulator.h>
+#include <Protocol/MemoryAccept.h>
 #include <Guid/MemoryTypeInformation.h>
 #include <Guid/FirmwareFileSystem2.h>
 #include <Guid/FirmwareFileSystem3.h>
 #include <Guid/HobList.h>
+#include <Guid/HobListIndex.h>
 #include <Guid/DebugImageInfoTable.h>
 #include <Guid/FileInfo.h>
 #include <Guid/Apriori.h>
@@ -84,6 +86,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/DxeServicesLib.h>
 #include <Library/DebugAgentLib.h>
 #include <Library/CpuExceptionHandlerLib.h>
+#include <Library/OrderedCollectionLib.h>
 
 //
 // attributes for reserved memory before it is promoted to system memory
@@ -160,6 +163,14 @@ typedef struct {
 
   EFI_HANDLE                       ImageHandle;
   BOOLEAN                          IsFvImage;
+
+  ///
+  /// TRUE if Depex evaluated to FALSE while the protocol database was at
+  /// DepexGeneration, so it does not need to be evaluated again until the
+  /// protocol database changes.
+  ///
+  BOOLEAN                          DepexUnsatisfied;
+  UINT64                           DepexGeneration;
 } EFI_CORE_DRIVER_ENTRY;
 
 //
@@ -249,6 +260,7 @@ extern EFI_SECURITY_ARCH_PROTOCOL        *gSecurity;
 extern EFI_SECURITY2_ARCH_PROTOCOL       *gSecurity2;
 extern EFI_BDS_ARCH_PROTOCOL             *gBds;
 extern EFI_SMM_BASE2_PROTOCOL            *gSmmBase2;
+extern EDKII_MEMORY_ACCEPT_PROTOCOL      *gMemoryAccept;
 
 extern EFI_TPL  gEfiCurrentTpl;
 
@@ -258,6 +270,7 @@ extern EFI_LOADED_IMAGE_PROTOCOL  *gDxeCoreLoadedImage;
 extern EFI_MEMORY_TYPE_INFORMATION  gMemoryTypeInformation[EfiMaxMemoryType + 1];
 
 extern BOOLEAN                    gDispatcherRunning;
+extern UINT64                     gProtocolDatabaseGeneration;
 extern EFI_RUNTIME_ARCH_PROTOCOL  gRuntimeTemplate;
 
 extern BOOLEAN  gMemoryAttributesTableForwardCfi;
@@ -549,6 +562,19 @@ CoreInstallConfigurationTable (
   IN VOID      *Table
   );
 
+/**
+  Build an index of the GUID HOBs of the HOB list, which maps every GUID to
+  the first GUID HOB with that GUID, and install it into the EFI System Table's
+  Configuration Table.
+
+  @param  HobStart      The first HOB of the HOB list.
+
+**/
+VOID
+CoreInstallHobListIndex (
+  IN VOID  *HobStart
+  );
+
 /**
   Raise the task priority level to the new level.
   High level is implemented by disabling processor interrupts.
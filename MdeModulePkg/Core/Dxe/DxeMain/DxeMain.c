@@ -27,7 +27,8 @@ EFI_WATCHDOG_TIMER_ARCH_PROTOCOL  *gWatchdogTimer = NULL;
 //
 // DXE Core globals for optional protocol dependencies
 //
-EFI_SMM_BASE2_PROTOCOL  *gSmmBase2 = NULL;
+EFI_SMM_BASE2_PROTOCOL        *gSmmBase2     = NULL;
+EDKII_MEMORY_ACCEPT_PROTOCOL  *gMemoryAccept = NULL;
 
 //
 // DXE Core Global used to update core loaded image protocol handle
@@ -353,6 +354,14 @@ DxeMain (
   Status = CoreInstallConfigurationTable (&gEfiHobListGuid, HobStart);
   ASSERT_EFI_ERROR (Status);
 
+  //
+  // Install the index of the GUID HOBs, which the HOB library of the DXE
+  // drivers finds GUID HOBs with.
+  //
+  if (FeaturePcdGet (PcdHobListIndexEnable)) {
+    CoreInstallHobListIndex (HobStart);
+  }
+
   //
   // Install Memory Type Information Table into the EFI System Tables's Configuration Table
   //
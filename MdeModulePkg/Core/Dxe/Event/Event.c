@@ -31,9 +31,14 @@ LIST_ENTRY  gEventQueue[TPL_HIGH_LEVEL + 1];
 UINTN  gEventPending = 0;
 
 ///
-/// gEventSignalQueue - A list of events to signal based on EventGroup type
+/// gEventSignalQueue - The lists of events to signal based on EventGroup type,
+/// hashed by EventGroup so that signaling a group does not have to compare the
+/// GUID of every notify-signal event. The lists are initialized when they are
+/// first used, as events may be created before CoreInitializeEventServices().
 ///
-LIST_ENTRY  gEventSignalQueue = INITIALIZE_LIST_HEAD_VARIABLE (gEventSignalQueue);
+#define EVENT_SIGNAL_QUEUE_HASH_SIZE  32
+
+LIST_ENTRY  gEventSignalQueue[EVENT_SIGNAL_QUEUE_HASH_SIZE];
 
 ///
 /// Enumerate the valid types
@@ -228,6 +233,33 @@ CoreNotifyEvent (
   gEventPending |= (UINTN)(1 << Event->NotifyTpl);
 }
 
+/**
+  Returns the list of the events to signal for an EventGroup.
+
+  @param  EventGroup             The GUID of the event group
+
+  @return The list head of the hash bucket of EventGroup.
+
+**/
+LIST_ENTRY *
+CoreGetEventSignalQueue (
+  IN CONST EFI_GUID  *EventGroup
+  )
+{
+  LIST_ENTRY  *Head;
+
+  Head = &gEventSignalQueue[
+                            (ReadUnaligned32 ((CONST UINT32 *)EventGroup) ^
+                             ReadUnaligned32 ((CONST UINT32 *)&EventGroup->Data4[4])) &
+                            (EVENT_SIGNAL_QUEUE_HASH_SIZE - 1)
+         ];
+  if (Head->ForwardLink == NULL) {
+    InitializeListHead (Head);
+  }
+
+  return Head;
+}
+
 /**
   Signals all events in the EventGroup.
 
@@ -245,7 +277,7 @@ CoreNotifySignalList (
 
   CoreAcquireEventLock ();
 
-  Head = &gEventSignalQueue;
+  Head = CoreGetEventSignalQueue (EventGroup);
   for (Link = Head->ForwardLink; Link != Head; Link = Link->ForwardLink) {
     Event = CR (Link, IEVENT, SignalLink, EVENT_SIGNATURE);
     if (CompareGuid (&Event->EventGroup, EventGroup)) {
@@ -489,7 +521,7 @@ CoreCreateEventInternal (
     //
     // The Event's NotifyFunction must be queued whenever the event is signaled
     //
-    InsertHeadList (&gEventSignalQueue, &IEvent->SignalLink);
+    InsertHeadList (CoreGetEventSignalQueue (&IEvent->EventGroup), &IEvent->SignalLink);
   }
 
   CoreReleaseEventLock ();
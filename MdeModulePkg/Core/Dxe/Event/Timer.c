@@ -38,6 +38,7 @@ CoreInsertEventTimer (
 {
   UINT64      TriggerTime;
   LIST_ENTRY  *Link;
+  LIST_ENTRY  *BackLink;
   IEVENT      *Event2;
 
   ASSERT_LOCKED (&mEfiTimerLock);
@@ -48,14 +49,27 @@ CoreInsertEventTimer (
   TriggerTime = Event->Timer.TriggerTime;
 
   //
-  // Insert the timer into the timer database in assending sorted order
+  // Insert the timer into the timer database in assending sorted order.
+  // The database is searched from both ends at once, so that a short timer
+  // near the head and a periodic timer re-armed near the tail are both
+  // inserted in a few steps.
   //
+  BackLink = mEfiTimerList.BackLink;
   for (Link = mEfiTimerList.ForwardLink; Link != &mEfiTimerList; Link = Link->ForwardLink) {
     Event2 = CR (Link, IEVENT, Timer.Link, EVENT_SIGNATURE);
 
     if (Event2->Timer.TriggerTime > TriggerTime) {
       break;
     }
+
+    Event2 = CR (BackLink, IEVENT, Timer.Link, EVENT_SIGNATURE);
+
+    if (Event2->Timer.TriggerTime <= TriggerTime) {
+      Link = BackLink->ForwardLink;
+      break;
+    }
+
+    BackLink = BackLink->BackLink;
   }
 
   InsertTailList (Link, &Event->Timer.Link);
@@ -45,6 +45,13 @@ EFI_LOCK    mGcdIoSpaceLock     = EFI_INITIALIZE_LOCK_VARIABLE (TPL_NOTIFY);
 LIST_ENTRY  mGcdMemorySpaceMap  = INITIALIZE_LIST_HEAD_VARIABLE (mGcdMemorySpaceMap);
 LIST_ENTRY  mGcdIoSpaceMap      = INITIALIZE_LIST_HEAD_VARIABLE (mGcdIoSpaceMap);
 
+//
+// The GCD map entries ordered by address, to find the entry that covers an
+// address in logarithmic time. A NULL tree falls back to walking the list.
+//
+ORDERED_COLLECTION  *mGcdMemorySpaceTree = NULL;
+ORDERED_COLLECTION  *mGcdIoSpaceTree     = NULL;
+
 EFI_GCD_MAP_ENTRY  mGcdMemorySpaceMapEntryTemplate = {
   EFI_GCD_MAP_SIGNATURE,
   {
@@ -375,6 +382,188 @@ PageAlignLength (
 // GCD Memory Space Worker Functions
 //
 
+/**
+  Compare two GCD map entries by their base address.
+
+  @param  UserStruct1            A pointer to a GCD map entry.
+  @param  UserStruct2            A pointer to another GCD map entry.
+
+  @retval <0                     UserStruct1 is below UserStruct2.
+  @retval  0                     Both entries have the same base address.
+  @retval >0                     UserStruct1 is above UserStruct2.
+
+**/
+INTN
+EFIAPI
+CoreCompareGcdMapEntry (
+  IN CONST VOID  *UserStruct1,
+  IN CONST VOID  *UserStruct2
+  )
+{
+  CONST EFI_GCD_MAP_ENTRY  *Entry1;
+  CONST EFI_GCD_MAP_ENTRY  *Entry2;
+
+  Entry1 = UserStruct1;
+  Entry2 = UserStruct2;
+
+  if (Entry1->BaseAddress < Entry2->BaseAddress) {
+    return -1;
+  }
+
+  return (Entry1->BaseAddress > Entry2->BaseAddress) ? 1 : 0;
+}
+
+/**
+  Compare an address with the range of a GCD map entry. As the entries do not
+  overlap, this finds the entry that covers the address.
+
+  @param  StandaloneKey          A pointer to an EFI_PHYSICAL_ADDRESS.
+  @param  UserStruct             A pointer to a GCD map entry.
+
+  @retval <0                     The address is below the entry.
+  @retval  0                     The entry covers the address.
+  @retval >0                     The address is above the entry.
+
+**/
+INTN
+EFIAPI
+CoreCompareGcdMapKey (
+  IN CONST VOID  *StandaloneKey,
+  IN CONST VOID  *UserStruct
+  )
+{
+  CONST EFI_PHYSICAL_ADDRESS  *Address;
+  CONST EFI_GCD_MAP_ENTRY     *Entry;
+
+  Address = StandaloneKey;
+  Entry   = UserStruct;
+
+  if (*Address < Entry->BaseAddress) {
+    return -1;
+  }
+
+  return (*Address > Entry->EndAddress) ? 1 : 0;
+}
+
+/**
+  Return the ordered collection of a GCD map.
+
+  @param  Map                    The GCD map.
+
+  @return A pointer to the variable that holds the ordered collection.
+
+**/
+ORDERED_COLLECTION **
+CoreGetGcdMapTree (
+  IN LIST_ENTRY  *Map
+  )
+{
+  if (Map == &mGcdMemorySpaceMap) {
+    return &mGcdMemorySpaceTree;
+  }
+
+  ASSERT (Map == &mGcdIoSpaceMap);
+  return &mGcdIoSpaceTree;
+}
+
+/**
+  Release the ordered collection of a GCD map, so the GCD map is searched by
+  walking the list from now on.
+
+  @param  Map                    The GCD map.
+
+**/
+VOID
+CoreReleaseGcdMapTree (
+  IN LIST_ENTRY  *Map
+  )
+{
+  ORDERED_COLLECTION        **Tree;
+  ORDERED_COLLECTION_ENTRY  *TreeEntry;
+
+  Tree = CoreGetGcdMapTree (Map);
+  if (*Tree == NULL) {
+    return;
+  }
+
+  mOnGuarding = TRUE;
+  while ((TreeEntry = OrderedCollectionMin (*Tree)) != NULL) {
+    OrderedCollectionDelete (*Tree, TreeEntry, NULL);
+  }
+
+  OrderedCollectionUninit (*Tree);
+  mOnGuarding = FALSE;
+
+  *Tree = NULL;
+}
+
+/**
+  Add a GCD map entry, which has just been linked into the GCD map, to the
+  ordered collection of the GCD map.
+
+  @param  Map                    The GCD map.
+  @param  Entry                  The GCD map entry.
+
+**/
+VOID
+CoreAddGcdMapTreeEntry (
+  IN LIST_ENTRY         *Map,
+  IN EFI_GCD_MAP_ENTRY  *Entry
+  )
+{
+  ORDERED_COLLECTION  **Tree;
+  RETURN_STATUS       Status;
+
+  Tree = CoreGetGcdMapTree (Map);
+  if (*Tree == NULL) {
+    return;
+  }
+
+  mOnGuarding = TRUE;
+  Status      = OrderedCollectionInsert (*Tree, NULL, Entry);
+  mOnGuarding = FALSE;
+  if (RETURN_ERROR (Status)) {
+    ASSERT (Status == RETURN_OUT_OF_RESOURCES);
+    DEBUG ((DEBUG_WARN, "GCD: Fall back to searching the GCD map linearly - %r\n", Status));
+    CoreReleaseGcdMapTree (Map);
+  }
+}
+
+/**
+  Remove a GCD map entry from the ordered collection of the GCD map. This must
+  be done before the range of any entry next to the entry is changed to cover
+  the range of the entry.
+
+  @param  Map                    The GCD map.
+  @param  Entry                  The GCD map entry.
+
+**/
+VOID
+CoreRemoveGcdMapTreeEntry (
+  IN LIST_ENTRY         *Map,
+  IN EFI_GCD_MAP_ENTRY  *Entry
+  )
+{
+  ORDERED_COLLECTION        **Tree;
+  ORDERED_COLLECTION_ENTRY  *TreeEntry;
+
+  Tree = CoreGetGcdMapTree (Map);
+  if (*Tree == NULL) {
+    return;
+  }
+
+  TreeEntry = OrderedCollectionFind (*Tree, &Entry->BaseAddress);
+  ASSERT (TreeEntry != NULL && OrderedCollectionUserStruct (TreeEntry) == Entry);
+  if (TreeEntry == NULL) {
+    CoreReleaseGcdMapTree (Map);
+    return;
+  }
+
+  mOnGuarding = TRUE;
+  OrderedCollectionDelete (*Tree, TreeEntry, NULL);
+  mOnGuarding = FALSE;
+}
+
 /**
   Allocate pool for two entries.
 
@@ -424,6 +613,7 @@ CoreAllocateGcdMapEntry (
   @param  Length                 The length of the new range in bytes
   @param  TopEntry               Top pad entry to insert if needed.
   @param  BottomEntry            Bottom pad entry to insert if needed.
+  @param  Map                    The GCD map that the linked list belongs to.
 
   @retval EFI_SUCCESS            The new range was inserted into the linked list
 
@@ -435,7 +625,8 @@ CoreInsertGcdMapEntry (
   IN EFI_PHYSICAL_ADDRESS  BaseAddress,
   IN UINT64                Length,
   IN EFI_GCD_MAP_ENTRY     *TopEntry,
-  IN EFI_GCD_MAP_ENTRY     *BottomEntry
+  IN EFI_GCD_MAP_ENTRY     *BottomEntry,
+  IN LIST_ENTRY            *Map
   )
 {
   ASSERT (Length != 0);
@@ -447,6 +638,7 @@ CoreInsertGcdMapEntry (
     Entry->BaseAddress      = BaseAddress;
     BottomEntry->EndAddress = BaseAddress - 1;
     InsertTailList (Link, &BottomEntry->Link);
+    CoreAddGcdMapTreeEntry (Map, BottomEntry);
   }
 
   if ((BaseAddress + Length - 1) < Entry->EndAddress) {
@@ -456,6 +648,7 @@ CoreInsertGcdMapEntry (
     TopEntry->BaseAddress = BaseAddress + Length;
     Entry->EndAddress     = BaseAddress + Length - 1;
     InsertHeadList (Link, &TopEntry->Link);
+    CoreAddGcdMapTreeEntry (Map, TopEntry);
   }
 
   return EFI_SUCCESS;
@@ -527,6 +720,8 @@ CoreMergeGcdMapEntry (
     return EFI_UNSUPPORTED;
   }
 
+  CoreRemoveGcdMapTreeEntry (Map, AdjacentEntry);
+
   if (Forward) {
     Entry->EndAddress = AdjacentEntry->EndAddress;
   } else {
@@ -605,14 +800,38 @@ CoreSearchGcdMapEntry (
   IN  LIST_ENTRY            *Map
   )
 {
-  LIST_ENTRY         *Link;
-  EFI_GCD_MAP_ENTRY  *Entry;
+  LIST_ENTRY                *Link;
+  EFI_GCD_MAP_ENTRY         *Entry;
+  ORDERED_COLLECTION        *Tree;
+  ORDERED_COLLECTION_ENTRY  *StartTreeEntry;
+  ORDERED_COLLECTION_ENTRY  *EndTreeEntry;
+  EFI_PHYSICAL_ADDRESS      EndAddress;
 
   ASSERT (Length != 0);
 
   *StartLink = NULL;
   *EndLink   = NULL;
 
+  Tree = *CoreGetGcdMapTree (Map);
+  if (Tree != NULL) {
+    EndAddress = BaseAddress + Length - 1;
+    if (EndAddress < BaseAddress) {
+      return EFI_NOT_FOUND;
+    }
+
+    StartTreeEntry = OrderedCollectionFind (Tree, &BaseAddress);
+    EndTreeEntry   = OrderedCollectionFind (Tree, &EndAddress);
+    if ((StartTreeEntry == NULL) || (EndTreeEntry == NULL)) {
+      return EFI_NOT_FOUND;
+    }
+
+    Entry      = OrderedCollectionUserStruct (StartTreeEntry);
+    *StartLink = &Entry->Link;
+    Entry      = OrderedCollectionUserStruct (EndTreeEntry);
+    *EndLink   = &Entry->Link;
+    return EFI_SUCCESS;
+  }
+
   Link = Map->ForwardLink;
   while (Link != Map) {
     Entry = CR (Link, EFI_GCD_MAP_ENTRY, Link, EFI_GCD_MAP_SIGNATURE);
@@ -935,7 +1154,7 @@ CoreConvertSpace (
   Link = StartLink;
   while (Link != EndLink->ForwardLink) {
     Entry = CR (Link, EFI_GCD_MAP_ENTRY, Link, EFI_GCD_MAP_SIGNATURE);
-    CoreInsertGcdMapEntry (Link, Entry, BaseAddress, Length, TopEntry, BottomEntry);
+    CoreInsertGcdMapEntry (Link, Entry, BaseAddress, Length, TopEntry, BottomEntry, Map);
     switch (Operation) {
       //
       // Add operations
@@ -1323,7 +1542,7 @@ CoreAllocateSpace (
   Link = StartLink;
   while (Link != EndLink->ForwardLink) {
     Entry = CR (Link, EFI_GCD_MAP_ENTRY, Link, EFI_GCD_MAP_SIGNATURE);
-    CoreInsertGcdMapEntry (Link, Entry, *BaseAddress, Length, TopEntry, BottomEntry);
+    CoreInsertGcdMapEntry (Link, Entry, *BaseAddress, Length, TopEntry, BottomEntry, Map);
     Entry->ImageHandle  = ImageHandle;
     Entry->DeviceHandle = DeviceHandle;
     Link                = Link->ForwardLink;
@@ -2615,6 +2834,9 @@ CoreInitializeGcdServices (
 
   InsertHeadList (&mGcdMemorySpaceMap, &Entry->Link);
 
+  mGcdMemorySpaceTree = OrderedCollectionInit (CoreCompareGcdMapEntry, CoreCompareGcdMapKey);
+  CoreAddGcdMapTreeEntry (&mGcdMemorySpaceMap, Entry);
+
   CoreDumpGcdMemorySpaceMap (TRUE);
 
   //
@@ -2627,6 +2849,9 @@ CoreInitializeGcdServices (
 
   InsertHeadList (&mGcdIoSpaceMap, &Entry->Link);
 
+  mGcdIoSpaceTree = OrderedCollectionInit (CoreCompareGcdMapEntry, CoreCompareGcdMapKey);
+  CoreAddGcdMapTreeEntry (&mGcdIoSpaceMap, Entry);
+
   CoreDumpGcdIoSpaceMap (TRUE);
 
   //
@@ -14,11 +14,103 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 // gHandleList           - A list of all the handles in the system
 // gProtocolDatabaseLock - Lock to protect the mProtocolDatabase
 // gHandleDatabaseKey    -  The Key to show that the handle has been created/modified
+// gProtocolDatabaseGeneration - Incremented whenever a protocol interface is
+//                         installed, uninstalled or reinstalled
 //
-LIST_ENTRY  mProtocolDatabase     = INITIALIZE_LIST_HEAD_VARIABLE (mProtocolDatabase);
-LIST_ENTRY  gHandleList           = INITIALIZE_LIST_HEAD_VARIABLE (gHandleList);
-EFI_LOCK    gProtocolDatabaseLock = EFI_INITIALIZE_LOCK_VARIABLE (TPL_NOTIFY);
-UINT64      gHandleDatabaseKey    = 0;
+LIST_ENTRY  mProtocolDatabase           = INITIALIZE_LIST_HEAD_VARIABLE (mProtocolDatabase);
+LIST_ENTRY  gHandleList                 = INITIALIZE_LIST_HEAD_VARIABLE (gHandleList);
+EFI_LOCK    gProtocolDatabaseLock       = EFI_INITIALIZE_LOCK_VARIABLE (TPL_NOTIFY);
+UINT64      gHandleDatabaseKey          = 0;
+UINT64      gProtocolDatabaseGeneration = 0;
+
+//
+// mProtocolHashTable    - Protocol entries of mProtocolDatabase hashed by protocol GUID
+// mHandleHashTable      - Handles of gHandleList hashed by handle address
+//
+// Both are indexes only: protocol entries are never freed, and a handle is
+// removed from mHandleHashTable at the same time it is removed from gHandleList.
+//
+#define PROTOCOL_HASH_TABLE_SIZE  256
+#define HANDLE_HASH_TABLE_SIZE    256
+
+STATIC PROTOCOL_ENTRY  *mProtocolHashTable[PROTOCOL_HASH_TABLE_SIZE];
+STATIC IHANDLE         *mHandleHashTable[HANDLE_HASH_TABLE_SIZE];
+
+/**
+  Get the mProtocolHashTable bucket of a protocol GUID.
+
+  @param  Protocol               The ID of the protocol
+
+  @return The bucket index.
+
+**/
+STATIC
+UINTN
+ProtocolHashIndex (
+  IN EFI_GUID  *Protocol
+  )
+{
+  UINT32  Hash;
+
+  Hash  = ReadUnaligned32 ((UINT32 *)Protocol) ^
+          ReadUnaligned32 ((UINT32 *)Protocol + 1) ^
+          ReadUnaligned32 ((UINT32 *)Protocol + 2) ^
+          ReadUnaligned32 ((UINT32 *)Protocol + 3);
+  Hash ^= Hash >> 16;
+  Hash ^= Hash >> 8;
+
+  return Hash & (PROTOCOL_HASH_TABLE_SIZE - 1);
+}
+
+/**
+  Get the mHandleHashTable bucket of a handle.
+
+  @param  Handle                 The handle
+
+  @return The bucket index.
+
+**/
+STATIC
+UINTN
+HandleHashIndex (
+  IN EFI_HANDLE  Handle
+  )
+{
+  UINTN  Hash;
+
+  //
+  // Handles are pool allocations, the low bits are always zero
+  //
+  Hash  = (UINTN)Handle >> 3;
+  Hash ^= Hash >> 8;
+
+  return Hash & (HANDLE_HASH_TABLE_SIZE - 1);
+}
+
+/**
+  Remove a handle from mHandleHashTable.
+  The gProtocolDatabaseLock must be owned
+
+  @param  Handle                 The handle to remove
+
+**/
+STATIC
+VOID
+CoreRemoveHandleHash (
+  IN IHANDLE  *Handle
+  )
+{
+  IHANDLE  **Link;
+
+  for (Link = &mHandleHashTable[HandleHashIndex (Handle)]; *Link != NULL; Link = &(*Link)->HashNext) {
+    if (*Link == Handle) {
+      *Link = Handle->HashNext;
+      break;
+    }
+  }
+
+  Handle->HashNext = NULL;
+}
 
 /**
   Acquire lock on gProtocolDatabaseLock.
@@ -59,8 +151,7 @@ CoreValidateHandle (
   IN  EFI_HANDLE  UserHandle
   )
 {
-  IHANDLE     *Handle;
-  LIST_ENTRY  *Link;
+  IHANDLE  *Handle;
 
   if (UserHandle == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -68,9 +159,13 @@ CoreValidateHandle (
 
   ASSERT_LOCKED (&gProtocolDatabaseLock);
 
-  for (Link = gHandleList.BackLink; Link != &gHandleList; Link = Link->BackLink) {
-    Handle = CR (Link, IHANDLE, AllHandles, EFI_HANDLE_SIGNATURE);
+  //
+  // Only compare the addresses, UserHandle must not be dereferenced before
+  // it is known to be valid
+  //
+  for (Handle = mHandleHashTable[HandleHashIndex (UserHandle)]; Handle != NULL; Handle = Handle->HashNext) {
     if (Handle == (IHANDLE *)UserHandle) {
+      ASSERT_IS_HANDLE (Handle);
       return EFI_SUCCESS;
     }
   }
@@ -94,9 +189,9 @@ CoreFindProtocolEntry (
   IN BOOLEAN   Create
   )
 {
-  LIST_ENTRY      *Link;
   PROTOCOL_ENTRY  *Item;
   PROTOCOL_ENTRY  *ProtEntry;
+  UINTN           HashIndex;
 
   ASSERT_LOCKED (&gProtocolDatabaseLock);
 
@@ -105,11 +200,9 @@ CoreFindProtocolEntry (
   //
 
   ProtEntry = NULL;
-  for (Link = mProtocolDatabase.ForwardLink;
-       Link != &mProtocolDatabase;
-       Link = Link->ForwardLink)
-  {
-    Item = CR (Link, PROTOCOL_ENTRY, AllEntries, PROTOCOL_ENTRY_SIGNATURE);
+  HashIndex = ProtocolHashIndex (Protocol);
+  for (Item = mProtocolHashTable[HashIndex]; Item != NULL; Item = Item->HashNext) {
+    ASSERT (Item->Signature == PROTOCOL_ENTRY_SIGNATURE);
     if (CompareGuid (&Item->ProtocolID, Protocol)) {
       //
       // This is the protocol entry
@@ -140,6 +233,8 @@ CoreFindProtocolEntry (
       // Add it to protocol database
       //
       InsertTailList (&mProtocolDatabase, &ProtEntry->AllEntries);
+      ProtEntry->HashNext           = mProtocolHashTable[HashIndex];
+      mProtocolHashTable[HashIndex] = ProtEntry;
     }
   }
 
@@ -469,6 +564,8 @@ CoreInstallProtocolInterfaceNotify (
     // in the system
     //
     InsertTailList (&gHandleList, &Handle->AllHandles);
+    Handle->HashNext                           = mHandleHashTable[HandleHashIndex (Handle)];
+    mHandleHashTable[HandleHashIndex (Handle)] = Handle;
   } else {
     Status = CoreValidateHandle (Handle);
     if (EFI_ERROR (Status)) {
@@ -507,6 +604,7 @@ CoreInstallProtocolInterfaceNotify (
   // protocol entry
   //
   InsertTailList (&ProtEntry->Protocols, &Prot->ByProtocol);
+  gProtocolDatabaseGeneration++;
 
   //
   // Notify the notification list for this protocol
@@ -806,6 +904,7 @@ CoreUninstallProtocolInterface (
     //
     gHandleDatabaseKey++;
     Handle->Key = gHandleDatabaseKey;
+    gProtocolDatabaseGeneration++;
 
     //
     // Remove the protocol interface from the handle
@@ -826,6 +925,7 @@ CoreUninstallProtocolInterface (
   if (IsListEmpty (&Handle->Protocols)) {
     Handle->Signature = 0;
     RemoveEntryList (&Handle->AllHandles);
+    CoreRemoveHandleHash (Handle);
     CoreFreePool (Handle);
   }
 
@@ -939,13 +1039,20 @@ CoreGetProtocolInterface (
 
   Handle = (IHANDLE *)UserHandle;
 
+  //
+  // Resolve the GUID once, then match the protocol entry by address
+  //
+  ProtEntry = CoreFindProtocolEntry (Protocol, FALSE);
+  if (ProtEntry == NULL) {
+    return NULL;
+  }
+
   //
   // Look at each protocol interface for a match
   //
   for (Link = Handle->Protocols.ForwardLink; Link != &Handle->Protocols; Link = Link->ForwardLink) {
-    Prot      = CR (Link, PROTOCOL_INTERFACE, Link, PROTOCOL_INTERFACE_SIGNATURE);
-    ProtEntry = Prot->Protocol;
-    if (CompareGuid (&ProtEntry->ProtocolID, Protocol)) {
+    Prot = CR (Link, PROTOCOL_INTERFACE, Link, PROTOCOL_INTERFACE_SIGNATURE);
+    if (Prot->Protocol == ProtEntry) {
       return Prot;
     }
   }
@@ -14,15 +14,17 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 ///
 /// IHANDLE - contains a list of protocol handles
 ///
-typedef struct {
-  UINTN         Signature;
+typedef struct _IHANDLE {
+  UINTN              Signature;
   /// All handles list of IHANDLE
-  LIST_ENTRY    AllHandles;
+  LIST_ENTRY         AllHandles;
   /// List of PROTOCOL_INTERFACE's for this handle
-  LIST_ENTRY    Protocols;
-  UINTN         LocateRequest;
+  LIST_ENTRY         Protocols;
+  UINTN              LocateRequest;
   /// The Handle Database Key value when this handle was last created or modified
-  UINT64        Key;
+  UINT64             Key;
+  /// Next handle in the same mHandleHashTable bucket
+  struct _IHANDLE    *HashNext;
 } IHANDLE;
 
 #define ASSERT_IS_HANDLE(a)  ASSERT((a)->Signature == EFI_HANDLE_SIGNATURE)
@@ -34,16 +36,18 @@ typedef struct {
 /// database.  Each handler that supports this protocol is listed, along
 /// with a list of registered notifies.
 ///
-typedef struct {
-  UINTN         Signature;
+typedef struct _PROTOCOL_ENTRY {
+  UINTN                     Signature;
   /// Link Entry inserted to mProtocolDatabase
-  LIST_ENTRY    AllEntries;
+  LIST_ENTRY                AllEntries;
   /// ID of the protocol
-  EFI_GUID      ProtocolID;
+  EFI_GUID                  ProtocolID;
   /// All protocol interfaces
-  LIST_ENTRY    Protocols;
+  LIST_ENTRY                Protocols;
   /// Registerd notification handlers
-  LIST_ENTRY    Notify;
+  LIST_ENTRY                Notify;
+  /// Next entry in the same mProtocolHashTable bucket
+  struct _PROTOCOL_ENTRY    *HashNext;
 } PROTOCOL_ENTRY;
 
 #define PROTOCOL_INTERFACE_SIGNATURE  SIGNATURE_32('p','i','f','c')
@@ -453,6 +453,7 @@ CoreLocateDevicePath (
 {
   INTN                      SourceSize;
   INTN                      Size;
+  INTN                      NodeSize;
   INTN                      BestMatch;
   UINTN                     HandleCount;
   UINTN                     Index;
@@ -509,11 +510,25 @@ CoreLocateDevicePath (
     }
 
     //
-    // Check if DevicePath is first part of SourcePath
+    // Check if DevicePath is first part of SourcePath. Compare it node by node,
+    // so that the device paths of most handles are rejected after their first
+    // different node, instead of being measured and compared as a whole.
     //
-    Size = GetDevicePathSize (TmpDevicePath) - sizeof (EFI_DEVICE_PATH_PROTOCOL);
-    ASSERT (Size >= 0);
-    if ((Size <= SourceSize) && (CompareMem (SourcePath, TmpDevicePath, (UINTN)Size) == 0)) {
+    Size = 0;
+    while (!IsDevicePathEnd (TmpDevicePath)) {
+      NodeSize = DevicePathNodeLength (TmpDevicePath);
+      if ((NodeSize < (INTN)sizeof (EFI_DEVICE_PATH_PROTOCOL)) ||
+          (NodeSize > SourceSize - Size) ||
+          (CompareMem ((UINT8 *)SourcePath + Size, TmpDevicePath, (UINTN)NodeSize) != 0))
+      {
+        break;
+      }
+
+      Size         += NodeSize;
+      TmpDevicePath = NextDevicePathNode (TmpDevicePath);
+    }
+
+    if (IsDevicePathEnd (TmpDevicePath)) {
       //
       // If the size is equal to the best match, then we
       // have a duplicate device path for 2 different device
@@ -248,6 +248,7 @@ CoreReinstallProtocolInterface (
   //
   gHandleDatabaseKey++;
   Handle->Key = gHandleDatabaseKey;
+  gProtocolDatabaseGeneration++;
 
   //
   // Release the lock and connect all drivers to UserHandle
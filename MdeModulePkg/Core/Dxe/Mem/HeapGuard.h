@@ -319,6 +319,18 @@ IsPageTypeToGuard (
   IN EFI_ALLOCATE_TYPE  AllocateType
   );
 
+/**
+  Check to see if the allocation being made, whose type is to be guarded, is
+  picked for Guard by PcdHeapGuardSamplingRate.
+
+  @return TRUE  The allocation should be guarded.
+  @return FALSE The allocation should be made without Guard.
+**/
+BOOLEAN
+IsAllocationSampledToGuard (
+  VOID
+  );
+
 /**
   Check to see if the page at the given address is guarded or not.
 
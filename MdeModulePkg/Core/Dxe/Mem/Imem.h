@@ -99,6 +99,17 @@ CoreFreePoolI (
   OUT EFI_MEMORY_TYPE  *PoolType OPTIONAL
   );
 
+/**
+  Get the hit/miss statistics of the pool cache.
+
+  @param  CacheInfo     Pointer to the buffer to receive the statistics.
+
+**/
+VOID
+CoreGetPoolCacheInfo (
+  OUT MEMORY_PROFILE_POOL_CACHE_INFO  *CacheInfo
+  );
+
 /**
   Enter critical section by gaining lock on gMemoryLock.
 
@@ -146,6 +157,25 @@ CoreInternalAllocatePages (
   IN BOOLEAN                   NeedGuard
   );
 
+/**
+  Accept unaccepted memory and add it to the memory map, so that an allocation
+  which ran out of memory can be retried. The caller must not hold gMemoryLock.
+
+  @param  MaxAddress             The highest address the allocation may use.
+  @param  NumberOfPages          The number of pages of the allocation.
+  @param  Alignment              The alignment in bytes of the allocation.
+
+  @retval TRUE                   Memory was accepted for the allocation.
+  @retval FALSE                  No memory could be accepted.
+
+**/
+BOOLEAN
+CoreAcceptMemoryForAllocation (
+  IN UINT64  MaxAddress,
+  IN UINTN   NumberOfPages,
+  IN UINTN   Alignment
+  );
+
 //
 // Internal Global data
 //
@@ -153,4 +183,5 @@ CoreInternalAllocatePages (
 extern EFI_LOCK    gMemoryLock;
 extern LIST_ENTRY  gMemoryMap;
 extern LIST_ENTRY  mGcdMemorySpaceMap;
+extern EFI_LOCK    mGcdMemorySpaceLock;
 #endif
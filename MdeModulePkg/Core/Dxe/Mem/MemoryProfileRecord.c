@@ -61,6 +61,7 @@ GLOBAL_REMOVE_IF_UNREFERENCED BOOLEAN                   mMemoryProfileGettingSta
 GLOBAL_REMOVE_IF_UNREFERENCED BOOLEAN                   mMemoryProfileRecordingEnable = MEMORY_PROFILE_RECORDING_DISABLE;
 GLOBAL_REMOVE_IF_UNREFERENCED EFI_DEVICE_PATH_PROTOCOL  *mMemoryProfileDriverPath;
 GLOBAL_REMOVE_IF_UNREFERENCED UINTN                     mMemoryProfileDriverPathSize;
+GLOBAL_REMOVE_IF_UNREFERENCED UINT32                    mMemoryProfileSamplingCount;
 
 /**
   Get memory profile data.
@@ -1402,6 +1403,25 @@ CoreUpdateProfile (
   }
 
   CoreAcquireMemoryProfileLock ();
+
+  //
+  // Only record one out of every PcdMemoryProfileSamplingRate basic allocate
+  // actions. The free of an allocation not recorded finds no alloc info and
+  // is filtered in CoreUpdateProfileFree(), like the free of a memory type
+  // not recorded.
+  //
+  if ((PcdGet32 (PcdMemoryProfileSamplingRate) > 1) && (Action == BasicAction) &&
+      ((BasicAction == MemoryProfileActionAllocatePages) || (BasicAction == MemoryProfileActionAllocatePool)))
+  {
+    mMemoryProfileSamplingCount++;
+    if (mMemoryProfileSamplingCount < PcdGet32 (PcdMemoryProfileSamplingRate)) {
+      CoreReleaseMemoryProfileLock ();
+      return EFI_UNSUPPORTED;
+    }
+
+    mMemoryProfileSamplingCount = 0;
+  }
+
   switch (BasicAction) {
     case MemoryProfileActionAllocatePages:
       Status = CoreUpdateProfileAllocate (CallerAddress, Action, MemoryType, Size, Buffer, ActionString);
@@ -1483,6 +1503,8 @@ MemoryProfileGetDataSize (
     }
   }
 
+  TotalSize += sizeof (MEMORY_PROFILE_POOL_CACHE_INFO);
+
   return TotalSize;
 }
 
@@ -1560,6 +1582,8 @@ MemoryProfileCopyData (
 
     DriverInfo = (MEMORY_PROFILE_DRIVER_INFO *)AllocInfo;
   }
+
+  CoreGetPoolCacheInfo ((MEMORY_PROFILE_POOL_CACHE_INFO *)DriverInfo);
 }
 
 /**
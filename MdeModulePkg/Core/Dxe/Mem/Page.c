@@ -45,6 +45,10 @@ UINTN       mFreeMapStack = 0;
 ///
 LIST_ENTRY  mFreeMemoryMapEntryList           = INITIALIZE_LIST_HEAD_VARIABLE (mFreeMemoryMapEntryList);
 BOOLEAN     mMemoryTypeInformationInitialized = FALSE;
+///
+/// Set while memory is accepted for an allocation, as accepting may allocate memory
+///
+BOOLEAN  mAcceptingMemory = FALSE;
 
 EFI_MEMORY_TYPE_STATISTICS  mMemoryTypeStatistics[EfiMaxMemoryType + 1] = {
   { 0, MAX_ALLOC_ADDRESS, 0, 0, EfiMaxMemoryType, TRUE,  FALSE },  // EfiReservedMemoryType
@@ -464,6 +468,105 @@ PromoteMemoryResource (
   return Promoted;
 }
 
+/**
+  Accept unaccepted memory and add it to the memory map, so that an allocation
+  which ran out of memory can be retried. The caller must not hold gMemoryLock.
+
+  The lowest unaccepted range that can hold the allocation below MaxAddress is
+  accepted, at least PcdOnDemandMemoryAcceptSize bytes of it, so that the next
+  allocations find accepted memory too.
+
+  @param  MaxAddress             The highest address the allocation may use.
+  @param  NumberOfPages          The number of pages of the allocation.
+  @param  Alignment              The alignment in bytes of the allocation.
+
+  @retval TRUE                   Memory was accepted for the allocation.
+  @retval FALSE                  No memory could be accepted.
+
+**/
+BOOLEAN
+CoreAcceptMemoryForAllocation (
+  IN UINT64  MaxAddress,
+  IN UINTN   NumberOfPages,
+  IN UINTN   Alignment
+  )
+{
+  LIST_ENTRY            *Link;
+  EFI_GCD_MAP_ENTRY     *Entry;
+  UINT64                Needed;
+  UINT64                Length;
+  UINT64                EndAddress;
+  EFI_PHYSICAL_ADDRESS  BaseAddress;
+  UINT64                Capabilities;
+  EFI_STATUS            Status;
+
+  if ((gMemoryAccept == NULL) || mAcceptingMemory || (PcdGet32 (PcdOnDemandMemoryAcceptSize) == 0)) {
+    return FALSE;
+  }
+
+  Needed = EFI_PAGES_TO_SIZE ((UINT64)NumberOfPages) + Alignment;
+  Length = ALIGN_VALUE (MAX (Needed, PcdGet32 (PcdOnDemandMemoryAcceptSize)), SIZE_2MB);
+
+  //
+  // The allocation may come from the GCD services, which hold the GCD lock
+  // while they allocate their map entries. There is nothing to do then.
+  //
+  if (EFI_ERROR (CoreAcquireLockOrFail (&mGcdMemorySpaceLock))) {
+    return FALSE;
+  }
+
+  BaseAddress  = 0;
+  Capabilities = 0;
+  for (Link = mGcdMemorySpaceMap.ForwardLink; Link != &mGcdMemorySpaceMap; Link = Link->ForwardLink) {
+    Entry = CR (Link, EFI_GCD_MAP_ENTRY, Link, EFI_GCD_MAP_SIGNATURE);
+    if ((Entry->GcdMemoryType != EfiGcdMemoryTypeUnaccepted) || (Entry->BaseAddress > MaxAddress)) {
+      continue;
+    }
+
+    EndAddress = MIN (Entry->EndAddress, MaxAddress);
+    if (EndAddress - Entry->BaseAddress + 1 < Needed) {
+      continue;
+    }
+
+    BaseAddress  = Entry->BaseAddress;
+    Length       = MIN (Length, (EndAddress - BaseAddress + 1) & ~(UINT64)EFI_PAGE_MASK);
+    Capabilities = Entry->Capabilities;
+    break;
+  }
+
+  CoreReleaseGcdMemoryLock ();
+
+  if (Capabilities == 0) {
+    return FALSE;
+  }
+
+  DEBUG ((DEBUG_PAGE, "Accept memory 0x%lx - 0x%lx for an allocation of 0x%lx pages\n", BaseAddress, BaseAddress + Length - 1, (UINT64)NumberOfPages));
+
+  mAcceptingMemory = TRUE;
+  Status           = gMemoryAccept->AcceptMemory (gMemoryAccept, BaseAddress, (UINTN)Length);
+  if (!EFI_ERROR (Status)) {
+    Status = CoreRemoveMemorySpace (BaseAddress, Length);
+  }
+
+  if (!EFI_ERROR (Status)) {
+    Status = CoreAddMemorySpace (
+               EfiGcdMemoryTypeSystemMemory,
+               BaseAddress,
+               Length,
+               Capabilities & ~(EFI_MEMORY_PRESENT | EFI_MEMORY_INITIALIZED | EFI_MEMORY_TESTED | EFI_MEMORY_RUNTIME)
+               );
+  }
+
+  mAcceptingMemory = FALSE;
+
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed to accept memory 0x%lx - 0x%lx: %r\n", BaseAddress, BaseAddress + Length - 1, Status));
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
 /**
   This function try to allocate Runtime code & Boot time code memory range. If LMFA enabled, 2 patchable PCD
   PcdLoadFixAddressRuntimeCodePageNumber & PcdLoadFixAddressBootTimeCodePageNumber which are set by tools will record the
@@ -1287,6 +1390,15 @@ FindFreePages (
   )
 {
   UINT64  Start;
+  UINT64  SearchedMaxAddress;
+
+  //
+  // Each search below walks the whole memory map. SearchedMaxAddress records
+  // the top of the range [0, SearchedMaxAddress] already searched in vain, so
+  // that the same range is not walked again when the bins overlap, e.g. for
+  // the memory types without a bin or when no bin is configured.
+  //
+  SearchedMaxAddress = 0;
 
   //
   // Attempt to find free pages in the preferred bin based on the requested memory type
@@ -1303,12 +1415,16 @@ FindFreePages (
     if (Start != 0) {
       return Start;
     }
+
+    if (mMemoryTypeStatistics[NewType].BaseAddress == 0) {
+      SearchedMaxAddress = mMemoryTypeStatistics[NewType].MaximumAddress;
+    }
   }
 
   //
   // Attempt to find free pages in the default allocation bin
   //
-  if (MaxAddress >= mDefaultMaximumAddress) {
+  if ((MaxAddress >= mDefaultMaximumAddress) && (mDefaultMaximumAddress != SearchedMaxAddress)) {
     Start = CoreFindFreePagesI (
               mDefaultMaximumAddress,
               0,
@@ -1324,6 +1440,8 @@ FindFreePages (
 
       return Start;
     }
+
+    SearchedMaxAddress = mDefaultMaximumAddress;
   }
 
   //
@@ -1332,16 +1450,18 @@ FindFreePages (
   // address range.  If this allocation fails, then there are not enough
   // resources anywhere to satisfy the request.
   //
-  Start = CoreFindFreePagesI (
-            MaxAddress,
-            0,
-            NoPages,
-            NewType,
-            Alignment,
-            NeedGuard
-            );
-  if (Start != 0) {
-    return Start;
+  if (MaxAddress != SearchedMaxAddress) {
+    Start = CoreFindFreePagesI (
+              MaxAddress,
+              0,
+              NoPages,
+              NewType,
+              Alignment,
+              NeedGuard
+              );
+    if (Start != 0) {
+      return Start;
+    }
   }
 
   //
@@ -1393,6 +1513,7 @@ CoreInternalAllocatePages (
   UINT64           MaxAddress;
   UINTN            Alignment;
   EFI_MEMORY_TYPE  CheckType;
+  BOOLEAN          Accepted;
 
   if ((UINT32)Type >= MaxAllocateType) {
     return EFI_INVALID_PARAMETER;
@@ -1526,6 +1647,24 @@ CoreInternalAllocatePages (
               Alignment,
               NeedGuard
               );
+    if (Start == 0) {
+      //
+      // Accept more memory of a confidential guest, then re-attempt the allocation
+      //
+      CoreReleaseMemoryLock ();
+      Accepted = CoreAcceptMemoryForAllocation (MaxAddress, NumberOfPages, Alignment);
+      CoreAcquireMemoryLock ();
+      if (Accepted) {
+        Start = FindFreePages (
+                  MaxAddress,
+                  NumberOfPages,
+                  MemoryType,
+                  Alignment,
+                  NeedGuard
+                  );
+      }
+    }
+
     if (Start == 0) {
       Status = EFI_OUT_OF_RESOURCES;
       goto Done;
@@ -1599,7 +1738,7 @@ CoreAllocatePages (
   EFI_STATUS  Status;
   BOOLEAN     NeedGuard;
 
-  NeedGuard = IsPageTypeToGuard (MemoryType, Type) && !mOnGuarding;
+  NeedGuard = IsPageTypeToGuard (MemoryType, Type) && !mOnGuarding && IsAllocationSampledToGuard ();
   Status    = CoreInternalAllocatePages (
                 Type,
                 MemoryType,
@@ -19,8 +19,9 @@ typedef struct {
   LIST_ENTRY    Link;
 } POOL_FREE;
 
-#define POOL_HEAD_SIGNATURE      SIGNATURE_32('p','h','d','0')
-#define POOLPAGE_HEAD_SIGNATURE  SIGNATURE_32('p','h','d','1')
+#define POOL_HEAD_SIGNATURE       SIGNATURE_32('p','h','d','0')
+#define POOLPAGE_HEAD_SIGNATURE   SIGNATURE_32('p','h','d','1')
+#define POOLCACHE_HEAD_SIGNATURE  SIGNATURE_32('p','h','d','2')
 typedef struct {
   UINT32             Signature;
   UINT32             Reserved;
@@ -82,6 +83,25 @@ POOL  mPoolHead[EfiMaxMemoryType];
 //
 LIST_ENTRY  mPoolHeadList = INITIALIZE_LIST_HEAD_VARIABLE (mPoolHeadList);
 
+//
+// Small freed pool blocks are kept in a per memory type, per size class
+// cache and handed out again without going through the free lists. A block
+// in the cache is never merged back into its page, so a FreePool/AllocatePool
+// pair of the same size class does not release and re-acquire pool pages.
+// Only the size classes up to 1KB are cached, and only for the memory types
+// below EfiMaxMemoryType, to bound the memory the cache can hold on to.
+//
+#define POOL_CACHE_DEPTH       8
+#define POOL_CACHE_LIST_COUNT  5
+
+typedef struct {
+  UINTN        Count[POOL_CACHE_LIST_COUNT];
+  POOL_HEAD    *Block[POOL_CACHE_LIST_COUNT][POOL_CACHE_DEPTH];
+} POOL_CACHE;
+
+STATIC POOL_CACHE                      mPoolCache[EfiMaxMemoryType];
+STATIC MEMORY_PROFILE_POOL_CACHE_INFO  mPoolCacheInfo;
+
 /**
   Get pool size table index from the specified size.
 
@@ -107,6 +127,114 @@ GetPoolIndexFromSize (
   return MAX_POOL_LIST;
 }
 
+/**
+  Check whether a pool block may be kept in the pool cache.
+
+  @param  PoolType      The memory type of the pool block.
+  @param  Index         The size class of the pool block.
+
+  @retval TRUE          The pool block can be cached.
+  @retval FALSE         The pool block can not be cached.
+
+**/
+STATIC
+BOOLEAN
+IsPoolCacheable (
+  IN EFI_MEMORY_TYPE  PoolType,
+  IN UINTN            Index
+  )
+{
+  return (BOOLEAN)(((UINT32)PoolType < EfiMaxMemoryType) && (Index < POOL_CACHE_LIST_COUNT));
+}
+
+/**
+  Take a pool block of the specified size class out of the pool cache.
+  Caller must have the memory lock held
+
+  @param  PoolType      The memory type of the pool block.
+  @param  Index         The size class of the pool block.
+
+  @return The cached pool block, or NULL if the cache is empty.
+
+**/
+STATIC
+POOL_HEAD *
+PoolCachePop (
+  IN EFI_MEMORY_TYPE  PoolType,
+  IN UINTN            Index
+  )
+{
+  POOL_CACHE  *Cache;
+  POOL_HEAD   *Head;
+
+  Cache = &mPoolCache[PoolType];
+  if (Cache->Count[Index] == 0) {
+    mPoolCacheInfo.AllocateMissCountByType[PoolType]++;
+    return NULL;
+  }
+
+  Cache->Count[Index]--;
+  Head = Cache->Block[Index][Cache->Count[Index]];
+  ASSERT (Head->Signature == POOLCACHE_HEAD_SIGNATURE);
+  mPoolCacheInfo.AllocateHitCountByType[PoolType]++;
+  return Head;
+}
+
+/**
+  Put a freed pool block into the pool cache.
+  Caller must have the memory lock held
+
+  @param  PoolType      The memory type of the pool block.
+  @param  Index         The size class of the pool block.
+  @param  Head          The pool block to cache.
+
+  @retval TRUE          The pool block was put into the cache.
+  @retval FALSE         The cache is full.
+
+**/
+STATIC
+BOOLEAN
+PoolCachePush (
+  IN EFI_MEMORY_TYPE  PoolType,
+  IN UINTN            Index,
+  IN POOL_HEAD        *Head
+  )
+{
+  POOL_CACHE  *Cache;
+
+  Cache = &mPoolCache[PoolType];
+  if (Cache->Count[Index] >= POOL_CACHE_DEPTH) {
+    mPoolCacheInfo.FreeMissCountByType[PoolType]++;
+    return FALSE;
+  }
+
+  //
+  // Use a dedicated signature so that a double free of a cached block is
+  // caught, and the page scan in CoreFreePoolI() sees the block as in use.
+  //
+  Head->Signature                          = POOLCACHE_HEAD_SIGNATURE;
+  Cache->Block[Index][Cache->Count[Index]] = Head;
+  Cache->Count[Index]++;
+  mPoolCacheInfo.FreeHitCountByType[PoolType]++;
+  return TRUE;
+}
+
+/**
+  Get the hit/miss statistics of the pool cache.
+
+  @param  CacheInfo     Pointer to the buffer to receive the statistics.
+
+**/
+VOID
+CoreGetPoolCacheInfo (
+  OUT MEMORY_PROFILE_POOL_CACHE_INFO  *CacheInfo
+  )
+{
+  CoreAcquireLock (&mPoolMemoryLock);
+  CopyMem (CacheInfo, &mPoolCacheInfo, sizeof (MEMORY_PROFILE_POOL_CACHE_INFO));
+  CoreReleaseLock (&mPoolMemoryLock);
+}
+
 /**
   Called to initialize the pool.
 
@@ -127,6 +255,12 @@ CoreInitializePool (
       InitializeListHead (&mPoolHead[Type].FreeList[Index]);
     }
   }
+
+  mPoolCacheInfo.Header.Signature = MEMORY_PROFILE_POOL_CACHE_INFO_SIGNATURE;
+  mPoolCacheInfo.Header.Length    = sizeof (MEMORY_PROFILE_POOL_CACHE_INFO);
+  mPoolCacheInfo.Header.Revision  = MEMORY_PROFILE_POOL_CACHE_INFO_REVISION;
+  mPoolCacheInfo.CacheDepth       = POOL_CACHE_DEPTH;
+  mPoolCacheInfo.MaxCachedSize    = LIST_TO_SIZE (POOL_CACHE_LIST_COUNT - 1) - POOL_OVERHEAD;
 }
 
 /**
@@ -232,7 +366,7 @@ CoreInternalAllocatePool (
     return EFI_OUT_OF_RESOURCES;
   }
 
-  NeedGuard = IsPoolTypeToGuard (PoolType) && !mOnGuarding;
+  NeedGuard = IsPoolTypeToGuard (PoolType) && !mOnGuarding && IsAllocationSampledToGuard ();
 
   //
   // Acquire the memory lock and make the allocation
@@ -244,6 +378,22 @@ CoreInternalAllocatePool (
 
   *Buffer = CoreAllocatePoolI (PoolType, Size, NeedGuard);
   CoreReleaseLock (&mPoolMemoryLock);
+
+  //
+  // Accept more memory of a confidential guest, then re-attempt the allocation
+  //
+  if ((*Buffer == NULL) &&
+      CoreAcceptMemoryForAllocation (MAX_ALLOC_ADDRESS, EFI_SIZE_TO_PAGES (Size) + 1, RUNTIME_PAGE_ALLOCATION_GRANULARITY))
+  {
+    Status = CoreAcquireLockOrFail (&mPoolMemoryLock);
+    if (EFI_ERROR (Status)) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    *Buffer = CoreAllocatePoolI (PoolType, Size, NeedGuard);
+    CoreReleaseLock (&mPoolMemoryLock);
+  }
+
   return (*Buffer != NULL) ? EFI_SUCCESS : EFI_OUT_OF_RESOURCES;
 }
 
@@ -434,6 +584,16 @@ CoreAllocatePoolI (
     goto Done;
   }
 
+  //
+  // Try the pool cache first
+  //
+  if (IsPoolCacheable (PoolType, Index)) {
+    Head = PoolCachePop (PoolType, Index);
+    if (Head != NULL) {
+      goto Done;
+    }
+  }
+
   //
   // If there's no free pool in the proper list size, go get some more pages
   //
@@ -807,9 +967,11 @@ CoreFreePoolI (
         NoPages
         );
     }
-  } else {
+  } else if (!IsPoolCacheable (Pool->MemoryType, Index) ||
+             !PoolCachePush (Pool->MemoryType, Index, Head))
+  {
     //
-    // Put the pool entry onto the free pool list
+    // The pool cache is full, put the pool entry onto the free pool list
     //
     Free = (POOL_FREE *)Head;
     ASSERT (Free != NULL);
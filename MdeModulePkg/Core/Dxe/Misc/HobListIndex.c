@@ -0,0 +1,95 @@
+/** @file
+  Builds the index of the GUID HOBs of the HOB list that the HOB library
+  looks GUID HOBs up with.
+
+Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "DxeMain.h"
+
+/**
+  Build an index of the GUID HOBs of the HOB list, which maps every GUID to
+  the first GUID HOB with that GUID, and install it into the EFI System Table's
+  Configuration Table.
+
+  @param  HobStart      The first HOB of the HOB list.
+
+**/
+VOID
+CoreInstallHobListIndex (
+  IN VOID  *HobStart
+  )
+{
+  EFI_STATUS            Status;
+  EFI_PEI_HOB_POINTERS  Hob;
+  EDKII_HOB_LIST_INDEX  *HobListIndex;
+  UINTN                 GuidHobCount;
+  UINTN                 Low;
+  UINTN                 High;
+  UINTN                 Middle;
+  INTN                  Result;
+
+  GuidHobCount = 0;
+  for (Hob.Raw = HobStart; !END_OF_HOB_LIST (Hob); Hob.Raw = GET_NEXT_HOB (Hob)) {
+    if (Hob.Header->HobType == EFI_HOB_TYPE_GUID_EXTENSION) {
+      GuidHobCount++;
+    }
+  }
+
+  HobListIndex = AllocatePool (OFFSET_OF (EDKII_HOB_LIST_INDEX, Entry) + GuidHobCount * sizeof (EDKII_HOB_LIST_INDEX_ENTRY));
+  if (HobListIndex == NULL) {
+    return;
+  }
+
+  HobListIndex->HobList      = HobStart;
+  HobListIndex->EndOfHobList = Hob.Raw;
+  HobListIndex->EntryCount   = 0;
+
+  for (Hob.Raw = HobStart; !END_OF_HOB_LIST (Hob); Hob.Raw = GET_NEXT_HOB (Hob)) {
+    if (Hob.Header->HobType != EFI_HOB_TYPE_GUID_EXTENSION) {
+      continue;
+    }
+
+    //
+    // Keep the entries sorted. Only the first GUID HOB with a GUID is indexed.
+    //
+    Low  = 0;
+    High = HobListIndex->EntryCount;
+    while (Low < High) {
+      Middle = Low + (High - Low) / 2;
+      Result = CompareMem (&Hob.Guid->Name, &HobListIndex->Entry[Middle].Name, sizeof (EFI_GUID));
+      if (Result == 0) {
+        break;
+      }
+
+      if (Result < 0) {
+        High = Middle;
+      } else {
+        Low = Middle + 1;
+      }
+    }
+
+    if (Low < High) {
+      continue;
+    }
+
+    CopyMem (
+      &HobListIndex->Entry[Low + 1],
+      &HobListIndex->Entry[Low],
+      (HobListIndex->EntryCount - Low) * sizeof (EDKII_HOB_LIST_INDEX_ENTRY)
+      );
+    CopyGuid (&HobListIndex->Entry[Low].Name, &Hob.Guid->Name);
+    HobListIndex->Entry[Low].FirstHob = Hob.Guid;
+    HobListIndex->EntryCount++;
+  }
+
+  DEBUG ((DEBUG_INFO, "HOB list index: %d GUID HOBs with %d GUIDs\n", GuidHobCount, HobListIndex->EntryCount));
+
+  Status = CoreInstallConfigurationTable (&gEdkiiHobListIndexGuid, HobListIndex);
+  ASSERT_EFI_ERROR (Status);
+  if (EFI_ERROR (Status)) {
+    FreePool (HobListIndex);
+  }
+}
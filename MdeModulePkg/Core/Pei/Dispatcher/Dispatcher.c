@@ -1396,6 +1396,139 @@ EvacuateTempRam (
   return Status;
 }
 
+/**
+  Re-point the FV handle and the PEIM file handles of an FV to its copy in
+  permanent memory.
+
+  @param Private         PeiCore's private data structure
+  @param FvIndex         The index of the FV in the Fv[] array.
+  @param NewFvHeader     The copy of the FV in permanent memory.
+
+**/
+VOID
+RepointShadowedFv (
+  IN PEI_CORE_INSTANCE           *Private,
+  IN UINTN                       FvIndex,
+  IN EFI_FIRMWARE_VOLUME_HEADER  *NewFvHeader
+  )
+{
+  UINTN  OrgFvHandle;
+  UINTN  FvLength;
+  UINTN  FileHandle;
+  UINTN  FileIndex;
+
+  OrgFvHandle = (UINTN)Private->Fv[FvIndex].FvHeader;
+  FvLength    = (UINTN)Private->Fv[FvIndex].FvHeader->FvLength;
+
+  if (Private->Fv[FvIndex].ScanFv) {
+    for (FileIndex = 0; FileIndex < Private->Fv[FvIndex].PeimCount; FileIndex++) {
+      FileHandle = (UINTN)Private->Fv[FvIndex].FvFileHandles[FileIndex];
+      if ((FileHandle >= OrgFvHandle) && (FileHandle < OrgFvHandle + FvLength)) {
+        Private->Fv[FvIndex].FvFileHandles[FileIndex] = (EFI_PEI_FILE_HANDLE)(FileHandle - OrgFvHandle + (UINTN)NewFvHeader);
+      }
+    }
+  }
+
+  //
+  // The FV file table holds offsets, so it stays valid for the copy.
+  //
+  Private->Fv[FvIndex].FvHeader = NewFvHeader;
+  Private->Fv[FvIndex].FvHandle = (EFI_PEI_FV_HANDLE)NewFvHeader;
+}
+
+/**
+  Copy the FVs that are outside of permanent memory, typically memory-mapped
+  flash, to permanent memory, each in one bulk copy, and re-point their FV and
+  file handles to the copies. The PEIMs dispatched after this, and the sections
+  read from these FVs, then come from DRAM instead of from flash.
+
+  Unlike EvacuateTempRam(), the PEIMs that already ran are not migrated: they
+  keep running from their original location, and the PPIs they installed and
+  the FV HOBs keep pointing to it. Only the FVs that the PEI Core produces the
+  file system of are copied.
+
+  @param Private         PeiCore's private data structure
+
+**/
+VOID
+ShadowFirmwareVolumes (
+  IN PEI_CORE_INSTANCE  *Private
+  )
+{
+  EFI_STATUS                  Status;
+  UINTN                       FvIndex;
+  UINTN                       FvChildIndex;
+  EFI_PHYSICAL_ADDRESS        FvHeaderAddress;
+  EFI_FIRMWARE_VOLUME_HEADER  *FvHeader;
+  EFI_FIRMWARE_VOLUME_HEADER  *ChildFvHeader;
+  EFI_FIRMWARE_VOLUME_HEADER  *ShadowedFvHeader;
+
+  ASSERT (Private->PeiMemoryInstalled);
+
+  for (FvIndex = 0; FvIndex < Private->FvCount; FvIndex++) {
+    FvHeader = Private->Fv[FvIndex].FvHeader;
+    ASSERT (FvHeader != NULL);
+
+    //
+    // Skip the FVs in permanent memory, which also covers the child FVs of
+    // the FVs that are shadowed already.
+    //
+    if (((EFI_PHYSICAL_ADDRESS)(UINTN)FvHeader >= Private->PhysicalMemoryBegin) &&
+        (((EFI_PHYSICAL_ADDRESS)(UINTN)FvHeader + (FvHeader->FvLength - 1)) < Private->FreePhysicalMemoryTop))
+    {
+      continue;
+    }
+
+    if ((Private->Fv[FvIndex].FvHandle != (EFI_PEI_FV_HANDLE)FvHeader) ||
+        (!CompareGuid (&FvHeader->FileSystemGuid, &gEfiFirmwareFileSystem2Guid) &&
+         !CompareGuid (&FvHeader->FileSystemGuid, &gEfiFirmwareFileSystem3Guid)))
+    {
+      continue;
+    }
+
+    Status = PeiServicesAllocatePages (
+               EfiBootServicesCode,
+               EFI_SIZE_TO_PAGES ((UINTN)FvHeader->FvLength),
+               &FvHeaderAddress
+               );
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_WARN, "No memory to shadow FV[%d] at 0x%p - %r\n", FvIndex, FvHeader, Status));
+      continue;
+    }
+
+    ShadowedFvHeader = (EFI_FIRMWARE_VOLUME_HEADER *)(UINTN)FvHeaderAddress;
+    CopyMem (ShadowedFvHeader, FvHeader, (UINTN)FvHeader->FvLength);
+
+    DEBUG ((
+      DEBUG_INFO,
+      "Shadowed FV[%d] from 0x%p to 0x%p (0x%lx bytes)\n",
+      FvIndex,
+      FvHeader,
+      ShadowedFvHeader,
+      FvHeader->FvLength
+      ));
+
+    //
+    // The child FVs are in the copy of their parent FV already.
+    //
+    for (FvChildIndex = 0; FvChildIndex < Private->FvCount; FvChildIndex++) {
+      ChildFvHeader = Private->Fv[FvChildIndex].FvHeader;
+      if ((FvChildIndex != FvIndex) &&
+          ((UINTN)ChildFvHeader > (UINTN)FvHeader) &&
+          (((UINTN)ChildFvHeader + ChildFvHeader->FvLength) <= ((UINTN)FvHeader + FvHeader->FvLength)))
+      {
+        RepointShadowedFv (
+          Private,
+          FvChildIndex,
+          (EFI_FIRMWARE_VOLUME_HEADER *)((UINTN)ShadowedFvHeader + (UINTN)ChildFvHeader - (UINTN)FvHeader)
+          );
+      }
+    }
+
+    RepointShadowedFv (Private, FvIndex, ShadowedFvHeader);
+  }
+}
+
 /**
   Conduct PEIM dispatch.
 
@@ -263,7 +263,7 @@ FileHandleToVolume (
 
 **/
 EFI_STATUS
-FindFileEx (
+FindFileInFv (
   IN  CONST EFI_PEI_FV_HANDLE    FvHandle,
   IN  CONST EFI_GUID             *FileName    OPTIONAL,
   IN        EFI_FV_FILETYPE      SearchType,
@@ -455,6 +455,174 @@ FindFileEx (
   return EFI_NOT_FOUND;
 }
 
+/**
+  Build the file table of an FV, so that later file lookups in the FV do not
+  have to walk and checksum the FFS files again.
+
+  The table is left empty if it cannot be allocated, then lookups walk the FV.
+
+  @param CoreFvHandle    The PEI_CORE_FV_HANDLE of the FV.
+
+**/
+VOID
+BuildFvFileTable (
+  IN OUT PEI_CORE_FV_HANDLE  *CoreFvHandle
+  )
+{
+  EFI_FFS_FILE_HEADER  *FfsFileHeader;
+  PEI_CORE_FV_FILE     *FileTable;
+  UINTN                MaxCount;
+  EFI_STATUS           Status;
+
+  CoreFvHandle->FileTableBuilt = TRUE;
+
+  MaxCount      = 0;
+  FfsFileHeader = NULL;
+  while (TRUE) {
+    Status = FindFileInFv (
+               CoreFvHandle->FvHandle,
+               NULL,
+               EFI_FV_FILETYPE_ALL,
+               (EFI_PEI_FILE_HANDLE *)&FfsFileHeader,
+               NULL
+               );
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+
+    if (CoreFvHandle->FileCount == MaxCount) {
+      //
+      // Run out of room, grow the buffer.
+      //
+      MaxCount  = (MaxCount == 0) ? FV_FILE_TABLE_INITIAL_COUNT : MaxCount * 2;
+      FileTable = AllocatePool (sizeof (PEI_CORE_FV_FILE) * MaxCount);
+      if (FileTable == NULL) {
+        CoreFvHandle->FileCount = 0;
+        CoreFvHandle->FileTable = NULL;
+        return;
+      }
+
+      if (CoreFvHandle->FileTable != NULL) {
+        CopyMem (FileTable, CoreFvHandle->FileTable, sizeof (PEI_CORE_FV_FILE) * CoreFvHandle->FileCount);
+      }
+
+      CoreFvHandle->FileTable = FileTable;
+    }
+
+    CopyGuid (&CoreFvHandle->FileTable[CoreFvHandle->FileCount].Name, &FfsFileHeader->Name);
+    CoreFvHandle->FileTable[CoreFvHandle->FileCount].Offset = (UINT32)((UINTN)FfsFileHeader - (UINTN)CoreFvHandle->FvHandle);
+    CoreFvHandle->FileTable[CoreFvHandle->FileCount].Type   = FfsFileHeader->Type;
+    CoreFvHandle->FileCount++;
+  }
+
+  DEBUG ((DEBUG_VERBOSE, "FV %p has %d files\n", CoreFvHandle->FvHandle, CoreFvHandle->FileCount));
+}
+
+/**
+  Given the input file pointer, search for the first matching file in the
+  FFS volume as defined by SearchType. The search starts from FileHeader inside
+  the Firmware Volume defined by FwVolHeader.
+  If SearchType is EFI_FV_FILETYPE_ALL, the first FFS file will return without check its file type.
+  If SearchType is PEI_CORE_INTERNAL_FFS_FILE_DISPATCH_TYPE,
+  the first PEIM, or COMBINED PEIM or FV file type FFS file will return.
+
+  The FVs known to the PEI Core are searched through their file table, which
+  is built by the first search. Other FVs are walked.
+
+  @param FvHandle        Pointer to the FV header of the volume to search
+  @param FileName        File name
+  @param SearchType      Filter to find only files of this type.
+                         Type EFI_FV_FILETYPE_ALL causes no filtering to be done.
+  @param FileHandle      This parameter must point to a valid FFS volume.
+  @param AprioriFile     Pointer to AprioriFile image in this FV if has
+
+  @return EFI_NOT_FOUND  No files matching the search criteria were found
+  @retval EFI_SUCCESS    Success to search given file
+
+**/
+EFI_STATUS
+FindFileEx (
+  IN  CONST EFI_PEI_FV_HANDLE    FvHandle,
+  IN  CONST EFI_GUID             *FileName    OPTIONAL,
+  IN        EFI_FV_FILETYPE      SearchType,
+  IN OUT    EFI_PEI_FILE_HANDLE  *FileHandle,
+  IN OUT    EFI_PEI_FILE_HANDLE  *AprioriFile  OPTIONAL
+  )
+{
+  PEI_CORE_FV_HANDLE  *CoreFvHandle;
+  PEI_CORE_FV_FILE    *FvFile;
+  UINTN               Index;
+  UINTN               Low;
+  UINTN               High;
+  UINT32              Offset;
+
+  CoreFvHandle = FvHandleToCoreHandle (FvHandle);
+  if ((CoreFvHandle != NULL) && !CoreFvHandle->FileTableBuilt) {
+    BuildFvFileTable (CoreFvHandle);
+  }
+
+  if ((CoreFvHandle == NULL) || (CoreFvHandle->FileTable == NULL)) {
+    return FindFileInFv (FvHandle, FileName, SearchType, FileHandle, AprioriFile);
+  }
+
+  //
+  // Find the table entry to start from.
+  //
+  Index = 0;
+  if ((*FileHandle != NULL) && (FileName == NULL)) {
+    Offset = (UINT32)((UINTN)*FileHandle - (UINTN)FvHandle);
+    Low    = 0;
+    High   = CoreFvHandle->FileCount;
+    while (Low < High) {
+      Index = (Low + High) / 2;
+      if (CoreFvHandle->FileTable[Index].Offset < Offset) {
+        Low = Index + 1;
+      } else {
+        High = Index;
+      }
+    }
+
+    if ((Low == CoreFvHandle->FileCount) || (CoreFvHandle->FileTable[Low].Offset != Offset)) {
+      //
+      // The file to start from is not in the table, e.g. a pad file.
+      //
+      return FindFileInFv (FvHandle, FileName, SearchType, FileHandle, AprioriFile);
+    }
+
+    Index = Low + 1;
+  }
+
+  for ( ; Index < CoreFvHandle->FileCount; Index++) {
+    FvFile = &CoreFvHandle->FileTable[Index];
+    if (FileName != NULL) {
+      if (CompareGuid (&FvFile->Name, FileName)) {
+        break;
+      }
+    } else if (SearchType == PEI_CORE_INTERNAL_FFS_FILE_DISPATCH_TYPE) {
+      if ((FvFile->Type == EFI_FV_FILETYPE_PEIM) ||
+          (FvFile->Type == EFI_FV_FILETYPE_COMBINED_PEIM_DRIVER) ||
+          (FvFile->Type == EFI_FV_FILETYPE_FIRMWARE_VOLUME_IMAGE))
+      {
+        break;
+      } else if (AprioriFile != NULL) {
+        if ((FvFile->Type == EFI_FV_FILETYPE_FREEFORM) && CompareGuid (&FvFile->Name, &gPeiAprioriFileNameGuid)) {
+          *AprioriFile = (EFI_PEI_FILE_HANDLE)((UINT8 *)FvHandle + FvFile->Offset);
+        }
+      }
+    } else if ((SearchType == FvFile->Type) || (SearchType == EFI_FV_FILETYPE_ALL)) {
+      break;
+    }
+  }
+
+  if (Index == CoreFvHandle->FileCount) {
+    *FileHandle = NULL;
+    return EFI_NOT_FOUND;
+  }
+
+  *FileHandle = (EFI_PEI_FILE_HANDLE)((UINT8 *)FvHandle + CoreFvHandle->FileTable[Index].Offset);
+  return EFI_SUCCESS;
+}
+
 /**
   Initialize PeiCore FV List.
 
@@ -77,6 +77,10 @@ typedef struct {
   /// MaxCount number of entries.
   ///
   PEI_PPI_LIST_POINTERS    *PpiPtrs;
+  ///
+  /// MaxCount number of entries, the PpiGuidHash() of the GUID of each PPI.
+  ///
+  UINT32                   *GuidHashes;
 } PEI_PPI_LIST;
 
 typedef struct {
@@ -86,6 +90,10 @@ typedef struct {
   /// MaxCount number of entries.
   ///
   PEI_PPI_LIST_POINTERS    *NotifyPtrs;
+  ///
+  /// MaxCount number of entries, the PpiGuidHash() of the GUID of each Notify.
+  ///
+  UINT32                   *GuidHashes;
 } PEI_CALLBACK_NOTIFY_LIST;
 
 typedef struct {
@@ -96,6 +104,10 @@ typedef struct {
   /// MaxCount number of entries.
   ///
   PEI_PPI_LIST_POINTERS    *NotifyPtrs;
+  ///
+  /// MaxCount number of entries, the PpiGuidHash() of the GUID of each Notify.
+  ///
+  UINT32                   *GuidHashes;
 } PEI_DISPATCH_NOTIFY_LIST;
 
 ///
@@ -132,6 +144,25 @@ typedef struct {
 //
 #define FV_GROWTH_STEP  8
 
+//
+// Number of PEI_CORE_FV_FILE entries a file table starts with. It doubles
+// each time it runs out of room.
+//
+#define FV_FILE_TABLE_INITIAL_COUNT  32
+
+///
+/// A valid FFS file of an FV, recorded in PEI_CORE_FV_HANDLE.FileTable.
+///
+typedef struct {
+  EFI_GUID           Name;
+  ///
+  /// Offset of the FFS file header from the FV header, so the entry stays
+  /// valid when the FV is migrated.
+  ///
+  UINT32             Offset;
+  EFI_FV_FILETYPE    Type;
+} PEI_CORE_FV_FILE;
+
 typedef struct {
   EFI_FIRMWARE_VOLUME_HEADER     *FvHeader;
   EFI_PEI_FIRMWARE_VOLUME_PPI    *FvPpi;
@@ -147,6 +178,13 @@ typedef struct {
   EFI_PEI_FILE_HANDLE            *FvFileHandles;
   BOOLEAN                        ScanFv;
   UINT32                         AuthenticationStatus;
+  //
+  // Pointer to the buffer with the FileCount number of entries, the valid
+  // non-pad files of the FV in FV order. Built by the first file lookup.
+  //
+  BOOLEAN                        FileTableBuilt;
+  UINTN                          FileCount;
+  PEI_CORE_FV_FILE               *FileTable;
 } PEI_CORE_FV_HANDLE;
 
 typedef struct {
@@ -431,6 +469,19 @@ EvacuateTempRam (
   IN CONST EFI_SEC_PEI_HAND_OFF  *SecCoreData
   );
 
+/**
+  Copy the FVs that are outside of permanent memory, typically memory-mapped
+  flash, to permanent memory, each in one bulk copy, and re-point their FV and
+  file handles to the copies.
+
+  @param Private         PeiCore's private data structure
+
+**/
+VOID
+ShadowFirmwareVolumes (
+  IN PEI_CORE_INSTANCE  *Private
+  );
+
 /**
   Conduct PEIM dispatch.
 
@@ -224,14 +224,26 @@ PeiCore (
           OldCoreData->PpiData.PpiList.PpiPtrs = (PEI_PPI_LIST_POINTERS *)((UINT8 *)OldCoreData->PpiData.PpiList.PpiPtrs + OldCoreData->HeapOffset);
         }
 
+        if (OldCoreData->PpiData.PpiList.GuidHashes != NULL) {
+          OldCoreData->PpiData.PpiList.GuidHashes = (UINT32 *)((UINT8 *)OldCoreData->PpiData.PpiList.GuidHashes + OldCoreData->HeapOffset);
+        }
+
         if (OldCoreData->PpiData.CallbackNotifyList.NotifyPtrs != NULL) {
           OldCoreData->PpiData.CallbackNotifyList.NotifyPtrs = (PEI_PPI_LIST_POINTERS *)((UINT8 *)OldCoreData->PpiData.CallbackNotifyList.NotifyPtrs + OldCoreData->HeapOffset);
         }
 
+        if (OldCoreData->PpiData.CallbackNotifyList.GuidHashes != NULL) {
+          OldCoreData->PpiData.CallbackNotifyList.GuidHashes = (UINT32 *)((UINT8 *)OldCoreData->PpiData.CallbackNotifyList.GuidHashes + OldCoreData->HeapOffset);
+        }
+
         if (OldCoreData->PpiData.DispatchNotifyList.NotifyPtrs != NULL) {
           OldCoreData->PpiData.DispatchNotifyList.NotifyPtrs = (PEI_PPI_LIST_POINTERS *)((UINT8 *)OldCoreData->PpiData.DispatchNotifyList.NotifyPtrs + OldCoreData->HeapOffset);
         }
 
+        if (OldCoreData->PpiData.DispatchNotifyList.GuidHashes != NULL) {
+          OldCoreData->PpiData.DispatchNotifyList.GuidHashes = (UINT32 *)((UINT8 *)OldCoreData->PpiData.DispatchNotifyList.GuidHashes + OldCoreData->HeapOffset);
+        }
+
         OldCoreData->Fv = (PEI_CORE_FV_HANDLE *)((UINT8 *)OldCoreData->Fv + OldCoreData->HeapOffset);
         for (Index = 0; Index < OldCoreData->FvCount; Index++) {
           if (OldCoreData->Fv[Index].PeimState != NULL) {
@@ -241,6 +253,10 @@ PeiCore (
           if (OldCoreData->Fv[Index].FvFileHandles != NULL) {
             OldCoreData->Fv[Index].FvFileHandles = (EFI_PEI_FILE_HANDLE *)((UINT8 *)OldCoreData->Fv[Index].FvFileHandles + OldCoreData->HeapOffset);
           }
+
+          if (OldCoreData->Fv[Index].FileTable != NULL) {
+            OldCoreData->Fv[Index].FileTable = (PEI_CORE_FV_FILE *)((UINT8 *)OldCoreData->Fv[Index].FileTable + OldCoreData->HeapOffset);
+          }
         }
 
         OldCoreData->TempFileGuid    = (EFI_GUID *)((UINT8 *)OldCoreData->TempFileGuid + OldCoreData->HeapOffset);
@@ -259,14 +275,26 @@ PeiCore (
           OldCoreData->PpiData.PpiList.PpiPtrs = (PEI_PPI_LIST_POINTERS *)((UINT8 *)OldCoreData->PpiData.PpiList.PpiPtrs - OldCoreData->HeapOffset);
         }
 
+        if (OldCoreData->PpiData.PpiList.GuidHashes != NULL) {
+          OldCoreData->PpiData.PpiList.GuidHashes = (UINT32 *)((UINT8 *)OldCoreData->PpiData.PpiList.GuidHashes - OldCoreData->HeapOffset);
+        }
+
         if (OldCoreData->PpiData.CallbackNotifyList.NotifyPtrs != NULL) {
           OldCoreData->PpiData.CallbackNotifyList.NotifyPtrs = (PEI_PPI_LIST_POINTERS *)((UINT8 *)OldCoreData->PpiData.CallbackNotifyList.NotifyPtrs - OldCoreData->HeapOffset);
         }
 
+        if (OldCoreData->PpiData.CallbackNotifyList.GuidHashes != NULL) {
+          OldCoreData->PpiData.CallbackNotifyList.GuidHashes = (UINT32 *)((UINT8 *)OldCoreData->PpiData.CallbackNotifyList.GuidHashes - OldCoreData->HeapOffset);
+        }
+
         if (OldCoreData->PpiData.DispatchNotifyList.NotifyPtrs != NULL) {
           OldCoreData->PpiData.DispatchNotifyList.NotifyPtrs = (PEI_PPI_LIST_POINTERS *)((UINT8 *)OldCoreData->PpiData.DispatchNotifyList.NotifyPtrs - OldCoreData->HeapOffset);
         }
 
+        if (OldCoreData->PpiData.DispatchNotifyList.GuidHashes != NULL) {
+          OldCoreData->PpiData.DispatchNotifyList.GuidHashes = (UINT32 *)((UINT8 *)OldCoreData->PpiData.DispatchNotifyList.GuidHashes - OldCoreData->HeapOffset);
+        }
+
         OldCoreData->Fv = (PEI_CORE_FV_HANDLE *)((UINT8 *)OldCoreData->Fv - OldCoreData->HeapOffset);
         for (Index = 0; Index < OldCoreData->FvCount; Index++) {
           if (OldCoreData->Fv[Index].PeimState != NULL) {
@@ -276,6 +304,10 @@ PeiCore (
           if (OldCoreData->Fv[Index].FvFileHandles != NULL) {
             OldCoreData->Fv[Index].FvFileHandles = (EFI_PEI_FILE_HANDLE *)((UINT8 *)OldCoreData->Fv[Index].FvFileHandles - OldCoreData->HeapOffset);
           }
+
+          if (OldCoreData->Fv[Index].FileTable != NULL) {
+            OldCoreData->Fv[Index].FileTable = (PEI_CORE_FV_FILE *)((UINT8 *)OldCoreData->Fv[Index].FileTable - OldCoreData->HeapOffset);
+          }
         }
 
         OldCoreData->TempFileGuid    = (EFI_GUID *)((UINT8 *)OldCoreData->TempFileGuid - OldCoreData->HeapOffset);
@@ -475,6 +507,11 @@ PeiCore (
 
       DEBUG ((DEBUG_VERBOSE, "PPI lists after temporary RAM evacuation:\n"));
       DumpPpiList (&PrivateData);
+    } else if (PcdGetBool (PcdShadowFirmwareVolumesAfterMemory)) {
+      //
+      // Read the rest of the PEI phase from DRAM instead of from flash.
+      //
+      ShadowFirmwareVolumes (&PrivateData);
     }
 
     //
@@ -8,6 +8,62 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include "PeiMain.h"
 
+/**
+  Compute the hash of a PPI GUID that is kept next to the PPI and Notify lists,
+  so that searching a list only touches the GUIDs whose hash matches.
+
+  The hash only depends on the GUID value, so it stays valid when the PPI
+  descriptors are migrated to permanent memory.
+
+  @param Guid            The GUID of the PPI or Notify.
+
+  @return The hash of the GUID.
+
+**/
+UINT32
+PpiGuidHash (
+  IN CONST EFI_GUID  *Guid
+  )
+{
+  return ((CONST UINT32 *)Guid)[0] ^ ((CONST UINT32 *)Guid)[1] ^
+         ((CONST UINT32 *)Guid)[2] ^ ((CONST UINT32 *)Guid)[3];
+}
+
+/**
+  Grow a PPI or Notify list together with its GUID hashes.
+
+  @param ListPtrs        On input, the entries of the list.
+                         On output, the grown entries.
+  @param GuidHashes      On input, the GUID hashes of the list.
+                         On output, the grown GUID hashes.
+  @param MaxCount        On input, the number of entries.
+                         On output, the grown number of entries.
+  @param GrowthStep      The number of entries to grow by.
+
+**/
+VOID
+GrowPpiList (
+  IN OUT PEI_PPI_LIST_POINTERS  **ListPtrs,
+  IN OUT UINT32                 **GuidHashes,
+  IN OUT UINTN                  *MaxCount,
+  IN     UINTN                  GrowthStep
+  )
+{
+  VOID  *TempPtr;
+
+  TempPtr = AllocateZeroPool (sizeof (PEI_PPI_LIST_POINTERS) * (*MaxCount + GrowthStep));
+  ASSERT (TempPtr != NULL);
+  CopyMem (TempPtr, *ListPtrs, sizeof (PEI_PPI_LIST_POINTERS) * *MaxCount);
+  *ListPtrs = TempPtr;
+
+  TempPtr = AllocateZeroPool (sizeof (UINT32) * (*MaxCount + GrowthStep));
+  ASSERT (TempPtr != NULL);
+  CopyMem (TempPtr, *GuidHashes, sizeof (UINT32) * *MaxCount);
+  *GuidHashes = TempPtr;
+
+  *MaxCount = *MaxCount + GrowthStep;
+}
+
 /**
 
   Migrate Pointer from the temporary memory to PEI installed memory.
@@ -456,7 +512,6 @@ InternalPeiInstallPpi (
   PEI_PPI_LIST       *PpiListPointer;
   UINTN              Index;
   UINTN              LastCount;
-  VOID               *TempPtr;
 
   if (PpiList == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -490,21 +545,17 @@ InternalPeiInstallPpi (
       //
       // Run out of room, grow the buffer.
       //
-      TempPtr = AllocateZeroPool (
-                  sizeof (PEI_PPI_LIST_POINTERS) * (PpiListPointer->MaxCount + PPI_GROWTH_STEP)
-                  );
-      ASSERT (TempPtr != NULL);
-      CopyMem (
-        TempPtr,
-        PpiListPointer->PpiPtrs,
-        sizeof (PEI_PPI_LIST_POINTERS) * PpiListPointer->MaxCount
+      GrowPpiList (
+        &PpiListPointer->PpiPtrs,
+        &PpiListPointer->GuidHashes,
+        &PpiListPointer->MaxCount,
+        PPI_GROWTH_STEP
         );
-      PpiListPointer->PpiPtrs  = TempPtr;
-      PpiListPointer->MaxCount = PpiListPointer->MaxCount + PPI_GROWTH_STEP;
     }
 
     DEBUG ((DEBUG_INFO, "Install PPI: %g\n", PpiList->Guid));
     PpiListPointer->PpiPtrs[Index].Ppi = (EFI_PEI_PPI_DESCRIPTOR *)PpiList;
+    PpiListPointer->GuidHashes[Index]  = PpiGuidHash (PpiList->Guid);
     Index++;
     PpiListPointer->CurrentCount++;
 
@@ -625,6 +676,7 @@ PeiReInstallPpi (
   //
   DEBUG ((DEBUG_INFO, "Reinstall PPI: %g\n", NewPpi->Guid));
   PrivateData->PpiData.PpiList.PpiPtrs[Index].Ppi = (EFI_PEI_PPI_DESCRIPTOR *)NewPpi;
+  PrivateData->PpiData.PpiList.GuidHashes[Index]  = PpiGuidHash (NewPpi->Guid);
 
   //
   // Process any callback level notifies for the newly installed PPI.
@@ -671,13 +723,20 @@ PeiLocatePpi (
   UINTN                   Index;
   EFI_GUID                *CheckGuid;
   EFI_PEI_PPI_DESCRIPTOR  *TempPtr;
+  UINT32                  GuidHash;
 
   PrivateData = PEI_CORE_INSTANCE_FROM_PS_THIS (PeiServices);
+  GuidHash    = PpiGuidHash (Guid);
 
   //
   // Search the data base for the matching instance of the GUIDed PPI.
+  // Only the PPIs whose GUID hash matches need their GUID to be compared.
   //
   for (Index = 0; Index < PrivateData->PpiData.PpiList.CurrentCount; Index++) {
+    if (PrivateData->PpiData.PpiList.GuidHashes[Index] != GuidHash) {
+      continue;
+    }
+
     TempPtr   = PrivateData->PpiData.PpiList.PpiPtrs[Index].Ppi;
     CheckGuid = TempPtr->Guid;
 
@@ -741,7 +800,6 @@ InternalPeiNotifyPpi (
   PEI_DISPATCH_NOTIFY_LIST  *DispatchNotifyListPointer;
   UINTN                     DispatchNotifyIndex;
   UINTN                     LastDispatchNotifyCount;
-  VOID                      *TempPtr;
 
   if (NotifyList == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -779,20 +837,16 @@ InternalPeiNotifyPpi (
         //
         // Run out of room, grow the buffer.
         //
-        TempPtr = AllocateZeroPool (
-                    sizeof (PEI_PPI_LIST_POINTERS) * (CallbackNotifyListPointer->MaxCount + CALLBACK_NOTIFY_GROWTH_STEP)
-                    );
-        ASSERT (TempPtr != NULL);
-        CopyMem (
-          TempPtr,
-          CallbackNotifyListPointer->NotifyPtrs,
-          sizeof (PEI_PPI_LIST_POINTERS) * CallbackNotifyListPointer->MaxCount
+        GrowPpiList (
+          &CallbackNotifyListPointer->NotifyPtrs,
+          &CallbackNotifyListPointer->GuidHashes,
+          &CallbackNotifyListPointer->MaxCount,
+          CALLBACK_NOTIFY_GROWTH_STEP
           );
-        CallbackNotifyListPointer->NotifyPtrs = TempPtr;
-        CallbackNotifyListPointer->MaxCount   = CallbackNotifyListPointer->MaxCount + CALLBACK_NOTIFY_GROWTH_STEP;
       }
 
       CallbackNotifyListPointer->NotifyPtrs[CallbackNotifyIndex].Notify = (EFI_PEI_NOTIFY_DESCRIPTOR *)NotifyList;
+      CallbackNotifyListPointer->GuidHashes[CallbackNotifyIndex]        = PpiGuidHash (NotifyList->Guid);
       CallbackNotifyIndex++;
       CallbackNotifyListPointer->CurrentCount++;
     } else {
@@ -800,20 +854,16 @@ InternalPeiNotifyPpi (
         //
         // Run out of room, grow the buffer.
         //
-        TempPtr = AllocateZeroPool (
-                    sizeof (PEI_PPI_LIST_POINTERS) * (DispatchNotifyListPointer->MaxCount + DISPATCH_NOTIFY_GROWTH_STEP)
-                    );
-        ASSERT (TempPtr != NULL);
-        CopyMem (
-          TempPtr,
-          DispatchNotifyListPointer->NotifyPtrs,
-          sizeof (PEI_PPI_LIST_POINTERS) * DispatchNotifyListPointer->MaxCount
+        GrowPpiList (
+          &DispatchNotifyListPointer->NotifyPtrs,
+          &DispatchNotifyListPointer->GuidHashes,
+          &DispatchNotifyListPointer->MaxCount,
+          DISPATCH_NOTIFY_GROWTH_STEP
           );
-        DispatchNotifyListPointer->NotifyPtrs = TempPtr;
-        DispatchNotifyListPointer->MaxCount   = DispatchNotifyListPointer->MaxCount + DISPATCH_NOTIFY_GROWTH_STEP;
       }
 
       DispatchNotifyListPointer->NotifyPtrs[DispatchNotifyIndex].Notify = (EFI_PEI_NOTIFY_DESCRIPTOR *)NotifyList;
+      DispatchNotifyListPointer->GuidHashes[DispatchNotifyIndex]        = PpiGuidHash (NotifyList->Guid);
       DispatchNotifyIndex++;
       DispatchNotifyListPointer->CurrentCount++;
     }
@@ -971,17 +1021,29 @@ ProcessNotify (
   EFI_GUID                   *SearchGuid;
   EFI_GUID                   *CheckGuid;
   EFI_PEI_NOTIFY_DESCRIPTOR  *NotifyDescriptor;
+  UINT32                     GuidHash;
 
   for (Index1 = NotifyStartIndex; Index1 < NotifyStopIndex; Index1++) {
     if (NotifyType == EFI_PEI_PPI_DESCRIPTOR_NOTIFY_CALLBACK) {
       NotifyDescriptor = PrivateData->PpiData.CallbackNotifyList.NotifyPtrs[Index1].Notify;
+      GuidHash         = PrivateData->PpiData.CallbackNotifyList.GuidHashes[Index1];
     } else {
       NotifyDescriptor = PrivateData->PpiData.DispatchNotifyList.NotifyPtrs[Index1].Notify;
+      GuidHash         = PrivateData->PpiData.DispatchNotifyList.GuidHashes[Index1];
     }
 
     CheckGuid = NotifyDescriptor->Guid;
 
     for (Index2 = InstallStartIndex; Index2 < InstallStopIndex; Index2++) {
+      //
+      // Only the PPIs whose GUID hash matches need their GUID to be compared.
+      // The hashes are re-read from PrivateData since a notify function may
+      // install PPIs and grow the list.
+      //
+      if (PrivateData->PpiData.PpiList.GuidHashes[Index2] != GuidHash) {
+        continue;
+      }
+
       SearchGuid = PrivateData->PpiData.PpiList.PpiPtrs[Index2].Ppi->Guid;
       //
       // Don't use CompareGuid function here for performance reasons.
@@ -14,6 +14,12 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 //
 GLOBAL_REMOVE_IF_UNREFERENCED BOOLEAN  mOnGuarding = FALSE;
 
+//
+// Number of allocations of the guarded types made without Guard since the
+// last guarded one, when PcdHeapGuardSamplingRate enables sampling.
+//
+GLOBAL_REMOVE_IF_UNREFERENCED UINT32  mGuardSamplingCount = 0;
+
 //
 // Pointer to table tracking the Guarded memory with bitmap, in which  '1'
 // is used to indicate memory guarded. '0' might be free memory or Guard
@@ -663,6 +669,38 @@ IsPageTypeToGuard (
   return IsMemoryTypeToGuard (MemoryType, AllocateType, GUARD_HEAP_TYPE_PAGE);
 }
 
+/**
+  Check to see if the allocation being made, whose type is to be guarded, is
+  picked for Guard by PcdHeapGuardSamplingRate.
+
+  Only one out of every PcdHeapGuardSamplingRate allocations of the guarded
+  types gets Guard pages. The others take the fast path without any change
+  of page table attributes.
+
+  @return TRUE  The allocation should be guarded.
+  @return FALSE The allocation should be made without Guard.
+**/
+BOOLEAN
+IsAllocationSampledToGuard (
+  VOID
+  )
+{
+  UINT32  SamplingRate;
+
+  SamplingRate = PcdGet32 (PcdHeapGuardSamplingRate);
+  if (SamplingRate <= 1) {
+    return TRUE;
+  }
+
+  mGuardSamplingCount++;
+  if (mGuardSamplingCount < SamplingRate) {
+    return FALSE;
+  }
+
+  mGuardSamplingCount = 0;
+  return TRUE;
+}
+
 /**
   Check to see if the heap guard is enabled for page and/or pool allocation.
 
@@ -958,5 +958,9 @@ SmmMain (
 
   SmmCoreInitializeSmiHandlerProfile ();
 
+  SmmCoreInitializeSmiLatencyHistogram ();
+
+  SmmCoreInstallParallelSmiHandlerProtocol ();
+
   return EFI_SUCCESS;
 }
@@ -28,6 +28,8 @@
 #include <Protocol/SmmReadyToBoot.h>
 #include <Protocol/SmmMemoryAttribute.h>
 #include <Protocol/SmmSxDispatch2.h>
+#include <Protocol/SmmParallelSmiHandler.h>
+#include <Protocol/MmMp.h>
 
 #include <Guid/Apriori.h>
 #include <Guid/EventGroup.h>
@@ -35,6 +37,7 @@
 #include <Guid/MemoryProfile.h>
 #include <Guid/LoadModuleAtFixedAddress.h>
 #include <Guid/SmiHandlerProfile.h>
+#include <Guid/SmiLatencyHistogram.h>
 #include <Guid/EndOfS3Resume.h>
 #include <Guid/S3SmmInitDone.h>
 
@@ -52,6 +55,7 @@
 #include <Library/PcdLib.h>
 #include <Library/SmmCorePlatformHookLib.h>
 #include <Library/PerformanceLib.h>
+#include <Library/TimerLib.h>
 #include <Library/HobLib.h>
 #include <Library/SmmMemLib.h>
 #include <Library/SafeIntLib.h>
@@ -94,6 +98,11 @@ typedef struct {
   VOID                            *Context;    // for profile
   UINTN                           ContextSize; // for profile
   BOOLEAN                         ToRemove;    // To remove this SMI_HANDLER later
+  BOOLEAN                         Parallel;    // Root SMI handler which may run on an AP
+  BOOLEAN                         OnAp;        // Running on an AP in the current SMI
+  MM_COMPLETION                   Token;       // Completion token of the AP procedure
+  EFI_STATUS                      Status;      // Status returned by the handler on the AP
+  SMI_LATENCY_HISTOGRAM           *Latency;    // Handler time histogram, or NULL
 } SMI_HANDLER;
 
 //
@@ -1142,6 +1151,14 @@ SmmCoreGetMemoryMap (
   OUT UINT32                    *DescriptorVersion
   );
 
+/**
+  Install the EDKII SMM Parallel SMI Handler protocol.
+**/
+VOID
+SmmCoreInstallParallelSmiHandlerProtocol (
+  VOID
+  );
+
 /**
   Initialize SmiHandler profile feature.
 **/
@@ -1150,6 +1167,26 @@ SmmCoreInitializeSmiHandlerProfile (
   VOID
   );
 
+/**
+  Initialize SMI latency histogram feature.
+**/
+VOID
+SmmCoreInitializeSmiLatencyHistogram (
+  VOID
+  );
+
+/**
+  Record one latency in a histogram.
+
+  @param[in, out] Histogram   The histogram.
+  @param[in]      StartTicks  The performance counter value at the start.
+**/
+VOID
+SmiLatencyHistogramRecord (
+  IN OUT SMI_LATENCY_HISTOGRAM  *Histogram,
+  IN     UINT64                 StartTicks
+  );
+
 /**
   This function is called by SmmChildDispatcher module to report
   a new SMI handler is registered, to SmmCore.
@@ -1213,6 +1250,9 @@ extern EFI_SMRAM_DESCRIPTOR  *mFullSmramRanges;
 
 extern EFI_SMM_DRIVER_ENTRY  *mSmmCoreDriverEntry;
 
+extern LIST_ENTRY  mSmiEntryList;
+extern SMI_ENTRY   mRootSmiEntry;
+
 extern EFI_LOADED_IMAGE_PROTOCOL  *mSmmCoreLoadedImage;
 
 //
@@ -256,7 +256,7 @@ SmmInternalAllocatePool (
     return EFI_INVALID_PARAMETER;
   }
 
-  NeedGuard   = IsPoolTypeToGuard (PoolType);
+  NeedGuard   = IsPoolTypeToGuard (PoolType) && IsAllocationSampledToGuard ();
   HasPoolTail = !(NeedGuard &&
                   ((PcdGet8 (PcdHeapGuardPropertyMask) & BIT7) == 0));
 
@@ -22,6 +22,37 @@ SMI_ENTRY  mRootSmiEntry = {
   INITIALIZE_LIST_HEAD_VARIABLE (mRootSmiEntry.SmiHandlers),
 };
 
+//
+// The MM MP protocol used to run parallel-safe root SMI handlers on APs, and
+// the parameters of the root SMI handlers in the current SMI.
+//
+EFI_MM_MP_PROTOCOL  *mSmmMp                     = NULL;
+CONST VOID          *mParallelSmiContext        = NULL;
+VOID                *mParallelSmiCommBuffer     = NULL;
+UINTN               *mParallelSmiCommBufferSize = NULL;
+
+/**
+  Declare a root SMI handler safe to run on an AP, in parallel with the BSP
+  and with the other root SMI handlers.
+
+  @param[in]  This            The EDKII_SMM_PARALLEL_SMI_HANDLER_PROTOCOL instance.
+  @param[in]  DispatchHandle  The handle returned by SmiHandlerRegister() for a root
+                              SMI handler.
+
+  @retval EFI_SUCCESS            The handler is declared parallel-safe.
+  @retval EFI_INVALID_PARAMETER  DispatchHandle does not refer to a root SMI handler.
+**/
+EFI_STATUS
+EFIAPI
+SmiHandlerSetParallel (
+  IN EDKII_SMM_PARALLEL_SMI_HANDLER_PROTOCOL  *This,
+  IN EFI_HANDLE                               DispatchHandle
+  );
+
+EDKII_SMM_PARALLEL_SMI_HANDLER_PROTOCOL  mSmmParallelSmiHandler = {
+  SmiHandlerSetParallel
+};
+
 /**
   Finds the SMI entry for the requested handler type.
 
@@ -102,6 +133,10 @@ RemoveSmiHandler (
 {
   ASSERT (SmiHandler->ToRemove);
   RemoveEntryList (&SmiHandler->Link);
+  if (SmiHandler->Latency != NULL) {
+    FreePool (SmiHandler->Latency);
+  }
+
   FreePool (SmiHandler);
 
   //
@@ -118,6 +153,115 @@ RemoveSmiHandler (
   return FALSE;
 }
 
+/**
+  Run a parallel-safe root SMI handler on an AP.
+
+  @param[in, out]  ProcedureArgument  The SMI_HANDLER of the root SMI handler.
+
+  @retval EFI_SUCCESS  The root SMI handler has run, its return status is in
+                       the SMI_HANDLER.
+**/
+EFI_STATUS
+EFIAPI
+ParallelSmiHandlerProcedure (
+  IN OUT VOID  *ProcedureArgument
+  )
+{
+  SMI_HANDLER  *SmiHandler;
+  UINT64       StartTicks;
+
+  SmiHandler = (SMI_HANDLER *)ProcedureArgument;
+  StartTicks = (SmiHandler->Latency != NULL) ? GetPerformanceCounter () : 0;
+
+  SmiHandler->Status = SmiHandler->Handler (
+                                    (EFI_HANDLE)SmiHandler,
+                                    mParallelSmiContext,
+                                    mParallelSmiCommBuffer,
+                                    mParallelSmiCommBufferSize
+                                    );
+
+  if (SmiHandler->Latency != NULL) {
+    SmiLatencyHistogramRecord (SmiHandler->Latency, StartTicks);
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Start the parallel-safe root SMI handlers on the APs that are in SMM.
+
+  A root SMI handler that cannot be started on an AP is left to run on the BSP.
+
+  @return The number of root SMI handlers started on APs.
+**/
+UINTN
+StartParallelSmiHandlers (
+  VOID
+  )
+{
+  LIST_ENTRY   *Link;
+  SMI_HANDLER  *SmiHandler;
+  UINTN        CpuIndex;
+  UINTN        Tries;
+  UINTN        Started;
+  EFI_STATUS   Status;
+
+  if (gSmmCoreSmst.NumberOfCpus < 2) {
+    return 0;
+  }
+
+  if (mSmmMp == NULL) {
+    Status = SmmLocateProtocol (&gEfiMmMpProtocolGuid, NULL, (VOID **)&mSmmMp);
+    if (EFI_ERROR (Status)) {
+      mSmmMp = NULL;
+      return 0;
+    }
+  }
+
+  CpuIndex = gSmmCoreSmst.CurrentlyExecutingCpu;
+  Started  = 0;
+  for (Link = mRootSmiEntry.SmiHandlers.ForwardLink; Link != &mRootSmiEntry.SmiHandlers; Link = Link->ForwardLink) {
+    SmiHandler = CR (Link, SMI_HANDLER, Link, SMI_HANDLER_SIGNATURE);
+    if (!SmiHandler->Parallel || SmiHandler->ToRemove) {
+      continue;
+    }
+
+    //
+    // Spread the handlers over the APs, starting after the last AP used.
+    //
+    for (Tries = 0; Tries < gSmmCoreSmst.NumberOfCpus; Tries++) {
+      CpuIndex = (CpuIndex + 1) % gSmmCoreSmst.NumberOfCpus;
+      if (CpuIndex == gSmmCoreSmst.CurrentlyExecutingCpu) {
+        continue;
+      }
+
+      Status = mSmmMp->DispatchProcedure (
+                         mSmmMp,
+                         ParallelSmiHandlerProcedure,
+                         CpuIndex,
+                         0,
+                         SmiHandler,
+                         &SmiHandler->Token,
+                         NULL
+                         );
+      if (!EFI_ERROR (Status)) {
+        SmiHandler->OnAp = TRUE;
+        Started++;
+        break;
+      }
+    }
+
+    if (!SmiHandler->OnAp) {
+      //
+      // No AP is available, run the remaining handlers on the BSP.
+      //
+      break;
+    }
+  }
+
+  return Started;
+}
+
 /**
   Manage SMI of a particular type.
 
@@ -149,17 +293,30 @@ SmiManage (
   EFI_STATUS   ReturnStatus;
   BOOLEAN      WillReturn;
   EFI_STATUS   Status;
+  UINTN        ParallelCount;
+  UINT64       StartTicks;
 
   PERF_FUNCTION_BEGIN ();
   mSmiManageCallingDepth++;
-  WillReturn   = FALSE;
-  Status       = EFI_NOT_FOUND;
-  ReturnStatus = Status;
+  WillReturn    = FALSE;
+  Status        = EFI_NOT_FOUND;
+  ReturnStatus  = Status;
+  ParallelCount = 0;
   if (HandlerType == NULL) {
     //
     // Root SMI handler
     //
     SmiEntry = &mRootSmiEntry;
+
+    //
+    // Fan the parallel-safe root SMI handlers out to the APs first.
+    //
+    if (mSmiManageCallingDepth == 1) {
+      mParallelSmiContext        = Context;
+      mParallelSmiCommBuffer     = CommBuffer;
+      mParallelSmiCommBufferSize = CommBufferSize;
+      ParallelCount              = StartParallelSmiHandlers ();
+    }
   } else {
     //
     // Non-root SMI handler
@@ -178,6 +335,11 @@ SmiManage (
 
   for (Link = Head->ForwardLink; Link != Head; Link = Link->ForwardLink) {
     SmiHandler = CR (Link, SMI_HANDLER, Link, SMI_HANDLER_SIGNATURE);
+    if (SmiHandler->OnAp) {
+      continue;
+    }
+
+    StartTicks = (SmiHandler->Latency != NULL) ? GetPerformanceCounter () : 0;
 
     Status = SmiHandler->Handler (
                            (EFI_HANDLE)SmiHandler,
@@ -186,6 +348,10 @@ SmiManage (
                            CommBufferSize
                            );
 
+    if (SmiHandler->Latency != NULL) {
+      SmiLatencyHistogramRecord (SmiHandler->Latency, StartTicks);
+    }
+
     switch (Status) {
       case EFI_INTERRUPT_PENDING:
         //
@@ -254,6 +420,43 @@ SmiManage (
     }
   }
 
+  //
+  // Collect the results of the root SMI handlers that ran on APs, the same way
+  // as the results of the root SMI handlers that ran on the BSP.
+  //
+  for (Link = Head->ForwardLink; (ParallelCount > 0) && (Link != Head); Link = Link->ForwardLink) {
+    SmiHandler = CR (Link, SMI_HANDLER, Link, SMI_HANDLER_SIGNATURE);
+    if (!SmiHandler->OnAp) {
+      continue;
+    }
+
+    mSmmMp->WaitForProcedure (mSmmMp, SmiHandler->Token);
+    SmiHandler->OnAp = FALSE;
+    ParallelCount--;
+
+    switch (SmiHandler->Status) {
+      case EFI_SUCCESS:
+      case EFI_WARN_INTERRUPT_SOURCE_QUIESCED:
+        ReturnStatus = EFI_SUCCESS;
+        break;
+
+      case EFI_INTERRUPT_PENDING:
+      case EFI_WARN_INTERRUPT_SOURCE_PENDING:
+        if (ReturnStatus != EFI_SUCCESS) {
+          ReturnStatus = SmiHandler->Status;
+        }
+
+        break;
+
+      default:
+        //
+        // Unexpected status code returned.
+        //
+        ASSERT (FALSE);
+        break;
+    }
+  }
+
   ASSERT (mSmiManageCallingDepth > 0);
   mSmiManageCallingDepth--;
 
@@ -370,6 +573,13 @@ SmiHandlerRegister (
     }
   }
 
+  if (FeaturePcdGet (PcdSmiLatencyHistogramEnable)) {
+    //
+    // The handler is still dispatched if its histogram cannot be allocated.
+    //
+    SmiHandler->Latency = AllocateZeroPool (sizeof (SMI_LATENCY_HISTOGRAM));
+  }
+
   List = &SmiEntry->SmiHandlers;
 
   SmiHandler->SmiEntry = SmiEntry;
@@ -458,3 +668,56 @@ SmiHandlerUnRegister (
   RemoveSmiHandler (SmiHandler, (SmiEntry == &mRootSmiEntry) ? NULL : SmiEntry);
   return EFI_SUCCESS;
 }
+
+/**
+  Declare a root SMI handler safe to run on an AP, in parallel with the BSP
+  and with the other root SMI handlers.
+
+  @param[in]  This            The EDKII_SMM_PARALLEL_SMI_HANDLER_PROTOCOL instance.
+  @param[in]  DispatchHandle  The handle returned by SmiHandlerRegister() for a root
+                              SMI handler.
+
+  @retval EFI_SUCCESS            The handler is declared parallel-safe.
+  @retval EFI_INVALID_PARAMETER  DispatchHandle does not refer to a root SMI handler.
+**/
+EFI_STATUS
+EFIAPI
+SmiHandlerSetParallel (
+  IN EDKII_SMM_PARALLEL_SMI_HANDLER_PROTOCOL  *This,
+  IN EFI_HANDLE                               DispatchHandle
+  )
+{
+  LIST_ENTRY   *Link;
+  SMI_HANDLER  *SmiHandler;
+
+  for (Link = mRootSmiEntry.SmiHandlers.ForwardLink; Link != &mRootSmiEntry.SmiHandlers; Link = Link->ForwardLink) {
+    SmiHandler = CR (Link, SMI_HANDLER, Link, SMI_HANDLER_SIGNATURE);
+    if (((EFI_HANDLE)SmiHandler == DispatchHandle) && !SmiHandler->ToRemove) {
+      SmiHandler->Parallel = TRUE;
+      return EFI_SUCCESS;
+    }
+  }
+
+  return EFI_INVALID_PARAMETER;
+}
+
+/**
+  Install the EDKII SMM Parallel SMI Handler protocol.
+**/
+VOID
+SmmCoreInstallParallelSmiHandlerProtocol (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+  EFI_HANDLE  Handle;
+
+  Handle = NULL;
+  Status = SmmInstallProtocolInterface (
+             &Handle,
+             &gEdkiiSmmParallelSmiHandlerProtocolGuid,
+             EFI_NATIVE_INTERFACE,
+             &mSmmParallelSmiHandler
+             );
+  ASSERT_EFI_ERROR (Status);
+}
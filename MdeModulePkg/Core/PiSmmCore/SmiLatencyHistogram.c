@@ -0,0 +1,315 @@
+/** @file
+  SMI handler latency histogram support.
+
+  Every SMI handler gets a log2 histogram of the time it takes, which can be
+  read through gSmiLatencyHistogramGuid SMM communication at OS runtime.
+
+Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "PiSmmCore.h"
+
+typedef struct {
+  //
+  // The buffer to copy the records to, or NULL.
+  //
+  UINT8      *DataBuffer;
+  UINT64     DataSize;
+  UINT64     DataOffset;
+  //
+  // Clear the histograms instead of copying them.
+  //
+  BOOLEAN    Reset;
+  //
+  // The offset of the next record.
+  //
+  UINT64     Offset;
+} SMI_LATENCY_HISTOGRAM_WALK;
+
+//
+// Number of counts in a roll-over cycle of the performance counter.
+//
+UINT64  mSmiLatencyCycle = 0;
+//
+// Flag to indicate the performance counter is count-up or count-down.
+//
+BOOLEAN  mSmiLatencyCountDown = FALSE;
+
+/**
+  Record one latency in a histogram.
+
+  @param[in, out] Histogram   The histogram.
+  @param[in]      StartTicks  The performance counter value at the start.
+**/
+VOID
+SmiLatencyHistogramRecord (
+  IN OUT SMI_LATENCY_HISTOGRAM  *Histogram,
+  IN     UINT64                 StartTicks
+  )
+{
+  UINT64  CurrentTicks;
+  UINT64  Delta;
+  UINT64  NanoSeconds;
+  UINTN   Bucket;
+
+  CurrentTicks = GetPerformanceCounter ();
+  if (mSmiLatencyCountDown) {
+    Delta = (CurrentTicks <= StartTicks) ? StartTicks - CurrentTicks : mSmiLatencyCycle - (CurrentTicks - StartTicks) + 1;
+  } else {
+    Delta = (CurrentTicks >= StartTicks) ? CurrentTicks - StartTicks : mSmiLatencyCycle - (StartTicks - CurrentTicks) + 1;
+  }
+
+  NanoSeconds = GetTimeInNanoSecond (Delta);
+  Bucket      = (NanoSeconds < 2) ? 0 : (UINTN)HighBitSet64 (NanoSeconds);
+  if (Bucket >= SMI_LATENCY_HISTOGRAM_BUCKET_COUNT) {
+    Bucket = SMI_LATENCY_HISTOGRAM_BUCKET_COUNT - 1;
+  }
+
+  Histogram->Count++;
+  Histogram->TotalNanoSeconds += NanoSeconds;
+  if (NanoSeconds > Histogram->MaxNanoSeconds) {
+    Histogram->MaxNanoSeconds = NanoSeconds;
+  }
+
+  Histogram->Bucket[Bucket]++;
+}
+
+/**
+  Copy or clear the histograms of the SMI handlers of an SMI entry.
+
+  @param[in]      SmiEntry  The SMI entry.
+  @param[in]      IsRoot    TRUE for the root SMI entry.
+  @param[in, out] Walk      The state of the walk.
+**/
+VOID
+SmiLatencyHistogramWalkEntry (
+  IN     SMI_ENTRY                   *SmiEntry,
+  IN     BOOLEAN                     IsRoot,
+  IN OUT SMI_LATENCY_HISTOGRAM_WALK  *Walk
+  )
+{
+  LIST_ENTRY                     *Link;
+  SMI_HANDLER                    *SmiHandler;
+  SMI_HANDLER_LATENCY_HISTOGRAM  Record;
+  UINT64                         Start;
+  UINT64                         End;
+
+  for (Link = SmiEntry->SmiHandlers.ForwardLink; Link != &SmiEntry->SmiHandlers; Link = Link->ForwardLink) {
+    SmiHandler = CR (Link, SMI_HANDLER, Link, SMI_HANDLER_SIGNATURE);
+    if (SmiHandler->Latency == NULL) {
+      continue;
+    }
+
+    if (Walk->Reset) {
+      ZeroMem (SmiHandler->Latency, sizeof (*SmiHandler->Latency));
+      continue;
+    }
+
+    Start = MAX (Walk->Offset, Walk->DataOffset);
+    End   = MIN (Walk->Offset + sizeof (Record), Walk->DataOffset + Walk->DataSize);
+    if ((Walk->DataBuffer != NULL) && (Start < End)) {
+      ZeroMem (&Record, sizeof (Record));
+      if (!IsRoot) {
+        CopyGuid (&Record.HandlerType, &SmiEntry->HandlerType);
+      }
+
+      Record.Handler       = (PHYSICAL_ADDRESS)(UINTN)SmiHandler->Handler;
+      Record.CallerAddress = (PHYSICAL_ADDRESS)SmiHandler->CallerAddr;
+      CopyMem (&Record.HandlerTime, SmiHandler->Latency, sizeof (Record.HandlerTime));
+      CopyMem (
+        Walk->DataBuffer + (Start - Walk->DataOffset),
+        (UINT8 *)&Record + (Start - Walk->Offset),
+        (UINTN)(End - Start)
+        );
+    }
+
+    Walk->Offset += sizeof (Record);
+  }
+}
+
+/**
+  Copy or clear the histograms of all SMI handlers.
+
+  @param[in, out] Walk  The state of the walk.
+
+  @return The size of the histograms of all SMI handlers.
+**/
+UINT64
+SmiLatencyHistogramWalk (
+  IN OUT SMI_LATENCY_HISTOGRAM_WALK  *Walk
+  )
+{
+  LIST_ENTRY  *Link;
+
+  Walk->Offset = 0;
+  SmiLatencyHistogramWalkEntry (&mRootSmiEntry, TRUE, Walk);
+  for (Link = mSmiEntryList.ForwardLink; Link != &mSmiEntryList; Link = Link->ForwardLink) {
+    SmiLatencyHistogramWalkEntry (CR (Link, SMI_ENTRY, AllEntries, SMI_ENTRY_SIGNATURE), FALSE, Walk);
+  }
+
+  return Walk->Offset;
+}
+
+/**
+  SMI latency histogram handler to get data by offset.
+
+  @param SmiLatencyHistogramParameterGetDataByOffset   The parameter of SMI latency histogram get data by offset.
+
+**/
+VOID
+SmiLatencyHistogramHandlerGetDataByOffset (
+  IN SMI_LATENCY_HISTOGRAM_PARAMETER_GET_DATA_BY_OFFSET  *SmiLatencyHistogramParameterGetDataByOffset
+  )
+{
+  SMI_LATENCY_HISTOGRAM_PARAMETER_GET_DATA_BY_OFFSET  SmiLatencyHistogramGetDataByOffset;
+  SMI_LATENCY_HISTOGRAM_WALK                          Walk;
+  UINT64                                              DataSize;
+
+  CopyMem (&SmiLatencyHistogramGetDataByOffset, SmiLatencyHistogramParameterGetDataByOffset, sizeof (SmiLatencyHistogramGetDataByOffset));
+
+  //
+  // Sanity check
+  //
+  if (!SmmIsBufferOutsideSmmValid ((UINTN)SmiLatencyHistogramGetDataByOffset.DataBuffer, (UINTN)SmiLatencyHistogramGetDataByOffset.DataSize)) {
+    DEBUG ((DEBUG_ERROR, "SmiLatencyHistogramHandlerGetDataByOffset: SMI latency histogram get data in SMRAM or overflow!\n"));
+    SmiLatencyHistogramParameterGetDataByOffset->Header.ReturnStatus = (UINT64)(INT64)(INTN)EFI_ACCESS_DENIED;
+    return;
+  }
+
+  ZeroMem (&Walk, sizeof (Walk));
+  DataSize = SmiLatencyHistogramWalk (&Walk);
+  if (SmiLatencyHistogramGetDataByOffset.DataOffset >= DataSize) {
+    SmiLatencyHistogramGetDataByOffset.DataOffset = DataSize;
+    SmiLatencyHistogramGetDataByOffset.DataSize   = 0;
+  } else {
+    if (DataSize - SmiLatencyHistogramGetDataByOffset.DataOffset < SmiLatencyHistogramGetDataByOffset.DataSize) {
+      SmiLatencyHistogramGetDataByOffset.DataSize = DataSize - SmiLatencyHistogramGetDataByOffset.DataOffset;
+    }
+
+    Walk.DataBuffer = (UINT8 *)(UINTN)SmiLatencyHistogramGetDataByOffset.DataBuffer;
+    Walk.DataSize   = SmiLatencyHistogramGetDataByOffset.DataSize;
+    Walk.DataOffset = SmiLatencyHistogramGetDataByOffset.DataOffset;
+    SmiLatencyHistogramWalk (&Walk);
+    SmiLatencyHistogramGetDataByOffset.DataOffset += SmiLatencyHistogramGetDataByOffset.DataSize;
+  }
+
+  CopyMem (SmiLatencyHistogramParameterGetDataByOffset, &SmiLatencyHistogramGetDataByOffset, sizeof (SmiLatencyHistogramGetDataByOffset));
+  SmiLatencyHistogramParameterGetDataByOffset->Header.ReturnStatus = 0;
+}
+
+/**
+  Dispatch function for the SMI latency histogram communication.
+
+  Caution: This function may receive untrusted input.
+  Communicate buffer and buffer size are external input, so this function will do basic validation.
+
+  @param DispatchHandle  The unique handle assigned to this handler by SmiHandlerRegister().
+  @param Context         Points to an optional handler context which was specified when the
+                         handler was registered.
+  @param CommBuffer      A pointer to a collection of data in memory that will
+                         be conveyed from a non-SMM environment into an SMM environment.
+  @param CommBufferSize  The size of the CommBuffer.
+
+  @retval EFI_SUCCESS Command is handled successfully.
+**/
+EFI_STATUS
+EFIAPI
+SmiLatencyHistogramHandler (
+  IN EFI_HANDLE  DispatchHandle,
+  IN CONST VOID  *Context         OPTIONAL,
+  IN OUT VOID    *CommBuffer      OPTIONAL,
+  IN OUT UINTN   *CommBufferSize  OPTIONAL
+  )
+{
+  SMI_LATENCY_HISTOGRAM_PARAMETER_HEADER  *SmiLatencyHistogramParameterHeader;
+  SMI_LATENCY_HISTOGRAM_WALK              Walk;
+  UINTN                                   TempCommBufferSize;
+
+  //
+  // If input is invalid, stop processing this SMI
+  //
+  if ((CommBuffer == NULL) || (CommBufferSize == NULL)) {
+    return EFI_SUCCESS;
+  }
+
+  TempCommBufferSize = *CommBufferSize;
+
+  if (TempCommBufferSize < sizeof (SMI_LATENCY_HISTOGRAM_PARAMETER_HEADER)) {
+    DEBUG ((DEBUG_ERROR, "SmiLatencyHistogramHandler: SMM communication buffer size invalid!\n"));
+    return EFI_SUCCESS;
+  }
+
+  if (!SmmIsBufferOutsideSmmValid ((UINTN)CommBuffer, TempCommBufferSize)) {
+    DEBUG ((DEBUG_ERROR, "SmiLatencyHistogramHandler: SMM communication buffer in SMRAM or overflow!\n"));
+    return EFI_SUCCESS;
+  }
+
+  SmiLatencyHistogramParameterHeader               = (SMI_LATENCY_HISTOGRAM_PARAMETER_HEADER *)((UINTN)CommBuffer);
+  SmiLatencyHistogramParameterHeader->ReturnStatus = (UINT64)-1;
+
+  ZeroMem (&Walk, sizeof (Walk));
+  switch (SmiLatencyHistogramParameterHeader->Command) {
+    case SMI_LATENCY_HISTOGRAM_COMMAND_GET_INFO:
+      if (TempCommBufferSize != sizeof (SMI_LATENCY_HISTOGRAM_PARAMETER_GET_INFO)) {
+        DEBUG ((DEBUG_ERROR, "SmiLatencyHistogramHandler: SMM communication buffer size invalid!\n"));
+        return EFI_SUCCESS;
+      }
+
+      ((SMI_LATENCY_HISTOGRAM_PARAMETER_GET_INFO *)(UINTN)CommBuffer)->DataSize = SmiLatencyHistogramWalk (&Walk);
+      SmiLatencyHistogramParameterHeader->ReturnStatus                          = 0;
+      break;
+    case SMI_LATENCY_HISTOGRAM_COMMAND_GET_DATA_BY_OFFSET:
+      if (TempCommBufferSize != sizeof (SMI_LATENCY_HISTOGRAM_PARAMETER_GET_DATA_BY_OFFSET)) {
+        DEBUG ((DEBUG_ERROR, "SmiLatencyHistogramHandler: SMM communication buffer size invalid!\n"));
+        return EFI_SUCCESS;
+      }
+
+      SmiLatencyHistogramHandlerGetDataByOffset ((SMI_LATENCY_HISTOGRAM_PARAMETER_GET_DATA_BY_OFFSET *)(UINTN)CommBuffer);
+      break;
+    case SMI_LATENCY_HISTOGRAM_COMMAND_RESET:
+      Walk.Reset = TRUE;
+      SmiLatencyHistogramWalk (&Walk);
+      SmiLatencyHistogramParameterHeader->ReturnStatus = 0;
+      break;
+    default:
+      break;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Initialize SMI latency histogram feature.
+**/
+VOID
+SmmCoreInitializeSmiLatencyHistogram (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+  EFI_HANDLE  DispatchHandle;
+  UINT64      Start;
+  UINT64      End;
+
+  if (!FeaturePcdGet (PcdSmiLatencyHistogramEnable)) {
+    return;
+  }
+
+  GetPerformanceCounterProperties (&Start, &End);
+  if (End < Start) {
+    mSmiLatencyCountDown = TRUE;
+    mSmiLatencyCycle     = Start - End;
+  } else {
+    mSmiLatencyCountDown = FALSE;
+    mSmiLatencyCycle     = End - Start;
+  }
+
+  Status = SmiHandlerRegister (
+             SmiLatencyHistogramHandler,
+             &gSmiLatencyHistogramGuid,
+             &DispatchHandle
+             );
+  ASSERT_EFI_ERROR (Status);
+}
@@ -179,6 +179,23 @@ typedef struct {
   // MEMORY_PROFILE_DESCRIPTOR     MemoryDescriptor[MemoryRangeCount];
 } MEMORY_PROFILE_MEMORY_RANGE;
 
+#define MEMORY_PROFILE_POOL_CACHE_INFO_SIGNATURE  SIGNATURE_32 ('M','P','P','C')
+#define MEMORY_PROFILE_POOL_CACHE_INFO_REVISION   0x0001
+
+//
+// Hit/miss statistics of the small pool block cache kept in front of the
+// pool free lists. Only BIOS MemoryType (0 ~ EfiMaxMemoryType - 1) is cached.
+//
+typedef struct {
+  MEMORY_PROFILE_COMMON_HEADER    Header;
+  UINT32                          CacheDepth;
+  UINT32                          MaxCachedSize;
+  UINT64                          AllocateHitCountByType[EfiMaxMemoryType];
+  UINT64                          AllocateMissCountByType[EfiMaxMemoryType];
+  UINT64                          FreeHitCountByType[EfiMaxMemoryType];
+  UINT64                          FreeMissCountByType[EfiMaxMemoryType];
+} MEMORY_PROFILE_POOL_CACHE_INFO;
+
 //
 // UEFI memory profile layout:
 // +--------------------------------+
@@ -196,6 +213,8 @@ typedef struct {
 // +--------------------------------+
 // | ALLOC_INFO(n, mn)              |
 // +--------------------------------+
+// | POOL_CACHE_INFO (optional)     |
+// +--------------------------------+
 //
 
 typedef struct _EDKII_MEMORY_PROFILE_PROTOCOL EDKII_MEMORY_PROFILE_PROTOCOL;
@@ -54,6 +54,12 @@ typedef struct  {
   UINT16    ExGuidIndex;        // Index of GuidTable in units of GUID.
 } DYNAMICEX_MAPPING;
 
+//
+// From this build version on, ExMapTable[] is sorted by ExGuidIndex and then
+// by ExTokenNumber, so that it can be binary searched.
+//
+#define PCD_DATABASE_SORTED_EX_MAP_VERSION  8
+
 typedef struct {
   UINT32    StringIndex;        // Offset in String Table in units of UINT8.
   UINT32    DefaultValueOffset; // Offset of the Default Value.
@@ -107,7 +113,7 @@ typedef struct {
   // UINT64                         ValueUint64[];
   // UINT32                         ValueUint32[];
   // VPD_HEAD                       VpdHead[];               // VPD Offset
-  // DYNAMICEX_MAPPING              ExMapTable[];            // DynamicEx PCD mapped to LocalIndex in LocalTokenNumberTable. It can be accessed by the ExMapTableOffset.
+  // DYNAMICEX_MAPPING              ExMapTable[];            // DynamicEx PCD mapped to LocalIndex in LocalTokenNumberTable. It can be accessed by the ExMapTableOffset. Sorted from PCD_DATABASE_SORTED_EX_MAP_VERSION on.
   // UINT32                         LocalTokenNumberTable[]; // Offset | DataType | PCD Type. It can be accessed by LocalTokenNumberTableOffset.
   // GUID                           GuidTable[];             // GUID for DynamicEx and HII PCD variable Guid. It can be accessed by the GuidTableOffset.
   // STRING_HEAD                    StringHead[];            // String PCD
@@ -0,0 +1,111 @@
+/** @file
+  Header file for SMI latency histogram definition.
+
+  The SMM Core keeps a histogram of the time each SMI handler takes, and the
+  SMM CPU driver keeps histograms of the time each processor spends in the
+  phases of an SMI. Both can be read through the SMM Communication protocol,
+  also at OS runtime.
+
+Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef  _SMI_LATENCY_HISTOGRAM_H_
+#define  _SMI_LATENCY_HISTOGRAM_H_
+
+#define SMI_LATENCY_HISTOGRAM_BUCKET_COUNT  32
+
+///
+/// A histogram of latencies, in nanoseconds.
+/// Bucket[0] counts the latencies below 2ns, Bucket[N] counts the latencies in
+/// [2^N, 2^(N+1)) ns, and the last bucket also counts every longer latency.
+///
+typedef struct {
+  UINT64    Count;
+  UINT64    TotalNanoSeconds;
+  UINT64    MaxNanoSeconds;
+  UINT64    Bucket[SMI_LATENCY_HISTOGRAM_BUCKET_COUNT];
+} SMI_LATENCY_HISTOGRAM;
+
+///
+/// The data for gSmiLatencyHistogramGuid is an array of this structure, one
+/// element per registered SMI handler.
+///
+typedef struct {
+  //
+  // Zero for root SMI handlers.
+  //
+  EFI_GUID                 HandlerType;
+  PHYSICAL_ADDRESS         Handler;
+  PHYSICAL_ADDRESS         CallerAddress;
+  SMI_LATENCY_HISTOGRAM    HandlerTime;
+} SMI_HANDLER_LATENCY_HISTOGRAM;
+
+//
+// From entering the SMI until the processor starts the SMI handlers (BSP),
+// or has checked in to run the procedures of the BSP (AP).
+//
+#define SMM_CPU_LATENCY_PHASE_RENDEZVOUS  0
+//
+// From the end of the rendezvous until the SMI handlers are done (BSP), or
+// until the BSP tells the processor to leave SMM (AP).
+//
+#define SMM_CPU_LATENCY_PHASE_HANDLER  1
+//
+// From the end of the handler phase until the processor leaves SMM.
+//
+#define SMM_CPU_LATENCY_PHASE_EXIT   2
+#define SMM_CPU_LATENCY_PHASE_COUNT  3
+
+///
+/// The data for gSmmCpuLatencyHistogramGuid is an array of this structure,
+/// one element per processor.
+///
+typedef struct {
+  UINT32                   CpuIndex;
+  UINT8                    Reserved[4];
+  SMI_LATENCY_HISTOGRAM    Phase[SMM_CPU_LATENCY_PHASE_COUNT];
+} SMM_CPU_LATENCY_HISTOGRAM;
+
+//
+// SMI latency histogram communication command
+//
+#define SMI_LATENCY_HISTOGRAM_COMMAND_GET_INFO            0x1
+#define SMI_LATENCY_HISTOGRAM_COMMAND_GET_DATA_BY_OFFSET  0x2
+#define SMI_LATENCY_HISTOGRAM_COMMAND_RESET               0x3
+
+typedef struct {
+  UINT32    Command;
+  UINT32    DataLength;
+  UINT64    ReturnStatus;
+} SMI_LATENCY_HISTOGRAM_PARAMETER_HEADER;
+
+typedef struct {
+  SMI_LATENCY_HISTOGRAM_PARAMETER_HEADER    Header;
+  UINT64                                    DataSize;
+} SMI_LATENCY_HISTOGRAM_PARAMETER_GET_INFO;
+
+typedef struct {
+  SMI_LATENCY_HISTOGRAM_PARAMETER_HEADER    Header;
+  //
+  // On input, data buffer size.
+  // On output, actual data buffer size copied.
+  //
+  UINT64                                    DataSize;
+  PHYSICAL_ADDRESS                          DataBuffer;
+  //
+  // On input, data buffer offset to copy.
+  // On output, next time data buffer offset to copy.
+  //
+  UINT64                                    DataOffset;
+} SMI_LATENCY_HISTOGRAM_PARAMETER_GET_DATA_BY_OFFSET;
+
+#define SMI_LATENCY_HISTOGRAM_GUID  {0x22c764eb, 0x736d, 0x4667, {0x80, 0xe4, 0x7e, 0x6f, 0xc5, 0xcc, 0x07, 0xd9}}
+
+#define SMM_CPU_LATENCY_HISTOGRAM_GUID  {0x3db7a396, 0xd6dc, 0x492f, {0x86, 0x03, 0x54, 0xf6, 0x8c, 0xe3, 0xc3, 0x6f}}
+
+extern EFI_GUID  gSmiLatencyHistogramGuid;
+extern EFI_GUID  gSmmCpuLatencyHistogramGuid;
+
+#endif
@@ -77,6 +77,10 @@ typedef struct {
 // The payload for this function is SMM_VARIABLE_COMMUNICATE_GET_RUNTIME_CACHE_INFO
 //
 #define SMM_VARIABLE_FUNCTION_GET_RUNTIME_CACHE_INFO  14
+//
+// The payload for this function is SMM_VARIABLE_COMMUNICATE_GET_VARIABLE_BATCH
+//
+#define SMM_VARIABLE_FUNCTION_GET_VARIABLE_BATCH  15
 
 ///
 /// Size of SMM communicate header, without including the payload.
@@ -147,4 +151,24 @@ typedef struct {
   BOOLEAN    AuthenticatedVariableUsage;
 } SMM_VARIABLE_COMMUNICATE_GET_RUNTIME_CACHE_INFO;
 
+///
+/// This structure is used to communicate with SMI handler by GetVariable for
+/// several variables at once. It is followed by EntryCount
+/// SMM_VARIABLE_COMMUNICATE_BATCH_ENTRY structures.
+///
+typedef struct {
+  UINTN    EntryCount;
+} SMM_VARIABLE_COMMUNICATE_GET_VARIABLE_BATCH;
+
+///
+/// One GetVariable request in a SMM_VARIABLE_COMMUNICATE_GET_VARIABLE_BATCH.
+/// Access.Name is followed by the data buffer. EntrySize covers the whole entry
+/// including the name and the data buffer, and is a multiple of sizeof (UINTN).
+///
+typedef struct {
+  UINTN                                       EntrySize;
+  EFI_STATUS                                  Status;
+  SMM_VARIABLE_COMMUNICATE_ACCESS_VARIABLE    Access;
+} SMM_VARIABLE_COMMUNICATE_BATCH_ENTRY;
+
 #endif // _SMM_VARIABLE_COMMON_H_
@@ -36,6 +36,11 @@ typedef struct {
   /// This field is used to store the distance of two neighbouring VAR_ADDED type variables.
   /// The meaning of the field is implement-dependent.
   UINT16             Index[VARIABLE_INDEX_TABLE_VOLUME];
+  ///
+  /// This field is used to store a hash of the vendor GUID and the name size of the
+  /// variables recorded in Index, so that a lookup does not need to read the other variables.
+  /// The meaning of the field is implement-dependent.
+  UINT8              Hash[VARIABLE_INDEX_TABLE_VOLUME];
 } VARIABLE_INDEX_TABLE;
 
 #endif // __VARIABLE_INDEX_TABLE_H__
@@ -0,0 +1,53 @@
+/** @file
+  EDKII SMM Parallel SMI Handler protocol.
+
+  This SMM protocol is published by the SMM Foundation code. A driver that
+  registered a root SMI handler uses it to declare that the handler may run on
+  an AP already in SMM, in parallel with the other root SMI handlers.
+
+  Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef SMM_PARALLEL_SMI_HANDLER_H_
+#define SMM_PARALLEL_SMI_HANDLER_H_
+
+#define EDKII_SMM_PARALLEL_SMI_HANDLER_PROTOCOL_GUID \
+  { \
+    0xea97402a, 0x0104, 0x4eb9, { 0xb0, 0xd8, 0x91, 0x7b, 0xe3, 0x0d, 0xc1, 0xc0 } \
+  }
+
+typedef struct _EDKII_SMM_PARALLEL_SMI_HANDLER_PROTOCOL EDKII_SMM_PARALLEL_SMI_HANDLER_PROTOCOL;
+
+/**
+  Declare a root SMI handler safe to run on an AP, in parallel with the BSP
+  and with the other root SMI handlers.
+
+  The handler is called with the same parameters as other root SMI handlers,
+  but may run on any processor that is in SMM. It must only touch data that no
+  other root SMI handler touches, and it must not call SMM Foundation services,
+  because those services are not MP safe. When no AP is available, the handler
+  runs on the BSP.
+
+  @param[in]  This            The EDKII_SMM_PARALLEL_SMI_HANDLER_PROTOCOL instance.
+  @param[in]  DispatchHandle  The handle returned by SmiHandlerRegister() for a root
+                              SMI handler.
+
+  @retval EFI_SUCCESS            The handler is declared parallel-safe.
+  @retval EFI_INVALID_PARAMETER  DispatchHandle does not refer to a root SMI handler.
+**/
+typedef
+EFI_STATUS
+(EFIAPI *EDKII_SMM_PARALLEL_SMI_HANDLER_SET_PARALLEL)(
+  IN EDKII_SMM_PARALLEL_SMI_HANDLER_PROTOCOL  *This,
+  IN EFI_HANDLE                               DispatchHandle
+  );
+
+struct _EDKII_SMM_PARALLEL_SMI_HANDLER_PROTOCOL {
+  EDKII_SMM_PARALLEL_SMI_HANDLER_SET_PARALLEL    SetParallel;
+};
+
+extern EFI_GUID  gEdkiiSmmParallelSmiHandlerProtocolGuid;
+
+#endif
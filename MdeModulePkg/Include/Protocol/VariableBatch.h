@@ -0,0 +1,77 @@
+/** @file
+  Variable Batch Protocol is related to EDK II-specific implementation of variables
+  and intended for use as a means to read several variables with a single request
+  to the variable driver, so that a variable driver that runs in SMM only pays the
+  cost of entering SMM once per batch instead of once per variable.
+
+  Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef __VARIABLE_BATCH_H__
+#define __VARIABLE_BATCH_H__
+
+#define EDKII_VARIABLE_BATCH_PROTOCOL_GUID \
+  { \
+    0x3c232378, 0xf78c, 0x4b55, { 0x99, 0xe2, 0x61, 0x90, 0xcb, 0xff, 0x78, 0x94 } \
+  }
+
+typedef struct _EDKII_VARIABLE_BATCH_PROTOCOL EDKII_VARIABLE_BATCH_PROTOCOL;
+
+///
+/// One GetVariable request in a batch. The fields have the same meaning as the
+/// parameters of the GetVariable runtime service.
+///
+typedef struct {
+  CHAR16        *VariableName;
+  EFI_GUID      *VendorGuid;
+  ///
+  /// Returns the attributes of the variable.
+  ///
+  UINT32        Attributes;
+  ///
+  /// On input, the size of Data. On output, the size of the variable data.
+  ///
+  UINTN         DataSize;
+  VOID          *Data;
+  ///
+  /// Returns the status GetVariable () would have returned for the request.
+  ///
+  EFI_STATUS    Status;
+} EDKII_VARIABLE_BATCH_REQUEST;
+
+/**
+  Read a batch of variables.
+
+  Each request is processed as if GetVariable () were called with its fields, and
+  the result of that call is returned in its Status field. The requests are not
+  atomic with respect to each other.
+
+  @param[in]      This          The EDKII_VARIABLE_BATCH_PROTOCOL instance.
+  @param[in]      RequestCount  The number of entries in Requests.
+  @param[in, out] Requests      The requests to process.
+
+  @retval EFI_SUCCESS           All requests were processed, the result of each
+                                request is in its Status field.
+  @retval EFI_INVALID_PARAMETER Requests is NULL and RequestCount is not 0.
+**/
+typedef
+EFI_STATUS
+(EFIAPI *EDKII_VARIABLE_BATCH_GET_VARIABLES)(
+  IN     EDKII_VARIABLE_BATCH_PROTOCOL  *This,
+  IN     UINTN                          RequestCount,
+  IN OUT EDKII_VARIABLE_BATCH_REQUEST   *Requests
+  );
+
+///
+/// Variable Batch Protocol reads several variables with a single request to the
+/// variable driver.
+///
+struct _EDKII_VARIABLE_BATCH_PROTOCOL {
+  EDKII_VARIABLE_BATCH_GET_VARIABLES    GetVariables;
+};
+
+extern EFI_GUID  gEdkiiVariableBatchProtocolGuid;
+
+#endif
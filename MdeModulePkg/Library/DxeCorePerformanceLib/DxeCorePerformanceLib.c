@@ -25,6 +25,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define STRING_SIZE                (FPDT_STRING_EVENT_RECORD_NAME_LENGTH * sizeof (CHAR8))
 #define FIRMWARE_RECORD_BUFFER     0x10000
 #define CACHE_HANDLE_GUID_COUNT    0x800
+#define CACHE_HANDLE_GUID_HASH     0x100
 
 BOOT_PERFORMANCE_TABLE  *mAcpiBootPerformanceTable    = NULL;
 BOOT_PERFORMANCE_TABLE  mBootPerformanceTableTemplate = {
@@ -54,11 +55,20 @@ typedef struct {
   EFI_HANDLE    Handle;
   CHAR8         NameString[FPDT_STRING_EVENT_RECORD_NAME_LENGTH];
   EFI_GUID      ModuleGuid;
+  UINT16        Next;       // Index + 1 of the next pair of the same hash bucket, or 0
 } HANDLE_GUID_MAP;
 
 HANDLE_GUID_MAP  mCacheHandleGuidTable[CACHE_HANDLE_GUID_COUNT];
 UINTN            mCachePairCount = 0;
 
+//
+// Index + 1 of the last cached pair of each hash bucket of the handles, or 0.
+//
+UINT16  mCacheHandleGuidHash[CACHE_HANDLE_GUID_HASH];
+
+#define CACHE_HANDLE_GUID_HASH_INDEX(Handle) \
+  (((UINTN)(Handle) >> 3) & (CACHE_HANDLE_GUID_HASH - 1))
+
 UINT32  mLoadImageCount       = 0;
 UINT32  mPerformanceLength    = 0;
 UINT32  mMaxPerformanceLength = 0;
@@ -472,6 +482,7 @@ GetModuleInfoFromHandle (
   CHAR16                             *StringPtr;
   EFI_COMPONENT_NAME2_PROTOCOL       *ComponentName2;
   MEDIA_FW_VOL_FILEPATH_DEVICE_PATH  *FvFilePath;
+  UINTN                              Bucket;
 
   if ((NameString == NULL) || (BufferSize == 0)) {
     return EFI_INVALID_PARAMETER;
@@ -480,13 +491,12 @@ GetModuleInfoFromHandle (
   //
   // Try to get the ModuleGuid and name string form the caached array.
   //
-  if (mCachePairCount > 0) {
-    for (Count = mCachePairCount -1; Count >= 0; Count--) {
-      if (Handle == mCacheHandleGuidTable[Count].Handle) {
-        CopyGuid (ModuleGuid, &mCacheHandleGuidTable[Count].ModuleGuid);
-        AsciiStrCpyS (NameString, FPDT_STRING_EVENT_RECORD_NAME_LENGTH, mCacheHandleGuidTable[Count].NameString);
-        return EFI_SUCCESS;
-      }
+  Bucket = CACHE_HANDLE_GUID_HASH_INDEX (Handle);
+  for (Count = mCacheHandleGuidHash[Bucket]; Count > 0; Count = mCacheHandleGuidTable[Count - 1].Next) {
+    if (Handle == mCacheHandleGuidTable[Count - 1].Handle) {
+      CopyGuid (ModuleGuid, &mCacheHandleGuidTable[Count - 1].ModuleGuid);
+      AsciiStrCpyS (NameString, FPDT_STRING_EVENT_RECORD_NAME_LENGTH, mCacheHandleGuidTable[Count - 1].NameString);
+      return EFI_SUCCESS;
     }
   }
 
@@ -672,7 +682,9 @@ Done:
     mCacheHandleGuidTable[mCachePairCount].Handle = Handle;
     CopyGuid (&mCacheHandleGuidTable[mCachePairCount].ModuleGuid, ModuleGuid);
     AsciiStrCpyS (mCacheHandleGuidTable[mCachePairCount].NameString, FPDT_STRING_EVENT_RECORD_NAME_LENGTH, NameString);
+    mCacheHandleGuidTable[mCachePairCount].Next = mCacheHandleGuidHash[Bucket];
     mCachePairCount++;
+    mCacheHandleGuidHash[Bucket] = (UINT16)mCachePairCount;
   }
 
   return Status;
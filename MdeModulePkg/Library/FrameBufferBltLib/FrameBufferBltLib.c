@@ -35,6 +35,49 @@ CONST EFI_PIXEL_BITMASK  mBgrPixelMasks = {
   0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000
 };
 
+/**
+  Convert pixels between the EFI_GRAPHICS_OUTPUT_BLT_PIXEL layout and the
+  PixelRedGreenBlueReserved8BitPerColor layout, which only differ in the
+  position of the red and blue bytes. The reserved byte is cleared.
+
+  Two pixels are converted at a time, which is considerably cheaper than the
+  generic shift and mask conversion of each color.
+
+  @param[out] Destination  The converted pixels.
+  @param[in]  Source       The pixels to convert.
+  @param[in]  Count        The number of pixels to convert.
+**/
+VOID
+FrameBufferBltLibSwapRedBlue (
+  OUT UINT8        *Destination,
+  IN  CONST UINT8  *Source,
+  IN  UINTN        Count
+  )
+{
+  UINT64  Uint64;
+  UINT32  Uint32;
+
+  for ( ; Count >= 2; Count -= 2) {
+    Uint64 = ReadUnaligned64 ((CONST UINT64 *)Source);
+    WriteUnaligned64 (
+      (UINT64 *)Destination,
+      (Uint64 & 0x0000ff000000ff00ULL) |
+      ((Uint64 >> 16) & 0x000000ff000000ffULL) |
+      ((Uint64 & 0x000000ff000000ffULL) << 16)
+      );
+    Source      += 2 * sizeof (UINT32);
+    Destination += 2 * sizeof (UINT32);
+  }
+
+  if (Count != 0) {
+    Uint32 = ReadUnaligned32 ((CONST UINT32 *)Source);
+    WriteUnaligned32 (
+      (UINT32 *)Destination,
+      (Uint32 & 0x0000ff00) | ((Uint32 >> 16) & 0x000000ff) | ((Uint32 & 0x000000ff) << 16)
+      );
+  }
+}
+
 /**
   Initialize the bit mask in frame buffer configure.
 
@@ -406,6 +449,20 @@ FrameBufferBltLibVideoToBltBuffer (
 
   WidthInBytes = Width * Configure->BytesPerPixel;
 
+  //
+  // When both the frame buffer and the BltBuffer rows of the rectangle are
+  // contiguous and no conversion is needed, copy the rectangle at once.
+  //
+  if ((Configure->PixelFormat == PixelBlueGreenRedReserved8BitPerColor) &&
+      (Width == Configure->PixelsPerScanLine) &&
+      (Delta == WidthInBytes))
+  {
+    Offset      = SourceY * Configure->PixelsPerScanLine * Configure->BytesPerPixel;
+    Destination = (UINT8 *)BltBuffer + (DestinationY * Delta);
+    CopyMem (Destination, Configure->FrameBuffer + Offset, WidthInBytes * Height);
+    return RETURN_SUCCESS;
+  }
+
   //
   // Video to BltBuffer: Source is Video, destination is BltBuffer
   //
@@ -425,7 +482,13 @@ FrameBufferBltLibVideoToBltBuffer (
 
     CopyMem (Destination, Source, WidthInBytes);
 
-    if (Configure->PixelFormat != PixelBlueGreenRedReserved8BitPerColor) {
+    if (Configure->PixelFormat == PixelRedGreenBlueReserved8BitPerColor) {
+      FrameBufferBltLibSwapRedBlue (
+        (UINT8 *)BltBuffer + (DstY * Delta) + (DestinationX * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL)),
+        Configure->LineBuffer,
+        Width
+        );
+    } else if (Configure->PixelFormat != PixelBlueGreenRedReserved8BitPerColor) {
       for (IndexX = 0; IndexX < Width; IndexX++) {
         Blt = (EFI_GRAPHICS_OUTPUT_BLT_PIXEL *)
               ((UINT8 *)BltBuffer + (DstY * Delta) +
@@ -514,6 +577,20 @@ FrameBufferBltLibBufferToVideo (
 
   WidthInBytes = Width * Configure->BytesPerPixel;
 
+  //
+  // When both the BltBuffer and the frame buffer rows of the rectangle are
+  // contiguous and no conversion is needed, copy the rectangle at once.
+  //
+  if ((Configure->PixelFormat == PixelBlueGreenRedReserved8BitPerColor) &&
+      (Width == Configure->PixelsPerScanLine) &&
+      (Delta == WidthInBytes))
+  {
+    Offset = DestinationY * Configure->PixelsPerScanLine * Configure->BytesPerPixel;
+    Source = (UINT8 *)BltBuffer + (SourceY * Delta);
+    CopyMem (Configure->FrameBuffer + Offset, Source, WidthInBytes * Height);
+    return RETURN_SUCCESS;
+  }
+
   for (SrcY = SourceY, DstY = DestinationY;
        SrcY < (Height + SourceY);
        SrcY++, DstY++)
@@ -524,6 +601,13 @@ FrameBufferBltLibBufferToVideo (
 
     if (Configure->PixelFormat == PixelBlueGreenRedReserved8BitPerColor) {
       Source = (UINT8 *)BltBuffer + (SrcY * Delta) + SourceX * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL);
+    } else if (Configure->PixelFormat == PixelRedGreenBlueReserved8BitPerColor) {
+      FrameBufferBltLibSwapRedBlue (
+        Configure->LineBuffer,
+        (UINT8 *)BltBuffer + (SrcY * Delta) + SourceX * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL),
+        Width
+        );
+      Source = Configure->LineBuffer;
     } else {
       for (IndexX = 0; IndexX < Width; IndexX++) {
         Blt =
@@ -619,6 +703,15 @@ FrameBufferBltLibVideoToVideo (
   Destination = Configure->FrameBuffer + Offset;
 
   LineStride = Configure->BytesPerPixel * Configure->PixelsPerScanLine;
+  if (Width == Configure->PixelsPerScanLine) {
+    //
+    // The rows are contiguous, so move the rectangle at once. CopyMem ()
+    // handles the overlapping source and destination.
+    //
+    CopyMem (Destination, Source, WidthInBytes * Height);
+    return RETURN_SUCCESS;
+  }
+
   if (Destination > Source) {
     //
     // Copy from last line to avoid source is corrupted by copying
@@ -206,54 +206,54 @@ ScriptIoRead (
   for ( ; Count > 0; Count--, Address += AddressStride, Out.Buf += BufferStride) {
     switch (Width) {
       case S3BootScriptWidthUint8:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint8 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint8 - 0x%08x\n", (UINTN)Address));
         *Out.Uint8 = IoRead8 ((UINTN)Address);
         break;
       case S3BootScriptWidthFifoUint8:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint8 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint8 - 0x%08x\n", (UINTN)Address));
         *Out.Uint8 = IoRead8 ((UINTN)Address);
         break;
       case S3BootScriptWidthFillUint8:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint8 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint8 - 0x%08x\n", (UINTN)Address));
         *Out.Uint8 = IoRead8 ((UINTN)Address);
         break;
 
       case S3BootScriptWidthUint16:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint16 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint16 - 0x%08x\n", (UINTN)Address));
         *Out.Uint16 = IoRead16 ((UINTN)Address);
         break;
       case S3BootScriptWidthFifoUint16:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint16 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint16 - 0x%08x\n", (UINTN)Address));
         *Out.Uint16 = IoRead16 ((UINTN)Address);
         break;
       case S3BootScriptWidthFillUint16:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint16 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint16 - 0x%08x\n", (UINTN)Address));
         *Out.Uint16 = IoRead16 ((UINTN)Address);
         break;
 
       case S3BootScriptWidthUint32:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint32 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint32 - 0x%08x\n", (UINTN)Address));
         *Out.Uint32 = IoRead32 ((UINTN)Address);
         break;
       case S3BootScriptWidthFifoUint32:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint32 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint32 - 0x%08x\n", (UINTN)Address));
         *Out.Uint32 = IoRead32 ((UINTN)Address);
         break;
       case S3BootScriptWidthFillUint32:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint32 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint32 - 0x%08x\n", (UINTN)Address));
         *Out.Uint32 = IoRead32 ((UINTN)Address);
         break;
 
       case S3BootScriptWidthUint64:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint64 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint64 - 0x%08x\n", (UINTN)Address));
         *Out.Uint64 = IoRead64 ((UINTN)Address);
         break;
       case S3BootScriptWidthFifoUint64:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint64 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint64 - 0x%08x\n", (UINTN)Address));
         *Out.Uint64 = IoRead64 ((UINTN)Address);
         break;
       case S3BootScriptWidthFillUint64:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint64 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint64 - 0x%08x\n", (UINTN)Address));
         *Out.Uint64 = IoRead64 ((UINTN)Address);
         break;
 
@@ -314,51 +314,51 @@ ScriptIoWrite (
   for ( ; Count > 0; Count--, Address += AddressStride, In.Buf += BufferStride) {
     switch (Width) {
       case S3BootScriptWidthUint8:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint8 - 0x%08x (0x%02x)\n", (UINTN)Address, (UINTN)*In.Uint8));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint8 - 0x%08x (0x%02x)\n", (UINTN)Address, (UINTN)*In.Uint8));
         IoWrite8 ((UINTN)Address, *In.Uint8);
         break;
       case S3BootScriptWidthFifoUint8:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint8 - 0x%08x (0x%02x)\n", (UINTN)OriginalAddress, (UINTN)*In.Uint8));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint8 - 0x%08x (0x%02x)\n", (UINTN)OriginalAddress, (UINTN)*In.Uint8));
         IoWrite8 ((UINTN)OriginalAddress, *In.Uint8);
         break;
       case S3BootScriptWidthFillUint8:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint8 - 0x%08x (0x%02x)\n", (UINTN)Address, (UINTN)*OriginalIn.Uint8));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint8 - 0x%08x (0x%02x)\n", (UINTN)Address, (UINTN)*OriginalIn.Uint8));
         IoWrite8 ((UINTN)Address, *OriginalIn.Uint8);
         break;
       case S3BootScriptWidthUint16:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint16 - 0x%08x (0x%04x)\n", (UINTN)Address, (UINTN)*In.Uint16));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint16 - 0x%08x (0x%04x)\n", (UINTN)Address, (UINTN)*In.Uint16));
         IoWrite16 ((UINTN)Address, *In.Uint16);
         break;
       case S3BootScriptWidthFifoUint16:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint16 - 0x%08x (0x%04x)\n", (UINTN)OriginalAddress, (UINTN)*In.Uint16));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint16 - 0x%08x (0x%04x)\n", (UINTN)OriginalAddress, (UINTN)*In.Uint16));
         IoWrite16 ((UINTN)OriginalAddress, *In.Uint16);
         break;
       case S3BootScriptWidthFillUint16:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint16 - 0x%08x (0x%04x)\n", (UINTN)Address, (UINTN)*OriginalIn.Uint16));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint16 - 0x%08x (0x%04x)\n", (UINTN)Address, (UINTN)*OriginalIn.Uint16));
         IoWrite16 ((UINTN)Address, *OriginalIn.Uint16);
         break;
       case S3BootScriptWidthUint32:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint32 - 0x%08x (0x%08x)\n", (UINTN)Address, (UINTN)*In.Uint32));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint32 - 0x%08x (0x%08x)\n", (UINTN)Address, (UINTN)*In.Uint32));
         IoWrite32 ((UINTN)Address, *In.Uint32);
         break;
       case S3BootScriptWidthFifoUint32:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint32 - 0x%08x (0x%08x)\n", (UINTN)OriginalAddress, (UINTN)*In.Uint32));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint32 - 0x%08x (0x%08x)\n", (UINTN)OriginalAddress, (UINTN)*In.Uint32));
         IoWrite32 ((UINTN)OriginalAddress, *In.Uint32);
         break;
       case S3BootScriptWidthFillUint32:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint32 - 0x%08x (0x%08x)\n", (UINTN)Address, (UINTN)*OriginalIn.Uint32));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint32 - 0x%08x (0x%08x)\n", (UINTN)Address, (UINTN)*OriginalIn.Uint32));
         IoWrite32 ((UINTN)Address, *OriginalIn.Uint32);
         break;
       case S3BootScriptWidthUint64:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint64 - 0x%08x (0x%016lx)\n", (UINTN)Address, *In.Uint64));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint64 - 0x%08x (0x%016lx)\n", (UINTN)Address, *In.Uint64));
         IoWrite64 ((UINTN)Address, *In.Uint64);
         break;
       case S3BootScriptWidthFifoUint64:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint64 - 0x%08x (0x%016lx)\n", (UINTN)OriginalAddress, *In.Uint64));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint64 - 0x%08x (0x%016lx)\n", (UINTN)OriginalAddress, *In.Uint64));
         IoWrite64 ((UINTN)OriginalAddress, *In.Uint64);
         break;
       case S3BootScriptWidthFillUint64:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint64 - 0x%08x (0x%016lx)\n", (UINTN)Address, *OriginalIn.Uint64));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint64 - 0x%08x (0x%016lx)\n", (UINTN)Address, *OriginalIn.Uint64));
         IoWrite64 ((UINTN)Address, *OriginalIn.Uint64);
         break;
       default:
@@ -444,54 +444,54 @@ ScriptMemoryRead (
   for ( ; Count > 0; Count--, Address += AddressStride, Out.Buf += BufferStride) {
     switch (Width) {
       case S3BootScriptWidthUint8:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint8 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint8 - 0x%08x\n", (UINTN)Address));
         *Out.Uint8 = MmioRead8 ((UINTN)Address);
         break;
       case S3BootScriptWidthFifoUint8:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint8 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint8 - 0x%08x\n", (UINTN)Address));
         *Out.Uint8 = MmioRead8 ((UINTN)Address);
         break;
       case S3BootScriptWidthFillUint8:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint8 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint8 - 0x%08x\n", (UINTN)Address));
         *Out.Uint8 = MmioRead8 ((UINTN)Address);
         break;
 
       case S3BootScriptWidthUint16:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint16 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint16 - 0x%08x\n", (UINTN)Address));
         *Out.Uint16 = MmioRead16 ((UINTN)Address);
         break;
       case S3BootScriptWidthFifoUint16:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint16 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint16 - 0x%08x\n", (UINTN)Address));
         *Out.Uint16 = MmioRead16 ((UINTN)Address);
         break;
       case S3BootScriptWidthFillUint16:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint16 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint16 - 0x%08x\n", (UINTN)Address));
         *Out.Uint16 = MmioRead16 ((UINTN)Address);
         break;
 
       case S3BootScriptWidthUint32:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint32 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint32 - 0x%08x\n", (UINTN)Address));
         *Out.Uint32 = MmioRead32 ((UINTN)Address);
         break;
       case S3BootScriptWidthFifoUint32:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint32 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint32 - 0x%08x\n", (UINTN)Address));
         *Out.Uint32 = MmioRead32 ((UINTN)Address);
         break;
       case S3BootScriptWidthFillUint32:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint32 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint32 - 0x%08x\n", (UINTN)Address));
         *Out.Uint32 = MmioRead32 ((UINTN)Address);
         break;
 
       case S3BootScriptWidthUint64:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint64 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint64 - 0x%08x\n", (UINTN)Address));
         *Out.Uint64 = MmioRead64 ((UINTN)Address);
         break;
       case S3BootScriptWidthFifoUint64:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint64 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint64 - 0x%08x\n", (UINTN)Address));
         *Out.Uint64 = MmioRead64 ((UINTN)Address);
         break;
       case S3BootScriptWidthFillUint64:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint64 - 0x%08x\n", (UINTN)Address));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint64 - 0x%08x\n", (UINTN)Address));
         *Out.Uint64 = MmioRead64 ((UINTN)Address);
         break;
 
@@ -549,51 +549,51 @@ ScriptMemoryWrite (
   for ( ; Count > 0; Count--, Address += AddressStride, In.Buf += BufferStride) {
     switch (Width) {
       case S3BootScriptWidthUint8:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint8 - 0x%08x (0x%02x)\n", (UINTN)Address, (UINTN)*In.Uint8));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint8 - 0x%08x (0x%02x)\n", (UINTN)Address, (UINTN)*In.Uint8));
         MmioWrite8 ((UINTN)Address, *In.Uint8);
         break;
       case S3BootScriptWidthFifoUint8:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint8 - 0x%08x (0x%02x)\n", (UINTN)OriginalAddress, (UINTN)*In.Uint8));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint8 - 0x%08x (0x%02x)\n", (UINTN)OriginalAddress, (UINTN)*In.Uint8));
         MmioWrite8 ((UINTN)OriginalAddress, *In.Uint8);
         break;
       case S3BootScriptWidthFillUint8:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint8 - 0x%08x (0x%02x)\n", (UINTN)Address, (UINTN)*OriginalIn.Uint8));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint8 - 0x%08x (0x%02x)\n", (UINTN)Address, (UINTN)*OriginalIn.Uint8));
         MmioWrite8 ((UINTN)Address, *OriginalIn.Uint8);
         break;
       case S3BootScriptWidthUint16:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint16 - 0x%08x (0x%04x)\n", (UINTN)Address, (UINTN)*In.Uint16));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint16 - 0x%08x (0x%04x)\n", (UINTN)Address, (UINTN)*In.Uint16));
         MmioWrite16 ((UINTN)Address, *In.Uint16);
         break;
       case S3BootScriptWidthFifoUint16:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint16 - 0x%08x (0x%04x)\n", (UINTN)OriginalAddress, (UINTN)*In.Uint16));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint16 - 0x%08x (0x%04x)\n", (UINTN)OriginalAddress, (UINTN)*In.Uint16));
         MmioWrite16 ((UINTN)OriginalAddress, *In.Uint16);
         break;
       case S3BootScriptWidthFillUint16:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint16 - 0x%08x (0x%04x)\n", (UINTN)Address, (UINTN)*OriginalIn.Uint16));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint16 - 0x%08x (0x%04x)\n", (UINTN)Address, (UINTN)*OriginalIn.Uint16));
         MmioWrite16 ((UINTN)Address, *OriginalIn.Uint16);
         break;
       case S3BootScriptWidthUint32:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint32 - 0x%08x (0x%08x)\n", (UINTN)Address, (UINTN)*In.Uint32));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint32 - 0x%08x (0x%08x)\n", (UINTN)Address, (UINTN)*In.Uint32));
         MmioWrite32 ((UINTN)Address, *In.Uint32);
         break;
       case S3BootScriptWidthFifoUint32:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint32 - 0x%08x (0x%08x)\n", (UINTN)OriginalAddress, (UINTN)*In.Uint32));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint32 - 0x%08x (0x%08x)\n", (UINTN)OriginalAddress, (UINTN)*In.Uint32));
         MmioWrite32 ((UINTN)OriginalAddress, *In.Uint32);
         break;
       case S3BootScriptWidthFillUint32:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint32 - 0x%08x (0x%08x)\n", (UINTN)Address, (UINTN)*OriginalIn.Uint32));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint32 - 0x%08x (0x%08x)\n", (UINTN)Address, (UINTN)*OriginalIn.Uint32));
         MmioWrite32 ((UINTN)Address, *OriginalIn.Uint32);
         break;
       case S3BootScriptWidthUint64:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint64 - 0x%08x (0x%016lx)\n", (UINTN)Address, *In.Uint64));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint64 - 0x%08x (0x%016lx)\n", (UINTN)Address, *In.Uint64));
         MmioWrite64 ((UINTN)Address, *In.Uint64);
         break;
       case S3BootScriptWidthFifoUint64:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint64 - 0x%08x (0x%016lx)\n", (UINTN)OriginalAddress, *In.Uint64));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint64 - 0x%08x (0x%016lx)\n", (UINTN)OriginalAddress, *In.Uint64));
         MmioWrite64 ((UINTN)OriginalAddress, *In.Uint64);
         break;
       case S3BootScriptWidthFillUint64:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint64 - 0x%08x (0x%016lx)\n", (UINTN)Address, *OriginalIn.Uint64));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint64 - 0x%08x (0x%016lx)\n", (UINTN)Address, *OriginalIn.Uint64));
         MmioWrite64 ((UINTN)Address, *OriginalIn.Uint64);
         break;
       default:
@@ -682,41 +682,41 @@ ScriptPciCfg2Read (
   for ( ; Count > 0; Count--, PciAddress += AddressStride, Out.Buf += BufferStride) {
     switch (Width) {
       case S3BootScriptWidthUint8:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint8 - 0x%016lx\n", PciAddress));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint8 - 0x%016lx\n", PciAddress));
         *Out.Uint8 = PciSegmentRead8 (PciAddress);
         break;
       case S3BootScriptWidthFifoUint8:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint8 - 0x%016lx\n", PciAddress));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint8 - 0x%016lx\n", PciAddress));
         *Out.Uint8 = PciSegmentRead8 (PciAddress);
         break;
       case S3BootScriptWidthFillUint8:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint8 - 0x%016lx\n", PciAddress));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint8 - 0x%016lx\n", PciAddress));
         *Out.Uint8 = PciSegmentRead8 (PciAddress);
         break;
 
       case S3BootScriptWidthUint16:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint16 - 0x%016lx\n", PciAddress));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint16 - 0x%016lx\n", PciAddress));
         *Out.Uint16 = PciSegmentRead16 (PciAddress);
         break;
       case S3BootScriptWidthFifoUint16:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint16 - 0x%016lx\n", PciAddress));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint16 - 0x%016lx\n", PciAddress));
         *Out.Uint16 = PciSegmentRead16 (PciAddress);
         break;
       case S3BootScriptWidthFillUint16:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint16 - 0x%016lx\n", PciAddress));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint16 - 0x%016lx\n", PciAddress));
         *Out.Uint16 = PciSegmentRead16 (PciAddress);
         break;
 
       case S3BootScriptWidthUint32:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint32 - 0x%016lx\n", PciAddress));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint32 - 0x%016lx\n", PciAddress));
         *Out.Uint32 = PciSegmentRead32 (PciAddress);
         break;
       case S3BootScriptWidthFifoUint32:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint32 - 0x%016lx\n", PciAddress));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint32 - 0x%016lx\n", PciAddress));
         *Out.Uint32 = PciSegmentRead32 (PciAddress);
         break;
       case S3BootScriptWidthFillUint32:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint32 - 0x%016lx\n", PciAddress));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint32 - 0x%016lx\n", PciAddress));
         *Out.Uint32 = PciSegmentRead32 (PciAddress);
         break;
 
@@ -776,39 +776,39 @@ ScriptPciCfg2Write (
   for ( ; Count > 0; Count--, PciAddress += AddressStride, In.Buf += BufferStride) {
     switch (Width) {
       case S3BootScriptWidthUint8:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint8 - 0x%016lx (0x%02x)\n", PciAddress, (UINTN)*In.Uint8));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint8 - 0x%016lx (0x%02x)\n", PciAddress, (UINTN)*In.Uint8));
         PciSegmentWrite8 (PciAddress, *In.Uint8);
         break;
       case S3BootScriptWidthFifoUint8:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint8 - 0x%016lx (0x%02x)\n", OriginalPciAddress, (UINTN)*In.Uint8));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint8 - 0x%016lx (0x%02x)\n", OriginalPciAddress, (UINTN)*In.Uint8));
         PciSegmentWrite8 (OriginalPciAddress, *In.Uint8);
         break;
       case S3BootScriptWidthFillUint8:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint8 - 0x%016lx (0x%02x)\n", PciAddress, (UINTN)*OriginalIn.Uint8));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint8 - 0x%016lx (0x%02x)\n", PciAddress, (UINTN)*OriginalIn.Uint8));
         PciSegmentWrite8 (PciAddress, *OriginalIn.Uint8);
         break;
       case S3BootScriptWidthUint16:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint16 - 0x%016lx (0x%04x)\n", PciAddress, (UINTN)*In.Uint16));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint16 - 0x%016lx (0x%04x)\n", PciAddress, (UINTN)*In.Uint16));
         PciSegmentWrite16 (PciAddress, *In.Uint16);
         break;
       case S3BootScriptWidthFifoUint16:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint16 - 0x%016lx (0x%04x)\n", OriginalPciAddress, (UINTN)*In.Uint16));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint16 - 0x%016lx (0x%04x)\n", OriginalPciAddress, (UINTN)*In.Uint16));
         PciSegmentWrite16 (OriginalPciAddress, *In.Uint16);
         break;
       case S3BootScriptWidthFillUint16:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint16 - 0x%016lx (0x%04x)\n", PciAddress, (UINTN)*OriginalIn.Uint16));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint16 - 0x%016lx (0x%04x)\n", PciAddress, (UINTN)*OriginalIn.Uint16));
         PciSegmentWrite16 (PciAddress, *OriginalIn.Uint16);
         break;
       case S3BootScriptWidthUint32:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthUint32 - 0x%016lx (0x%08x)\n", PciAddress, (UINTN)*In.Uint32));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthUint32 - 0x%016lx (0x%08x)\n", PciAddress, (UINTN)*In.Uint32));
         PciSegmentWrite32 (PciAddress, *In.Uint32);
         break;
       case S3BootScriptWidthFifoUint32:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFifoUint32 - 0x%016lx (0x%08x)\n", OriginalPciAddress, (UINTN)*In.Uint32));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFifoUint32 - 0x%016lx (0x%08x)\n", OriginalPciAddress, (UINTN)*In.Uint32));
         PciSegmentWrite32 (OriginalPciAddress, *In.Uint32);
         break;
       case S3BootScriptWidthFillUint32:
-        DEBUG ((DEBUG_INFO, "S3BootScriptWidthFillUint32 - 0x%016lx (0x%08x)\n", (UINTN)PciAddress, (UINTN)*OriginalIn.Uint32));
+        DEBUG ((DEBUG_VERBOSE, "S3BootScriptWidthFillUint32 - 0x%016lx (0x%08x)\n", (UINTN)PciAddress, (UINTN)*OriginalIn.Uint32));
         PciSegmentWrite32 (PciAddress, *OriginalIn.Uint32);
         break;
       default:
@@ -1662,7 +1662,7 @@ S3BootScriptExecute (
   DEBUG ((DEBUG_INFO, "TableHeader.TableLength - 0x%08x\n", (UINTN)TableLength));
 
   while ((UINTN)Script < (UINTN)(StartAddress + TableLength)) {
-    DEBUG ((DEBUG_INFO, "ExecuteBootScript - %08x\n", (UINTN)Script));
+    DEBUG ((DEBUG_VERBOSE, "ExecuteBootScript - %08x\n", (UINTN)Script));
 
     CopyMem ((VOID *)&ScriptHeader, Script, sizeof (EFI_BOOT_SCRIPT_COMMON_HEADER));
     switch (ScriptHeader.OpCode) {
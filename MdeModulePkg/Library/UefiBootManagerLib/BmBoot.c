@@ -17,7 +17,9 @@ EFI_BOOT_MANAGER_LEGACY_BOOT                 mBmLegacyBoot              = NULL;
 
 ///
 /// This GUID is used for an EFI Variable that stores the front device pathes
-/// for a partial device path that starts with the HD node.
+/// for a partial device path that starts with the HD node, and for an EFI
+/// Variable that stores the file system a partial device path that starts
+/// with the File-path node was last booted from.
 ///
 EFI_GUID  mBmHardDriveBootVariableGuid = {
   0xfab7e9e1, 0x39dd, 0x4f2b, { 0x84, 0x08, 0xe2, 0x0e, 0x90, 0x6c, 0xb6, 0xde }
@@ -651,6 +653,114 @@ BmExpandUsbDevicePath (
   return NextFullPath;
 }
 
+/**
+  Return the full path of the short-form File-path device path on the file
+  system it was last booted from, connecting only that file system.
+
+  @param FilePath      The device path pointing to a load option.
+                       It could be a short-form device path.
+
+  @return The full path on the cached file system, or NULL if there is no
+          cached file system or it is not present.
+          Caller is responsible to free the memory.
+**/
+EFI_DEVICE_PATH_PROTOCOL *
+BmGetCachedFileSystemFullPath (
+  IN  EFI_DEVICE_PATH_PROTOCOL  *FilePath
+  )
+{
+  EFI_STATUS                Status;
+  EFI_DEVICE_PATH_PROTOCOL  *CachedDevicePath;
+  UINTN                     CachedDevicePathSize;
+  EFI_DEVICE_PATH_PROTOCOL  *Node;
+  EFI_HANDLE                Handle;
+  EFI_DEVICE_PATH_PROTOCOL  *FullPath;
+
+  GetVariable2 (L"FSDP", &mBmHardDriveBootVariableGuid, (VOID **)&CachedDevicePath, &CachedDevicePathSize);
+  if (CachedDevicePath == NULL) {
+    return NULL;
+  }
+
+  //
+  // Delete the invalid 'FSDP' variable.
+  //
+  if (!IsDevicePathValid (CachedDevicePath, CachedDevicePathSize)) {
+    FreePool (CachedDevicePath);
+    gRT->SetVariable (L"FSDP", &mBmHardDriveBootVariableGuid, 0, 0, NULL);
+    return NULL;
+  }
+
+  FullPath = NULL;
+  EfiBootManagerConnectDevicePath (CachedDevicePath, NULL);
+  Node   = CachedDevicePath;
+  Status = gBS->LocateDevicePath (&gEfiSimpleFileSystemProtocolGuid, &Node, &Handle);
+  if (!EFI_ERROR (Status) && IsDevicePathEnd (Node)) {
+    FullPath = AppendDevicePath (CachedDevicePath, FilePath);
+  }
+
+  FreePool (CachedDevicePath);
+  return FullPath;
+}
+
+/**
+  Save the file system a short-form File-path device path was booted from,
+  so that the next boot can try it before connecting all controllers.
+  Failing to save only impacts performance next time expanding the
+  short-form device path.
+
+  @param FilePath      The device path pointing to a load option.
+                       It could be a short-form device path.
+  @param FullPath      The full path the load option was loaded from.
+**/
+VOID
+BmCacheFileSystemDevicePath (
+  IN  EFI_DEVICE_PATH_PROTOCOL  *FilePath,
+  IN  EFI_DEVICE_PATH_PROTOCOL  *FullPath
+  )
+{
+  EFI_STATUS                Status;
+  EFI_DEVICE_PATH_PROTOCOL  *Node;
+  EFI_HANDLE                Handle;
+  EFI_DEVICE_PATH_PROTOCOL  *DevicePath;
+  EFI_DEVICE_PATH_PROTOCOL  *CachedDevicePath;
+  UINTN                     CachedDevicePathSize;
+
+  if ((DevicePathType (FilePath) != MEDIA_DEVICE_PATH) ||
+      (DevicePathSubType (FilePath) != MEDIA_FILEPATH_DP))
+  {
+    return;
+  }
+
+  Node   = FullPath;
+  Status = gBS->LocateDevicePath (&gEfiSimpleFileSystemProtocolGuid, &Node, &Handle);
+  if (EFI_ERROR (Status)) {
+    return;
+  }
+
+  DevicePath = DevicePathFromHandle (Handle);
+  if (DevicePath == NULL) {
+    return;
+  }
+
+  GetVariable2 (L"FSDP", &mBmHardDriveBootVariableGuid, (VOID **)&CachedDevicePath, &CachedDevicePathSize);
+  if ((CachedDevicePath == NULL) ||
+      (CachedDevicePathSize != GetDevicePathSize (DevicePath)) ||
+      (CompareMem (CachedDevicePath, DevicePath, CachedDevicePathSize) != 0))
+  {
+    gRT->SetVariable (
+           L"FSDP",
+           &mBmHardDriveBootVariableGuid,
+           EFI_VARIABLE_BOOTSERVICE_ACCESS | EFI_VARIABLE_NON_VOLATILE,
+           GetDevicePathSize (DevicePath),
+           DevicePath
+           );
+  }
+
+  if (CachedDevicePath != NULL) {
+    FreePool (CachedDevicePath);
+  }
+}
+
 /**
   Expand File-path device path node to be full device path in platform.
 
@@ -675,16 +785,40 @@ BmExpandFileDevicePath (
   EFI_BLOCK_IO_PROTOCOL     *BlockIo;
   UINTN                     MediaType;
   EFI_DEVICE_PATH_PROTOCOL  *NextFullPath;
+  EFI_DEVICE_PATH_PROTOCOL  *CachedFullPath;
   BOOLEAN                   GetNext;
 
+  //
+  // The file system the load option was last booted from is tried first,
+  // before connecting all controllers.
+  //
+  CachedFullPath = BmGetCachedFileSystemFullPath (FilePath);
+  if ((FullPath == NULL) && (CachedFullPath != NULL)) {
+    return CachedFullPath;
+  }
+
   EfiBootManagerConnectAll ();
+  if (CachedFullPath == NULL) {
+    CachedFullPath = BmGetCachedFileSystemFullPath (FilePath);
+    if ((FullPath == NULL) && (CachedFullPath != NULL)) {
+      return CachedFullPath;
+    }
+  }
+
   Status = gBS->LocateHandleBuffer (ByProtocol, &gEfiSimpleFileSystemProtocolGuid, NULL, &HandleCount, &Handles);
   if (EFI_ERROR (Status)) {
     HandleCount = 0;
     Handles     = NULL;
   }
 
-  GetNext      = (BOOLEAN)(FullPath == NULL);
+  GetNext = (BOOLEAN)(FullPath == NULL);
+  if ((FullPath != NULL) && (CachedFullPath != NULL) &&
+      (GetDevicePathSize (FullPath) == GetDevicePathSize (CachedFullPath)) &&
+      (CompareMem (FullPath, CachedFullPath, GetDevicePathSize (FullPath)) == 0))
+  {
+    GetNext = TRUE;
+  }
+
   NextFullPath = NULL;
   //
   // Enumerate all removable media devices followed by all fixed media devices,
@@ -703,6 +837,18 @@ BmExpandFileDevicePath (
           )
       {
         NextFullPath = AppendDevicePath (DevicePathFromHandle (Handles[Index]), FilePath);
+        if ((CachedFullPath != NULL) &&
+            (GetDevicePathSize (NextFullPath) == GetDevicePathSize (CachedFullPath)) &&
+            (CompareMem (NextFullPath, CachedFullPath, GetDevicePathSize (NextFullPath)) == 0))
+        {
+          //
+          // The cached file system was already returned ahead of all others.
+          //
+          FreePool (NextFullPath);
+          NextFullPath = NULL;
+          continue;
+        }
+
         if (GetNext) {
           break;
         } else {
@@ -722,6 +868,10 @@ BmExpandFileDevicePath (
     FreePool (Handles);
   }
 
+  if (CachedFullPath != NULL) {
+    FreePool (CachedFullPath);
+  }
+
   return NextFullPath;
 }
 
@@ -1966,6 +2116,10 @@ EfiBootManagerBoot (
     }
 
     if (FilePath != NULL) {
+      if (!EFI_ERROR (Status)) {
+        BmCacheFileSystemDevicePath (BootOption->FilePath, FilePath);
+      }
+
       FreePool (FilePath);
     }
 
@@ -875,58 +875,43 @@ EfiBootManagerIsValidLoadOptionVariableName (
 }
 
 /**
-  Build the Boot#### or Driver#### option from the VariableName.
+  Build the Boot#### or Driver#### option from the content of its variable.
 
-  @param  VariableName          Variable name of the load option
+  @param  OptionType            The type of the load option.
+  @param  OptionNumber          The number of the load option.
   @param  VendorGuid            Variable GUID of the load option
+  @param  Variable              The content of the load option variable.
+  @param  VariableSize          The size of the load option variable.
   @param  Option                Return the load option.
 
-  @retval EFI_SUCCESS     Get the option just been created
-  @retval EFI_NOT_FOUND   Failed to get the new option
+  @retval EFI_SUCCESS            Get the option just been created
+  @retval EFI_INVALID_PARAMETER  The variable content is not a valid load option.
 
 **/
+STATIC
 EFI_STATUS
-EFIAPI
-EfiBootManagerVariableToLoadOptionEx (
-  IN CHAR16                            *VariableName,
-  IN EFI_GUID                          *VendorGuid,
-  IN OUT EFI_BOOT_MANAGER_LOAD_OPTION  *Option
+BmVariableDataToLoadOption (
+  IN EFI_BOOT_MANAGER_LOAD_OPTION_TYPE  OptionType,
+  IN UINT16                             OptionNumber,
+  IN EFI_GUID                           *VendorGuid,
+  IN UINT8                              *Variable,
+  IN UINTN                              VariableSize,
+  IN OUT EFI_BOOT_MANAGER_LOAD_OPTION   *Option
   )
 {
-  EFI_STATUS                         Status;
-  UINT32                             Attribute;
-  UINT16                             FilePathSize;
-  UINT8                              *Variable;
-  UINT8                              *VariablePtr;
-  UINTN                              VariableSize;
-  EFI_DEVICE_PATH_PROTOCOL           *FilePath;
-  UINT8                              *OptionalData;
-  UINT32                             OptionalDataSize;
-  CHAR16                             *Description;
-  EFI_BOOT_MANAGER_LOAD_OPTION_TYPE  OptionType;
-  UINT16                             OptionNumber;
-
-  if ((VariableName == NULL) || (Option == NULL)) {
-    return EFI_INVALID_PARAMETER;
-  }
-
-  if (!EfiBootManagerIsValidLoadOptionVariableName (VariableName, &OptionType, &OptionNumber)) {
-    return EFI_INVALID_PARAMETER;
-  }
-
-  //
-  // Read the variable
-  //
-  GetVariable2 (VariableName, VendorGuid, (VOID **)&Variable, &VariableSize);
-  if (Variable == NULL) {
-    return EFI_NOT_FOUND;
-  }
+  EFI_STATUS                Status;
+  UINT32                    Attribute;
+  UINT16                    FilePathSize;
+  UINT8                     *VariablePtr;
+  EFI_DEVICE_PATH_PROTOCOL  *FilePath;
+  UINT8                     *OptionalData;
+  UINT32                    OptionalDataSize;
+  CHAR16                    *Description;
 
   //
   // Validate *#### variable data.
   //
   if (!BmValidateOption (Variable, VariableSize)) {
-    FreePool (Variable);
     return EFI_INVALID_PARAMETER;
   }
 
@@ -980,6 +965,52 @@ EfiBootManagerVariableToLoadOptionEx (
 
   CopyGuid (&Option->VendorGuid, VendorGuid);
 
+  return Status;
+}
+
+/**
+  Build the Boot#### or Driver#### option from the VariableName.
+
+  @param  VariableName          Variable name of the load option
+  @param  VendorGuid            Variable GUID of the load option
+  @param  Option                Return the load option.
+
+  @retval EFI_SUCCESS     Get the option just been created
+  @retval EFI_NOT_FOUND   Failed to get the new option
+
+**/
+EFI_STATUS
+EFIAPI
+EfiBootManagerVariableToLoadOptionEx (
+  IN CHAR16                            *VariableName,
+  IN EFI_GUID                          *VendorGuid,
+  IN OUT EFI_BOOT_MANAGER_LOAD_OPTION  *Option
+  )
+{
+  EFI_STATUS                         Status;
+  UINT8                              *Variable;
+  UINTN                              VariableSize;
+  EFI_BOOT_MANAGER_LOAD_OPTION_TYPE  OptionType;
+  UINT16                             OptionNumber;
+
+  if ((VariableName == NULL) || (Option == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (!EfiBootManagerIsValidLoadOptionVariableName (VariableName, &OptionType, &OptionNumber)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // Read the variable
+  //
+  GetVariable2 (VariableName, VendorGuid, (VOID **)&Variable, &VariableSize);
+  if (Variable == NULL) {
+    return EFI_NOT_FOUND;
+  }
+
+  Status = BmVariableDataToLoadOption (OptionType, OptionNumber, VendorGuid, Variable, VariableSize, Option);
+
   FreePool (Variable);
   return Status;
 }
@@ -1061,6 +1092,129 @@ BmCollectLoadOptions (
   }
 }
 
+/**
+  Read the L"Boot####"/L"Driver####" variables referenced by an option order
+  variable with the variable batch protocol. When the variable driver runs in
+  SMM this costs two SMIs for all the options instead of two per option.
+
+  @param  LoadOptionType    The type of the load option.
+  @param  OptionOrder       The content of the option order variable.
+  @param  OptionCount       The number of entries in OptionOrder.
+  @param  Variables         Return the content of each variable, NULL for the
+                            variables that could not be read.
+  @param  VariableSizes     Return the size of each variable.
+
+  @retval EFI_SUCCESS           Variables and VariableSizes hold one entry per option.
+  @retval EFI_UNSUPPORTED       The variable batch protocol is not available.
+  @retval EFI_OUT_OF_RESOURCES  There is not enough memory for the batch.
+
+**/
+STATIC
+EFI_STATUS
+BmGetLoadOptionVariables (
+  IN  EFI_BOOT_MANAGER_LOAD_OPTION_TYPE  LoadOptionType,
+  IN  UINT16                             *OptionOrder,
+  IN  UINTN                              OptionCount,
+  OUT UINT8                              ***Variables,
+  OUT UINTN                              **VariableSizes
+  )
+{
+  EFI_STATUS                     Status;
+  EDKII_VARIABLE_BATCH_PROTOCOL  *VariableBatch;
+  EDKII_VARIABLE_BATCH_REQUEST   *Requests;
+  CHAR16                         (*OptionNames)[BM_OPTION_NAME_LEN];
+  UINTN                          Index;
+
+  Status = gBS->LocateProtocol (&gEdkiiVariableBatchProtocolGuid, NULL, (VOID **)&VariableBatch);
+  if (EFI_ERROR (Status)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  Requests       = AllocateZeroPool (OptionCount * sizeof (*Requests));
+  OptionNames    = AllocatePool (OptionCount * sizeof (*OptionNames));
+  *Variables     = AllocateZeroPool (OptionCount * sizeof (**Variables));
+  *VariableSizes = AllocateZeroPool (OptionCount * sizeof (**VariableSizes));
+  if ((Requests == NULL) || (OptionNames == NULL) || (*Variables == NULL) || (*VariableSizes == NULL)) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto Done;
+  }
+
+  //
+  // The first pass only returns the size of each variable.
+  //
+  for (Index = 0; Index < OptionCount; Index++) {
+    UnicodeSPrint (OptionNames[Index], sizeof (OptionNames[Index]), L"%s%04x", mBmLoadOptionName[LoadOptionType], OptionOrder[Index]);
+    Requests[Index].VariableName = OptionNames[Index];
+    Requests[Index].VendorGuid   = &gEfiGlobalVariableGuid;
+  }
+
+  Status = VariableBatch->GetVariables (VariableBatch, OptionCount, Requests);
+  if (EFI_ERROR (Status)) {
+    goto Done;
+  }
+
+  for (Index = 0; Index < OptionCount; Index++) {
+    if (Requests[Index].Status != EFI_BUFFER_TOO_SMALL) {
+      Requests[Index].DataSize = 0;
+      continue;
+    }
+
+    Requests[Index].Data = AllocatePool (Requests[Index].DataSize);
+    if (Requests[Index].Data == NULL) {
+      Status = EFI_OUT_OF_RESOURCES;
+      goto Done;
+    }
+  }
+
+  Status = VariableBatch->GetVariables (VariableBatch, OptionCount, Requests);
+  if (EFI_ERROR (Status)) {
+    goto Done;
+  }
+
+  for (Index = 0; Index < OptionCount; Index++) {
+    if (Requests[Index].Status == EFI_SUCCESS) {
+      (*Variables)[Index]     = Requests[Index].Data;
+      (*VariableSizes)[Index] = Requests[Index].DataSize;
+      Requests[Index].Data    = NULL;
+    }
+  }
+
+Done:
+  if (Requests != NULL) {
+    for (Index = 0; Index < OptionCount; Index++) {
+      if (Requests[Index].Data != NULL) {
+        FreePool (Requests[Index].Data);
+      }
+    }
+
+    FreePool (Requests);
+  }
+
+  if (OptionNames != NULL) {
+    FreePool (OptionNames);
+  }
+
+  if (EFI_ERROR (Status)) {
+    if (*Variables != NULL) {
+      for (Index = 0; Index < OptionCount; Index++) {
+        if ((*Variables)[Index] != NULL) {
+          FreePool ((*Variables)[Index]);
+        }
+      }
+
+      FreePool (*Variables);
+      *Variables = NULL;
+    }
+
+    if (*VariableSizes != NULL) {
+      FreePool (*VariableSizes);
+      *VariableSizes = NULL;
+    }
+  }
+
+  return Status;
+}
+
 /**
   Returns an array of load options based on the EFI variable
   L"BootOrder"/L"DriverOrder" and the L"Boot####"/L"Driver####" variables impled by it.
@@ -1089,6 +1243,8 @@ EfiBootManagerGetLoadOptions (
   CHAR16                         OptionName[BM_OPTION_NAME_LEN];
   UINT16                         OptionNumber;
   BM_COLLECT_LOAD_OPTIONS_PARAM  Param;
+  UINT8                          **Variables;
+  UINTN                          *VariableSizes;
 
   *OptionCount = 0;
   Options      = NULL;
@@ -1107,12 +1263,33 @@ EfiBootManagerGetLoadOptions (
     Options = AllocatePool (*OptionCount * sizeof (EFI_BOOT_MANAGER_LOAD_OPTION));
     ASSERT (Options != NULL);
 
+    Status = BmGetLoadOptionVariables (LoadOptionType, OptionOrder, *OptionCount, &Variables, &VariableSizes);
+    if (EFI_ERROR (Status)) {
+      Variables     = NULL;
+      VariableSizes = NULL;
+    }
+
     OptionIndex = 0;
     for (Index = 0; Index < *OptionCount; Index++) {
       OptionNumber = OptionOrder[Index];
       UnicodeSPrint (OptionName, sizeof (OptionName), L"%s%04x", mBmLoadOptionName[LoadOptionType], OptionNumber);
 
-      Status = EfiBootManagerVariableToLoadOption (OptionName, &Options[OptionIndex]);
+      if (Variables == NULL) {
+        Status = EfiBootManagerVariableToLoadOption (OptionName, &Options[OptionIndex]);
+      } else if (Variables[Index] == NULL) {
+        Status = EFI_NOT_FOUND;
+      } else {
+        Status = BmVariableDataToLoadOption (
+                   LoadOptionType,
+                   OptionNumber,
+                   &gEfiGlobalVariableGuid,
+                   Variables[Index],
+                   VariableSizes[Index],
+                   &Options[OptionIndex]
+                   );
+        FreePool (Variables[Index]);
+      }
+
       if (EFI_ERROR (Status)) {
         DEBUG ((DEBUG_INFO, "[Bds] %s doesn't exist - Update ****Order variable to remove the reference!!", OptionName));
         EfiBootManagerDeleteLoadOptionVariable (OptionNumber, LoadOptionType);
@@ -1122,6 +1299,11 @@ EfiBootManagerGetLoadOptions (
       }
     }
 
+    if (Variables != NULL) {
+      FreePool (Variables);
+      FreePool (VariableSizes);
+    }
+
     if (OptionOrder != NULL) {
       FreePool (OptionOrder);
     }
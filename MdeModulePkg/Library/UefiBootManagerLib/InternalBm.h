@@ -42,6 +42,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Protocol/RamDisk.h>
 #include <Protocol/DeferredImageLoad.h>
 #include <Protocol/PlatformBootManager.h>
+#include <Protocol/VariableBatch.h>
 
 #include <Guid/MemoryTypeInformation.h>
 #include <Guid/FileInfo.h>
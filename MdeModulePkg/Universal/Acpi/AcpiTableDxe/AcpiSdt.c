@@ -84,31 +84,45 @@ FindTableByBuffer (
 }
 
 /**
-  This function updates AML table checksum.
+  This function updates AML table checksum for a piece of AML code that is
+  about to be overwritten.
   It will search the ACPI table installed by ACPI_TABLE protocol.
 
+  Only the bytes that change are summed, so the cost does not depend on the
+  size of the table.
+
   @param[in]  Buffer        A piece of AML code buffer pointer.
+  @param[in]  Data          The data that will replace the AML code.
+  @param[in]  DataSize      The size of Data.
 
   @retval EFI_SUCCESS       The table holds the AML buffer is found, and checksum is updated.
   @retval EFI_NOT_FOUND     The table holds the AML buffer is not found.
 **/
 EFI_STATUS
 SdtUpdateAmlChecksum (
-  IN VOID  *Buffer
+  IN VOID        *Buffer,
+  IN CONST VOID  *Data,
+  IN UINTN       DataSize
   )
 {
-  EFI_ACPI_TABLE_LIST  *CurrentTableList;
+  EFI_ACPI_TABLE_LIST          *CurrentTableList;
+  EFI_ACPI_DESCRIPTION_HEADER  *Table;
 
   CurrentTableList = FindTableByBuffer (Buffer);
   if (CurrentTableList == NULL) {
     return EFI_NOT_FOUND;
   }
 
-  AcpiPlatformChecksum (
-    (VOID *)CurrentTableList->Table,
-    CurrentTableList->Table->Length,
-    OFFSET_OF (EFI_ACPI_DESCRIPTION_HEADER, Checksum)
-    );
+  if (DataSize == 0) {
+    return EFI_SUCCESS;
+  }
+
+  //
+  // The sum of all bytes of the table stays zero if the checksum takes up
+  // the difference between the old and the new bytes.
+  //
+  Table           = (EFI_ACPI_DESCRIPTION_HEADER *)CurrentTableList->Table;
+  Table->Checksum = (UINT8)(Table->Checksum + CalculateSum8 (Buffer, DataSize) - CalculateSum8 (Data, DataSize));
   return EFI_SUCCESS;
 }
 
@@ -488,7 +502,6 @@ SdtOpenSdtTable (
   AmlHandle->Buffer          = (VOID *)((UINTN)Table->Table + sizeof (EFI_ACPI_SDT_HEADER));
   AmlHandle->Size            = Table->Table->Length - sizeof (EFI_ACPI_SDT_HEADER);
   AmlHandle->AmlByteEncoding = NULL;
-  AmlHandle->Modified        = FALSE;
 
   //
   // return the ACPI handle
@@ -564,7 +577,6 @@ SdtOpenEx (
   AmlHandle->Signature       = EFI_AML_HANDLE_SIGNATURE;
   AmlHandle->Buffer          = Buffer;
   AmlHandle->AmlByteEncoding = AmlByteEncoding;
-  AmlHandle->Modified        = FALSE;
 
   AmlHandle->Size = AmlGetObjectSize (AmlByteEncoding, Buffer, BufferSize);
   if (AmlHandle->Size == 0) {
@@ -630,7 +642,6 @@ Close (
   )
 {
   EFI_AML_HANDLE  *AmlHandle;
-  EFI_STATUS      Status;
 
   //
   // Check for invalid input parameters
@@ -647,15 +658,8 @@ Close (
   }
 
   //
-  // Update Checksum only if modified
+  // The checksum is kept up to date by SetOption().
   //
-  if (AmlHandle->Modified) {
-    Status = SdtUpdateAmlChecksum (AmlHandle->Buffer);
-    if (EFI_ERROR (Status)) {
-      return EFI_INVALID_PARAMETER;
-    }
-  }
-
   FreePool (AmlHandle);
 
   return EFI_SUCCESS;
@@ -798,8 +802,12 @@ SetOption (
   //
   // Update
   //
+  Status = SdtUpdateAmlChecksum (OrgData, Data, DataSize);
+  if (EFI_ERROR (Status)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
   CopyMem (OrgData, Data, DataSize);
-  AmlHandle->Modified = TRUE;
 
   return EFI_SUCCESS;
 }
@@ -1058,9 +1066,12 @@ FindPath (
   }
 
   DEBUG_CODE_BEGIN ();
-  DEBUG ((DEBUG_ERROR, "AcpiSdt: FindPath - "));
-  AmlPrintNameString (AmlPath);
-  DEBUG ((DEBUG_ERROR, "\n"));
+  if (DebugPrintLevelEnabled (DEBUG_VERBOSE)) {
+    DEBUG ((DEBUG_VERBOSE, "AcpiSdt: FindPath - "));
+    AmlPrintNameString (AmlPath);
+    DEBUG ((DEBUG_VERBOSE, "\n"));
+  }
+
   DEBUG_CODE_END ();
 
   if (AmlHandle->Signature == EFI_AML_ROOT_HANDLE_SIGNATURE) {
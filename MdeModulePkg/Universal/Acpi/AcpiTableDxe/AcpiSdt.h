@@ -92,7 +92,6 @@ typedef struct {
   UINT8                *Buffer;
   UINTN                Size;
   AML_BYTE_ENCODING    *AmlByteEncoding;
-  BOOLEAN              Modified;
 } EFI_AML_HANDLE;
 
 typedef UINT32 AML_OP_PARSE_INDEX;
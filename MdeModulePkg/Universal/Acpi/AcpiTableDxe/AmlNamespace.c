@@ -480,16 +480,16 @@ AmlDumpNodeInfo (
   CurrentLink = AmlParentNodeList->Children.ForwardLink;
 
   if (Level == 0) {
-    DEBUG ((DEBUG_ERROR, "\\"));
+    DEBUG ((DEBUG_VERBOSE, "\\"));
   } else {
     for (Index = 0; Index < Level; Index++) {
-      DEBUG ((DEBUG_ERROR, "    "));
+      DEBUG ((DEBUG_VERBOSE, "    "));
     }
 
     AmlPrintNameSeg (AmlParentNodeList->Name);
   }
 
-  DEBUG ((DEBUG_ERROR, "\n"));
+  DEBUG ((DEBUG_VERBOSE, "\n"));
 
   while (CurrentLink != &AmlParentNodeList->Children) {
     CurrentAmlNodeList = EFI_AML_NODE_LIST_FROM_LINK (CurrentLink);
@@ -548,9 +548,15 @@ AmlFindPath (
     return EFI_INVALID_PARAMETER;
   }
 
+  //
+  // Walking the whole namespace is only worth it if the dump is printed.
+  //
   DEBUG_CODE_BEGIN ();
-  DEBUG ((DEBUG_ERROR, "AcpiSdt: NameSpace:\n"));
-  AmlDumpNodeInfo (AmlRootNodeList, 0);
+  if (DebugPrintLevelEnabled (DEBUG_VERBOSE)) {
+    DEBUG ((DEBUG_VERBOSE, "AcpiSdt: NameSpace:\n"));
+    AmlDumpNodeInfo (AmlRootNodeList, 0);
+  }
+
   DEBUG_CODE_END ();
 
   //
@@ -585,9 +591,12 @@ AmlFindPath (
   //
   if (CurrentAmlNodeList != NULL) {
     DEBUG_CODE_BEGIN ();
-    DEBUG ((DEBUG_ERROR, "AcpiSdt: Search from: \\"));
-    AmlPrintNameSeg (CurrentAmlNodeList->Name);
-    DEBUG ((DEBUG_ERROR, "\n"));
+    if (DebugPrintLevelEnabled (DEBUG_VERBOSE)) {
+      DEBUG ((DEBUG_VERBOSE, "AcpiSdt: Search from: \\"));
+      AmlPrintNameSeg (CurrentAmlNodeList->Name);
+      DEBUG ((DEBUG_VERBOSE, "\n"));
+    }
+
     DEBUG_CODE_END ();
     AmlNodeList = AmlFindNodeInTheTree (
                     AmlPath,
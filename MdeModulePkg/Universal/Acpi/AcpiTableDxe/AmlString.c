@@ -467,22 +467,22 @@ AmlPrintNameSeg (
   IN UINT8  *Buffer
   )
 {
-  DEBUG ((DEBUG_ERROR, "%c", Buffer[0]));
+  DEBUG ((DEBUG_VERBOSE, "%c", Buffer[0]));
   if ((Buffer[1] == '_') && (Buffer[2] == '_') && (Buffer[3] == '_')) {
     return;
   }
 
-  DEBUG ((DEBUG_ERROR, "%c", Buffer[1]));
+  DEBUG ((DEBUG_VERBOSE, "%c", Buffer[1]));
   if ((Buffer[2] == '_') && (Buffer[3] == '_')) {
     return;
   }
 
-  DEBUG ((DEBUG_ERROR, "%c", Buffer[2]));
+  DEBUG ((DEBUG_VERBOSE, "%c", Buffer[2]));
   if (Buffer[3] == '_') {
     return;
   }
 
-  DEBUG ((DEBUG_ERROR, "%c", Buffer[3]));
+  DEBUG ((DEBUG_VERBOSE, "%c", Buffer[3]));
   return;
 }
 
@@ -504,14 +504,14 @@ AmlPrintNameString (
     // RootChar
     //
     Buffer++;
-    DEBUG ((DEBUG_ERROR, "\\"));
+    DEBUG ((DEBUG_VERBOSE, "\\"));
   } else if (*Buffer == AML_PARENT_PREFIX_CHAR) {
     //
     // ParentPrefixChar
     //
     do {
       Buffer++;
-      DEBUG ((DEBUG_ERROR, "^"));
+      DEBUG ((DEBUG_VERBOSE, "^"));
     } while (*Buffer == AML_PARENT_PREFIX_CHAR);
   }
 
@@ -543,7 +543,7 @@ AmlPrintNameString (
   AmlPrintNameSeg (Buffer);
   Buffer += AML_NAME_SEG_SIZE;
   for (Index = 0; Index < SegCount - 1; Index++) {
-    DEBUG ((DEBUG_ERROR, "."));
+    DEBUG ((DEBUG_VERBOSE, "."));
     AmlPrintNameSeg (Buffer);
     Buffer += AML_NAME_SEG_SIZE;
   }
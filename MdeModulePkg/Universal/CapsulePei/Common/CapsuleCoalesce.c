@@ -1196,62 +1196,58 @@ CapsuleDataCoalesce (
   PrivateDataPtr = (EFI_CAPSULE_PEIM_PRIVATE_DATA *)NewCapsuleBase;
 
   //
-  // Move all the blocks to the top (high) of memory.
-  // Relocate all the obstructing blocks. Note that the block descriptors
-  // were coalesced when they were relocated, so we can just ++ the pointer.
-  //
-  CurrentBlockDesc = BlockList;
-  while ((CurrentBlockDesc->Length != 0) || (CurrentBlockDesc->Union.ContinuationPointer != (EFI_PHYSICAL_ADDRESS)(UINTN)NULL)) {
-    if (CapsuleTimes == 0) {
+  // The blocks are copied in order to the top (high) of memory, so the
+  // destination of every block is known up front. Before anything is copied,
+  // relocate the blocks whose data lies in the part of the destination that is
+  // written before their own turn comes. A block overlapping only its own
+  // destination can stay, as CopyMem() handles overlapping buffers. Note that
+  // the block descriptors were coalesced when they were relocated, so we can
+  // just ++ the pointer.
+  //
+  DestLength    = sizeof (EFI_CAPSULE_PEIM_PRIVATE_DATA) + (CapsuleNumber - 1) * sizeof (UINT64);
+  TempBlockDesc = BlockList + 1;
+  while (TempBlockDesc->Length != 0) {
+    if (IsOverlapped (
+          (UINT8 *)NewCapsuleBase,
+          DestLength,
+          (UINT8 *)(UINTN)TempBlockDesc->Union.DataBlock,
+          (UINTN)TempBlockDesc->Length
+          ))
+    {
       //
-      // The first entry is the block descriptor for EFI_CAPSULE_PEIM_PRIVATE_DATA.
-      // CapsuleOffset field is uninitialized at this time. No need copy it, but need to reserve for future use.
+      // Relocate the block
       //
-      ASSERT (CurrentBlockDesc->Union.DataBlock == (UINT64)(UINTN)&PrivateData);
-      DestLength = sizeof (EFI_CAPSULE_PEIM_PRIVATE_DATA) + (CapsuleNumber - 1) * sizeof (UINT64);
-    } else {
-      DestLength = (UINTN)CurrentBlockDesc->Length;
-    }
+      RelocPtr = FindFreeMem (BlockList, FreeMemBase, FreeMemSize, (UINTN)TempBlockDesc->Length);
+      if (RelocPtr == NULL) {
+        return EFI_BUFFER_TOO_SMALL;
+      }
 
-    //
-    // See if any of the remaining capsule blocks are in the way
-    //
-    TempBlockDesc = CurrentBlockDesc;
-    while (TempBlockDesc->Length != 0) {
-      //
-      // Is this block in the way of where we want to copy the current descriptor to?
-      //
-      if (IsOverlapped (
-            (UINT8 *)DestPtr,
-            (UINTN)DestLength,
-            (UINT8 *)(UINTN)TempBlockDesc->Union.DataBlock,
-            (UINTN)TempBlockDesc->Length
-            ))
-      {
-        //
-        // Relocate the block
-        //
-        RelocPtr = FindFreeMem (BlockList, FreeMemBase, FreeMemSize, (UINTN)TempBlockDesc->Length);
-        if (RelocPtr == NULL) {
-          return EFI_BUFFER_TOO_SMALL;
-        }
+      CopyMem ((VOID *)RelocPtr, (VOID *)(UINTN)TempBlockDesc->Union.DataBlock, (UINTN)TempBlockDesc->Length);
+      DEBUG ((
+        DEBUG_INFO,
+        "Capsule reloc data block from 0x%8X to 0x%8X with size 0x%8X\n",
+        (UINTN)TempBlockDesc->Union.DataBlock,
+        (UINTN)RelocPtr,
+        (UINTN)TempBlockDesc->Length
+        ));
 
-        CopyMem ((VOID *)RelocPtr, (VOID *)(UINTN)TempBlockDesc->Union.DataBlock, (UINTN)TempBlockDesc->Length);
-        DEBUG ((
-          DEBUG_INFO,
-          "Capsule reloc data block from 0x%8X to 0x%8X with size 0x%8X\n",
-          (UINTN)TempBlockDesc->Union.DataBlock,
-          (UINTN)RelocPtr,
-          (UINTN)TempBlockDesc->Length
-          ));
+      TempBlockDesc->Union.DataBlock = (EFI_PHYSICAL_ADDRESS)(UINTN)RelocPtr;
+    }
 
-        TempBlockDesc->Union.DataBlock = (EFI_PHYSICAL_ADDRESS)(UINTN)RelocPtr;
-      }
+    DestLength += (UINTN)TempBlockDesc->Length;
+    TempBlockDesc++;
+  }
 
+  //
+  // Now copy every block straight to its destination, once.
+  //
+  CurrentBlockDesc = BlockList;
+  while ((CurrentBlockDesc->Length != 0) || (CurrentBlockDesc->Union.ContinuationPointer != (EFI_PHYSICAL_ADDRESS)(UINTN)NULL)) {
+    if (CapsuleTimes == 0) {
       //
-      // Next descriptor
+      // The first entry is the block descriptor for EFI_CAPSULE_PEIM_PRIVATE_DATA.
       //
-      TempBlockDesc++;
+      ASSERT (CurrentBlockDesc->Union.DataBlock == (UINT64)(UINTN)&PrivateData);
     }
 
     //
@@ -1296,7 +1292,7 @@ CapsuleDataCoalesce (
 
       CopyMem ((VOID *)DestPtr, (VOID *)(UINTN)(CurrentBlockDesc->Union.DataBlock), (UINTN)CurrentBlockDesc->Length);
       DEBUG ((
-        DEBUG_INFO,
+        DEBUG_VERBOSE,
         "Capsule coalesce block no.0x%lX from 0x%lX to 0x%lX with size 0x%lX\n",
         (UINT64)CapsuleTimes,
         CurrentBlockDesc->Union.DataBlock,
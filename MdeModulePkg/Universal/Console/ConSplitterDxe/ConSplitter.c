@@ -4637,14 +4637,13 @@ ConSplitterTextOutOutputString (
   IN  CHAR16                           *WString
   )
 {
-  EFI_STATUS                      Status;
-  TEXT_OUT_SPLITTER_PRIVATE_DATA  *Private;
-  UINTN                           Index;
-  EFI_STATUS                      ReturnStatus;
-  UINTN                           MaxColumn;
-  UINTN                           MaxRow;
-
-  This->SetAttribute (This, This->Mode->Attribute);
+  EFI_STATUS                       Status;
+  TEXT_OUT_SPLITTER_PRIVATE_DATA   *Private;
+  UINTN                            Index;
+  EFI_STATUS                       ReturnStatus;
+  UINTN                            MaxColumn;
+  UINTN                            MaxRow;
+  EFI_SIMPLE_TEXT_OUTPUT_PROTOCOL  *TextOut;
 
   Private = TEXT_OUT_SPLITTER_PRIVATE_DATA_FROM_THIS (This);
 
@@ -4652,10 +4651,16 @@ ConSplitterTextOutOutputString (
   // return the worst status met
   //
   for (Index = 0, ReturnStatus = EFI_SUCCESS; Index < Private->CurrentNumberOfConsoles; Index++) {
-    Status = Private->TextOutList[Index].TextOut->OutputString (
-                                                    Private->TextOutList[Index].TextOut,
-                                                    WString
-                                                    );
+    //
+    // Only bring the attribute of the console in line with the splitter
+    // when it differs, to save a call into every console per string.
+    //
+    TextOut = Private->TextOutList[Index].TextOut;
+    if (TextOut->Mode->Attribute != This->Mode->Attribute) {
+      TextOut->SetAttribute (TextOut, (UINTN)This->Mode->Attribute);
+    }
+
+    Status = TextOut->OutputString (TextOut, WString);
     if (EFI_ERROR (Status)) {
       ReturnStatus = Status;
     }
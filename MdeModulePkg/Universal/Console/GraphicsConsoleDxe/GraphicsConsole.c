@@ -660,6 +660,10 @@ Error:
       FreePool (Private->LineBuffer);
     }
 
+    if (Private->GlyphCache != NULL) {
+      FreePool (Private->GlyphCache);
+    }
+
     if (Private->ModeData != NULL) {
       FreePool (Private->ModeData);
     }
@@ -748,6 +752,10 @@ GraphicsConsoleControllerDriverStop (
       FreePool (Private->LineBuffer);
     }
 
+    if (Private->GlyphCache != NULL) {
+      FreePool (Private->GlyphCache);
+    }
+
     if (Private->ModeData != NULL) {
       FreePool (Private->ModeData);
     }
@@ -1756,6 +1764,170 @@ GetTextColors (
   return EFI_SUCCESS;
 }
 
+/**
+  Get the glyph of a narrow character rendered in the current text colors from
+  the glyph cache of the Graphics Console device, rendering it on a cache miss.
+
+  Only characters whose glyph fills exactly one EFI_GLYPH_WIDTH x EFI_GLYPH_HEIGHT
+  cell are cached.
+
+  @param  This                  Protocol instance pointer.
+  @param  Char                  The character.
+
+  @return The cached glyph, or NULL if the character cannot be cached.
+
+**/
+GRAPHICS_CONSOLE_GLYPH *
+GetCachedGlyph (
+  IN  EFI_SIMPLE_TEXT_OUTPUT_PROTOCOL  *This,
+  IN  CHAR16                           Char
+  )
+{
+  EFI_STATUS                     Status;
+  GRAPHICS_CONSOLE_DEV           *Private;
+  GRAPHICS_CONSOLE_GLYPH         *Glyph;
+  UINT8                          Attribute;
+  CHAR16                         String[2];
+  EFI_FONT_DISPLAY_INFO          FontInfo;
+  EFI_IMAGE_OUTPUT               Image;
+  EFI_IMAGE_OUTPUT               *Blt;
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL  Bitmap[EFI_GLYPH_HEIGHT][EFI_GLYPH_WIDTH * 2];
+  EFI_HII_ROW_INFO               *RowInfoArray;
+  UINTN                          RowInfoArraySize;
+  UINTN                          PosY;
+
+  Private = GRAPHICS_CONSOLE_CON_OUT_DEV_FROM_THIS (This);
+  if (Private->GlyphCache == NULL) {
+    Private->GlyphCache = AllocateZeroPool (GRAPHICS_CONSOLE_GLYPH_CACHE_SIZE * sizeof (GRAPHICS_CONSOLE_GLYPH));
+    if (Private->GlyphCache == NULL) {
+      return NULL;
+    }
+  }
+
+  Attribute = (UINT8)(This->Mode->Attribute & 0x7F);
+  Glyph     = &Private->GlyphCache[((UINTN)Char + (UINTN)Attribute * 97) % GRAPHICS_CONSOLE_GLYPH_CACHE_SIZE];
+  if (Glyph->Valid && (Glyph->Char == Char) && (Glyph->Attribute == Attribute)) {
+    return Glyph;
+  }
+
+  //
+  // Render the character into a buffer wide enough for a wide glyph, so that
+  // the width of its glyph is known.
+  //
+  String[0] = Char;
+  String[1] = L'\0';
+  ZeroMem (&FontInfo, sizeof (FontInfo));
+  GetTextColors (This, &FontInfo.ForegroundColor, &FontInfo.BackgroundColor);
+  Image.Width        = EFI_GLYPH_WIDTH * 2;
+  Image.Height       = EFI_GLYPH_HEIGHT;
+  Image.Image.Bitmap = &Bitmap[0][0];
+  Blt                = &Image;
+  RowInfoArray       = NULL;
+  RowInfoArraySize   = 0;
+
+  Status = mHiiFont->StringToImage (
+                       mHiiFont,
+                       EFI_HII_IGNORE_IF_NO_GLYPH | EFI_HII_IGNORE_LINE_BREAK,
+                       String,
+                       &FontInfo,
+                       &Blt,
+                       0,
+                       0,
+                       &RowInfoArray,
+                       &RowInfoArraySize,
+                       NULL
+                       );
+  if ((Status != EFI_SUCCESS) || (RowInfoArraySize != 1) ||
+      (RowInfoArray[0].LineWidth != EFI_GLYPH_WIDTH) || (RowInfoArray[0].LineHeight != EFI_GLYPH_HEIGHT))
+  {
+    if (RowInfoArray != NULL) {
+      FreePool (RowInfoArray);
+    }
+
+    return NULL;
+  }
+
+  FreePool (RowInfoArray);
+
+  for (PosY = 0; PosY < EFI_GLYPH_HEIGHT; PosY++) {
+    CopyMem (&Glyph->Bitmap[PosY * EFI_GLYPH_WIDTH], Bitmap[PosY], EFI_GLYPH_WIDTH * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL));
+  }
+
+  Glyph->Valid     = TRUE;
+  Glyph->Char      = Char;
+  Glyph->Attribute = Attribute;
+
+  return Glyph;
+}
+
+/**
+  Draw narrow Unicode characters on the Graphics Console device's screen with
+  the glyph cache, in the current text colors and with a single Blt() call.
+
+  @param  This                  Protocol instance pointer.
+  @param  UnicodeWeight         One Unicode string to be displayed.
+  @param  Count                 The count of Unicode string.
+
+  @retval EFI_SUCCESS           Drawing Unicode string implemented successfully.
+  @retval EFI_NOT_FOUND         Some of the characters cannot be drawn from the
+                                glyph cache. Nothing is drawn.
+  @retval Others                The Blt() call failed.
+
+**/
+EFI_STATUS
+DrawCachedGlyphsAtCursorN (
+  IN  EFI_SIMPLE_TEXT_OUTPUT_PROTOCOL  *This,
+  IN  CHAR16                           *UnicodeWeight,
+  IN  UINTN                            Count
+  )
+{
+  GRAPHICS_CONSOLE_DEV    *Private;
+  GRAPHICS_CONSOLE_GLYPH  *Glyph;
+  UINTN                   Index;
+  UINTN                   PosY;
+  UINTN                   Delta;
+
+  Private = GRAPHICS_CONSOLE_CON_OUT_DEV_FROM_THIS (This);
+  if ((Private->GraphicsOutput == NULL) || (Private->LineBuffer == NULL) ||
+      ((This->Mode->Attribute & EFI_WIDE_ATTRIBUTE) != 0) ||
+      (Count == 0) || (Count > Private->ModeData[This->Mode->Mode].Columns))
+  {
+    return EFI_NOT_FOUND;
+  }
+
+  //
+  // Compose the characters in the line buffer, then blt them all at once.
+  //
+  Delta = Count * EFI_GLYPH_WIDTH;
+  for (Index = 0; Index < Count; Index++) {
+    Glyph = GetCachedGlyph (This, UnicodeWeight[Index]);
+    if (Glyph == NULL) {
+      return EFI_NOT_FOUND;
+    }
+
+    for (PosY = 0; PosY < EFI_GLYPH_HEIGHT; PosY++) {
+      CopyMem (
+        &Private->LineBuffer[PosY * Delta + Index * EFI_GLYPH_WIDTH],
+        &Glyph->Bitmap[PosY * EFI_GLYPH_WIDTH],
+        EFI_GLYPH_WIDTH * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL)
+        );
+    }
+  }
+
+  return Private->GraphicsOutput->Blt (
+                                    Private->GraphicsOutput,
+                                    Private->LineBuffer,
+                                    EfiBltBufferToVideo,
+                                    0,
+                                    0,
+                                    This->Mode->CursorColumn * EFI_GLYPH_WIDTH + Private->ModeData[This->Mode->Mode].DeltaX,
+                                    This->Mode->CursorRow * EFI_GLYPH_HEIGHT + Private->ModeData[This->Mode->Mode].DeltaY,
+                                    Delta,
+                                    EFI_GLYPH_HEIGHT,
+                                    Delta * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL)
+                                    );
+}
+
 /**
   Draw Unicode string on the Graphics Console device's screen.
 
@@ -1785,6 +1957,14 @@ DrawUnicodeWeightAtCursorN (
   EFI_HII_ROW_INFO       *RowInfoArray;
   UINTN                  RowInfoArraySize;
 
+  //
+  // Narrow characters are drawn from the glyph cache when possible.
+  //
+  Status = DrawCachedGlyphsAtCursorN (This, UnicodeWeight, Count);
+  if (Status != EFI_NOT_FOUND) {
+    return Status;
+  }
+
   Private = GRAPHICS_CONSOLE_CON_OUT_DEV_FROM_THIS (This);
   Blt     = (EFI_IMAGE_OUTPUT *)AllocateZeroPool (sizeof (EFI_IMAGE_OUTPUT));
   if (Blt == NULL) {
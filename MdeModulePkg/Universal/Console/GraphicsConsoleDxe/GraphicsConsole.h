@@ -56,6 +56,18 @@ typedef struct {
   UINT32    GopModeNumber;
 } GRAPHICS_CONSOLE_MODE_DATA;
 
+//
+// The number of rendered narrow glyphs cached for a device.
+//
+#define GRAPHICS_CONSOLE_GLYPH_CACHE_SIZE  256
+
+typedef struct {
+  BOOLEAN                          Valid;
+  UINT8                            Attribute;   // The text attribute the glyph is rendered in.
+  CHAR16                           Char;
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL    Bitmap[EFI_GLYPH_HEIGHT * EFI_GLYPH_WIDTH];
+} GRAPHICS_CONSOLE_GLYPH;
+
 typedef struct {
   UINTN                              Signature;
   EFI_GRAPHICS_OUTPUT_PROTOCOL       *GraphicsOutput;
@@ -64,6 +76,7 @@ typedef struct {
   EFI_SIMPLE_TEXT_OUTPUT_MODE        SimpleTextOutputMode;
   GRAPHICS_CONSOLE_MODE_DATA         *ModeData;
   EFI_GRAPHICS_OUTPUT_BLT_PIXEL      *LineBuffer;
+  GRAPHICS_CONSOLE_GLYPH             *GlyphCache;
 } GRAPHICS_CONSOLE_DEV;
 
 #define GRAPHICS_CONSOLE_CON_OUT_DEV_FROM_THIS(a) \
@@ -518,6 +531,46 @@ GetTextColors (
   OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL    *Background
   );
 
+/**
+  Get the glyph of a narrow character rendered in the current text colors from
+  the glyph cache of the Graphics Console device, rendering it on a cache miss.
+
+  Only characters whose glyph fills exactly one EFI_GLYPH_WIDTH x EFI_GLYPH_HEIGHT
+  cell are cached.
+
+  @param  This                  Protocol instance pointer.
+  @param  Char                  The character.
+
+  @return The cached glyph, or NULL if the character cannot be cached.
+
+**/
+GRAPHICS_CONSOLE_GLYPH *
+GetCachedGlyph (
+  IN  EFI_SIMPLE_TEXT_OUTPUT_PROTOCOL  *This,
+  IN  CHAR16                           Char
+  );
+
+/**
+  Draw narrow Unicode characters on the Graphics Console device's screen with
+  the glyph cache, in the current text colors and with a single Blt() call.
+
+  @param  This                  Protocol instance pointer.
+  @param  UnicodeWeight         One Unicode string to be displayed.
+  @param  Count                 The count of Unicode string.
+
+  @retval EFI_SUCCESS           Drawing Unicode string implemented successfully.
+  @retval EFI_NOT_FOUND         Some of the characters cannot be drawn from the
+                                glyph cache. Nothing is drawn.
+  @retval Others                The Blt() call failed.
+
+**/
+EFI_STATUS
+DrawCachedGlyphsAtCursorN (
+  IN  EFI_SIMPLE_TEXT_OUTPUT_PROTOCOL  *This,
+  IN  CHAR16                           *UnicodeWeight,
+  IN  UINTN                            Count
+  );
+
 /**
   Draw Unicode string on the Graphics Console device's screen.
 
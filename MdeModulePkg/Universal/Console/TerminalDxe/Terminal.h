@@ -63,6 +63,12 @@ typedef struct {
 
 #define KEYBOARD_TIMER_INTERVAL  200000         // 0.02s
 
+//
+// Size of the buffer in which OutputString() collects the bytes for the
+// serial device, so that a string is sent with few SerialIo->Write() calls.
+//
+#define TERMINAL_OUTPUT_BUFFER_SIZE  128
+
 #define TERMINAL_DEV_SIGNATURE  SIGNATURE_32 ('t', 'm', 'n', 'l')
 
 #define TERMINAL_CONSOLE_IN_EX_NOTIFY_SIGNATURE  SIGNATURE_32 ('t', 'm', 'e', 'n')
@@ -426,6 +432,25 @@ TerminalConOutReset (
   IN  BOOLEAN                          ExtendedVerification
   );
 
+/**
+  Send the bytes collected in the output buffer to the serial device.
+
+  @param  TerminalDevice    The terminal device.
+  @param  Buffer            The output buffer.
+  @param  BufferLength      On input, the number of bytes in Buffer.
+                            On output, zero.
+
+  @retval EFI_SUCCESS       The bytes are sent, or there is nothing to send.
+  @retval Others            The serial device fails to send the bytes.
+
+**/
+EFI_STATUS
+TerminalFlushOutputBuffer (
+  IN     TERMINAL_DEV  *TerminalDevice,
+  IN     UINT8         *Buffer,
+  IN OUT UINTN         *BufferLength
+  );
+
 /**
   Implements EFI_SIMPLE_TEXT_OUTPUT_PROTOCOL.OutputString().
   The Unicode string will be converted to terminal expressible data stream
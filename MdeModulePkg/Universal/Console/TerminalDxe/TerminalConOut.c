@@ -84,6 +84,41 @@ CHAR16  mCursorBackwardString[]    = { ESC, '[', '0', '0', 'D', 0 };
 // Body of the ConOut functions
 //
 
+/**
+  Send the bytes collected in the output buffer to the serial device.
+
+  @param  TerminalDevice    The terminal device.
+  @param  Buffer            The output buffer.
+  @param  BufferLength      On input, the number of bytes in Buffer.
+                            On output, zero.
+
+  @retval EFI_SUCCESS       The bytes are sent, or there is nothing to send.
+  @retval Others            The serial device fails to send the bytes.
+
+**/
+EFI_STATUS
+TerminalFlushOutputBuffer (
+  IN     TERMINAL_DEV  *TerminalDevice,
+  IN     UINT8         *Buffer,
+  IN OUT UINTN         *BufferLength
+  )
+{
+  UINTN  Length;
+
+  if (*BufferLength == 0) {
+    return EFI_SUCCESS;
+  }
+
+  Length        = *BufferLength;
+  *BufferLength = 0;
+
+  return TerminalDevice->SerialIo->Write (
+                                     TerminalDevice->SerialIo,
+                                     &Length,
+                                     Buffer
+                                     );
+}
+
 /**
   Implements EFI_SIMPLE_TEXT_OUTPUT_PROTOCOL.Reset().
 
@@ -175,22 +210,23 @@ TerminalConOutOutputString (
   EFI_SIMPLE_TEXT_OUTPUT_MODE  *Mode;
   UINTN                        MaxColumn;
   UINTN                        MaxRow;
-  UINTN                        Length;
   UTF8_CHAR                    Utf8Char;
   CHAR8                        GraphicChar;
   CHAR8                        AsciiChar;
   EFI_STATUS                   Status;
   UINT8                        ValidBytes;
-  CHAR8                        CrLfStr[2];
+  UINT8                        OutputBuffer[TERMINAL_OUTPUT_BUFFER_SIZE];
+  UINTN                        OutputLength;
   //
   //  flag used to indicate whether condition happens which will cause
   //  return EFI_WARN_UNKNOWN_GLYPH
   //
   BOOLEAN  Warning;
 
-  ValidBytes = 0;
-  Warning    = FALSE;
-  AsciiChar  = 0;
+  ValidBytes   = 0;
+  Warning      = FALSE;
+  AsciiChar    = 0;
+  OutputLength = 0;
 
   //
   //  get Terminal device data structure pointer.
@@ -214,6 +250,17 @@ TerminalConOutOutputString (
           );
 
   for ( ; *WString != CHAR_NULL; WString++) {
+    //
+    // Make room for the bytes of one character, which are at most a
+    // 3-byte VT-UTF8 character or a character followed by CR LF.
+    //
+    if (OutputLength > sizeof (OutputBuffer) - 3) {
+      Status = TerminalFlushOutputBuffer (TerminalDevice, OutputBuffer, &OutputLength);
+      if (EFI_ERROR (Status)) {
+        goto OutputError;
+      }
+    }
+
     switch (TerminalDevice->TerminalType) {
       case TerminalTypePcAnsi:
       case TerminalTypeVt100:
@@ -251,32 +298,13 @@ TerminalConOutOutputString (
           GraphicChar = AsciiChar;
         }
 
-        Length = 1;
-
-        Status = TerminalDevice->SerialIo->Write (
-                                             TerminalDevice->SerialIo,
-                                             &Length,
-                                             &GraphicChar
-                                             );
-
-        if (EFI_ERROR (Status)) {
-          goto OutputError;
-        }
-
+        OutputBuffer[OutputLength++] = (UINT8)GraphicChar;
         break;
 
       case TerminalTypeVtUtf8:
         UnicodeToUtf8 (*WString, &Utf8Char, &ValidBytes);
-        Length = ValidBytes;
-        Status = TerminalDevice->SerialIo->Write (
-                                             TerminalDevice->SerialIo,
-                                             &Length,
-                                             (UINT8 *)&Utf8Char
-                                             );
-        if (EFI_ERROR (Status)) {
-          goto OutputError;
-        }
-
+        CopyMem (&OutputBuffer[OutputLength], &Utf8Char, ValidBytes);
+        OutputLength += ValidBytes;
         break;
     }
 
@@ -322,20 +350,8 @@ TerminalConOutOutputString (
             // the driver, but only if we're not in the middle of
             // printing an escape sequence.
             //
-            CrLfStr[0] = '\r';
-            CrLfStr[1] = '\n';
-
-            Length = sizeof (CrLfStr);
-
-            Status = TerminalDevice->SerialIo->Write (
-                                                 TerminalDevice->SerialIo,
-                                                 &Length,
-                                                 CrLfStr
-                                                 );
-
-            if (EFI_ERROR (Status)) {
-              goto OutputError;
-            }
+            OutputBuffer[OutputLength++] = '\r';
+            OutputBuffer[OutputLength++] = '\n';
           }
         }
 
@@ -343,6 +359,11 @@ TerminalConOutOutputString (
     }
   }
 
+  Status = TerminalFlushOutputBuffer (TerminalDevice, OutputBuffer, &OutputLength);
+  if (EFI_ERROR (Status)) {
+    goto OutputError;
+  }
+
   if (Warning) {
     return EFI_WARN_UNKNOWN_GLYPH;
   }
@@ -353,6 +353,28 @@ DiskIoDriverBindingStop (
   return Status;
 }
 
+/**
+  Return the number of bytes the sub task transfers from/to the block device,
+  which covers Offset and Length rounded up to whole blocks.
+
+  @param Subtask      Subtask.
+  @param BlockSize    The block size of the device.
+
+  @return The number of bytes to transfer.
+**/
+UINTN
+DiskIoSubtaskTransferLength (
+  IN DISK_IO_SUBTASK  *Subtask,
+  IN UINT32           BlockSize
+  )
+{
+  if (Subtask->Length == 0) {
+    return 0;
+  }
+
+  return ((Subtask->Offset + Subtask->Length + BlockSize - 1) / BlockSize) * BlockSize;
+}
+
 /**
   Destroy the sub task.
 
@@ -382,9 +404,7 @@ DiskIoDestroySubtask (
     if (Subtask->WorkingBuffer != NULL) {
       FreeAlignedPages (
         Subtask->WorkingBuffer,
-        Subtask->Length < Instance->BlockIo->Media->BlockSize
-        ? EFI_SIZE_TO_PAGES (Instance->BlockIo->Media->BlockSize)
-        : EFI_SIZE_TO_PAGES (Subtask->Length)
+        EFI_SIZE_TO_PAGES (DiskIoSubtaskTransferLength (Subtask, Instance->BlockIo->Media->BlockSize))
         );
     }
 
@@ -552,7 +572,10 @@ DiskIoCreateSubtaskList (
   UINT64           OverRunLba;
   UINT32           UnderRun;
   UINT32           OverRun;
+  UINT64           BlockCount;
+  UINT64           MiddleBlockCount;
   UINT8            *BufferPtr;
+  UINT8            *MiddleBufferPtr;
   UINTN            Length;
   UINTN            DataBufferSize;
   DISK_IO_SUBTASK  *Subtask;
@@ -583,6 +606,47 @@ DiskIoCreateSubtaskList (
     return TRUE;
   }
 
+  //
+  // A read which doesn't start or end on a block boundary goes through a
+  // working buffer for the partial blocks. When the blocks in between can't
+  // be read into Buffer directly either, or there are none, read all the
+  // blocks with one transfer through one working buffer instead of one
+  // transfer for each part.
+  //
+  BlockCount = DivU64x32Remainder (Offset + BufferSize, BlockSize, &OverRun) - Lba;
+  if (OverRun != 0) {
+    BlockCount++;
+  }
+
+  if (!Write && (BlockCount > 1) && ((UnderRun != 0) || (OverRun != 0)) &&
+      (BlockCount <= PcdGet32 (PcdDiskIoDataBufferBlockNum)))
+  {
+    MiddleBlockCount = BlockCount - ((UnderRun != 0) ? 1 : 0) - ((OverRun != 0) ? 1 : 0);
+    MiddleBufferPtr  = BufferPtr + ((UnderRun != 0) ? BlockSize - UnderRun : 0);
+    if ((MiddleBlockCount == 0) || (ALIGN_POINTER (MiddleBufferPtr, IoAlign) != MiddleBufferPtr)) {
+      if (Blocking) {
+        WorkingBuffer = SharedWorkingBuffer;
+      } else {
+        WorkingBuffer = AllocateAlignedPages (EFI_SIZE_TO_PAGES ((UINTN)BlockCount * BlockSize), IoAlign);
+        if (WorkingBuffer == NULL) {
+          goto Done;
+        }
+      }
+
+      Subtask = DiskIoCreateSubtask (FALSE, Lba, UnderRun, BufferSize, WorkingBuffer, BufferPtr, Blocking);
+      if (Subtask == NULL) {
+        if (!Blocking) {
+          FreeAlignedPages (WorkingBuffer, EFI_SIZE_TO_PAGES ((UINTN)BlockCount * BlockSize));
+        }
+
+        goto Done;
+      }
+
+      InsertTailList (Subtasks, &Subtask->Link);
+      return TRUE;
+    }
+  }
+
   if (UnderRun != 0) {
     Length = MIN (BlockSize - UnderRun, BufferSize);
     if (Blocking) {
@@ -906,7 +970,7 @@ DiskIo2ReadWriteDisk (
     Subtask->Task   = Task;
     SubtaskBlocking = Subtask->Blocking;
 
-    ASSERT ((Subtask->Length % Media->BlockSize == 0) || (Subtask->Length < Media->BlockSize));
+    ASSERT ((Subtask->Length % Media->BlockSize == 0) || (Subtask->WorkingBuffer != NULL));
 
     if (Subtask->Write) {
       //
@@ -924,7 +988,7 @@ DiskIo2ReadWriteDisk (
                             BlockIo,
                             MediaId,
                             Subtask->Lba,
-                            (Subtask->Length % Media->BlockSize == 0) ? Subtask->Length : Media->BlockSize,
+                            DiskIoSubtaskTransferLength (Subtask, Media->BlockSize),
                             (Subtask->WorkingBuffer != NULL) ? Subtask->WorkingBuffer : Subtask->Buffer
                             );
       } else {
@@ -933,7 +997,7 @@ DiskIo2ReadWriteDisk (
                              MediaId,
                              Subtask->Lba,
                              &Subtask->BlockIo2Token,
-                             (Subtask->Length % Media->BlockSize == 0) ? Subtask->Length : Media->BlockSize,
+                             DiskIoSubtaskTransferLength (Subtask, Media->BlockSize),
                              (Subtask->WorkingBuffer != NULL) ? Subtask->WorkingBuffer : Subtask->Buffer
                              );
       }
@@ -946,7 +1010,7 @@ DiskIo2ReadWriteDisk (
                             BlockIo,
                             MediaId,
                             Subtask->Lba,
-                            (Subtask->Length % Media->BlockSize == 0) ? Subtask->Length : Media->BlockSize,
+                            DiskIoSubtaskTransferLength (Subtask, Media->BlockSize),
                             (Subtask->WorkingBuffer != NULL) ? Subtask->WorkingBuffer : Subtask->Buffer
                             );
         if (!EFI_ERROR (Status) && (Subtask->WorkingBuffer != NULL)) {
@@ -958,7 +1022,7 @@ DiskIo2ReadWriteDisk (
                              MediaId,
                              Subtask->Lba,
                              &Subtask->BlockIo2Token,
-                             (Subtask->Length % Media->BlockSize == 0) ? Subtask->Length : Media->BlockSize,
+                             DiskIoSubtaskTransferLength (Subtask, Media->BlockSize),
                              (Subtask->WorkingBuffer != NULL) ? Subtask->WorkingBuffer : Subtask->Buffer
                              );
       }
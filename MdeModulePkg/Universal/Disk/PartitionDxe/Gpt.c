@@ -32,6 +32,10 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
   @param[in]  DiskIo      Disk Io protocol.
   @param[in]  Lba         The starting Lba of the Partition Table
   @param[out] PartHeader  Stores the partition table that is read
+  @param[out] PartEntry   If not NULL and the partition table is valid, on
+                          output points to a pool buffer holding the
+                          partition entry array that was checked. The
+                          caller must free it.
 
   @retval TRUE      The partition table is valid
   @retval FALSE     The partition table is not valid
@@ -42,7 +46,8 @@ PartitionValidGptTable (
   IN  EFI_BLOCK_IO_PROTOCOL       *BlockIo,
   IN  EFI_DISK_IO_PROTOCOL        *DiskIo,
   IN  EFI_LBA                     Lba,
-  OUT EFI_PARTITION_TABLE_HEADER  *PartHeader
+  OUT EFI_PARTITION_TABLE_HEADER  *PartHeader,
+  OUT EFI_PARTITION_ENTRY         **PartEntry OPTIONAL
   );
 
 /**
@@ -52,6 +57,9 @@ PartitionValidGptTable (
   @param[in]  BlockIo     Parent BlockIo interface
   @param[in]  DiskIo      Disk Io Protocol.
   @param[in]  PartHeader  Partition table header structure
+  @param[out] PartEntry   If not NULL and the CRC is valid, on output points
+                          to a pool buffer holding the partition entry array
+                          that was read. The caller must free it.
 
   @retval TRUE      the CRC is valid
   @retval FALSE     the CRC is invalid
@@ -61,7 +69,8 @@ BOOLEAN
 PartitionCheckGptEntryArrayCRC (
   IN  EFI_BLOCK_IO_PROTOCOL       *BlockIo,
   IN  EFI_DISK_IO_PROTOCOL        *DiskIo,
-  IN  EFI_PARTITION_TABLE_HEADER  *PartHeader
+  IN  EFI_PARTITION_TABLE_HEADER  *PartHeader,
+  OUT EFI_PARTITION_ENTRY         **PartEntry OPTIONAL
   );
 
 /**
@@ -285,10 +294,10 @@ PartitionInstallGptChildHandles (
   //
   // Check primary and backup partition tables
   //
-  if (!PartitionValidGptTable (BlockIo, DiskIo, PRIMARY_PART_HEADER_LBA, PrimaryHeader)) {
+  if (!PartitionValidGptTable (BlockIo, DiskIo, PRIMARY_PART_HEADER_LBA, PrimaryHeader, &PartEntry)) {
     DEBUG ((DEBUG_INFO, " Not Valid primary partition table\n"));
 
-    if (!PartitionValidGptTable (BlockIo, DiskIo, LastBlock, BackupHeader)) {
+    if (!PartitionValidGptTable (BlockIo, DiskIo, LastBlock, BackupHeader, NULL)) {
       DEBUG ((DEBUG_INFO, " Not Valid backup partition table\n"));
       goto Done;
     } else {
@@ -298,18 +307,18 @@ PartitionInstallGptChildHandles (
         DEBUG ((DEBUG_INFO, " Restore primary partition table error\n"));
       }
 
-      if (PartitionValidGptTable (BlockIo, DiskIo, BackupHeader->AlternateLBA, PrimaryHeader)) {
+      if (PartitionValidGptTable (BlockIo, DiskIo, BackupHeader->AlternateLBA, PrimaryHeader, &PartEntry)) {
         DEBUG ((DEBUG_INFO, " Restore backup partition table success\n"));
       }
     }
-  } else if (!PartitionValidGptTable (BlockIo, DiskIo, PrimaryHeader->AlternateLBA, BackupHeader)) {
+  } else if (!PartitionValidGptTable (BlockIo, DiskIo, PrimaryHeader->AlternateLBA, BackupHeader, NULL)) {
     DEBUG ((DEBUG_INFO, " Valid primary and !Valid backup partition table\n"));
     DEBUG ((DEBUG_INFO, " Restore backup partition table by the primary\n"));
     if (!PartitionRestoreGptTable (BlockIo, DiskIo, PrimaryHeader)) {
       DEBUG ((DEBUG_INFO, " Restore backup partition table error\n"));
     }
 
-    if (PartitionValidGptTable (BlockIo, DiskIo, PrimaryHeader->AlternateLBA, BackupHeader)) {
+    if (PartitionValidGptTable (BlockIo, DiskIo, PrimaryHeader->AlternateLBA, BackupHeader, NULL)) {
       DEBUG ((DEBUG_INFO, " Restore backup partition table success\n"));
     }
   }
@@ -317,28 +326,31 @@ PartitionInstallGptChildHandles (
   DEBUG ((DEBUG_INFO, " Valid primary and Valid backup partition table\n"));
 
   //
-  // Read the EFI Partition Entries
+  // Read the EFI Partition Entries, unless the primary table check above
+  // already returned the entries it verified.
   //
-  PartEntry = AllocatePool (PrimaryHeader->NumberOfPartitionEntries * PrimaryHeader->SizeOfPartitionEntry);
   if (PartEntry == NULL) {
-    DEBUG ((DEBUG_ERROR, "Allocate pool error\n"));
-    goto Done;
-  }
+    PartEntry = AllocatePool (PrimaryHeader->NumberOfPartitionEntries * PrimaryHeader->SizeOfPartitionEntry);
+    if (PartEntry == NULL) {
+      DEBUG ((DEBUG_ERROR, "Allocate pool error\n"));
+      goto Done;
+    }
 
-  Status = DiskIo->ReadDisk (
-                     DiskIo,
-                     MediaId,
-                     MultU64x32 (PrimaryHeader->PartitionEntryLBA, BlockSize),
-                     PrimaryHeader->NumberOfPartitionEntries * (PrimaryHeader->SizeOfPartitionEntry),
-                     PartEntry
-                     );
-  if (EFI_ERROR (Status)) {
-    GptValidStatus = Status;
-    DEBUG ((DEBUG_ERROR, " Partition Entry ReadDisk error\n"));
-    goto Done;
-  }
+    Status = DiskIo->ReadDisk (
+                       DiskIo,
+                       MediaId,
+                       MultU64x32 (PrimaryHeader->PartitionEntryLBA, BlockSize),
+                       PrimaryHeader->NumberOfPartitionEntries * (PrimaryHeader->SizeOfPartitionEntry),
+                       PartEntry
+                       );
+    if (EFI_ERROR (Status)) {
+      GptValidStatus = Status;
+      DEBUG ((DEBUG_ERROR, " Partition Entry ReadDisk error\n"));
+      goto Done;
+    }
 
-  DEBUG ((DEBUG_INFO, " Partition entries read block success\n"));
+    DEBUG ((DEBUG_INFO, " Partition entries read block success\n"));
+  }
 
   DEBUG ((DEBUG_INFO, " Number of partition entries: %d\n", PrimaryHeader->NumberOfPartitionEntries));
 
@@ -458,6 +470,10 @@ Done:
   @param[in]  DiskIo      Disk Io protocol.
   @param[in]  Lba         The starting Lba of the Partition Table
   @param[out] PartHeader  Stores the partition table that is read
+  @param[out] PartEntry   If not NULL and the partition table is valid, on
+                          output points to a pool buffer holding the
+                          partition entry array that was checked. The
+                          caller must free it.
 
   @retval TRUE      The partition table is valid
   @retval FALSE     The partition table is not valid
@@ -468,7 +484,8 @@ PartitionValidGptTable (
   IN  EFI_BLOCK_IO_PROTOCOL       *BlockIo,
   IN  EFI_DISK_IO_PROTOCOL        *DiskIo,
   IN  EFI_LBA                     Lba,
-  OUT EFI_PARTITION_TABLE_HEADER  *PartHeader
+  OUT EFI_PARTITION_TABLE_HEADER  *PartHeader,
+  OUT EFI_PARTITION_ENTRY         **PartEntry OPTIONAL
   )
 {
   EFI_STATUS                  Status;
@@ -520,7 +537,7 @@ PartitionValidGptTable (
   }
 
   CopyMem (PartHeader, PartHdr, sizeof (EFI_PARTITION_TABLE_HEADER));
-  if (!PartitionCheckGptEntryArrayCRC (BlockIo, DiskIo, PartHeader)) {
+  if (!PartitionCheckGptEntryArrayCRC (BlockIo, DiskIo, PartHeader, PartEntry)) {
     FreePool (PartHdr);
     return FALSE;
   }
@@ -537,6 +554,9 @@ PartitionValidGptTable (
   @param[in]  BlockIo     Parent BlockIo interface
   @param[in]  DiskIo      Disk Io Protocol.
   @param[in]  PartHeader  Partition table header structure
+  @param[out] PartEntry   If not NULL and the CRC is valid, on output points
+                          to a pool buffer holding the partition entry array
+                          that was read. The caller must free it.
 
   @retval TRUE      the CRC is valid
   @retval FALSE     the CRC is invalid
@@ -546,7 +566,8 @@ BOOLEAN
 PartitionCheckGptEntryArrayCRC (
   IN  EFI_BLOCK_IO_PROTOCOL       *BlockIo,
   IN  EFI_DISK_IO_PROTOCOL        *DiskIo,
-  IN  EFI_PARTITION_TABLE_HEADER  *PartHeader
+  IN  EFI_PARTITION_TABLE_HEADER  *PartHeader,
+  OUT EFI_PARTITION_ENTRY         **PartEntry OPTIONAL
   )
 {
   EFI_STATUS  Status;
@@ -584,9 +605,21 @@ PartitionCheckGptEntryArrayCRC (
     return FALSE;
   }
 
-  FreePool (Ptr);
+  if (PartHeader->PartitionEntryArrayCRC32 != Crc) {
+    FreePool (Ptr);
+    return FALSE;
+  }
 
-  return (BOOLEAN)(PartHeader->PartitionEntryArrayCRC32 == Crc);
+  //
+  // Hand the verified entries to the caller so they need not be read again.
+  //
+  if (PartEntry != NULL) {
+    *PartEntry = (EFI_PARTITION_ENTRY *)Ptr;
+  } else {
+    FreePool (Ptr);
+  }
+
+  return TRUE;
 }
 
 /**
@@ -1100,6 +1100,10 @@ ReadFile (
   BOOLEAN                 FinishedSeeking;
   UINT32                  ExtentLength;
   UDF_FE_RECORDING_FLAGS  RecordingFlags;
+  UINT64                  DiskOffset;
+  UINT64                  PendingDiskOffset;
+  UINT64                  PendingDataOffset;
+  UINT64                  PendingLength;
 
   LogicalBlockSize = Volume->LogicalVolDesc.LogicalBlockSize;
   DoFreeAed        = FALSE;
@@ -1113,6 +1117,13 @@ ReadFile (
   FinishedSeeking = FALSE;
   Data            = NULL;
 
+  //
+  // Data of the extents to read that is not read from the disk yet.
+  //
+  PendingDiskOffset = 0;
+  PendingDataOffset = 0;
+  PendingLength     = 0;
+
   switch (ReadFileInfo->Flags) {
     case ReadFileGetFileSize:
     case ReadFileAllocateAndRead:
@@ -1339,20 +1350,35 @@ Skip_File_Seek:
             }
 
             //
-            // Read extent's data into FileData.
+            // Read extent's data into FileData. The extents of a file are
+            // usually recorded one after the other, so an extent that starts
+            // on the disk where the previous one ends is read together with
+            // it, with a single request.
             //
-            Status = DiskIo->ReadDisk (
-                               DiskIo,
-                               BlockIo->Media->MediaId,
-                               Offset + MultU64x32 (Lsn, LogicalBlockSize),
-                               (UINTN)DataLength,
-                               (VOID *)((UINT8 *)ReadFileInfo->FileData +
-                                        DataOffset)
-                               );
-            if (EFI_ERROR (Status)) {
-              goto Error_Read_Disk_Blk;
+            DiskOffset = Offset + MultU64x32 (Lsn, LogicalBlockSize);
+            if ((PendingLength != 0) && (DiskOffset != PendingDiskOffset + PendingLength)) {
+              Status = DiskIo->ReadDisk (
+                                 DiskIo,
+                                 BlockIo->Media->MediaId,
+                                 PendingDiskOffset,
+                                 (UINTN)PendingLength,
+                                 (VOID *)((UINT8 *)ReadFileInfo->FileData +
+                                          PendingDataOffset)
+                                 );
+              if (EFI_ERROR (Status)) {
+                goto Error_Read_Disk_Blk;
+              }
+
+              PendingLength = 0;
             }
 
+            if (PendingLength == 0) {
+              PendingDiskOffset = DiskOffset;
+              PendingDataOffset = DataOffset;
+            }
+
+            PendingLength += DataLength;
+
             //
             // Update current file's position.
             //
@@ -1395,6 +1421,20 @@ Skip_Ad:
   }
 
 Done:
+  if ((PendingLength != 0) && !EFI_ERROR (Status)) {
+    //
+    // Read the data of the last extents.
+    //
+    Status = DiskIo->ReadDisk (
+                       DiskIo,
+                       BlockIo->Media->MediaId,
+                       PendingDiskOffset,
+                       (UINTN)PendingLength,
+                       (VOID *)((UINT8 *)ReadFileInfo->FileData +
+                                PendingDataOffset)
+                       );
+  }
+
   if (DoFreeAed) {
     FreePool (Data);
   }
@@ -476,18 +476,21 @@ FtwWrite (
   }
 
   //
-  // Read all original data from target block to memory buffer
-  //
-  Ptr = MyBuffer;
-  for (Index = 0; Index < NumberOfWriteBlocks; Index += 1) {
-    MyLength = BlockSize;
-    Status   = Fvb->Read (Fvb, Lba + Index, 0, &MyLength, Ptr);
-    if (EFI_ERROR (Status)) {
-      FreePool (MyBuffer);
-      return EFI_ABORTED;
-    }
+  // Read all original data from target block to memory buffer,
+  // unless the input buffer overwrites the target blocks entirely
+  //
+  if ((Offset != 0) || (Length != WriteLength)) {
+    Ptr = MyBuffer;
+    for (Index = 0; Index < NumberOfWriteBlocks; Index += 1) {
+      MyLength = BlockSize;
+      Status   = Fvb->Read (Fvb, Lba + Index, 0, &MyLength, Ptr);
+      if (EFI_ERROR (Status)) {
+        FreePool (MyBuffer);
+        return EFI_ABORTED;
+      }
 
-    Ptr += MyLength;
+      Ptr += MyLength;
+    }
   }
 
   //
@@ -499,31 +502,36 @@ FtwWrite (
   //
   // Try to keep the content of spare block
   // Save spare block into a spare backup memory buffer (Sparebuffer)
-  //
-  SpareBufferSize = FtwDevice->SpareAreaLength;
-  SpareBuffer     = AllocatePool (SpareBufferSize);
-  if (SpareBuffer == NULL) {
-    FreePool (MyBuffer);
-    return EFI_OUT_OF_RESOURCES;
-  }
-
-  Ptr = SpareBuffer;
-  for (Index = 0; Index < FtwDevice->NumberOfSpareBlock; Index += 1) {
-    MyLength = FtwDevice->SpareBlockSize;
-    Status   = FtwDevice->FtwBackupFvb->Read (
-                                          FtwDevice->FtwBackupFvb,
-                                          FtwDevice->FtwSpareLba + Index,
-                                          0,
-                                          &MyLength,
-                                          Ptr
-                                          );
-    if (EFI_ERROR (Status)) {
+  // The platform may not need it, in which case it saves a read of the spare
+  // block here and an erase and a write of it at the end.
+  //
+  SpareBuffer = NULL;
+  if (FeaturePcdGet (PcdFtwRestoreSpareArea)) {
+    SpareBufferSize = FtwDevice->SpareAreaLength;
+    SpareBuffer     = AllocatePool (SpareBufferSize);
+    if (SpareBuffer == NULL) {
       FreePool (MyBuffer);
-      FreePool (SpareBuffer);
-      return EFI_ABORTED;
+      return EFI_OUT_OF_RESOURCES;
     }
 
-    Ptr += MyLength;
+    Ptr = SpareBuffer;
+    for (Index = 0; Index < FtwDevice->NumberOfSpareBlock; Index += 1) {
+      MyLength = FtwDevice->SpareBlockSize;
+      Status   = FtwDevice->FtwBackupFvb->Read (
+                                            FtwDevice->FtwBackupFvb,
+                                            FtwDevice->FtwSpareLba + Index,
+                                            0,
+                                            &MyLength,
+                                            Ptr
+                                            );
+      if (EFI_ERROR (Status)) {
+        FreePool (MyBuffer);
+        FreePool (SpareBuffer);
+        return EFI_ABORTED;
+      }
+
+      Ptr += MyLength;
+    }
   }
 
   //
@@ -533,7 +541,10 @@ FtwWrite (
   Status = FtwEraseSpareBlock (FtwDevice);
   if (EFI_ERROR (Status)) {
     FreePool (MyBuffer);
-    FreePool (SpareBuffer);
+    if (SpareBuffer != NULL) {
+      FreePool (SpareBuffer);
+    }
+
     return EFI_ABORTED;
   }
 
@@ -554,7 +565,10 @@ FtwWrite (
                                         );
     if (EFI_ERROR (Status)) {
       FreePool (MyBuffer);
-      FreePool (SpareBuffer);
+      if (SpareBuffer != NULL) {
+        FreePool (SpareBuffer);
+      }
+
       return EFI_ABORTED;
     }
 
@@ -579,7 +593,10 @@ FtwWrite (
                SPARE_COMPLETED
                );
   if (EFI_ERROR (Status)) {
-    FreePool (SpareBuffer);
+    if (SpareBuffer != NULL) {
+      FreePool (SpareBuffer);
+    }
+
     return EFI_ABORTED;
   }
 
@@ -591,10 +608,18 @@ FtwWrite (
   //
   Status = FtwWriteRecord (This, Fvb, BlockSize);
   if (EFI_ERROR (Status)) {
-    FreePool (SpareBuffer);
+    if (SpareBuffer != NULL) {
+      FreePool (SpareBuffer);
+    }
+
     return EFI_ABORTED;
   }
 
+  if (SpareBuffer == NULL) {
+    DEBUG ((DEBUG_INFO, "Ftw: Write() success, (Lba:Offset)=(%lx:0x%x), Length: 0x%x\n", Lba, Offset, Length));
+    return EFI_SUCCESS;
+  }
+
   //
   // Restore spare backup buffer into spare block , if no failure happened during FtwWrite.
   //
@@ -4138,6 +4138,251 @@ GenerateAltConfigResp (
   return EFI_SUCCESS;
 }
 
+/**
+  Free a cached full request string and default value string.
+
+  @param  CacheEntry             The cache entry to free. It must not be in a list.
+
+**/
+VOID
+FreeConfigCacheEntry (
+  IN HII_CONFIG_CACHE_ENTRY  *CacheEntry
+  )
+{
+  if (CacheEntry->Request != NULL) {
+    FreePool (CacheEntry->Request);
+  }
+
+  if (CacheEntry->PlatformLanguage != NULL) {
+    FreePool (CacheEntry->PlatformLanguage);
+  }
+
+  if (CacheEntry->FullRequest != NULL) {
+    FreePool (CacheEntry->FullRequest);
+  }
+
+  if (CacheEntry->DefaultAltCfgResp != NULL) {
+    FreePool (CacheEntry->DefaultAltCfgResp);
+  }
+
+  FreePool (CacheEntry);
+}
+
+/**
+  Free the full request strings and default value strings cached for a
+  package list. It must be called whenever the form packages or the string
+  packages of the package list change.
+
+  @param  DatabaseRecord         The package list.
+
+**/
+VOID
+FreeConfigCache (
+  IN HII_DATABASE_RECORD  *DatabaseRecord
+  )
+{
+  HII_CONFIG_CACHE_ENTRY  *CacheEntry;
+
+  while (!IsListEmpty (&DatabaseRecord->ConfigCacheList)) {
+    CacheEntry = CR (DatabaseRecord->ConfigCacheList.ForwardLink, HII_CONFIG_CACHE_ENTRY, Entry, HII_CONFIG_CACHE_ENTRY_SIGNATURE);
+    RemoveEntryList (&CacheEntry->Entry);
+    FreeConfigCacheEntry (CacheEntry);
+  }
+}
+
+/**
+  Compare two strings that may be NULL.
+
+  @param  FirstString            The first string, may be NULL.
+  @param  SecondString           The second string, may be NULL.
+
+  @retval TRUE                   The strings are both NULL or are the same.
+  @retval FALSE                  The strings are different.
+
+**/
+BOOLEAN
+IsSameConfigCacheString (
+  IN CONST CHAR16  *FirstString   OPTIONAL,
+  IN CONST CHAR16  *SecondString  OPTIONAL
+  )
+{
+  if ((FirstString == NULL) || (SecondString == NULL)) {
+    return (BOOLEAN)(FirstString == SecondString);
+  }
+
+  return (BOOLEAN)(StrCmp (FirstString, SecondString) == 0);
+}
+
+/**
+  Get the full request string and the default value string for a request
+  string from the cache of a package list, instead of parsing the IFR data.
+
+  @param  DataBaseRecord         The package list.
+  @param  PlatformLanguage       The current PlatformLang, may be NULL.
+  @param  Request                The request string as for GetFullStringFromHiiFormPackages().
+  @param  AltCfgResp             The default value string as for GetFullStringFromHiiFormPackages().
+
+  @retval EFI_SUCCESS            The strings are got from the cache.
+  @retval EFI_NOT_FOUND          The request string is not cached.
+  @retval EFI_OUT_OF_RESOURCES   Not enough memory for the return strings.
+
+**/
+EFI_STATUS
+GetConfigFromCache (
+  IN     HII_DATABASE_RECORD  *DataBaseRecord,
+  IN     CHAR8                *PlatformLanguage OPTIONAL,
+  IN OUT EFI_STRING           *Request,
+  IN OUT EFI_STRING           *AltCfgResp
+  )
+{
+  EFI_STATUS              Status;
+  LIST_ENTRY              *Link;
+  HII_CONFIG_CACHE_ENTRY  *CacheEntry;
+  EFI_STRING              FullRequest;
+  EFI_STRING              DefaultAltCfgResp;
+
+  for (Link = DataBaseRecord->ConfigCacheList.ForwardLink; Link != &DataBaseRecord->ConfigCacheList; Link = Link->ForwardLink) {
+    CacheEntry = CR (Link, HII_CONFIG_CACHE_ENTRY, Entry, HII_CONFIG_CACHE_ENTRY_SIGNATURE);
+    if (!IsSameConfigCacheString (CacheEntry->Request, *Request)) {
+      continue;
+    }
+
+    if ((CacheEntry->PlatformLanguage == NULL) || (PlatformLanguage == NULL)) {
+      if (CacheEntry->PlatformLanguage != PlatformLanguage) {
+        continue;
+      }
+    } else if (AsciiStrCmp (CacheEntry->PlatformLanguage, PlatformLanguage) != 0) {
+      continue;
+    }
+
+    FullRequest       = NULL;
+    DefaultAltCfgResp = NULL;
+    if (CacheEntry->FullRequest != NULL) {
+      FullRequest = AllocateCopyPool (StrSize (CacheEntry->FullRequest), CacheEntry->FullRequest);
+      if (FullRequest == NULL) {
+        return EFI_OUT_OF_RESOURCES;
+      }
+    }
+
+    if (CacheEntry->DefaultAltCfgResp != NULL) {
+      DefaultAltCfgResp = AllocateCopyPool (StrSize (CacheEntry->DefaultAltCfgResp), CacheEntry->DefaultAltCfgResp);
+      if (DefaultAltCfgResp == NULL) {
+        if (FullRequest != NULL) {
+          FreePool (FullRequest);
+        }
+
+        return EFI_OUT_OF_RESOURCES;
+      }
+    }
+
+    if (FullRequest != NULL) {
+      if (*Request != NULL) {
+        FreePool (*Request);
+      }
+
+      *Request = FullRequest;
+    }
+
+    Status = EFI_SUCCESS;
+    if ((*AltCfgResp != NULL) && (DefaultAltCfgResp != NULL)) {
+      Status = MergeDefaultString (AltCfgResp, DefaultAltCfgResp);
+      FreePool (DefaultAltCfgResp);
+    } else if (*AltCfgResp == NULL) {
+      *AltCfgResp = DefaultAltCfgResp;
+    }
+
+    //
+    // Keep the most recently used entry first.
+    //
+    RemoveEntryList (&CacheEntry->Entry);
+    InsertHeadList (&DataBaseRecord->ConfigCacheList, &CacheEntry->Entry);
+
+    return Status;
+  }
+
+  return EFI_NOT_FOUND;
+}
+
+/**
+  Cache the full request string and the default value string retrieved from
+  the IFR data of a package list for a request string. Nothing is cached if
+  there is not enough memory.
+
+  @param  DataBaseRecord         The package list.
+  @param  PlatformLanguage       The PlatformLang the strings were retrieved with, may be NULL.
+  @param  Request                The input request string, may be NULL.
+  @param  FullRequest            The full request string, or NULL if it is the input request string.
+  @param  DefaultAltCfgResp      The default value string, may be NULL.
+
+**/
+VOID
+AddConfigToCache (
+  IN HII_DATABASE_RECORD  *DataBaseRecord,
+  IN CHAR8                *PlatformLanguage   OPTIONAL,
+  IN EFI_STRING           Request            OPTIONAL,
+  IN EFI_STRING           FullRequest        OPTIONAL,
+  IN EFI_STRING           DefaultAltCfgResp  OPTIONAL
+  )
+{
+  HII_CONFIG_CACHE_ENTRY  *CacheEntry;
+  LIST_ENTRY              *Link;
+  UINTN                   Count;
+
+  CacheEntry = AllocateZeroPool (sizeof (HII_CONFIG_CACHE_ENTRY));
+  if (CacheEntry == NULL) {
+    return;
+  }
+
+  CacheEntry->Signature = HII_CONFIG_CACHE_ENTRY_SIGNATURE;
+  if (Request != NULL) {
+    CacheEntry->Request = AllocateCopyPool (StrSize (Request), Request);
+    if (CacheEntry->Request == NULL) {
+      FreeConfigCacheEntry (CacheEntry);
+      return;
+    }
+  }
+
+  if (PlatformLanguage != NULL) {
+    CacheEntry->PlatformLanguage = AllocateCopyPool (AsciiStrSize (PlatformLanguage), PlatformLanguage);
+    if (CacheEntry->PlatformLanguage == NULL) {
+      FreeConfigCacheEntry (CacheEntry);
+      return;
+    }
+  }
+
+  if (FullRequest != NULL) {
+    CacheEntry->FullRequest = AllocateCopyPool (StrSize (FullRequest), FullRequest);
+    if (CacheEntry->FullRequest == NULL) {
+      FreeConfigCacheEntry (CacheEntry);
+      return;
+    }
+  }
+
+  if (DefaultAltCfgResp != NULL) {
+    CacheEntry->DefaultAltCfgResp = AllocateCopyPool (StrSize (DefaultAltCfgResp), DefaultAltCfgResp);
+    if (CacheEntry->DefaultAltCfgResp == NULL) {
+      FreeConfigCacheEntry (CacheEntry);
+      return;
+    }
+  }
+
+  InsertHeadList (&DataBaseRecord->ConfigCacheList, &CacheEntry->Entry);
+
+  //
+  // Drop the least recently used entry when the cache is full.
+  //
+  Count = 0;
+  for (Link = DataBaseRecord->ConfigCacheList.ForwardLink; Link != &DataBaseRecord->ConfigCacheList; Link = Link->ForwardLink) {
+    Count++;
+  }
+
+  if (Count > HII_CONFIG_CACHE_MAX_ENTRY_COUNT) {
+    CacheEntry = CR (DataBaseRecord->ConfigCacheList.BackLink, HII_CONFIG_CACHE_ENTRY, Entry, HII_CONFIG_CACHE_ENTRY_SIGNATURE);
+    RemoveEntryList (&CacheEntry->Entry);
+    FreeConfigCacheEntry (CacheEntry);
+  }
+}
+
 /**
   This function gets the full request string and full default value string by
   parsing IFR data in HII form packages.
@@ -4145,6 +4390,9 @@ GenerateAltConfigResp (
   When Request points to NULL string, the request string and default value string
   for each varstore in form package will return.
 
+  The strings are cached for the package list, so that the IFR data is parsed
+  only once for the same request string.
+
   @param  DataBaseRecord         The DataBaseRecord instance contains the found Hii handle and package.
   @param  DevicePath             Device Path which Hii Config Access Protocol is registered.
   @param  Request                Pointer to a null-terminated Unicode string in
@@ -4204,6 +4452,8 @@ GetFullStringFromHiiFormPackages (
   EFI_STRING           ConfigHdr;
   EFI_STRING           StringPtr;
   EFI_STRING           Progress;
+  EFI_STRING           OrgRequest;
+  CHAR8                *PlatformLanguage;
 
   if ((DataBaseRecord == NULL) || (DevicePath == NULL) || (Request == NULL) || (AltCfgResp == NULL)) {
     return EFI_INVALID_PARAMETER;
@@ -4220,6 +4470,26 @@ GetFullStringFromHiiFormPackages (
   HiiFormPackage    = NULL;
   PackageSize       = 0;
   Progress          = *Request;
+  OrgRequest        = NULL;
+  PlatformLanguage  = NULL;
+
+  //
+  // The default value of a string question and the names of a name/value
+  // varstore depend on the current platform language.
+  //
+  GetEfiGlobalVariable2 (L"PlatformLang", (VOID **)&PlatformLanguage, NULL);
+  Status = GetConfigFromCache (DataBaseRecord, PlatformLanguage, Request, AltCfgResp);
+  if (Status != EFI_NOT_FOUND) {
+    goto Done;
+  }
+
+  if (*Request != NULL) {
+    OrgRequest = AllocateCopyPool (StrSize (*Request), *Request);
+    if (OrgRequest == NULL) {
+      Status = EFI_OUT_OF_RESOURCES;
+      goto Done;
+    }
+  }
 
   Status = GetFormPackageData (DataBaseRecord, &HiiFormPackage, &PackageSize);
   if (EFI_ERROR (Status)) {
@@ -4336,6 +4606,7 @@ GetFullStringFromHiiFormPackages (
   // No requested varstore in IFR data and directly return
   //
   if ((VarStorageData->Type == 0) && (VarStorageData->Name == NULL)) {
+    AddConfigToCache (DataBaseRecord, PlatformLanguage, OrgRequest, NULL, NULL);
     Status = EFI_SUCCESS;
     goto Done;
   }
@@ -4350,6 +4621,10 @@ GetFullStringFromHiiFormPackages (
 
   if (RequestBlockArray == NULL) {
     if (!GenerateConfigRequest (ConfigHdr, VarStorageData, &Status, Request)) {
+      if (!EFI_ERROR (Status)) {
+        AddConfigToCache (DataBaseRecord, PlatformLanguage, OrgRequest, NULL, NULL);
+      }
+
       goto Done;
     }
   }
@@ -4364,6 +4639,14 @@ GetFullStringFromHiiFormPackages (
     goto Done;
   }
 
+  AddConfigToCache (
+    DataBaseRecord,
+    PlatformLanguage,
+    OrgRequest,
+    (RequestBlockArray == NULL) ? *Request : NULL,
+    DefaultAltCfgResp
+    );
+
   //
   // 5. Merge string into the input AltCfgResp if the input *AltCfgResp is not NULL.
   //
@@ -4450,6 +4733,14 @@ Done:
     FreePool (HiiFormPackage);
   }
 
+  if (OrgRequest != NULL) {
+    FreePool (OrgRequest);
+  }
+
+  if (PlatformLanguage != NULL) {
+    FreePool (PlatformLanguage);
+  }
+
   if (PointerProgress != NULL) {
     if (*Request == NULL) {
       *PointerProgress = NULL;
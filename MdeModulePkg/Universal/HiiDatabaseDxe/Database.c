@@ -58,6 +58,7 @@ GenerateHiiDatabaseRecord (
   }
 
   DatabaseRecord->Signature = HII_DATABASE_RECORD_SIGNATURE;
+  InitializeListHead (&DatabaseRecord->ConfigCacheList);
 
   DatabaseRecord->PackageList = AllocateZeroPool (sizeof (HII_DATABASE_PACKAGE_LIST_INSTANCE));
   if (DatabaseRecord->PackageList == NULL) {
@@ -1537,6 +1538,7 @@ AdjustStringPackage (
       //
       *BlockPtr = EFI_HII_SIBT_END;
       FreePool (StringPackage->StringBlock);
+      FreeStringBlockIndex (StringPackage);
       StringPackage->StringBlock                  = StringBlock;
       StringPackage->StringPkgHdr->Header.Length += Skip2BlockSize;
       PackageList->PackageListHdr.PackageLength  += Skip2BlockSize;
@@ -1677,6 +1679,7 @@ RemoveStringPackages (
     RemoveEntryList (&Package->StringEntry);
     PackageList->PackageListHdr.PackageLength -= Package->StringPkgHdr->Header.Length;
     FreePool (Package->StringBlock);
+    FreeStringBlockIndex (Package);
     FreePool (Package->StringPkgHdr);
     //
     // Delete font information
@@ -3755,6 +3758,7 @@ HiiRemovePackageList (
 
       HiiHandle->Signature = 0;
       FreePool (HiiHandle);
+      FreeConfigCache (Node);
       FreePool (Node->PackageList);
       FreePool (Node);
 
@@ -3849,6 +3853,7 @@ HiiUpdatePackageList (
     Node = CR (Link, HII_DATABASE_RECORD, DatabaseEntry, HII_DATABASE_RECORD_SIGNATURE);
     if (Node->Handle == Handle) {
       OldPackageList = Node->PackageList;
+      FreeConfigCache (Node);
       //
       // Remove the package if its type matches one of the package types which is
       // contained in the new package list.
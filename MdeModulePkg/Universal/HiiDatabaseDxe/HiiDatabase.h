@@ -150,6 +150,16 @@ typedef struct {
 // String Package definitions
 //
 #define HII_STRING_PACKAGE_SIGNATURE  SIGNATURE_32 ('h','i','s','p')
+
+//
+// Location of the string block which holds a StringId. StartStringId is the
+// first id of the block, or 0 if the block of the StringId is not known yet.
+//
+typedef struct {
+  UINT32           BlockOffset;
+  EFI_STRING_ID    StartStringId;
+} HII_STRING_BLOCK_INDEX;
+
 typedef struct _HII_STRING_PACKAGE_INSTANCE {
   UINTN                         Signature;
   EFI_HII_STRING_PACKAGE_HDR    *StringPkgHdr;
@@ -158,6 +168,8 @@ typedef struct _HII_STRING_PACKAGE_INSTANCE {
   LIST_ENTRY                    FontInfoList;          // local font info list
   UINT8                         FontId;
   EFI_STRING_ID                 MaxStringId;           // record StringId
+  HII_STRING_BLOCK_INDEX        *StringBlockIndex;     // string block of each StringId, filled by FindStringBlock
+  UINTN                         StringBlockIndexCount;
 } HII_STRING_PACKAGE_INSTANCE;
 
 //
@@ -286,8 +298,30 @@ typedef struct _HII_DATABASE_RECORD {
   EFI_HANDLE                            DriverHandle;
   EFI_HII_HANDLE                        Handle;
   LIST_ENTRY                            DatabaseEntry;
+  LIST_ENTRY                            ConfigCacheList;
 } HII_DATABASE_RECORD;
 
+#define HII_CONFIG_CACHE_ENTRY_SIGNATURE  SIGNATURE_32 ('h','i','c','c')
+
+//
+// The maximum number of requests whose full request and default value strings
+// are cached for a package list.
+//
+#define HII_CONFIG_CACHE_MAX_ENTRY_COUNT  8
+
+//
+// The full request string and the default value string retrieved from the IFR
+// data of a package list for a request string.
+//
+typedef struct {
+  UINTN         Signature;
+  LIST_ENTRY    Entry;
+  EFI_STRING    Request;                        // The input request string, may be NULL.
+  CHAR8         *PlatformLanguage;              // The PlatformLang used to look up strings, may be NULL.
+  EFI_STRING    FullRequest;                    // NULL when the request string is not changed.
+  EFI_STRING    DefaultAltCfgResp;              // May be NULL.
+} HII_CONFIG_CACHE_ENTRY;
+
 #define HII_DATABASE_NOTIFY_SIGNATURE  SIGNATURE_32 ('h','i','d','n')
 
 typedef struct _HII_DATABASE_NOTIFY {
@@ -535,6 +569,18 @@ FindStringBlock (
   OUT EFI_STRING_ID                *StartStringId OPTIONAL
   );
 
+/**
+  Free the index of the string blocks of a string package. It must be called
+  whenever the string blocks of the package are replaced.
+
+  @param  StringPackage           Hii string package instance.
+
+**/
+VOID
+FreeStringBlockIndex (
+  IN HII_STRING_PACKAGE_INSTANCE  *StringPackage
+  );
+
 /**
   Parse all glyph blocks to find a glyph block specified by CharValue.
   If CharValue = (CHAR16) (-1), collect all default character cell information
@@ -2308,6 +2354,19 @@ HiiGetConfigRespInfo (
   IN CONST EFI_HII_DATABASE_PROTOCOL  *This
   );
 
+/**
+  Free the full request strings and default value strings cached for a
+  package list. It must be called whenever the form packages or the string
+  packages of the package list change.
+
+  @param  DatabaseRecord         The package list.
+
+**/
+VOID
+FreeConfigCache (
+  IN HII_DATABASE_RECORD  *DatabaseRecord
+  );
+
 /**
   Find question default value from PcdNvStoreDefaultValueBuffer
 
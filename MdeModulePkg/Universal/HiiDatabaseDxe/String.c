@@ -283,6 +283,8 @@ FindStringBlock (
   UINT32                   Length32;
   UINTN                    StringSize;
   CHAR16                   Zero;
+  UINTN                    BlockOffset;
+  EFI_STRING_ID            BlockStartId;
 
   ASSERT (StringPackage != NULL);
   ASSERT (StringPackage->Signature == HII_STRING_PACKAGE_SIGNATURE);
@@ -311,7 +313,31 @@ FindStringBlock (
   BlockHdr  = StringPackage->StringBlock;
   BlockSize = 0;
   Offset    = 0;
+
+  //
+  // Start from the block of StringId if an earlier parse has recorded it.
+  //
+  if ((StringId != (EFI_STRING_ID)(-1)) && (StringId != 0)) {
+    if (StringPackage->StringBlockIndex == NULL) {
+      StringPackage->StringBlockIndex = AllocateZeroPool ((StringPackage->MaxStringId + 1) * sizeof (HII_STRING_BLOCK_INDEX));
+      if (StringPackage->StringBlockIndex != NULL) {
+        StringPackage->StringBlockIndexCount = StringPackage->MaxStringId + 1;
+      }
+    }
+
+    if ((StringId < StringPackage->StringBlockIndexCount) && (StringPackage->StringBlockIndex[StringId].StartStringId != 0)) {
+      BlockSize       = StringPackage->StringBlockIndex[StringId].BlockOffset;
+      CurrentStringId = StringPackage->StringBlockIndex[StringId].StartStringId;
+      BlockHdr        = StringPackage->StringBlock + BlockSize;
+      if (StartStringId != NULL) {
+        *StartStringId = CurrentStringId;
+      }
+    }
+  }
+
   while (*BlockHdr != EFI_HII_SIBT_END) {
+    BlockOffset  = BlockSize;
+    BlockStartId = CurrentStringId;
     switch (*BlockHdr) {
       case EFI_HII_SIBT_STRING_SCSU:
         Offset        = sizeof (EFI_HII_STRING_BLOCK);
@@ -550,6 +576,16 @@ FindStringBlock (
         break;
     }
 
+    //
+    // Record the block of the string ids it holds for the later parses.
+    //
+    if (StringPackage->StringBlockIndex != NULL) {
+      for (Index = BlockStartId; (Index < CurrentStringId) && (Index < StringPackage->StringBlockIndexCount); Index++) {
+        StringPackage->StringBlockIndex[Index].BlockOffset   = (UINT32)BlockOffset;
+        StringPackage->StringBlockIndex[Index].StartStringId = BlockStartId;
+      }
+    }
+
     if ((StringId > 0) && (StringId != (EFI_STRING_ID)(-1))) {
       ASSERT (BlockType != NULL && StringBlockAddr != NULL && StringTextOffset != NULL);
       *BlockType        = *BlockHdr;
@@ -589,6 +625,25 @@ FindStringBlock (
   return EFI_NOT_FOUND;
 }
 
+/**
+  Free the index of the string blocks of a string package. It must be called
+  whenever the string blocks of the package are replaced.
+
+  @param  StringPackage           Hii string package instance.
+
+**/
+VOID
+FreeStringBlockIndex (
+  IN HII_STRING_PACKAGE_INSTANCE  *StringPackage
+  )
+{
+  if (StringPackage->StringBlockIndex != NULL) {
+    FreePool (StringPackage->StringBlockIndex);
+    StringPackage->StringBlockIndex      = NULL;
+    StringPackage->StringBlockIndexCount = 0;
+  }
+}
+
 /**
   Parse all string blocks to get a string specified by StringId.
 
@@ -854,6 +909,7 @@ InsertLackStringBlock (
   }
 
   FreePool (StringPackage->StringBlock);
+  FreeStringBlockIndex (StringPackage);
   StringPackage->StringBlock                  = StringBlock;
   StringPackage->StringPkgHdr->Header.Length += NewBlockSize - OldBlockSize;
 
@@ -1025,6 +1081,7 @@ SetStringWorker (
 
       ZeroMem (StringPackage->StringBlock, OldBlockSize);
       FreePool (StringPackage->StringBlock);
+      FreeStringBlockIndex (StringPackage);
       StringPackage->StringBlock                  = Block;
       StringPackage->StringPkgHdr->Header.Length += (UINT32)(BlockSize - OldBlockSize);
       break;
@@ -1059,6 +1116,7 @@ SetStringWorker (
 
       ZeroMem (StringPackage->StringBlock, OldBlockSize);
       FreePool (StringPackage->StringBlock);
+      FreeStringBlockIndex (StringPackage);
       StringPackage->StringBlock                  = Block;
       StringPackage->StringPkgHdr->Header.Length += (UINT32)(BlockSize - OldBlockSize);
       break;
@@ -1111,6 +1169,7 @@ SetStringWorker (
 
   ZeroMem (StringPackage->StringBlock, OldBlockSize);
   FreePool (StringPackage->StringBlock);
+  FreeStringBlockIndex (StringPackage);
   StringPackage->StringBlock                  = Block;
   StringPackage->StringPkgHdr->Header.Length += Ext2.Length;
 
@@ -1224,6 +1283,8 @@ HiiNewString (
 
   EfiAcquireLock (&mHiiDatabaseLock);
 
+  FreeConfigCache (DatabaseRecord);
+
   Status                  = EFI_SUCCESS;
   NewStringPackageCreated = FALSE;
   NewStringId             = 0;
@@ -1299,6 +1360,7 @@ HiiNewString (
       *BlockPtr = EFI_HII_SIBT_END;
       ZeroMem (StringPackage->StringBlock, OldBlockSize);
       FreePool (StringPackage->StringBlock);
+      FreeStringBlockIndex (StringPackage);
       StringPackage->StringBlock                     = StringBlock;
       StringPackage->StringPkgHdr->Header.Length    += Ucs2BlockSize;
       PackageListNode->PackageListHdr.PackageLength += Ucs2BlockSize;
@@ -1435,6 +1497,7 @@ HiiNewString (
     *BlockPtr = EFI_HII_SIBT_END;
     ZeroMem (StringPackage->StringBlock, OldBlockSize);
     FreePool (StringPackage->StringBlock);
+    FreeStringBlockIndex (StringPackage);
     StringPackage->StringBlock                     = StringBlock;
     StringPackage->StringPkgHdr->Header.Length    += Ucs2BlockSize;
     PackageListNode->PackageListHdr.PackageLength += Ucs2BlockSize;
@@ -1478,6 +1541,7 @@ HiiNewString (
       *BlockPtr = EFI_HII_SIBT_END;
       ZeroMem (StringPackage->StringBlock, OldBlockSize);
       FreePool (StringPackage->StringBlock);
+      FreeStringBlockIndex (StringPackage);
       StringPackage->StringBlock                     = StringBlock;
       StringPackage->StringPkgHdr->Header.Length    += Ucs2FontBlockSize;
       PackageListNode->PackageListHdr.PackageLength += Ucs2FontBlockSize;
@@ -1540,6 +1604,7 @@ HiiNewString (
       *BlockPtr = EFI_HII_SIBT_END;
       ZeroMem (StringPackage->StringBlock, OldBlockSize);
       FreePool (StringPackage->StringBlock);
+      FreeStringBlockIndex (StringPackage);
       StringPackage->StringBlock                     = StringBlock;
       StringPackage->StringPkgHdr->Header.Length    += FontBlockSize + Ucs2FontBlockSize;
       PackageListNode->PackageListHdr.PackageLength += FontBlockSize + Ucs2FontBlockSize;
@@ -1584,6 +1649,7 @@ Done:
     //
     RemoveEntryList (&StringPackage->StringEntry);
     FreePool (StringPackage->StringBlock);
+    FreeStringBlockIndex (StringPackage);
     FreePool (StringPackage->StringPkgHdr);
     FreePool (StringPackage);
   }
@@ -1777,6 +1843,7 @@ HiiSetString (
     DatabaseRecord = CR (Link, HII_DATABASE_RECORD, DatabaseEntry, HII_DATABASE_RECORD_SIGNATURE);
     if (DatabaseRecord->Handle == PackageList) {
       PackageListNode = (HII_DATABASE_PACKAGE_LIST_INSTANCE *)(DatabaseRecord->PackageList);
+      FreeConfigCache (DatabaseRecord);
     }
   }
 
@@ -315,6 +315,127 @@ ConstructNonTestedMemoryRange (
   return EFI_SUCCESS;
 }
 
+/**
+  Write the memory test pattern into, or verify the memory test pattern in,
+  the slices of a memory range until no slice is left.
+
+  This function runs on all enabled processors at the same time, so it must
+  not call any UEFI service.
+
+  @param[in, out] Buffer  The memory test job.
+
+**/
+VOID
+EFIAPI
+MemoryTestSliceProcedure (
+  IN OUT VOID  *Buffer
+  )
+{
+  MEMORY_TEST_JOB       *Job;
+  UINT32                Slice;
+  EFI_PHYSICAL_ADDRESS  Address;
+  EFI_PHYSICAL_ADDRESS  End;
+
+  Job = (MEMORY_TEST_JOB *)Buffer;
+
+  while (Job->ErrorAddress == MAX_UINT64) {
+    Slice = InterlockedIncrement (&Job->NextSlice) - 1;
+    if (Slice >= Job->SliceCount) {
+      break;
+    }
+
+    Address = Job->Start + MultU64x32 (TEST_BLOCK_SIZE, Slice);
+    End     = MIN (Address + TEST_BLOCK_SIZE, Job->Start + Job->Size);
+
+    while (Address < End) {
+      if (!Job->Verify) {
+        CopyMem ((VOID *)(UINTN)Address, Job->Private->MonoPattern, Job->Private->MonoTestSize);
+      } else if (CompareMemWithoutCheckArgument (
+                   (VOID *)(UINTN)Address,
+                   Job->Private->MonoPattern,
+                   Job->Private->MonoTestSize
+                   ) != 0)
+      {
+        InterlockedCompareExchange64 (&Job->ErrorAddress, MAX_UINT64, Address);
+        break;
+      }
+
+      Address += Job->Private->CoverageSpan;
+    }
+  }
+}
+
+/**
+  Write the memory test pattern into, or verify the memory test pattern in,
+  a range of physical memory.
+
+  The range is split into slices, which all enabled processors test at the
+  same time when the MP services are available.
+
+  @param[in]  Private       Point to generic memory test driver's private data.
+  @param[in]  Start         The memory range's start address.
+  @param[in]  Size          The memory range's size.
+  @param[in]  Verify        TRUE to verify the memory test pattern, FALSE to write it.
+
+  @return The address of a miscompare, or MAX_UINT64 if no miscompare is found.
+
+**/
+UINT64
+RunMemoryTestJob (
+  IN  GENERIC_MEMORY_TEST_PRIVATE  *Private,
+  IN  EFI_PHYSICAL_ADDRESS         Start,
+  IN  UINT64                       Size,
+  IN  BOOLEAN                      Verify
+  )
+{
+  EFI_STATUS       Status;
+  MEMORY_TEST_JOB  Job;
+  EFI_EVENT        Event;
+
+  Job.Private      = Private;
+  Job.Start        = Start;
+  Job.Size         = Size;
+  Job.Verify       = Verify;
+  Job.SliceCount   = (UINT32)DivU64x32 (Size + TEST_BLOCK_SIZE - 1, TEST_BLOCK_SIZE);
+  Job.NextSlice    = 0;
+  Job.ErrorAddress = MAX_UINT64;
+
+  //
+  // Let the APs take slices while the BSP takes slices as well.
+  //
+  Event = NULL;
+  if ((Private->MpServices != NULL) && (Job.SliceCount > 1)) {
+    Status = gBS->CreateEvent (0, TPL_CALLBACK, NULL, NULL, &Event);
+    if (!EFI_ERROR (Status)) {
+      Status = Private->MpServices->StartupAllAPs (
+                                      Private->MpServices,
+                                      MemoryTestSliceProcedure,
+                                      FALSE,
+                                      Event,
+                                      0,
+                                      &Job,
+                                      NULL
+                                      );
+      if (EFI_ERROR (Status)) {
+        gBS->CloseEvent (Event);
+        Event = NULL;
+      }
+    }
+  }
+
+  MemoryTestSliceProcedure (&Job);
+
+  if (Event != NULL) {
+    while (gBS->CheckEvent (Event) == EFI_NOT_READY) {
+      CpuPause ();
+    }
+
+    gBS->CloseEvent (Event);
+  }
+
+  return Job.ErrorAddress;
+}
+
 /**
   Write the memory test pattern into a range of physical memory.
 
@@ -333,10 +454,6 @@ WriteMemory (
   IN  UINT64                       Size
   )
 {
-  EFI_PHYSICAL_ADDRESS  Address;
-
-  Address = Start;
-
   //
   // Add 4G memory address check for IA32 platform
   // NOTE: Without page table, there is no way to use memory above 4G.
@@ -345,10 +462,7 @@ WriteMemory (
     return EFI_SUCCESS;
   }
 
-  while (Address < (Start + Size)) {
-    CopyMem ((VOID *)(UINTN)Address, Private->MonoPattern, Private->MonoTestSize);
-    Address += Private->CoverageSpan;
-  }
+  RunMemoryTestJob (Private, Start, Size, FALSE);
 
   //
   // bug bug: we may need GCD service to make the code cache and data uncache,
@@ -383,10 +497,8 @@ VerifyMemory (
   )
 {
   EFI_PHYSICAL_ADDRESS            Address;
-  INTN                            ErrorFound;
   EFI_MEMORY_EXTENDED_ERROR_DATA  *ExtendedErrorData;
 
-  Address           = Start;
   ExtendedErrorData = NULL;
 
   //
@@ -402,43 +514,35 @@ VerifyMemory (
   // error here. If there is miscompare error here then check if generic
   // memory test driver can disable the bad DIMM.
   //
-  while (Address < (Start + Size)) {
-    ErrorFound = CompareMemWithoutCheckArgument (
-                   (VOID *)(UINTN)(Address),
-                   Private->MonoPattern,
-                   Private->MonoTestSize
-                   );
-    if (ErrorFound != 0) {
-      //
-      // Report uncorrectable errors
-      //
-      ExtendedErrorData = AllocateZeroPool (sizeof (EFI_MEMORY_EXTENDED_ERROR_DATA));
-      if (ExtendedErrorData == NULL) {
-        return EFI_OUT_OF_RESOURCES;
-      }
-
-      ExtendedErrorData->DataHeader.HeaderSize = (UINT16)sizeof (EFI_STATUS_CODE_DATA);
-      ExtendedErrorData->DataHeader.Size       = (UINT16)(sizeof (EFI_MEMORY_EXTENDED_ERROR_DATA) - sizeof (EFI_STATUS_CODE_DATA));
-      ExtendedErrorData->Granularity           = EFI_MEMORY_ERROR_DEVICE;
-      ExtendedErrorData->Operation             = EFI_MEMORY_OPERATION_READ;
-      ExtendedErrorData->Syndrome              = 0x0;
-      ExtendedErrorData->Address               = Address;
-      ExtendedErrorData->Resolution            = 0x40;
-
-      REPORT_STATUS_CODE_EX (
-        EFI_ERROR_CODE,
-        EFI_COMPUTING_UNIT_MEMORY | EFI_CU_MEMORY_EC_UNCORRECTABLE,
-        0,
-        &gEfiGenericMemTestProtocolGuid,
-        NULL,
-        (UINT8 *)ExtendedErrorData + sizeof (EFI_STATUS_CODE_DATA),
-        ExtendedErrorData->DataHeader.Size
-        );
-
-      return EFI_DEVICE_ERROR;
+  Address = RunMemoryTestJob (Private, Start, Size, TRUE);
+  if (Address != MAX_UINT64) {
+    //
+    // Report uncorrectable errors
+    //
+    ExtendedErrorData = AllocateZeroPool (sizeof (EFI_MEMORY_EXTENDED_ERROR_DATA));
+    if (ExtendedErrorData == NULL) {
+      return EFI_OUT_OF_RESOURCES;
     }
 
-    Address += Private->CoverageSpan;
+    ExtendedErrorData->DataHeader.HeaderSize = (UINT16)sizeof (EFI_STATUS_CODE_DATA);
+    ExtendedErrorData->DataHeader.Size       = (UINT16)(sizeof (EFI_MEMORY_EXTENDED_ERROR_DATA) - sizeof (EFI_STATUS_CODE_DATA));
+    ExtendedErrorData->Granularity           = EFI_MEMORY_ERROR_DEVICE;
+    ExtendedErrorData->Operation             = EFI_MEMORY_OPERATION_READ;
+    ExtendedErrorData->Syndrome              = 0x0;
+    ExtendedErrorData->Address               = Address;
+    ExtendedErrorData->Resolution            = 0x40;
+
+    REPORT_STATUS_CODE_EX (
+      EFI_ERROR_CODE,
+      EFI_COMPUTING_UNIT_MEMORY | EFI_CU_MEMORY_EC_UNCORRECTABLE,
+      0,
+      &gEfiGenericMemTestProtocolGuid,
+      NULL,
+      (UINT8 *)ExtendedErrorData + sizeof (EFI_STATUS_CODE_DATA),
+      ExtendedErrorData->DataHeader.Size
+      );
+
+    return EFI_DEVICE_ERROR;
   }
 
   return EFI_SUCCESS;
@@ -466,6 +570,8 @@ InitializeMemoryTest (
   EFI_STATUS                   Status;
   GENERIC_MEMORY_TEST_PRIVATE  *Private;
   EFI_CPU_ARCH_PROTOCOL        *Cpu;
+  EFI_MP_SERVICES_PROTOCOL     *MpServices;
+  UINTN                        NumberOfProcessors;
 
   Private             = GENERIC_MEMORY_TEST_PRIVATE_FROM_THIS (This);
   *RequireSoftECCInit = FALSE;
@@ -501,6 +607,33 @@ InitializeMemoryTest (
     Private->Cpu = Cpu;
   }
 
+  //
+  // Get the MP services protocol to run the memory test on all processors,
+  // each of which tests one TEST_BLOCK_SIZE slice of a BDS block at a time.
+  //
+  Private->MpServices         = NULL;
+  Private->NumberOfProcessors = 1;
+  if (PcdGetBool (PcdMemoryTestOnAllProcessors)) {
+    Status = gBS->LocateProtocol (
+                    &gEfiMpServiceProtocolGuid,
+                    NULL,
+                    (VOID **)&MpServices
+                    );
+    if (!EFI_ERROR (Status)) {
+      Status = MpServices->GetNumberOfProcessors (
+                             MpServices,
+                             &NumberOfProcessors,
+                             &Private->NumberOfProcessors
+                             );
+      if (!EFI_ERROR (Status) && (Private->NumberOfProcessors > 1)) {
+        Private->MpServices   = MpServices;
+        Private->BdsBlockSize = MultU64x32 (TEST_BLOCK_SIZE, (UINT32)Private->NumberOfProcessors);
+      } else {
+        Private->NumberOfProcessors = 1;
+      }
+    }
+  }
+
   //
   // Create the CoverageSpan of the memory test base on the coverage level
   //
@@ -868,7 +1001,9 @@ GENERIC_MEMORY_TEST_PRIVATE  mGenericMemoryTestPrivate = {
   {
     NULL,
     NULL
-  }
+  },
+  NULL,
+  0
 };
 
 /**
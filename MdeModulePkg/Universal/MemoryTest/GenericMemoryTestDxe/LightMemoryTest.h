@@ -13,6 +13,7 @@
 #include <Guid/StatusCodeDataTypeId.h>
 #include <Protocol/GenericMemoryTest.h>
 #include <Protocol/Cpu.h>
+#include <Protocol/MpService.h>
 
 #include <Library/DebugLib.h>
 #include <Library/UefiDriverEntryPoint.h>
@@ -23,6 +24,8 @@
 #include <Library/BaseMemoryLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/UefiBootServicesTableLib.h>
+#include <Library/PcdLib.h>
+#include <Library/SynchronizationLib.h>
 
 //
 // Some global define
@@ -108,8 +111,28 @@ typedef struct {
   // memory range list
   //
   LIST_ENTRY                          NonTestedMemRanList;
+
+  //
+  // MP services protocol's pointer, NULL if the memory test runs on the BSP only
+  //
+  EFI_MP_SERVICES_PROTOCOL            *MpServices;
+  UINTN                               NumberOfProcessors;
 } GENERIC_MEMORY_TEST_PRIVATE;
 
+//
+// The memory test of one range, split into TEST_BLOCK_SIZE slices that
+// the enabled processors take one at a time.
+//
+typedef struct {
+  GENERIC_MEMORY_TEST_PRIVATE    *Private;
+  EFI_PHYSICAL_ADDRESS           Start;
+  UINT64                         Size;
+  BOOLEAN                        Verify;
+  UINT32                         SliceCount;
+  volatile UINT32                NextSlice;
+  volatile UINT64                ErrorAddress;
+} MEMORY_TEST_JOB;
+
 #define GENERIC_MEMORY_TEST_PRIVATE_FROM_THIS(a) \
   CR ( \
   a, \
@@ -756,7 +756,8 @@ LocateExPcdBinary (
   // Check the first bytes (Header Signature Guid) and build version.
   //
   if (!CompareGuid ((VOID *)mDxePcdDbBinary, &gPcdDataBaseSignatureGuid) ||
-      (mDxePcdDbBinary->BuildVersion != PCD_SERVICE_DXE_VERSION))
+      (mDxePcdDbBinary->BuildVersion < PCD_SERVICE_DXE_VERSION_MIN) ||
+      (mDxePcdDbBinary->BuildVersion > PCD_SERVICE_DXE_VERSION))
   {
     ASSERT (FALSE);
   }
@@ -1568,6 +1569,66 @@ SetHiiVariable (
   return Status;
 }
 
+/**
+  Search the dynamic-ex mapping table of a PCD database for a dynamic-ex PCD.
+
+  From PCD_DATABASE_SORTED_EX_MAP_VERSION on, the build tool sorts the mapping
+  table by token space guid index and then by dynamic-ex token number, so it
+  is binary searched. The table of an older database is searched linearly.
+
+  @param Database        The PCD database.
+  @param GuidIndex       Index of the token space guid in the guid table of the database.
+  @param ExTokenNumber   Dynamic-ex PCD token number.
+
+  @return Token Number for dynamic-ex PCD, or PCD_INVALID_TOKEN_NUMBER if the
+          PCD is not in the database.
+
+**/
+UINTN
+SearchExMapTable (
+  IN PCD_DATABASE_INIT  *Database,
+  IN UINTN              GuidIndex,
+  IN UINTN              ExTokenNumber
+  )
+{
+  DYNAMICEX_MAPPING  *ExMap;
+  UINTN              Index;
+  UINTN              Low;
+  UINTN              High;
+  UINTN              Middle;
+
+  ExMap = (DYNAMICEX_MAPPING *)((UINT8 *)Database + Database->ExMapTableOffset);
+
+  if (Database->BuildVersion < PCD_DATABASE_SORTED_EX_MAP_VERSION) {
+    for (Index = 0; Index < Database->ExTokenCount; Index++) {
+      if ((ExTokenNumber == ExMap[Index].ExTokenNumber) &&
+          (GuidIndex == ExMap[Index].ExGuidIndex))
+      {
+        return ExMap[Index].TokenNumber;
+      }
+    }
+
+    return PCD_INVALID_TOKEN_NUMBER;
+  }
+
+  Low  = 0;
+  High = Database->ExTokenCount;
+  while (Low < High) {
+    Middle = Low + (High - Low) / 2;
+    if ((ExMap[Middle].ExGuidIndex < GuidIndex) ||
+        ((ExMap[Middle].ExGuidIndex == GuidIndex) && (ExMap[Middle].ExTokenNumber < ExTokenNumber)))
+    {
+      Low = Middle + 1;
+    } else if ((ExMap[Middle].ExGuidIndex == GuidIndex) && (ExMap[Middle].ExTokenNumber == ExTokenNumber)) {
+      return ExMap[Middle].TokenNumber;
+    } else {
+      High = Middle;
+    }
+  }
+
+  return PCD_INVALID_TOKEN_NUMBER;
+}
+
 /**
   Get Token Number according to dynamic-ex PCD's {token space guid:token number}
 
@@ -1587,14 +1648,12 @@ GetExPcdTokenNumber (
   IN UINT32          ExTokenNumber
   )
 {
-  UINT32             Index;
-  DYNAMICEX_MAPPING  *ExMap;
-  EFI_GUID           *GuidTable;
-  EFI_GUID           *MatchGuid;
-  UINTN              MatchGuidIdx;
+  EFI_GUID  *GuidTable;
+  EFI_GUID  *MatchGuid;
+  UINTN     MatchGuidIdx;
+  UINTN     TokenNumber;
 
   if (!mPeiDatabaseEmpty) {
-    ExMap     = (DYNAMICEX_MAPPING *)((UINT8 *)mPcdDatabase.PeiDb + mPcdDatabase.PeiDb->ExMapTableOffset);
     GuidTable = (EFI_GUID *)((UINT8 *)mPcdDatabase.PeiDb + mPcdDatabase.PeiDb->GuidTableOffset);
 
     MatchGuid = ScanGuid (GuidTable, mPeiGuidTableSize, Guid);
@@ -1602,17 +1661,13 @@ GetExPcdTokenNumber (
     if (MatchGuid != NULL) {
       MatchGuidIdx = MatchGuid - GuidTable;
 
-      for (Index = 0; Index < mPcdDatabase.PeiDb->ExTokenCount; Index++) {
-        if ((ExTokenNumber == ExMap[Index].ExTokenNumber) &&
-            (MatchGuidIdx == ExMap[Index].ExGuidIndex))
-        {
-          return ExMap[Index].TokenNumber;
-        }
+      TokenNumber = SearchExMapTable (mPcdDatabase.PeiDb, MatchGuidIdx, ExTokenNumber);
+      if (TokenNumber != PCD_INVALID_TOKEN_NUMBER) {
+        return TokenNumber;
       }
     }
   }
 
-  ExMap     = (DYNAMICEX_MAPPING *)((UINT8 *)mPcdDatabase.DxeDb + mPcdDatabase.DxeDb->ExMapTableOffset);
   GuidTable = (EFI_GUID *)((UINT8 *)mPcdDatabase.DxeDb + mPcdDatabase.DxeDb->GuidTableOffset);
 
   MatchGuid = ScanGuid (GuidTable, mDxeGuidTableSize, Guid);
@@ -1624,12 +1679,9 @@ GetExPcdTokenNumber (
 
   MatchGuidIdx = MatchGuid - GuidTable;
 
-  for (Index = 0; Index < mPcdDatabase.DxeDb->ExTokenCount; Index++) {
-    if ((ExTokenNumber == ExMap[Index].ExTokenNumber) &&
-        (MatchGuidIdx == ExMap[Index].ExGuidIndex))
-    {
-      return ExMap[Index].TokenNumber;
-    }
+  TokenNumber = SearchExMapTable (mPcdDatabase.DxeDb, MatchGuidIdx, ExTokenNumber);
+  if (TokenNumber != PCD_INVALID_TOKEN_NUMBER) {
+    return TokenNumber;
   }
 
   DEBUG ((DEBUG_ERROR, "%a: Failed to find PCD with GUID: %g and token number: %d\n", __func__, Guid, ExTokenNumber));
@@ -33,12 +33,18 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 // Please make sure the PCD Serivce DXE Version is consistent with
 // the version of the generated DXE PCD Database by build tool.
 //
-#define PCD_SERVICE_DXE_VERSION  7
+#define PCD_SERVICE_DXE_VERSION  8
+
+//
+// The oldest version of the generated DXE PCD Database that is still supported.
+// Its dynamic-ex mapping table is not sorted, and is searched linearly.
+//
+#define PCD_SERVICE_DXE_VERSION_MIN  7
 
 //
 // PCD_DXE_SERVICE_DRIVER_VERSION is defined in Autogen.h.
 //
-#if (PCD_SERVICE_DXE_VERSION != PCD_DXE_SERVICE_DRIVER_VERSION)
+#if ((PCD_DXE_SERVICE_DRIVER_VERSION < PCD_SERVICE_DXE_VERSION_MIN) || (PCD_DXE_SERVICE_DRIVER_VERSION > PCD_SERVICE_DXE_VERSION))
   #error "Please make sure the version of PCD DXE Service and the generated PCD DXE Database match."
 #endif
 
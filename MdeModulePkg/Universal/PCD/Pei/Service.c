@@ -403,7 +403,8 @@ LocateExPcdBinary (
   // Check the first bytes (Header Signature Guid) and build version.
   //
   if (!CompareGuid (PcdDb, &gPcdDataBaseSignatureGuid) ||
-      (((PEI_PCD_DATABASE *)PcdDb)->BuildVersion != PCD_SERVICE_PEIM_VERSION))
+      (((PEI_PCD_DATABASE *)PcdDb)->BuildVersion < PCD_SERVICE_PEIM_VERSION_MIN) ||
+      (((PEI_PCD_DATABASE *)PcdDb)->BuildVersion > PCD_SERVICE_PEIM_VERSION))
   {
     ASSERT (FALSE);
   }
@@ -959,6 +960,66 @@ GetWorker (
   return NULL;
 }
 
+/**
+  Search the dynamic-ex mapping table of a PCD database for a dynamic-ex PCD.
+
+  From PCD_DATABASE_SORTED_EX_MAP_VERSION on, the build tool sorts the mapping
+  table by token space guid index and then by dynamic-ex token number, so it
+  is binary searched. The table of an older database is searched linearly.
+
+  @param Database        The PCD database.
+  @param GuidIndex       Index of the token space guid in the guid table of the database.
+  @param ExTokenNumber   Dynamic-ex PCD token number.
+
+  @return Token Number for dynamic-ex PCD, or PCD_INVALID_TOKEN_NUMBER if the
+          PCD is not in the database.
+
+**/
+UINTN
+SearchExMapTable (
+  IN PCD_DATABASE_INIT  *Database,
+  IN UINTN              GuidIndex,
+  IN UINTN              ExTokenNumber
+  )
+{
+  DYNAMICEX_MAPPING  *ExMap;
+  UINTN              Index;
+  UINTN              Low;
+  UINTN              High;
+  UINTN              Middle;
+
+  ExMap = (DYNAMICEX_MAPPING *)((UINT8 *)Database + Database->ExMapTableOffset);
+
+  if (Database->BuildVersion < PCD_DATABASE_SORTED_EX_MAP_VERSION) {
+    for (Index = 0; Index < Database->ExTokenCount; Index++) {
+      if ((ExTokenNumber == ExMap[Index].ExTokenNumber) &&
+          (GuidIndex == ExMap[Index].ExGuidIndex))
+      {
+        return ExMap[Index].TokenNumber;
+      }
+    }
+
+    return PCD_INVALID_TOKEN_NUMBER;
+  }
+
+  Low  = 0;
+  High = Database->ExTokenCount;
+  while (Low < High) {
+    Middle = Low + (High - Low) / 2;
+    if ((ExMap[Middle].ExGuidIndex < GuidIndex) ||
+        ((ExMap[Middle].ExGuidIndex == GuidIndex) && (ExMap[Middle].ExTokenNumber < ExTokenNumber)))
+    {
+      Low = Middle + 1;
+    } else if ((ExMap[Middle].ExGuidIndex == GuidIndex) && (ExMap[Middle].ExTokenNumber == ExTokenNumber)) {
+      return ExMap[Middle].TokenNumber;
+    } else {
+      High = Middle;
+    }
+  }
+
+  return PCD_INVALID_TOKEN_NUMBER;
+}
+
 /**
   Get Token Number according to dynamic-ex PCD's {token space guid:token number}
 
@@ -978,16 +1039,13 @@ GetExPcdTokenNumber (
   IN UINTN           ExTokenNumber
   )
 {
-  UINT32             Index;
-  DYNAMICEX_MAPPING  *ExMap;
-  EFI_GUID           *GuidTable;
-  EFI_GUID           *MatchGuid;
-  UINTN              MatchGuidIdx;
-  PEI_PCD_DATABASE   *PeiPcdDb;
+  EFI_GUID          *GuidTable;
+  EFI_GUID          *MatchGuid;
+  UINTN             MatchGuidIdx;
+  PEI_PCD_DATABASE  *PeiPcdDb;
 
   PeiPcdDb = GetPcdDatabase ();
 
-  ExMap     = (DYNAMICEX_MAPPING *)((UINT8 *)PeiPcdDb + PeiPcdDb->ExMapTableOffset);
   GuidTable = (EFI_GUID *)((UINT8 *)PeiPcdDb + PeiPcdDb->GuidTableOffset);
 
   MatchGuid = ScanGuid (GuidTable, PeiPcdDb->GuidTableCount * sizeof (EFI_GUID), Guid);
@@ -999,15 +1057,7 @@ GetExPcdTokenNumber (
 
   MatchGuidIdx = MatchGuid - GuidTable;
 
-  for (Index = 0; Index < PeiPcdDb->ExTokenCount; Index++) {
-    if ((ExTokenNumber == ExMap[Index].ExTokenNumber) &&
-        (MatchGuidIdx == ExMap[Index].ExGuidIndex))
-    {
-      return ExMap[Index].TokenNumber;
-    }
-  }
-
-  return PCD_INVALID_TOKEN_NUMBER;
+  return SearchExMapTable (PeiPcdDb, MatchGuidIdx, ExTokenNumber);
 }
 
 /**
@@ -31,12 +31,18 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 // Please make sure the PCD Serivce PEIM Version is consistent with
 // the version of the generated PEIM PCD Database by build tool.
 //
-#define PCD_SERVICE_PEIM_VERSION  7
+#define PCD_SERVICE_PEIM_VERSION  8
+
+//
+// The oldest version of the generated PEI PCD Database that is still supported.
+// Its dynamic-ex mapping table is not sorted, and is searched linearly.
+//
+#define PCD_SERVICE_PEIM_VERSION_MIN  7
 
 //
 // PCD_PEI_SERVICE_DRIVER_VERSION is defined in Autogen.h.
 //
-#if (PCD_SERVICE_PEIM_VERSION != PCD_PEI_SERVICE_DRIVER_VERSION)
+#if ((PCD_PEI_SERVICE_DRIVER_VERSION < PCD_SERVICE_PEIM_VERSION_MIN) || (PCD_PEI_SERVICE_DRIVER_VERSION > PCD_SERVICE_PEIM_VERSION))
   #error "Please make sure the version of PCD PEIM Service and the generated PCD PEI Database match."
 #endif
 
@@ -24,6 +24,138 @@ EFI_REGULAR_EXPRESSION_PROTOCOL  mProtocolInstance = {
 
 #define CHAR16_ENCODING  ONIG_ENCODING_UTF16_LE
 
+//
+// Number of compiled patterns kept for the next calls of OnigurumaMatch()
+//
+#define REGEX_CACHE_SIZE  8
+
+typedef struct {
+  CHAR16            *Pattern;
+  OnigSyntaxType    *Syntax;
+  regex_t           *Regex;
+  UINT64            LastUse;
+  UINTN             InUse;
+} REGEX_CACHE_ENTRY;
+
+STATIC REGEX_CACHE_ENTRY  mRegexCache[REGEX_CACHE_SIZE];
+STATIC UINT64             mRegexCacheUseCount;
+
+/**
+  Look up a compiled pattern in the cache.
+
+  @param Pattern        A pointer to a NULL terminated string that represents the
+                        regular expression.
+  @param Syntax         The Oniguruma syntax the pattern is compiled with.
+
+  @return The cache entry of the pattern, which is marked as in use, or NULL if
+          the pattern is not in the cache.
+
+**/
+STATIC
+REGEX_CACHE_ENTRY *
+LookupRegexCache (
+  IN CHAR16          *Pattern,
+  IN OnigSyntaxType  *Syntax
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < REGEX_CACHE_SIZE; Index++) {
+    if ((mRegexCache[Index].Regex != NULL) &&
+        (mRegexCache[Index].Syntax == Syntax) &&
+        (StrCmp (mRegexCache[Index].Pattern, Pattern) == 0))
+    {
+      mRegexCache[Index].LastUse = ++mRegexCacheUseCount;
+      mRegexCache[Index].InUse++;
+      return &mRegexCache[Index];
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Add a compiled pattern to the cache, in place of the least recently used
+  entry which is not in use.
+
+  @param Pattern        A pointer to a NULL terminated string that represents the
+                        regular expression.
+  @param Syntax         The Oniguruma syntax the pattern is compiled with.
+  @param Regex          The compiled pattern.
+
+  @return The cache entry of the pattern, which is marked as in use, or NULL if
+          the pattern cannot be cached. The caller then frees Regex when it is
+          done with it.
+
+**/
+STATIC
+REGEX_CACHE_ENTRY *
+InsertRegexCache (
+  IN CHAR16          *Pattern,
+  IN OnigSyntaxType  *Syntax,
+  IN regex_t         *Regex
+  )
+{
+  REGEX_CACHE_ENTRY  *Entry;
+  CHAR16             *PatternCopy;
+  UINTN              Index;
+
+  Entry = NULL;
+  for (Index = 0; Index < REGEX_CACHE_SIZE; Index++) {
+    if (mRegexCache[Index].InUse != 0) {
+      continue;
+    }
+
+    if ((Entry == NULL) || (mRegexCache[Index].LastUse < Entry->LastUse)) {
+      Entry = &mRegexCache[Index];
+    }
+  }
+
+  if (Entry == NULL) {
+    return NULL;
+  }
+
+  PatternCopy = AllocateCopyPool (StrSize (Pattern), Pattern);
+  if (PatternCopy == NULL) {
+    return NULL;
+  }
+
+  if (Entry->Regex != NULL) {
+    onig_free (Entry->Regex);
+    FreePool (Entry->Pattern);
+  }
+
+  Entry->Pattern = PatternCopy;
+  Entry->Syntax  = Syntax;
+  Entry->Regex   = Regex;
+  Entry->LastUse = ++mRegexCacheUseCount;
+  Entry->InUse   = 1;
+  return Entry;
+}
+
+/**
+  Release a compiled pattern once a match is done with it.
+
+  @param CacheEntry     The cache entry of the pattern, or NULL if the pattern
+                        is not cached.
+  @param Regex          The compiled pattern.
+
+**/
+STATIC
+VOID
+ReleaseRegex (
+  IN REGEX_CACHE_ENTRY  *CacheEntry,
+  IN regex_t            *Regex
+  )
+{
+  if (CacheEntry != NULL) {
+    ASSERT (CacheEntry->InUse != 0);
+    CacheEntry->InUse--;
+  } else {
+    onig_free (Regex);
+  }
+}
+
 /**
   Call the Oniguruma regex match API.
 
@@ -75,15 +207,16 @@ OnigurumaMatch (
   OUT UINTN                  *CapturesCount
   )
 {
-  regex_t         *OnigRegex;
-  OnigSyntaxType  *OnigSyntax;
-  OnigRegion      *Region;
-  INT32           OnigResult;
-  OnigErrorInfo   ErrorInfo;
-  OnigUChar       ErrorMessage[ONIG_MAX_ERROR_MESSAGE_LEN];
-  UINT32          Index;
-  OnigUChar       *Start;
-  EFI_STATUS      Status;
+  regex_t            *OnigRegex;
+  REGEX_CACHE_ENTRY  *CacheEntry;
+  OnigSyntaxType     *OnigSyntax;
+  OnigRegion         *Region;
+  INT32              OnigResult;
+  OnigErrorInfo      ErrorInfo;
+  OnigUChar          ErrorMessage[ONIG_MAX_ERROR_MESSAGE_LEN];
+  UINT32             Index;
+  OnigUChar          *Start;
+  EFI_STATUS         Status;
 
   Status = EFI_SUCCESS;
 
@@ -101,23 +234,30 @@ OnigurumaMatch (
   }
 
   //
-  // Compile pattern
+  // Compile pattern, unless it was compiled by a previous call
   //
-  Start      = (OnigUChar *)Pattern;
-  OnigResult = onig_new (
-                 &OnigRegex,
-                 Start,
-                 Start + onigenc_str_bytelen_null (CHAR16_ENCODING, Start),
-                 ONIG_OPTION_DEFAULT,
-                 CHAR16_ENCODING,
-                 OnigSyntax,
-                 &ErrorInfo
-                 );
+  CacheEntry = LookupRegexCache (Pattern, OnigSyntax);
+  if (CacheEntry != NULL) {
+    OnigRegex = CacheEntry->Regex;
+  } else {
+    Start      = (OnigUChar *)Pattern;
+    OnigResult = onig_new (
+                   &OnigRegex,
+                   Start,
+                   Start + onigenc_str_bytelen_null (CHAR16_ENCODING, Start),
+                   ONIG_OPTION_DEFAULT,
+                   CHAR16_ENCODING,
+                   OnigSyntax,
+                   &ErrorInfo
+                   );
+
+    if (OnigResult != ONIG_NORMAL) {
+      onig_error_code_to_str (ErrorMessage, OnigResult, &ErrorInfo);
+      DEBUG ((DEBUG_ERROR, "Regex compilation failed: %a\n", ErrorMessage));
+      return EFI_DEVICE_ERROR;
+    }
 
-  if (OnigResult != ONIG_NORMAL) {
-    onig_error_code_to_str (ErrorMessage, OnigResult, &ErrorInfo);
-    DEBUG ((DEBUG_ERROR, "Regex compilation failed: %a\n", ErrorMessage));
-    return EFI_DEVICE_ERROR;
+    CacheEntry = InsertRegexCache (Pattern, OnigSyntax, OnigRegex);
   }
 
   //
@@ -126,7 +266,7 @@ OnigurumaMatch (
   Start  = (OnigUChar *)String;
   Region = onig_region_new ();
   if (Region == NULL) {
-    onig_free (OnigRegex);
+    ReleaseRegex (CacheEntry, OnigRegex);
     return EFI_OUT_OF_RESOURCES;
   }
 
@@ -148,7 +288,7 @@ OnigurumaMatch (
       onig_error_code_to_str (ErrorMessage, OnigResult);
       DEBUG ((DEBUG_ERROR, "Regex match failed: %a\n", ErrorMessage));
       onig_region_free (Region, 1);
-      onig_free (OnigRegex);
+      ReleaseRegex (CacheEntry, OnigRegex);
       return EFI_DEVICE_ERROR;
     }
   }
@@ -188,7 +328,7 @@ OnigurumaMatch (
   }
 
   onig_region_free (Region, 1);
-  onig_free (OnigRegex);
+  ReleaseRegex (CacheEntry, OnigRegex);
 
   return Status;
 }
@@ -320,8 +320,15 @@ ReportDispatcher (
       RscData->Data.HeaderSize = sizeof (RscData->Data);
     }
 
-    Status = gBS->SignalEvent (CallbackEntry->Event);
-    ASSERT_EFI_ERROR (Status);
+    //
+    // The event only needs to be signaled for the first record queued in the
+    // buffer. While the buffer is not empty the notification is pending, or is
+    // running and will pick up this record too, since it empties the buffer.
+    //
+    if (FailSafeEndPointer == CallbackEntry->StatusCodeDataBuffer) {
+      Status = gBS->SignalEvent (CallbackEntry->Event);
+      ASSERT_EFI_ERROR (Status);
+    }
   }
 
   //
@@ -881,6 +881,92 @@ IdToQuestion (
   return NULL;
 }
 
+/**
+  Search the Question referred by an expression opcode in Formset scope.
+
+  The result is the same as IdToQuestion (). The Question and the form which
+  contains it are cached in the opcode, so that the statement lists are only
+  searched when the opcode is evaluated for the first time in FormSet and Form.
+
+  @param  FormSet                The formset which contains this form.
+  @param  Form                   The form which contains this expression.
+  @param  OpCode                 The expression opcode.
+  @param  Index                  0 for OpCode->QuestionId, 1 for OpCode->QuestionId2.
+
+  @retval Pointer                The Question.
+  @retval NULL                   Specified Question not found in the formset.
+
+**/
+FORM_BROWSER_STATEMENT *
+OpCodeIdToQuestion (
+  IN     FORM_BROWSER_FORMSET  *FormSet,
+  IN     FORM_BROWSER_FORM     *Form,
+  IN OUT EXPRESSION_OPCODE     *OpCode,
+  IN     UINTN                 Index
+  )
+{
+  QUESTION_CACHE          *Cache;
+  LIST_ENTRY              *Link;
+  FORM_BROWSER_FORM       *QuestionForm;
+  FORM_BROWSER_STATEMENT  *Question;
+  UINT16                  QuestionId;
+
+  Cache = &OpCode->QuestionCache;
+  if ((Cache->FormSet != FormSet) || (Cache->Form != Form)) {
+    ZeroMem (Cache, sizeof (QUESTION_CACHE));
+    Cache->FormSet = FormSet;
+    Cache->Form    = Form;
+  }
+
+  Question = Cache->Question[Index];
+  if (Question != NULL) {
+    //
+    // EFI variable storage may be updated by Callback() asynchronous,
+    // to keep synchronous, always reload the Question Value.
+    //
+    if ((Cache->QuestionForm[Index] != Form) && (Question->Storage->Type == EFI_HII_VARSTORE_EFI_VARIABLE)) {
+      GetQuestionValue (FormSet, Cache->QuestionForm[Index], Question, GetSetValueWithHiiDriver);
+    }
+
+    return Question;
+  }
+
+  QuestionId = (Index == 0) ? OpCode->QuestionId : OpCode->QuestionId2;
+
+  //
+  // Search in the form scope first
+  //
+  Question = IdToQuestion2 (Form, QuestionId);
+  if (Question != NULL) {
+    Cache->Question[Index]     = Question;
+    Cache->QuestionForm[Index] = Form;
+    return Question;
+  }
+
+  //
+  // Search in the formset scope
+  //
+  Link = GetFirstNode (&FormSet->FormListHead);
+  while (!IsNull (&FormSet->FormListHead, Link)) {
+    QuestionForm = FORM_BROWSER_FORM_FROM_LINK (Link);
+
+    Question = IdToQuestion2 (QuestionForm, QuestionId);
+    if (Question != NULL) {
+      Cache->Question[Index]     = Question;
+      Cache->QuestionForm[Index] = QuestionForm;
+      if (Question->Storage->Type == EFI_HII_VARSTORE_EFI_VARIABLE) {
+        GetQuestionValue (FormSet, QuestionForm, Question, GetSetValueWithHiiDriver);
+      }
+
+      return Question;
+    }
+
+    Link = GetNextNode (&FormSet->FormListHead, Link);
+  }
+
+  return NULL;
+}
+
 /**
   Get Expression given its RuleId.
 
@@ -2594,7 +2680,7 @@ EvaluateExpression (
       // Built-in functions
       //
       case EFI_IFR_EQ_ID_VAL_OP:
-        Question = IdToQuestion (FormSet, Form, OpCode->QuestionId);
+        Question = OpCodeIdToQuestion (FormSet, Form, OpCode, 0);
         if (Question == NULL) {
           Value->Type = EFI_IFR_TYPE_UNDEFINED;
           break;
@@ -2615,13 +2701,13 @@ EvaluateExpression (
         break;
 
       case EFI_IFR_EQ_ID_ID_OP:
-        Question = IdToQuestion (FormSet, Form, OpCode->QuestionId);
+        Question = OpCodeIdToQuestion (FormSet, Form, OpCode, 0);
         if (Question == NULL) {
           Value->Type = EFI_IFR_TYPE_UNDEFINED;
           break;
         }
 
-        Question2 = IdToQuestion (FormSet, Form, OpCode->QuestionId2);
+        Question2 = OpCodeIdToQuestion (FormSet, Form, OpCode, 1);
         if (Question2 == NULL) {
           Value->Type = EFI_IFR_TYPE_UNDEFINED;
           break;
@@ -2642,7 +2728,7 @@ EvaluateExpression (
         break;
 
       case EFI_IFR_EQ_ID_VAL_LIST_OP:
-        Question = IdToQuestion (FormSet, Form, OpCode->QuestionId);
+        Question = OpCodeIdToQuestion (FormSet, Form, OpCode, 0);
         if (Question == NULL) {
           Value->Type = EFI_IFR_TYPE_UNDEFINED;
           break;
@@ -2669,7 +2755,7 @@ EvaluateExpression (
 
       case EFI_IFR_QUESTION_REF1_OP:
       case EFI_IFR_THIS_OP:
-        Question = IdToQuestion (FormSet, Form, OpCode->QuestionId);
+        Question = OpCodeIdToQuestion (FormSet, Form, OpCode, 0);
         if (Question == NULL) {
           Status = EFI_NOT_FOUND;
           goto Done;
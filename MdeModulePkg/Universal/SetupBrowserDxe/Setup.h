@@ -180,6 +180,18 @@ typedef union {
   UINT16           VarOffset;
 } VAR_STORE_INFO;
 
+//
+// The Questions of QuestionId and QuestionId2 of an expression opcode, and the
+// forms which contain them, found when the opcode was last evaluated in FormSet
+// and Form.
+//
+typedef struct {
+  struct _FORM_BROWSER_FORMSET      *FormSet;
+  struct _FORM_BROWSER_FORM         *Form;
+  struct _FORM_BROWSER_STATEMENT    *Question[2];
+  struct _FORM_BROWSER_FORM         *QuestionForm[2];
+} QUESTION_CACHE;
+
 #define EXPRESSION_OPCODE_SIGNATURE  SIGNATURE_32 ('E', 'X', 'O', 'P')
 
 typedef struct {
@@ -209,6 +221,7 @@ typedef struct {
   UINT8              ValueWidth;        // For EFI_IFR_SET, EFI_IFR_GET
   CHAR16             *ValueName;        // For EFI_IFR_SET, EFI_IFR_GET
   LIST_ENTRY         MapExpressionList; // nested expressions inside of Map opcode.
+  QUESTION_CACHE     QuestionCache;     // For EFI_IFR_EQ_ID_VAL, EFI_IFR_EQ_ID_ID, EFI_IFR_EQ_ID_VAL_LIST, EFI_IFR_QUESTION_REF1, EFI_IFR_THIS
 } EXPRESSION_OPCODE;
 
 #define EXPRESSION_OPCODE_FROM_LINK(a)  CR (a, EXPRESSION_OPCODE, Link, EXPRESSION_OPCODE_SIGNATURE)
@@ -393,7 +406,7 @@ typedef struct {
 #define FORM_BROWSER_FORM_SIGNATURE  SIGNATURE_32 ('F', 'F', 'R', 'M')
 #define STANDARD_MAP_FORM_TYPE       0x01
 
-typedef struct {
+typedef struct _FORM_BROWSER_FORM {
   UINTN                   Signature;
   LIST_ENTRY              Link;
 
@@ -430,7 +443,7 @@ typedef struct {
 
 #define FORM_BROWSER_FORMSET_SIGNATURE  SIGNATURE_32 ('F', 'B', 'F', 'S')
 
-typedef struct {
+typedef struct _FORM_BROWSER_FORMSET {
   UINTN                             Signature;
   LIST_ENTRY                        Link;
   LIST_ENTRY                        SaveFailLink;
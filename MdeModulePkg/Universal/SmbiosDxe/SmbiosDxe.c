@@ -246,7 +246,7 @@ GetSmbiosStructureSize (
 
   Determin whether an SmbiosHandle has already in use.
 
-  @param Head        Pointer to the beginning of SMBIOS structure.
+  @param Private     Pointer to the SMBIOS instance.
   @param Handle      A unique handle will be assigned to the SMBIOS record.
 
   @retval TRUE       Smbios handle already in use.
@@ -256,21 +256,46 @@ GetSmbiosStructureSize (
 BOOLEAN
 EFIAPI
 CheckSmbiosHandleExistance (
-  IN  LIST_ENTRY         *Head,
+  IN  SMBIOS_INSTANCE    *Private,
   IN  EFI_SMBIOS_HANDLE  Handle
   )
 {
+  return (BOOLEAN)((Private->AllocatedHandleBitmap[Handle / 8] & (1 << (Handle % 8))) != 0);
+}
+
+/**
+
+  Find the handle entry of an SmbiosHandle that is in use.
+
+  @param Private     Pointer to the SMBIOS instance.
+  @param Handle      The SMBIOS handle to find.
+
+  @return The handle entry, or NULL if the SMBIOS handle is NOT used.
+
+**/
+SMBIOS_HANDLE_ENTRY *
+FindSmbiosHandleEntry (
+  IN  SMBIOS_INSTANCE    *Private,
+  IN  EFI_SMBIOS_HANDLE  Handle
+  )
+{
+  LIST_ENTRY           *Head;
   LIST_ENTRY           *Link;
   SMBIOS_HANDLE_ENTRY  *HandleEntry;
 
+  if (!CheckSmbiosHandleExistance (Private, Handle)) {
+    return NULL;
+  }
+
+  Head = &Private->AllocatedHandleListHead[SMBIOS_HANDLE_HASH (Handle)];
   for (Link = Head->ForwardLink; Link != Head; Link = Link->ForwardLink) {
     HandleEntry = SMBIOS_HANDLE_ENTRY_FROM_LINK (Link);
     if (HandleEntry->SmbiosHandle == Handle) {
-      return TRUE;
+      return HandleEntry;
     }
   }
 
-  return FALSE;
+  return NULL;
 }
 
 /**
@@ -313,18 +338,17 @@ GetAvailableSmbiosHandle (
   IN OUT   EFI_SMBIOS_HANDLE    *Handle
   )
 {
-  LIST_ENTRY         *Head;
   SMBIOS_INSTANCE    *Private;
   EFI_SMBIOS_HANDLE  MaxSmbiosHandle;
-  EFI_SMBIOS_HANDLE  AvailableHandle;
+  UINTN              AvailableHandle;
 
   GetMaxSmbiosHandle (This, &MaxSmbiosHandle);
 
   Private = SMBIOS_INSTANCE_FROM_THIS (This);
-  Head    = &Private->AllocatedHandleListHead;
-  for (AvailableHandle = 0; AvailableHandle < MaxSmbiosHandle; AvailableHandle++) {
-    if (!CheckSmbiosHandleExistance (Head, AvailableHandle)) {
-      *Handle = AvailableHandle;
+  for (AvailableHandle = Private->LowestFreeHandle; AvailableHandle < MaxSmbiosHandle; AvailableHandle++) {
+    if (!CheckSmbiosHandleExistance (Private, (EFI_SMBIOS_HANDLE)AvailableHandle)) {
+      Private->LowestFreeHandle = AvailableHandle;
+      *Handle                   = (EFI_SMBIOS_HANDLE)AvailableHandle;
       return EFI_SUCCESS;
     }
   }
@@ -366,7 +390,6 @@ SmbiosAdd (
   UINTN                     StructureSize;
   UINTN                     NumberOfStrings;
   EFI_STATUS                Status;
-  LIST_ENTRY                *Head;
   SMBIOS_INSTANCE           *Private;
   EFI_SMBIOS_ENTRY          *SmbiosEntry;
   EFI_SMBIOS_HANDLE         MaxSmbiosHandle;
@@ -383,8 +406,7 @@ SmbiosAdd (
   //
   // Check whether SmbiosHandle is already in use
   //
-  Head = &Private->AllocatedHandleListHead;
-  if ((*SmbiosHandle != SMBIOS_HANDLE_PI_RESERVED) && CheckSmbiosHandleExistance (Head, *SmbiosHandle)) {
+  if ((*SmbiosHandle != SMBIOS_HANDLE_PI_RESERVED) && CheckSmbiosHandleExistance (Private, *SmbiosHandle)) {
     return EFI_ALREADY_STARTED;
   }
 
@@ -481,6 +503,7 @@ SmbiosAdd (
 
   HandleEntry = AllocateZeroPool (sizeof (SMBIOS_HANDLE_ENTRY));
   if (HandleEntry == NULL) {
+    FreePool (SmbiosEntry);
     EfiReleaseLock (&Private->DataLock);
     return EFI_OUT_OF_RESOURCES;
   }
@@ -490,7 +513,12 @@ SmbiosAdd (
   //
   HandleEntry->Signature    = SMBIOS_HANDLE_ENTRY_SIGNATURE;
   HandleEntry->SmbiosHandle = *SmbiosHandle;
-  InsertTailList (&Private->AllocatedHandleListHead, &HandleEntry->Link);
+  HandleEntry->SmbiosEntry  = SmbiosEntry;
+  InsertTailList (&Private->AllocatedHandleListHead[SMBIOS_HANDLE_HASH (*SmbiosHandle)], &HandleEntry->Link);
+  Private->AllocatedHandleBitmap[*SmbiosHandle / 8] |= (UINT8)(1 << (*SmbiosHandle % 8));
+  if (*SmbiosHandle == Private->LowestFreeHandle) {
+    Private->LowestFreeHandle++;
+  }
 
   InternalRecord = (EFI_SMBIOS_RECORD_HEADER *)(SmbiosEntry + 1);
   Raw            = (VOID *)(InternalRecord + 1);
@@ -521,8 +549,9 @@ SmbiosAdd (
   // Here we create SMBIOS table and publish it in
   // configuration table, so other UEFI drivers can get SMBIOS table from
   // configuration table without depending on PI SMBIOS protocol.
+  // The record is the last one, so it only needs to be appended to the tables.
   //
-  SmbiosTableConstruction (Smbios32BitTable, Smbios64BitTable);
+  SmbiosTableAppend (SmbiosEntry);
 
   //
   // Leave critical section
@@ -562,11 +591,11 @@ SmbiosUpdateString (
   CHAR8                     *StrStart;
   VOID                      *Raw;
   LIST_ENTRY                *Link;
-  LIST_ENTRY                *Head;
   EFI_STATUS                Status;
   SMBIOS_INSTANCE           *Private;
   EFI_SMBIOS_ENTRY          *SmbiosEntry;
   EFI_SMBIOS_ENTRY          *ResizedSmbiosEntry;
+  SMBIOS_HANDLE_ENTRY       *HandleEntry;
   EFI_SMBIOS_HANDLE         MaxSmbiosHandle;
   EFI_SMBIOS_TABLE_HEADER   *Record;
   EFI_SMBIOS_RECORD_HEADER  *InternalRecord;
@@ -623,170 +652,170 @@ SmbiosUpdateString (
     return Status;
   }
 
-  Head = &Private->DataListHead;
-  for (Link = Head->ForwardLink; Link != Head; Link = Link->ForwardLink) {
-    SmbiosEntry = SMBIOS_ENTRY_FROM_LINK (Link);
-    Record      = (EFI_SMBIOS_TABLE_HEADER *)(SmbiosEntry->RecordHeader + 1);
-
-    if (Record->Handle == *SmbiosHandle) {
-      //
-      // Find out the specified SMBIOS record
-      //
-      if (*StringNumber > SmbiosEntry->RecordHeader->NumberOfStrings) {
-        EfiReleaseLock (&Private->DataLock);
-        return EFI_NOT_FOUND;
-      }
-
-      //
-      // Point to unformed string section
-      //
-      StrStart = (CHAR8 *)Record + Record->Length;
+  //
+  // Find out the specified SMBIOS record
+  //
+  HandleEntry = FindSmbiosHandleEntry (Private, *SmbiosHandle);
+  if (HandleEntry == NULL) {
+    EfiReleaseLock (&Private->DataLock);
+    return EFI_INVALID_PARAMETER;
+  }
 
-      for (StrIndex = 1, TargetStrOffset = 0; StrIndex < *StringNumber; StrStart++, TargetStrOffset++) {
-        //
-        // A string ends in 00h
-        //
-        if (*StrStart == 0) {
-          StrIndex++;
-        }
+  SmbiosEntry = HandleEntry->SmbiosEntry;
+  Link        = &SmbiosEntry->Link;
+  Record      = (EFI_SMBIOS_TABLE_HEADER *)(SmbiosEntry->RecordHeader + 1);
 
-        //
-        // String section ends in double-null (0000h)
-        //
-        if ((*StrStart == 0) && (*(StrStart + 1) == 0)) {
-          EfiReleaseLock (&Private->DataLock);
-          return EFI_NOT_FOUND;
-        }
-      }
+  if (*StringNumber > SmbiosEntry->RecordHeader->NumberOfStrings) {
+    EfiReleaseLock (&Private->DataLock);
+    return EFI_NOT_FOUND;
+  }
 
-      if (*StrStart == 0) {
-        StrStart++;
-        TargetStrOffset++;
-      }
+  //
+  // Point to unformed string section
+  //
+  StrStart = (CHAR8 *)Record + Record->Length;
 
-      //
-      // Now we get the string target
-      //
-      TargetStrLen = AsciiStrLen (StrStart);
-      if (InputStrLen == TargetStrLen) {
-        AsciiStrCpyS (StrStart, TargetStrLen + 1, String);
-        //
-        // Some UEFI drivers (such as network) need some information in SMBIOS table.
-        // Here we create SMBIOS table and publish it in
-        // configuration table, so other UEFI drivers can get SMBIOS table from
-        // configuration table without depending on PI SMBIOS protocol.
-        //
-        SmbiosTableConstruction (SmbiosEntry->Smbios32BitTable, SmbiosEntry->Smbios64BitTable);
-        EfiReleaseLock (&Private->DataLock);
-        return EFI_SUCCESS;
-      }
+  for (StrIndex = 1, TargetStrOffset = 0; StrIndex < *StringNumber; StrStart++, TargetStrOffset++) {
+    //
+    // A string ends in 00h
+    //
+    if (*StrStart == 0) {
+      StrIndex++;
+    }
 
-      SmbiosEntry->Smbios32BitTable = FALSE;
-      SmbiosEntry->Smbios64BitTable = FALSE;
-      if ((This->MajorVersion < 0x3) ||
-          ((This->MajorVersion >= 0x3) && ((PcdGet32 (PcdSmbiosEntryPointProvideMethod) & BIT0) == BIT0)))
-      {
-        //
-        // 32-bit table is produced, check the valid length.
-        //
-        if ((EntryPointStructure != NULL) &&
-            (EntryPointStructure->TableLength + InputStrLen - TargetStrLen > SMBIOS_TABLE_MAX_LENGTH))
-        {
-          //
-          // The length of the entire structure table (including all strings) must be reported
-          // in the Structure Table Length field of the SMBIOS Structure Table Entry Point,
-          // which is a WORD field limited to 65,535 bytes.
-          //
-          DEBUG ((DEBUG_INFO, "SmbiosUpdateString: Total length exceeds max 32-bit table length\n"));
-        } else {
-          DEBUG ((DEBUG_INFO, "SmbiosUpdateString: New smbios record add to 32-bit table\n"));
-          SmbiosEntry->Smbios32BitTable = TRUE;
-        }
-      }
+    //
+    // String section ends in double-null (0000h)
+    //
+    if ((*StrStart == 0) && (*(StrStart + 1) == 0)) {
+      EfiReleaseLock (&Private->DataLock);
+      return EFI_NOT_FOUND;
+    }
+  }
 
-      if ((This->MajorVersion >= 0x3) && ((PcdGet32 (PcdSmbiosEntryPointProvideMethod) & BIT1) == BIT1)) {
-        //
-        // 64-bit table is produced, check the valid length.
-        //
-        if ((Smbios30EntryPointStructure != NULL) &&
-            (Smbios30EntryPointStructure->TableMaximumSize + InputStrLen - TargetStrLen > SMBIOS_3_0_TABLE_MAX_LENGTH))
-        {
-          DEBUG ((DEBUG_INFO, "SmbiosUpdateString: Total length exceeds max 64-bit table length\n"));
-        } else {
-          DEBUG ((DEBUG_INFO, "SmbiosUpdateString: New smbios record add to 64-bit table\n"));
-          SmbiosEntry->Smbios64BitTable = TRUE;
-        }
-      }
+  if (*StrStart == 0) {
+    StrStart++;
+    TargetStrOffset++;
+  }
 
-      if ((!SmbiosEntry->Smbios32BitTable) && (!SmbiosEntry->Smbios64BitTable)) {
-        EfiReleaseLock (&Private->DataLock);
-        return EFI_UNSUPPORTED;
-      }
+  //
+  // Now we get the string target
+  //
+  TargetStrLen = AsciiStrLen (StrStart);
+  if (InputStrLen == TargetStrLen) {
+    AsciiStrCpyS (StrStart, TargetStrLen + 1, String);
+    //
+    // Some UEFI drivers (such as network) need some information in SMBIOS table.
+    // Here we create SMBIOS table and publish it in
+    // configuration table, so other UEFI drivers can get SMBIOS table from
+    // configuration table without depending on PI SMBIOS protocol.
+    //
+    SmbiosTableConstruction (SmbiosEntry->Smbios32BitTable, SmbiosEntry->Smbios64BitTable);
+    EfiReleaseLock (&Private->DataLock);
+    return EFI_SUCCESS;
+  }
 
+  SmbiosEntry->Smbios32BitTable = FALSE;
+  SmbiosEntry->Smbios64BitTable = FALSE;
+  if ((This->MajorVersion < 0x3) ||
+      ((This->MajorVersion >= 0x3) && ((PcdGet32 (PcdSmbiosEntryPointProvideMethod) & BIT0) == BIT0)))
+  {
+    //
+    // 32-bit table is produced, check the valid length.
+    //
+    if ((EntryPointStructure != NULL) &&
+        (EntryPointStructure->TableLength + InputStrLen - TargetStrLen > SMBIOS_TABLE_MAX_LENGTH))
+    {
       //
-      // Original string buffer size is not exactly match input string length.
-      // Re-allocate buffer is needed.
+      // The length of the entire structure table (including all strings) must be reported
+      // in the Structure Table Length field of the SMBIOS Structure Table Entry Point,
+      // which is a WORD field limited to 65,535 bytes.
       //
-      NewEntrySize       = SmbiosEntry->RecordSize + InputStrLen - TargetStrLen;
-      ResizedSmbiosEntry = AllocateZeroPool (NewEntrySize);
+      DEBUG ((DEBUG_INFO, "SmbiosUpdateString: Total length exceeds max 32-bit table length\n"));
+    } else {
+      DEBUG ((DEBUG_INFO, "SmbiosUpdateString: New smbios record add to 32-bit table\n"));
+      SmbiosEntry->Smbios32BitTable = TRUE;
+    }
+  }
 
-      if (ResizedSmbiosEntry == NULL) {
-        EfiReleaseLock (&Private->DataLock);
-        return EFI_OUT_OF_RESOURCES;
-      }
+  if ((This->MajorVersion >= 0x3) && ((PcdGet32 (PcdSmbiosEntryPointProvideMethod) & BIT1) == BIT1)) {
+    //
+    // 64-bit table is produced, check the valid length.
+    //
+    if ((Smbios30EntryPointStructure != NULL) &&
+        (Smbios30EntryPointStructure->TableMaximumSize + InputStrLen - TargetStrLen > SMBIOS_3_0_TABLE_MAX_LENGTH))
+    {
+      DEBUG ((DEBUG_INFO, "SmbiosUpdateString: Total length exceeds max 64-bit table length\n"));
+    } else {
+      DEBUG ((DEBUG_INFO, "SmbiosUpdateString: New smbios record add to 64-bit table\n"));
+      SmbiosEntry->Smbios64BitTable = TRUE;
+    }
+  }
 
-      InternalRecord = (EFI_SMBIOS_RECORD_HEADER *)(ResizedSmbiosEntry + 1);
-      Raw            = (VOID *)(InternalRecord + 1);
+  if ((!SmbiosEntry->Smbios32BitTable) && (!SmbiosEntry->Smbios64BitTable)) {
+    EfiReleaseLock (&Private->DataLock);
+    return EFI_UNSUPPORTED;
+  }
 
-      //
-      // Build internal record Header
-      //
-      InternalRecord->Version         = EFI_SMBIOS_RECORD_HEADER_VERSION;
-      InternalRecord->HeaderSize      = (UINT16)sizeof (EFI_SMBIOS_RECORD_HEADER);
-      InternalRecord->RecordSize      = SmbiosEntry->RecordHeader->RecordSize + InputStrLen - TargetStrLen;
-      InternalRecord->ProducerHandle  = SmbiosEntry->RecordHeader->ProducerHandle;
-      InternalRecord->NumberOfStrings = SmbiosEntry->RecordHeader->NumberOfStrings;
+  //
+  // Original string buffer size is not exactly match input string length.
+  // Re-allocate buffer is needed.
+  //
+  NewEntrySize       = SmbiosEntry->RecordSize + InputStrLen - TargetStrLen;
+  ResizedSmbiosEntry = AllocateZeroPool (NewEntrySize);
 
-      //
-      // Copy SMBIOS structure and optional strings.
-      //
-      CopyMem (Raw, SmbiosEntry->RecordHeader + 1, Record->Length + TargetStrOffset);
-      CopyMem ((VOID *)((UINTN)Raw + Record->Length + TargetStrOffset), String, InputStrLen + 1);
-      CopyMem (
-        (CHAR8 *)((UINTN)Raw + Record->Length + TargetStrOffset + InputStrLen + 1),
-        (CHAR8 *)Record + Record->Length + TargetStrOffset + TargetStrLen + 1,
-        SmbiosEntry->RecordHeader->RecordSize - sizeof (EFI_SMBIOS_RECORD_HEADER) - Record->Length - TargetStrOffset - TargetStrLen - 1
-        );
+  if (ResizedSmbiosEntry == NULL) {
+    EfiReleaseLock (&Private->DataLock);
+    return EFI_OUT_OF_RESOURCES;
+  }
 
-      //
-      // Insert new record
-      //
-      ResizedSmbiosEntry->Signature        = EFI_SMBIOS_ENTRY_SIGNATURE;
-      ResizedSmbiosEntry->RecordHeader     = InternalRecord;
-      ResizedSmbiosEntry->RecordSize       = NewEntrySize;
-      ResizedSmbiosEntry->Smbios32BitTable = SmbiosEntry->Smbios32BitTable;
-      ResizedSmbiosEntry->Smbios64BitTable = SmbiosEntry->Smbios64BitTable;
-      InsertTailList (Link->ForwardLink, &ResizedSmbiosEntry->Link);
+  InternalRecord = (EFI_SMBIOS_RECORD_HEADER *)(ResizedSmbiosEntry + 1);
+  Raw            = (VOID *)(InternalRecord + 1);
 
-      //
-      // Remove old record
-      //
-      RemoveEntryList (Link);
-      FreePool (SmbiosEntry);
-      //
-      // Some UEFI drivers (such as network) need some information in SMBIOS table.
-      // Here we create SMBIOS table and publish it in
-      // configuration table, so other UEFI drivers can get SMBIOS table from
-      // configuration table without depending on PI SMBIOS protocol.
-      //
-      SmbiosTableConstruction (ResizedSmbiosEntry->Smbios32BitTable, ResizedSmbiosEntry->Smbios64BitTable);
-      EfiReleaseLock (&Private->DataLock);
-      return EFI_SUCCESS;
-    }
-  }
+  //
+  // Build internal record Header
+  //
+  InternalRecord->Version         = EFI_SMBIOS_RECORD_HEADER_VERSION;
+  InternalRecord->HeaderSize      = (UINT16)sizeof (EFI_SMBIOS_RECORD_HEADER);
+  InternalRecord->RecordSize      = SmbiosEntry->RecordHeader->RecordSize + InputStrLen - TargetStrLen;
+  InternalRecord->ProducerHandle  = SmbiosEntry->RecordHeader->ProducerHandle;
+  InternalRecord->NumberOfStrings = SmbiosEntry->RecordHeader->NumberOfStrings;
+
+  //
+  // Copy SMBIOS structure and optional strings.
+  //
+  CopyMem (Raw, SmbiosEntry->RecordHeader + 1, Record->Length + TargetStrOffset);
+  CopyMem ((VOID *)((UINTN)Raw + Record->Length + TargetStrOffset), String, InputStrLen + 1);
+  CopyMem (
+    (CHAR8 *)((UINTN)Raw + Record->Length + TargetStrOffset + InputStrLen + 1),
+    (CHAR8 *)Record + Record->Length + TargetStrOffset + TargetStrLen + 1,
+    SmbiosEntry->RecordHeader->RecordSize - sizeof (EFI_SMBIOS_RECORD_HEADER) - Record->Length - TargetStrOffset - TargetStrLen - 1
+    );
+
+  //
+  // Insert new record
+  //
+  ResizedSmbiosEntry->Signature        = EFI_SMBIOS_ENTRY_SIGNATURE;
+  ResizedSmbiosEntry->RecordHeader     = InternalRecord;
+  ResizedSmbiosEntry->RecordSize       = NewEntrySize;
+  ResizedSmbiosEntry->Smbios32BitTable = SmbiosEntry->Smbios32BitTable;
+  ResizedSmbiosEntry->Smbios64BitTable = SmbiosEntry->Smbios64BitTable;
+  InsertTailList (Link->ForwardLink, &ResizedSmbiosEntry->Link);
+  HandleEntry->SmbiosEntry = ResizedSmbiosEntry;
 
+  //
+  // Remove old record
+  //
+  RemoveEntryList (Link);
+  FreePool (SmbiosEntry);
+  //
+  // Some UEFI drivers (such as network) need some information in SMBIOS table.
+  // Here we create SMBIOS table and publish it in
+  // configuration table, so other UEFI drivers can get SMBIOS table from
+  // configuration table without depending on PI SMBIOS protocol.
+  //
+  SmbiosTableConstruction (ResizedSmbiosEntry->Smbios32BitTable, ResizedSmbiosEntry->Smbios64BitTable);
   EfiReleaseLock (&Private->DataLock);
-  return EFI_INVALID_PARAMETER;
+  return EFI_SUCCESS;
 }
 
 /**
@@ -806,14 +835,11 @@ SmbiosRemove (
   IN EFI_SMBIOS_HANDLE          SmbiosHandle
   )
 {
-  LIST_ENTRY               *Link;
-  LIST_ENTRY               *Head;
-  EFI_STATUS               Status;
-  EFI_SMBIOS_HANDLE        MaxSmbiosHandle;
-  SMBIOS_INSTANCE          *Private;
-  EFI_SMBIOS_ENTRY         *SmbiosEntry;
-  SMBIOS_HANDLE_ENTRY      *HandleEntry;
-  EFI_SMBIOS_TABLE_HEADER  *Record;
+  EFI_STATUS           Status;
+  EFI_SMBIOS_HANDLE    MaxSmbiosHandle;
+  SMBIOS_INSTANCE      *Private;
+  EFI_SMBIOS_ENTRY     *SmbiosEntry;
+  SMBIOS_HANDLE_ENTRY  *HandleEntry;
 
   //
   // Check args validity
@@ -833,57 +859,51 @@ SmbiosRemove (
     return Status;
   }
 
-  Head = &Private->DataListHead;
-  for (Link = Head->ForwardLink; Link != Head; Link = Link->ForwardLink) {
-    SmbiosEntry = SMBIOS_ENTRY_FROM_LINK (Link);
-    Record      = (EFI_SMBIOS_TABLE_HEADER *)(SmbiosEntry->RecordHeader + 1);
-    if (Record->Handle == SmbiosHandle) {
-      //
-      // Remove specified smobios record from DataList
-      //
-      RemoveEntryList (Link);
-      //
-      // Remove this handle from AllocatedHandleList
-      //
-      Head = &Private->AllocatedHandleListHead;
-      for (Link = Head->ForwardLink; Link != Head; Link = Link->ForwardLink) {
-        HandleEntry = SMBIOS_HANDLE_ENTRY_FROM_LINK (Link);
-        if (HandleEntry->SmbiosHandle == SmbiosHandle) {
-          RemoveEntryList (Link);
-          FreePool (HandleEntry);
-          break;
-        }
-      }
+  HandleEntry = FindSmbiosHandleEntry (Private, SmbiosHandle);
+  if (HandleEntry == NULL) {
+    //
+    // Leave critical section
+    //
+    EfiReleaseLock (&Private->DataLock);
+    return EFI_INVALID_PARAMETER;
+  }
 
-      //
-      // Some UEFI drivers (such as network) need some information in SMBIOS table.
-      // Here we create SMBIOS table and publish it in
-      // configuration table, so other UEFI drivers can get SMBIOS table from
-      // configuration table without depending on PI SMBIOS protocol.
-      //
-      if (SmbiosEntry->Smbios32BitTable) {
-        DEBUG ((DEBUG_INFO, "SmbiosRemove: remove from 32-bit table\n"));
-      }
+  //
+  // Remove specified smobios record from DataList
+  //
+  SmbiosEntry = HandleEntry->SmbiosEntry;
+  RemoveEntryList (&SmbiosEntry->Link);
+  //
+  // Remove this handle from AllocatedHandleList
+  //
+  RemoveEntryList (&HandleEntry->Link);
+  FreePool (HandleEntry);
+  Private->AllocatedHandleBitmap[SmbiosHandle / 8] &= (UINT8)~(1 << (SmbiosHandle % 8));
+  if (SmbiosHandle < Private->LowestFreeHandle) {
+    Private->LowestFreeHandle = SmbiosHandle;
+  }
 
-      if (SmbiosEntry->Smbios64BitTable) {
-        DEBUG ((DEBUG_INFO, "SmbiosRemove: remove from 64-bit table\n"));
-      }
+  //
+  // Some UEFI drivers (such as network) need some information in SMBIOS table.
+  // Here we create SMBIOS table and publish it in
+  // configuration table, so other UEFI drivers can get SMBIOS table from
+  // configuration table without depending on PI SMBIOS protocol.
+  //
+  if (SmbiosEntry->Smbios32BitTable) {
+    DEBUG ((DEBUG_INFO, "SmbiosRemove: remove from 32-bit table\n"));
+  }
 
-      //
-      // Update the whole SMBIOS table again based on which table the removed SMBIOS record is in.
-      //
-      SmbiosTableConstruction (SmbiosEntry->Smbios32BitTable, SmbiosEntry->Smbios64BitTable);
-      FreePool (SmbiosEntry);
-      EfiReleaseLock (&Private->DataLock);
-      return EFI_SUCCESS;
-    }
+  if (SmbiosEntry->Smbios64BitTable) {
+    DEBUG ((DEBUG_INFO, "SmbiosRemove: remove from 64-bit table\n"));
   }
 
   //
-  // Leave critical section
+  // Update the whole SMBIOS table again based on which table the removed SMBIOS record is in.
   //
+  SmbiosTableConstruction (SmbiosEntry->Smbios32BitTable, SmbiosEntry->Smbios64BitTable);
+  FreePool (SmbiosEntry);
   EfiReleaseLock (&Private->DataLock);
-  return EFI_INVALID_PARAMETER;
+  return EFI_SUCCESS;
 }
 
 /**
@@ -914,62 +934,45 @@ SmbiosGetNext (
   OUT EFI_HANDLE                *ProducerHandle OPTIONAL
   )
 {
-  BOOLEAN                  StartPointFound;
   LIST_ENTRY               *Link;
   LIST_ENTRY               *Head;
   SMBIOS_INSTANCE          *Private;
   EFI_SMBIOS_ENTRY         *SmbiosEntry;
+  SMBIOS_HANDLE_ENTRY      *HandleEntry;
   EFI_SMBIOS_TABLE_HEADER  *SmbiosTableHeader;
 
   if (SmbiosHandle == NULL) {
     return EFI_INVALID_PARAMETER;
   }
 
-  StartPointFound = FALSE;
-  Private         = SMBIOS_INSTANCE_FROM_THIS (This);
-  Head            = &Private->DataListHead;
-  for (Link = Head->ForwardLink; Link != Head; Link = Link->ForwardLink) {
-    SmbiosEntry       = SMBIOS_ENTRY_FROM_LINK (Link);
-    SmbiosTableHeader = (EFI_SMBIOS_TABLE_HEADER *)(SmbiosEntry->RecordHeader + 1);
-
-    //
-    // If SmbiosHandle is 0xFFFE, the first matched SMBIOS record handle will be returned
-    //
-    if (*SmbiosHandle == SMBIOS_HANDLE_PI_RESERVED) {
-      if ((Type != NULL) && (*Type != SmbiosTableHeader->Type)) {
-        continue;
-      }
+  Private = SMBIOS_INSTANCE_FROM_THIS (This);
+  Head    = &Private->DataListHead;
 
-      *SmbiosHandle = SmbiosTableHeader->Handle;
-      *Record       = SmbiosTableHeader;
-      if (ProducerHandle != NULL) {
-        *ProducerHandle = SmbiosEntry->RecordHeader->ProducerHandle;
-      }
+  //
+  // If SmbiosHandle is 0xFFFE, the first matched SMBIOS record handle will be returned.
+  // Otherwise start this round search from the record after the one of SmbiosHandle.
+  //
+  Link = Head->ForwardLink;
+  if (*SmbiosHandle != SMBIOS_HANDLE_PI_RESERVED) {
+    HandleEntry = FindSmbiosHandleEntry (Private, *SmbiosHandle);
+    Link        = (HandleEntry == NULL) ? Head : HandleEntry->SmbiosEntry->Link.ForwardLink;
+  }
 
-      return EFI_SUCCESS;
-    }
+  for ( ; Link != Head; Link = Link->ForwardLink) {
+    SmbiosEntry       = SMBIOS_ENTRY_FROM_LINK (Link);
+    SmbiosTableHeader = (EFI_SMBIOS_TABLE_HEADER *)(SmbiosEntry->RecordHeader + 1);
 
-    //
-    // Start this round search from the next SMBIOS handle
-    //
-    if (!StartPointFound && (*SmbiosHandle == SmbiosTableHeader->Handle)) {
-      StartPointFound = TRUE;
+    if ((Type != NULL) && (*Type != SmbiosTableHeader->Type)) {
       continue;
     }
 
-    if (StartPointFound) {
-      if ((Type != NULL) && (*Type != SmbiosTableHeader->Type)) {
-        continue;
-      }
-
-      *SmbiosHandle = SmbiosTableHeader->Handle;
-      *Record       = SmbiosTableHeader;
-      if (ProducerHandle != NULL) {
-        *ProducerHandle = SmbiosEntry->RecordHeader->ProducerHandle;
-      }
-
-      return EFI_SUCCESS;
+    *SmbiosHandle = SmbiosTableHeader->Handle;
+    *Record       = SmbiosTableHeader;
+    if (ProducerHandle != NULL) {
+      *ProducerHandle = SmbiosEntry->RecordHeader->ProducerHandle;
     }
+
+    return EFI_SUCCESS;
   }
 
   *SmbiosHandle = SMBIOS_HANDLE_PI_RESERVED;
@@ -1051,7 +1054,6 @@ SmbiosCreateTable (
 {
   UINT8                           *BufferPointer;
   UINTN                           RecordSize;
-  UINTN                           NumOfStr;
   EFI_STATUS                      Status;
   EFI_SMBIOS_HANDLE               SmbiosHandle;
   EFI_SMBIOS_PROTOCOL             *SmbiosProtocol;
@@ -1126,7 +1128,7 @@ SmbiosCreateTable (
     Status = GetNextSmbiosRecord (SmbiosProtocol, &CurrentSmbiosEntry, &SmbiosRecord);
 
     if ((Status == EFI_SUCCESS) && (CurrentSmbiosEntry->Smbios32BitTable)) {
-      GetSmbiosStructureSize (SmbiosProtocol, SmbiosRecord, &RecordSize, &NumOfStr);
+      RecordSize = CurrentSmbiosEntry->RecordHeader->RecordSize - sizeof (EFI_SMBIOS_RECORD_HEADER);
       //
       // Record NumberOfSmbiosStructures, TableLength and MaxStructureSize
       //
@@ -1202,7 +1204,7 @@ SmbiosCreateTable (
     Status = GetNextSmbiosRecord (SmbiosProtocol, &CurrentSmbiosEntry, &SmbiosRecord);
 
     if ((Status == EFI_SUCCESS) && (CurrentSmbiosEntry->Smbios32BitTable)) {
-      GetSmbiosStructureSize (SmbiosProtocol, SmbiosRecord, &RecordSize, &NumOfStr);
+      RecordSize = CurrentSmbiosEntry->RecordHeader->RecordSize - sizeof (EFI_SMBIOS_RECORD_HEADER);
       CopyMem (BufferPointer, SmbiosRecord, RecordSize);
       BufferPointer = BufferPointer + RecordSize;
     }
@@ -1250,7 +1252,6 @@ SmbiosCreate64BitTable (
 {
   UINT8                           *BufferPointer;
   UINTN                           RecordSize;
-  UINTN                           NumOfStr;
   EFI_STATUS                      Status;
   EFI_SMBIOS_HANDLE               SmbiosHandle;
   EFI_SMBIOS_PROTOCOL             *SmbiosProtocol;
@@ -1306,7 +1307,7 @@ SmbiosCreate64BitTable (
     Status = GetNextSmbiosRecord (SmbiosProtocol, &CurrentSmbiosEntry, &SmbiosRecord);
 
     if ((Status == EFI_SUCCESS) && (CurrentSmbiosEntry->Smbios64BitTable)) {
-      GetSmbiosStructureSize (SmbiosProtocol, SmbiosRecord, &RecordSize, &NumOfStr);
+      RecordSize = CurrentSmbiosEntry->RecordHeader->RecordSize - sizeof (EFI_SMBIOS_RECORD_HEADER);
       //
       // Record TableMaximumSize
       //
@@ -1376,7 +1377,7 @@ SmbiosCreate64BitTable (
       //
       // This record can be added to 64-bit table
       //
-      GetSmbiosStructureSize (SmbiosProtocol, SmbiosRecord, &RecordSize, &NumOfStr);
+      RecordSize = CurrentSmbiosEntry->RecordHeader->RecordSize - sizeof (EFI_SMBIOS_RECORD_HEADER);
       CopyMem (BufferPointer, SmbiosRecord, RecordSize);
       BufferPointer = BufferPointer + RecordSize;
     }
@@ -1435,6 +1436,83 @@ SmbiosTableConstruction (
   }
 }
 
+/**
+  Append the last SMBIOS record to the Smbios Tables and installs them to the System Table again.
+
+  The tables already hold all the other records in the same order, so the record
+  replaces the End-Of-Table structure, which moves after it. A table is assembled
+  again if it has not been created yet, or if its pages have no room for the record.
+
+  @param  SmbiosEntry         The SMBIOS entry at the tail of the record list.
+
+**/
+VOID
+SmbiosTableAppend (
+  IN EFI_SMBIOS_ENTRY  *SmbiosEntry
+  )
+{
+  UINTN    RecordSize;
+  UINT8    *BufferPointer;
+  BOOLEAN  Smbios32BitTable;
+  BOOLEAN  Smbios64BitTable;
+
+  ASSERT (SmbiosEntry->Link.ForwardLink == &mPrivateData.DataListHead);
+
+  RecordSize       = SmbiosEntry->RecordHeader->RecordSize - sizeof (EFI_SMBIOS_RECORD_HEADER);
+  Smbios32BitTable = FALSE;
+  Smbios64BitTable = FALSE;
+
+  if (SmbiosEntry->Smbios32BitTable) {
+    if ((EntryPointStructure == NULL) || (EntryPointStructure->TableAddress == 0) ||
+        (EFI_SIZE_TO_PAGES ((UINTN)EntryPointStructure->TableLength + RecordSize) > mPreAllocatedPages))
+    {
+      Smbios32BitTable = TRUE;
+    } else {
+      BufferPointer = (UINT8 *)(UINTN)EntryPointStructure->TableAddress + EntryPointStructure->TableLength - sizeof (EFI_SMBIOS_TABLE_END_STRUCTURE);
+      CopyMem (BufferPointer + RecordSize, BufferPointer, sizeof (EFI_SMBIOS_TABLE_END_STRUCTURE));
+      CopyMem (BufferPointer, SmbiosEntry->RecordHeader + 1, RecordSize);
+
+      EntryPointStructure->NumberOfSmbiosStructures++;
+      EntryPointStructure->TableLength = (UINT16)(EntryPointStructure->TableLength + RecordSize);
+      if (RecordSize > EntryPointStructure->MaxStructureSize) {
+        EntryPointStructure->MaxStructureSize = (UINT16)RecordSize;
+      }
+
+      EntryPointStructure->IntermediateChecksum        = 0;
+      EntryPointStructure->EntryPointStructureChecksum = 0;
+
+      EntryPointStructure->IntermediateChecksum =
+        CalculateCheckSum8 ((UINT8 *)EntryPointStructure + 0x10, EntryPointStructure->EntryPointLength - 0x10);
+      EntryPointStructure->EntryPointStructureChecksum =
+        CalculateCheckSum8 ((UINT8 *)EntryPointStructure, EntryPointStructure->EntryPointLength);
+
+      gBS->InstallConfigurationTable (&gEfiSmbiosTableGuid, EntryPointStructure);
+    }
+  }
+
+  if (SmbiosEntry->Smbios64BitTable) {
+    if ((Smbios30EntryPointStructure == NULL) || (Smbios30EntryPointStructure->TableAddress == 0) ||
+        (EFI_SIZE_TO_PAGES ((UINTN)Smbios30EntryPointStructure->TableMaximumSize + RecordSize) > mPre64BitAllocatedPages))
+    {
+      Smbios64BitTable = TRUE;
+    } else {
+      BufferPointer = (UINT8 *)(UINTN)Smbios30EntryPointStructure->TableAddress + Smbios30EntryPointStructure->TableMaximumSize - sizeof (EFI_SMBIOS_TABLE_END_STRUCTURE);
+      CopyMem (BufferPointer + RecordSize, BufferPointer, sizeof (EFI_SMBIOS_TABLE_END_STRUCTURE));
+      CopyMem (BufferPointer, SmbiosEntry->RecordHeader + 1, RecordSize);
+
+      Smbios30EntryPointStructure->TableMaximumSize = (UINT32)(Smbios30EntryPointStructure->TableMaximumSize + RecordSize);
+
+      Smbios30EntryPointStructure->EntryPointStructureChecksum = 0;
+      Smbios30EntryPointStructure->EntryPointStructureChecksum =
+        CalculateCheckSum8 ((UINT8 *)Smbios30EntryPointStructure, Smbios30EntryPointStructure->EntryPointLength);
+
+      gBS->InstallConfigurationTable (&gEfiSmbios3TableGuid, Smbios30EntryPointStructure);
+    }
+  }
+
+  SmbiosTableConstruction (Smbios32BitTable, Smbios64BitTable);
+}
+
 /**
   Validates a SMBIOS 2.0 table entry point.
 
@@ -1766,6 +1844,7 @@ SmbiosDriverEntryPoint (
   )
 {
   EFI_STATUS  Status;
+  UINTN       Index;
 
   mPrivateData.Signature           = SMBIOS_INSTANCE_SIGNATURE;
   mPrivateData.Smbios.Add          = SmbiosAdd;
@@ -1776,7 +1855,10 @@ SmbiosDriverEntryPoint (
   mPrivateData.Smbios.MinorVersion = (UINT8)(PcdGet16 (PcdSmbiosVersion) & 0x00ff);
 
   InitializeListHead (&mPrivateData.DataListHead);
-  InitializeListHead (&mPrivateData.AllocatedHandleListHead);
+  for (Index = 0; Index < SMBIOS_HANDLE_HASH_SIZE; Index++) {
+    InitializeListHead (&mPrivateData.AllocatedHandleListHead[Index]);
+  }
+
   EfiInitializeLock (&mPrivateData.DataLock, TPL_NOTIFY);
 
   //
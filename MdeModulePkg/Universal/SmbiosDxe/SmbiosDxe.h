@@ -26,6 +26,18 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/HobLib.h>
 #include <UniversalPayload/SmbiosTable.h>
 
+//
+// The allocated SMBIOS handles are kept in this many lists, selected by the
+// low bits of the handle, so that a record is found without walking all of them.
+//
+#define SMBIOS_HANDLE_HASH_SIZE  0x100
+#define SMBIOS_HANDLE_HASH(Handle)  ((UINTN)(Handle) & (SMBIOS_HANDLE_HASH_SIZE - 1))
+
+//
+// One bit for each value of EFI_SMBIOS_HANDLE.
+//
+#define SMBIOS_HANDLE_BITMAP_SIZE  ((MAX_UINT16 + 1) / 8)
+
 #define SMBIOS_INSTANCE_SIGNATURE  SIGNATURE_32 ('S', 'B', 'i', 's')
 typedef struct {
   UINT32                 Signature;
@@ -43,9 +55,17 @@ typedef struct {
   //
   LIST_ENTRY             DataListHead;
   //
-  // List of allocated SMBIOS handle.
+  // Lists of allocated SMBIOS handle, indexed by SMBIOS_HANDLE_HASH.
+  //
+  LIST_ENTRY             AllocatedHandleListHead[SMBIOS_HANDLE_HASH_SIZE];
+  //
+  // Bitmap of allocated SMBIOS handle.
+  //
+  UINT8                  AllocatedHandleBitmap[SMBIOS_HANDLE_BITMAP_SIZE];
+  //
+  // No handle below this one is free.
   //
-  LIST_ENTRY             AllocatedHandleListHead;
+  UINTN                  LowestFreeHandle;
 } SMBIOS_INSTANCE;
 
 #define SMBIOS_INSTANCE_FROM_THIS(this)  CR (this, SMBIOS_INSTANCE, Smbios, SMBIOS_INSTANCE_SIGNATURE)
@@ -97,6 +117,10 @@ typedef struct {
   // Filter driver will register what record guid filter should be used.
   //
   EFI_SMBIOS_HANDLE    SmbiosHandle;
+  //
+  // The SMBIOS record that owns the handle.
+  //
+  EFI_SMBIOS_ENTRY     *SmbiosEntry;
 } SMBIOS_HANDLE_ENTRY;
 
 #define SMBIOS_HANDLE_ENTRY_FROM_LINK(link)  CR (link, SMBIOS_HANDLE_ENTRY, Link, SMBIOS_HANDLE_ENTRY_SIGNATURE)
@@ -120,6 +144,17 @@ SmbiosTableConstruction (
   BOOLEAN  Smbios64BitTable
   );
 
+/**
+  Append the last SMBIOS record to the Smbios Tables and installs them to the System Table again.
+
+  @param  SmbiosEntry         The SMBIOS entry at the tail of the record list.
+
+**/
+VOID
+SmbiosTableAppend (
+  IN EFI_SMBIOS_ENTRY  *SmbiosEntry
+  );
+
 /**
   Validates a SMBIOS 3.0 table entry point.
 
@@ -827,6 +827,35 @@ GetVariableNameOrData (
   CopyMem (Buffer, NameOrData, Size);
 }
 
+/**
+  Compute the hash of a variable recorded in the variable index table.
+
+  @param  VendorGuid          The vendor GUID of the variable.
+  @param  NameSize            The size of the name of the variable, including
+                              the null terminator.
+
+  @return The hash of the vendor GUID and the name size.
+
+**/
+UINT8
+GetVariableIndexHash (
+  IN CONST EFI_GUID  *VendorGuid,
+  IN UINTN           NameSize
+  )
+{
+  CONST UINT8  *Bytes;
+  UINTN        Index;
+  UINT8        Hash;
+
+  Bytes = (CONST UINT8 *)VendorGuid;
+  Hash  = (UINT8)NameSize;
+  for (Index = 0; Index < sizeof (EFI_GUID); Index++) {
+    Hash = (UINT8)(((Hash << 1) | (Hash >> 7)) ^ Bytes[Index]);
+  }
+
+  return Hash;
+}
+
 /**
   Find the variable in the specified variable store.
 
@@ -858,6 +887,7 @@ FindVariableEx (
   VARIABLE_STORE_HEADER  *VariableStoreHeader;
   VARIABLE_INDEX_TABLE   *IndexTable;
   VARIABLE_HEADER        *VariableHeader;
+  UINT8                  Hash;
 
   VariableStoreHeader = StoreInfo->VariableStoreHeader;
 
@@ -889,11 +919,21 @@ FindVariableEx (
     //
     // traverse the variable index table to look for varible.
     // The IndexTable->Index[Index] records the distance of two neighbouring VAR_ADDED type variables.
+    // The variables whose IndexTable->Hash[Index] does not match are not read.
     //
+    Hash = 0;
+    if (VariableName[0] != 0) {
+      Hash = GetVariableIndexHash (VendorGuid, StrSize (VariableName));
+    }
+
     for (Offset = 0, Index = 0; Index < IndexTable->Length; Index++) {
       ASSERT (Index < sizeof (IndexTable->Index) / sizeof (IndexTable->Index[0]));
       Offset  += IndexTable->Index[Index];
       MaxIndex = (VARIABLE_HEADER *)((UINT8 *)IndexTable->StartPtr + Offset);
+      if ((VariableName[0] != 0) && (IndexTable->Hash[Index] != Hash)) {
+        continue;
+      }
+
       GetVariableHeader (StoreInfo, MaxIndex, &VariableHeader);
       if (CompareWithValidVariable (StoreInfo, MaxIndex, VariableHeader, VariableName, VendorGuid, PtrTrack) == EFI_SUCCESS) {
         if (VariableHeader->State == (VAR_IN_DELETED_TRANSITION & VAR_ADDED)) {
@@ -918,6 +958,7 @@ FindVariableEx (
     // HOB exists but the variable cannot be found in HOB
     // If not found in HOB, then let's start from the MaxIndex we've found.
     //
+    GetVariableHeader (StoreInfo, MaxIndex, &VariableHeader);
     Variable     = GetNextVariablePtr (StoreInfo, MaxIndex, VariableHeader);
     LastVariable = MaxIndex;
   } else {
@@ -947,6 +988,10 @@ FindVariableEx (
           //
           StopRecord = TRUE;
         } else {
+          IndexTable->Hash[IndexTable->Length]    = GetVariableIndexHash (
+                                                      GetVendorGuidPtr (VariableHeader, StoreInfo->AuthFlag),
+                                                      NameSizeOfVariable (VariableHeader, StoreInfo->AuthFlag)
+                                                      );
           IndexTable->Index[IndexTable->Length++] = (UINT16)Offset;
           LastVariable                            = Variable;
         }
@@ -91,6 +91,8 @@ GetLbaAndOffsetByAddress (
   This function writes a buffer to variable storage space into a firmware
   volume block device. The destination is specified by parameter
   VariableBase. Fault Tolerant Write protocol is used for writing.
+  Only the range of the buffer that differs from the current variable
+  storage content is written.
 
   @param  VariableBase   Base address of variable to write
   @param  VariableBuffer Point to the variable data buffer.
@@ -112,6 +114,10 @@ FtwVariableSpace (
   UINTN                              VarOffset;
   UINTN                              FtwBufferSize;
   EFI_FAULT_TOLERANT_WRITE_PROTOCOL  *FtwProtocol;
+  UINT8                              *FlashBuffer;
+  UINT8                              *WriteBuffer;
+  UINTN                              Start;
+  UINTN                              End;
 
   //
   // Locate fault tolerant write protocol.
@@ -129,28 +135,51 @@ FtwVariableSpace (
     return Status;
   }
 
+  FtwBufferSize = ((VARIABLE_STORE_HEADER *)((UINTN)VariableBase))->Size;
+  ASSERT (FtwBufferSize == VariableBuffer->Size);
+
+  //
+  // A reclaim usually keeps a long run of unchanged variables at the start of
+  // the store and erased space at its end. Skip both so that the FTW write and
+  // the erase cycles it costs are limited to the blocks that really change.
+  //
+  FlashBuffer = (UINT8 *)(UINTN)VariableBase;
+  WriteBuffer = (UINT8 *)VariableBuffer;
+  for (Start = 0; Start < FtwBufferSize; Start++) {
+    if (FlashBuffer[Start] != WriteBuffer[Start]) {
+      break;
+    }
+  }
+
+  if (Start == FtwBufferSize) {
+    return EFI_SUCCESS;
+  }
+
+  for (End = FtwBufferSize; End > Start; End--) {
+    if (FlashBuffer[End - 1] != WriteBuffer[End - 1]) {
+      break;
+    }
+  }
+
   //
   // Get LBA and Offset by address.
   //
-  Status = GetLbaAndOffsetByAddress (VariableBase, &VarLba, &VarOffset);
+  Status = GetLbaAndOffsetByAddress (VariableBase + Start, &VarLba, &VarOffset);
   if (EFI_ERROR (Status)) {
     return EFI_ABORTED;
   }
 
-  FtwBufferSize = ((VARIABLE_STORE_HEADER *)((UINTN)VariableBase))->Size;
-  ASSERT (FtwBufferSize == VariableBuffer->Size);
-
   //
   // FTW write record.
   //
   Status = FtwProtocol->Write (
                           FtwProtocol,
-                          VarLba,                // LBA
-                          VarOffset,             // Offset
-                          FtwBufferSize,         // NumBytes
-                          NULL,                  // PrivateData NULL
-                          FvbHandle,             // Fvb Handle
-                          (VOID *)VariableBuffer // write buffer
+                          VarLba,                       // LBA
+                          VarOffset,                    // Offset
+                          End - Start,                  // NumBytes
+                          NULL,                         // PrivateData NULL
+                          FvbHandle,                    // Fvb Handle
+                          (VOID *)(WriteBuffer + Start) // write buffer
                           );
 
   return Status;
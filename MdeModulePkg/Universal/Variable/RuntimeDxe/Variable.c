@@ -792,6 +792,11 @@ Reclaim (
   }
 
 Done:
+  //
+  // The variable headers have been moved, the store index is rebuilt on the next lookup.
+  //
+  VariableIndexInvalidate (IsVolatile ? VariableStoreHeader : mNvVariableCache);
+
   DoneStatus = EFI_SUCCESS;
   if (IsVolatile || mVariableModuleGlobal->VariableGlobal.EmuNvMode) {
     DoneStatus = SynchronizeRuntimeVariableCache (
@@ -3397,6 +3402,7 @@ FlushHobVariableToFlash (
         *(mVariableModuleGlobal->VariableGlobal.VariableRuntimeCacheContext.HobFlushComplete) = TRUE;
       }
 
+      VariableIndexRegisterStore (VariableStoreTypeHob, NULL);
       if (!AtRuntime ()) {
         FreePool ((VOID *)VariableStoreHeader);
       }
@@ -3796,6 +3802,13 @@ VariableCommonInitialize (
   VolatileVariableStore->Reserved  = 0;
   VolatileVariableStore->Reserved1 = 0;
 
+  //
+  // Index the variable stores to speed up FindVariableEx ().
+  //
+  VariableIndexRegisterStore (VariableStoreTypeVolatile, VolatileVariableStore);
+  VariableIndexRegisterStore (VariableStoreTypeHob, (VARIABLE_STORE_HEADER *)(UINTN)mVariableModuleGlobal->VariableGlobal.HobVariableBase);
+  VariableIndexRegisterStore (VariableStoreTypeNv, mNvVariableCache);
+
   return EFI_SUCCESS;
 }
 
@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 **/
 
 #include "Variable.h"
+#include "VariableParsing.h"
 
 #include <Protocol/VariablePolicy.h>
 #include <Library/VariablePolicyLib.h>
@@ -268,6 +269,15 @@ VariableClassAddressChangeEvent (
   EfiConvertPointer (0x0, (VOID **)&mNvVariableCache);
   EfiConvertPointer (0x0, (VOID **)&mNvFvHeaderCache);
 
+  for (Index = 0; Index < VariableStoreTypeMax; Index++) {
+    if (mVariableStoreIndex[Index].Store != NULL) {
+      EfiConvertPointer (0x0, (VOID **)&mVariableStoreIndex[Index].Store);
+      EfiConvertPointer (0x0, (VOID **)&mVariableStoreIndex[Index].BucketHead);
+      EfiConvertPointer (0x0, (VOID **)&mVariableStoreIndex[Index].BucketTail);
+      EfiConvertPointer (EFI_OPTIONAL_PTR, (VOID **)&mVariableStoreIndex[Index].Entry);
+    }
+  }
+
   if (mAuthContextOut.AddressPointer != NULL) {
     for (Index = 0; Index < mAuthContextOut.AddressPointerCount; Index++) {
       EfiConvertPointer (0x0, (VOID **)mAuthContextOut.AddressPointer[Index]);
@@ -9,6 +9,12 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include "VariableParsing.h"
 
+///
+/// Indexes of the variable stores owned by the variable driver, one slot per
+/// VARIABLE_STORE_TYPE.
+///
+VARIABLE_STORE_INDEX  mVariableStoreIndex[VariableStoreTypeMax];
+
 /**
 
   This code checks if variable header is valid or not.
@@ -445,6 +451,300 @@ VariableCompareTimeStampInternal (
   return (BOOLEAN)(FirstTime->Second <= SecondTime->Second);
 }
 
+/**
+  Computes the index bucket of a variable name and vendor GUID.
+
+  @param[in]  Name              Pointer to the variable name.
+  @param[in]  NameSize          Maximum size in bytes of the variable name.
+  @param[in]  VendorGuid        Pointer to the variable vendor GUID.
+  @param[out] Bucket            Index bucket of the variable.
+
+  @retval TRUE                  The bucket was computed.
+  @retval FALSE                 The name is not NULL terminated within NameSize.
+
+**/
+STATIC
+BOOLEAN
+VariableIndexHash (
+  IN  CHAR16    *Name,
+  IN  UINTN     NameSize,
+  IN  EFI_GUID  *VendorGuid,
+  OUT UINT32    *Bucket
+  )
+{
+  UINT32  Hash;
+  UINT8   *Guid;
+  UINTN   Index;
+
+  //
+  // FNV-1a over the vendor GUID bytes and the name characters.
+  //
+  Hash = 0x811C9DC5;
+  Guid = (UINT8 *)VendorGuid;
+  for (Index = 0; Index < sizeof (EFI_GUID); Index++) {
+    Hash = (Hash ^ Guid[Index]) * 0x01000193;
+  }
+
+  for (Index = 0; Index < NameSize / sizeof (CHAR16); Index++) {
+    if (Name[Index] == 0) {
+      *Bucket = Hash % VARIABLE_INDEX_BUCKET_COUNT;
+      return TRUE;
+    }
+
+    Hash = (Hash ^ Name[Index]) * 0x01000193;
+  }
+
+  return FALSE;
+}
+
+/**
+  Grows the entry array of a variable store index.
+
+  @param[in, out] Index         Pointer to the variable store index.
+
+  @retval TRUE                  The entry array was grown.
+  @retval FALSE                 No memory could be allocated.
+
+**/
+STATIC
+BOOLEAN
+VariableIndexGrow (
+  IN OUT VARIABLE_STORE_INDEX  *Index
+  )
+{
+  VARIABLE_INDEX_ENTRY  *Entry;
+  UINT32                Capacity;
+
+  //
+  // Memory cannot be allocated once ExitBootServices() has been called. The
+  // variables past the end of the index are then found by walking the store.
+  //
+  if (AtRuntime ()) {
+    return FALSE;
+  }
+
+  Capacity = MAX (Index->EntryCapacity * 2, VARIABLE_INDEX_MIN_CAPACITY);
+  Entry    = AllocateRuntimePool (Capacity * sizeof (VARIABLE_INDEX_ENTRY));
+  if (Entry == NULL) {
+    return FALSE;
+  }
+
+  if (Index->Entry != NULL) {
+    CopyMem (Entry, Index->Entry, Index->EntryCount * sizeof (VARIABLE_INDEX_ENTRY));
+    FreePool (Index->Entry);
+  }
+
+  Index->Entry         = Entry;
+  Index->EntryCapacity = Capacity;
+  return TRUE;
+}
+
+/**
+  Gets the index of the variable store searched by a variable pointer track,
+  and adds the variables appended to the store since the last lookup.
+
+  @param[in]  PtrTrack          Variable Track Pointer structure of the search.
+  @param[in]  AuthFormat        TRUE indicates authenticated variables are used.
+                                FALSE indicates authenticated variables are not used.
+
+  @return Pointer to the variable store index, or NULL if the store is not indexed.
+
+**/
+STATIC
+VARIABLE_STORE_INDEX *
+VariableIndexUpdate (
+  IN  VARIABLE_POINTER_TRACK  *PtrTrack,
+  IN  BOOLEAN                 AuthFormat
+  )
+{
+  VARIABLE_STORE_INDEX  *Index;
+  VARIABLE_STORE_TYPE   StoreType;
+  VARIABLE_HEADER       *Variable;
+  VARIABLE_HEADER       *EndPtr;
+  CHAR16                *NamePtr;
+  UINTN                 NameSize;
+  UINT32                Bucket;
+
+  for (StoreType = (VARIABLE_STORE_TYPE)0; StoreType < VariableStoreTypeMax; StoreType++) {
+    Index = &mVariableStoreIndex[StoreType];
+    if ((Index->Store != NULL) &&
+        (PtrTrack->StartPtr == GetStartPointer (Index->Store)) &&
+        (PtrTrack->EndPtr == GetEndPointer (Index->Store)))
+    {
+      break;
+    }
+  }
+
+  if ((StoreType == VariableStoreTypeMax) || Index->Disabled) {
+    return NULL;
+  }
+
+  if (!Index->Valid) {
+    SetMem (Index->BucketHead, VARIABLE_INDEX_BUCKET_COUNT * sizeof (UINT32), 0);
+    Index->EntryCount = 0;
+    Index->IndexedEnd = (UINT32)((UINTN)PtrTrack->StartPtr - (UINTN)Index->Store);
+    Index->Valid      = TRUE;
+  }
+
+  EndPtr   = PtrTrack->EndPtr;
+  Variable = (VARIABLE_HEADER *)((UINTN)Index->Store + Index->IndexedEnd);
+  while (IsValidVariableHeader (Variable, EndPtr)) {
+    if ((Index->EntryCount == Index->EntryCapacity) && !VariableIndexGrow (Index)) {
+      break;
+    }
+
+    NamePtr  = GetVariableNamePtr (Variable, AuthFormat);
+    NameSize = NameSizeOfVariable (Variable, AuthFormat);
+    if (((UINTN)NamePtr > (UINTN)EndPtr) ||
+        (NameSize > (UINTN)EndPtr - (UINTN)NamePtr) ||
+        !VariableIndexHash (NamePtr, NameSize, GetVendorGuidPtr (Variable, AuthFormat), &Bucket))
+    {
+      //
+      // FindVariableEx() matches such a name by prefix, which cannot be hashed.
+      //
+      Index->Disabled = TRUE;
+      return NULL;
+    }
+
+    Index->Entry[Index->EntryCount].Offset = (UINT32)((UINTN)Variable - (UINTN)Index->Store);
+    Index->Entry[Index->EntryCount].Next   = 0;
+    Index->EntryCount++;
+    if (Index->BucketHead[Bucket] == 0) {
+      Index->BucketHead[Bucket] = Index->EntryCount;
+    } else {
+      Index->Entry[Index->BucketTail[Bucket] - 1].Next = Index->EntryCount;
+    }
+
+    Index->BucketTail[Bucket] = Index->EntryCount;
+
+    Variable          = GetNextVariablePtr (Variable, AuthFormat);
+    Index->IndexedEnd = (UINT32)((UINTN)Variable - (UINTN)Index->Store);
+  }
+
+  return Index;
+}
+
+/**
+  Sets the variable store indexed in the given index slot.
+
+  The index is built on the first lookup in the variable store and extended
+  on later lookups with the variables appended to the store since then.
+  A NULL VariableStore releases the slot.
+
+  @param[in]  StoreType         Index slot of the variable store.
+  @param[in]  VariableStore     Pointer to the variable store header, or NULL.
+
+**/
+VOID
+VariableIndexRegisterStore (
+  IN  VARIABLE_STORE_TYPE    StoreType,
+  IN  VARIABLE_STORE_HEADER  *VariableStore OPTIONAL
+  )
+{
+  VARIABLE_STORE_INDEX  *Index;
+
+  ASSERT (StoreType < VariableStoreTypeMax);
+  Index = &mVariableStoreIndex[StoreType];
+
+  if (!AtRuntime ()) {
+    if (Index->BucketHead != NULL) {
+      FreePool (Index->BucketHead);
+    }
+
+    if (Index->Entry != NULL) {
+      FreePool (Index->Entry);
+    }
+  }
+
+  ZeroMem (Index, sizeof (VARIABLE_STORE_INDEX));
+  if ((VariableStore == NULL) || AtRuntime ()) {
+    return;
+  }
+
+  //
+  // The bucket heads and tails share one allocation.
+  //
+  Index->BucketHead = AllocateRuntimeZeroPool (2 * VARIABLE_INDEX_BUCKET_COUNT * sizeof (UINT32));
+  if (Index->BucketHead == NULL) {
+    return;
+  }
+
+  Index->BucketTail = Index->BucketHead + VARIABLE_INDEX_BUCKET_COUNT;
+  Index->Store      = VariableStore;
+}
+
+/**
+  Invalidates the index of a variable store.
+
+  This must be called whenever variable headers of the store are moved or
+  rewritten, for example by a reclaim. Appended variables and variable state
+  changes do not require invalidating the index.
+
+  @param[in]  VariableStore     Pointer to the variable store header.
+
+**/
+VOID
+VariableIndexInvalidate (
+  IN  VARIABLE_STORE_HEADER  *VariableStore
+  )
+{
+  VARIABLE_STORE_TYPE  StoreType;
+
+  for (StoreType = (VARIABLE_STORE_TYPE)0; StoreType < VariableStoreTypeMax; StoreType++) {
+    if (mVariableStoreIndex[StoreType].Store == VariableStore) {
+      mVariableStoreIndex[StoreType].Valid    = FALSE;
+      mVariableStoreIndex[StoreType].Disabled = FALSE;
+    }
+  }
+}
+
+/**
+  Checks if a variable header is a candidate of FindVariableEx().
+
+  @param[in]  VariableName      Name of the variable to be found.
+  @param[in]  VendorGuid        Vendor GUID to be found.
+  @param[in]  IgnoreRtCheck     Ignore EFI_VARIABLE_RUNTIME_ACCESS attribute
+                                check at runtime when searching variable.
+  @param[in]  Variable          Pointer to the variable header.
+  @param[in]  AuthFormat        TRUE indicates authenticated variables are used.
+                                FALSE indicates authenticated variables are not used.
+
+  @retval TRUE                  The variable is added or in deleted transition and matches.
+  @retval FALSE                 The variable does not match.
+
+**/
+STATIC
+BOOLEAN
+IsMatchingVariable (
+  IN  CHAR16           *VariableName,
+  IN  EFI_GUID         *VendorGuid,
+  IN  BOOLEAN          IgnoreRtCheck,
+  IN  VARIABLE_HEADER  *Variable,
+  IN  BOOLEAN          AuthFormat
+  )
+{
+  if ((Variable->State != VAR_ADDED) &&
+      (Variable->State != (VAR_IN_DELETED_TRANSITION & VAR_ADDED)))
+  {
+    return FALSE;
+  }
+
+  if (!IgnoreRtCheck && AtRuntime () && ((Variable->Attributes & EFI_VARIABLE_RUNTIME_ACCESS) == 0)) {
+    return FALSE;
+  }
+
+  if (VariableName[0] == 0) {
+    return TRUE;
+  }
+
+  if (!CompareGuid (VendorGuid, GetVendorGuidPtr (Variable, AuthFormat))) {
+    return FALSE;
+  }
+
+  ASSERT (NameSizeOfVariable (Variable, AuthFormat) != 0);
+  return (BOOLEAN)(CompareMem (VariableName, GetVariableNamePtr (Variable, AuthFormat), NameSizeOfVariable (Variable, AuthFormat)) == 0);
+}
+
 /**
   Find the variable in the specified variable store.
 
@@ -468,8 +768,11 @@ FindVariableEx (
   IN     BOOLEAN                 AuthFormat
   )
 {
-  VARIABLE_HEADER  *InDeletedVariable;
-  VOID             *Point;
+  VARIABLE_HEADER       *InDeletedVariable;
+  VARIABLE_HEADER       *Variable;
+  VARIABLE_STORE_INDEX  *Index;
+  UINT32                Bucket;
+  UINT32                EntryIndex;
 
   PtrTrack->InDeletedTransitionPtr = NULL;
 
@@ -477,39 +780,44 @@ FindVariableEx (
   // Find the variable by walk through HOB, volatile and non-volatile variable store.
   //
   InDeletedVariable = NULL;
+  Variable          = PtrTrack->StartPtr;
+
+  //
+  // If the store is indexed, only visit the indexed variables with the same
+  // hash, then walk the variables past the end of the index.
+  //
+  Index = NULL;
+  if (VariableName[0] != 0) {
+    Index = VariableIndexUpdate (PtrTrack, AuthFormat);
+  }
 
-  for ( PtrTrack->CurrPtr = PtrTrack->StartPtr
+  if ((Index != NULL) && VariableIndexHash (VariableName, MAX_UINTN, VendorGuid, &Bucket)) {
+    for (EntryIndex = Index->BucketHead[Bucket]; EntryIndex != 0; EntryIndex = Index->Entry[EntryIndex - 1].Next) {
+      PtrTrack->CurrPtr = (VARIABLE_HEADER *)((UINTN)Index->Store + Index->Entry[EntryIndex - 1].Offset);
+      if (IsMatchingVariable (VariableName, VendorGuid, IgnoreRtCheck, PtrTrack->CurrPtr, AuthFormat)) {
+        if (PtrTrack->CurrPtr->State == (VAR_IN_DELETED_TRANSITION & VAR_ADDED)) {
+          InDeletedVariable = PtrTrack->CurrPtr;
+        } else {
+          PtrTrack->InDeletedTransitionPtr = InDeletedVariable;
+          return EFI_SUCCESS;
+        }
+      }
+    }
+
+    Variable = (VARIABLE_HEADER *)((UINTN)Index->Store + Index->IndexedEnd);
+  }
+
+  for ( PtrTrack->CurrPtr = Variable
         ; IsValidVariableHeader (PtrTrack->CurrPtr, PtrTrack->EndPtr)
         ; PtrTrack->CurrPtr = GetNextVariablePtr (PtrTrack->CurrPtr, AuthFormat)
         )
   {
-    if ((PtrTrack->CurrPtr->State == VAR_ADDED) ||
-        (PtrTrack->CurrPtr->State == (VAR_IN_DELETED_TRANSITION & VAR_ADDED))
-        )
-    {
-      if (IgnoreRtCheck || !AtRuntime () || ((PtrTrack->CurrPtr->Attributes & EFI_VARIABLE_RUNTIME_ACCESS) != 0)) {
-        if (VariableName[0] == 0) {
-          if (PtrTrack->CurrPtr->State == (VAR_IN_DELETED_TRANSITION & VAR_ADDED)) {
-            InDeletedVariable = PtrTrack->CurrPtr;
-          } else {
-            PtrTrack->InDeletedTransitionPtr = InDeletedVariable;
-            return EFI_SUCCESS;
-          }
-        } else {
-          if (CompareGuid (VendorGuid, GetVendorGuidPtr (PtrTrack->CurrPtr, AuthFormat))) {
-            Point = (VOID *)GetVariableNamePtr (PtrTrack->CurrPtr, AuthFormat);
-
-            ASSERT (NameSizeOfVariable (PtrTrack->CurrPtr, AuthFormat) != 0);
-            if (CompareMem (VariableName, Point, NameSizeOfVariable (PtrTrack->CurrPtr, AuthFormat)) == 0) {
-              if (PtrTrack->CurrPtr->State == (VAR_IN_DELETED_TRANSITION & VAR_ADDED)) {
-                InDeletedVariable = PtrTrack->CurrPtr;
-              } else {
-                PtrTrack->InDeletedTransitionPtr = InDeletedVariable;
-                return EFI_SUCCESS;
-              }
-            }
-          }
-        }
+    if (IsMatchingVariable (VariableName, VendorGuid, IgnoreRtCheck, PtrTrack->CurrPtr, AuthFormat)) {
+      if (PtrTrack->CurrPtr->State == (VAR_IN_DELETED_TRANSITION & VAR_ADDED)) {
+        InDeletedVariable = PtrTrack->CurrPtr;
+      } else {
+        PtrTrack->InDeletedTransitionPtr = InDeletedVariable;
+        return EFI_SUCCESS;
       }
     }
   }
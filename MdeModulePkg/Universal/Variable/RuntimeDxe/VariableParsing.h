@@ -13,6 +13,59 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Guid/ImageAuthentication.h>
 #include "Variable.h"
 
+///
+/// Number of hash buckets of a variable store index.
+///
+#define VARIABLE_INDEX_BUCKET_COUNT  512
+
+///
+/// Minimum number of entries allocated for a variable store index.
+///
+#define VARIABLE_INDEX_MIN_CAPACITY  64
+
+typedef struct {
+  ///
+  /// Offset of the variable header from the start of the variable store.
+  ///
+  UINT32    Offset;
+  ///
+  /// Index + 1 of the next entry in the same bucket, 0 terminates the list.
+  ///
+  UINT32    Next;
+} VARIABLE_INDEX_ENTRY;
+
+///
+/// Hash index over the variable headers of a variable store, keyed by
+/// variable name and vendor GUID. The entries of a bucket are kept in
+/// the order of the variable headers in the store so that searching the
+/// index gives the same result as walking the store.
+///
+typedef struct {
+  ///
+  /// Indexed variable store, NULL if the slot is not used.
+  ///
+  VARIABLE_STORE_HEADER    *Store;
+  UINT32                   *BucketHead;
+  UINT32                   *BucketTail;
+  VARIABLE_INDEX_ENTRY     *Entry;
+  UINT32                   EntryCount;
+  UINT32                   EntryCapacity;
+  ///
+  /// Offset of the first variable header not covered by the index yet.
+  ///
+  UINT32                   IndexedEnd;
+  ///
+  /// FALSE if the index must be rebuilt before it is used again.
+  ///
+  BOOLEAN                  Valid;
+  ///
+  /// TRUE if the store holds a variable name the index cannot hash.
+  ///
+  BOOLEAN                  Disabled;
+} VARIABLE_STORE_INDEX;
+
+extern VARIABLE_STORE_INDEX  mVariableStoreIndex[VariableStoreTypeMax];
+
 /**
 
   This code checks if variable header is valid or not.
@@ -344,4 +397,36 @@ UpdateVariableInfo (
   IN OUT VARIABLE_INFO_ENTRY  **VariableInfo
   );
 
+/**
+  Sets the variable store indexed in the given index slot.
+
+  The index is built on the first lookup in the variable store and extended
+  on later lookups with the variables appended to the store since then.
+  A NULL VariableStore releases the slot.
+
+  @param[in]  StoreType         Index slot of the variable store.
+  @param[in]  VariableStore     Pointer to the variable store header, or NULL.
+
+**/
+VOID
+VariableIndexRegisterStore (
+  IN  VARIABLE_STORE_TYPE    StoreType,
+  IN  VARIABLE_STORE_HEADER  *VariableStore OPTIONAL
+  );
+
+/**
+  Invalidates the index of a variable store.
+
+  This must be called whenever variable headers of the store are moved or
+  rewritten, for example by a reclaim. Appended variables and variable state
+  changes do not require invalidating the index.
+
+  @param[in]  VariableStore     Pointer to the variable store header.
+
+**/
+VOID
+VariableIndexInvalidate (
+  IN  VARIABLE_STORE_HEADER  *VariableStore
+  );
+
 #endif
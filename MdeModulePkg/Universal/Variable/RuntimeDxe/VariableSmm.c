@@ -424,6 +424,78 @@ SmmVariableGetStatistics (
   return EFI_SUCCESS;
 }
 
+/**
+  Get a batch of variables for the variable wrapper driver.
+
+  Caution: This function may receive untrusted input.
+  The batch is external input, so every entry is validated against the payload
+  before it is consumed.
+
+  @param[in, out] Batch        The batch copied into the SMM variable buffer payload.
+  @param[in]      PayloadSize  The size of the batch, including all its entries.
+
+  @retval EFI_SUCCESS          Every entry was processed, its own status is in the entry.
+  @retval EFI_ACCESS_DENIED    An entry is malformed or exceeds the payload.
+
+**/
+STATIC
+EFI_STATUS
+SmmGetVariableBatch (
+  IN OUT SMM_VARIABLE_COMMUNICATE_GET_VARIABLE_BATCH  *Batch,
+  IN     UINTN                                        PayloadSize
+  )
+{
+  SMM_VARIABLE_COMMUNICATE_BATCH_ENTRY  *Entry;
+  UINTN                                 Remaining;
+  UINTN                                 Index;
+
+  Entry     = (SMM_VARIABLE_COMMUNICATE_BATCH_ENTRY *)(Batch + 1);
+  Remaining = PayloadSize - sizeof (*Batch);
+
+  for (Index = 0; Index < Batch->EntryCount; Index++) {
+    if ((Remaining < OFFSET_OF (SMM_VARIABLE_COMMUNICATE_BATCH_ENTRY, Access.Name)) ||
+        (Entry->EntrySize < OFFSET_OF (SMM_VARIABLE_COMMUNICATE_BATCH_ENTRY, Access.Name)) ||
+        (Entry->EntrySize > Remaining) ||
+        ((Entry->EntrySize % sizeof (UINTN)) != 0))
+    {
+      return EFI_ACCESS_DENIED;
+    }
+
+    //
+    // Prevent overflow, the name and the data must both fit in the entry.
+    //
+    if ((Entry->Access.NameSize > Entry->EntrySize) ||
+        (Entry->Access.DataSize > Entry->EntrySize) ||
+        (OFFSET_OF (SMM_VARIABLE_COMMUNICATE_BATCH_ENTRY, Access.Name) + Entry->Access.NameSize + Entry->Access.DataSize > Entry->EntrySize))
+    {
+      return EFI_ACCESS_DENIED;
+    }
+
+    //
+    // The VariableSpeculationBarrier() call here is to ensure the previous
+    // range/content checks for the entry have been completed before the
+    // subsequent consumption of the entry content.
+    //
+    VariableSpeculationBarrier ();
+    if ((Entry->Access.NameSize < sizeof (CHAR16)) || (Entry->Access.Name[Entry->Access.NameSize/sizeof (CHAR16) - 1] != L'\0')) {
+      return EFI_ACCESS_DENIED;
+    }
+
+    Entry->Status = VariableServiceGetVariable (
+                      Entry->Access.Name,
+                      &Entry->Access.Guid,
+                      &Entry->Access.Attributes,
+                      &Entry->Access.DataSize,
+                      (UINT8 *)Entry->Access.Name + Entry->Access.NameSize
+                      );
+
+    Remaining -= Entry->EntrySize;
+    Entry      = (SMM_VARIABLE_COMMUNICATE_BATCH_ENTRY *)((UINT8 *)Entry + Entry->EntrySize);
+  }
+
+  return EFI_SUCCESS;
+}
+
 /**
   Communication service SMI Handler entry.
 
@@ -986,6 +1058,28 @@ SmmVariableHandler (
       Status = EFI_SUCCESS;
       break;
 
+    case SMM_VARIABLE_FUNCTION_GET_VARIABLE_BATCH:
+      if (CommBufferPayloadSize < sizeof (SMM_VARIABLE_COMMUNICATE_GET_VARIABLE_BATCH)) {
+        DEBUG ((DEBUG_ERROR, "GetVariableBatch: SMM communication buffer size invalid!\n"));
+        return EFI_SUCCESS;
+      }
+
+      //
+      // Copy the input communicate buffer payload to pre-allocated SMM variable buffer payload.
+      //
+      CopyMem (mVariableBufferPayload, SmmVariableFunctionHeader->Data, CommBufferPayloadSize);
+      Status = SmmGetVariableBatch (
+                 (SMM_VARIABLE_COMMUNICATE_GET_VARIABLE_BATCH *)mVariableBufferPayload,
+                 CommBufferPayloadSize
+                 );
+      if (EFI_ERROR (Status)) {
+        DEBUG ((DEBUG_ERROR, "GetVariableBatch: Entry exceeds communication buffer size limit!\n"));
+        goto EXIT;
+      }
+
+      CopyMem (SmmVariableFunctionHeader->Data, mVariableBufferPayload, CommBufferPayloadSize);
+      break;
+
     default:
       Status = EFI_UNSUPPORTED;
   }
@@ -25,6 +25,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Protocol/SmmVariable.h>
 #include <Protocol/VariableLock.h>
 #include <Protocol/VarCheck.h>
+#include <Protocol/VariableBatch.h>
 
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/UefiRuntimeServicesTableLib.h>
@@ -57,6 +58,7 @@ BOOLEAN                         mVariableAuthFormat;
 EFI_LOCK                        mVariableServicesLock;
 EDKII_VARIABLE_LOCK_PROTOCOL    mVariableLock;
 EDKII_VAR_CHECK_PROTOCOL        mVarCheck;
+EDKII_VARIABLE_BATCH_PROTOCOL   mVariableBatch;
 VARIABLE_RUNTIME_CACHE_INFO     mVariableRtCacheInfo;
 BOOLEAN                         mIsRuntimeCacheEnabled = FALSE;
 
@@ -805,6 +807,203 @@ RuntimeServiceGetVariable (
   return Status;
 }
 
+/**
+  Finds a batch of variables in SMM, packing as many requests into each SMI as
+  the communicate buffer payload allows.
+
+  Requests whose Status is not EFI_NOT_READY on input are skipped. A request
+  that does not fit in an empty communicate buffer is sent on its own through
+  FindVariableInSmm (), which trims its data buffer to the payload limit.
+
+  @param[in]      RequestCount  The number of entries in Requests.
+  @param[in, out] Requests      The requests to process.
+
+**/
+VOID
+FindVariableBatchInSmm (
+  IN     UINTN                         RequestCount,
+  IN OUT EDKII_VARIABLE_BATCH_REQUEST  *Requests
+  )
+{
+  EFI_STATUS                                   Status;
+  SMM_VARIABLE_COMMUNICATE_GET_VARIABLE_BATCH  *Batch;
+  SMM_VARIABLE_COMMUNICATE_BATCH_ENTRY         *Entry;
+  EDKII_VARIABLE_BATCH_REQUEST                 *Request;
+  UINTN                                        PayloadSize;
+  UINTN                                        EntrySize;
+  UINTN                                        NameSize;
+  UINTN                                        First;
+  UINTN                                        Index;
+
+  First = 0;
+  while (First < RequestCount) {
+    Status = InitCommunicateBuffer ((VOID **)&Batch, sizeof (*Batch), SMM_VARIABLE_FUNCTION_GET_VARIABLE_BATCH);
+    if (EFI_ERROR (Status)) {
+      for ( ; First < RequestCount; First++) {
+        if (Requests[First].Status == EFI_NOT_READY) {
+          Requests[First].Status = Status;
+        }
+      }
+
+      return;
+    }
+
+    Batch->EntryCount = 0;
+    PayloadSize       = sizeof (*Batch);
+    Entry             = (SMM_VARIABLE_COMMUNICATE_BATCH_ENTRY *)(Batch + 1);
+
+    for (Index = First; Index < RequestCount; Index++) {
+      Request = &Requests[Index];
+      if (Request->Status != EFI_NOT_READY) {
+        continue;
+      }
+
+      NameSize = StrSize (Request->VariableName);
+      if ((NameSize > mVariableBufferPayloadSize) ||
+          (Request->DataSize > mVariableBufferPayloadSize - NameSize))
+      {
+        break;
+      }
+
+      EntrySize = ALIGN_VALUE (
+                    OFFSET_OF (SMM_VARIABLE_COMMUNICATE_BATCH_ENTRY, Access.Name) + NameSize + Request->DataSize,
+                    sizeof (UINTN)
+                    );
+      if (EntrySize > mVariableBufferPayloadSize - PayloadSize) {
+        break;
+      }
+
+      Entry->EntrySize         = EntrySize;
+      Entry->Status            = EFI_NOT_READY;
+      Entry->Access.DataSize   = Request->DataSize;
+      Entry->Access.NameSize   = NameSize;
+      Entry->Access.Attributes = 0;
+      CopyGuid (&Entry->Access.Guid, Request->VendorGuid);
+      CopyMem (Entry->Access.Name, Request->VariableName, NameSize);
+
+      Batch->EntryCount++;
+      PayloadSize += EntrySize;
+      Entry        = (SMM_VARIABLE_COMMUNICATE_BATCH_ENTRY *)((UINT8 *)Entry + EntrySize);
+    }
+
+    if (Batch->EntryCount == 0) {
+      if (Index < RequestCount) {
+        Request         = &Requests[Index];
+        Request->Status = FindVariableInSmm (
+                            Request->VariableName,
+                            Request->VendorGuid,
+                            &Request->Attributes,
+                            &Request->DataSize,
+                            Request->Data
+                            );
+        Index++;
+      }
+
+      First = Index;
+      continue;
+    }
+
+    //
+    // Re-init the communicate buffer with the final payload size, the entries are kept.
+    //
+    InitCommunicateBuffer ((VOID **)&Batch, PayloadSize, SMM_VARIABLE_FUNCTION_GET_VARIABLE_BATCH);
+    Status = SendCommunicateBuffer (PayloadSize);
+
+    Entry = (SMM_VARIABLE_COMMUNICATE_BATCH_ENTRY *)(Batch + 1);
+    for ( ; First < Index; First++) {
+      Request = &Requests[First];
+      if (Request->Status != EFI_NOT_READY) {
+        continue;
+      }
+
+      if (EFI_ERROR (Status)) {
+        Request->Status = Status;
+        continue;
+      }
+
+      Request->Status     = Entry->Status;
+      Request->Attributes = Entry->Access.Attributes;
+      if ((Entry->Status == EFI_SUCCESS) || (Entry->Status == EFI_BUFFER_TOO_SMALL)) {
+        Request->DataSize = Entry->Access.DataSize;
+      }
+
+      if (Entry->Status == EFI_SUCCESS) {
+        if (Request->Data != NULL) {
+          CopyMem (Request->Data, (UINT8 *)Entry->Access.Name + Entry->Access.NameSize, Entry->Access.DataSize);
+        } else {
+          Request->Status = EFI_INVALID_PARAMETER;
+        }
+      }
+
+      Entry = (SMM_VARIABLE_COMMUNICATE_BATCH_ENTRY *)((UINT8 *)Entry + Entry->EntrySize);
+    }
+  }
+}
+
+/**
+  Read a batch of variables.
+
+  With the runtime cache enabled every request is served from the cache, otherwise
+  the requests are packed into as few SMIs as the communicate buffer allows.
+
+  @param[in]      This          The EDKII_VARIABLE_BATCH_PROTOCOL instance.
+  @param[in]      RequestCount  The number of entries in Requests.
+  @param[in, out] Requests      The requests to process.
+
+  @retval EFI_SUCCESS           All requests were processed, the result of each
+                                request is in its Status field.
+  @retval EFI_INVALID_PARAMETER Requests is NULL and RequestCount is not 0.
+
+**/
+EFI_STATUS
+EFIAPI
+VariableBatchGetVariables (
+  IN     EDKII_VARIABLE_BATCH_PROTOCOL  *This,
+  IN     UINTN                          RequestCount,
+  IN OUT EDKII_VARIABLE_BATCH_REQUEST   *Requests
+  )
+{
+  UINTN                         Index;
+  EDKII_VARIABLE_BATCH_REQUEST  *Request;
+
+  if ((Requests == NULL) && (RequestCount != 0)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  for (Index = 0; Index < RequestCount; Index++) {
+    Request = &Requests[Index];
+    if ((Request->VariableName == NULL) || (Request->VendorGuid == NULL)) {
+      Request->Status = EFI_INVALID_PARAMETER;
+    } else if (Request->VariableName[0] == 0) {
+      Request->Status = EFI_NOT_FOUND;
+    } else {
+      Request->Status = EFI_NOT_READY;
+    }
+  }
+
+  AcquireLockOnlyAtBootTime (&mVariableServicesLock);
+  if (mIsRuntimeCacheEnabled) {
+    for (Index = 0; Index < RequestCount; Index++) {
+      Request = &Requests[Index];
+      if (Request->Status == EFI_NOT_READY) {
+        Request->Status = FindVariableInRuntimeCache (
+                            Request->VariableName,
+                            Request->VendorGuid,
+                            &Request->Attributes,
+                            &Request->DataSize,
+                            Request->Data
+                            );
+      }
+    }
+  } else {
+    FindVariableBatchInSmm (RequestCount, Requests);
+  }
+
+  ReleaseLockOnlyAtBootTime (&mVariableServicesLock);
+
+  return EFI_SUCCESS;
+}
+
 /**
   Finds the next available variable in a runtime cache variable store.
 
@@ -1752,6 +1951,15 @@ SmmVariableReady (
                                                      );
   ASSERT_EFI_ERROR (Status);
 
+  mVariableBatch.GetVariables = VariableBatchGetVariables;
+  Status                      = gBS->InstallMultipleProtocolInterfaces (
+                                       &mHandle,
+                                       &gEdkiiVariableBatchProtocolGuid,
+                                       &mVariableBatch,
+                                       NULL
+                                       );
+  ASSERT_EFI_ERROR (Status);
+
   gBS->CloseEvent (Event);
 }
 
@@ -0,0 +1,50 @@
+/** @file
+  GUID and data structure of the HOB list index configuration table.
+
+  The DXE Core may install an index of the GUID HOBs of the HOB list into the
+  EFI System Table's Configuration Table. It maps every GUID that is used by a
+  GUID HOB to the first GUID HOB with that GUID, so the HOB library can find a
+  GUID HOB without walking the HOB list. The HOB list does not change in DXE,
+  so the index stays valid.
+
+  Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef HOB_LIST_INDEX_GUID_H_
+#define HOB_LIST_INDEX_GUID_H_
+
+#define EDKII_HOB_LIST_INDEX_GUID \
+  { \
+    0x6e9fa9b3, 0x48a4, 0x46da, { 0xb3, 0xf1, 0x4c, 0x5f, 0x6f, 0x9a, 0x8f, 0x56 } \
+  }
+
+typedef struct {
+  EFI_GUID             Name;
+  ///
+  /// The first GUID HOB with the GUID Name in the HOB list.
+  ///
+  EFI_HOB_GUID_TYPE    *FirstHob;
+} EDKII_HOB_LIST_INDEX_ENTRY;
+
+typedef struct {
+  ///
+  /// The first HOB of the HOB list that is indexed.
+  ///
+  VOID                          *HobList;
+  ///
+  /// The end of HOB list HOB of the HOB list that is indexed.
+  ///
+  VOID                          *EndOfHobList;
+  UINTN                         EntryCount;
+  ///
+  /// The entries, sorted by Name in the byte order of CompareMem(), with one
+  /// entry per GUID.
+  ///
+  EDKII_HOB_LIST_INDEX_ENTRY    Entry[1];
+} EDKII_HOB_LIST_INDEX;
+
+extern EFI_GUID  gEdkiiHobListIndexGuid;
+
+#endif
@@ -134,6 +134,20 @@
 ///
 #define HTTP_HEADER_CONTENT_LENGTH  "Content-Length"
 
+///
+/// Range Request Header
+/// The Range request-header field requests only part of the entity, as one or more
+/// byte ranges, e.g. "bytes=0-499".
+///
+#define HTTP_HEADER_RANGE  "Range"
+
+///
+/// Content-Range Header
+/// The Content-Range entity-header field is sent with a partial entity-body to specify
+/// where in the full entity-body the partial body should be applied, e.g. "bytes 0-499/1234".
+///
+#define HTTP_HEADER_CONTENT_RANGE  "Content-Range"
+
 ///
 /// Transfer-Encoding Header
 /// The Transfer-Encoding general-header field indicates what (if any) type of transformation
@@ -227,6 +241,14 @@
 ///
 #define HTTP_HEADER_ETAG  "ETag"
 
+///
+/// Cache-Control General Header
+/// The Cache-Control general-header field is used to specify directives
+/// that MUST be obeyed by all caching mechanisms along the request/response
+/// chain, such as "no-store" and "no-cache".
+///
+#define HTTP_HEADER_CACHE_CONTROL  "Cache-Control"
+
 ///
 /// Custom header field checked by the iLO web server to
 /// specify a client session key.
@@ -8,6 +8,81 @@
 
 #include "BaseLibInternals.h"
 
+//
+// Partitions of up to this number of elements are sorted with an insertion sort.
+//
+#define QUICK_SORT_INSERTION_SORT_THRESHOLD  8
+
+/**
+  Swap two elements of the buffer to sort.
+
+  @param[in, out] Element1          The first element.
+  @param[in, out] Element2          The second element.
+  @param[in]      ElementSize       Size of an element in bytes.
+  @param[out]     BufferOneElement  Buffer whose size equals to ElementSize.
+**/
+VOID
+InternalQuickSortSwap (
+  IN OUT VOID         *Element1,
+  IN OUT VOID         *Element2,
+  IN     CONST UINTN  ElementSize,
+  OUT    VOID         *BufferOneElement
+  )
+{
+  if (Element1 == Element2) {
+    return;
+  }
+
+  CopyMem (BufferOneElement, Element1, ElementSize);
+  CopyMem (Element1, Element2, ElementSize);
+  CopyMem (Element2, BufferOneElement, ElementSize);
+}
+
+/**
+  Sort a small buffer with an insertion sort.
+
+  @param[in, out] BufferToSort      On call a Buffer of (possibly sorted) elements,
+                                    on return a buffer of sorted elements.
+  @param[in]      Count             The number of elements in the buffer to sort.
+  @param[in]      ElementSize       Size of an element in bytes.
+  @param[in]      CompareFunction   The function to call to perform the comparison
+                                    of any 2 elements.
+  @param[out]     BufferOneElement  Buffer whose size equals to ElementSize.
+**/
+VOID
+InternalInsertionSort (
+  IN OUT VOID                 *BufferToSort,
+  IN CONST UINTN              Count,
+  IN CONST UINTN              ElementSize,
+  IN       BASE_SORT_COMPARE  CompareFunction,
+  OUT VOID                    *BufferOneElement
+  )
+{
+  UINT8  *Buffer;
+  UINTN  Index;
+  UINTN  Target;
+
+  Buffer = (UINT8 *)BufferToSort;
+  for (Index = 1; Index < Count; Index++) {
+    if (CompareFunction (Buffer + (Index - 1) * ElementSize, Buffer + Index * ElementSize) <= 0) {
+      continue;
+    }
+
+    //
+    // Find where the element goes in the sorted elements before it, then move
+    // the greater elements up by one to make room for it.
+    //
+    CopyMem (BufferOneElement, Buffer + Index * ElementSize, ElementSize);
+    Target = Index - 1;
+    while ((Target > 0) && (CompareFunction (Buffer + (Target - 1) * ElementSize, BufferOneElement) > 0)) {
+      Target--;
+    }
+
+    CopyMem (Buffer + (Target + 1) * ElementSize, Buffer + Target * ElementSize, (Index - Target) * ElementSize);
+    CopyMem (Buffer + Target * ElementSize, BufferOneElement, ElementSize);
+  }
+}
+
 /**
   This function is identical to perform QuickSort,
   except that is uses the pre-allocated buffer so the in place sorting does not need to
@@ -41,77 +116,92 @@ QuickSort (
   OUT VOID                    *BufferOneElement
   )
 {
-  VOID   *Pivot;
-  UINTN  LoopCount;
-  UINTN  NextSwapLocation;
+  UINT8  *Buffer;
+  UINTN  Remaining;
+  UINTN  Left;
+  UINTN  Right;
+  UINT8  *First;
+  UINT8  *Middle;
+  UINT8  *Last;
 
   ASSERT (BufferToSort     != NULL);
   ASSERT (CompareFunction  != NULL);
   ASSERT (BufferOneElement != NULL);
   ASSERT (ElementSize      >= 1);
 
-  if (Count < 2) {
-    return;
-  }
-
-  NextSwapLocation = 0;
+  Buffer    = (UINT8 *)BufferToSort;
+  Remaining = Count;
 
   //
-  // pick a pivot (we choose last element)
+  // Only the smaller partition is sorted by recursion, the larger one is sorted
+  // by the next iteration, so that the recursion depth is at most log2(Count).
   //
-  Pivot = ((UINT8 *)BufferToSort + ((Count - 1) * ElementSize));
+  while (Remaining > QUICK_SORT_INSERTION_SORT_THRESHOLD) {
+    //
+    // Pick the median of the first, middle and last elements as the pivot, so
+    // that sorted and reverse sorted buffers are split evenly. Order the three
+    // elements, then move the pivot to the first position. The last element is
+    // then not less than the pivot, which bounds the scan from the left below.
+    //
+    First  = Buffer;
+    Middle = Buffer + (Remaining / 2) * ElementSize;
+    Last   = Buffer + (Remaining - 1) * ElementSize;
+    if (CompareFunction (First, Middle) > 0) {
+      InternalQuickSortSwap (First, Middle, ElementSize, BufferOneElement);
+    }
+
+    if (CompareFunction (Middle, Last) > 0) {
+      InternalQuickSortSwap (Middle, Last, ElementSize, BufferOneElement);
+      if (CompareFunction (First, Middle) > 0) {
+        InternalQuickSortSwap (First, Middle, ElementSize, BufferOneElement);
+      }
+    }
+
+    InternalQuickSortSwap (First, Middle, ElementSize, BufferOneElement);
 
-  //
-  // Now get the pivot such that all on "left" are below it
-  // and everything "right" are above it
-  //
-  for (LoopCount = 0; LoopCount < Count -1; LoopCount++) {
     //
-    // if the element is less than or equal to the pivot
+    // Now get the pivot such that all on "left" are not above it and
+    // everything on "right" are not below it. The elements equal to the pivot
+    // stop both scans, so that they are spread over both sides.
     //
-    if (CompareFunction ((VOID *)((UINT8 *)BufferToSort + ((LoopCount) * ElementSize)), Pivot) <= 0) {
-      //
-      // swap
-      //
-      CopyMem (BufferOneElement, (UINT8 *)BufferToSort + (NextSwapLocation * ElementSize), ElementSize);
-      CopyMem ((UINT8 *)BufferToSort + (NextSwapLocation * ElementSize), (UINT8 *)BufferToSort + ((LoopCount) * ElementSize), ElementSize);
-      CopyMem ((UINT8 *)BufferToSort + ((LoopCount)*ElementSize), BufferOneElement, ElementSize);
-
-      //
-      // increment NextSwapLocation
-      //
-      NextSwapLocation++;
+    Left  = 0;
+    Right = Remaining;
+    while (TRUE) {
+      do {
+        Left++;
+      } while (CompareFunction (Buffer + Left * ElementSize, First) < 0);
+
+      do {
+        Right--;
+      } while (CompareFunction (Buffer + Right * ElementSize, First) > 0);
+
+      if (Left >= Right) {
+        break;
+      }
+
+      InternalQuickSortSwap (Buffer + Left * ElementSize, Buffer + Right * ElementSize, ElementSize, BufferOneElement);
     }
-  }
 
-  //
-  // swap pivot to it's final position (NextSwapLocation)
-  //
-  CopyMem (BufferOneElement, Pivot, ElementSize);
-  CopyMem (Pivot, (UINT8 *)BufferToSort + (NextSwapLocation * ElementSize), ElementSize);
-  CopyMem ((UINT8 *)BufferToSort + (NextSwapLocation * ElementSize), BufferOneElement, ElementSize);
+    //
+    // swap pivot to it's final position (Right)
+    //
+    InternalQuickSortSwap (First, Buffer + Right * ElementSize, ElementSize, BufferOneElement);
 
-  //
-  // Now recurse on 2 partial lists.  neither of these will have the 'pivot' element
-  // IE list is sorted left half, pivot element, sorted right half...
-  //
-  if (NextSwapLocation >= 2) {
-    QuickSort (
-      BufferToSort,
-      NextSwapLocation,
-      ElementSize,
-      CompareFunction,
-      BufferOneElement
-      );
+    //
+    // Now sort the 2 partial lists. Neither of them has the 'pivot' element
+    // IE list is sorted left half, pivot element, sorted right half...
+    //
+    if (Right < Remaining - Right - 1) {
+      QuickSort (Buffer, Right, ElementSize, CompareFunction, BufferOneElement);
+      Buffer    += (Right + 1) * ElementSize;
+      Remaining -= Right + 1;
+    } else {
+      QuickSort (Buffer + (Right + 1) * ElementSize, Remaining - Right - 1, ElementSize, CompareFunction, BufferOneElement);
+      Remaining = Right;
+    }
   }
 
-  if ((Count - NextSwapLocation - 1) >= 2) {
-    QuickSort (
-      (UINT8 *)BufferToSort + (NextSwapLocation + 1) * ElementSize,
-      Count - NextSwapLocation - 1,
-      ElementSize,
-      CompareFunction,
-      BufferOneElement
-      );
+  if (Remaining >= 2) {
+    InternalInsertionSort (Buffer, Remaining, ElementSize, CompareFunction, BufferOneElement);
   }
 }
@@ -121,7 +121,8 @@ StrnLenS (
   IN UINTN         MaxSize
   )
 {
-  UINTN  Length;
+  UINTN         ScanSize;
+  CONST CHAR16  *Terminator;
 
   ASSERT (((UINTN)String & BIT0) == 0);
 
@@ -138,16 +139,21 @@ StrnLenS (
   // String then StrnLenS returns MaxSize. At most the first MaxSize characters of String shall
   // be accessed by StrnLenS.
   //
-  Length = 0;
-  while (String[Length] != 0) {
-    if (Length >= MaxSize - 1) {
-      return MaxSize;
-    }
+  // The null character is searched with ScanMem16(), so that the BaseMemoryLib
+  // instance optimized for the CPU does the scan. The scan stops at the end of
+  // the address space, which a string cannot cross.
+  //
+  ScanSize = MaxSize;
+  if (ScanSize > (MAX_ADDRESS - (UINTN)String) / sizeof (CHAR16) + 1) {
+    ScanSize = (MAX_ADDRESS - (UINTN)String) / sizeof (CHAR16) + 1;
+  }
 
-    Length++;
+  Terminator = ScanMem16 (String, ScanSize * sizeof (CHAR16), 0);
+  if (Terminator == NULL) {
+    return MaxSize;
   }
 
-  return Length;
+  return (UINTN)(Terminator - String);
 }
 
 /**
@@ -1698,7 +1704,8 @@ AsciiStrnLenS (
   IN UINTN        MaxSize
   )
 {
-  UINTN  Length;
+  UINTN        ScanSize;
+  CONST CHAR8  *Terminator;
 
   //
   // If String is a null pointer or MaxSize is 0, then the AsciiStrnLenS function returns zero.
@@ -1713,16 +1720,21 @@ AsciiStrnLenS (
   // String then AsciiStrnLenS returns MaxSize. At most the first MaxSize characters of String shall
   // be accessed by AsciiStrnLenS.
   //
-  Length = 0;
-  while (String[Length] != 0) {
-    if (Length >= MaxSize - 1) {
-      return MaxSize;
-    }
+  // The null character is searched with ScanMem8(), so that the BaseMemoryLib
+  // instance optimized for the CPU does the scan. The scan stops at the end of
+  // the address space, which a string cannot cross.
+  //
+  ScanSize = MaxSize;
+  if (ScanSize > (MAX_ADDRESS - (UINTN)String) / sizeof (CHAR8) + 1) {
+    ScanSize = (MAX_ADDRESS - (UINTN)String) / sizeof (CHAR8) + 1;
+  }
 
-    Length++;
+  Terminator = ScanMem8 (String, ScanSize * sizeof (CHAR8), 0);
+  if (Terminator == NULL) {
+    return MaxSize;
   }
 
-  return Length;
+  return (UINTN)(Terminator - String);
 }
 
 /**
@@ -975,6 +975,7 @@ PeCoffLoaderRelocateImage (
   PHYSICAL_ADDRESS                     BaseAddress;
   UINT32                               NumberOfRvaAndSizes;
   UINT32                               TeStrippedOffset;
+  BOOLEAN                              CheckEachFixup;
 
   ASSERT (ImageContext != NULL);
 
@@ -1109,14 +1110,25 @@ PeCoffLoaderRelocateImage (
         return RETURN_LOAD_ERROR;
       }
 
+      //
+      // The offset of a fixup in the block is at most 0xFFF. If the end of
+      // the 4 KB page of the block is in the image, so are all its fixups,
+      // and they need not be checked one by one.
+      //
+      CheckEachFixup = (BOOLEAN)((UINT64)RelocBase->VirtualAddress + 0xFFF >= ImageContext->ImageSize + TeStrippedOffset);
+
       //
       // Run this relocation record
       //
       while ((UINTN)Reloc < (UINTN)RelocEnd) {
-        Fixup = PeCoffLoaderImageAddress (ImageContext, RelocBase->VirtualAddress + (*Reloc & 0xFFF), TeStrippedOffset);
-        if (Fixup == NULL) {
-          ImageContext->ImageError = IMAGE_ERROR_FAILED_RELOCATION;
-          return RETURN_LOAD_ERROR;
+        if (CheckEachFixup) {
+          Fixup = PeCoffLoaderImageAddress (ImageContext, RelocBase->VirtualAddress + (*Reloc & 0xFFF), TeStrippedOffset);
+          if (Fixup == NULL) {
+            ImageContext->ImageError = IMAGE_ERROR_FAILED_RELOCATION;
+            return RETURN_LOAD_ERROR;
+          }
+        } else {
+          Fixup = FixupBase + (*Reloc & 0xFFF);
         }
 
         switch ((*Reloc) >> 12) {
@@ -98,8 +98,14 @@ AcquireSpinLock (
   INT64   Cycle;
   INT64   Delta;
 
+  //
+  // While the lock is held, the waiters only read it, and try to acquire it
+  // when it is seen released. So they share the cache line of the lock until
+  // it is released, instead of taking it exclusive with a locked compare
+  // exchange on every try.
+  //
   if (PcdGet32 (PcdSpinLockTimeout) == 0) {
-    while (!AcquireSpinLockOrFail (SpinLock)) {
+    while ((*SpinLock != SPIN_LOCK_RELEASED) || !AcquireSpinLockOrFail (SpinLock)) {
       CpuPause ();
     }
   } else if (!AcquireSpinLockOrFail (SpinLock)) {
@@ -133,7 +139,7 @@ AcquireSpinLock (
 
     Cycle++;
 
-    while (!AcquireSpinLockOrFail (SpinLock)) {
+    while ((*SpinLock != SPIN_LOCK_RELEASED) || !AcquireSpinLockOrFail (SpinLock)) {
       CpuPause ();
       Previous = Current;
       Current  = GetPerformanceCounter ();
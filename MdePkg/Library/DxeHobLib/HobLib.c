@@ -9,13 +9,15 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <PiDxe.h>
 
 #include <Guid/HobList.h>
+#include <Guid/HobListIndex.h>
 
 #include <Library/HobLib.h>
 #include <Library/UefiLib.h>
 #include <Library/DebugLib.h>
 #include <Library/BaseMemoryLib.h>
 
-VOID  *mHobList = NULL;
+VOID                  *mHobList      = NULL;
+EDKII_HOB_LIST_INDEX  *mHobListIndex = NULL;
 
 /**
   Returns the pointer to the HOB list.
@@ -30,7 +32,8 @@ VOID  *mHobList = NULL;
 
   If the pointer to the HOB list is NULL, then ASSERT().
 
-  This function also caches the pointer to the HOB list retrieved.
+  This function also caches the pointer to the HOB list retrieved, and the
+  pointer to the HOB list index that the DXE Core may have installed.
 
   @return The pointer to the HOB list.
 
@@ -47,6 +50,11 @@ GetHobList (
     Status = EfiGetSystemConfigurationTable (&gEfiHobListGuid, &mHobList);
     ASSERT_EFI_ERROR (Status);
     ASSERT (mHobList != NULL);
+
+    Status = EfiGetSystemConfigurationTable (&gEdkiiHobListIndexGuid, (VOID **)&mHobListIndex);
+    if (EFI_ERROR (Status) || (mHobListIndex->HobList != mHobList)) {
+      mHobListIndex = NULL;
+    }
   }
 
   return mHobList;
@@ -142,6 +150,43 @@ GetFirstHob (
   return GetNextHob (Type, HobList);
 }
 
+/**
+  Looks up a GUID in the HOB list index.
+
+  @param  Guid          The GUID to look up.
+
+  @return The index entry of the GUID, or NULL if no GUID HOB has that GUID.
+
+**/
+EDKII_HOB_LIST_INDEX_ENTRY *
+InternalFindHobListIndexEntry (
+  IN CONST EFI_GUID  *Guid
+  )
+{
+  UINTN  Low;
+  UINTN  High;
+  UINTN  Middle;
+  INTN   Result;
+
+  Low  = 0;
+  High = mHobListIndex->EntryCount;
+  while (Low < High) {
+    Middle = Low + (High - Low) / 2;
+    Result = CompareMem (Guid, &mHobListIndex->Entry[Middle].Name, sizeof (EFI_GUID));
+    if (Result == 0) {
+      return &mHobListIndex->Entry[Middle];
+    }
+
+    if (Result < 0) {
+      High = Middle;
+    } else {
+      Low = Middle + 1;
+    }
+  }
+
+  return NULL;
+}
+
 /**
   Returns the next instance of the matched GUID HOB from the starting HOB.
 
@@ -171,7 +216,26 @@ GetNextGuidHob (
   IN CONST VOID      *HobStart
   )
 {
-  EFI_PEI_HOB_POINTERS  GuidHob;
+  EFI_PEI_HOB_POINTERS        GuidHob;
+  EDKII_HOB_LIST_INDEX_ENTRY  *Entry;
+
+  //
+  // The HOB list index answers the lookups that start before the first GUID
+  // HOB with the GUID, and the lookups of GUIDs that no GUID HOB has.
+  //
+  if ((mHobListIndex != NULL) &&
+      ((UINTN)HobStart >= (UINTN)mHobListIndex->HobList) &&
+      ((UINTN)HobStart <= (UINTN)mHobListIndex->EndOfHobList))
+  {
+    Entry = InternalFindHobListIndexEntry (Guid);
+    if (Entry == NULL) {
+      return NULL;
+    }
+
+    if ((UINTN)HobStart <= (UINTN)Entry->FirstHob) {
+      return Entry->FirstHob;
+    }
+  }
 
   GuidHob.Raw = (UINT8 *)HobStart;
   while ((GuidHob.Raw = GetNextHob (EFI_HOB_TYPE_GUID_EXTENSION, GuidHob.Raw)) != NULL) {
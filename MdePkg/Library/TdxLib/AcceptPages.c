@@ -21,10 +21,11 @@ UINT64  mNumberOfDuplicatedAcceptedPages;
 #define TDX_ACCEPTPAGE_MAX_RETRIED  3
 
 // PageSize is mapped to PageLevel like below:
-// 4KB - 0, 2MB - 1
-UINT32  mTdxAcceptPageLevelMap[2] = {
+// 4KB - 0, 2MB - 1, 1GB - 2
+UINT32  mTdxAcceptPageLevelMap[3] = {
   SIZE_4KB,
-  SIZE_2MB
+  SIZE_2MB,
+  SIZE_1GB
 };
 
 #define INVALID_ACCEPT_PAGELEVEL  ARRAY_SIZE(mTdxAcceptPageLevelMap)
@@ -64,7 +65,7 @@ GetGpaPageLevel (
   @param[in]  StartAddress      Guest physical address of the private
                                 page to accept. [63:52] and [11:0] must be 0.
   @param[in]  NumberOfPages     Number of the pages to be accepted.
-  @param[in]  PageSize          GPA page size. Only accept 2M/4K size.
+  @param[in]  PageSize          GPA page size. Only accept 1G/2M/4K size.
 
   @return EFI_SUCCESS           Accept successfully
   @return others                Indicate other errors
@@ -98,7 +99,7 @@ TdAcceptPages (
   GpaPageLevel = GetGpaPageLevel (PageSize);
   if (GpaPageLevel == INVALID_ACCEPT_PAGELEVEL) {
     ASSERT (FALSE);
-    DEBUG ((DEBUG_ERROR, "Accept page size must be 4K/2M. Invalid page size - 0x%llx\n", PageSize));
+    DEBUG ((DEBUG_ERROR, "Accept page size must be 4K/2M/1G. Invalid page size - 0x%llx\n", PageSize));
     return EFI_INVALID_PARAMETER;
   }
 
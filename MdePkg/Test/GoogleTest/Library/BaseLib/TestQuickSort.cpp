@@ -0,0 +1,136 @@
+/** @file
+  Unit tests for BaseLib's QuickSort.
+
+  Besides checking the result, the tests bound the number of comparisons
+  QuickSort makes on the inputs that used to be its worst cases. The count
+  does not depend on the speed of the host, so a regression to O(n^2) fails
+  the test reliably.
+
+  Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+extern "C" {
+  #include <Base.h>
+  #include <Library/BaseLib.h>
+}
+
+// Number of elements of the large buffers, 2^14
+constexpr STATIC UINTN  mLargeCount = 16384;
+constexpr STATIC UINTN  mLargeLog2  = 14;
+
+STATIC UINTN  mCompareCount;
+
+STATIC
+INTN
+EFIAPI
+CompareUint32 (
+  IN CONST VOID  *Buffer1,
+  IN CONST VOID  *Buffer2
+  )
+{
+  UINT32  Value1;
+  UINT32  Value2;
+
+  mCompareCount++;
+  Value1 = *(CONST UINT32 *)Buffer1;
+  Value2 = *(CONST UINT32 *)Buffer2;
+  if (Value1 < Value2) {
+    return -1;
+  } else if (Value1 > Value2) {
+    return 1;
+  }
+
+  return 0;
+}
+
+// Sort Buffer with QuickSort, check the result against std::sort and
+// return the number of comparisons.
+STATIC
+UINTN
+SortAndCheck (
+  std::vector<UINT32>  &Buffer
+  )
+{
+  std::vector<UINT32>  Expected (Buffer);
+  UINT32               Scratch;
+
+  std::sort (Expected.begin (), Expected.end ());
+  mCompareCount = 0;
+  QuickSort (Buffer.data (), Buffer.size (), sizeof (UINT32), CompareUint32, &Scratch);
+  EXPECT_EQ (Buffer, Expected);
+  return mCompareCount;
+}
+
+TEST (QuickSort, SmallBuffers) {
+  std::vector<UINT32>  Buffer;
+  UINTN                Count;
+  UINTN                Index;
+
+  // Every size around the insertion sort threshold, in several orders
+  for (Count = 1; Count < 40; Count++) {
+    Buffer.resize (Count);
+    for (Index = 0; Index < Count; Index++) {
+      Buffer[Index] = (UINT32)Index;
+    }
+
+    SortAndCheck (Buffer);
+
+    for (Index = 0; Index < Count; Index++) {
+      Buffer[Index] = (UINT32)(Count - Index);
+    }
+
+    SortAndCheck (Buffer);
+
+    for (Index = 0; Index < Count; Index++) {
+      Buffer[Index] = (UINT32)((Index * 7919) % 5);
+    }
+
+    SortAndCheck (Buffer);
+  }
+}
+
+TEST (QuickSort, RandomBuffer) {
+  std::vector<UINT32>  Buffer (mLargeCount);
+  UINT32               Seed;
+  UINTN                Index;
+
+  Seed = 1;
+  for (Index = 0; Index < mLargeCount; Index++) {
+    Seed          = Seed * 1103515245 + 12345;
+    Buffer[Index] = Seed >> 8;
+  }
+
+  EXPECT_LT (SortAndCheck (Buffer), 2 * mLargeCount * mLargeLog2);
+}
+
+TEST (QuickSort, SortedBuffer) {
+  std::vector<UINT32>  Buffer (mLargeCount);
+  UINTN                Index;
+
+  for (Index = 0; Index < mLargeCount; Index++) {
+    Buffer[Index] = (UINT32)Index;
+  }
+
+  EXPECT_LT (SortAndCheck (Buffer), 2 * mLargeCount * mLargeLog2);
+}
+
+TEST (QuickSort, ReverseSortedBuffer) {
+  std::vector<UINT32>  Buffer (mLargeCount);
+  UINTN                Index;
+
+  for (Index = 0; Index < mLargeCount; Index++) {
+    Buffer[Index] = (UINT32)(mLargeCount - Index);
+  }
+
+  EXPECT_LT (SortAndCheck (Buffer), 2 * mLargeCount * mLargeLog2);
+}
+
+TEST (QuickSort, EqualElements) {
+  std::vector<UINT32>  Buffer (mLargeCount, 42);
+
+  EXPECT_LT (SortAndCheck (Buffer), 2 * mLargeCount * mLargeLog2);
+}
@@ -31,13 +31,20 @@ typedef struct _DNS_INSTANCE DNS_INSTANCE;
 
 #define DNS_INSTANCE_SIGNATURE  SIGNATURE_32 ('D', 'N', 'S', 'I')
 
+///
+/// Maximum number of DNS servers a query is sent to in parallel.
+///
+#define DNS_SESSION_SERVER_MAX  3
+
 struct _DNS_DRIVER_DATA {
   EFI_EVENT     Timer;                 /// Ticking timer for DNS cache update.
 
   LIST_ENTRY    Dns4CacheList;
+  LIST_ENTRY    Dns4NegativeCacheList;
   LIST_ENTRY    Dns4ServerList;
 
   LIST_ENTRY    Dns6CacheList;
+  LIST_ENTRY    Dns6NegativeCacheList;
   LIST_ENTRY    Dns6ServerList;
 };
 
@@ -78,7 +85,8 @@ struct _DNS_INSTANCE {
   EFI_DNS4_CONFIG_DATA    Dns4CfgData;
   EFI_DNS6_CONFIG_DATA    Dns6CfgData;
 
-  EFI_IP_ADDRESS          SessionDnsServer;
+  UINT32                  SessionDnsServerCount;
+  EFI_IP_ADDRESS          SessionDnsServer[DNS_SESSION_SERVER_MAX];
 
   NET_MAP                 Dns4TxTokens;
   NET_MAP                 Dns6TxTokens;
@@ -689,7 +689,12 @@ Dns4ConfigUdp (
   UdpConfig.RemotePort         = DNS_SERVER_PORT;
 
   CopyMem (&UdpConfig.StationAddress, &Config->StationIp, sizeof (EFI_IPv4_ADDRESS));
-  CopyMem (&UdpConfig.RemoteAddress, &Instance->SessionDnsServer.v4, sizeof (EFI_IPv4_ADDRESS));
+
+  //
+  // Queries are sent to all the DNS servers of the session, so accept the
+  // responses from any remote address. DnsOnPacketReceived() filters them.
+  //
+  ZeroMem (&UdpConfig.RemoteAddress, sizeof (EFI_IPv4_ADDRESS));
 
   Status = UdpIo->Protocol.Udp4->Configure (UdpIo->Protocol.Udp4, &UdpConfig);
 
@@ -732,7 +737,12 @@ Dns6ConfigUdp (
   UdpConfig.StationPort        = Config->LocalPort;
   UdpConfig.RemotePort         = DNS_SERVER_PORT;
   CopyMem (&UdpConfig.StationAddress, &Config->StationIp, sizeof (EFI_IPv6_ADDRESS));
-  CopyMem (&UdpConfig.RemoteAddress, &Instance->SessionDnsServer.v6, sizeof (EFI_IPv6_ADDRESS));
+
+  //
+  // Queries are sent to all the DNS servers of the session, so accept the
+  // responses from any remote address. DnsOnPacketReceived() filters them.
+  //
+  ZeroMem (&UdpConfig.RemoteAddress, sizeof (EFI_IPv6_ADDRESS));
 
   Status = UdpIo->Protocol.Udp6->Configure (UdpIo->Protocol.Udp6, &UdpConfig);
 
@@ -942,6 +952,105 @@ UpdateDns6Cache (
   return EFI_SUCCESS;
 }
 
+/**
+  Update the shared list of negative responses, that is names which the DNS
+  servers have reported not to exist or to have no address of the queried type.
+
+  @param  NegativeCacheList  All Dns4 or Dns6 negative cache list.
+  @param  HostName           The host name that has no address.
+  @param  Status             The status to complete lookups of HostName with.
+  @param  Timeout            Time in seconds the negative response remains cached.
+
+  @retval EFI_SUCCESS           Update the negative cache successfully.
+  @retval EFI_OUT_OF_RESOURCES  Failed to allocate memory.
+
+**/
+EFI_STATUS
+UpdateDnsNegativeCache (
+  IN LIST_ENTRY  *NegativeCacheList,
+  IN CHAR16      *HostName,
+  IN EFI_STATUS  Status,
+  IN UINT32      Timeout
+  )
+{
+  DNS_NEGATIVE_CACHE  *Item;
+
+  Item = GetDnsNegativeCache (NegativeCacheList, HostName);
+  if (Item == NULL) {
+    Item = AllocateZeroPool (sizeof (DNS_NEGATIVE_CACHE));
+    if (Item == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    Item->HostName = AllocateCopyPool (StrSize (HostName), HostName);
+    if (Item->HostName == NULL) {
+      FreePool (Item);
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    InsertTailList (NegativeCacheList, &Item->AllCacheLink);
+  }
+
+  Item->Status  = Status;
+  Item->Timeout = Timeout;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Find a host name in the shared list of negative responses.
+
+  @param  NegativeCacheList  All Dns4 or Dns6 negative cache list.
+  @param  HostName           The host name to look up.
+
+  @return The negative cache entry of HostName, or NULL if HostName is not cached.
+
+**/
+DNS_NEGATIVE_CACHE *
+GetDnsNegativeCache (
+  IN LIST_ENTRY  *NegativeCacheList,
+  IN CHAR16      *HostName
+  )
+{
+  LIST_ENTRY          *Entry;
+  DNS_NEGATIVE_CACHE  *Item;
+
+  NET_LIST_FOR_EACH (Entry, NegativeCacheList) {
+    Item = NET_LIST_USER_STRUCT (Entry, DNS_NEGATIVE_CACHE, AllCacheLink);
+    if (StrCmp (HostName, Item->HostName) == 0) {
+      return Item;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Age the entries of a negative cache list by one second, and remove the
+  expired ones.
+
+  @param  NegativeCacheList  All Dns4 or Dns6 negative cache list.
+
+**/
+VOID
+DnsExpireNegativeCache (
+  IN LIST_ENTRY  *NegativeCacheList
+  )
+{
+  LIST_ENTRY          *Entry;
+  LIST_ENTRY          *Next;
+  DNS_NEGATIVE_CACHE  *Item;
+
+  NET_LIST_FOR_EACH_SAFE (Entry, Next, NegativeCacheList) {
+    Item = NET_LIST_USER_STRUCT (Entry, DNS_NEGATIVE_CACHE, AllCacheLink);
+    if (--Item->Timeout == 0) {
+      RemoveEntryList (&Item->AllCacheLink);
+      FreePool (Item->HostName);
+      FreePool (Item);
+    }
+  }
+}
+
 /**
   Add Dns4 ServerIp to common list of addresses of all configured DNSv4 server.
 
@@ -1108,6 +1217,95 @@ IsValidDnsResponse (
   return FALSE;
 }
 
+/**
+  Get the time a negative response may be cached, from the SOA record in its
+  authority section as described in RFC 2308.
+
+  @param  DnsHeader             The header of the response, in host byte order.
+  @param  RxString              Received datagram.
+  @param  Length                Length of the received datagram.
+  @param  AuthorityOffset       Offset of the authority section in RxString.
+
+  @return The time in seconds the response may be cached, or 0 if the response
+          is not a cacheable negative response.
+
+**/
+UINT32
+DnsGetNegativeTtl (
+  IN DNS_HEADER  *DnsHeader,
+  IN UINT8       *RxString,
+  IN UINT32      Length,
+  IN UINT32      AuthorityOffset
+  )
+{
+  UINT32              Offset;
+  UINT16              Index;
+  DNS_ANSWER_SECTION  Section;
+  UINT32              Minimum;
+
+  //
+  // Only a name error or an empty answer to a query is a negative response.
+  //
+  if ((DnsHeader->Flags.Bits.QR != DNS_FLAGS_QR_RESPONSE) || (DnsHeader->AnswersNum != 0) ||
+      ((DnsHeader->Flags.Bits.RCode != DNS_FLAGS_RCODE_NO_ERROR) && (DnsHeader->Flags.Bits.RCode != DNS_FLAGS_RCODE_NAME_ERROR)))
+  {
+    return 0;
+  }
+
+  Offset = AuthorityOffset;
+  for (Index = 0; Index < DnsHeader->AuthorityNum; Index++) {
+    //
+    // Skip the owner name, a sequence of labels ending with the root label or
+    // with a compression pointer.
+    //
+    while ((Offset < Length) && (RxString[Offset] != 0) && ((RxString[Offset] & 0xC0) == 0)) {
+      Offset += RxString[Offset] + 1;
+    }
+
+    if (Offset >= Length) {
+      return 0;
+    }
+
+    if (RxString[Offset] == 0) {
+      Offset++;
+    } else if ((RxString[Offset] & 0xC0) == 0xC0) {
+      Offset += sizeof (UINT16);
+    } else {
+      return 0;
+    }
+
+    if ((Offset > Length) || (Length - Offset < sizeof (DNS_ANSWER_SECTION))) {
+      return 0;
+    }
+
+    CopyMem (&Section, RxString + Offset, sizeof (DNS_ANSWER_SECTION));
+    Offset            += sizeof (DNS_ANSWER_SECTION);
+    Section.Type       = NTOHS (Section.Type);
+    Section.Ttl        = NTOHL (Section.Ttl);
+    Section.DataLength = NTOHS (Section.DataLength);
+
+    if (Length - Offset < Section.DataLength) {
+      return 0;
+    }
+
+    //
+    // The SOA data ends with the MINIMUM field, which bounds the TTL of
+    // negative responses. The two names before it are at least one byte each.
+    //
+    if ((Section.Type == DNS_TYPE_SOA) && (Section.DataLength >= 2 + 5 * sizeof (UINT32))) {
+      Minimum = NTOHL (ReadUnaligned32 ((UINT32 *)(RxString + Offset + Section.DataLength - sizeof (UINT32))));
+      return MIN (MIN (Section.Ttl, Minimum), DNS_NEGATIVE_CACHE_MAX_TTL);
+    }
+
+    Offset += Section.DataLength;
+  }
+
+  //
+  // Negative responses without a SOA record are not cached.
+  //
+  return 0;
+}
+
 /**
   Parse Dns Response.
 
@@ -1146,6 +1344,7 @@ ParseDnsResponse (
   UINT32  RRCount;
   UINT32  AnswerSectionNum;
   UINT32  CNameTtl;
+  UINT32  NegativeTtl;
 
   EFI_IPv4_ADDRESS  *HostAddr4;
   EFI_IPv6_ADDRESS  *HostAddr6;
@@ -1292,6 +1491,19 @@ ParseDnsResponse (
       Status = EFI_DEVICE_ERROR;
     }
 
+    //
+    // Remember a negative response to a host name lookup, so that the lookup
+    // is answered from the cache until the response expires.
+    //
+    NegativeTtl = DnsGetNegativeTtl (DnsHeader, RxString, Length, (UINT32)((UINT8 *)(QuerySection + 1) - RxString));
+    if (NegativeTtl != 0) {
+      if ((Dns4TokenEntry != NULL) && !Dns4TokenEntry->GeneralLookUp && (Dns4TokenEntry->QueryHostName != NULL)) {
+        UpdateDnsNegativeCache (&mDriverData->Dns4NegativeCacheList, Dns4TokenEntry->QueryHostName, Status, NegativeTtl);
+      } else if ((Dns6TokenEntry != NULL) && !Dns6TokenEntry->GeneralLookUp && (Dns6TokenEntry->QueryHostName != NULL)) {
+        UpdateDnsNegativeCache (&mDriverData->Dns6NegativeCacheList, Dns6TokenEntry->QueryHostName, Status, NegativeTtl);
+      }
+    }
+
     goto ON_COMPLETE;
   }
 
@@ -1538,7 +1750,13 @@ ParseDnsResponse (
             Dns4CacheEntry->Timeout = MAX (CNameTtl, AnswerSection->Ttl);
           }
 
-          UpdateDns4Cache (&mDriverData->Dns4CacheList, FALSE, TRUE, *Dns4CacheEntry);
+          //
+          // A TTL of zero means the answer must not be cached, whereas a zero
+          // Timeout would make the cache entry permanent.
+          //
+          if (Dns4CacheEntry->Timeout != 0) {
+            UpdateDns4Cache (&mDriverData->Dns4CacheList, FALSE, TRUE, *Dns4CacheEntry);
+          }
 
           //
           // Free allocated CacheEntry pool.
@@ -1600,7 +1818,13 @@ ParseDnsResponse (
             Dns6CacheEntry->Timeout = MAX (CNameTtl, AnswerSection->Ttl);
           }
 
-          UpdateDns6Cache (&mDriverData->Dns6CacheList, FALSE, TRUE, *Dns6CacheEntry);
+          //
+          // A TTL of zero means the answer must not be cached, whereas a zero
+          // Timeout would make the cache entry permanent.
+          //
+          if (Dns6CacheEntry->Timeout != 0) {
+            UpdateDns6Cache (&mDriverData->Dns6CacheList, FALSE, TRUE, *Dns6CacheEntry);
+          }
 
           //
           // Free allocated CacheEntry pool.
@@ -1827,6 +2051,10 @@ DnsOnPacketReceived (
 
   ASSERT (Packet != NULL);
 
+  if (!DnsIsSessionServer (Instance, EndPoint)) {
+    goto ON_EXIT;
+  }
+
   Len = Packet->TotalSize;
 
   RcvString = NetbufGetByte (Packet, 0, NULL);
@@ -1901,6 +2129,104 @@ DnsOnPacketSent (
   NetbufFree (Packet);
 }
 
+/**
+  Check whether a datagram comes from one of the DNS servers of the session.
+
+  @param  Instance              The DNS instance
+  @param  EndPoint              The local/remote UDP access point of the datagram
+
+  @retval TRUE                  The datagram comes from a DNS server of the session.
+  @retval FALSE                 The datagram comes from another host.
+
+**/
+BOOLEAN
+DnsIsSessionServer (
+  IN DNS_INSTANCE   *Instance,
+  IN UDP_END_POINT  *EndPoint
+  )
+{
+  EFI_IP_ADDRESS  RemoteAddr;
+  UINT32          Index;
+
+  //
+  // UDP_IO reports the remote address in host byte order.
+  //
+  CopyMem (&RemoteAddr, &EndPoint->RemoteAddr, sizeof (EFI_IP_ADDRESS));
+  if (Instance->Service->IpVersion == IP_VERSION_4) {
+    RemoteAddr.Addr[0] = HTONL (RemoteAddr.Addr[0]);
+  } else {
+    Ip6Swap128 (&RemoteAddr.v6);
+  }
+
+  for (Index = 0; Index < Instance->SessionDnsServerCount; Index++) {
+    if (Instance->Service->IpVersion == IP_VERSION_4) {
+      if (EFI_IP4_EQUAL (&RemoteAddr.v4, &Instance->SessionDnsServer[Index].v4)) {
+        return TRUE;
+      }
+    } else {
+      if (EFI_IP6_EQUAL (&RemoteAddr.v6, &Instance->SessionDnsServer[Index].v6)) {
+        return TRUE;
+      }
+    }
+  }
+
+  return FALSE;
+}
+
+/**
+  Transmit the packet to all the DNS servers of the session in parallel. The
+  first server to respond answers the query.
+
+  @param  Instance              The DNS instance
+  @param  Packet                The packet to transmit
+
+  @retval EFI_SUCCESS           The packet is transmitted to at least one server.
+  @retval Others                Failed to transmit the packet.
+
+**/
+EFI_STATUS
+DnsTransmit (
+  IN DNS_INSTANCE  *Instance,
+  IN NET_BUF       *Packet
+  )
+{
+  EFI_STATUS     Status;
+  EFI_STATUS     SendStatus;
+  UDP_END_POINT  EndPoint;
+  UINT32         Index;
+
+  Status = EFI_NOT_STARTED;
+
+  for (Index = 0; Index < Instance->SessionDnsServerCount; Index++) {
+    ZeroMem (&EndPoint, sizeof (UDP_END_POINT));
+    EndPoint.RemotePort = DNS_SERVER_PORT;
+
+    //
+    // UDP_IO takes the remote IPv4 address in host byte order.
+    //
+    if (Instance->Service->IpVersion == IP_VERSION_4) {
+      CopyMem (&EndPoint.RemoteAddr.v4, &Instance->SessionDnsServer[Index].v4, sizeof (EFI_IPv4_ADDRESS));
+      EndPoint.RemoteAddr.Addr[0] = NTOHL (EndPoint.RemoteAddr.Addr[0]);
+    } else {
+      CopyMem (&EndPoint.RemoteAddr.v6, &Instance->SessionDnsServer[Index].v6, sizeof (EFI_IPv6_ADDRESS));
+    }
+
+    NET_GET_REF (Packet);
+
+    SendStatus = UdpIoSendDatagram (Instance->UdpIo, Packet, &EndPoint, NULL, DnsOnPacketSent, Instance);
+    if (EFI_ERROR (SendStatus)) {
+      NET_PUT_REF (Packet);
+      if (Status != EFI_SUCCESS) {
+        Status = SendStatus;
+      }
+    } else {
+      Status = EFI_SUCCESS;
+    }
+  }
+
+  return Status;
+}
+
 /**
   Query request information.
 
@@ -1932,9 +2258,7 @@ DoDnsQuery (
   //
   // Transmit the DNS packet.
   //
-  NET_GET_REF (Packet);
-
-  Status = UdpIoSendDatagram (Instance->UdpIo, Packet, NULL, NULL, DnsOnPacketSent, Instance);
+  Status = DnsTransmit (Instance, Packet);
 
   return Status;
 }
@@ -2056,34 +2380,9 @@ DnsRetransmit (
   IN NET_BUF       *Packet
   )
 {
-  EFI_STATUS  Status;
-
-  UINT8  *Buffer;
-
   ASSERT (Packet != NULL);
 
-  //
-  // Set the requests to the listening port, other packets to the connected port
-  //
-  Buffer = NetbufGetByte (Packet, 0, NULL);
-  ASSERT (Buffer != NULL);
-
-  NET_GET_REF (Packet);
-
-  Status = UdpIoSendDatagram (
-             Instance->UdpIo,
-             Packet,
-             NULL,
-             NULL,
-             DnsOnPacketSent,
-             Instance
-             );
-
-  if (EFI_ERROR (Status)) {
-    NET_PUT_REF (Packet);
-  }
-
-  return Status;
+  return DnsTransmit (Instance, Packet);
 }
 
 /**
@@ -2229,25 +2528,25 @@ DnsOnTimerUpdate (
   Item4 = NULL;
   Item6 = NULL;
 
+  //
+  // Expire the negative responses.
+  //
+  DnsExpireNegativeCache (&mDriverData->Dns4NegativeCacheList);
+  DnsExpireNegativeCache (&mDriverData->Dns6NegativeCacheList);
+
   //
   // Iterate through all the DNS4 cache list.
   //
   NET_LIST_FOR_EACH_SAFE (Entry, Next, &mDriverData->Dns4CacheList) {
     Item4 = NET_LIST_USER_STRUCT (Entry, DNS4_CACHE, AllCacheLink);
-    Item4->DnsCache.Timeout--;
-  }
-
-  Entry = mDriverData->Dns4CacheList.ForwardLink;
-  while (Entry != &mDriverData->Dns4CacheList) {
-    Item4 = NET_LIST_USER_STRUCT (Entry, DNS4_CACHE, AllCacheLink);
-    if (Item4->DnsCache.Timeout == 0) {
-      RemoveEntryList (&Item4->AllCacheLink);
-      FreePool (Item4->DnsCache.HostName);
-      FreePool (Item4->DnsCache.IpAddress);
-      FreePool (Item4);
-      Entry = mDriverData->Dns4CacheList.ForwardLink;
-    } else {
-      Entry = Entry->ForwardLink;
+    if (Item4->DnsCache.Timeout != 0) {
+      Item4->DnsCache.Timeout--;
+      if (Item4->DnsCache.Timeout == 0) {
+        RemoveEntryList (&Item4->AllCacheLink);
+        FreePool (Item4->DnsCache.HostName);
+        FreePool (Item4->DnsCache.IpAddress);
+        FreePool (Item4);
+      }
     }
   }
 
@@ -2256,20 +2555,14 @@ DnsOnTimerUpdate (
   //
   NET_LIST_FOR_EACH_SAFE (Entry, Next, &mDriverData->Dns6CacheList) {
     Item6 = NET_LIST_USER_STRUCT (Entry, DNS6_CACHE, AllCacheLink);
-    Item6->DnsCache.Timeout--;
-  }
-
-  Entry = mDriverData->Dns6CacheList.ForwardLink;
-  while (Entry != &mDriverData->Dns6CacheList) {
-    Item6 = NET_LIST_USER_STRUCT (Entry, DNS6_CACHE, AllCacheLink);
-    if (Item6->DnsCache.Timeout == 0) {
-      RemoveEntryList (&Item6->AllCacheLink);
-      FreePool (Item6->DnsCache.HostName);
-      FreePool (Item6->DnsCache.IpAddress);
-      FreePool (Item6);
-      Entry = mDriverData->Dns6CacheList.ForwardLink;
-    } else {
-      Entry = Entry->ForwardLink;
+    if (Item6->DnsCache.Timeout != 0) {
+      Item6->DnsCache.Timeout--;
+      if (Item6->DnsCache.Timeout == 0) {
+        RemoveEntryList (&Item6->AllCacheLink);
+        FreePool (Item6->DnsCache.HostName);
+        FreePool (Item6->DnsCache.IpAddress);
+        FreePool (Item6);
+      }
     }
   }
 }
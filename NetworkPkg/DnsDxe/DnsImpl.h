@@ -83,6 +83,11 @@ extern EFI_DNS6_PROTOCOL             mDns6Protocol;
 
 #define DNS_TIME_TO_GETMAP  5
 
+//
+// Upper bound, in seconds, of the time a negative response is cached.
+//
+#define DNS_NEGATIVE_CACHE_MAX_TTL  300
+
 #pragma pack(1)
 
 typedef union _DNS_FLAGS DNS_FLAGS;
@@ -97,6 +102,13 @@ typedef struct {
   EFI_DNS6_CACHE_ENTRY    DnsCache;
 } DNS6_CACHE;
 
+typedef struct {
+  LIST_ENTRY    AllCacheLink;
+  CHAR16        *HostName;
+  EFI_STATUS    Status;
+  UINT32        Timeout;
+} DNS_NEGATIVE_CACHE;
+
 typedef struct {
   LIST_ENTRY          AllServerLink;
   EFI_IPv4_ADDRESS    Dns4ServerIp;
@@ -515,6 +527,54 @@ UpdateDns6Cache (
   IN EFI_DNS6_CACHE_ENTRY  DnsCacheEntry
   );
 
+/**
+  Update the shared list of negative responses, that is names which the DNS
+  servers have reported not to exist or to have no address of the queried type.
+
+  @param  NegativeCacheList  All Dns4 or Dns6 negative cache list.
+  @param  HostName           The host name that has no address.
+  @param  Status             The status to complete lookups of HostName with.
+  @param  Timeout            Time in seconds the negative response remains cached.
+
+  @retval EFI_SUCCESS           Update the negative cache successfully.
+  @retval EFI_OUT_OF_RESOURCES  Failed to allocate memory.
+
+**/
+EFI_STATUS
+UpdateDnsNegativeCache (
+  IN LIST_ENTRY  *NegativeCacheList,
+  IN CHAR16      *HostName,
+  IN EFI_STATUS  Status,
+  IN UINT32      Timeout
+  );
+
+/**
+  Find a host name in the shared list of negative responses.
+
+  @param  NegativeCacheList  All Dns4 or Dns6 negative cache list.
+  @param  HostName           The host name to look up.
+
+  @return The negative cache entry of HostName, or NULL if HostName is not cached.
+
+**/
+DNS_NEGATIVE_CACHE *
+GetDnsNegativeCache (
+  IN LIST_ENTRY  *NegativeCacheList,
+  IN CHAR16      *HostName
+  );
+
+/**
+  Age the entries of a negative cache list by one second, and remove the
+  expired ones.
+
+  @param  NegativeCacheList  All Dns4 or Dns6 negative cache list.
+
+**/
+VOID
+DnsExpireNegativeCache (
+  IN LIST_ENTRY  *NegativeCacheList
+  );
+
 /**
   Add Dns4 ServerIp to common list of addresses of all configured DNSv4 server.
 
@@ -571,6 +631,27 @@ IsValidDnsResponse (
   OUT NET_MAP_ITEM  **Item
   );
 
+/**
+  Get the time a negative response may be cached, from the SOA record in its
+  authority section as described in RFC 2308.
+
+  @param  DnsHeader             The header of the response, in host byte order.
+  @param  RxString              Received datagram.
+  @param  Length                Length of the received datagram.
+  @param  AuthorityOffset       Offset of the authority section in RxString.
+
+  @return The time in seconds the response may be cached, or 0 if the response
+          is not a cacheable negative response.
+
+**/
+UINT32
+DnsGetNegativeTtl (
+  IN DNS_HEADER  *DnsHeader,
+  IN UINT8       *RxString,
+  IN UINT32      Length,
+  IN UINT32      AuthorityOffset
+  );
+
 /**
   Parse Dns Response.
 
@@ -627,6 +708,39 @@ DnsOnPacketSent (
   VOID           *Context
   );
 
+/**
+  Check whether a datagram comes from one of the DNS servers of the session.
+
+  @param  Instance              The DNS instance
+  @param  EndPoint              The local/remote UDP access point of the datagram
+
+  @retval TRUE                  The datagram comes from a DNS server of the session.
+  @retval FALSE                 The datagram comes from another host.
+
+**/
+BOOLEAN
+DnsIsSessionServer (
+  IN DNS_INSTANCE   *Instance,
+  IN UDP_END_POINT  *EndPoint
+  );
+
+/**
+  Transmit the packet to all the DNS servers of the session in parallel. The
+  first server to respond answers the query.
+
+  @param  Instance              The DNS instance
+  @param  Packet                The packet to transmit
+
+  @retval EFI_SUCCESS           The packet is transmitted to at least one server.
+  @retval Others                Failed to transmit the packet.
+
+**/
+EFI_STATUS
+DnsTransmit (
+  IN DNS_INSTANCE  *Instance,
+  IN NET_BUF       *Packet
+  );
+
 /**
   Query request information.
 
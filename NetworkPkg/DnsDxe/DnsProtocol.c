@@ -188,6 +188,7 @@ Dns4Configure (
 
   UINT32            ServerListCount;
   EFI_IPv4_ADDRESS  *ServerList;
+  UINT32            Index;
 
   Status     = EFI_SUCCESS;
   ServerList = NULL;
@@ -208,7 +209,8 @@ Dns4Configure (
   Instance = DNS_INSTANCE_FROM_THIS_PROTOCOL4 (This);
 
   if (DnsConfigData == NULL) {
-    ZeroMem (&Instance->SessionDnsServer, sizeof (EFI_IP_ADDRESS));
+    Instance->SessionDnsServerCount = 0;
+    ZeroMem (Instance->SessionDnsServer, sizeof (Instance->SessionDnsServer));
 
     //
     // Reset the Instance if ConfigData is NULL
@@ -269,9 +271,17 @@ Dns4Configure (
 
       OldTpl = gBS->RaiseTPL (TPL_CALLBACK);
 
-      CopyMem (&Instance->SessionDnsServer.v4, &ServerList[0], sizeof (EFI_IPv4_ADDRESS));
+      Instance->SessionDnsServerCount = MIN (ServerListCount, DNS_SESSION_SERVER_MAX);
+      for (Index = 0; Index < Instance->SessionDnsServerCount; Index++) {
+        CopyMem (&Instance->SessionDnsServer[Index].v4, &ServerList[Index], sizeof (EFI_IPv4_ADDRESS));
+      }
+
+      FreePool (ServerList);
     } else {
-      CopyMem (&Instance->SessionDnsServer.v4, &DnsConfigData->DnsServerList[0], sizeof (EFI_IPv4_ADDRESS));
+      Instance->SessionDnsServerCount = MIN (DnsConfigData->DnsServerListCount, DNS_SESSION_SERVER_MAX);
+      for (Index = 0; Index < Instance->SessionDnsServerCount; Index++) {
+        CopyMem (&Instance->SessionDnsServer[Index].v4, &DnsConfigData->DnsServerList[Index], sizeof (EFI_IPv4_ADDRESS));
+      }
     }
 
     //
@@ -288,16 +298,18 @@ Dns4Configure (
     }
 
     //
-    // Add configured DNS server used by this instance to ServerList.
+    // Add configured DNS servers used by this instance to ServerList.
     //
-    Status = AddDns4ServerIp (&mDriverData->Dns4ServerList, Instance->SessionDnsServer.v4);
-    if (EFI_ERROR (Status)) {
-      if (Instance->Dns4CfgData.DnsServerList != NULL) {
-        FreePool (Instance->Dns4CfgData.DnsServerList);
-        Instance->Dns4CfgData.DnsServerList = NULL;
-      }
+    for (Index = 0; Index < Instance->SessionDnsServerCount; Index++) {
+      Status = AddDns4ServerIp (&mDriverData->Dns4ServerList, Instance->SessionDnsServer[Index].v4);
+      if (EFI_ERROR (Status)) {
+        if (Instance->Dns4CfgData.DnsServerList != NULL) {
+          FreePool (Instance->Dns4CfgData.DnsServerList);
+          Instance->Dns4CfgData.DnsServerList = NULL;
+        }
 
-      goto ON_EXIT;
+        goto ON_EXIT;
+      }
     }
 
     Instance->State = DNS_STATE_CONFIGED;
@@ -347,6 +359,8 @@ Dns4HostNameToIp (
   LIST_ENTRY  *Entry;
   LIST_ENTRY  *Next;
 
+  DNS_NEGATIVE_CACHE  *NegativeItem;
+
   CHAR8  *QueryName;
 
   DNS4_TOKEN_ENTRY  *TokenEntry;
@@ -450,6 +464,22 @@ Dns4HostNameToIp (
       Status = Token->Status;
       goto ON_EXIT;
     }
+
+    //
+    // The servers have recently reported that the host name has no address.
+    //
+    NegativeItem = GetDnsNegativeCache (&mDriverData->Dns4NegativeCacheList, HostName);
+    if (NegativeItem != NULL) {
+      Token->Status = NegativeItem->Status;
+
+      if (Token->Event != NULL) {
+        gBS->SignalEvent (Token->Event);
+        DispatchDpc ();
+      }
+
+      Status = EFI_SUCCESS;
+      goto ON_EXIT;
+    }
   }
 
   //
@@ -1037,6 +1067,7 @@ Dns6Configure (
 
   UINT32            ServerListCount;
   EFI_IPv6_ADDRESS  *ServerList;
+  UINT32            Index;
 
   Status     = EFI_SUCCESS;
   ServerList = NULL;
@@ -1057,7 +1088,8 @@ Dns6Configure (
   Instance = DNS_INSTANCE_FROM_THIS_PROTOCOL6 (This);
 
   if (DnsConfigData == NULL) {
-    ZeroMem (&Instance->SessionDnsServer, sizeof (EFI_IP_ADDRESS));
+    Instance->SessionDnsServerCount = 0;
+    ZeroMem (Instance->SessionDnsServer, sizeof (Instance->SessionDnsServer));
 
     //
     // Reset the Instance if ConfigData is NULL
@@ -1111,9 +1143,17 @@ Dns6Configure (
 
       OldTpl = gBS->RaiseTPL (TPL_CALLBACK);
 
-      CopyMem (&Instance->SessionDnsServer.v6, &ServerList[0], sizeof (EFI_IPv6_ADDRESS));
+      Instance->SessionDnsServerCount = MIN (ServerListCount, DNS_SESSION_SERVER_MAX);
+      for (Index = 0; Index < Instance->SessionDnsServerCount; Index++) {
+        CopyMem (&Instance->SessionDnsServer[Index].v6, &ServerList[Index], sizeof (EFI_IPv6_ADDRESS));
+      }
+
+      FreePool (ServerList);
     } else {
-      CopyMem (&Instance->SessionDnsServer.v6, &DnsConfigData->DnsServerList[0], sizeof (EFI_IPv6_ADDRESS));
+      Instance->SessionDnsServerCount = MIN (DnsConfigData->DnsServerCount, DNS_SESSION_SERVER_MAX);
+      for (Index = 0; Index < Instance->SessionDnsServerCount; Index++) {
+        CopyMem (&Instance->SessionDnsServer[Index].v6, &DnsConfigData->DnsServerList[Index], sizeof (EFI_IPv6_ADDRESS));
+      }
     }
 
     //
@@ -1132,16 +1172,18 @@ Dns6Configure (
     }
 
     //
-    // Add configured DNS server used by this instance to ServerList.
+    // Add configured DNS servers used by this instance to ServerList.
     //
-    Status = AddDns6ServerIp (&mDriverData->Dns6ServerList, Instance->SessionDnsServer.v6);
-    if (EFI_ERROR (Status)) {
-      if (Instance->Dns6CfgData.DnsServerList != NULL) {
-        FreePool (Instance->Dns6CfgData.DnsServerList);
-        Instance->Dns6CfgData.DnsServerList = NULL;
-      }
+    for (Index = 0; Index < Instance->SessionDnsServerCount; Index++) {
+      Status = AddDns6ServerIp (&mDriverData->Dns6ServerList, Instance->SessionDnsServer[Index].v6);
+      if (EFI_ERROR (Status)) {
+        if (Instance->Dns6CfgData.DnsServerList != NULL) {
+          FreePool (Instance->Dns6CfgData.DnsServerList);
+          Instance->Dns6CfgData.DnsServerList = NULL;
+        }
 
-      goto ON_EXIT;
+        goto ON_EXIT;
+      }
     }
 
     Instance->State = DNS_STATE_CONFIGED;
@@ -1193,6 +1235,8 @@ Dns6HostNameToIp (
   LIST_ENTRY  *Entry;
   LIST_ENTRY  *Next;
 
+  DNS_NEGATIVE_CACHE  *NegativeItem;
+
   CHAR8  *QueryName;
 
   DNS6_TOKEN_ENTRY  *TokenEntry;
@@ -1296,6 +1340,22 @@ Dns6HostNameToIp (
       Status = Token->Status;
       goto ON_EXIT;
     }
+
+    //
+    // The servers have recently reported that the host name has no address.
+    //
+    NegativeItem = GetDnsNegativeCache (&mDriverData->Dns6NegativeCacheList, HostName);
+    if (NegativeItem != NULL) {
+      Token->Status = NegativeItem->Status;
+
+      if (Token->Event != NULL) {
+        gBS->SignalEvent (Token->Event);
+        DispatchDpc ();
+      }
+
+      Status = EFI_SUCCESS;
+      goto ON_EXIT;
+    }
   }
 
   //
@@ -118,39 +118,36 @@ DpcQueueDpc (
     }
 
     //
-    // Add 64 DPC entries to the free list
+    // Lower the TPL level to perform a memory allocation
     //
-    for (Index = 0; Index < 64; Index++) {
-      //
-      // Lower the TPL level to perform a memory allocation
-      //
-      gBS->RestoreTPL (OriginalTpl);
+    gBS->RestoreTPL (OriginalTpl);
 
-      //
-      // Allocate a new DPC entry
-      //
-      DpcEntry = AllocatePool (sizeof (DPC_ENTRY));
+    //
+    // Allocate 64 DPC entries at once
+    //
+    DpcEntry = AllocatePool (64 * sizeof (DPC_ENTRY));
 
-      //
-      // Raise the TPL level back to TPL_HIGH_LEVEL for DPC list operations
-      //
-      gBS->RaiseTPL (TPL_HIGH_LEVEL);
+    //
+    // Raise the TPL level back to TPL_HIGH_LEVEL for DPC list operations
+    //
+    gBS->RaiseTPL (TPL_HIGH_LEVEL);
 
-      //
-      // If the allocation of a DPC entry fails, and the free list is empty,
-      // then return EFI_OUT_OF_RESOURCES.
-      //
-      if (DpcEntry == NULL) {
-        if (IsListEmpty (&mDpcEntryFreeList)) {
-          ReturnStatus = EFI_OUT_OF_RESOURCES;
-          goto Done;
-        }
+    //
+    // The free list may have been refilled by another caller while the TPL was
+    // lowered, so only fail if it is still empty.
+    //
+    if (DpcEntry == NULL) {
+      if (IsListEmpty (&mDpcEntryFreeList)) {
+        ReturnStatus = EFI_OUT_OF_RESOURCES;
+        goto Done;
       }
-
+    } else {
       //
-      // Add the newly allocated DPC entry to the DPC free list
+      // Add the newly allocated DPC entries to the DPC free list
       //
-      InsertTailList (&mDpcEntryFreeList, &DpcEntry->ListEntry);
+      for (Index = 0; Index < 64; Index++) {
+        InsertTailList (&mDpcEntryFreeList, &DpcEntry[Index].ListEntry);
+      }
     }
   }
 
@@ -597,26 +597,28 @@ HttpBootHttpIoCallback (
 }
 
 /**
-  Create a HttpIo instance for the file download.
+  Create a HttpIo instance configured with the station address of the driver.
 
   @param[in]    Private        The pointer to the driver's private data.
+  @param[in]    Callback       Callback function which will be invoked when specified
+                               HTTP_IO_CALLBACK_EVENT happened.
+  @param[out]   HttpIo         The HttpIo instance to create.
 
   @retval EFI_SUCCESS          Successfully created.
   @retval Others               Failed to create HttpIo.
 
 **/
 EFI_STATUS
-HttpBootCreateHttpIo (
-  IN     HTTP_BOOT_PRIVATE_DATA  *Private
+HttpBootInitHttpIo (
+  IN     HTTP_BOOT_PRIVATE_DATA  *Private,
+  IN     HTTP_IO_CALLBACK        Callback  OPTIONAL,
+  OUT    HTTP_IO                 *HttpIo
   )
 {
   HTTP_IO_CONFIG_DATA  ConfigData;
-  EFI_STATUS           Status;
   EFI_HANDLE           ImageHandle;
   UINT32               TimeoutValue;
 
-  ASSERT (Private != NULL);
-
   //
   // Get HTTP timeout value
   //
@@ -636,15 +638,36 @@ HttpBootCreateHttpIo (
     ImageHandle = Private->Ip6Nic->ImageHandle;
   }
 
-  Status = HttpIoCreateIo (
-             ImageHandle,
-             Private->Controller,
-             Private->UsingIpv6 ? IP_VERSION_6 : IP_VERSION_4,
-             &ConfigData,
-             HttpBootHttpIoCallback,
-             (VOID *)Private,
-             &Private->HttpIo
-             );
+  return HttpIoCreateIo (
+           ImageHandle,
+           Private->Controller,
+           Private->UsingIpv6 ? IP_VERSION_6 : IP_VERSION_4,
+           &ConfigData,
+           Callback,
+           (VOID *)Private,
+           HttpIo
+           );
+}
+
+/**
+  Create a HttpIo instance for the file download.
+
+  @param[in]    Private        The pointer to the driver's private data.
+
+  @retval EFI_SUCCESS          Successfully created.
+  @retval Others               Failed to create HttpIo.
+
+**/
+EFI_STATUS
+HttpBootCreateHttpIo (
+  IN     HTTP_BOOT_PRIVATE_DATA  *Private
+  )
+{
+  EFI_STATUS  Status;
+
+  ASSERT (Private != NULL);
+
+  Status = HttpBootInitHttpIo (Private, HttpBootHttpIoCallback, &Private->HttpIo);
   if (EFI_ERROR (Status)) {
     return Status;
   }
@@ -901,6 +924,276 @@ HttpBootGetBootFileCallback (
   return EFI_SUCCESS;
 }
 
+/**
+  Download the boot file in byte ranges over several HTTP connections in parallel.
+
+  The boot file is split into ranges of about the same size, and the request for
+  each range is sent over its own connection before any response is received. The
+  responses are then received in turns; while one connection is polled the others
+  keep filling their TCP receive buffers, so the server streams all the ranges at
+  the same time. The entity body is reported to HttpBootCallback in file order.
+
+  @param[in]    Private         The pointer to the driver's private data.
+  @param[in]    RequestData     The HTTP request data for the boot file.
+  @param[in]    HttpIoHeader    The HTTP headers to send with each request.
+  @param[in]    FileSize        The size of the boot file, as reported by the server.
+  @param[out]   Buffer          The memory buffer to transfer the file to. It must be
+                                at least FileSize bytes long.
+
+  @retval EFI_SUCCESS           The boot file was loaded.
+  @retval EFI_UNSUPPORTED       The boot file can't be downloaded in ranges, because it is
+                                too small, or the server didn't answer a request with the
+                                requested range. Nothing has been written to Buffer.
+  @retval Others                Unexpected error happened.
+
+**/
+EFI_STATUS
+HttpBootGetBootFileRanges (
+  IN     HTTP_BOOT_PRIVATE_DATA  *Private,
+  IN     EFI_HTTP_REQUEST_DATA   *RequestData,
+  IN     HTTP_IO_HEADER          *HttpIoHeader,
+  IN     UINTN                   FileSize,
+  OUT UINT8                      *Buffer
+  )
+{
+  EFI_STATUS             Status;
+  HTTP_BOOT_RANGE        *Ranges;
+  HTTP_BOOT_RANGE        *Range;
+  UINTN                  RangeCount;
+  UINTN                  RangeSize;
+  UINTN                  PendingCount;
+  UINTN                  Index;
+  UINTN                  Next;
+  HTTP_IO_HEADER         *RangeHeader;
+  CHAR8                  RangeValue[HTTP_BOOT_RANGE_VALUE_MAX_LEN];
+  HTTP_IO_RESPONSE_DATA  ResponseData;
+  EFI_HTTP_HEADER        *HttpHeader;
+  UINTN                  ContentLength;
+  UINTN                  ReportedSize;
+  UINTN                  ContiguousSize;
+
+  RangeCount = MIN (PcdGet8 (PcdHttpBootRangeConnections), HTTP_BOOT_RANGE_MAX_CONNECTIONS);
+  RangeCount = MIN (RangeCount, FileSize / HTTP_BOOT_RANGE_MIN_SIZE);
+  if (RangeCount < 2) {
+    return EFI_UNSUPPORTED;
+  }
+
+  Ranges = AllocateZeroPool (RangeCount * sizeof (HTTP_BOOT_RANGE));
+  if (Ranges == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  //
+  // Copy the request headers, leaving room for the "Range" header.
+  //
+  RangeHeader = HttpIoCreateHeader (HttpIoHeader->HeaderCount + 1);
+  if (RangeHeader == NULL) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto ON_EXIT;
+  }
+
+  for (Index = 0; Index < HttpIoHeader->HeaderCount; Index++) {
+    Status = HttpIoSetHeader (
+               RangeHeader,
+               HttpIoHeader->Headers[Index].FieldName,
+               HttpIoHeader->Headers[Index].FieldValue
+               );
+    if (EFI_ERROR (Status)) {
+      goto ON_EXIT;
+    }
+  }
+
+  //
+  // 1. Send the request for each range over its own connection.
+  //
+  RangeSize = FileSize / RangeCount;
+  for (Index = 0; Index < RangeCount; Index++) {
+    Range         = &Ranges[Index];
+    Range->Offset = Index * RangeSize;
+    Range->Length = (Index == RangeCount - 1) ? FileSize - Range->Offset : RangeSize;
+
+    //
+    // The ranges are reported to HttpBootCallback as a whole file below, so
+    // the messages of the individual connections are not passed on.
+    //
+    Status = HttpBootInitHttpIo (Private, NULL, &Range->HttpIo);
+    if (EFI_ERROR (Status)) {
+      goto ON_FALLBACK;
+    }
+
+    Range->HttpCreated = TRUE;
+
+    AsciiSPrint (
+      RangeValue,
+      sizeof (RangeValue),
+      "bytes=%Lu-%Lu",
+      (UINT64)Range->Offset,
+      (UINT64)(Range->Offset + Range->Length - 1)
+      );
+    Status = HttpIoSetHeader (RangeHeader, HTTP_HEADER_RANGE, RangeValue);
+    if (EFI_ERROR (Status)) {
+      goto ON_EXIT;
+    }
+
+    Status = HttpIoSendRequest (
+               &Range->HttpIo,
+               RequestData,
+               RangeHeader->HeaderCount,
+               RangeHeader->Headers,
+               0,
+               NULL
+               );
+    if (EFI_ERROR (Status)) {
+      goto ON_FALLBACK;
+    }
+  }
+
+  //
+  // 2. Receive the response headers, the server must answer each request with
+  //    exactly the requested range.
+  //
+  for (Index = 0; Index < RangeCount; Index++) {
+    Range = &Ranges[Index];
+
+    ZeroMem (&ResponseData, sizeof (HTTP_IO_RESPONSE_DATA));
+    Status = HttpIoRecvResponse (&Range->HttpIo, TRUE, &ResponseData);
+    if (!EFI_ERROR (Status)) {
+      if (EFI_ERROR (ResponseData.Status) ||
+          (ResponseData.Response.StatusCode != HTTP_STATUS_206_PARTIAL_CONTENT))
+      {
+        Status = EFI_UNSUPPORTED;
+      } else {
+        AsciiSPrint (
+          RangeValue,
+          sizeof (RangeValue),
+          "bytes %Lu-%Lu/%Lu",
+          (UINT64)Range->Offset,
+          (UINT64)(Range->Offset + Range->Length - 1),
+          (UINT64)FileSize
+          );
+        HttpHeader = HttpFindHeader (
+                       ResponseData.HeaderCount,
+                       ResponseData.Headers,
+                       HTTP_HEADER_CONTENT_RANGE
+                       );
+        Status = HttpIoGetContentLength (
+                   ResponseData.HeaderCount,
+                   ResponseData.Headers,
+                   &ContentLength
+                   );
+        if ((HttpHeader == NULL) || (AsciiStriCmp (HttpHeader->FieldValue, RangeValue) != 0) ||
+            EFI_ERROR (Status) || (ContentLength != Range->Length))
+        {
+          Status = EFI_UNSUPPORTED;
+        }
+      }
+    }
+
+    HttpFreeHeaderFields (ResponseData.Headers, ResponseData.HeaderCount);
+    if (EFI_ERROR (Status)) {
+      goto ON_FALLBACK;
+    }
+  }
+
+  //
+  // 3. Receive the ranges in turns, directly into the caller's buffer.
+  //
+  if (Private->HttpBootCallback != NULL) {
+    Status = Private->HttpBootCallback->Callback (
+                                          Private->HttpBootCallback,
+                                          HttpBootHttpRequest,
+                                          FALSE,
+                                          sizeof (EFI_HTTP_MESSAGE),
+                                          (VOID *)Ranges[0].HttpIo.ReqToken.Message
+                                          );
+    if (EFI_ERROR (Status)) {
+      goto ON_EXIT;
+    }
+  }
+
+  PendingCount = RangeCount;
+  ReportedSize = 0;
+  while (PendingCount > 0) {
+    for (Index = 0; Index < RangeCount; Index++) {
+      Range = &Ranges[Index];
+      if (Range->ReceivedSize == Range->Length) {
+        continue;
+      }
+
+      ZeroMem (&ResponseData, sizeof (HTTP_IO_RESPONSE_DATA));
+      ResponseData.Body       = (CHAR8 *)Buffer + Range->Offset + Range->ReceivedSize;
+      ResponseData.BodyLength = Range->Length - Range->ReceivedSize;
+      Status                  = HttpIoRecvResponse (
+                                  &Range->HttpIo,
+                                  FALSE,
+                                  &ResponseData
+                                  );
+      if (EFI_ERROR (Status) || EFI_ERROR (ResponseData.Status)) {
+        if (EFI_ERROR (ResponseData.Status)) {
+          Status = ResponseData.Status;
+        }
+
+        goto ON_EXIT;
+      }
+
+      Range->ReceivedSize += ResponseData.BodyLength;
+      if (Range->ReceivedSize == Range->Length) {
+        PendingCount--;
+      }
+
+      if (Private->HttpBootCallback == NULL) {
+        continue;
+      }
+
+      //
+      // Report the data which is now contiguous from the start of the file.
+      //
+      for (Next = 0; Next < RangeCount; Next++) {
+        ContiguousSize = Ranges[Next].Offset + Ranges[Next].ReceivedSize;
+        if (Ranges[Next].ReceivedSize < Ranges[Next].Length) {
+          break;
+        }
+      }
+
+      if (ContiguousSize > ReportedSize) {
+        Status = Private->HttpBootCallback->Callback (
+                                              Private->HttpBootCallback,
+                                              HttpBootHttpEntityBody,
+                                              TRUE,
+                                              (UINT32)(ContiguousSize - ReportedSize),
+                                              Buffer + ReportedSize
+                                              );
+        if (EFI_ERROR (Status)) {
+          goto ON_EXIT;
+        }
+
+        ReportedSize = ContiguousSize;
+      }
+    }
+  }
+
+  Status = EFI_SUCCESS;
+  goto ON_EXIT;
+
+ON_FALLBACK:
+  DEBUG ((DEBUG_INFO, "HttpBootGetBootFileRanges: %r, use a single connection.\n", Status));
+  Status = EFI_UNSUPPORTED;
+
+ON_EXIT:
+  for (Index = 0; Index < RangeCount; Index++) {
+    if (Ranges[Index].HttpCreated) {
+      HttpIoDestroyIo (&Ranges[Index].HttpIo);
+    }
+  }
+
+  if (RangeHeader != NULL) {
+    HttpIoFreeHeader (RangeHeader);
+  }
+
+  FreePool (Ranges);
+  return Status;
+}
+
 /**
   This function download the boot file by using UEFI HTTP protocol.
 
@@ -1117,7 +1410,31 @@ HttpBootGetBootFile (
   }
 
   //
-  // 2.4 Send out the request to HTTP server.
+  // 2.4 Download the file in byte ranges over several connections if the server
+  //     accepts range requests, otherwise fall back to a single request.
+  //
+  if (!HeaderOnly && (Buffer != NULL) && Private->BootFileAcceptRanges &&
+      (Private->BootFileSize != 0) && (*BufferSize >= Private->BootFileSize))
+  {
+    Status = HttpBootGetBootFileRanges (
+               Private,
+               RequestData,
+               HttpIoHeader,
+               Private->BootFileSize,
+               Buffer
+               );
+    if (Status != EFI_UNSUPPORTED) {
+      if (!EFI_ERROR (Status)) {
+        *BufferSize = Private->BootFileSize;
+        *ImageType  = Private->ImageType;
+      }
+
+      goto ERROR_4;
+    }
+  }
+
+  //
+  // 2.5 Send out the request to HTTP server.
   //
   HttpIo = &Private->HttpIo;
   Status = HttpIoSendRequest (
@@ -1237,6 +1554,19 @@ HttpBootGetBootFile (
     goto ERROR_5;
   }
 
+  //
+  // Record whether the server accepts byte range requests for the boot file.
+  //
+  if (HeaderOnly) {
+    HttpHeader = HttpFindHeader (
+                   ResponseData->HeaderCount,
+                   ResponseData->Headers,
+                   HTTP_HEADER_ACCEPT_RANGES
+                   );
+    Private->BootFileAcceptRanges = (BOOLEAN)((HttpHeader != NULL) &&
+                                              (AsciiStriCmp (HttpHeader->FieldValue, "bytes") == 0));
+  }
+
   //
   // 3.2 Cache the response header.
   //
@@ -14,6 +14,13 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define HTTP_USER_AGENT_EFI_HTTP_BOOT          "UefiHttpBoot/1.0"
 #define HTTP_BOOT_AUTHENTICATION_INFO_MAX_LEN  255
 
+//
+// Limits of the parallel download of a boot file in byte ranges.
+//
+#define HTTP_BOOT_RANGE_MAX_CONNECTIONS  8
+#define HTTP_BOOT_RANGE_MIN_SIZE         SIZE_1MB
+#define HTTP_BOOT_RANGE_VALUE_MAX_LEN    64
+
 //
 // Record the data length and start address of a data block.
 //
@@ -58,6 +65,17 @@ typedef struct {
   HTTP_BOOT_PRIVATE_DATA     *Private;
 } HTTP_BOOT_CALLBACK_DATA;
 
+//
+// A byte range of the boot file, downloaded over its own HTTP connection.
+//
+typedef struct {
+  HTTP_IO    HttpIo;
+  BOOLEAN    HttpCreated;
+  UINTN      Offset;                      // Offset of the range in the boot file.
+  UINTN      Length;
+  UINTN      ReceivedSize;
+} HTTP_BOOT_RANGE;
+
 /**
   Discover all the boot information for boot file.
 
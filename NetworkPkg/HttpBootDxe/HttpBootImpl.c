@@ -467,12 +467,13 @@ HttpBootStop (
   ZeroMem (&Private->StationIp, sizeof (EFI_IP_ADDRESS));
   ZeroMem (&Private->SubnetMask, sizeof (EFI_IP_ADDRESS));
   ZeroMem (&Private->GatewayIp, sizeof (EFI_IP_ADDRESS));
-  Private->Port              = 0;
-  Private->BootFileUri       = NULL;
-  Private->BootFileUriParser = NULL;
-  Private->BootFileSize      = 0;
-  Private->SelectIndex       = 0;
-  Private->SelectProxyType   = HttpOfferTypeMax;
+  Private->Port                 = 0;
+  Private->BootFileUri          = NULL;
+  Private->BootFileUriParser    = NULL;
+  Private->BootFileSize         = 0;
+  Private->BootFileAcceptRanges = FALSE;
+  Private->SelectIndex          = 0;
+  Private->SelectProxyType      = HttpOfferTypeMax;
 
   if (!Private->UsingIpv6) {
     //
@@ -67,6 +67,8 @@ HttpCreateService (
   HttpService->ControllerHandle            = Controller;
   HttpService->ChildrenNumber              = 0;
   InitializeListHead (&HttpService->ChildrenList);
+  InitializeListHead (&HttpService->IdleConnections);
+  InitializeListHead (&HttpService->TlsSessions);
 
   *ServiceData = HttpService;
   return EFI_SUCCESS;
@@ -90,6 +92,8 @@ HttpCleanService (
     return;
   }
 
+  HttpFreeIdleConnections (HttpService, UsingIpv6);
+
   if (!UsingIpv6) {
     if (HttpService->Tcp4ChildHandle != NULL) {
       gBS->CloseProtocol (
@@ -127,6 +131,10 @@ HttpCleanService (
       HttpService->Tcp6ChildHandle = NULL;
     }
   }
+
+  if ((HttpService->Tcp4ChildHandle == NULL) && (HttpService->Tcp6ChildHandle == NULL)) {
+    HttpsFreeTlsSessions (HttpService);
+  }
 }
 
 /**
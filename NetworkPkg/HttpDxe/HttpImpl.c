@@ -564,6 +564,14 @@ EfiHttpRequest (
     EfiHttpCancel (This, NULL);
   }
 
+  if ((Configure || ReConfigure) && !HttpInstance->UseHttps && HttpAdoptConnection (HttpInstance)) {
+    //
+    // Another HTTP child left an idle connection to the remote host, use it as is.
+    //
+    Configure   = FALSE;
+    ReConfigure = FALSE;
+  }
+
   //
   // Wrap the HTTP token in HTTP_TOKEN_WRAP
   //
@@ -642,7 +650,8 @@ EfiHttpRequest (
     }
   }
 
-  HttpInstance->ConnectionClose = FALSE;
+  HttpInstance->ConnectionClose  = FALSE;
+  HttpInstance->ResponseComplete = FALSE;
 
   //
   // Transmit the request message.
@@ -1251,7 +1260,8 @@ HttpResponseWorker (
         // Free the MsgParse since we already have a full HTTP message.
         //
         HttpFreeMsgParser (HttpInstance->MsgParser);
-        HttpInstance->MsgParser = NULL;
+        HttpInstance->MsgParser        = NULL;
+        HttpInstance->ResponseComplete = TRUE;
       }
     }
 
@@ -1405,7 +1415,8 @@ HttpResponseWorker (
       // Free the MsgParse since we already have a full HTTP message.
       //
       HttpFreeMsgParser (HttpInstance->MsgParser);
-      HttpInstance->MsgParser = NULL;
+      HttpInstance->MsgParser        = NULL;
+      HttpInstance->ResponseComplete = TRUE;
     }
 
     //
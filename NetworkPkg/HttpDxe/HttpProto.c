@@ -212,7 +212,8 @@ HttpTcpReceiveNotifyDpc (
     // Free the MsgParse since we already have a full HTTP message.
     //
     HttpFreeMsgParser (HttpInstance->MsgParser);
-    HttpInstance->MsgParser = NULL;
+    HttpInstance->MsgParser        = NULL;
+    HttpInstance->ResponseComplete = TRUE;
   }
 
   Wrap->HttpToken->Message->BodyLength = Length;
@@ -810,6 +811,70 @@ ON_ERROR:
   return EFI_UNSUPPORTED;
 }
 
+/**
+  Close the TCP child of the HTTP instance and destroy it.
+
+  @param[in]  HttpInstance       The HTTP instance private data.
+
+**/
+VOID
+HttpDestroyTcpChild (
+  IN  HTTP_PROTOCOL  *HttpInstance
+  )
+{
+  if (HttpInstance->Tcp4ChildHandle != NULL) {
+    gBS->CloseProtocol (
+           HttpInstance->Tcp4ChildHandle,
+           &gEfiTcp4ProtocolGuid,
+           HttpInstance->Service->Ip4DriverBindingHandle,
+           HttpInstance->Service->ControllerHandle
+           );
+
+    gBS->CloseProtocol (
+           HttpInstance->Tcp4ChildHandle,
+           &gEfiTcp4ProtocolGuid,
+           HttpInstance->Service->Ip4DriverBindingHandle,
+           HttpInstance->Handle
+           );
+
+    NetLibDestroyServiceChild (
+      HttpInstance->Service->ControllerHandle,
+      HttpInstance->Service->Ip4DriverBindingHandle,
+      &gEfiTcp4ServiceBindingProtocolGuid,
+      HttpInstance->Tcp4ChildHandle
+      );
+
+    HttpInstance->Tcp4ChildHandle = NULL;
+    HttpInstance->Tcp4            = NULL;
+  }
+
+  if (HttpInstance->Tcp6ChildHandle != NULL) {
+    gBS->CloseProtocol (
+           HttpInstance->Tcp6ChildHandle,
+           &gEfiTcp6ProtocolGuid,
+           HttpInstance->Service->Ip6DriverBindingHandle,
+           HttpInstance->Service->ControllerHandle
+           );
+
+    gBS->CloseProtocol (
+           HttpInstance->Tcp6ChildHandle,
+           &gEfiTcp6ProtocolGuid,
+           HttpInstance->Service->Ip6DriverBindingHandle,
+           HttpInstance->Handle
+           );
+
+    NetLibDestroyServiceChild (
+      HttpInstance->Service->ControllerHandle,
+      HttpInstance->Service->Ip6DriverBindingHandle,
+      &gEfiTcp6ServiceBindingProtocolGuid,
+      HttpInstance->Tcp6ChildHandle
+      );
+
+    HttpInstance->Tcp6ChildHandle = NULL;
+    HttpInstance->Tcp6            = NULL;
+  }
+}
+
 /**
   Clean up the HTTP child, release all the resources used by it.
 
@@ -821,6 +886,8 @@ HttpCleanProtocol (
   IN  HTTP_PROTOCOL  *HttpInstance
   )
 {
+  HttpsSaveTlsSession (HttpInstance);
+  HttpParkConnection (HttpInstance);
   HttpCloseConnection (HttpInstance);
 
   HttpCloseTcpConnCloseEvent (HttpInstance);
@@ -863,71 +930,321 @@ HttpCleanProtocol (
     HttpInstance->TlsAlreadyCreated = FALSE;
   }
 
-  if (HttpInstance->Tcp4ChildHandle != NULL) {
+  HttpDestroyTcpChild (HttpInstance);
+
+  if (HttpInstance->Service->Tcp4ChildHandle != NULL) {
     gBS->CloseProtocol (
-           HttpInstance->Tcp4ChildHandle,
+           HttpInstance->Service->Tcp4ChildHandle,
            &gEfiTcp4ProtocolGuid,
            HttpInstance->Service->Ip4DriverBindingHandle,
-           HttpInstance->Service->ControllerHandle
+           HttpInstance->Handle
            );
+  }
 
+  if (HttpInstance->Service->Tcp6ChildHandle != NULL) {
     gBS->CloseProtocol (
-           HttpInstance->Tcp4ChildHandle,
-           &gEfiTcp4ProtocolGuid,
-           HttpInstance->Service->Ip4DriverBindingHandle,
+           HttpInstance->Service->Tcp6ChildHandle,
+           &gEfiTcp6ProtocolGuid,
+           HttpInstance->Service->Ip6DriverBindingHandle,
            HttpInstance->Handle
            );
+  }
 
-    NetLibDestroyServiceChild (
-      HttpInstance->Service->ControllerHandle,
-      HttpInstance->Service->Ip4DriverBindingHandle,
-      &gEfiTcp4ServiceBindingProtocolGuid,
-      HttpInstance->Tcp4ChildHandle
+  TlsCloseTxRxEvent (HttpInstance);
+}
+
+/**
+  Keep the connection of the HTTP instance open for another HTTP child of the
+  same service, instead of closing it when the instance is reset or destroyed.
+
+  Only an idle HTTP connection is kept: the response to each request has been
+  received completely, and the server didn't ask to close the connection. A
+  HTTPS connection is never kept, its TLS child is installed on the handle of
+  the HTTP instance.
+
+  @param[in]  HttpInstance       The HTTP instance private data.
+
+  @retval TRUE                   The connection has been moved to the idle connections
+                                 of the service.
+  @retval FALSE                  The connection can't be reused.
+
+**/
+BOOLEAN
+HttpParkConnection (
+  IN  HTTP_PROTOCOL  *HttpInstance
+  )
+{
+  EFI_STATUS                 Status;
+  HTTP_SERVICE               *Service;
+  HTTP_IDLE_CONNECTION       *Connection;
+  EFI_TCP4_CONNECTION_STATE  Tcp4State;
+  EFI_TCP6_CONNECTION_STATE  Tcp6State;
+
+  if ((HttpInstance->State != HTTP_STATE_TCP_CONNECTED) ||
+      HttpInstance->UseHttps ||
+      HttpInstance->ConnectionClose ||
+      !HttpInstance->ResponseComplete ||
+      (HttpInstance->RemoteHost == NULL) ||
+      (HttpInstance->CacheBody != NULL) ||
+      (HttpInstance->MsgParser != NULL) ||
+      !NetMapIsEmpty (&HttpInstance->TxTokens) ||
+      !NetMapIsEmpty (&HttpInstance->RxTokens))
+  {
+    return FALSE;
+  }
+
+  if (!HttpInstance->LocalAddressIsIPv6) {
+    Status = HttpInstance->Tcp4->GetModeData (HttpInstance->Tcp4, &Tcp4State, NULL, NULL, NULL, NULL);
+    if (EFI_ERROR (Status) || (Tcp4State != Tcp4StateEstablished)) {
+      return FALSE;
+    }
+  } else {
+    Status = HttpInstance->Tcp6->GetModeData (HttpInstance->Tcp6, &Tcp6State, NULL, NULL, NULL, NULL);
+    if (EFI_ERROR (Status) || (Tcp6State != Tcp6StateEstablished)) {
+      return FALSE;
+    }
+  }
+
+  Connection = AllocateZeroPool (sizeof (HTTP_IDLE_CONNECTION));
+  if (Connection == NULL) {
+    return FALSE;
+  }
+
+  Service = HttpInstance->Service;
+
+  //
+  // Make room by closing the connection which has been idle the longest.
+  //
+  if (Service->IdleConnectionCount >= HTTP_IDLE_CONNECTION_MAX) {
+    HttpFreeIdleConnection (
+      Service,
+      NET_LIST_HEAD (&Service->IdleConnections, HTTP_IDLE_CONNECTION, Link)
       );
   }
 
-  if (HttpInstance->Service->Tcp4ChildHandle != NULL) {
+  Connection->LocalAddressIsIPv6 = HttpInstance->LocalAddressIsIPv6;
+  Connection->RemoteHost         = HttpInstance->RemoteHost;
+  Connection->RemotePort         = HttpInstance->RemotePort;
+  HttpInstance->RemoteHost       = NULL;
+  HttpInstance->RemotePort       = 0;
+
+  if (!HttpInstance->LocalAddressIsIPv6) {
+    CopyMem (&Connection->IPv4Node, &HttpInstance->IPv4Node, sizeof (HttpInstance->IPv4Node));
+    IP4_COPY_ADDRESS (&Connection->RemoteAddr, &HttpInstance->RemoteAddr);
+
     gBS->CloseProtocol (
-           HttpInstance->Service->Tcp4ChildHandle,
+           HttpInstance->Tcp4ChildHandle,
            &gEfiTcp4ProtocolGuid,
-           HttpInstance->Service->Ip4DriverBindingHandle,
+           Service->Ip4DriverBindingHandle,
            HttpInstance->Handle
            );
-  }
 
-  if (HttpInstance->Tcp6ChildHandle != NULL) {
+    Connection->TcpChildHandle    = HttpInstance->Tcp4ChildHandle;
+    Connection->Tcp4              = HttpInstance->Tcp4;
+    HttpInstance->Tcp4ChildHandle = NULL;
+    HttpInstance->Tcp4            = NULL;
+  } else {
+    CopyMem (&Connection->Ipv6Node, &HttpInstance->Ipv6Node, sizeof (HttpInstance->Ipv6Node));
+    IP6_COPY_ADDRESS (&Connection->RemoteIpv6Addr, &HttpInstance->RemoteIpv6Addr);
+
     gBS->CloseProtocol (
            HttpInstance->Tcp6ChildHandle,
            &gEfiTcp6ProtocolGuid,
-           HttpInstance->Service->Ip6DriverBindingHandle,
-           HttpInstance->Service->ControllerHandle
+           Service->Ip6DriverBindingHandle,
+           HttpInstance->Handle
            );
 
+    Connection->TcpChildHandle    = HttpInstance->Tcp6ChildHandle;
+    Connection->Tcp6              = HttpInstance->Tcp6;
+    HttpInstance->Tcp6ChildHandle = NULL;
+    HttpInstance->Tcp6            = NULL;
+  }
+
+  HttpInstance->State = HTTP_STATE_TCP_CLOSED;
+
+  InsertTailList (&Service->IdleConnections, &Connection->Link);
+  Service->IdleConnectionCount++;
+
+  return TRUE;
+}
+
+/**
+  Take over an idle connection to the remote host of the HTTP instance, in place
+  of the TCP child of the instance.
+
+  @param[in]  HttpInstance       The HTTP instance private data.
+
+  @retval TRUE                   The HTTP instance is connected to its remote host.
+  @retval FALSE                  There is no idle connection the instance can take over.
+
+**/
+BOOLEAN
+HttpAdoptConnection (
+  IN  HTTP_PROTOCOL  *HttpInstance
+  )
+{
+  EFI_STATUS            Status;
+  HTTP_SERVICE          *Service;
+  HTTP_IDLE_CONNECTION  *Connection;
+  LIST_ENTRY            *Entry;
+  EFI_TCP4_PROTOCOL     *Tcp4;
+  EFI_TCP6_PROTOCOL     *Tcp6;
+
+  Service    = HttpInstance->Service;
+  Connection = NULL;
+  NET_LIST_FOR_EACH (Entry, &Service->IdleConnections) {
+    Connection = NET_LIST_USER_STRUCT (Entry, HTTP_IDLE_CONNECTION, Link);
+    if ((Connection->LocalAddressIsIPv6 == HttpInstance->LocalAddressIsIPv6) &&
+        (Connection->RemotePort == HttpInstance->RemotePort) &&
+        (AsciiStrCmp (Connection->RemoteHost, HttpInstance->RemoteHost) == 0) &&
+        (HttpInstance->LocalAddressIsIPv6 ?
+         (CompareMem (&Connection->Ipv6Node, &HttpInstance->Ipv6Node, sizeof (HttpInstance->Ipv6Node)) == 0) :
+         (CompareMem (&Connection->IPv4Node, &HttpInstance->IPv4Node, sizeof (HttpInstance->IPv4Node)) == 0)))
+    {
+      break;
+    }
+
+    Connection = NULL;
+  }
+
+  if (Connection == NULL) {
+    return FALSE;
+  }
+
+  //
+  // The TCP connection and close tokens of the instance are used with the
+  // connection from now on.
+  //
+  HttpCloseTcpConnCloseEvent (HttpInstance);
+  Status = HttpCreateTcpConnCloseEvent (HttpInstance);
+  if (EFI_ERROR (Status)) {
+    return FALSE;
+  }
+
+  if (!HttpInstance->LocalAddressIsIPv6) {
+    Status = gBS->OpenProtocol (
+                    Connection->TcpChildHandle,
+                    &gEfiTcp4ProtocolGuid,
+                    (VOID **)&Tcp4,
+                    Service->Ip4DriverBindingHandle,
+                    HttpInstance->Handle,
+                    EFI_OPEN_PROTOCOL_BY_CHILD_CONTROLLER
+                    );
+    if (EFI_ERROR (Status)) {
+      return FALSE;
+    }
+
+    HttpDestroyTcpChild (HttpInstance);
+    HttpInstance->Tcp4ChildHandle = Connection->TcpChildHandle;
+    HttpInstance->Tcp4            = Tcp4;
+    IP4_COPY_ADDRESS (&HttpInstance->RemoteAddr, &Connection->RemoteAddr);
+  } else {
+    Status = gBS->OpenProtocol (
+                    Connection->TcpChildHandle,
+                    &gEfiTcp6ProtocolGuid,
+                    (VOID **)&Tcp6,
+                    Service->Ip6DriverBindingHandle,
+                    HttpInstance->Handle,
+                    EFI_OPEN_PROTOCOL_BY_CHILD_CONTROLLER
+                    );
+    if (EFI_ERROR (Status)) {
+      return FALSE;
+    }
+
+    HttpDestroyTcpChild (HttpInstance);
+    HttpInstance->Tcp6ChildHandle = Connection->TcpChildHandle;
+    HttpInstance->Tcp6            = Tcp6;
+    IP6_COPY_ADDRESS (&HttpInstance->RemoteIpv6Addr, &Connection->RemoteIpv6Addr);
+  }
+
+  HttpInstance->State = HTTP_STATE_TCP_CONNECTED;
+
+  RemoveEntryList (&Connection->Link);
+  Service->IdleConnectionCount--;
+  FreePool (Connection->RemoteHost);
+  FreePool (Connection);
+
+  return TRUE;
+}
+
+/**
+  Close an idle connection of the HTTP service and destroy its TCP child.
+
+  @param[in]  HttpService        The HTTP service.
+  @param[in]  Connection         The idle connection.
+
+**/
+VOID
+HttpFreeIdleConnection (
+  IN  HTTP_SERVICE          *HttpService,
+  IN  HTTP_IDLE_CONNECTION  *Connection
+  )
+{
+  RemoveEntryList (&Connection->Link);
+  HttpService->IdleConnectionCount--;
+
+  if (!Connection->LocalAddressIsIPv6) {
+    Connection->Tcp4->Configure (Connection->Tcp4, NULL);
+
     gBS->CloseProtocol (
-           HttpInstance->Tcp6ChildHandle,
-           &gEfiTcp6ProtocolGuid,
-           HttpInstance->Service->Ip6DriverBindingHandle,
-           HttpInstance->Handle
+           Connection->TcpChildHandle,
+           &gEfiTcp4ProtocolGuid,
+           HttpService->Ip4DriverBindingHandle,
+           HttpService->ControllerHandle
            );
 
     NetLibDestroyServiceChild (
-      HttpInstance->Service->ControllerHandle,
-      HttpInstance->Service->Ip6DriverBindingHandle,
-      &gEfiTcp6ServiceBindingProtocolGuid,
-      HttpInstance->Tcp6ChildHandle
+      HttpService->ControllerHandle,
+      HttpService->Ip4DriverBindingHandle,
+      &gEfiTcp4ServiceBindingProtocolGuid,
+      Connection->TcpChildHandle
       );
-  }
+  } else {
+    Connection->Tcp6->Configure (Connection->Tcp6, NULL);
 
-  if (HttpInstance->Service->Tcp6ChildHandle != NULL) {
     gBS->CloseProtocol (
-           HttpInstance->Service->Tcp6ChildHandle,
+           Connection->TcpChildHandle,
            &gEfiTcp6ProtocolGuid,
-           HttpInstance->Service->Ip6DriverBindingHandle,
-           HttpInstance->Handle
+           HttpService->Ip6DriverBindingHandle,
+           HttpService->ControllerHandle
            );
+
+    NetLibDestroyServiceChild (
+      HttpService->ControllerHandle,
+      HttpService->Ip6DriverBindingHandle,
+      &gEfiTcp6ServiceBindingProtocolGuid,
+      Connection->TcpChildHandle
+      );
   }
 
-  TlsCloseTxRxEvent (HttpInstance);
+  FreePool (Connection->RemoteHost);
+  FreePool (Connection);
+}
+
+/**
+  Close the idle connections of the HTTP service.
+
+  @param[in]  HttpService        The HTTP service.
+  @param[in]  UsingIpv6          Close the TCP6 connections if TRUE, the TCP4
+                                 connections otherwise.
+
+**/
+VOID
+HttpFreeIdleConnections (
+  IN  HTTP_SERVICE  *HttpService,
+  IN  BOOLEAN       UsingIpv6
+  )
+{
+  LIST_ENTRY            *Entry;
+  LIST_ENTRY            *NextEntry;
+  HTTP_IDLE_CONNECTION  *Connection;
+
+  NET_LIST_FOR_EACH_SAFE (Entry, NextEntry, &HttpService->IdleConnections) {
+    Connection = NET_LIST_USER_STRUCT (Entry, HTTP_IDLE_CONNECTION, Link);
+    if (Connection->LocalAddressIsIPv6 == UsingIpv6) {
+      HttpFreeIdleConnection (HttpService, Connection);
+    }
+  }
 }
 
 /**
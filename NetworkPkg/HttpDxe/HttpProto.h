@@ -49,6 +49,12 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #define HTTP_URL_BUFFER_LEN  4096
 
+//
+// The maximum number of idle connections a HTTP service keeps for reuse.
+//
+#define HTTP_IDLE_CONNECTION_MAX  4
+#define HTTP_TLS_SESSION_MAX      8
+
 typedef struct _HTTP_SERVICE {
   UINT32                          Signature;
   EFI_SERVICE_BINDING_PROTOCOL    ServiceBinding;
@@ -60,8 +66,41 @@ typedef struct _HTTP_SERVICE {
   LIST_ENTRY                      ChildrenList;
   UINTN                           ChildrenNumber;
   INTN                            State;
+  LIST_ENTRY                      IdleConnections;
+  UINTN                           IdleConnectionCount;
+  LIST_ENTRY                      TlsSessions;
+  UINTN                           TlsSessionCount;
 } HTTP_SERVICE;
 
+//
+// A connected TCP child left behind by a HTTP child that has been reset or
+// destroyed, which another HTTP child of the same service may take over.
+//
+typedef struct {
+  LIST_ENTRY                 Link;        // Link to IdleConnections of the service.
+  BOOLEAN                    LocalAddressIsIPv6;
+  EFI_HTTPv4_ACCESS_POINT    IPv4Node;
+  EFI_HTTPv6_ACCESS_POINT    Ipv6Node;
+  EFI_HANDLE                 TcpChildHandle;
+  EFI_TCP4_PROTOCOL          *Tcp4;
+  EFI_TCP6_PROTOCOL          *Tcp6;
+  CHAR8                      *RemoteHost;
+  UINT16                     RemotePort;
+  EFI_IPv4_ADDRESS           RemoteAddr;
+  EFI_IPv6_ADDRESS           RemoteIpv6Addr;
+} HTTP_IDLE_CONNECTION;
+
+//
+// The ID of the last TLS session with a HTTPS server, which the next
+// connection to the server asks the TLS driver to resume.
+//
+typedef struct {
+  LIST_ENTRY            Link;        // Link to TlsSessions of the service.
+  CHAR8                 *RemoteHost;
+  UINT16                RemotePort;
+  EFI_TLS_SESSION_ID    SessionId;
+} HTTP_TLS_SESSION;
+
 typedef struct {
   EFI_TCP4_IO_TOKEN         Tx4Token;
   EFI_TCP4_TRANSMIT_DATA    Tx4Data;
@@ -198,6 +237,11 @@ typedef struct _HTTP_PROTOCOL {
   BOOLEAN                           TlsIsRxDone;
 
   BOOLEAN                           ConnectionClose;
+
+  //
+  // TRUE if the response to each request sent has been received completely.
+  //
+  BOOLEAN                           ResponseComplete;
 } HTTP_PROTOCOL;
 
 typedef struct {
@@ -335,6 +379,69 @@ HttpCleanProtocol (
   IN  HTTP_PROTOCOL  *HttpInstance
   );
 
+/**
+  Keep the connection of the HTTP instance open for another HTTP child of the
+  same service, instead of closing it when the instance is reset or destroyed.
+
+  Only an idle HTTP connection is kept: the response to each request has been
+  received completely, and the server didn't ask to close the connection. A
+  HTTPS connection is never kept, its TLS child is installed on the handle of
+  the HTTP instance.
+
+  @param[in]  HttpInstance       The HTTP instance private data.
+
+  @retval TRUE                   The connection has been moved to the idle connections
+                                 of the service.
+  @retval FALSE                  The connection can't be reused.
+
+**/
+BOOLEAN
+HttpParkConnection (
+  IN  HTTP_PROTOCOL  *HttpInstance
+  );
+
+/**
+  Take over an idle connection to the remote host of the HTTP instance, in place
+  of the TCP child of the instance.
+
+  @param[in]  HttpInstance       The HTTP instance private data.
+
+  @retval TRUE                   The HTTP instance is connected to its remote host.
+  @retval FALSE                  There is no idle connection the instance can take over.
+
+**/
+BOOLEAN
+HttpAdoptConnection (
+  IN  HTTP_PROTOCOL  *HttpInstance
+  );
+
+/**
+  Close an idle connection of the HTTP service and destroy its TCP child.
+
+  @param[in]  HttpService        The HTTP service.
+  @param[in]  Connection         The idle connection.
+
+**/
+VOID
+HttpFreeIdleConnection (
+  IN  HTTP_SERVICE          *HttpService,
+  IN  HTTP_IDLE_CONNECTION  *Connection
+  );
+
+/**
+  Close the idle connections of the HTTP service.
+
+  @param[in]  HttpService        The HTTP service.
+  @param[in]  UsingIpv6          Close the TCP6 connections if TRUE, the TCP4
+                                 connections otherwise.
+
+**/
+VOID
+HttpFreeIdleConnections (
+  IN  HTTP_SERVICE  *HttpService,
+  IN  BOOLEAN       UsingIpv6
+  );
+
 /**
   Establish TCP connection with HTTP server.
 
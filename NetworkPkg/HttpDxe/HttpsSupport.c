@@ -708,6 +708,11 @@ TlsConfigureSession (
     return Status;
   }
 
+  //
+  // EfiTlsSessionID
+  //
+  HttpsResumeTlsSession (HttpInstance);
+
   //
   // Tls Cipher List
   //
@@ -1944,3 +1949,184 @@ HttpsReceive (
 
   return Status;
 }
+
+/**
+  Find the TLS session with a remote host.
+
+  @param[in]  HttpService        The HTTP service.
+  @param[in]  RemoteHost         The name of the remote host.
+  @param[in]  RemotePort         The port of the remote host.
+
+  @return  The TLS session, or NULL if there is none.
+
+**/
+HTTP_TLS_SESSION *
+HttpsFindTlsSession (
+  IN  HTTP_SERVICE  *HttpService,
+  IN  CHAR8         *RemoteHost,
+  IN  UINT16        RemotePort
+  )
+{
+  LIST_ENTRY        *Entry;
+  HTTP_TLS_SESSION  *Session;
+
+  NET_LIST_FOR_EACH (Entry, &HttpService->TlsSessions) {
+    Session = NET_LIST_USER_STRUCT (Entry, HTTP_TLS_SESSION, Link);
+    if ((Session->RemotePort == RemotePort) &&
+        (AsciiStrCmp (Session->RemoteHost, RemoteHost) == 0))
+    {
+      return Session;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Forget a TLS session of the HTTP service.
+
+  @param[in]  HttpService        The HTTP service.
+  @param[in]  Session            The TLS session.
+
+**/
+VOID
+HttpsFreeTlsSession (
+  IN  HTTP_SERVICE      *HttpService,
+  IN  HTTP_TLS_SESSION  *Session
+  )
+{
+  RemoveEntryList (&Session->Link);
+  HttpService->TlsSessionCount--;
+
+  FreePool (Session->RemoteHost);
+  FreePool (Session);
+}
+
+/**
+  Remember the ID of the TLS session of the HTTP instance, so that the next
+  HTTPS connection to the same remote host can resume the session instead of
+  performing a full handshake.
+
+  @param[in]  HttpInstance       The HTTP instance private data.
+
+**/
+VOID
+HttpsSaveTlsSession (
+  IN  HTTP_PROTOCOL  *HttpInstance
+  )
+{
+  EFI_STATUS          Status;
+  HTTP_SERVICE        *HttpService;
+  HTTP_TLS_SESSION    *Session;
+  EFI_TLS_SESSION_ID  SessionId;
+  UINTN               SessionIdSize;
+
+  if (!HttpInstance->UseHttps || !HttpInstance->TlsAlreadyCreated ||
+      (HttpInstance->TlsSessionState != EfiTlsSessionDataTransferring) ||
+      (HttpInstance->RemoteHost == NULL))
+  {
+    return;
+  }
+
+  //
+  // The TLS driver keeps the session data for the session ID it returns.
+  //
+  SessionIdSize = sizeof (EFI_TLS_SESSION_ID);
+  Status        = HttpInstance->Tls->GetSessionData (
+                                       HttpInstance->Tls,
+                                       EfiTlsSessionID,
+                                       &SessionId,
+                                       &SessionIdSize
+                                       );
+  if (EFI_ERROR (Status) || (SessionId.Length == 0)) {
+    return;
+  }
+
+  HttpService = HttpInstance->Service;
+  Session     = HttpsFindTlsSession (HttpService, HttpInstance->RemoteHost, HttpInstance->RemotePort);
+  if (Session == NULL) {
+    Session = AllocateZeroPool (sizeof (HTTP_TLS_SESSION));
+    if (Session == NULL) {
+      return;
+    }
+
+    Session->RemoteHost = AllocateCopyPool (AsciiStrSize (HttpInstance->RemoteHost), HttpInstance->RemoteHost);
+    if (Session->RemoteHost == NULL) {
+      FreePool (Session);
+      return;
+    }
+
+    Session->RemotePort = HttpInstance->RemotePort;
+
+    if (HttpService->TlsSessionCount >= HTTP_TLS_SESSION_MAX) {
+      HttpsFreeTlsSession (
+        HttpService,
+        NET_LIST_HEAD (&HttpService->TlsSessions, HTTP_TLS_SESSION, Link)
+        );
+    }
+  } else {
+    RemoveEntryList (&Session->Link);
+    HttpService->TlsSessionCount--;
+  }
+
+  CopyMem (&Session->SessionId, &SessionId, sizeof (EFI_TLS_SESSION_ID));
+  InsertTailList (&HttpService->TlsSessions, &Session->Link);
+  HttpService->TlsSessionCount++;
+}
+
+/**
+  Ask the TLS driver to resume the last TLS session with the remote host of the
+  HTTP instance, if there is one.
+
+  @param[in]  HttpInstance       The HTTP instance private data.
+
+**/
+VOID
+HttpsResumeTlsSession (
+  IN  HTTP_PROTOCOL  *HttpInstance
+  )
+{
+  EFI_STATUS        Status;
+  HTTP_TLS_SESSION  *Session;
+
+  if (HttpInstance->RemoteHost == NULL) {
+    return;
+  }
+
+  Session = HttpsFindTlsSession (HttpInstance->Service, HttpInstance->RemoteHost, HttpInstance->RemotePort);
+  if (Session == NULL) {
+    return;
+  }
+
+  //
+  // A full handshake is performed if the session can't be resumed.
+  //
+  Status = HttpInstance->Tls->SetSessionData (
+                                HttpInstance->Tls,
+                                EfiTlsSessionID,
+                                &Session->SessionId,
+                                sizeof (EFI_TLS_SESSION_ID)
+                                );
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_VERBOSE, "HttpsResumeTlsSession: %a:%d - %r\n", Session->RemoteHost, Session->RemotePort, Status));
+  }
+}
+
+/**
+  Forget the TLS sessions of the HTTP service.
+
+  @param[in]  HttpService        The HTTP service.
+
+**/
+VOID
+HttpsFreeTlsSessions (
+  IN  HTTP_SERVICE  *HttpService
+  )
+{
+  while (!IsListEmpty (&HttpService->TlsSessions)) {
+    HttpsFreeTlsSession (
+      HttpService,
+      NET_LIST_HEAD (&HttpService->TlsSessions, HTTP_TLS_SESSION, Link)
+      );
+  }
+}
@@ -259,4 +259,40 @@ HttpsReceive (
   IN     EFI_EVENT      Timeout
   );
 
+/**
+  Remember the ID of the TLS session of the HTTP instance, so that the next
+  HTTPS connection to the same remote host can resume the session instead of
+  performing a full handshake.
+
+  @param[in]  HttpInstance       The HTTP instance private data.
+
+**/
+VOID
+HttpsSaveTlsSession (
+  IN  HTTP_PROTOCOL  *HttpInstance
+  );
+
+/**
+  Ask the TLS driver to resume the last TLS session with the remote host of the
+  HTTP instance, if there is one.
+
+  @param[in]  HttpInstance       The HTTP instance private data.
+
+**/
+VOID
+HttpsResumeTlsSession (
+  IN  HTTP_PROTOCOL  *HttpInstance
+  );
+
+/**
+  Forget the TLS sessions of the HTTP service.
+
+  @param[in]  HttpService        The HTTP service.
+
+**/
+VOID
+HttpsFreeTlsSessions (
+  IN  HTTP_SERVICE  *HttpService
+  );
+
 #endif
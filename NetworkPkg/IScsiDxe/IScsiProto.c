@@ -1801,7 +1801,7 @@ IScsiFillOpParams (
   AsciiSPrint (Value, sizeof (Value), "%a", Session->ImmediateData ? "Yes" : "No");
   IScsiAddKeyValuePair (Pdu, ISCSI_KEY_IMMEDIATE_DATA, Value);
 
-  AsciiSPrint (Value, sizeof (Value), "%d", MAX_RECV_DATA_SEG_LEN_IN_FFP);
+  AsciiSPrint (Value, sizeof (Value), "%d", ISCSI_CLAMP_DATA_LENGTH (PcdGet32 (PcdIScsiMaxRecvDataSegmentLength)));
   IScsiAddKeyValuePair (Pdu, ISCSI_KEY_MAX_RECV_DATA_SEGMENT_LENGTH, Value);
 
   AsciiSPrint (Value, sizeof (Value), "%d", Session->MaxBurstLength);
@@ -3145,11 +3145,12 @@ IScsiSessionInit (
   Session->MaxConnections       = ISCSI_MAX_CONNS_PER_SESSION;
   Session->InitialR2T           = FALSE;
   Session->ImmediateData        = TRUE;
-  Session->MaxBurstLength       = 262144;
-  Session->FirstBurstLength     = MAX_RECV_DATA_SEG_LEN_IN_FFP;
+  Session->MaxBurstLength       = ISCSI_CLAMP_DATA_LENGTH (PcdGet32 (PcdIScsiMaxBurstLength));
+  Session->FirstBurstLength     = ISCSI_CLAMP_DATA_LENGTH (PcdGet32 (PcdIScsiFirstBurstLength));
+  Session->FirstBurstLength     = MIN (Session->FirstBurstLength, Session->MaxBurstLength);
   Session->DefaultTime2Wait     = 2;
   Session->DefaultTime2Retain   = 20;
-  Session->MaxOutstandingR2T    = DEFAULT_MAX_OUTSTANDING_R2T;
+  Session->MaxOutstandingR2T    = MAX (PcdGet16 (PcdIScsiMaxOutstandingR2T), 1);
   Session->DataPDUInOrder       = TRUE;
   Session->DataSequenceInOrder  = TRUE;
   Session->ErrorRecoveryLevel   = 0;
@@ -28,8 +28,16 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define ISCSI_MAX_CONNS_PER_SESSION  1
 
 #define DEFAULT_MAX_RECV_DATA_SEG_LEN  8192
-#define MAX_RECV_DATA_SEG_LEN_IN_FFP   65536
-#define DEFAULT_MAX_OUTSTANDING_R2T    1
+
+//
+// Valid range of the data length keys (MaxRecvDataSegmentLength,
+// MaxBurstLength and FirstBurstLength), RFC 7143 section 13.
+//
+#define ISCSI_MIN_DATA_LENGTH  512
+#define ISCSI_MAX_DATA_LENGTH  0xFFFFFF
+
+#define ISCSI_CLAMP_DATA_LENGTH(Len) \
+  MIN (MAX ((Len), ISCSI_MIN_DATA_LENGTH), ISCSI_MAX_DATA_LENGTH)
 
 #define ISCSI_VERSION_MAX  0x00
 #define ISCSI_VERSION_MIN  0x00
@@ -0,0 +1,97 @@
+/** @file
+  This file defines the EDKII Simple Network Receive Loan Protocol interface.
+
+  A Simple Network Protocol driver may install this protocol on the handle of
+  its EFI_SIMPLE_NETWORK_PROTOCOL instance in order to hand received frames to
+  the consumer in place, in the driver's own receive buffers, instead of
+  copying them into the buffer passed to EFI_SIMPLE_NETWORK_PROTOCOL.Receive().
+  The two receive interfaces share the same receive queue; a consumer may mix
+  them freely.
+
+  Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#ifndef EDKII_SIMPLE_NETWORK_RX_LOAN_H_
+#define EDKII_SIMPLE_NETWORK_RX_LOAN_H_
+
+#define EDKII_SIMPLE_NETWORK_RX_LOAN_PROTOCOL_GUID \
+  { \
+    0x33280b11, 0xe030, 0x4dd3, {0xb8, 0x90, 0xc5, 0xd5, 0x88, 0xbe, 0x8e, 0x3a} \
+  }
+
+typedef struct _EDKII_SIMPLE_NETWORK_RX_LOAN_PROTOCOL  EDKII_SIMPLE_NETWORK_RX_LOAN_PROTOCOL;
+typedef struct _EDKII_SIMPLE_NETWORK_RX_LOAN_FRAME     EDKII_SIMPLE_NETWORK_RX_LOAN_FRAME;
+
+/**
+  Give a loaned frame back to the Simple Network Protocol driver, which may
+  then reuse its buffer for receiving another frame.
+
+  This function may be called at or below TPL_NOTIFY, also after the network
+  interface has been shut down.
+
+  @param[in]  Frame               The frame returned by
+                                  EDKII_SIMPLE_NETWORK_RX_LOAN_PROTOCOL.Receive().
+**/
+typedef
+VOID
+(EFIAPI *EDKII_SIMPLE_NETWORK_RX_LOAN_RELEASE)(
+  IN EDKII_SIMPLE_NETWORK_RX_LOAN_FRAME  *Frame
+  );
+
+///
+/// A received frame that is still owned by the Simple Network Protocol driver.
+///
+struct _EDKII_SIMPLE_NETWORK_RX_LOAN_FRAME {
+  ///
+  /// The received frame, including the media header. The data following the
+  /// media header should be 4-byte aligned. The consumer may modify the frame
+  /// in place.
+  ///
+  UINT8                                   *Buffer;
+  ///
+  /// The size, in bytes, of the frame, including the media header.
+  ///
+  UINTN                                   Length;
+  ///
+  /// The function to give the frame back to the driver with.
+  ///
+  EDKII_SIMPLE_NETWORK_RX_LOAN_RELEASE    Release;
+};
+
+/**
+  Receive a frame from the network interface without copying it.
+
+  The media header size is EFI_SIMPLE_NETWORK_MODE.MediaHeaderSize. The frame
+  remains valid until the consumer calls its Release() function.
+
+  @param[in]   This               Pointer to the EDKII_SIMPLE_NETWORK_RX_LOAN_PROTOCOL instance.
+  @param[out]  Frame              On output, the received frame.
+
+  @retval EFI_SUCCESS             A frame has been received.
+  @retval EFI_NOT_STARTED         The network interface has not been started.
+  @retval EFI_NOT_READY           No frame has been received.
+  @retval EFI_OUT_OF_RESOURCES    Too many frames are on loan already. The next
+                                  frame can be received with
+                                  EFI_SIMPLE_NETWORK_PROTOCOL.Receive().
+  @retval EFI_DEVICE_ERROR        The network interface is not initialized, or
+                                  a malformed frame has been dropped.
+**/
+typedef
+EFI_STATUS
+(EFIAPI *EDKII_SIMPLE_NETWORK_RX_LOAN_RECEIVE)(
+  IN  EDKII_SIMPLE_NETWORK_RX_LOAN_PROTOCOL  *This,
+  OUT EDKII_SIMPLE_NETWORK_RX_LOAN_FRAME     **Frame
+  );
+
+///
+/// EDKII Simple Network Receive Loan Protocol lends received frames to the
+/// consumer of the Simple Network Protocol.
+///
+struct _EDKII_SIMPLE_NETWORK_RX_LOAN_PROTOCOL {
+  EDKII_SIMPLE_NETWORK_RX_LOAN_RECEIVE    Receive;
+};
+
+extern EFI_GUID  gEdkiiSimpleNetworkRxLoanProtocolGuid;
+
+#endif /* EDKII_SIMPLE_NETWORK_RX_LOAN_H_ */
@@ -166,6 +166,159 @@ Ip4CleanRouteCache (
   }
 }
 
+/**
+  Free the nodes of the route trie below a node.
+
+  @param[in, out]  Node          The node whose children to free.
+
+**/
+VOID
+Ip4CleanRouteTrie (
+  IN OUT IP4_ROUTE_NODE  *Node
+  )
+{
+  UINT32  Index;
+
+  for (Index = 0; Index < 2; Index++) {
+    if (Node->Child[Index] != NULL) {
+      Ip4CleanRouteTrie (Node->Child[Index]);
+      FreePool (Node->Child[Index]);
+      Node->Child[Index] = NULL;
+    }
+  }
+}
+
+/**
+  Free the nodes at the end of a path of the route trie that neither
+  hold a route entry nor lead to one.
+
+  @param[in, out]  Path          The nodes from the root of the trie, Path[0] is the root.
+  @param[in]       Depth         The depth of the last node of the path.
+
+**/
+VOID
+Ip4PruneRouteTrie (
+  IN OUT IP4_ROUTE_NODE  **Path,
+  IN     UINTN           Depth
+  )
+{
+  IP4_ROUTE_NODE  *Node;
+  IP4_ROUTE_NODE  *Parent;
+
+  for ( ; Depth > 0; Depth--) {
+    Node = Path[Depth];
+
+    if ((Node->RtEntry != NULL) || (Node->Child[0] != NULL) || (Node->Child[1] != NULL)) {
+      break;
+    }
+
+    Parent = Path[Depth - 1];
+
+    if (Parent->Child[0] == Node) {
+      Parent->Child[0] = NULL;
+    } else {
+      Parent->Child[1] = NULL;
+    }
+
+    FreePool (Node);
+  }
+}
+
+/**
+  Walk the route trie to the node of a network, and create the missing
+  nodes on the way if requested.
+
+  @param[in]   RtTable           The route table that owns the trie.
+  @param[in]   Dest              The destination network.
+  @param[in]   Length            The netmask length of the destination network.
+  @param[in]   Create            Whether to create the missing nodes.
+  @param[out]  Path              The nodes from the root to the network node,
+                                 Path[0] is the root. Holds IP4_MASK_NUM nodes.
+
+  @return NULL if the node doesn't exist and can't be created, otherwise
+          the node of the network.
+
+**/
+IP4_ROUTE_NODE *
+Ip4GetRouteNode (
+  IN  IP4_ROUTE_TABLE  *RtTable,
+  IN  IP4_ADDR         Dest,
+  IN  UINTN            Length,
+  IN  BOOLEAN          Create,
+  OUT IP4_ROUTE_NODE   **Path
+  )
+{
+  IP4_ROUTE_NODE  *Node;
+  UINTN           Depth;
+  UINTN           Bit;
+
+  Node    = &RtTable->RouteTrie;
+  Path[0] = Node;
+
+  for (Depth = 0; Depth < Length; Depth++) {
+    Bit = (Dest >> (IP4_MASK_MAX - 1 - Depth)) & 1;
+
+    if (Node->Child[Bit] == NULL) {
+      if (!Create) {
+        return NULL;
+      }
+
+      Node->Child[Bit] = AllocateZeroPool (sizeof (IP4_ROUTE_NODE));
+      if (Node->Child[Bit] == NULL) {
+        Ip4PruneRouteTrie (Path, Depth);
+        return NULL;
+      }
+    }
+
+    Node            = Node->Child[Bit];
+    Path[Depth + 1] = Node;
+  }
+
+  return Node;
+}
+
+/**
+  Search the route trie of a single route table for the most specific
+  route entry to the Dst.
+
+  @param[in]   RtTable           The route table to search.
+  @param[in]   Dst               The destination address to search for.
+  @param[out]  Length            The netmask length of the route entry found.
+
+  @return NULL if no route entry matches the Dst, otherwise the most
+          specific route entry.
+
+**/
+IP4_ROUTE_ENTRY *
+Ip4LookupRouteTrie (
+  IN  IP4_ROUTE_TABLE  *RtTable,
+  IN  IP4_ADDR         Dst,
+  OUT UINTN            *Length
+  )
+{
+  IP4_ROUTE_NODE   *Node;
+  IP4_ROUTE_ENTRY  *RtEntry;
+  UINTN            Depth;
+
+  Node    = &RtTable->RouteTrie;
+  RtEntry = Node->RtEntry;
+  *Length = 0;
+
+  for (Depth = 0; Depth < IP4_MASK_MAX; Depth++) {
+    Node = Node->Child[(Dst >> (IP4_MASK_MAX - 1 - Depth)) & 1];
+    if (Node == NULL) {
+      break;
+    }
+
+    if (Node->RtEntry != NULL) {
+      RtEntry = Node->RtEntry;
+      *Length = Depth + 1;
+    }
+  }
+
+  return RtEntry;
+}
+
 /**
   Create an empty route table, includes its internal route cache
 
@@ -194,6 +347,8 @@ Ip4CreateRouteTable (
     InitializeListHead (&(RtTable->RouteArea[Index]));
   }
 
+  ZeroMem (&RtTable->RouteTrie, sizeof (IP4_ROUTE_NODE));
+
   RtTable->Next = NULL;
 
   Ip4InitRouteCache (&RtTable->Cache);
@@ -235,6 +390,7 @@ Ip4FreeRouteTable (
     }
   }
 
+  Ip4CleanRouteTrie (&RtTable->RouteTrie);
   Ip4CleanRouteCache (&RtTable->Cache);
 
   FreePool (RtTable);
@@ -298,12 +454,16 @@ Ip4AddRoute (
   LIST_ENTRY       *Head;
   LIST_ENTRY       *Entry;
   IP4_ROUTE_ENTRY  *RtEntry;
+  IP4_ROUTE_NODE   *Node;
+  IP4_ROUTE_NODE   *Path[IP4_MASK_NUM];
+  UINTN            Length;
 
   //
   // All the route entries with the same netmask length are
   // linke to the same route area
   //
-  Head = &(RtTable->RouteArea[NetGetMaskLength (Netmask)]);
+  Length = NetGetMaskLength (Netmask);
+  Head   = &(RtTable->RouteArea[Length]);
 
   //
   // First check whether the route exists
@@ -316,12 +476,20 @@ Ip4AddRoute (
     }
   }
 
+  Node = Ip4GetRouteNode (RtTable, Dest, Length, TRUE, Path);
+
+  if (Node == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
   //
-  // Create a route entry and insert it to the route area.
+  // Create a route entry and insert it to the route area. Being
+  // the first entry of its network, it also takes the trie node.
   //
   RtEntry = Ip4CreateRouteEntry (Dest, Netmask, Gateway);
 
   if (RtEntry == NULL) {
+    Ip4PruneRouteTrie (Path, Length);
     return EFI_OUT_OF_RESOURCES;
   }
 
@@ -332,6 +500,8 @@ Ip4AddRoute (
   InsertHeadList (Head, &RtEntry->Link);
   RtTable->TotalNum++;
 
+  Node->RtEntry = RtEntry;
+
   return EFI_SUCCESS;
 }
 
@@ -360,8 +530,12 @@ Ip4DelRoute (
   LIST_ENTRY       *Entry;
   LIST_ENTRY       *Next;
   IP4_ROUTE_ENTRY  *RtEntry;
+  IP4_ROUTE_NODE   *Node;
+  IP4_ROUTE_NODE   *Path[IP4_MASK_NUM];
+  UINTN            Length;
 
-  Head = &(RtTable->RouteArea[NetGetMaskLength (Netmask)]);
+  Length = NetGetMaskLength (Netmask);
+  Head   = &(RtTable->RouteArea[Length]);
 
   NET_LIST_FOR_EACH_SAFE (Entry, Next, Head) {
     RtEntry = NET_LIST_USER_STRUCT (Entry, IP4_ROUTE_ENTRY, Link);
@@ -372,6 +546,25 @@ Ip4DelRoute (
       Ip4FreeRouteEntry (RtEntry);
 
       RtTable->TotalNum--;
+
+      //
+      // Hand the trie node over to the next route entry to the same
+      // network, if any, or remove it.
+      //
+      Node = Ip4GetRouteNode (RtTable, Dest, Length, FALSE, Path);
+      ASSERT (Node != NULL);
+
+      Node->RtEntry = NULL;
+      NET_LIST_FOR_EACH (Entry, Head) {
+        RtEntry = NET_LIST_USER_STRUCT (Entry, IP4_ROUTE_ENTRY, Link);
+
+        if (IP4_NET_EQUAL (RtEntry->Dest, Dest, Netmask)) {
+          Node->RtEntry = RtEntry;
+          break;
+        }
+      }
+
+      Ip4PruneRouteTrie (Path, Length);
       return EFI_SUCCESS;
     }
   }
@@ -420,10 +613,9 @@ Ip4FindRouteCache (
 
 /**
   Search the route table for a most specific match to the Dst. It searches
-  from the longest route area (mask length == 32) to the shortest route area
-  (default routes). In each route area, it will first search the instance's
-  route table, then the default route table. This is required by the following
-  requirements:
+  the route trie of the instance's route table, then the one of the default
+  route table, and prefers the instance's route entry if both are equally
+  specific. This is required by the following requirements:
   1. IP search the route table for a most specific match
   2. The local route entries have precedence over the default route entry.
 
@@ -440,27 +632,29 @@ Ip4FindRouteEntry (
   IN IP4_ADDR         Dst
   )
 {
-  LIST_ENTRY       *Entry;
   IP4_ROUTE_ENTRY  *RtEntry;
+  IP4_ROUTE_ENTRY  *BestEntry;
   IP4_ROUTE_TABLE  *Table;
-  INTN             Index;
+  UINTN            Length;
+  UINTN            BestLength;
 
-  RtEntry = NULL;
+  BestEntry  = NULL;
+  BestLength = 0;
 
-  for (Index = IP4_MASK_MAX; Index >= 0; Index--) {
-    for (Table = RtTable; Table != NULL; Table = Table->Next) {
-      NET_LIST_FOR_EACH (Entry, &Table->RouteArea[Index]) {
-        RtEntry = NET_LIST_USER_STRUCT (Entry, IP4_ROUTE_ENTRY, Link);
+  for (Table = RtTable; Table != NULL; Table = Table->Next) {
+    RtEntry = Ip4LookupRouteTrie (Table, Dst, &Length);
 
-        if (IP4_NET_EQUAL (RtEntry->Dest, Dst, RtEntry->Netmask)) {
-          NET_GET_REF (RtEntry);
-          return RtEntry;
-        }
-      }
+    if ((RtEntry != NULL) && ((BestEntry == NULL) || (Length > BestLength))) {
+      BestEntry  = RtEntry;
+      BestLength = Length;
     }
   }
 
-  return NULL;
+  if (BestEntry != NULL) {
+    NET_GET_REF (BestEntry);
+  }
+
+  return BestEntry;
 }
 
 /**
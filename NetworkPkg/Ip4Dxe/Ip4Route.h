@@ -64,13 +64,29 @@ typedef struct {
   LIST_ENTRY    CacheBucket[IP4_ROUTE_CACHE_HASH_VALUE];
 } IP4_ROUTE_CACHE;
 
+///
+/// A node of the binary route trie. The node at depth N stands for
+/// the network formed by the N leading bits on the path from the
+/// root, and RtEntry is the route entry to that network that takes
+/// precedence, that is the first one in its route area. Nodes without
+/// route entry only lead to longer networks.
+///
+typedef struct _IP4_ROUTE_NODE IP4_ROUTE_NODE;
+
+struct _IP4_ROUTE_NODE {
+  IP4_ROUTE_NODE     *Child[2];
+  IP4_ROUTE_ENTRY    *RtEntry;
+};
+
 ///
 /// Each IP4 instance has its own route table. Each ServiceBinding
 /// instance has a default route table and default address.
 ///
 /// All the route table entries with the same mask are linked
 /// together in one route area. For example, RouteArea[0] contains
-/// the default routes. A route table also contains a route cache.
+/// the default routes. The route trie indexes the route areas for
+/// a longest prefix match in at most 32 steps. A route table also
+/// contains a route cache.
 ///
 typedef struct _IP4_ROUTE_TABLE IP4_ROUTE_TABLE;
 
@@ -78,6 +94,7 @@ struct _IP4_ROUTE_TABLE {
   INTN               RefCnt;
   UINT32             TotalNum;
   LIST_ENTRY         RouteArea[IP4_MASK_NUM];
+  IP4_ROUTE_NODE     RouteTrie;
   IP4_ROUTE_TABLE    *Next;
   IP4_ROUTE_CACHE    Cache;
 };
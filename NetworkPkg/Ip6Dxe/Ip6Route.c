@@ -11,12 +11,14 @@
 
 /**
   This is the worker function for IP6_ROUTE_CACHE_HASH(). It calculates the value
-  as the index of the route cache bucket according to the prefix of two IPv6 addresses.
+  as the index of the route cache bucket according to all the 128 bits of two IPv6
+  addresses. Hashing the prefix only would put all the destinations of a link, which
+  share the prefix of the source address, into the same bucket.
 
   @param[in]  Ip1     The IPv6 address.
   @param[in]  Ip2     The IPv6 address.
 
-  @return The hash value of the prefix of two IPv6 addresses.
+  @return The hash value of two IPv6 addresses.
 
 **/
 UINT32
@@ -25,13 +27,15 @@ Ip6RouteCacheHash (
   IN EFI_IPv6_ADDRESS  *Ip2
   )
 {
-  UINT32  Prefix1;
-  UINT32  Prefix2;
+  UINT32  Hash;
+  UINTN   Index;
 
-  Prefix1 = *((UINT32 *)((UINTN *)(Ip1)));
-  Prefix2 = *((UINT32 *)((UINTN *)(Ip2)));
+  Hash = 0;
+  for (Index = 0; Index < sizeof (EFI_IPv6_ADDRESS); Index += sizeof (UINT32)) {
+    Hash ^= ReadUnaligned32 ((UINT32 *)&Ip1->Addr[Index]) ^ ReadUnaligned32 ((UINT32 *)&Ip2->Addr[Index]);
+  }
 
-  return ((UINT32)(Prefix1 ^ Prefix2) % IP6_ROUTE_CACHE_HASH_SIZE);
+  return Hash % IP6_ROUTE_CACHE_HASH_SIZE;
 }
 
 /**
@@ -96,11 +100,196 @@ Ip6FreeRouteEntry (
 }
 
 /**
-  Search the route table for a most specific match to the Dst. It searches
-  from the longest route area (prefix length == 128) to the shortest route area
-  (default routes). In each route area, it will first search the instance's
-  route table, then the default route table. This is required per the following
-  requirements:
+  Free the nodes of the route trie below a node.
+
+  @param[in, out]  Node          The node whose children to free.
+
+**/
+VOID
+Ip6CleanRouteTrie (
+  IN OUT IP6_ROUTE_NODE  *Node
+  )
+{
+  UINT32  Index;
+
+  for (Index = 0; Index < 2; Index++) {
+    if (Node->Child[Index] != NULL) {
+      Ip6CleanRouteTrie (Node->Child[Index]);
+      FreePool (Node->Child[Index]);
+      Node->Child[Index] = NULL;
+    }
+  }
+}
+
+/**
+  Free the nodes at the end of a path of the route trie that neither
+  hold a route entry nor lead to one.
+
+  @param[in, out]  Path          The nodes from the root of the trie, Path[0] is the root.
+  @param[in]       Depth         The depth of the last node of the path.
+
+**/
+VOID
+Ip6PruneRouteTrie (
+  IN OUT IP6_ROUTE_NODE  **Path,
+  IN     UINTN           Depth
+  )
+{
+  IP6_ROUTE_NODE  *Node;
+  IP6_ROUTE_NODE  *Parent;
+
+  for ( ; Depth > 0; Depth--) {
+    Node = Path[Depth];
+
+    if ((Node->RtEntry != NULL) || (Node->Child[0] != NULL) || (Node->Child[1] != NULL)) {
+      break;
+    }
+
+    Parent = Path[Depth - 1];
+
+    if (Parent->Child[0] == Node) {
+      Parent->Child[0] = NULL;
+    } else {
+      Parent->Child[1] = NULL;
+    }
+
+    FreePool (Node);
+  }
+}
+
+/**
+  Walk the route trie to the node of a prefix, and create the missing
+  nodes on the way if requested.
+
+  @param[in]   RtTable       The route table that owns the trie.
+  @param[in]   Destination   The destination network.
+  @param[in]   PrefixLength  The prefix length of the destination network.
+  @param[in]   Create        Whether to create the missing nodes.
+  @param[out]  Path          The nodes from the root to the prefix node,
+                             Path[0] is the root. Holds IP6_PREFIX_NUM nodes.
+
+  @return NULL if the node doesn't exist and can't be created. Otherwise,
+          the node of the prefix.
+
+**/
+IP6_ROUTE_NODE *
+Ip6GetRouteNode (
+  IN  IP6_ROUTE_TABLE   *RtTable,
+  IN  EFI_IPv6_ADDRESS  *Destination,
+  IN  UINTN             PrefixLength,
+  IN  BOOLEAN           Create,
+  OUT IP6_ROUTE_NODE    **Path
+  )
+{
+  IP6_ROUTE_NODE  *Node;
+  UINTN           Depth;
+  UINTN           Bit;
+
+  Node    = &RtTable->RouteTrie;
+  Path[0] = Node;
+
+  for (Depth = 0; Depth < PrefixLength; Depth++) {
+    Bit = (Destination->Addr[Depth / 8] >> (7 - Depth % 8)) & 1;
+
+    if (Node->Child[Bit] == NULL) {
+      if (!Create) {
+        return NULL;
+      }
+
+      Node->Child[Bit] = AllocateZeroPool (sizeof (IP6_ROUTE_NODE));
+      if (Node->Child[Bit] == NULL) {
+        Ip6PruneRouteTrie (Path, Depth);
+        return NULL;
+      }
+    }
+
+    Node            = Node->Child[Bit];
+    Path[Depth + 1] = Node;
+  }
+
+  return Node;
+}
+
+/**
+  Hand the trie node of a prefix over to the first route entry to that
+  prefix in its route area, or remove the node if there is none.
+
+  @param[in, out]  RtTable       The route table that owns the trie.
+  @param[in]       Destination   The destination network.
+  @param[in]       PrefixLength  The prefix length of the destination network.
+
+**/
+VOID
+Ip6RefreshRouteNode (
+  IN OUT IP6_ROUTE_TABLE   *RtTable,
+  IN     EFI_IPv6_ADDRESS  *Destination,
+  IN     UINT8             PrefixLength
+  )
+{
+  IP6_ROUTE_NODE   *Node;
+  IP6_ROUTE_NODE   *Path[IP6_PREFIX_NUM];
+  LIST_ENTRY       *Entry;
+  IP6_ROUTE_ENTRY  *RtEntry;
+
+  Node = Ip6GetRouteNode (RtTable, Destination, PrefixLength, FALSE, Path);
+  if (Node == NULL) {
+    return;
+  }
+
+  Node->RtEntry = NULL;
+  NET_LIST_FOR_EACH (Entry, &RtTable->RouteArea[PrefixLength]) {
+    RtEntry = NET_LIST_USER_STRUCT (Entry, IP6_ROUTE_ENTRY, Link);
+
+    if (NetIp6IsNetEqual (Destination, &RtEntry->Destination, PrefixLength)) {
+      Node->RtEntry = RtEntry;
+      break;
+    }
+  }
+
+  Ip6PruneRouteTrie (Path, PrefixLength);
+}
+
+/**
+  Insert a route entry at the head of its route area in the route table.
+
+  @param[in, out]  RtTable        Route table to insert the route entry to.
+  @param[in]       RtEntry        The route entry to insert.
+
+  @retval EFI_OUT_OF_RESOURCES  Failed to allocate memory for the route trie.
+  @retval EFI_SUCCESS           The route entry was inserted successfully.
+
+**/
+EFI_STATUS
+Ip6InsertRouteEntry (
+  IN OUT IP6_ROUTE_TABLE  *RtTable,
+  IN     IP6_ROUTE_ENTRY  *RtEntry
+  )
+{
+  IP6_ROUTE_NODE  *Node;
+  IP6_ROUTE_NODE  *Path[IP6_PREFIX_NUM];
+
+  Node = Ip6GetRouteNode (RtTable, &RtEntry->Destination, RtEntry->PrefixLength, TRUE, Path);
+  if (Node == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  //
+  // Being the first route entry to its prefix, it takes the trie node.
+  //
+  InsertHeadList (&RtTable->RouteArea[RtEntry->PrefixLength], &RtEntry->Link);
+  RtTable->TotalNum++;
+
+  Node->RtEntry = RtEntry;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Search the route table for a most specific match to the Dst. A search by
+  destination walks the route trie, which yields the route entry with the
+  longest matching prefix. A search by next hop goes from the longest route
+  area (prefix length == 128) to the shortest route area (default routes).
+  This is required per the following requirements:
   1. IP search the route table for a most specific match.
   2. The local route entries have precedence over the default route entry.
 
@@ -123,26 +312,42 @@ Ip6FindRouteEntry (
 {
   LIST_ENTRY       *Entry;
   IP6_ROUTE_ENTRY  *RtEntry;
+  IP6_ROUTE_NODE   *Node;
   INTN             Index;
 
   ASSERT (Destination != NULL || NextHop != NULL);
 
   RtEntry = NULL;
 
+  if (Destination != NULL) {
+    Node    = &RtTable->RouteTrie;
+    RtEntry = Node->RtEntry;
+
+    for (Index = 0; Index < IP6_PREFIX_MAX; Index++) {
+      Node = Node->Child[(Destination->Addr[Index / 8] >> (7 - Index % 8)) & 1];
+      if (Node == NULL) {
+        break;
+      }
+
+      if (Node->RtEntry != NULL) {
+        RtEntry = Node->RtEntry;
+      }
+    }
+
+    if (RtEntry != NULL) {
+      NET_GET_REF (RtEntry);
+    }
+
+    return RtEntry;
+  }
+
   for (Index = IP6_PREFIX_MAX; Index >= 0; Index--) {
     NET_LIST_FOR_EACH (Entry, &RtTable->RouteArea[Index]) {
       RtEntry = NET_LIST_USER_STRUCT (Entry, IP6_ROUTE_ENTRY, Link);
 
-      if (Destination != NULL) {
-        if (NetIp6IsNetEqual (Destination, &RtEntry->Destination, RtEntry->PrefixLength)) {
-          NET_GET_REF (RtEntry);
-          return RtEntry;
-        }
-      } else if (NextHop != NULL) {
-        if (NetIp6IsNetEqual (NextHop, &RtEntry->NextHop, RtEntry->PrefixLength)) {
-          NET_GET_REF (RtEntry);
-          return RtEntry;
-        }
+      if (NetIp6IsNetEqual (NextHop, &RtEntry->NextHop, RtEntry->PrefixLength)) {
+        NET_GET_REF (RtEntry);
+        return RtEntry;
       }
     }
   }
@@ -342,6 +547,8 @@ Ip6CreateRouteTable (
     InitializeListHead (&RtTable->RouteArea[Index]);
   }
 
+  ZeroMem (&RtTable->RouteTrie, sizeof (IP6_ROUTE_NODE));
+
   for (Index = 0; Index < IP6_ROUTE_CACHE_HASH_SIZE; Index++) {
     InitializeListHead (&RtTable->Cache.CacheBucket[Index]);
     RtTable->Cache.CacheNum[Index] = 0;
@@ -393,6 +600,8 @@ Ip6CleanRouteTable (
     }
   }
 
+  Ip6CleanRouteTrie (&RtTable->RouteTrie);
+
   FreePool (RtTable);
 }
 
@@ -482,8 +691,10 @@ Ip6AddRoute (
     Route->Flag = IP6_DIRECT_ROUTE;
   }
 
-  InsertHeadList (ListHead, &Route->Link);
-  RtTable->TotalNum++;
+  if (EFI_ERROR (Ip6InsertRouteEntry (RtTable, Route))) {
+    Ip6FreeRouteEntry (Route);
+    return EFI_OUT_OF_RESOURCES;
+  }
 
   return EFI_SUCCESS;
 }
@@ -510,11 +721,12 @@ Ip6DelRoute (
   IN EFI_IPv6_ADDRESS     *GatewayAddress
   )
 {
-  LIST_ENTRY       *ListHead;
-  LIST_ENTRY       *Entry;
-  LIST_ENTRY       *Next;
-  IP6_ROUTE_ENTRY  *Route;
-  UINT32           TotalNum;
+  LIST_ENTRY        *ListHead;
+  LIST_ENTRY        *Entry;
+  LIST_ENTRY        *Next;
+  IP6_ROUTE_ENTRY   *Route;
+  UINT32            TotalNum;
+  EFI_IPv6_ADDRESS  RouteDestination;
 
   ListHead = &RtTable->RouteArea[PrefixLength];
   TotalNum = RtTable->TotalNum;
@@ -530,12 +742,16 @@ Ip6DelRoute (
       continue;
     }
 
+    IP6_COPY_ADDRESS (&RouteDestination, &Route->Destination);
+
     Ip6PurgeRouteCache (&RtTable->Cache, (UINTN)Route);
     RemoveEntryList (Entry);
     Ip6FreeRouteEntry (Route);
 
     ASSERT (RtTable->TotalNum > 0);
     RtTable->TotalNum--;
+
+    Ip6RefreshRouteNode (RtTable, &RouteDestination, PrefixLength);
   }
 
   return TotalNum == RtTable->TotalNum ? EFI_NOT_FOUND : EFI_SUCCESS;
@@ -44,30 +44,49 @@ typedef struct {
   UINT8         CacheNum[IP6_ROUTE_CACHE_HASH_SIZE];
 } IP6_ROUTE_CACHE;
 
+//
+// A node of the binary route trie. The node at depth N stands for
+// the prefix formed by the N leading bits on the path from the root,
+// and RtEntry is the route entry to that prefix that takes precedence,
+// that is the first one in its route area. Nodes without route entry
+// only lead to longer prefixes.
+//
+typedef struct _IP6_ROUTE_NODE IP6_ROUTE_NODE;
+
+struct _IP6_ROUTE_NODE {
+  IP6_ROUTE_NODE     *Child[2];
+  IP6_ROUTE_ENTRY    *RtEntry;
+};
+
 //
 // Each IP6 instance has its own route table. Each ServiceBinding
 // instance has a default route table and default address.
 //
 // All the route table entries with the same prefix length are linked
 // together in one route area. For example, RouteArea[0] contains
-// the default routes. A route table also contains a route cache.
+// the default routes. The route trie indexes the route areas for a
+// longest prefix match in at most 128 steps. A route table also
+// contains a route cache.
 //
 
 typedef struct _IP6_ROUTE_TABLE {
   INTN               RefCnt;
   UINT32             TotalNum;
   LIST_ENTRY         RouteArea[IP6_PREFIX_NUM];
+  IP6_ROUTE_NODE     RouteTrie;
   IP6_ROUTE_CACHE    Cache;
 } IP6_ROUTE_TABLE;
 
 /**
   This is the worker function for IP6_ROUTE_CACHE_HASH(). It calculates the value
-  as the index of the route cache bucket according to the prefix of two IPv6 addresses.
+  as the index of the route cache bucket according to all the 128 bits of two IPv6
+  addresses. Hashing the prefix only would put all the destinations of a link, which
+  share the prefix of the source address, into the same bucket.
 
   @param[in]  Ip1     The IPv6 address.
   @param[in]  Ip2     The IPv6 address.
 
-  @return The hash value of the prefix of two IPv6 addresses.
+  @return The hash value of two IPv6 addresses.
 
 **/
 UINT32
@@ -228,6 +247,22 @@ Ip6FreeRouteEntry (
   IN OUT IP6_ROUTE_ENTRY  *RtEntry
   );
 
+/**
+  Insert a route entry at the head of its route area in the route table.
+
+  @param[in, out]  RtTable        Route table to insert the route entry to.
+  @param[in]       RtEntry        The route entry to insert.
+
+  @retval EFI_OUT_OF_RESOURCES  Failed to allocate memory for the route trie.
+  @retval EFI_SUCCESS           The route entry was inserted successfully.
+
+**/
+EFI_STATUS
+Ip6InsertRouteEntry (
+  IN OUT IP6_ROUTE_TABLE  *RtTable,
+  IN     IP6_ROUTE_ENTRY  *RtEntry
+  );
+
 /**
   Add a route entry to the route table. It is the help function for EfiIp6Routes.
 
@@ -1617,30 +1617,69 @@ NetblockChecksum (
   IN UINT32  Len
   )
 {
-  register UINT32  Sum;
+  UINT64   Sum;
+  BOOLEAN  Odd;
 
   Sum = 0;
+  Odd = FALSE;
 
   //
-  // Add left-over byte, if any
+  // The one's complement sum is independent of the byte order and of the
+  // word size (RFC 1071), so the data is summed 32 bits at a time from an
+  // aligned address into a 64-bit accumulator, which cannot overflow for
+  // any UINT32 Len. Starting at an odd address shifts every byte by one
+  // position; swapping the bytes of the result undoes that.
   //
-  if (Len % 2 != 0) {
-    Sum += *(Bulk + Len - 1);
+  if ((Len > 0) && (((UINTN)Bulk & 0x01) != 0)) {
+    Sum = (UINT64)*Bulk << 8;
+    Bulk++;
+    Len--;
+    Odd = TRUE;
   }
 
-  while (Len > 1) {
+  if ((Len >= 2) && (((UINTN)Bulk & 0x02) != 0)) {
     Sum  += *(UINT16 *)Bulk;
     Bulk += 2;
     Len  -= 2;
   }
 
+  while (Len >= 16) {
+    Sum  += (UINT64)((UINT32 *)Bulk)[0] + ((UINT32 *)Bulk)[1] +
+            ((UINT32 *)Bulk)[2] + ((UINT32 *)Bulk)[3];
+    Bulk += 16;
+    Len  -= 16;
+  }
+
+  while (Len >= 4) {
+    Sum  += *(UINT32 *)Bulk;
+    Bulk += 4;
+    Len  -= 4;
+  }
+
+  if (Len >= 2) {
+    Sum  += *(UINT16 *)Bulk;
+    Bulk += 2;
+    Len  -= 2;
+  }
+
+  //
+  // Add left-over byte, if any
+  //
+  if (Len != 0) {
+    Sum += *Bulk;
+  }
+
   //
-  // Fold 32-bit sum to 16 bits
+  // Fold 64-bit sum to 16 bits
   //
   while ((Sum >> 16) != 0) {
     Sum = (Sum & 0xffff) + (Sum >> 16);
   }
 
+  if (Odd) {
+    Sum = SwapBytes16 ((UINT16)Sum);
+  }
+
   return (UINT16)Sum;
 }
 
@@ -182,6 +182,16 @@ MnpFreeNbuf (
   NET_PUT_REF (Nbuf);
 
   if (Nbuf->RefCnt == 1) {
+    if (Nbuf->Vector->Free == MnpReleaseLoanedFrame) {
+      //
+      // The Nbuf wraps a frame lent by the network driver, not a buffer from
+      // the pool. Free it, which gives the frame back to the driver.
+      //
+      NetbufFree (Nbuf);
+      gBS->RestoreTPL (OldTpl);
+      return;
+    }
+
     //
     // Trim all buffer contained in the Nbuf, then append it to the NbufQue.
     //
@@ -457,6 +467,21 @@ MnpInitializeDeviceData (
   SnpMode            = Snp->Mode;
   MnpDeviceData->Snp = Snp;
 
+  //
+  // Let the network driver lend received frames to us, if it can.
+  //
+  Status = gBS->OpenProtocol (
+                  ControllerHandle,
+                  &gEdkiiSimpleNetworkRxLoanProtocolGuid,
+                  (VOID **)&MnpDeviceData->RxLoan,
+                  ImageHandle,
+                  ControllerHandle,
+                  EFI_OPEN_PROTOCOL_GET_PROTOCOL
+                  );
+  if (EFI_ERROR (Status)) {
+    MnpDeviceData->RxLoan = NULL;
+  }
+
   //
   // Initialize the lists.
   //
@@ -1273,6 +1298,7 @@ MnpStart (
     }
 
     MnpDeviceData->EnableSystemPoll = EnableSystemPoll;
+    MnpDeviceData->BusyPoll         = FALSE;
   }
 
   //
@@ -1332,6 +1358,7 @@ MnpStop (
     //
     Status                          = gBS->SetTimer (MnpDeviceData->PollTimer, TimerCancel, 0);
     MnpDeviceData->EnableSystemPoll = FALSE;
+    MnpDeviceData->BusyPoll         = FALSE;
   }
 
   //
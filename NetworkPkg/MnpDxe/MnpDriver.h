@@ -13,6 +13,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include <Protocol/ManagedNetwork.h>
 #include <Protocol/SimpleNetwork.h>
+#include <Protocol/SimpleNetworkRxLoan.h>
 #include <Protocol/ServiceBinding.h>
 #include <Protocol/VlanConfig.h>
 
@@ -38,53 +39,62 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 extern  EFI_DRIVER_BINDING_PROTOCOL  gMnpDriverBinding;
 
 typedef struct {
-  UINT32                         Signature;
+  UINT32                                   Signature;
 
-  EFI_HANDLE                     ControllerHandle;
-  EFI_HANDLE                     ImageHandle;
+  EFI_HANDLE                               ControllerHandle;
+  EFI_HANDLE                               ImageHandle;
 
-  EFI_VLAN_CONFIG_PROTOCOL       VlanConfig;
-  UINTN                          NumberOfVlan;
-  CHAR16                         *MacString;
-  EFI_SIMPLE_NETWORK_PROTOCOL    *Snp;
+  EFI_VLAN_CONFIG_PROTOCOL                 VlanConfig;
+  UINTN                                    NumberOfVlan;
+  CHAR16                                   *MacString;
+  EFI_SIMPLE_NETWORK_PROTOCOL              *Snp;
+  //
+  // Optional, lends received frames to MNP so that they need not be copied
+  //
+  EDKII_SIMPLE_NETWORK_RX_LOAN_PROTOCOL    *RxLoan;
 
   //
   // List of MNP_SERVICE_DATA
   //
-  LIST_ENTRY                     ServiceList;
+  LIST_ENTRY                               ServiceList;
   //
   // Number of configured MNP Service Binding child
   //
-  UINTN                          ConfiguredChildrenNumber;
+  UINTN                                    ConfiguredChildrenNumber;
 
-  LIST_ENTRY                     GroupAddressList;
-  UINT32                         GroupAddressCount;
+  LIST_ENTRY                               GroupAddressList;
+  UINT32                                   GroupAddressCount;
 
-  LIST_ENTRY                     FreeTxBufList;
-  LIST_ENTRY                     AllTxBufList;
-  UINT32                         TxBufCount;
+  LIST_ENTRY                               FreeTxBufList;
+  LIST_ENTRY                               AllTxBufList;
+  UINT32                                   TxBufCount;
 
-  NET_BUF_QUEUE                  FreeNbufQue;
-  INTN                           NbufCnt;
+  NET_BUF_QUEUE                            FreeNbufQue;
+  INTN                                     NbufCnt;
 
-  EFI_EVENT                      PollTimer;
-  BOOLEAN                        EnableSystemPoll;
+  EFI_EVENT                                PollTimer;
+  BOOLEAN                                  EnableSystemPoll;
+  //
+  // TRUE if the poll timer runs at MNP_BUSY_POLL_INTERVAL instead of
+  // MNP_SYS_POLL_INTERVAL.
+  //
+  BOOLEAN                                  BusyPoll;
 
-  EFI_EVENT                      TimeoutCheckTimer;
-  EFI_EVENT                      MediaDetectTimer;
+  EFI_EVENT                                TimeoutCheckTimer;
+  EFI_EVENT                                MediaDetectTimer;
 
-  UINT32                         UnicastCount;
-  UINT32                         BroadcastCount;
-  UINT32                         MulticastCount;
-  UINT32                         PromiscuousCount;
+  UINT32                                   UnicastCount;
+  UINT32                                   BroadcastCount;
+  UINT32                                   MulticastCount;
+  UINT32                                   PromiscuousCount;
 
   //
   // The size of the data buffer in the MNP_PACKET_BUFFER used to
   // store a packet.
   //
-  UINT32                         BufferLength;
-  UINT32                         PaddingSize;
-  NET_BUF                        *RxNbufCache;
+  UINT32                                   BufferLength;
+  UINT32                                   PaddingSize;
+  NET_BUF                                  *RxNbufCache;
 } MNP_DEVICE_DATA;
 
 #define MNP_DEVICE_DATA_FROM_THIS(a) \
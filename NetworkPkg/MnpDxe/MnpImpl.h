@@ -14,6 +14,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define NET_ETHER_FCS_SIZE  4
 
 #define MNP_SYS_POLL_INTERVAL        (10 * TICKS_PER_MS)    // 10 milliseconds
+#define MNP_BUSY_POLL_INTERVAL       (1 * TICKS_PER_MS)     // 1 millisecond
 #define MNP_TIMEOUT_CHECK_INTERVAL   (50 * TICKS_PER_MS)    // 50 milliseconds
 #define MNP_MEDIA_DETECT_INTERVAL    (500 * TICKS_PER_MS)   // 500 milliseconds
 #define MNP_TX_TIMEOUT_TIME          (500 * TICKS_PER_MS)   // 500 milliseconds
@@ -22,6 +23,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define MNP_MAX_NET_BUFFER_NUM       65536
 #define MNP_TX_BUFFER_INCREASEMENT   32     // Same as the recycling Q length for xmit_done in UNDI command.
 #define MNP_MAX_TX_BUFFER_NUM        65536
+#define MNP_RX_BATCH_MAX             32     // Frames received per system poll at most.
 
 #define MNP_MAX_RCVD_PACKET_QUE_SIZE  256
 
@@ -414,6 +416,36 @@ MnpRecycleRxData (
   IN VOID       *Context
   );
 
+/**
+  Give a frame lent by the EDKII_SIMPLE_NETWORK_RX_LOAN_PROTOCOL back to the
+  network driver once the last reference to the NET_BUF wrapping it is dropped.
+
+  @param[in]  Arg               Pointer to the EDKII_SIMPLE_NETWORK_RX_LOAN_FRAME.
+
+**/
+VOID
+EFIAPI
+MnpReleaseLoanedFrame (
+  IN VOID  *Arg
+  );
+
+/**
+  Try to receive a packet lent by the network driver and deliver it.
+
+  @param[in, out]  MnpDeviceData        Pointer to the mnp device context data.
+
+  @retval EFI_SUCCESS           A packet has been received.
+  @retval EFI_NOT_READY         No packet received.
+  @retval EFI_OUT_OF_RESOURCES  The network driver has lent out as many
+                                packets as it is willing to.
+  @retval EFI_DEVICE_ERROR      An unexpected error occurs.
+
+**/
+EFI_STATUS
+MnpReceiveLoanedPacket (
+  IN OUT MNP_DEVICE_DATA  *MnpDeviceData
+  );
+
 /**
   Try to receive a packet and deliver it.
 
@@ -517,10 +549,30 @@ MnpCheckMediaStatus (
   IN VOID       *Context
   );
 
+/**
+  Check whether any configured instance on the device has a receive token
+  waiting for a packet.
+
+  @param[in]  MnpDeviceData        Pointer to the mnp device context data.
+
+  @retval TRUE                     At least one receive token is pending.
+  @retval FALSE                    No receive token is pending.
+
+**/
+BOOLEAN
+MnpRxTokenPending (
+  IN MNP_DEVICE_DATA  *MnpDeviceData
+  );
+
 /**
   Poll to receive the packets from Snp. This function is either called by upperlayer
   protocols/applications or the system poll timer notify mechanism.
 
+  Up to MNP_RX_BATCH_MAX packets are received per call. While packets keep
+  arriving and there are receive tokens waiting for them, the poll timer is
+  switched to MNP_BUSY_POLL_INTERVAL; it falls back to MNP_SYS_POLL_INTERVAL
+  once the link goes idle or nobody is receiving.
+
   @param[in]  Event        The event this notify function registered to.
   @param[in]  Context      Pointer to the context data registered to the event.
 
@@ -813,6 +813,119 @@ MnpEnqueuePacket (
   }
 }
 
+/**
+  Give a frame lent by the EDKII_SIMPLE_NETWORK_RX_LOAN_PROTOCOL back to the
+  network driver once the last reference to the NET_BUF wrapping it is dropped.
+
+  @param[in]  Arg               Pointer to the EDKII_SIMPLE_NETWORK_RX_LOAN_FRAME.
+
+**/
+VOID
+EFIAPI
+MnpReleaseLoanedFrame (
+  IN VOID  *Arg
+  )
+{
+  EDKII_SIMPLE_NETWORK_RX_LOAN_FRAME  *Frame;
+
+  Frame = (EDKII_SIMPLE_NETWORK_RX_LOAN_FRAME *)Arg;
+  Frame->Release (Frame);
+}
+
+/**
+  Try to receive a packet lent by the network driver and deliver it.
+
+  @param[in, out]  MnpDeviceData        Pointer to the mnp device context data.
+
+  @retval EFI_SUCCESS           A packet has been received.
+  @retval EFI_NOT_READY         No packet received.
+  @retval EFI_OUT_OF_RESOURCES  The network driver has lent out as many
+                                packets as it is willing to.
+  @retval EFI_DEVICE_ERROR      An unexpected error occurs.
+
+**/
+EFI_STATUS
+MnpReceiveLoanedPacket (
+  IN OUT MNP_DEVICE_DATA  *MnpDeviceData
+  )
+{
+  EFI_STATUS                             Status;
+  EDKII_SIMPLE_NETWORK_RX_LOAN_PROTOCOL  *RxLoan;
+  EDKII_SIMPLE_NETWORK_RX_LOAN_FRAME     *Frame;
+  NET_FRAGMENT                           Fragment;
+  NET_BUF                                *Nbuf;
+  MNP_SERVICE_DATA                       *MnpServiceData;
+  UINT16                                 VlanId;
+  BOOLEAN                                Delivered;
+
+  RxLoan = MnpDeviceData->RxLoan;
+  Status = RxLoan->Receive (RxLoan, &Frame);
+  if (EFI_ERROR (Status)) {
+    DEBUG_CODE_BEGIN ();
+    if ((Status != EFI_NOT_READY) && (Status != EFI_OUT_OF_RESOURCES)) {
+      DEBUG ((DEBUG_WARN, "MnpReceiveLoanedPacket: RxLoan->Receive() = %r.\n", Status));
+    }
+
+    DEBUG_CODE_END ();
+
+    return Status;
+  }
+
+  //
+  // Sanity check.
+  //
+  if (Frame->Length < MnpDeviceData->Snp->Mode->MediaHeaderSize) {
+    DEBUG ((DEBUG_WARN, "MnpReceiveLoanedPacket: Size error, TL = %d.\n", Frame->Length));
+    Frame->Release (Frame);
+    return EFI_DEVICE_ERROR;
+  }
+
+  //
+  // Wrap the frame in place. The NET_BUF takes the same references as the
+  // ones from MnpAllocNbuf(), so that MnpFreeNbuf() can drop them in the
+  // same way; the frame is given back when the last one is gone.
+  //
+  Fragment.Bulk = Frame->Buffer;
+  Fragment.Len  = (UINT32)Frame->Length;
+  Nbuf          = NetbufFromExt (&Fragment, 1, 0, 0, MnpReleaseLoanedFrame, Frame);
+  if (Nbuf == NULL) {
+    Frame->Release (Frame);
+    return EFI_DEVICE_ERROR;
+  }
+
+  NET_GET_REF (Nbuf);
+
+  VlanId = 0;
+  if (MnpDeviceData->NumberOfVlan != 0) {
+    //
+    // VLAN is configured, remove the VLAN tag if any
+    //
+    MnpRemoveVlanTag (MnpDeviceData, Nbuf, &VlanId);
+  }
+
+  //
+  // Enqueue the packet to the matched instances, if any. Frames on VLANs that
+  // are not configured, and frames without a receiver, are simply released.
+  //
+  Delivered      = FALSE;
+  MnpServiceData = MnpFindServiceData (MnpDeviceData, VlanId);
+  if (MnpServiceData != NULL) {
+    MnpEnqueuePacket (MnpServiceData, Nbuf);
+    Delivered = (BOOLEAN)(Nbuf->RefCnt > 2);
+  }
+
+  MnpFreeNbuf (MnpDeviceData, Nbuf);
+
+  if (Delivered) {
+    //
+    // Deliver the queued packets.
+    //
+    MnpDeliverPacket (MnpServiceData);
+  }
+
+  return EFI_SUCCESS;
+}
+
 /**
   Try to receive a packet and deliver it.
 
@@ -850,6 +963,18 @@ MnpReceivePacket (
     return EFI_NOT_STARTED;
   }
 
+  if (MnpDeviceData->RxLoan != NULL) {
+    Status = MnpReceiveLoanedPacket (MnpDeviceData);
+    if (Status != EFI_OUT_OF_RESOURCES) {
+      return Status;
+    }
+
+    //
+    // The network driver has lent out all the frames it is willing to, until
+    // the upper layers release some; copy this one into our own buffer.
+    //
+  }
+
   if (MnpDeviceData->RxNbufCache == NULL) {
     //
     // Try to get a new buffer as there may be buffers recycled.
@@ -1083,10 +1208,51 @@ MnpCheckMediaStatus (
   }
 }
 
+/**
+  Check whether any configured instance on the device has a receive token
+  waiting for a packet.
+
+  @param[in]  MnpDeviceData        Pointer to the mnp device context data.
+
+  @retval TRUE                     At least one receive token is pending.
+  @retval FALSE                    No receive token is pending.
+
+**/
+BOOLEAN
+MnpRxTokenPending (
+  IN MNP_DEVICE_DATA  *MnpDeviceData
+  )
+{
+  MNP_SERVICE_DATA   *MnpServiceData;
+  MNP_INSTANCE_DATA  *Instance;
+  LIST_ENTRY         *ServiceEntry;
+  LIST_ENTRY         *Entry;
+
+  NET_LIST_FOR_EACH (ServiceEntry, &MnpDeviceData->ServiceList) {
+    MnpServiceData = MNP_SERVICE_DATA_FROM_LINK (ServiceEntry);
+
+    NET_LIST_FOR_EACH (Entry, &MnpServiceData->ChildrenList) {
+      Instance = NET_LIST_USER_STRUCT (Entry, MNP_INSTANCE_DATA, InstEntry);
+      NET_CHECK_SIGNATURE (Instance, MNP_INSTANCE_DATA_SIGNATURE);
+
+      if (Instance->Configured && !NetMapIsEmpty (&Instance->RxTokenMap)) {
+        return TRUE;
+      }
+    }
+  }
+
+  return FALSE;
+}
+
 /**
   Poll to receive the packets from Snp. This function is either called by upperlayer
   protocols/applications or the system poll timer notify mechanism.
 
+  Up to MNP_RX_BATCH_MAX packets are received per call. While packets keep
+  arriving and there are receive tokens waiting for them, the poll timer is
+  switched to MNP_BUSY_POLL_INTERVAL; it falls back to MNP_SYS_POLL_INTERVAL
+  once the link goes idle or nobody is receiving.
+
   @param[in]  Event        The event this notify function registered to.
   @param[in]  Context      Pointer to the context data registered to the event.
 
@@ -1099,17 +1265,42 @@ MnpSystemPoll (
   )
 {
   MNP_DEVICE_DATA  *MnpDeviceData;
+  UINTN            Received;
+  BOOLEAN          BusyPoll;
 
   MnpDeviceData = (MNP_DEVICE_DATA *)Context;
   NET_CHECK_SIGNATURE (MnpDeviceData, MNP_DEVICE_DATA_SIGNATURE);
 
   //
-  // Try to receive packets from Snp.
+  // Try to receive packets from Snp, until it has none left or the batch
+  // is full.
   //
-  MnpReceivePacket (MnpDeviceData);
+  for (Received = 0; Received < MNP_RX_BATCH_MAX; Received++) {
+    if (EFI_ERROR (MnpReceivePacket (MnpDeviceData))) {
+      break;
+    }
+  }
 
   //
   // Dispatch the DPC queued by the NotifyFunction of rx token's events.
   //
   DispatchDpc ();
+
+  if (!MnpDeviceData->EnableSystemPoll) {
+    return;
+  }
+
+  //
+  // The upper layers may have queued new receive tokens from the DPCs, so
+  // check for pending tokens only now.
+  //
+  BusyPoll = (BOOLEAN)((Received > 0) && MnpRxTokenPending (MnpDeviceData));
+  if (BusyPoll != MnpDeviceData->BusyPoll) {
+    gBS->SetTimer (
+           MnpDeviceData->PollTimer,
+           TimerPeriodic,
+           BusyPoll ? MNP_BUSY_POLL_INTERVAL : MNP_SYS_POLL_INTERVAL
+           );
+    MnpDeviceData->BusyPoll = BusyPoll;
+  }
 }
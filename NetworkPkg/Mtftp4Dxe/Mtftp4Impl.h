@@ -126,6 +126,12 @@ struct _MTFTP4_PROTOCOL {
   //
   UINT64                    AckedBlock;
 
+  //
+  // Whether the blocks following a lost one in the current window
+  // have been answered with an ACK already.
+  //
+  BOOLEAN                   GapAcked;
+
   //
   // The server's communication end point: IP and two ports. one for
   // initial request, one for its selected port.
@@ -264,12 +264,28 @@ Mtftp4RrqHandleData (
   // expected one. If we are passive (Slave), save the block.
   //
   if (Instance->Master && (Expected != BlockNum)) {
+    //
+    // After a block of the window is lost, the following blocks of the
+    // window all arrive out of order. Ack them only once, since the server
+    // restarts the window for each ACK it receives (RFC 7440). The timer
+    // retransmits the ACK if it is lost.
+    //
+    if ((UINT16)(BlockNum - Expected) < Instance->WindowSize) {
+      if (Instance->GapAcked) {
+        return EFI_SUCCESS;
+      }
+
+      Instance->GapAcked = TRUE;
+    }
+
     //
     // If Expected is 0, (UINT16) (Expected - 1) is also the expected Ack number (65535).
     //
     return Mtftp4RrqSendAck (Instance, (UINT16)(Expected - 1));
   }
 
+  Instance->GapAcked = FALSE;
+
   Status = Mtftp4RrqSaveBlock (Instance, Packet, Len);
 
   if (EFI_ERROR (Status)) {
@@ -86,6 +86,12 @@ struct _MTFTP6_INSTANCE {
   //
   UINT64                    AckedBlock;
 
+  //
+  // Whether the blocks following a lost one in the current window
+  // have been answered with an ACK already.
+  //
+  BOOLEAN                   GapAcked;
+
   EFI_IPv6_ADDRESS          ServerIp;
   UINT16                    ServerCmdPort;
   UINT16                    ServerDataPort;
@@ -241,12 +241,28 @@ Mtftp6RrqHandleData (
     NetbufFree (*UdpPacket);
     *UdpPacket = NULL;
 
+    //
+    // After a block of the window is lost, the following blocks of the
+    // window all arrive out of order. Ack them only once, since the server
+    // restarts the window for each ACK it receives (RFC 7440). The timer
+    // retransmits the ACK if it is lost.
+    //
+    if ((UINT16)(BlockNum - Expected) < Instance->WindowSize) {
+      if (Instance->GapAcked) {
+        return EFI_SUCCESS;
+      }
+
+      Instance->GapAcked = TRUE;
+    }
+
     //
     // If Expected is 0, (UINT16) (Expected - 1) is also the expected Ack number (65535).
     //
     return Mtftp6RrqSendAck (Instance, (UINT16)(Expected - 1));
   }
 
+  Instance->GapAcked = FALSE;
+
   Status = Mtftp6RrqSaveBlock (Instance, Packet, Len, UdpPacket);
 
   if (EFI_ERROR (Status)) {
@@ -337,7 +353,7 @@ Mtftp6RrqOackValid (
   // return the timeout matches that requested.
   //
   if ((((ReplyInfo->BitMap & MTFTP6_OPT_BLKSIZE_BIT) != 0) && (ReplyInfo->BlkSize > RequestInfo->BlkSize)) ||
-      (((ReplyInfo->BitMap & MTFTP6_OPT_WINDOWSIZE_BIT) != 0) && (ReplyInfo->BlkSize > RequestInfo->BlkSize)) ||
+      (((ReplyInfo->BitMap & MTFTP6_OPT_WINDOWSIZE_BIT) != 0) && (ReplyInfo->WindowSize > RequestInfo->WindowSize)) ||
       (((ReplyInfo->BitMap & MTFTP6_OPT_TIMEOUT_BIT) != 0) && (ReplyInfo->Timeout != RequestInfo->Timeout))
       )
   {
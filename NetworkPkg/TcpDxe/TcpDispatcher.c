@@ -610,7 +610,7 @@ TcpConfigurePcb (
       Sk,
       (UINT32)(TCP_COMP_VAL (
                  TCP_RCV_BUF_SIZE_MIN,
-                 TCP_RCV_BUF_SIZE,
+                 TCP_RCV_BUF_SIZE_MAX,
                  TCP_RCV_BUF_SIZE,
                  Option->ReceiveBufferSize
                  )
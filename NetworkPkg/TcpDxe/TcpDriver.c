@@ -47,8 +47,8 @@ SOCK_INIT_DATA  mTcpDefaultSockData = {
   SO_CLOSED,
   NULL,
   TCP_BACKLOG,
-  TCP_SND_BUF_SIZE,
-  TCP_RCV_BUF_SIZE,
+  0,
+  0,
   IP_VERSION_4,
   NULL,
   TcpCreateSocketCallback,
@@ -973,6 +973,8 @@ TcpServiceBindingCreateChild (
   mTcpDefaultSockData.DataSize      = sizeof (TCP_PROTO_DATA);
   mTcpDefaultSockData.DriverBinding = TcpServiceData->DriverBindingHandle;
   mTcpDefaultSockData.IpVersion     = TcpServiceData->IpVersion;
+  mTcpDefaultSockData.SndBufferSize = TCP_SND_BUF_SIZE;
+  mTcpDefaultSockData.RcvBufferSize = TCP_RCV_BUF_SIZE;
 
   if (TcpServiceData->IpVersion == IP_VERSION_4) {
     mTcpDefaultSockData.Protocol = &gTcp4ProtocolTemplate;
@@ -449,6 +449,22 @@ TcpVerifySegment (
 // Functions from TcpInput.c
 //
 
+/**
+  Compute the slow start threshold after a loss is detected, by
+  either fast retransmission or retransmission timeout.
+
+  @param[in, out]  Tcb         Pointer to the TCP_CB of this TCP instance.
+  @param[in]       FlightSize  The amount of data sent but not yet ACKed.
+
+  @return The new slow start threshold.
+
+**/
+UINT32
+TcpCongestSsthresh (
+  IN OUT TCP_CB  *Tcb,
+  IN     UINT32  FlightSize
+  );
+
 /**
   Process the received ICMP error messages for TCP.
 
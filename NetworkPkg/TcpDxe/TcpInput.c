@@ -29,6 +29,217 @@ TcpSeqAcceptable (
           TCP_SEQ_LT (Seg->Seq, Tcb->RcvWl2 + Tcb->RcvWnd));
 }
 
+/**
+  Compute the integer cube root of a value.
+
+  @param[in]  Value    The value to compute the cube root of, less than 2^63.
+
+  @return The largest integer whose cube isn't greater than Value.
+
+**/
+UINT32
+TcpCubeRoot (
+  IN UINT64  Value
+  )
+{
+  UINT32  Root;
+  UINT32  Bit;
+  UINT32  Try;
+
+  Root = 0;
+  for (Bit = 1 << 20; Bit != 0; Bit >>= 1) {
+    Try = Root | Bit;
+    if (MultU64x32 (MultU64x32 (Try, Try), Try) <= Value) {
+      Root = Try;
+    }
+  }
+
+  return Root;
+}
+
+/**
+  Compute the slow start threshold after a loss is detected, by
+  either fast retransmission or retransmission timeout.
+
+  @param[in, out]  Tcb         Pointer to the TCP_CB of this TCP instance.
+  @param[in]       FlightSize  The amount of data sent but not yet ACKed.
+
+  @return The new slow start threshold.
+
+**/
+UINT32
+TcpCongestSsthresh (
+  IN OUT TCP_CB  *Tcb,
+  IN     UINT32  FlightSize
+  )
+{
+  if (PcdGet8 (PcdTcpCongestionControl) != TCP_CONGEST_CTRL_CUBIC) {
+    return MAX (FlightSize >> 1, (UINT32)(2 * Tcb->SndMss));
+  }
+
+  //
+  // RFC8312 section 4.5 and 4.6: multiplicative decrease with
+  // beta_cubic 0.7, and fast convergence that releases bandwidth
+  // to new flows if the window keeps shrinking.
+  //
+  if (Tcb->CWnd < Tcb->CubicLastWMax) {
+    Tcb->CubicWMax = (UINT32)DivU64x32 (MultU64x32 (Tcb->CWnd, 17), 20);
+  } else {
+    Tcb->CubicWMax = Tcb->CWnd;
+  }
+
+  Tcb->CubicLastWMax = Tcb->CWnd;
+  Tcb->CubicWEst     = 0;
+
+  return MAX ((UINT32)DivU64x32 (MultU64x32 (Tcb->CWnd, 7), 10), (UINT32)(2 * Tcb->SndMss));
+}
+
+/**
+  Increase the congestion window in congestion avoidance on
+  receiving an ACK that acknowledges new data.
+
+  @param[in, out]  Tcb      Pointer to the TCP_CB of this TCP instance.
+
+**/
+VOID
+TcpCongestAvoid (
+  IN OUT TCP_CB  *Tcb
+  )
+{
+  UINT32  Elapsed;
+  UINT32  Offset;
+  UINT64  Delta;
+  UINT64  Target;
+  UINT32  Increase;
+
+  if (PcdGet8 (PcdTcpCongestionControl) != TCP_CONGEST_CTRL_CUBIC) {
+    Tcb->CWnd += MAX (Tcb->SndMss * Tcb->SndMss / Tcb->CWnd, 1);
+    return;
+  }
+
+  //
+  // RFC8312 section 4.1: start a new epoch on the first ACK
+  // in congestion avoidance. K is the time in ms to grow back
+  // to CubicWMax, with C 0.4, K = cbrt ((WMax - CWnd) / C).
+  //
+  if (Tcb->CubicWEst == 0) {
+    Tcb->CubicEpoch = mTcpTick;
+    Tcb->CubicWEst  = Tcb->CWnd;
+
+    if (Tcb->CWnd < Tcb->CubicWMax) {
+      Tcb->CubicK = TcpCubeRoot (
+                      DivU64x32 (
+                        MultU64x32 (Tcb->CubicWMax - Tcb->CWnd, 2500000000U),
+                        Tcb->SndMss
+                        )
+                      );
+      Tcb->CubicOrigin = Tcb->CubicWMax;
+    } else {
+      Tcb->CubicK      = 0;
+      Tcb->CubicOrigin = Tcb->CWnd;
+    }
+  }
+
+  //
+  // W_cubic (t + RTT) = C * (t + RTT - K)^3 + WMax, in bytes
+  // that is 4 * SndMss * Offset^3 / 10^10 with Offset in ms.
+  //
+  Elapsed = (TCP_SUB_TIME (mTcpTick, Tcb->CubicEpoch) + (Tcb->SRtt >> TCP_RTT_SHIFT)) * TCP_TICK;
+  Elapsed = MIN (Elapsed, TCP_CUBIC_MAX_ELAPSED);
+
+  if (Elapsed > Tcb->CubicK) {
+    Offset = Elapsed - Tcb->CubicK;
+  } else {
+    Offset = Tcb->CubicK - Elapsed;
+  }
+
+  Delta = MultU64x32 (MultU64x32 (Offset, Offset), Offset);
+  Delta = DivU64x32 (MultU64x32 (DivU64x32 (Delta, 100000), 4 * Tcb->SndMss), 100000);
+
+  if (Elapsed > Tcb->CubicK) {
+    Target = Tcb->CubicOrigin + Delta;
+  } else if (Tcb->CubicOrigin > Delta) {
+    Target = Tcb->CubicOrigin - Delta;
+  } else {
+    Target = 0;
+  }
+
+  //
+  // RFC8312 section 4.2: TCP-friendly region. The estimated
+  // standard TCP window grows by 3 * (1 - beta) / (1 + beta),
+  // about 9/17, SndMss per RTT.
+  //
+  Tcb->CubicWEst += MAX ((UINT32)DivU64x32 (MultU64x32 (9 * Tcb->SndMss, Tcb->SndMss), Tcb->CubicWEst) / 17, 1);
+  Target          = MAX (Target, Tcb->CubicWEst);
+
+  //
+  // RFC8312 section 4.3 and 4.4: approach the target by
+  // (Target - CWnd) / CWnd per ACK, but don't grow more than
+  // half of the window in an RTT.
+  //
+  if (Target > Tcb->CWnd) {
+    Target   = MIN (Target, Tcb->CWnd + (Tcb->CWnd >> 1));
+    Increase = (UINT32)DivU64x32 (MultU64x32 (Target - Tcb->CWnd, Tcb->SndMss), Tcb->CWnd);
+  } else {
+    Increase = Tcb->SndMss * Tcb->SndMss / Tcb->CWnd / 100;
+  }
+
+  Tcb->CWnd += MAX (Increase, 1);
+}
+
+/**
+  Grow the receive buffer to twice the data the peer delivered in
+  the last RTT, so the advertised window doesn't limit a sender
+  that is still opening its congestion window. Memory is consumed
+  only when the application reads slower than the peer sends, a
+  larger high water mark costs nothing by itself.
+
+  @param[in, out]  Tcb      Pointer to the TCP_CB of this TCP instance.
+
+**/
+VOID
+TcpRcvBufAutoTune (
+  IN OUT TCP_CB  *Tcb
+  )
+{
+  UINT32  Rtt;
+  UINT32  Received;
+  UINT32  BufSize;
+  UINT32  MaxSize;
+
+  if (!PcdGetBool (PcdTcpReceiveBufferAutoTuning)) {
+    return;
+  }
+
+  //
+  // Measure once per RTT. SRtt is only as fine as the heart
+  // beat, so shorter RTTs are measured over one heart beat.
+  //
+  Rtt = MAX (Tcb->SRtt >> TCP_RTT_SHIFT, 1);
+  if (TCP_SUB_TIME (mTcpTick, Tcb->RcvSpaceTime) < Rtt) {
+    return;
+  }
+
+  Received = TCP_SUB_SEQ (Tcb->RcvNxt, Tcb->RcvSpaceSeq);
+  BufSize  = GET_RCV_BUFFSIZE (Tcb->Sk);
+  MaxSize  = TCP_RCV_BUF_SIZE_MAX;
+
+  if ((Received > BufSize / 2) && (BufSize < MaxSize)) {
+    BufSize = (Received >= MaxSize / 2) ? MaxSize : 2 * Received;
+    SET_RCV_BUFFSIZE (Tcb->Sk, BufSize);
+
+    DEBUG (
+      (DEBUG_NET,
+       "TcpRcvBufAutoTune: grow receive buffer of TCB %p to %d\n",
+       Tcb,
+       BufSize)
+      );
+  }
+
+  Tcb->RcvSpaceSeq  = Tcb->RcvNxt;
+  Tcb->RcvSpaceTime = mTcpTick;
+}
+
 /**
   NewReno fast recovery defined in RFC3782.
 
@@ -54,7 +265,7 @@ TcpFastRecover (
     //
     FlightSize = TCP_SUB_SEQ (Tcb->SndNxt, Tcb->SndUna);
 
-    Tcb->Ssthresh = MAX (FlightSize >> 1, (UINT32)(2 * Tcb->SndMss));
+    Tcb->Ssthresh = TcpCongestSsthresh (Tcb, FlightSize);
     Tcb->Recover  = Tcb->SndNxt;
 
     Tcb->CongestState = TCP_CONGEST_RECOVER;
@@ -1236,7 +1447,7 @@ TcpInput (
       if (Tcb->CWnd < Tcb->Ssthresh) {
         Tcb->CWnd += Tcb->SndMss;
       } else {
-        Tcb->CWnd += MAX (Tcb->SndMss * Tcb->SndMss / Tcb->CWnd, 1);
+        TcpCongestAvoid (Tcb);
       }
 
       Tcb->CWnd = MIN (Tcb->CWnd, TCP_MAX_WIN << Tcb->SndWndScale);
@@ -1487,10 +1698,14 @@ StepSix:
       goto DISCARD;
     }
 
+    Tcb->SackSeq = Seg->Seq;
+
     if (TcpDeliverData (Tcb) == -1) {
       goto RESET_THEN_DROP;
     }
 
+    TcpRcvBufAutoTune (Tcb);
+
     if (!IsListEmpty (&Tcb->RcvQue)) {
       TCP_SET_FLG (Tcb->CtrlFlag, TCP_CTRL_ACK_NOW);
     }
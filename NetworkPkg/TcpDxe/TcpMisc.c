@@ -140,6 +140,10 @@ TcpInitTcbLocal (
   Tcb->RcvWndScale   = 0;
   Tcb->RetxmitSeqMax = 0;
 
+  Tcb->CubicWMax     = 0;
+  Tcb->CubicLastWMax = 0;
+  Tcb->CubicWEst     = 0;
+
   Tcb->ProbeTimerOn = FALSE;
 
   return EFI_SUCCESS;
@@ -196,6 +200,9 @@ TcpInitTcbPeer (
 
   Tcb->RcvWl2 = Tcb->RcvNxt;
 
+  Tcb->RcvSpaceSeq  = Tcb->RcvNxt;
+  Tcb->RcvSpaceTime = mTcpTick;
+
   if (TCP_FLG_ON (Opt->Flag, TCP_OPTION_RCVD_WS) && !TCP_FLG_ON (Tcb->CtrlFlag, TCP_CTRL_NO_WS)) {
     Tcb->SndWndScale = Opt->WndScale;
 
@@ -208,6 +215,10 @@ TcpInitTcbPeer (
     Tcb->RcvWndScale = 0;
   }
 
+  if (TCP_FLG_ON (Opt->Flag, TCP_OPTION_RCVD_SACK_PERM) && PcdGetBool (PcdTcpSackEnable)) {
+    TCP_SET_FLG (Tcb->CtrlFlag, TCP_CTRL_SND_SACK);
+  }
+
   if (TCP_FLG_ON (Opt->Flag, TCP_OPTION_RCVD_TS) && !TCP_FLG_ON (Tcb->CtrlFlag, TCP_CTRL_NO_TS)) {
     TCP_SET_FLG (Tcb->CtrlFlag, TCP_CTRL_SND_TS);
     TCP_SET_FLG (Tcb->CtrlFlag, TCP_CTRL_RCVD_TS);
@@ -84,6 +84,14 @@ TcpComputeScale (
 
   BufSize = GET_RCV_BUFFSIZE (Tcb->Sk);
 
+  //
+  // The scale can't change once the connection is synchronized,
+  // leave room for the receive buffer auto-tuning to grow into.
+  //
+  if (PcdGetBool (PcdTcpReceiveBufferAutoTuning)) {
+    BufSize = MAX (BufSize, TCP_RCV_BUF_SIZE_MAX);
+  }
+
   Scale = 0;
   while ((Scale < TCP_OPTION_MAX_WS) && ((UINT32)(TCP_OPTION_MAX_WIN << Scale) < BufSize)) {
     Scale++;
@@ -160,6 +168,28 @@ TcpSynBuildOption (
     TcpPutUint32 (Data, TCP_OPTION_WS_FAST | TcpComputeScale (Tcb));
   }
 
+  //
+  // Build SACK permitted option, only when SACK is enabled,
+  // and either we are doing active open or we have received
+  // SACK permitted option from peer.
+  //
+  if (PcdGetBool (PcdTcpSackEnable) &&
+      (!TCP_FLG_ON (TCPSEG_NETBUF (Nbuf)->Flag, TCP_FLG_ACK) ||
+       TCP_FLG_ON (Tcb->CtrlFlag, TCP_CTRL_SND_SACK))
+      )
+  {
+    Data = NetbufAllocSpace (
+             Nbuf,
+             TCP_OPTION_SACK_PERM_ALIGNED_LEN,
+             NET_BUF_HEAD
+             );
+
+    ASSERT (Data != NULL);
+
+    Len += TCP_OPTION_SACK_PERM_ALIGNED_LEN;
+    TcpPutUint32 (Data, TCP_OPTION_SACK_PERM_FAST);
+  }
+
   //
   // Build the MSS option.
   //
@@ -172,6 +202,145 @@ TcpSynBuildOption (
   return Len;
 }
 
+/**
+  Get the next block of contiguous data in the reassemble queue.
+
+  @param[in]       Tcb     Pointer to the TCP_CB of this TCP instance.
+  @param[in, out]  Entry   On input, the queue entry to start from. On output,
+                           the entry following the block.
+  @param[out]      Left    The sequence number of the first byte in the block.
+  @param[out]      Right   The sequence number of the last byte in the block + 1.
+
+  @retval          TRUE    A block was found.
+  @retval          FALSE   No more data in the reassemble queue.
+
+**/
+BOOLEAN
+TcpGetSackBlock (
+  IN     TCP_CB      *Tcb,
+  IN OUT LIST_ENTRY  **Entry,
+  OUT    TCP_SEQNO   *Left,
+  OUT    TCP_SEQNO   *Right
+  )
+{
+  TCP_SEG  *Seg;
+
+  if (*Entry == &Tcb->RcvQue) {
+    return FALSE;
+  }
+
+  Seg    = TCPSEG_NETBUF (NET_LIST_USER_STRUCT (*Entry, NET_BUF, List));
+  *Left  = Seg->Seq;
+  *Right = Seg->Seq;
+
+  while (*Entry != &Tcb->RcvQue) {
+    Seg = TCPSEG_NETBUF (NET_LIST_USER_STRUCT (*Entry, NET_BUF, List));
+
+    if (Seg->Seq != *Right) {
+      break;
+    }
+
+    //
+    // FIN occupies a sequence number, but it isn't data.
+    //
+    *Right = Seg->End;
+    if (TCP_FLG_ON (Seg->Flag, TCP_FLG_FIN)) {
+      *Right = *Right - 1;
+    }
+
+    *Entry = (*Entry)->ForwardLink;
+  }
+
+  return TRUE;
+}
+
+/**
+  Build the SACK option to report the out-of-order data in the
+  reassemble queue. As RFC2018 requires, the first block holds
+  the most recently received segment, the others follow in
+  sequence order as long as the option space permits.
+
+  @param[in]  Tcb     Pointer to the TCP_CB of this TCP instance.
+  @param[in]  Nbuf    Pointer to the buffer to store the options.
+  @param[in]  Space   The option space left in the TCP header.
+
+  @return             The length of the SACK option.
+
+**/
+UINT16
+TcpBuildSackOption (
+  IN TCP_CB   *Tcb,
+  IN NET_BUF  *Nbuf,
+  IN UINT16   Space
+  )
+{
+  TCP_SEQNO   Block[TCP_OPTION_MAX_SACK_BLOCK][2];
+  LIST_ENTRY  *Entry;
+  TCP_SEQNO   Left;
+  TCP_SEQNO   Right;
+  UINT8       *Data;
+  UINTN       MaxBlock;
+  UINTN       Count;
+  UINTN       Index;
+  BOOLEAN     Latest;
+  UINT16      Len;
+
+  if (Space < TCP_OPTION_SACK_ALIGNED_LEN + TCP_OPTION_SACK_BLOCK_LEN) {
+    return 0;
+  }
+
+  MaxBlock = MIN (
+               (Space - TCP_OPTION_SACK_ALIGNED_LEN) / TCP_OPTION_SACK_BLOCK_LEN,
+               TCP_OPTION_MAX_SACK_BLOCK
+               );
+
+  //
+  // Block[0] is reserved for the block holding the latest segment.
+  //
+  Count  = 1;
+  Latest = FALSE;
+  Entry  = Tcb->RcvQue.ForwardLink;
+
+  while (TcpGetSackBlock (Tcb, &Entry, &Left, &Right)) {
+    if (TCP_SEQ_LEQ (Right, Left) || TCP_SEQ_LEQ (Right, Tcb->RcvNxt)) {
+      continue;
+    }
+
+    if (!Latest && TCP_SEQ_LEQ (Left, Tcb->SackSeq) && TCP_SEQ_LT (Tcb->SackSeq, Right)) {
+      Block[0][0] = Left;
+      Block[0][1] = Right;
+      Latest      = TRUE;
+    } else if (Count < MaxBlock) {
+      Block[Count][0] = Left;
+      Block[Count][1] = Right;
+      Count++;
+    }
+  }
+
+  if (!Latest) {
+    if (Count == 1) {
+      return 0;
+    }
+
+    Block[0][0] = Block[Count - 1][0];
+    Block[0][1] = Block[Count - 1][1];
+    Count--;
+  }
+
+  Len  = (UINT16)(TCP_OPTION_SACK_ALIGNED_LEN + Count * TCP_OPTION_SACK_BLOCK_LEN);
+  Data = NetbufAllocSpace (Nbuf, Len, NET_BUF_HEAD);
+  ASSERT (Data != NULL);
+
+  TcpPutUint32 (Data, TCP_OPTION_SACK_FAST | (Len - 2));
+
+  for (Index = 0; Index < Count; Index++) {
+    TcpPutUint32 (Data + TCP_OPTION_SACK_ALIGNED_LEN + Index * TCP_OPTION_SACK_BLOCK_LEN, Block[Index][0]);
+    TcpPutUint32 (Data + TCP_OPTION_SACK_ALIGNED_LEN + Index * TCP_OPTION_SACK_BLOCK_LEN + 4, Block[Index][1]);
+  }
+
+  return Len;
+}
+
 /**
   Build the TCP option in synchronized states.
 
@@ -214,6 +383,21 @@ TcpBuildOption (
     TcpPutUint32 (Data + 8, Tcb->TsRecent);
   }
 
+  //
+  // Build the SACK option if there is out-of-order data
+  // queued and the peer permitted SACK. Only pure ACKs
+  // carry it, since SndMss leaves no room for it in the
+  // data segments.
+  //
+  if (TCP_FLG_ON (Tcb->CtrlFlag, TCP_CTRL_SND_SACK) &&
+      !TCP_FLG_ON (TCPSEG_NETBUF (Nbuf)->Flag, TCP_FLG_RST) &&
+      (TCPSEG_NETBUF (Nbuf)->Seq == TCPSEG_NETBUF (Nbuf)->End) &&
+      !IsListEmpty (&Tcb->RcvQue)
+      )
+  {
+    Len = (UINT16)(Len + TcpBuildSackOption (Tcb, Nbuf, (UINT16)(TCP_OPTION_MAX_LEN - Len)));
+  }
+
   return Len;
 }
 
@@ -297,6 +481,18 @@ TcpParseOption (
         Cur += TCP_OPTION_WS_LEN;
         break;
 
+      case TCP_OPTION_SACK_PERM:
+        Len = Head[Cur + 1];
+
+        if ((Len != TCP_OPTION_SACK_PERM_LEN) || (TotalLen - Cur < TCP_OPTION_SACK_PERM_LEN)) {
+          return -1;
+        }
+
+        TCP_SET_FLG (Option->Flag, TCP_OPTION_RCVD_SACK_PERM);
+
+        Cur += TCP_OPTION_SACK_PERM_LEN;
+        break;
+
       case TCP_OPTION_TS:
         Len = Head[Cur + 1];
 
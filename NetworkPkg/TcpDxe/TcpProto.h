@@ -52,6 +52,17 @@
 #define TCP_CONGEST_LOSS     2      ///< Retxmit because of retxmit time out.
 #define TCP_CONGEST_OPEN     3      ///< TCP is opening its congestion window.
 
+//
+// Congestion control algorithms selected by PcdTcpCongestionControl.
+//
+#define TCP_CONGEST_CTRL_NEWRENO  0   ///< NewReno, RFC5681 and RFC6582.
+#define TCP_CONGEST_CTRL_CUBIC    1   ///< CUBIC, RFC8312.
+
+//
+// Cap of the CUBIC epoch age in ms, keeps the cube of it in 64 bits.
+//
+#define TCP_CUBIC_MAX_ELAPSED  1000000
+
 //
 // TCP control flags
 //
@@ -70,6 +81,7 @@
 #define TCP_CTRL_TIMER_ON      0x1000   ///< At least one of the timer is on.
 #define TCP_CTRL_RTT_ON        0x2000   ///< The RTT measurement is on.
 #define TCP_CTRL_ACK_NOW       0x4000   ///< Send the ACK now, don't delay.
+#define TCP_CTRL_SND_SACK      0x8000   ///< Send SACK blocks, the peer permitted it in syn.
 
 //
 // Timer related values
@@ -109,9 +121,10 @@
 //
 // Value ranges for some control option
 //
-#define TCP_RCV_BUF_SIZE          (2 * 1024 * 1024)
+#define TCP_RCV_BUF_SIZE          PcdGet32 (PcdTcpReceiveBufferSize)
 #define TCP_RCV_BUF_SIZE_MIN      (8 * 1024)
-#define TCP_SND_BUF_SIZE          (2 * 1024 * 1024)
+#define TCP_RCV_BUF_SIZE_MAX      PcdGet32 (PcdTcpMaxReceiveBufferSize)
+#define TCP_SND_BUF_SIZE          PcdGet32 (PcdTcpSendBufferSize)
 #define TCP_SND_BUF_SIZE_MIN      (8 * 1024)
 #define TCP_BACKLOG               10
 #define TCP_BACKLOG_MIN           5
@@ -285,6 +298,17 @@ struct _TCP_CONTROL_BLOCK {
   UINT32              TsRecent;    ///< TsRecent to echo to the remote peer.
   UINT32              TsRecentAge; ///< When this TsRecent is updated.
 
+  //
+  // RFC2018 selective acknowledgment, receive side only
+  //
+  TCP_SEQNO           SackSeq; ///< Seq of the most recently queued segment.
+
+  //
+  // Receive buffer auto-tuning
+  //
+  TCP_SEQNO           RcvSpaceSeq;  ///< RcvNxt when the current measurement started.
+  UINT32              RcvSpaceTime; ///< When the current measurement started.
+
   //
   // RFC2988 defined variables. about RTT measurement
   //
@@ -306,6 +330,16 @@ struct _TCP_CONTROL_BLOCK {
   UINT8               LossTimes;    ///< Number of retxmit timeouts in a row.
   TCP_SEQNO           LossRecover;  ///< Recover point for retxmit.
 
+  //
+  // RFC8312 CUBIC variables, used if PcdTcpCongestionControl selects it.
+  //
+  UINT32              CubicWMax;     ///< CWnd before the last reduction.
+  UINT32              CubicLastWMax; ///< CWnd at the previous reduction.
+  UINT32              CubicOrigin;   ///< The plateau of the cubic function.
+  UINT32              CubicK;        ///< Time in ms to reach CubicOrigin.
+  UINT32              CubicEpoch;    ///< When the current avoidance epoch started.
+  UINT32              CubicWEst;     ///< Reno-friendly window, 0 if no epoch is on.
+
   //
   // RFC7323
   // Addressing Window Retraction for TCP Window Scale Option.
@@ -194,7 +194,7 @@ TcpRexmitTimeout (
   // yet ACKed.
   //
   FlightSize    = TCP_SUB_SEQ (Tcb->SndNxt, Tcb->SndUna);
-  Tcb->Ssthresh = MAX ((UINT32)(2 * Tcb->SndMss), FlightSize / 2);
+  Tcb->Ssthresh = TcpCongestSsthresh (Tcb, FlightSize);
 
   Tcb->CWnd        = Tcb->SndMss;
   Tcb->LossRecover = Tcb->SndNxt;
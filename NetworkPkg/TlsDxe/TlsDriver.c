@@ -86,6 +86,8 @@ TlsCleanService (
   )
 {
   if (Service != NULL) {
+    TlsFreeSessionCache (Service);
+
     if (Service->TlsCtx != NULL) {
       TlsCtxFree (Service->TlsCtx);
     }
@@ -132,6 +134,7 @@ TlsCreateService (
   TlsService->TlsChildrenNum = 0;
   InitializeListHead (&TlsService->TlsChildrenList);
   TlsService->ImageHandle = Image;
+  InitializeListHead (&TlsService->SessionCache);
 
   *Service = TlsService;
 
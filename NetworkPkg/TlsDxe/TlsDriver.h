@@ -26,6 +26,11 @@
 
 #define TLS_INSTANCE_SIGNATURE  SIGNATURE_32 ('T', 'L', 'S', 'I')
 
+//
+// The maximum number of sessions kept for resumption.
+//
+#define TLS_SESSION_CACHE_MAX  8
+
 ///
 /// TLS Service Data
 ///
@@ -55,8 +60,25 @@ struct _TLS_SERVICE {
   // created for the connections.
   //
   VOID                            *TlsCtx;
+
+  //
+  // Sessions of earlier TLS instances, which a TLS instance may resume by
+  // setting their session ID, least recently cached first.
+  //
+  LIST_ENTRY                      SessionCache;
+  UINTN                           SessionCacheCount;
 };
 
+///
+/// A session kept for resumption.
+///
+typedef struct {
+  LIST_ENTRY            Link;
+  EFI_TLS_SESSION_ID    SessionId;
+  UINT8                 *Data;
+  UINTN                 DataSize;
+} TLS_CACHED_SESSION;
+
 struct _TLS_INSTANCE {
   UINT32                            Signature;
   LIST_ENTRY                        Link;
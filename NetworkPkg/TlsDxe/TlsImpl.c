@@ -348,3 +348,173 @@ ERROR:
 
   return Status;
 }
+
+/**
+  Find a session kept by the TLS service.
+
+  @param[in]  Service             The TLS service data.
+  @param[in]  SessionId           The ID of the session.
+
+  @return  The kept session, or NULL if no session with this ID has been kept.
+
+**/
+TLS_CACHED_SESSION *
+TlsFindCachedSession (
+  IN     TLS_SERVICE               *Service,
+  IN     CONST EFI_TLS_SESSION_ID  *SessionId
+  )
+{
+  LIST_ENTRY          *Entry;
+  TLS_CACHED_SESSION  *Cached;
+
+  NET_LIST_FOR_EACH (Entry, &Service->SessionCache) {
+    Cached = NET_LIST_USER_STRUCT (Entry, TLS_CACHED_SESSION, Link);
+    if ((Cached->SessionId.Length == SessionId->Length) &&
+        (CompareMem (Cached->SessionId.Data, SessionId->Data, SessionId->Length) == 0))
+    {
+      return Cached;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Release a session kept by the TLS service.
+
+  @param[in]  Service             The TLS service data.
+  @param[in]  Cached              The kept session.
+
+**/
+VOID
+TlsFreeCachedSession (
+  IN     TLS_SERVICE         *Service,
+  IN     TLS_CACHED_SESSION  *Cached
+  )
+{
+  RemoveEntryList (&Cached->Link);
+  Service->SessionCacheCount--;
+
+  ZeroMem (Cached->Data, Cached->DataSize);
+  FreePool (Cached->Data);
+  FreePool (Cached);
+}
+
+/**
+  Keep the session of the TLS instance, for a later TLS instance to resume.
+
+  The session is replaced if it has been kept already. Nothing is kept if the
+  session can't be resumed.
+
+  @param[in]  TlsInstance         The pointer to the TLS instance.
+  @param[in]  SessionId           The ID of the session of the TLS instance.
+
+**/
+VOID
+TlsCacheSession (
+  IN     TLS_INSTANCE              *TlsInstance,
+  IN     CONST EFI_TLS_SESSION_ID  *SessionId
+  )
+{
+  EFI_STATUS          Status;
+  TLS_SERVICE         *Service;
+  TLS_CACHED_SESSION  *Cached;
+  TLS_CACHED_SESSION  *Existing;
+  UINT8               *Data;
+  UINTN               DataSize;
+
+  if ((SessionId->Length == 0) || (SessionId->Length > MAX_TLS_SESSION_ID_LENGTH)) {
+    return;
+  }
+
+  DataSize = 0;
+  Status   = TlsGetSession (TlsInstance->TlsConn, NULL, &DataSize);
+  if (Status != EFI_BUFFER_TOO_SMALL) {
+    return;
+  }
+
+  Data = AllocatePool (DataSize);
+  if (Data == NULL) {
+    return;
+  }
+
+  Status = TlsGetSession (TlsInstance->TlsConn, Data, &DataSize);
+  if (EFI_ERROR (Status)) {
+    FreePool (Data);
+    return;
+  }
+
+  Cached = AllocateZeroPool (sizeof (TLS_CACHED_SESSION));
+  if (Cached == NULL) {
+    ZeroMem (Data, DataSize);
+    FreePool (Data);
+    return;
+  }
+
+  CopyMem (&Cached->SessionId, SessionId, sizeof (EFI_TLS_SESSION_ID));
+  Cached->Data     = Data;
+  Cached->DataSize = DataSize;
+
+  Service  = TlsInstance->Service;
+  Existing = TlsFindCachedSession (Service, SessionId);
+  if (Existing != NULL) {
+    TlsFreeCachedSession (Service, Existing);
+  } else if (Service->SessionCacheCount >= TLS_SESSION_CACHE_MAX) {
+    TlsFreeCachedSession (
+      Service,
+      NET_LIST_HEAD (&Service->SessionCache, TLS_CACHED_SESSION, Link)
+      );
+  }
+
+  InsertTailList (&Service->SessionCache, &Cached->Link);
+  Service->SessionCacheCount++;
+}
+
+/**
+  Set a kept session to be resumed by the TLS instance.
+
+  @param[in]  TlsInstance         The pointer to the TLS instance.
+  @param[in]  SessionId           The ID of the session to resume.
+
+  @retval EFI_SUCCESS             The session will be resumed.
+  @retval EFI_NOT_FOUND           No session with this ID has been kept.
+  @retval Others                  The session can't be resumed by the TLS instance.
+**/
+EFI_STATUS
+TlsResumeSession (
+  IN     TLS_INSTANCE              *TlsInstance,
+  IN     CONST EFI_TLS_SESSION_ID  *SessionId
+  )
+{
+  TLS_CACHED_SESSION  *Cached;
+
+  if (SessionId->Length > MAX_TLS_SESSION_ID_LENGTH) {
+    return EFI_NOT_FOUND;
+  }
+
+  Cached = TlsFindCachedSession (TlsInstance->Service, SessionId);
+  if (Cached == NULL) {
+    return EFI_NOT_FOUND;
+  }
+
+  return TlsSetSession (TlsInstance->TlsConn, Cached->Data, Cached->DataSize);
+}
+
+/**
+  Release the sessions kept by the TLS service.
+
+  @param[in]  Service             The TLS service data.
+
+**/
+VOID
+TlsFreeSessionCache (
+  IN     TLS_SERVICE  *Service
+  )
+{
+  while (!IsListEmpty (&Service->SessionCache)) {
+    TlsFreeCachedSession (
+      Service,
+      NET_LIST_HEAD (&Service->SessionCache, TLS_CACHED_SESSION, Link)
+      );
+  }
+}
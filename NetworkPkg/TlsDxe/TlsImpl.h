@@ -86,6 +86,49 @@ TlsDecryptPacket (
   IN     UINT32                 *FragmentCount
   );
 
+/**
+  Keep the session of the TLS instance, for a later TLS instance to resume.
+
+  The session is replaced if it has been kept already. Nothing is kept if the
+  session can't be resumed.
+
+  @param[in]  TlsInstance         The pointer to the TLS instance.
+  @param[in]  SessionId           The ID of the session of the TLS instance.
+
+**/
+VOID
+TlsCacheSession (
+  IN     TLS_INSTANCE              *TlsInstance,
+  IN     CONST EFI_TLS_SESSION_ID  *SessionId
+  );
+
+/**
+  Set a kept session to be resumed by the TLS instance.
+
+  @param[in]  TlsInstance         The pointer to the TLS instance.
+  @param[in]  SessionId           The ID of the session to resume.
+
+  @retval EFI_SUCCESS             The session will be resumed.
+  @retval EFI_NOT_FOUND           No session with this ID has been kept.
+  @retval Others                  The session can't be resumed by the TLS instance.
+**/
+EFI_STATUS
+TlsResumeSession (
+  IN     TLS_INSTANCE              *TlsInstance,
+  IN     CONST EFI_TLS_SESSION_ID  *SessionId
+  );
+
+/**
+  Release the sessions kept by the TLS service.
+
+  @param[in]  Service             The TLS service data.
+
+**/
+VOID
+TlsFreeSessionCache (
+  IN     TLS_SERVICE  *Service
+  );
+
 /**
   Set TLS session data.
 
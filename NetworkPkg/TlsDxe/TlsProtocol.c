@@ -195,11 +195,18 @@ TlsSetSessionData (
         goto ON_EXIT;
       }
 
-      Status = TlsSetSessionId (
-                 Instance->TlsConn,
-                 ((EFI_TLS_SESSION_ID *)Data)->Data,
-                 ((EFI_TLS_SESSION_ID *)Data)->Length
-                 );
+      //
+      // Resume the session if it has been kept by an earlier TLS instance.
+      //
+      Status = TlsResumeSession (Instance, (EFI_TLS_SESSION_ID *)Data);
+      if (EFI_ERROR (Status)) {
+        Status = TlsSetSessionId (
+                   Instance->TlsConn,
+                   ((EFI_TLS_SESSION_ID *)Data)->Data,
+                   ((EFI_TLS_SESSION_ID *)Data)->Length
+                   );
+      }
+
       break;
     case EfiTlsSessionState:
       if (DataSize != sizeof (EFI_TLS_SESSION_STATE)) {
@@ -362,6 +369,15 @@ TlsGetSessionData (
                     ((EFI_TLS_SESSION_ID *)Data)->Data,
                     &(((EFI_TLS_SESSION_ID *)Data)->Length)
                     );
+
+      //
+      // Keep the established session, so that a later TLS instance can resume
+      // it by setting its session ID.
+      //
+      if (!EFI_ERROR (Status) && (Instance->TlsSessionState == EfiTlsSessionDataTransferring)) {
+        TlsCacheSession (Instance, (EFI_TLS_SESSION_ID *)Data);
+      }
+
       break;
     case EfiTlsSessionState:
       if (*DataSize < sizeof (EFI_TLS_SESSION_STATE)) {
@@ -70,7 +70,7 @@ typedef struct _PXEBC_VIRTUAL_NIC       PXEBC_VIRTUAL_NIC;
 #define PXEBC_MENU_MAX_NUM          24
 #define PXEBC_OFFER_MAX_NUM         16
 
-#define PXEBC_CHECK_MEDIA_WAITING_TIME  EFI_TIMER_PERIOD_SECONDS(20)
+#define PXEBC_CHECK_MEDIA_WAITING_TIME  EFI_TIMER_PERIOD_SECONDS(PcdGet32 (PcdNetworkBootMediaDetectTimeout))
 
 #define PXEBC_PRIVATE_DATA_SIGNATURE  SIGNATURE_32 ('P', 'X', 'E', 'P')
 #define PXEBC_VIRTUAL_NIC_SIGNATURE   SIGNATURE_32 ('P', 'X', 'E', 'V')
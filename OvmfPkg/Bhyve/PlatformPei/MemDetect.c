@@ -523,12 +523,12 @@ QemuInitializeRam (
     SetMem (&MtrrSettings.Fixed, sizeof MtrrSettings.Fixed, MTRR_CACHE_WRITE_BACK);
     ZeroMem (&MtrrSettings.Variables, sizeof MtrrSettings.Variables);
     MtrrSettings.MtrrDefType |= BIT10;
-    MtrrSetAllMtrrs (&MtrrSettings);
 
     //
     // Set memory range from 640KB to 1MB to uncacheable
     //
-    Status = MtrrSetMemoryAttribute (
+    Status = MtrrSetMemoryAttributeInMtrrSettings (
+               &MtrrSettings,
                BASE_512KB + BASE_128KB,
                BASE_1MB - (BASE_512KB + BASE_128KB),
                CacheUncacheable
@@ -539,12 +539,18 @@ QemuInitializeRam (
     // Set memory range from the "top of lower RAM" (RAM below 4GB) to 4GB as
     // uncacheable
     //
-    Status = MtrrSetMemoryAttribute (
+    Status = MtrrSetMemoryAttributeInMtrrSettings (
+               &MtrrSettings,
                LowerMemorySize,
                SIZE_4GB - LowerMemorySize,
                CacheUncacheable
                );
     ASSERT_EFI_ERROR (Status);
+
+    //
+    // Program the MTRRs once with all the settings above.
+    //
+    MtrrSetAllMtrrs (&MtrrSettings);
   }
 }
 
@@ -24,10 +24,10 @@
 #include <ConfidentialComputingGuestAttr.h>
 #include <Library/TdxHelperLib.h>
 
-#define ALIGNED_2MB_MASK  0x1fffff
-#define MEGABYTE_SHIFT    20
+#define MEGABYTE_SHIFT  20
 
-#define ACCEPT_CHUNK_SIZE  SIZE_32MB
+#define ACCEPT_CHUNK_SIZE      SIZE_32MB
+#define ACCEPT_CHUNKS_PER_CPU  4
 #define AP_STACK_SIZE      SIZE_16KB
 #define APS_STACK_SIZE(CpusNum)  (ALIGN_VALUE(CpusNum*AP_STACK_SIZE, SIZE_2MB))
 
@@ -46,19 +46,26 @@ InternalBuildGuidHobForTdxMeasurement (
 /**
   This function will be called to accept pages. Only BSP accepts pages.
 
-  TDCALL(ACCEPT_PAGE) supports the accept page size of 4k and 2M. To
-  simplify the implementation, the Memory to be accpeted is splitted
-  into 3 parts:
-  -----------------  <-- StartAddress1 (not 2M aligned)
-  |  part 1       |      Length1 < 2M
-  |---------------|  <-- StartAddress2 (2M aligned)
-  |               |      Length2 = Integer multiples of 2M
-  |  part 2       |
+  TDCALL(ACCEPT_PAGE) supports the accept page size of 4k, 2M and 1G. Each
+  part of the memory is accepted with the largest page size, up to
+  PcdTdxAcceptPageSize, which it is aligned to:
+  -----------------
+  |  4K pages     |      up to the first 2M boundary
+  |---------------|
+  |  2M pages     |      up to the first 1G boundary
+  |---------------|
+  |               |
+  |  1G pages     |
   |               |
-  |---------------|  <-- StartAddress3
-  |  part 3       |      Length3 < 2M
+  |---------------|
+  |  2M pages     |      up to the last 2M boundary
+  |---------------|
+  |  4K pages     |
   |---------------|
 
+  TdAcceptPages falls back to smaller pages where the host maps the memory
+  with smaller pages.
+
   @param[in] PhysicalAddress   Start physical adress
   @param[in] PhysicalEnd       End physical address
 
@@ -75,85 +82,81 @@ BspAcceptMemoryResourceRange (
 {
   EFI_STATUS  Status;
   UINT32      AcceptPageSize;
-  UINT64      StartAddress1;
-  UINT64      StartAddress2;
-  UINT64      StartAddress3;
-  UINT64      TotalLength;
-  UINT64      Length1;
-  UINT64      Length2;
-  UINT64      Length3;
+  UINT32      PageSize;
+  UINT64      Length;
   UINT64      Pages;
 
   AcceptPageSize = FixedPcdGet32 (PcdTdxAcceptPageSize);
-  TotalLength    = PhysicalEnd - PhysicalAddress;
-  StartAddress1  = 0;
-  StartAddress2  = 0;
-  StartAddress3  = 0;
-  Length1        = 0;
-  Length2        = 0;
-  Length3        = 0;
-
-  if (TotalLength == 0) {
-    return EFI_SUCCESS;
-  }
+  Status         = EFI_SUCCESS;
+
+  while (!EFI_ERROR (Status) && (PhysicalAddress < PhysicalEnd)) {
+    //
+    // Use the largest page size the address is aligned to and the range can hold.
+    //
+    PageSize = AcceptPageSize;
+    while ((PageSize > SIZE_4KB) &&
+           (((PhysicalAddress & (PageSize - 1)) != 0) || (PhysicalEnd - PhysicalAddress < PageSize)))
+    {
+      PageSize = (PageSize == SIZE_1GB) ? SIZE_2MB : SIZE_4KB;
+    }
 
-  if (ALIGN_VALUE (PhysicalAddress, SIZE_2MB) != PhysicalAddress) {
-    StartAddress1 = PhysicalAddress;
-    Length1       = ALIGN_VALUE (PhysicalAddress, SIZE_2MB) - PhysicalAddress;
-    if (Length1 >= TotalLength) {
-      Length1 = TotalLength;
+    //
+    // Accept the pages up to the next boundary of the larger page size,
+    // from where the larger pages can be used again.
+    //
+    Length = PhysicalEnd - PhysicalAddress;
+    if (PageSize < AcceptPageSize) {
+      Length = MIN (Length, ALIGN_VALUE (PhysicalAddress + 1, (PageSize == SIZE_4KB) ? SIZE_2MB : SIZE_1GB) - PhysicalAddress);
     }
 
-    PhysicalAddress += Length1;
-    TotalLength     -= Length1;
-  }
+    Pages = Length / PageSize;
+    if (Pages == 0) {
+      ASSERT (FALSE);
+      return EFI_INVALID_PARAMETER;
+    }
 
-  if (TotalLength > SIZE_2MB) {
-    StartAddress2    = PhysicalAddress;
-    Length2          = TotalLength & ~(UINT64)ALIGNED_2MB_MASK;
-    PhysicalAddress += Length2;
-    TotalLength     -= Length2;
+    Status = TdAcceptPages (PhysicalAddress, Pages, PageSize);
+    ASSERT (!EFI_ERROR (Status));
+    PhysicalAddress += Pages * PageSize;
   }
 
-  if (TotalLength) {
-    StartAddress3 = PhysicalAddress;
-    Length3       = TotalLength;
-  }
+  return Status;
+}
 
-  Status = EFI_SUCCESS;
-  if (Length1 > 0) {
-    Pages  = Length1 / SIZE_4KB;
-    Status = TdAcceptPages (StartAddress1, Pages, SIZE_4KB);
-    if (EFI_ERROR (Status)) {
-      return Status;
-    }
-  }
+/**
+  Get the size of the chunks the memory to accept is split into between
+  the vCPUs. A chunk is aligned to its size. 1G chunks, which can be
+  accepted with 1G pages, are used if each vCPU gets several of them.
 
-  if (Length2 > 0) {
-    Pages  = Length2 / AcceptPageSize;
-    Status = TdAcceptPages (StartAddress2, Pages, AcceptPageSize);
-    if (EFI_ERROR (Status)) {
-      return Status;
-    }
-  }
+  @param[in] CpusNum         Total vCPU number of a Tdx guest
+  @param[in] PhysicalStart   Start address of a memory region which is to be accepted
+  @param[in] PhysicalEnd     End address of a memory region which is to be accepted
 
-  if (Length3 > 0) {
-    Pages  = Length3 / SIZE_4KB;
-    Status = TdAcceptPages (StartAddress3, Pages, SIZE_4KB);
-    ASSERT (!EFI_ERROR (Status));
-    if (EFI_ERROR (Status)) {
-      return Status;
-    }
+  @return The size of the chunks
+**/
+STATIC
+UINT64
+GetAcceptChunkSize (
+  IN UINT32                CpusNum,
+  IN EFI_PHYSICAL_ADDRESS  PhysicalStart,
+  IN EFI_PHYSICAL_ADDRESS  PhysicalEnd
+  )
+{
+  if ((FixedPcdGet32 (PcdTdxAcceptPageSize) == SIZE_1GB) &&
+      ((PhysicalEnd - PhysicalStart) / SIZE_1GB >= MultU64x32 (ACCEPT_CHUNKS_PER_CPU, CpusNum)))
+  {
+    return SIZE_1GB;
   }
 
-  return Status;
+  return ACCEPT_CHUNK_SIZE;
 }
 
 /**
  * This function is called by BSP and APs to accept memory.
  * Note:
  * The input PhysicalStart/PhysicalEnd indicates the whole memory region
- * to be accepted. BSP or AP only accepts one piece in the whole memory region.
+ * to be accepted. The region is split into aligned chunks, and BSP or AP
+ * accepts every CpusNum-th chunk, starting with the chunk of its CpuIndex.
  *
  * @param CpuIndex        vCPU index
  * @param CpusNum         Total vCPU number of a Tdx guest
@@ -173,26 +176,25 @@ BspApAcceptMemoryResourceRange (
   EFI_PHYSICAL_ADDRESS  PhysicalEnd
   )
 {
-  UINT64                Status;
-  UINT64                Pages;
+  EFI_STATUS            Status;
+  UINT64                ChunkSize;
   UINT64                Stride;
-  UINT64                AcceptPageSize;
   EFI_PHYSICAL_ADDRESS  PhysicalAddress;
 
-  AcceptPageSize = (UINT64)(UINTN)FixedPcdGet32 (PcdTdxAcceptPageSize);
-
   Status          = EFI_SUCCESS;
-  Stride          = (UINTN)CpusNum * ACCEPT_CHUNK_SIZE;
-  PhysicalAddress = PhysicalStart + ACCEPT_CHUNK_SIZE * (UINTN)CpuIndex;
+  ChunkSize       = GetAcceptChunkSize (CpusNum, PhysicalStart, PhysicalEnd);
+  Stride          = MultU64x32 (ChunkSize, CpusNum);
+  PhysicalAddress = (PhysicalStart & ~(ChunkSize - 1)) + MultU64x32 (ChunkSize, CpuIndex);
 
   while (!EFI_ERROR (Status) && PhysicalAddress < PhysicalEnd) {
-    Pages  = MIN (ACCEPT_CHUNK_SIZE, PhysicalEnd - PhysicalAddress) / AcceptPageSize;
-    Status = TdAcceptPages (PhysicalAddress, Pages, (UINT32)(UINTN)AcceptPageSize);
-    ASSERT (!EFI_ERROR (Status));
+    Status = BspAcceptMemoryResourceRange (
+               MAX (PhysicalAddress, PhysicalStart),
+               MIN (PhysicalAddress + ChunkSize, PhysicalEnd)
+               );
     PhysicalAddress += Stride;
   }
 
-  return EFI_SUCCESS;
+  return Status;
 }
 
 /**
@@ -303,11 +305,11 @@ MpAcceptMemoryResourceRange (
   //
   // Now BSP does its job.
   //
-  BspApAcceptMemoryResourceRange (0, CpusNum, PhysicalStart, PhysicalEnd);
+  Status = BspApAcceptMemoryResourceRange (0, CpusNum, PhysicalStart, PhysicalEnd);
 
   MpSerializeEnd ();
 
-  return EFI_SUCCESS;
+  return Status;
 }
 
 /**
@@ -276,6 +276,7 @@ InternalAllocateBuffer (
   UINT32                    MemBitmap;
   UINT32                    ReservedMemBitmap;
   UINT8                     Index;
+  UINT8                     Slot;
   IOMMU_RESERVED_MEM_RANGE  *MemRange;
   UINTN                     PagesOfLastMemRange;
 
@@ -309,48 +310,61 @@ InternalAllocateBuffer (
     goto LegacyAllocateBuffer;
   }
 
-  MemRange = &mReservedMemRanges[Index];
+  //
+  // If the pieces of the best fitting size are exhausted, use a piece of a
+  // larger size rather than changing the page encryption state of new pages.
+  //
+  for ( ; Index < ARRAY_SIZE (mReservedMemRanges); Index++) {
+    MemRange = &mReservedMemRanges[Index];
 
-  do {
-    ReservedMemBitmap = mReservedMemBitmap;
+    do {
+      *ReservedMemBit   = 0;
+      ReservedMemBitmap = mReservedMemBitmap;
 
-    if ((ReservedMemBitmap & MemRange->BitmapMask) == MemRange->BitmapMask) {
-      // The reserved memory is exhausted. Turn to legacy allocate.
-      goto LegacyAllocateBuffer;
-    }
+      if ((ReservedMemBitmap & MemRange->BitmapMask) == MemRange->BitmapMask) {
+        break;
+      }
 
-    MemBitmap = (ReservedMemBitmap & MemRange->BitmapMask) >> MemRange->Shift;
+      MemBitmap = (ReservedMemBitmap & MemRange->BitmapMask) >> MemRange->Shift;
 
-    for (Index = 0; Index < MemRange->Slots; Index++) {
-      if ((MemBitmap & (UINT8)(1<<Index)) == 0) {
-        break;
+      for (Slot = 0; Slot < MemRange->Slots; Slot++) {
+        if ((MemBitmap & (UINT8)(1<<Slot)) == 0) {
+          break;
+        }
       }
-    }
 
-    ASSERT (Index != MemRange->Slots);
+      ASSERT (Slot != MemRange->Slots);
 
-    *PhysicalAddress = MemRange->StartAddressOfMemRange + Index * SIZE_OF_MEM_RANGE (MemRange) + MemRange->HeaderSize;
-    *ReservedMemBit  = (UINT32)(1 << (Index + MemRange->Shift));
-  } while (ReservedMemBitmap != InterlockedCompareExchange32 (
-                                  &mReservedMemBitmap,
-                                  ReservedMemBitmap,
-                                  ReservedMemBitmap | *ReservedMemBit
-                                  ));
+      *PhysicalAddress = MemRange->StartAddressOfMemRange + Slot * SIZE_OF_MEM_RANGE (MemRange) + MemRange->HeaderSize;
+      *ReservedMemBit  = (UINT32)(1 << (Slot + MemRange->Shift));
+    } while (ReservedMemBitmap != InterlockedCompareExchange32 (
+                                    &mReservedMemBitmap,
+                                    ReservedMemBitmap,
+                                    ReservedMemBitmap | *ReservedMemBit
+                                    ));
 
-  DEBUG ((
-    DEBUG_VERBOSE,
-    "%a: range-size: %lx, start-address=0x%llx, pages=0x%llx, bits=0x%lx, bitmap: %lx => %lx\n",
-    __func__,
-    MemRange->DataSize,
-    *PhysicalAddress,
-    Pages,
-    *ReservedMemBit,
-    ReservedMemBitmap,
-    ReservedMemBitmap | *ReservedMemBit
-    ));
+    if (*ReservedMemBit == 0) {
+      continue;
+    }
 
-  return EFI_SUCCESS;
+    DEBUG ((
+      DEBUG_VERBOSE,
+      "%a: range-size: %lx, start-address=0x%llx, pages=0x%llx, bits=0x%lx, bitmap: %lx => %lx\n",
+      __func__,
+      MemRange->DataSize,
+      *PhysicalAddress,
+      Pages,
+      *ReservedMemBit,
+      ReservedMemBitmap,
+      ReservedMemBitmap | *ReservedMemBit
+      ));
+
+    return EFI_SUCCESS;
+  }
 
+  //
+  // The reserved memory is exhausted. Turn to legacy allocate.
+  //
 LegacyAllocateBuffer:
 
   *ReservedMemBit = 0;
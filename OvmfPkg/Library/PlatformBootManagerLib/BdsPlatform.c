@@ -498,9 +498,11 @@ PlatformBootManagerBeforeConsole (
   //
   // GPU passthrough only allows Console enablement after ROM image load
   //
-  PlatformInitializeConsole (
-    XenDetected () ? gXenPlatformConsole : gPlatformConsole
-    );
+  if (!FeaturePcdGet (PcdFastBoot)) {
+    PlatformInitializeConsole (
+      XenDetected () ? gXenPlatformConsole : gPlatformConsole
+      );
+  }
 
   FrontPageTimeout = GetFrontPageTimeoutFromQemu ();
   PcdStatus        = PcdSet16S (PcdPlatformBootTimeOut, FrontPageTimeout);
@@ -526,7 +528,7 @@ PlatformBootManagerBeforeConsole (
     Status
     ));
 
-  if (!FeaturePcdGet (PcdBootRestrictToFirmware)) {
+  if (!FeaturePcdGet (PcdBootRestrictToFirmware) && !FeaturePcdGet (PcdFastBoot)) {
     PlatformRegisterOptionsAndKeys ();
   }
 
@@ -1264,7 +1266,8 @@ DetectAndPreparePlatformVirtioDevicePath (
 /**
   Connect the predefined platform default console device.
 
-  Always try to find and enable PCI display devices.
+  Always try to find and enable PCI display devices, unless PcdFastBoot
+  limits the consoles to the predefined ones.
 
   @param[in] PlatformConsole  Predefined platform default console device array.
 **/
@@ -1279,13 +1282,15 @@ PlatformInitializeConsole (
   // Do platform specific PCI Device check and add them to ConOut, ConIn,
   // ErrOut
   //
-  VisitAllPciInstances (DetectAndPreparePlatformPciDevicePath);
+  if (!FeaturePcdGet (PcdFastBoot)) {
+    VisitAllPciInstances (DetectAndPreparePlatformPciDevicePath);
 
-  VisitAllInstancesOfProtocol (
-    &gVirtioDeviceProtocolGuid,
-    DetectAndPreparePlatformVirtioDevicePath,
-    NULL
-    );
+    VisitAllInstancesOfProtocol (
+      &gVirtioDeviceProtocolGuid,
+      DetectAndPreparePlatformVirtioDevicePath,
+      NULL
+      );
+  }
 
   PrepareMicrovmDevicePath ();
 
@@ -1608,6 +1613,25 @@ ConnectRecursivelyIfPciMassStorage (
   return EFI_SUCCESS;
 }
 
+STATIC
+EFI_STATUS
+EFIAPI
+ConnectRecursivelyIfVirtioBlock (
+  IN EFI_HANDLE  Handle,
+  IN VOID        *Instance,
+  IN VOID        *Context
+  )
+{
+  VIRTIO_DEVICE_PROTOCOL  *VirtIo = (VIRTIO_DEVICE_PROTOCOL *)Instance;
+
+  if (VirtIo->SubSystemDeviceId != VIRTIO_SUBSYSTEM_BLOCK_DEVICE) {
+    return EFI_SUCCESS;
+  }
+
+  DEBUG ((DEBUG_INFO, "Found virtio block device\n"));
+  return gBS->ConnectController (Handle, NULL, NULL, TRUE);
+}
+
 /**
   This notification function is invoked when the
   EMU Variable FVB has been changed.
@@ -1710,6 +1734,21 @@ PlatformBdsConnectSequence (
 
   Status = ConnectDevicesFromQemu ();
   if (RETURN_ERROR (Status)) {
+    if (FeaturePcdGet (PcdFastBoot)) {
+      //
+      // Only connect the devices a boot option can be found on: PCI mass
+      // storage, which includes virtio-blk PCI, and virtio-mmio block devices
+      //
+      DEBUG ((DEBUG_INFO, "Connect block devices\n"));
+      VisitAllPciInstances (ConnectRecursivelyIfPciMassStorage);
+      VisitAllInstancesOfProtocol (
+        &gVirtioDeviceProtocolGuid,
+        ConnectRecursivelyIfVirtioBlock,
+        NULL
+        );
+      return;
+    }
+
     //
     // Just use the simple policy to connect all devices
     //
@@ -1807,7 +1846,9 @@ PlatformBootManagerAfterConsole (
   //
   // Logo show
   //
-  BootLogoEnableLogo ();
+  if (!FeaturePcdGet (PcdFastBoot)) {
+    BootLogoEnableLogo ();
+  }
 
   //
   // Set PCI Interrupt Line registers and ACPI SCI_EN
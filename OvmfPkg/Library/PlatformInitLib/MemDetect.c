@@ -1187,12 +1187,12 @@ PlatformQemuInitializeRam (
     SetMem (&MtrrSettings.Fixed, sizeof MtrrSettings.Fixed, MTRR_CACHE_WRITE_BACK);
     ZeroMem (&MtrrSettings.Variables, sizeof MtrrSettings.Variables);
     MtrrSettings.MtrrDefType |= BIT10;
-    MtrrSetAllMtrrs (&MtrrSettings);
 
     //
     // Set memory range from 640KB to 1MB to uncacheable
     //
-    Status = MtrrSetMemoryAttribute (
+    Status = MtrrSetMemoryAttributeInMtrrSettings (
+               &MtrrSettings,
                BASE_512KB + BASE_128KB,
                BASE_1MB - (BASE_512KB + BASE_128KB),
                CacheUncacheable
@@ -1203,12 +1203,18 @@ PlatformQemuInitializeRam (
     // Set the memory range from the start of the 32-bit PCI MMIO
     // aperture to 4GB as uncacheable.
     //
-    Status = MtrrSetMemoryAttribute (
+    Status = MtrrSetMemoryAttributeInMtrrSettings (
+               &MtrrSettings,
                PlatformInfoHob->Uc32Base,
                SIZE_4GB - PlatformInfoHob->Uc32Base,
                CacheUncacheable
                );
     ASSERT_EFI_ERROR (Status);
+
+    //
+    // Program the MTRRs once with all the settings above.
+    //
+    MtrrSetAllMtrrs (&MtrrSettings);
   }
 }
 
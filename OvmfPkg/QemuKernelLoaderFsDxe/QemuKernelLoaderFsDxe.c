@@ -107,6 +107,153 @@ STATIC CONST SINGLE_VENMEDIA_NODE_DEVPATH  mInitrdDevicePath = {
   }
 };
 
+//
+// Utility functions.
+//
+
+/**
+  Read the size of a blob in mKernelBlob from fw_cfg.
+
+  param[in,out] Blob  Pointer to the KERNEL_BLOB element in mKernelBlob whose
+                      size is to be read.
+**/
+STATIC
+VOID
+FetchBlobSize (
+  IN OUT KERNEL_BLOB  *Blob
+  )
+{
+  UINTN  Idx;
+
+  Blob->Size = 0;
+  for (Idx = 0; Idx < ARRAY_SIZE (Blob->FwCfgItem); Idx++) {
+    if (Blob->FwCfgItem[Idx].SizeKey == 0) {
+      break;
+    }
+
+    QemuFwCfgSelectItem (Blob->FwCfgItem[Idx].SizeKey);
+    Blob->FwCfgItem[Idx].Size = QemuFwCfgRead32 ();
+    Blob->Size               += Blob->FwCfgItem[Idx].Size;
+  }
+}
+
+/**
+  Read the data of a blob in mKernelBlob from fw_cfg, and verify it.
+
+  The data is read again each time, so the caller can pass the buffer the data
+  is finally used in, and save copying it.
+
+  param[in]  Blob    Pointer to the KERNEL_BLOB element in mKernelBlob that is
+                     to be read from fw_cfg. Blob->Size must have been set by
+                     FetchBlobSize().
+  param[out] Buffer  The buffer of at least Blob->Size bytes to read the data
+                     into.
+
+  @retval EFI_SUCCESS  The data is read and verified.
+
+  @return              Error codes from VerifyBlob().
+**/
+STATIC
+EFI_STATUS
+FetchBlobData (
+  IN  CONST KERNEL_BLOB  *Blob,
+  OUT UINT8              *Buffer
+  )
+{
+  UINT32  Left;
+  UINTN   Idx;
+  UINT8   *ChunkData;
+
+  DEBUG ((
+    DEBUG_INFO,
+    "%a: loading %Ld bytes for \"%s\"\n",
+    __func__,
+    (INT64)Blob->Size,
+    Blob->Name
+    ));
+
+  ChunkData = Buffer;
+  for (Idx = 0; Idx < ARRAY_SIZE (Blob->FwCfgItem); Idx++) {
+    if (Blob->FwCfgItem[Idx].DataKey == 0) {
+      break;
+    }
+
+    QemuFwCfgSelectItem (Blob->FwCfgItem[Idx].DataKey);
+
+    Left = Blob->FwCfgItem[Idx].Size;
+    while (Left > 0) {
+      UINT32  Chunk;
+
+      Chunk = (Left < SIZE_1MB) ? Left : SIZE_1MB;
+      QemuFwCfgReadBytes (Chunk, ChunkData + Blob->FwCfgItem[Idx].Size - Left);
+      Left -= Chunk;
+      DEBUG ((
+        DEBUG_VERBOSE,
+        "%a: %Ld bytes remaining for \"%s\" (%d)\n",
+        __func__,
+        (INT64)Left,
+        Blob->Name,
+        (INT32)Idx
+        ));
+    }
+
+    ChunkData += Blob->FwCfgItem[Idx].Size;
+  }
+
+  return VerifyBlob (Blob->Name, Buffer, Blob->Size, EFI_SUCCESS);
+}
+
+/**
+  Populate the data of a blob in mKernelBlob, when it is first needed.
+
+  param[in,out] Blob  Pointer to the KERNEL_BLOB element in mKernelBlob that is
+                      to be filled from fw_cfg.
+
+  @retval EFI_SUCCESS           Blob->Data has been populated. If fw_cfg
+                                reported a size of zero for the blob, then
+                                Blob->Data has been left unchanged; such a
+                                blob is verified by the entry point.
+
+  @retval EFI_OUT_OF_RESOURCES  Failed to allocate memory for Blob->Data.
+
+  @return                       Error codes from VerifyBlob().
+**/
+STATIC
+EFI_STATUS
+LoadBlob (
+  IN OUT KERNEL_BLOB  *Blob
+  )
+{
+  EFI_STATUS  Status;
+  UINT8       *Data;
+
+  if ((Blob->Data != NULL) || (Blob->Size == 0)) {
+    return EFI_SUCCESS;
+  }
+
+  Data = AllocatePool (Blob->Size);
+  if (Data == NULL) {
+    DEBUG ((
+      DEBUG_ERROR,
+      "%a: failed to allocate %Ld bytes for \"%s\"\n",
+      __func__,
+      (INT64)Blob->Size,
+      Blob->Name
+      ));
+    VerifyBlob (Blob->Name, NULL, 0, EFI_OUT_OF_RESOURCES);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = FetchBlobData (Blob, Data);
+  if (EFI_ERROR (Status)) {
+    FreePool (Data);
+    return Status;
+  }
+
+  Blob->Data = Data;
+  return EFI_SUCCESS;
+}
+
 //
 // The "file in the EFI stub filesystem" abstraction.
 //
@@ -355,9 +502,10 @@ StubFileRead (
   OUT VOID              *Buffer
   )
 {
-  STUB_FILE          *StubFile;
-  CONST KERNEL_BLOB  *Blob;
-  UINT64             Left;
+  STUB_FILE    *StubFile;
+  KERNEL_BLOB  *Blob;
+  UINT64       Left;
+  EFI_STATUS   Status;
 
   StubFile = STUB_FILE_FROM_FILE (This);
 
@@ -365,8 +513,6 @@ StubFileRead (
   // Scanning the root directory?
   //
   if (StubFile->BlobType == KernelBlobTypeMax) {
-    EFI_STATUS  Status;
-
     if (StubFile->Position == KernelBlobTypeMax) {
       //
       // Scanning complete.
@@ -401,8 +547,23 @@ StubFileRead (
     *BufferSize = (UINTN)Left;
   }
 
-  if (Blob->Data != NULL) {
-    CopyMem (Buffer, Blob->Data + StubFile->Position, *BufferSize);
+  //
+  // A read of the whole blob, like the one of LoadImage(), gets the data
+  // straight from fw_cfg. Other reads are served from the blob's data, which
+  // is fetched on the first of them.
+  //
+  if ((Blob->Data == NULL) && (StubFile->Position == 0) && (*BufferSize == Blob->Size) && (Blob->Size > 0)) {
+    Status = FetchBlobData (Blob, Buffer);
+  } else {
+    Status = LoadBlob (Blob);
+    if (!EFI_ERROR (Status) && (Blob->Data != NULL)) {
+      CopyMem (Buffer, Blob->Data + StubFile->Position, *BufferSize);
+    }
+  }
+
+  if (EFI_ERROR (Status)) {
+    *BufferSize = 0;
+    return Status;
   }
 
   StubFile->Position += *BufferSize;
@@ -884,6 +1045,7 @@ InitrdLoadFile2 (
   )
 {
   CONST KERNEL_BLOB  *InitrdBlob = &mKernelBlob[KernelBlobTypeInitrd];
+  EFI_STATUS         Status;
 
   ASSERT (InitrdBlob->Size > 0);
 
@@ -906,7 +1068,17 @@ InitrdLoadFile2 (
     return EFI_BUFFER_TOO_SMALL;
   }
 
-  CopyMem (Buffer, InitrdBlob->Data, InitrdBlob->Size);
+  //
+  // The initrd is read from fw_cfg right into the buffer of the caller.
+  //
+  if (InitrdBlob->Data != NULL) {
+    CopyMem (Buffer, InitrdBlob->Data, InitrdBlob->Size);
+  } else {
+    Status = FetchBlobData (InitrdBlob, Buffer);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
 
   *BufferSize = InitrdBlob->Size;
   return EFI_SUCCESS;
@@ -916,116 +1088,16 @@ STATIC CONST EFI_LOAD_FILE2_PROTOCOL  mInitrdLoadFile2 = {
   InitrdLoadFile2,
 };
 
-//
-// Utility functions.
-//
-
-/**
-  Populate a blob in mKernelBlob.
-
-  param[in,out] Blob  Pointer to the KERNEL_BLOB element in mKernelBlob that is
-                      to be filled from fw_cfg.
-
-  @retval EFI_SUCCESS           Blob has been populated. If fw_cfg reported a
-                                size of zero for the blob, then Blob->Data has
-                                been left unchanged.
-
-  @retval EFI_OUT_OF_RESOURCES  Failed to allocate memory for Blob->Data.
-**/
-STATIC
-EFI_STATUS
-FetchBlob (
-  IN OUT KERNEL_BLOB  *Blob
-  )
-{
-  UINT32  Left;
-  UINTN   Idx;
-  UINT8   *ChunkData;
-
-  //
-  // Read blob size.
-  //
-  Blob->Size = 0;
-  for (Idx = 0; Idx < ARRAY_SIZE (Blob->FwCfgItem); Idx++) {
-    if (Blob->FwCfgItem[Idx].SizeKey == 0) {
-      break;
-    }
-
-    QemuFwCfgSelectItem (Blob->FwCfgItem[Idx].SizeKey);
-    Blob->FwCfgItem[Idx].Size = QemuFwCfgRead32 ();
-    Blob->Size               += Blob->FwCfgItem[Idx].Size;
-  }
-
-  if (Blob->Size == 0) {
-    return EFI_SUCCESS;
-  }
-
-  //
-  // Read blob.
-  //
-  Blob->Data = AllocatePool (Blob->Size);
-  if (Blob->Data == NULL) {
-    DEBUG ((
-      DEBUG_ERROR,
-      "%a: failed to allocate %Ld bytes for \"%s\"\n",
-      __func__,
-      (INT64)Blob->Size,
-      Blob->Name
-      ));
-    return EFI_OUT_OF_RESOURCES;
-  }
-
-  DEBUG ((
-    DEBUG_INFO,
-    "%a: loading %Ld bytes for \"%s\"\n",
-    __func__,
-    (INT64)Blob->Size,
-    Blob->Name
-    ));
-
-  ChunkData = Blob->Data;
-  for (Idx = 0; Idx < ARRAY_SIZE (Blob->FwCfgItem); Idx++) {
-    if (Blob->FwCfgItem[Idx].DataKey == 0) {
-      break;
-    }
-
-    QemuFwCfgSelectItem (Blob->FwCfgItem[Idx].DataKey);
-
-    Left = Blob->FwCfgItem[Idx].Size;
-    while (Left > 0) {
-      UINT32  Chunk;
-
-      Chunk = (Left < SIZE_1MB) ? Left : SIZE_1MB;
-      QemuFwCfgReadBytes (Chunk, ChunkData + Blob->FwCfgItem[Idx].Size - Left);
-      Left -= Chunk;
-      DEBUG ((
-        DEBUG_VERBOSE,
-        "%a: %Ld bytes remaining for \"%s\" (%d)\n",
-        __func__,
-        (INT64)Left,
-        Blob->Name,
-        (INT32)Idx
-        ));
-    }
-
-    ChunkData += Blob->FwCfgItem[Idx].Size;
-  }
-
-  return EFI_SUCCESS;
-}
-
 //
 // The entry point of the feature.
 //
 
 /**
-  Download the kernel, the initial ramdisk, and the kernel command line from
+  Look up the kernel, the initial ramdisk, and the kernel command line in
   QEMU's fw_cfg. Construct a minimal SimpleFileSystem that contains the two
-  image files.
+  image files. The blobs are downloaded when their files are read.
 
   @retval EFI_NOT_FOUND         Kernel image was not found.
-  @retval EFI_OUT_OF_RESOURCES  Memory allocation failed.
-  @retval EFI_PROTOCOL_ERROR    Unterminated kernel command line.
 
   @return                       Error codes from any of the underlying
                                 functions. On success, the function doesn't
@@ -1042,7 +1114,6 @@ QemuKernelLoaderFsDxeEntrypoint (
   KERNEL_BLOB  *CurrentBlob;
   KERNEL_BLOB  *KernelBlob;
   EFI_STATUS   Status;
-  EFI_STATUS   FetchStatus;
   EFI_HANDLE   FileSystemHandle;
   EFI_HANDLE   InitrdLoadFile2Handle;
 
@@ -1057,20 +1128,18 @@ QemuKernelLoaderFsDxeEntrypoint (
   }
 
   //
-  // Fetch all blobs.
+  // Fetch the sizes of all blobs. A missing blob is verified right away, the
+  // others are verified when they are downloaded.
   //
   for (BlobType = 0; BlobType < KernelBlobTypeMax; ++BlobType) {
     CurrentBlob = &mKernelBlob[BlobType];
-    FetchStatus = FetchBlob (CurrentBlob);
+    FetchBlobSize (CurrentBlob);
 
-    Status = VerifyBlob (
-               CurrentBlob->Name,
-               CurrentBlob->Data,
-               CurrentBlob->Size,
-               FetchStatus
-               );
-    if (EFI_ERROR (Status)) {
-      goto FreeBlobs;
+    if (CurrentBlob->Size == 0) {
+      Status = VerifyBlob (CurrentBlob->Name, NULL, 0, EFI_SUCCESS);
+      if (EFI_ERROR (Status)) {
+        return Status;
+      }
     }
 
     mTotalBlobBytes += CurrentBlob->Size;
@@ -1078,9 +1147,8 @@ QemuKernelLoaderFsDxeEntrypoint (
 
   KernelBlob = &mKernelBlob[KernelBlobTypeKernel];
 
-  if (KernelBlob->Data == NULL) {
-    Status = EFI_NOT_FOUND;
-    goto FreeBlobs;
+  if (KernelBlob->Size == 0) {
+    return EFI_NOT_FOUND;
   }
 
   //
@@ -1103,7 +1171,7 @@ QemuKernelLoaderFsDxeEntrypoint (
       __func__,
       Status
       ));
-    goto FreeBlobs;
+    return Status;
   }
 
   if (KernelBlob[KernelBlobTypeInitrd].Size > 0) {
@@ -1140,15 +1208,5 @@ UninstallFileSystemHandle:
                   );
   ASSERT_EFI_ERROR (Status);
 
-FreeBlobs:
-  while (BlobType > 0) {
-    CurrentBlob = &mKernelBlob[--BlobType];
-    if (CurrentBlob->Data != NULL) {
-      FreePool (CurrentBlob->Data);
-      CurrentBlob->Size = 0;
-      CurrentBlob->Data = NULL;
-    }
-  }
-
   return Status;
 }
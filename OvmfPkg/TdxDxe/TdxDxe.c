@@ -33,7 +33,6 @@
 #include <TdxAcpiTable.h>
 #include <Library/MemEncryptTdxLib.h>
 
-#define ALIGNED_2MB_MASK  0x1fffff
 EFI_HANDLE  mTdxDxeHandle = NULL;
 
 EFI_STATUS
@@ -46,73 +45,44 @@ TdxMemoryAccept (
 {
   EFI_STATUS  Status;
   UINT32      AcceptPageSize;
-  UINT64      StartAddress1;
-  UINT64      StartAddress2;
-  UINT64      StartAddress3;
-  UINT64      Length1;
-  UINT64      Length2;
-  UINT64      Length3;
+  UINT32      PageSize;
+  UINT64      Length;
   UINT64      Pages;
+  UINT64      EndAddress;
 
   AcceptPageSize = FixedPcdGet32 (PcdTdxAcceptPageSize);
-  StartAddress1  = 0;
-  StartAddress2  = 0;
-  StartAddress3  = 0;
-  Length1        = 0;
-  Length2        = 0;
-  Length3        = 0;
-
-  if (Size == 0) {
-    return EFI_SUCCESS;
-  }
+  EndAddress     = StartAddress + Size;
+  Status         = EFI_SUCCESS;
 
-  if (ALIGN_VALUE (StartAddress, SIZE_2MB) != StartAddress) {
-    StartAddress1 = StartAddress;
-    Length1       = ALIGN_VALUE (StartAddress, SIZE_2MB) - StartAddress;
-    if (Length1 >= Size) {
-      Length1 = Size;
+  while (!EFI_ERROR (Status) && (StartAddress < EndAddress)) {
+    //
+    // Use the largest page size the address is aligned to and the range can hold.
+    //
+    PageSize = AcceptPageSize;
+    while ((PageSize > SIZE_4KB) &&
+           (((StartAddress & (PageSize - 1)) != 0) || (EndAddress - StartAddress < PageSize)))
+    {
+      PageSize = (PageSize == SIZE_1GB) ? SIZE_2MB : SIZE_4KB;
     }
 
-    StartAddress += Length1;
-    Size         -= Length1;
-  }
-
-  if (Size > SIZE_2MB) {
-    StartAddress2 = StartAddress;
-    Length2       = Size & ~(UINT64)ALIGNED_2MB_MASK;
-    StartAddress += Length2;
-    Size         -= Length2;
-  }
-
-  if (Size) {
-    StartAddress3 = StartAddress;
-    Length3       = Size;
-  }
-
-  Status = EFI_SUCCESS;
-  if (Length1 > 0) {
-    Pages  = Length1 / SIZE_4KB;
-    Status = TdAcceptPages (StartAddress1, Pages, SIZE_4KB);
-    if (EFI_ERROR (Status)) {
-      return Status;
+    //
+    // Accept the pages up to the next boundary of the larger page size,
+    // from where the larger pages can be used again.
+    //
+    Length = EndAddress - StartAddress;
+    if (PageSize < AcceptPageSize) {
+      Length = MIN (Length, ALIGN_VALUE (StartAddress + 1, (PageSize == SIZE_4KB) ? SIZE_2MB : SIZE_1GB) - StartAddress);
     }
-  }
 
-  if (Length2 > 0) {
-    Pages  = Length2 / AcceptPageSize;
-    Status = TdAcceptPages (StartAddress2, Pages, AcceptPageSize);
-    if (EFI_ERROR (Status)) {
-      return Status;
+    Pages = Length / PageSize;
+    if (Pages == 0) {
+      ASSERT (FALSE);
+      return EFI_INVALID_PARAMETER;
     }
-  }
 
-  if (Length3 > 0) {
-    Pages  = Length3 / SIZE_4KB;
-    Status = TdAcceptPages (StartAddress3, Pages, SIZE_4KB);
+    Status = TdAcceptPages (StartAddress, Pages, PageSize);
     ASSERT (!EFI_ERROR (Status));
-    if (EFI_ERROR (Status)) {
-      return Status;
-    }
+    StartAddress += Pages * PageSize;
   }
 
   return Status;
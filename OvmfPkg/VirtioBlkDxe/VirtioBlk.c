@@ -6,9 +6,10 @@
 
   - No attach/detach (ie. removable media).
 
-  - Although the non-blocking interfaces of EFI_BLOCK_IO2_PROTOCOL could be a
-    good match for multiple in-flight virtio-blk requests, we stick to
-    synchronous requests and EFI_BLOCK_IO_PROTOCOL for now.
+  - Requests are carried out in slots of three descriptors each, so that as
+    many requests as the virtqueue has slots may be in flight at the same
+    time. The non-blocking interfaces of EFI_BLOCK_IO2_PROTOCOL queue their
+    requests and complete them from a timer; the blocking ones poll.
 
   Copyright (C) 2012, Red Hat, Inc.
   Copyright (c) 2012 - 2018, Intel Corporation. All rights reserved.<BR>
@@ -19,7 +20,6 @@
 
 **/
 
-#include <IndustryStandard/VirtioBlk.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
 #include <Library/MemoryAllocationLib.h>
@@ -29,6 +29,11 @@
 
 #include "VirtioBlk.h"
 
+//
+// The period of the timer that completes non-blocking requests.
+//
+#define VBLK_POLL_PERIOD  EFI_TIMER_PERIOD_MILLISECONDS (1)
+
 /**
 
   Convenience macros to read and write region 0 IO space elements of the
@@ -177,15 +182,483 @@ VerifyReadWriteRequest (
 
 /**
 
-  Format a read / write / flush request as three consecutive virtio
-  descriptors, push them to the host, and poll for the response.
+  Hand one sub-request of Request to the host, in a free slot.
+
+  The sub-request covers as much of the remaining transfer as a single data
+  descriptor may describe (see Dev->MaxSegmentSize). Its descriptor chain is
+  placed on the available ring at *AvailIdx, but the ring index itself is not
+  published; that's left to the caller, so that several sub-requests can be
+  exposed to the host with one notification.
+
+  Must be called at TPL_NOTIFY, with at least one free slot.
+
+  @param[in,out] Dev       The virtio-blk device.
+
+  @param[in,out] Request   The request to continue.
+
+  @param[in,out] AvailIdx  On input, the next available ring index to fill in.
+                           On output, incremented past the new entry.
+
+  @retval EFI_SUCCESS       The sub-request has been placed on the ring.
+
+  @retval EFI_DEVICE_ERROR  Failed to map the data buffer for a bus master
+                            operation.
+
+**/
+STATIC
+EFI_STATUS
+VirtioBlkStartSlot (
+  IN OUT VBLK_DEV      *Dev,
+  IN OUT VBLK_REQUEST  *Request,
+  IN OUT UINT16        *AvailIdx
+  )
+{
+  UINT32                     BlockSize;
+  UINT16                     Slot;
+  volatile VBLK_SLOT_SHARED  *Shared;
+  EFI_PHYSICAL_ADDRESS       SharedDeviceAddress;
+  EFI_PHYSICAL_ADDRESS       BufferDeviceAddress;
+  VOID                       *BufferMapping;
+  UINTN                      Size;
+  BOOLEAN                    RequestIsWrite;
+  DESC_INDICES               Indices;
+  EFI_STATUS                 Status;
+
+  ASSERT (Dev->InFlight < Dev->MaxInFlight);
+
+  BlockSize           = Dev->BlockIoMedia.BlockSize;
+  Slot                = Dev->FreeSlotStack[Dev->InFlight];
+  Shared              = &Dev->SlotShared[Slot];
+  SharedDeviceAddress = Dev->SlotSharedAddress + Slot * sizeof (VBLK_SLOT_SHARED);
+  Size                = MIN (
+                          Request->BufferSize - Request->SubmittedSize,
+                          Dev->MaxSegmentSize
+                          );
+  RequestIsWrite = (BOOLEAN)(Request->Type != VIRTIO_BLK_T_IN);
+  BufferMapping  = NULL;
+
+  //
+  // Map the data buffer, if any.
+  //
+  if (Size > 0) {
+    Status = VirtioMapAllBytesInSharedBuffer (
+               Dev->VirtIo,
+               (RequestIsWrite ?
+                VirtioOperationBusMasterRead :
+                VirtioOperationBusMasterWrite),
+               Request->Buffer + Request->SubmittedSize,
+               Size,
+               &BufferDeviceAddress,
+               &BufferMapping
+               );
+    if (EFI_ERROR (Status)) {
+      return EFI_DEVICE_ERROR;
+    }
+  }
+
+  //
+  // Prepare virtio-blk request header. IO Priority is homogeneously 0. Preset
+  // a host status for ourselves that we do not accept as success.
+  //
+  Shared->Header.Type   = Request->Type;
+  Shared->Header.IoPrio = 0;
+  Shared->Header.Sector = MultU64x32 (Request->Lba, BlockSize / 512) +
+                          Request->SubmittedSize / 512;
+  Shared->HostStatus    = VIRTIO_BLK_S_IOERR;
+
+  //
+  // virtio-blk header in first desc, data buffer for read/write in second
+  // desc, host status in last (second or third) desc. VRING_DESC_F_WRITE is
+  // interpreted from the host's point of view.
+  //
+  Indices.HeadDescIdx = (UINT16)(Slot * VBLK_DESC_PER_SLOT);
+  Indices.NextDescIdx = Indices.HeadDescIdx;
+
+  VirtioAppendDesc (
+    &Dev->Ring,
+    SharedDeviceAddress + OFFSET_OF (VBLK_SLOT_SHARED, Header),
+    sizeof (VIRTIO_BLK_REQ),
+    VRING_DESC_F_NEXT,
+    &Indices
+    );
+
+  if (Size > 0) {
+    //
+    // Dev->MaxSegmentSize is at most SIZE_1GB, so converting Size to UINT32
+    // will not truncate it.
+    //
+    VirtioAppendDesc (
+      &Dev->Ring,
+      BufferDeviceAddress,
+      (UINT32)Size,
+      VRING_DESC_F_NEXT | (RequestIsWrite ? 0 : VRING_DESC_F_WRITE),
+      &Indices
+      );
+  }
+
+  VirtioAppendDesc (
+    &Dev->Ring,
+    SharedDeviceAddress + OFFSET_OF (VBLK_SLOT_SHARED, HostStatus),
+    sizeof Shared->HostStatus,
+    VRING_DESC_F_WRITE,
+    &Indices
+    );
+
+  Dev->Ring.Avail.Ring[(*AvailIdx)++ % Dev->Ring.QueueSize] = Indices.HeadDescIdx;
+
+  Dev->Slots[Slot].Request       = Request;
+  Dev->Slots[Slot].BufferMapping = BufferMapping;
+  Dev->InFlight++;
+
+  Request->SubmittedSize += Size;
+  Request->Started        = TRUE;
+  Request->InFlight++;
+
+  return EFI_SUCCESS;
+}
+
+/**
+
+  Retire a request whose sub-requests have all been handled.
+
+  The request is unlinked from Dev->Requests. A non-blocking request's token
+  is completed and the request is freed; a blocking request is only marked as
+  done, as its owner is polling for that.
+
+  Must be called at TPL_NOTIFY.
+
+  @param[in,out] Request  The request to retire.
+
+**/
+STATIC
+VOID
+VirtioBlkCompleteRequest (
+  IN OUT VBLK_REQUEST  *Request
+  )
+{
+  ASSERT (Request->InFlight == 0);
+
+  RemoveEntryList (&Request->Link);
 
-  This is the main workhorse function. Two use cases are supported, read/write
-  and flush. The function may only be called after the request parameters have
-  been verified by
+  if (Request->Token == NULL) {
+    Request->Done = TRUE;
+    return;
+  }
+
+  Request->Token->TransactionStatus = Request->Status;
+  gBS->SignalEvent (Request->Token->Event);
+  FreePool (Request);
+}
+
+/**
+
+  Start as many queued sub-requests as there are free slots, and notify the
+  host about them with a single notification.
+
+  Requests are started in queueing order. A flush is started only after every
+  sub-request handed to the host earlier has completed, and no request queued
+  after a flush is started before the flush itself.
+
+  Must be called at TPL_NOTIFY.
+
+  @param[in,out] Dev  The virtio-blk device.
+
+**/
+STATIC
+VOID
+VirtioBlkSubmitRequests (
+  IN OUT VBLK_DEV  *Dev
+  )
+{
+  LIST_ENTRY    *Entry;
+  LIST_ENTRY    *NextEntry;
+  VBLK_REQUEST  *Request;
+  UINT16        AvailIdx;
+  EFI_STATUS    Status;
+
+  AvailIdx = *Dev->Ring.Avail.Idx;
+
+  for (Entry = GetFirstNode (&Dev->Requests);
+       !IsNull (&Dev->Requests, Entry) && (Dev->InFlight < Dev->MaxInFlight);
+       Entry = NextEntry)
+  {
+    NextEntry = GetNextNode (&Dev->Requests, Entry);
+    Request   = VBLK_REQUEST_FROM_LINK (Entry);
+
+    if (Request->Started && (Request->SubmittedSize == Request->BufferSize)) {
+      continue;
+    }
+
+    if ((Request->Type == VIRTIO_BLK_T_FLUSH) && (Dev->InFlight > 0)) {
+      break;
+    }
+
+    while ((!Request->Started ||
+            (Request->SubmittedSize < Request->BufferSize)) &&
+           (Dev->InFlight < Dev->MaxInFlight))
+    {
+      Status = VirtioBlkStartSlot (Dev, Request, &AvailIdx);
+      if (EFI_ERROR (Status)) {
+        //
+        // Give up on the rest of the request.
+        //
+        Request->Status        = Status;
+        Request->Started       = TRUE;
+        Request->SubmittedSize = Request->BufferSize;
+        if (Request->InFlight == 0) {
+          VirtioBlkCompleteRequest (Request);
+        }
+
+        break;
+      }
+    }
+
+    if (Request->Type == VIRTIO_BLK_T_FLUSH) {
+      break;
+    }
+  }
+
+  if (AvailIdx == *Dev->Ring.Avail.Idx) {
+    return;
+  }
+
+  //
+  // virtio-0.9.5, 2.4.1.3 Updating the Index Field
+  //
+  MemoryFence ();
+  *Dev->Ring.Avail.Idx = AvailIdx;
+
+  //
+  // virtio-0.9.5, 2.4.1.4 Notifying the Device -- gratuitous notifications are
+  // OK. virtio-blk's only virtqueue is #0, called "requestq" (see Appendix D).
+  //
+  MemoryFence ();
+  Status = Dev->VirtIo->SetQueueNotify (Dev->VirtIo, 0);
+  if (EFI_ERROR (Status)) {
+    //
+    // The descriptor chains are already visible to the host; they will be
+    // picked up with the next successful notification.
+    //
+    DEBUG ((DEBUG_ERROR, "%a: SetQueueNotify: %r\n", __func__, Status));
+  }
+}
+
+/**
+
+  Collect the sub-requests the host has completed, free their slots, and
+  retire the requests that have become complete with them.
+
+  Must be called at TPL_NOTIFY.
+
+  @param[in,out] Dev  The virtio-blk device.
+
+**/
+STATIC
+VOID
+VirtioBlkReapRequests (
+  IN OUT VBLK_DEV  *Dev
+  )
+{
+  UINT16        UsedIdx;
+  UINT32        DescIdx;
+  UINT16        Slot;
+  VBLK_REQUEST  *Request;
+  EFI_STATUS    UnmapStatus;
+
+  //
+  // virtio-0.9.5, 2.4.2 Receiving Used Buffers From the Device
+  //
+  MemoryFence ();
+  UsedIdx = *Dev->Ring.Used.Idx;
+  MemoryFence ();
+
+  while (Dev->LastUsed != UsedIdx) {
+    DescIdx = Dev->Ring.Used.UsedElem[Dev->LastUsed++ % Dev->Ring.QueueSize].Id;
+    ASSERT (DescIdx % VBLK_DESC_PER_SLOT == 0);
+    Slot = (UINT16)(DescIdx / VBLK_DESC_PER_SLOT);
+    ASSERT (Slot < Dev->MaxInFlight);
+
+    Request = Dev->Slots[Slot].Request;
+    ASSERT (Request != NULL);
+
+    if (Dev->Slots[Slot].BufferMapping != NULL) {
+      UnmapStatus = Dev->VirtIo->UnmapSharedBuffer (
+                                   Dev->VirtIo,
+                                   Dev->Slots[Slot].BufferMapping
+                                   );
+      if (EFI_ERROR (UnmapStatus) && (Request->Type == VIRTIO_BLK_T_IN)) {
+        //
+        // Data from the bus master may not reach the caller; fail the request.
+        //
+        Request->Status = EFI_DEVICE_ERROR;
+      }
+    }
+
+    if (Dev->SlotShared[Slot].HostStatus != VIRTIO_BLK_S_OK) {
+      //
+      // Fail the request, and do not start the rest of it.
+      //
+      Request->Status        = EFI_DEVICE_ERROR;
+      Request->SubmittedSize = Request->BufferSize;
+    }
+
+    Dev->Slots[Slot].Request            = NULL;
+    Dev->Slots[Slot].BufferMapping      = NULL;
+    Dev->FreeSlotStack[--Dev->InFlight] = Slot;
+    Request->InFlight--;
+
+    if ((Request->InFlight == 0) &&
+        (Request->SubmittedSize == Request->BufferSize))
+    {
+      VirtioBlkCompleteRequest (Request);
+    }
+  }
+}
+
+/**
+
+  Make progress with the queued requests: retire what the host has completed,
+  and start what fits into the freed slots.
+
+  @param[in,out] Dev  The virtio-blk device.
+
+  @retval TRUE   No request is queued any longer.
+
+  @retval FALSE  Requests are still queued or in flight.
+
+**/
+STATIC
+BOOLEAN
+VirtioBlkPoll (
+  IN OUT VBLK_DEV  *Dev
+  )
+{
+  EFI_TPL  OldTpl;
+  BOOLEAN  Idle;
+
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  VirtioBlkReapRequests (Dev);
+  VirtioBlkSubmitRequests (Dev);
+  Idle = IsListEmpty (&Dev->Requests);
+  gBS->RestoreTPL (OldTpl);
+
+  return Idle;
+}
+
+/**
+
+  Timer notification function that completes non-blocking requests.
+
+  The timer is armed by VirtioBlkQueueRequest() for a non-blocking request,
+  and cancelled here once no request is left.
+
+  @param[in] Event    Event whose notification function is being invoked.
+
+  @param[in] Context  Pointer to the VBLK_DEV structure.
+
+**/
+STATIC
+VOID
+EFIAPI
+VirtioBlkPollTimer (
+  IN  EFI_EVENT  Event,
+  IN  VOID       *Context
+  )
+{
+  VBLK_DEV  *Dev;
+
+  Dev = Context;
+  if (VirtioBlkPoll (Dev)) {
+    gBS->SetTimer (Dev->PollTimer, TimerCancel, 0);
+    Dev->PollTimerArmed = FALSE;
+  }
+}
+
+/**
+
+  Queue a verified request, and start it at once if slots are free.
+
+  @param[in,out] Dev      The virtio-blk device.
+
+  @param[in,out] Request  The request to queue. Its owner must keep it valid
+                          until it completes.
+
+**/
+STATIC
+VOID
+VirtioBlkQueueRequest (
+  IN OUT VBLK_DEV      *Dev,
+  IN OUT VBLK_REQUEST  *Request
+  )
+{
+  EFI_TPL     OldTpl;
+  BOOLEAN     NonBlocking;
+  EFI_STATUS  Status;
+
+  //
+  // A non-blocking request may be completed and freed while it is submitted.
+  //
+  NonBlocking = (BOOLEAN)(Request->Token != NULL);
+
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  InsertTailList (&Dev->Requests, &Request->Link);
+  VirtioBlkSubmitRequests (Dev);
+
+  if (NonBlocking && !Dev->PollTimerArmed) {
+    Status = gBS->SetTimer (Dev->PollTimer, TimerPeriodic, VBLK_POLL_PERIOD);
+    ASSERT_EFI_ERROR (Status);
+    Dev->PollTimerArmed = !EFI_ERROR (Status);
+  }
+
+  gBS->RestoreTPL (OldTpl);
+}
+
+/**
+
+  Wait until a blocking request completes, or -- if Request is NULL -- until
+  every queued request completes.
+
+  Keep slowing down until we reach a poll period of slightly above 1 ms.
+
+  @param[in,out] Dev      The virtio-blk device.
+
+  @param[in]     Request  The blocking request to wait for, or NULL.
+
+**/
+STATIC
+VOID
+VirtioBlkWait (
+  IN OUT VBLK_DEV               *Dev,
+  IN     volatile VBLK_REQUEST  *Request  OPTIONAL
+  )
+{
+  UINTN  PollPeriodUsecs;
+
+  PollPeriodUsecs = 1;
+  while (!VirtioBlkPoll (Dev) && ((Request == NULL) || !Request->Done)) {
+    gBS->Stall (PollPeriodUsecs); // calls AcpiTimerLib::MicroSecondDelay
+
+    if (PollPeriodUsecs < 1024) {
+      PollPeriodUsecs *= 2;
+    }
+  }
+}
+
+/**
+
+  Carry out a read / write / flush request, and wait for its completion.
+
+  This is the main workhorse function of the blocking interfaces. Two use
+  cases are supported, read/write and flush. The function may only be called
+  after the request parameters have been verified by
   - specific checks in ReadBlocks() / WriteBlocks() / FlushBlocks(), and
   - VerifyReadWriteRequest() (for read/write only).
 
+  Non-blocking requests queued earlier are let to complete first, so that the
+  blocking request observes their effects. A transfer larger than
+  Dev->MaxSegmentSize is split into sub-requests that are in flight at the
+  same time.
+
   Parameters handled commonly:
 
     @param[in] Dev             The virtio-blk device the request is targeted
@@ -223,8 +696,7 @@ VerifyReadWriteRequest (
 
   @retval EFI_SUCCESS          Transfer complete.
 
-  @retval EFI_DEVICE_ERROR     Failed to notify host side via VirtIo write, or
-                               unable to parse host response, or host response
+  @retval EFI_DEVICE_ERROR     Unable to parse host response, or host response
                                is not VIRTIO_BLK_S_OK or failed to map Buffer
                                for a bus master operation.
 
@@ -240,231 +712,104 @@ SynchronousRequest (
   IN              BOOLEAN   RequestIsWrite
   )
 {
-  UINT32                   BlockSize;
-  volatile VIRTIO_BLK_REQ  *Request;
-  volatile UINT8           *HostStatus;
-  VOID                     *HostStatusBuffer;
-  DESC_INDICES             Indices;
-  VOID                     *RequestMapping;
-  VOID                     *StatusMapping;
-  VOID                     *BufferMapping;
-  EFI_PHYSICAL_ADDRESS     BufferDeviceAddress;
-  EFI_PHYSICAL_ADDRESS     HostStatusDeviceAddress;
-  EFI_PHYSICAL_ADDRESS     RequestDeviceAddress;
-  EFI_STATUS               Status;
-  EFI_STATUS               UnmapStatus;
-
-  BlockSize = Dev->BlockIoMedia.BlockSize;
-
-  //
-  // Set BufferMapping and BufferDeviceAddress to suppress incorrect
-  // compiler/analyzer warnings.
-  //
-  BufferMapping       = NULL;
-  BufferDeviceAddress = 0;
+  VBLK_REQUEST  Request;
 
   //
   // ensured by VirtioBlkInit()
   //
-  ASSERT (BlockSize > 0);
-  ASSERT (BlockSize % 512 == 0);
+  ASSERT (Dev->BlockIoMedia.BlockSize > 0);
+  ASSERT (Dev->BlockIoMedia.BlockSize % 512 == 0);
 
   //
   // ensured by contract above, plus VerifyReadWriteRequest()
   //
-  ASSERT (BufferSize % BlockSize == 0);
+  ASSERT (BufferSize % Dev->BlockIoMedia.BlockSize == 0);
 
-  Request = AllocateZeroPool (sizeof (*Request));
-  if (Request == NULL) {
-    return EFI_DEVICE_ERROR;
-  }
+  ZeroMem (&Request, sizeof Request);
+  Request.Signature  = VBLK_REQ_SIG;
+  Request.Lba        = Lba;
+  Request.Buffer     = (UINT8 *)Buffer;
+  Request.BufferSize = BufferSize;
+  Request.Status     = EFI_SUCCESS;
 
-  //
-  // Prepare virtio-blk request header, setting zero size for flush.
-  // IO Priority is homogeneously 0.
-  //
-  Request->Type = RequestIsWrite ?
-                  (BufferSize == 0 ? VIRTIO_BLK_T_FLUSH : VIRTIO_BLK_T_OUT) :
-                  VIRTIO_BLK_T_IN;
-  Request->IoPrio = 0;
-  Request->Sector = MultU64x32 (Lba, BlockSize / 512);
+  Request.Type = RequestIsWrite ?
+                 (BufferSize == 0 ? VIRTIO_BLK_T_FLUSH : VIRTIO_BLK_T_OUT) :
+                 VIRTIO_BLK_T_IN;
 
-  //
-  // Host status is bi-directional (we preset with a value and expect the
-  // device to update it). Allocate a host status buffer which can be mapped
-  // to access equally by both processor and the device.
-  //
-  Status = Dev->VirtIo->AllocateSharedPages (
-                          Dev->VirtIo,
-                          EFI_SIZE_TO_PAGES (sizeof *HostStatus),
-                          &HostStatusBuffer
-                          );
-  if (EFI_ERROR (Status)) {
-    Status = EFI_DEVICE_ERROR;
-    goto FreeBlkRequest;
-  }
+  VirtioBlkWait (Dev, NULL);
+  VirtioBlkQueueRequest (Dev, &Request);
+  VirtioBlkWait (Dev, &Request);
 
-  HostStatus = HostStatusBuffer;
+  return Request.Status;
+}
 
-  //
-  // Map virtio-blk request header (must be done after request header is
-  // populated)
-  //
-  Status = VirtioMapAllBytesInSharedBuffer (
-             Dev->VirtIo,
-             VirtioOperationBusMasterRead,
-             (VOID *)Request,
-             sizeof (*Request),
-             &RequestDeviceAddress,
-             &RequestMapping
-             );
-  if (EFI_ERROR (Status)) {
-    Status = EFI_DEVICE_ERROR;
-    goto FreeHostStatusBuffer;
-  }
+/**
 
-  //
-  // Map data buffer
-  //
-  if (BufferSize > 0) {
-    Status = VirtioMapAllBytesInSharedBuffer (
-               Dev->VirtIo,
-               (RequestIsWrite ?
-                VirtioOperationBusMasterRead :
-                VirtioOperationBusMasterWrite),
-               (VOID *)Buffer,
-               BufferSize,
-               &BufferDeviceAddress,
-               &BufferMapping
-               );
-    if (EFI_ERROR (Status)) {
-      Status = EFI_DEVICE_ERROR;
-      goto UnmapRequestBuffer;
-    }
-  }
+  Queue a read / write / flush request on behalf of EFI_BLOCK_IO2_PROTOCOL,
+  or carry it out synchronously if no event is attached to the token.
 
-  //
-  // preset a host status for ourselves that we do not accept as success
-  //
-  *HostStatus = VIRTIO_BLK_S_IOERR;
+  The function may only be called after the request parameters have been
+  verified, like for SynchronousRequest().
 
-  //
-  // Map the Status Buffer with VirtioOperationBusMasterCommonBuffer so that
-  // both processor and device can access it.
-  //
-  Status = VirtioMapAllBytesInSharedBuffer (
-             Dev->VirtIo,
-             VirtioOperationBusMasterCommonBuffer,
-             HostStatusBuffer,
-             sizeof *HostStatus,
-             &HostStatusDeviceAddress,
-             &StatusMapping
-             );
-  if (EFI_ERROR (Status)) {
-    Status = EFI_DEVICE_ERROR;
-    goto UnmapDataBuffer;
-  }
+  @param[in]     Dev         The virtio-blk device the request is targeted at.
 
-  VirtioPrepare (&Dev->Ring, &Indices);
+  @param[in]     Lba         See SynchronousRequest().
 
-  //
-  // ensured by VirtioBlkInit() -- this predicate, in combination with the
-  // lock-step progress, ensures we don't have to track free descriptors.
-  //
-  ASSERT (Dev->Ring.QueueSize >= 3);
+  @param[in,out] Token       The token associated with the transaction, or
+                             NULL.
 
-  //
-  // virtio-blk header in first desc
-  //
-  VirtioAppendDesc (
-    &Dev->Ring,
-    RequestDeviceAddress,
-    sizeof (*Request),
-    VRING_DESC_F_NEXT,
-    &Indices
-    );
+  @param[in]     BufferSize  See SynchronousRequest().
 
-  //
-  // data buffer for read/write in second desc
-  //
-  if (BufferSize > 0) {
-    //
-    // From virtio-0.9.5, 2.3.2 Descriptor Table:
-    // "no descriptor chain may be more than 2^32 bytes long in total".
-    //
-    // The predicate is ensured by the call contract above (for flush), or
-    // VerifyReadWriteRequest() (for read/write). It also implies that
-    // converting BufferSize to UINT32 will not truncate it.
-    //
-    ASSERT (BufferSize <= SIZE_1GB);
+  @param[in,out] Buffer      See SynchronousRequest().
 
-    //
-    // VRING_DESC_F_WRITE is interpreted from the host's point of view.
-    //
-    VirtioAppendDesc (
-      &Dev->Ring,
-      BufferDeviceAddress,
-      (UINT32)BufferSize,
-      VRING_DESC_F_NEXT | (RequestIsWrite ? 0 : VRING_DESC_F_WRITE),
-      &Indices
-      );
-  }
+  @param[in]     RequestIsWrite
+                             See SynchronousRequest().
 
-  //
-  // host status in last (second or third) desc
-  //
-  VirtioAppendDesc (
-    &Dev->Ring,
-    HostStatusDeviceAddress,
-    sizeof *HostStatus,
-    VRING_DESC_F_WRITE,
-    &Indices
-    );
+  @retval EFI_SUCCESS           The request has been queued, or, for the
+                                synchronous case, completed.
+
+  @retval EFI_OUT_OF_RESOURCES  The request could not be queued due to a lack
+                                of resources.
+
+  @return                       Error codes from SynchronousRequest().
+
+**/
+STATIC
+EFI_STATUS
+VirtioBlkRequestEx (
+  IN     VBLK_DEV             *Dev,
+  IN     EFI_LBA              Lba,
+  IN OUT EFI_BLOCK_IO2_TOKEN  *Token  OPTIONAL,
+  IN     UINTN                BufferSize,
+  IN OUT VOID                 *Buffer,
+  IN     BOOLEAN              RequestIsWrite
+  )
+{
+  VBLK_REQUEST  *Request;
 
-  //
-  // virtio-blk's only virtqueue is #0, called "requestq" (see Appendix D).
-  //
-  if ((VirtioFlush (
-         Dev->VirtIo,
-         0,
-         &Dev->Ring,
-         &Indices,
-         NULL
-         ) == EFI_SUCCESS) &&
-      (*HostStatus == VIRTIO_BLK_S_OK))
-  {
-    Status = EFI_SUCCESS;
-  } else {
-    Status = EFI_DEVICE_ERROR;
+  if ((Token == NULL) || (Token->Event == NULL)) {
+    return SynchronousRequest (Dev, Lba, BufferSize, Buffer, RequestIsWrite);
   }
 
-  Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, StatusMapping);
-
-UnmapDataBuffer:
-  if (BufferSize > 0) {
-    UnmapStatus = Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, BufferMapping);
-    if (EFI_ERROR (UnmapStatus) && !RequestIsWrite && !EFI_ERROR (Status)) {
-      //
-      // Data from the bus master may not reach the caller; fail the request.
-      //
-      Status = EFI_DEVICE_ERROR;
-    }
+  Request = AllocateZeroPool (sizeof *Request);
+  if (Request == NULL) {
+    return EFI_OUT_OF_RESOURCES;
   }
 
-UnmapRequestBuffer:
-  Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, RequestMapping);
+  Request->Signature  = VBLK_REQ_SIG;
+  Request->Token      = Token;
+  Request->Lba        = Lba;
+  Request->Buffer     = Buffer;
+  Request->BufferSize = BufferSize;
+  Request->Status     = EFI_SUCCESS;
 
-FreeHostStatusBuffer:
-  Dev->VirtIo->FreeSharedPages (
-                 Dev->VirtIo,
-                 EFI_SIZE_TO_PAGES (sizeof *HostStatus),
-                 HostStatusBuffer
-                 );
+  Request->Type = RequestIsWrite ?
+                  (BufferSize == 0 ? VIRTIO_BLK_T_FLUSH : VIRTIO_BLK_T_OUT) :
+                  VIRTIO_BLK_T_IN;
 
-FreeBlkRequest:
-  FreePool ((VOID *)Request);
+  VirtioBlkQueueRequest (Dev, Request);
 
-  return Status;
+  return EFI_SUCCESS;
 }
 
 /**
@@ -611,6 +956,198 @@ VirtioBlkFlushBlocks (
          EFI_SUCCESS;
 }
 
+/**
+
+  Complete a token without carrying out any transfer.
+
+  @param[in,out] Token  The token associated with the transaction, or NULL.
+
+**/
+STATIC
+VOID
+VirtioBlkSignalToken (
+  IN OUT EFI_BLOCK_IO2_TOKEN  *Token  OPTIONAL
+  )
+{
+  if ((Token != NULL) && (Token->Event != NULL)) {
+    Token->TransactionStatus = EFI_SUCCESS;
+    gBS->SignalEvent (Token->Event);
+  }
+}
+
+//
+// UEFI Spec 2.3.1 + Errata C, 12.9 EFI Block I/O 2 Protocol
+// Driver Writer's Guide for UEFI 2.3.1 v1.01,
+//   24.2 Block I/O Protocol Implementations
+//
+EFI_STATUS
+EFIAPI
+VirtioBlkResetEx (
+  IN EFI_BLOCK_IO2_PROTOCOL  *This,
+  IN BOOLEAN                 ExtendedVerification
+  )
+{
+  //
+  // If we managed to initialize and install the driver, then the device is
+  // working correctly. Let the non-blocking requests in flight complete.
+  //
+  VirtioBlkWait (VIRTIO_BLK_FROM_BLOCK_IO2 (This), NULL);
+  return EFI_SUCCESS;
+}
+
+/**
+
+  ReadBlocksEx() operation for virtio-blk.
+
+  See
+  - UEFI Spec 2.3.1 + Errata C, 12.9 EFI Block I/O 2 Protocol,
+    EFI_BLOCK_IO2_PROTOCOL.ReadBlocksEx().
+  - Driver Writer's Guide for UEFI 2.3.1 v1.01, 24.2.2. ReadBlocks() and
+    ReadBlocksEx() Implementation.
+
+  Parameter checks and conformant return values are implemented in
+  VerifyReadWriteRequest() and VirtioBlkRequestEx().
+
+  A zero BufferSize doesn't seem to be prohibited, so do nothing in that case,
+  successfully.
+
+**/
+EFI_STATUS
+EFIAPI
+VirtioBlkReadBlocksEx (
+  IN     EFI_BLOCK_IO2_PROTOCOL  *This,
+  IN     UINT32                  MediaId,
+  IN     EFI_LBA                 Lba,
+  IN OUT EFI_BLOCK_IO2_TOKEN     *Token,
+  IN     UINTN                   BufferSize,
+  OUT    VOID                    *Buffer
+  )
+{
+  VBLK_DEV    *Dev;
+  EFI_STATUS  Status;
+
+  if (BufferSize == 0) {
+    VirtioBlkSignalToken (Token);
+    return EFI_SUCCESS;
+  }
+
+  Dev    = VIRTIO_BLK_FROM_BLOCK_IO2 (This);
+  Status = VerifyReadWriteRequest (
+             &Dev->BlockIoMedia,
+             Lba,
+             BufferSize,
+             FALSE               // RequestIsWrite
+             );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  return VirtioBlkRequestEx (
+           Dev,
+           Lba,
+           Token,
+           BufferSize,
+           Buffer,
+           FALSE       // RequestIsWrite
+           );
+}
+
+/**
+
+  WriteBlocksEx() operation for virtio-blk.
+
+  See
+  - UEFI Spec 2.3.1 + Errata C, 12.9 EFI Block I/O 2 Protocol,
+    EFI_BLOCK_IO2_PROTOCOL.WriteBlocksEx().
+  - Driver Writer's Guide for UEFI 2.3.1 v1.01, 24.2.3 WriteBlocks() and
+    WriteBlockEx() Implementation.
+
+  Parameter checks and conformant return values are implemented in
+  VerifyReadWriteRequest() and VirtioBlkRequestEx().
+
+  A zero BufferSize doesn't seem to be prohibited, so do nothing in that case,
+  successfully.
+
+**/
+EFI_STATUS
+EFIAPI
+VirtioBlkWriteBlocksEx (
+  IN     EFI_BLOCK_IO2_PROTOCOL  *This,
+  IN     UINT32                  MediaId,
+  IN     EFI_LBA                 Lba,
+  IN OUT EFI_BLOCK_IO2_TOKEN     *Token,
+  IN     UINTN                   BufferSize,
+  IN     VOID                    *Buffer
+  )
+{
+  VBLK_DEV    *Dev;
+  EFI_STATUS  Status;
+
+  if (BufferSize == 0) {
+    VirtioBlkSignalToken (Token);
+    return EFI_SUCCESS;
+  }
+
+  Dev    = VIRTIO_BLK_FROM_BLOCK_IO2 (This);
+  Status = VerifyReadWriteRequest (
+             &Dev->BlockIoMedia,
+             Lba,
+             BufferSize,
+             TRUE                // RequestIsWrite
+             );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  return VirtioBlkRequestEx (
+           Dev,
+           Lba,
+           Token,
+           BufferSize,
+           Buffer,
+           TRUE        // RequestIsWrite
+           );
+}
+
+/**
+
+  FlushBlocksEx() operation for virtio-blk.
+
+  See
+  - UEFI Spec 2.3.1 + Errata C, 12.9 EFI Block I/O 2 Protocol,
+    EFI_BLOCK_IO2_PROTOCOL.FlushBlocksEx().
+  - Driver Writer's Guide for UEFI 2.3.1 v1.01, 24.2.4 FlushBlocks() and
+    FlushBlocksEx() Implementation.
+
+  As with FlushBlocks(), we do nothing, successfully, if the underlying
+  virtio-blk device doesn't support flushing.
+
+**/
+EFI_STATUS
+EFIAPI
+VirtioBlkFlushBlocksEx (
+  IN     EFI_BLOCK_IO2_PROTOCOL  *This,
+  IN OUT EFI_BLOCK_IO2_TOKEN     *Token
+  )
+{
+  VBLK_DEV  *Dev;
+
+  Dev = VIRTIO_BLK_FROM_BLOCK_IO2 (This);
+  if (!Dev->BlockIoMedia.WriteCaching) {
+    VirtioBlkSignalToken (Token);
+    return EFI_SUCCESS;
+  }
+
+  return VirtioBlkRequestEx (
+           Dev,
+           0,      // Lba
+           Token,
+           0,      // BufferSize
+           NULL,   // Buffer
+           TRUE    // RequestIsWrite
+           );
+}
+
 /**
 
   Device probe function for this driver.
@@ -694,6 +1231,127 @@ VirtioBlkDriverBindingSupported (
   return Status;
 }
 
+/**
+
+  Set up the request slots for the virtqueue in Dev->Ring.
+
+  @param[in out] Dev  The driver instance to configure. Dev->Ring must have
+                      been initialized.
+
+  @retval EFI_SUCCESS           Setup complete.
+
+  @retval EFI_OUT_OF_RESOURCES  Memory allocation failed.
+
+  @return                       Error codes from AllocateSharedPages() or
+                                VirtioMapAllBytesInSharedBuffer().
+
+**/
+STATIC
+EFI_STATUS
+VirtioBlkInitSlots (
+  IN OUT VBLK_DEV  *Dev
+  )
+{
+  EFI_STATUS  Status;
+  VOID        *SlotShared;
+  UINT16      Slot;
+
+  Dev->MaxInFlight = Dev->Ring.QueueSize / VBLK_DESC_PER_SLOT;
+  Dev->InFlight    = 0;
+  Dev->LastUsed    = *Dev->Ring.Used.Idx;
+  ASSERT (Dev->MaxInFlight > 0);
+  ASSERT (Dev->LastUsed == 0);
+
+  Dev->FreeSlotStack = AllocatePool (
+                         Dev->MaxInFlight * sizeof *Dev->FreeSlotStack
+                         );
+  if (Dev->FreeSlotStack == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Dev->Slots = AllocateZeroPool (Dev->MaxInFlight * sizeof *Dev->Slots);
+  if (Dev->Slots == NULL) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto FreeFreeSlotStack;
+  }
+
+  //
+  // The request headers and host status bytes are accessed by both the
+  // processor and the device, hence the common buffer mapping.
+  //
+  Dev->SlotSharedPages = EFI_SIZE_TO_PAGES (
+                           Dev->MaxInFlight * sizeof *Dev->SlotShared
+                           );
+  Status = Dev->VirtIo->AllocateSharedPages (
+                          Dev->VirtIo,
+                          Dev->SlotSharedPages,
+                          &SlotShared
+                          );
+  if (EFI_ERROR (Status)) {
+    goto FreeSlots;
+  }
+
+  ZeroMem (SlotShared, EFI_PAGES_TO_SIZE (Dev->SlotSharedPages));
+
+  Status = VirtioMapAllBytesInSharedBuffer (
+             Dev->VirtIo,
+             VirtioOperationBusMasterCommonBuffer,
+             SlotShared,
+             EFI_PAGES_TO_SIZE (Dev->SlotSharedPages),
+             &Dev->SlotSharedAddress,
+             &Dev->SlotSharedMap
+             );
+  if (EFI_ERROR (Status)) {
+    goto FreeSlotShared;
+  }
+
+  Dev->SlotShared = SlotShared;
+  for (Slot = 0; Slot < Dev->MaxInFlight; ++Slot) {
+    Dev->FreeSlotStack[Slot] = Slot;
+  }
+
+  //
+  // We're going to poll the answers, the host should not send an interrupt.
+  //
+  *Dev->Ring.Avail.Flags = (UINT16)VRING_AVAIL_F_NO_INTERRUPT;
+
+  return EFI_SUCCESS;
+
+FreeSlotShared:
+  Dev->VirtIo->FreeSharedPages (Dev->VirtIo, Dev->SlotSharedPages, SlotShared);
+
+FreeSlots:
+  FreePool (Dev->Slots);
+
+FreeFreeSlotStack:
+  FreePool (Dev->FreeSlotStack);
+
+  return Status;
+}
+
+/**
+
+  Release the request slots set up with VirtioBlkInitSlots().
+
+  @param[in out] Dev  The driver instance to clean up.
+
+**/
+STATIC
+VOID
+VirtioBlkUninitSlots (
+  IN OUT VBLK_DEV  *Dev
+  )
+{
+  Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, Dev->SlotSharedMap);
+  Dev->VirtIo->FreeSharedPages (
+                 Dev->VirtIo,
+                 Dev->SlotSharedPages,
+                 Dev->SlotShared
+                 );
+  FreePool (Dev->Slots);
+  FreePool (Dev->FreeSlotStack);
+}
+
 /**
 
   Set up all BlockIo and virtio-blk aspects of this driver for the specified
@@ -710,7 +1368,7 @@ VirtioBlkDriverBindingSupported (
 
   @return                  Error codes from VirtioRingInit() or
                            VIRTIO_CFG_READ() / VIRTIO_CFG_WRITE or
-                           VirtioRingMap().
+                           VirtioRingMap() or VirtioBlkInitSlots().
 
 **/
 STATIC
@@ -729,12 +1387,14 @@ VirtioBlkInit (
   UINT8   PhysicalBlockExp;
   UINT8   AlignmentOffset;
   UINT32  OptIoSize;
+  UINT32  SizeMax;
   UINT16  QueueSize;
   UINT64  RingBaseShift;
 
   PhysicalBlockExp = 0;
   AlignmentOffset  = 0;
   OptIoSize        = 0;
+  SizeMax          = SIZE_1GB;
 
   //
   // Execute virtio-0.9.5, 2.2.1 Device Initialization Sequence.
@@ -829,8 +1489,24 @@ VirtioBlkInit (
     }
   }
 
+  if (Features & VIRTIO_BLK_F_SIZE_MAX) {
+    Status = VIRTIO_CFG_READ (Dev, SizeMax, &SizeMax);
+    if (EFI_ERROR (Status)) {
+      goto Failed;
+    }
+
+    //
+    // A data descriptor always covers whole logical blocks. Unless at least
+    // one block fits in a segment, disregard the limit.
+    //
+    if (SizeMax < BlockSize) {
+      Features &= ~(UINT64)VIRTIO_BLK_F_SIZE_MAX;
+      SizeMax   = SIZE_1GB;
+    }
+  }
+
   Features &= VIRTIO_BLK_F_BLK_SIZE | VIRTIO_BLK_F_TOPOLOGY | VIRTIO_BLK_F_RO |
-              VIRTIO_BLK_F_FLUSH | VIRTIO_F_VERSION_1 |
+              VIRTIO_BLK_F_FLUSH | VIRTIO_BLK_F_SIZE_MAX | VIRTIO_F_VERSION_1 |
               VIRTIO_F_IOMMU_PLATFORM;
 
   //
@@ -857,8 +1533,8 @@ VirtioBlkInit (
     goto Failed;
   }
 
-  if (QueueSize < 3) {
-    // SynchronousRequest() uses at most three descriptors
+  if (QueueSize < VBLK_DESC_PER_SLOT) {
+    // Every request slot uses three descriptors
     Status = EFI_UNSUPPORTED;
     goto Failed;
   }
@@ -881,18 +1557,26 @@ VirtioBlkInit (
     goto ReleaseQueue;
   }
 
+  //
+  // If anything fails from here on, we must release the request slots too.
+  //
+  Status = VirtioBlkInitSlots (Dev);
+  if (EFI_ERROR (Status)) {
+    goto UnmapQueue;
+  }
+
   //
   // Additional steps for MMIO: align the queue appropriately, and set the
-  // size. If anything fails from here on, we must unmap the ring resources.
+  // size.
   //
   Status = Dev->VirtIo->SetQueueNum (Dev->VirtIo, QueueSize);
   if (EFI_ERROR (Status)) {
-    goto UnmapQueue;
+    goto UninitSlots;
   }
 
   Status = Dev->VirtIo->SetQueueAlign (Dev->VirtIo, EFI_PAGE_SIZE);
   if (EFI_ERROR (Status)) {
-    goto UnmapQueue;
+    goto UninitSlots;
   }
 
   //
@@ -904,7 +1588,7 @@ VirtioBlkInit (
                           RingBaseShift
                           );
   if (EFI_ERROR (Status)) {
-    goto UnmapQueue;
+    goto UninitSlots;
   }
 
   //
@@ -914,7 +1598,7 @@ VirtioBlkInit (
     Features &= ~(UINT64)(VIRTIO_F_VERSION_1 | VIRTIO_F_IOMMU_PLATFORM);
     Status    = Dev->VirtIo->SetGuestFeatures (Dev->VirtIo, Features);
     if (EFI_ERROR (Status)) {
-      goto UnmapQueue;
+      goto UninitSlots;
     }
   }
 
@@ -924,7 +1608,7 @@ VirtioBlkInit (
   NextDevStat |= VSTAT_DRIVER_OK;
   Status       = Dev->VirtIo->SetDeviceStatus (Dev->VirtIo, NextDevStat);
   if (EFI_ERROR (Status)) {
-    goto UnmapQueue;
+    goto UninitSlots;
   }
 
   //
@@ -937,6 +1621,11 @@ VirtioBlkInit (
   Dev->BlockIo.ReadBlocks            = &VirtioBlkReadBlocks;
   Dev->BlockIo.WriteBlocks           = &VirtioBlkWriteBlocks;
   Dev->BlockIo.FlushBlocks           = &VirtioBlkFlushBlocks;
+  Dev->BlockIo2.Media                = &Dev->BlockIoMedia;
+  Dev->BlockIo2.Reset                = &VirtioBlkResetEx;
+  Dev->BlockIo2.ReadBlocksEx         = &VirtioBlkReadBlocksEx;
+  Dev->BlockIo2.WriteBlocksEx        = &VirtioBlkWriteBlocksEx;
+  Dev->BlockIo2.FlushBlocksEx        = &VirtioBlkFlushBlocksEx;
   Dev->BlockIoMedia.MediaId          = 0;
   Dev->BlockIoMedia.RemovableMedia   = FALSE;
   Dev->BlockIoMedia.MediaPresent     = TRUE;
@@ -949,6 +1638,7 @@ VirtioBlkInit (
                                          NumSectors,
                                          BlockSize / 512
                                          ) - 1;
+  Dev->MaxSegmentSize = MIN (SizeMax, SIZE_1GB) / BlockSize * BlockSize;
 
   DEBUG ((
     DEBUG_INFO,
@@ -957,6 +1647,13 @@ VirtioBlkInit (
     Dev->BlockIoMedia.BlockSize,
     Dev->BlockIoMedia.LastBlock + 1
     ));
+  DEBUG ((
+    DEBUG_INFO,
+    "%a: MaxInFlight=%u MaxSegmentSize=0x%x[B]\n",
+    __func__,
+    Dev->MaxInFlight,
+    Dev->MaxSegmentSize
+    ));
 
   if (Features & VIRTIO_BLK_F_TOPOLOGY) {
     Dev->BlockIo.Revision = EFI_BLOCK_IO_PROTOCOL_REVISION3;
@@ -982,6 +1679,9 @@ VirtioBlkInit (
 
   return EFI_SUCCESS;
 
+UninitSlots:
+  VirtioBlkUninitSlots (Dev);
+
 UnmapQueue:
   Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, Dev->RingMap);
 
@@ -1021,10 +1721,12 @@ VirtioBlkUninit (
   //
   Dev->VirtIo->SetDeviceStatus (Dev->VirtIo, 0);
 
+  VirtioBlkUninitSlots (Dev);
   Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, Dev->RingMap);
   VirtioRingUninit (Dev->VirtIo, &Dev->Ring);
 
   SetMem (&Dev->BlockIo, sizeof Dev->BlockIo, 0x00);
+  SetMem (&Dev->BlockIo2, sizeof Dev->BlockIo2, 0x00);
   SetMem (&Dev->BlockIoMedia, sizeof Dev->BlockIoMedia, 0x00);
 }
 
@@ -1115,6 +1817,8 @@ VirtioBlkDriverBindingStart (
     goto FreeVirtioBlk;
   }
 
+  InitializeListHead (&Dev->Requests);
+
   //
   // VirtIo access granted, configure virtio-blk device.
   //
@@ -1134,22 +1838,39 @@ VirtioBlkDriverBindingStart (
     goto UninitDev;
   }
 
+  Status = gBS->CreateEvent (
+                  EVT_TIMER | EVT_NOTIFY_SIGNAL,
+                  TPL_NOTIFY,
+                  &VirtioBlkPollTimer,
+                  Dev,
+                  &Dev->PollTimer
+                  );
+  if (EFI_ERROR (Status)) {
+    goto CloseExitBoot;
+  }
+
   //
-  // Setup complete, attempt to export the driver instance's BlockIo interface.
+  // Setup complete, attempt to export the driver instance's BlockIo and
+  // BlockIo2 interfaces.
   //
   Dev->Signature = VBLK_SIG;
-  Status         = gBS->InstallProtocolInterface (
+  Status         = gBS->InstallMultipleProtocolInterfaces (
                           &DeviceHandle,
                           &gEfiBlockIoProtocolGuid,
-                          EFI_NATIVE_INTERFACE,
-                          &Dev->BlockIo
+                          &Dev->BlockIo,
+                          &gEfiBlockIo2ProtocolGuid,
+                          &Dev->BlockIo2,
+                          NULL
                           );
   if (EFI_ERROR (Status)) {
-    goto CloseExitBoot;
+    goto ClosePollTimer;
   }
 
   return EFI_SUCCESS;
 
+ClosePollTimer:
+  gBS->CloseEvent (Dev->PollTimer);
+
 CloseExitBoot:
   gBS->CloseEvent (Dev->ExitBoot);
 
@@ -1222,15 +1943,24 @@ VirtioBlkDriverBindingStop (
   //
   // Handle Stop() requests for in-use driver instances gracefully.
   //
-  Status = gBS->UninstallProtocolInterface (
+  Status = gBS->UninstallMultipleProtocolInterfaces (
                   DeviceHandle,
                   &gEfiBlockIoProtocolGuid,
-                  &Dev->BlockIo
+                  &Dev->BlockIo,
+                  &gEfiBlockIo2ProtocolGuid,
+                  &Dev->BlockIo2,
+                  NULL
                   );
   if (EFI_ERROR (Status)) {
     return Status;
   }
 
+  //
+  // Let the non-blocking requests still in flight complete.
+  //
+  VirtioBlkWait (Dev, NULL);
+  gBS->CloseEvent (Dev->PollTimer);
+
   gBS->CloseEvent (Dev->ExitBoot);
 
   VirtioBlkUninit (Dev);
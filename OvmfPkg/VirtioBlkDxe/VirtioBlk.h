@@ -13,13 +13,63 @@
 #define _VIRTIO_BLK_DXE_H_
 
 #include <Protocol/BlockIo.h>
+#include <Protocol/BlockIo2.h>
 #include <Protocol/ComponentName.h>
 #include <Protocol/DriverBinding.h>
 
 #include <IndustryStandard/Virtio.h>
+#include <IndustryStandard/VirtioBlk.h>
 
 #define VBLK_SIG  SIGNATURE_32 ('V', 'B', 'L', 'K')
 
+//
+// Every in-flight request owns one slot. A slot is a fixed run of
+// VBLK_DESC_PER_SLOT descriptors in the virtqueue (header, data, host
+// status), plus one VBLK_SLOT_SHARED element in the shared area.
+//
+#define VBLK_DESC_PER_SLOT  3
+
+//
+// The part of a slot the host accesses: the request header it reads and the
+// status byte it writes back.
+//
+#pragma pack(1)
+typedef struct {
+  VIRTIO_BLK_REQ    Header;
+  UINT8             HostStatus;
+  UINT8             Reserved[15];
+} VBLK_SLOT_SHARED;
+#pragma pack()
+
+#define VBLK_REQ_SIG  SIGNATURE_32 ('V', 'B', 'R', 'Q')
+
+//
+// A ReadBlocks[Ex]() / WriteBlocks[Ex]() / FlushBlocks[Ex]() request. It is
+// carried out by one or more sub-requests, each occupying a slot.
+//
+typedef struct {
+  UINT32                 Signature;
+  LIST_ENTRY             Link;
+  EFI_BLOCK_IO2_TOKEN    *Token;          // NULL for a blocking request
+  UINT32                 Type;            // VIRTIO_BLK_T_IN/_OUT/_FLUSH
+  EFI_LBA                Lba;
+  UINT8                  *Buffer;
+  UINTN                  BufferSize;
+  UINTN                  SubmittedSize;   // handed to the host so far
+  BOOLEAN                Started;
+  BOOLEAN                Done;            // blocking requests only
+  UINT16                 InFlight;        // sub-requests owned by the host
+  EFI_STATUS             Status;
+} VBLK_REQUEST;
+
+#define VBLK_REQUEST_FROM_LINK(RequestLink) \
+        CR (RequestLink, VBLK_REQUEST, Link, VBLK_REQ_SIG)
+
+typedef struct {
+  VBLK_REQUEST    *Request;               // NULL if the slot is free
+  VOID            *BufferMapping;         // NULL if there is no data
+} VBLK_SLOT;
+
 typedef struct {
   //
   // Parts of this structure are initialized / torn down in various functions
@@ -31,15 +81,32 @@ typedef struct {
   UINT32                    Signature;         // DriverBindingStart  0
   VIRTIO_DEVICE_PROTOCOL    *VirtIo;           // DriverBindingStart  0
   EFI_EVENT                 ExitBoot;          // DriverBindingStart  0
+  EFI_EVENT                 PollTimer;         // DriverBindingStart  0
+  BOOLEAN                   PollTimerArmed;    // DriverBindingStart  0
+  LIST_ENTRY                Requests;          // DriverBindingStart  0
   VRING                     Ring;              // VirtioRingInit      2
   EFI_BLOCK_IO_PROTOCOL     BlockIo;           // VirtioBlkInit       1
+  EFI_BLOCK_IO2_PROTOCOL    BlockIo2;          // VirtioBlkInit       1
   EFI_BLOCK_IO_MEDIA        BlockIoMedia;      // VirtioBlkInit       1
+  UINT32                    MaxSegmentSize;    // VirtioBlkInit       1
   VOID                      *RingMap;          // VirtioRingMap       2
+  UINT16                    MaxInFlight;       // VirtioBlkInitSlots  2
+  UINT16                    InFlight;          // VirtioBlkInitSlots  2
+  UINT16                    LastUsed;          // VirtioBlkInitSlots  2
+  UINT16                    *FreeSlotStack;    // VirtioBlkInitSlots  2
+  VBLK_SLOT                 *Slots;            // VirtioBlkInitSlots  2
+  VBLK_SLOT_SHARED          *SlotShared;       // VirtioBlkInitSlots  2
+  UINTN                     SlotSharedPages;   // VirtioBlkInitSlots  2
+  EFI_PHYSICAL_ADDRESS      SlotSharedAddress; // VirtioBlkInitSlots  2
+  VOID                      *SlotSharedMap;    // VirtioBlkInitSlots  2
 } VBLK_DEV;
 
 #define VIRTIO_BLK_FROM_BLOCK_IO(BlockIoPointer) \
         CR (BlockIoPointer, VBLK_DEV, BlockIo, VBLK_SIG)
 
+#define VIRTIO_BLK_FROM_BLOCK_IO2(BlockIo2Pointer) \
+        CR (BlockIo2Pointer, VBLK_DEV, BlockIo2, VBLK_SIG)
+
 /**
 
   Device probe function for this driver.
@@ -244,6 +311,94 @@ VirtioBlkFlushBlocks (
   IN EFI_BLOCK_IO_PROTOCOL  *This
   );
 
+//
+// UEFI Spec 2.3.1 + Errata C, 12.9 EFI Block I/O 2 Protocol
+// Driver Writer's Guide for UEFI 2.3.1 v1.01,
+//   24.2 Block I/O Protocol Implementations
+//
+EFI_STATUS
+EFIAPI
+VirtioBlkResetEx (
+  IN EFI_BLOCK_IO2_PROTOCOL  *This,
+  IN BOOLEAN                 ExtendedVerification
+  );
+
+/**
+
+  ReadBlocksEx() operation for virtio-blk.
+
+  See
+  - UEFI Spec 2.3.1 + Errata C, 12.9 EFI Block I/O 2 Protocol,
+    EFI_BLOCK_IO2_PROTOCOL.ReadBlocksEx().
+  - Driver Writer's Guide for UEFI 2.3.1 v1.01, 24.2.2. ReadBlocks() and
+    ReadBlocksEx() Implementation.
+
+  If Token or Token->Event is NULL, the request is carried out synchronously,
+  like ReadBlocks(). Otherwise it is queued to the virtqueue, and Token->Event
+  is signaled once the request completes.
+
+**/
+
+EFI_STATUS
+EFIAPI
+VirtioBlkReadBlocksEx (
+  IN     EFI_BLOCK_IO2_PROTOCOL  *This,
+  IN     UINT32                  MediaId,
+  IN     EFI_LBA                 Lba,
+  IN OUT EFI_BLOCK_IO2_TOKEN     *Token,
+  IN     UINTN                   BufferSize,
+  OUT    VOID                    *Buffer
+  );
+
+/**
+
+  WriteBlocksEx() operation for virtio-blk.
+
+  See
+  - UEFI Spec 2.3.1 + Errata C, 12.9 EFI Block I/O 2 Protocol,
+    EFI_BLOCK_IO2_PROTOCOL.WriteBlocksEx().
+  - Driver Writer's Guide for UEFI 2.3.1 v1.01, 24.2.3 WriteBlocks() and
+    WriteBlockEx() Implementation.
+
+  If Token or Token->Event is NULL, the request is carried out synchronously,
+  like WriteBlocks(). Otherwise it is queued to the virtqueue, and
+  Token->Event is signaled once the request completes.
+
+**/
+
+EFI_STATUS
+EFIAPI
+VirtioBlkWriteBlocksEx (
+  IN     EFI_BLOCK_IO2_PROTOCOL  *This,
+  IN     UINT32                  MediaId,
+  IN     EFI_LBA                 Lba,
+  IN OUT EFI_BLOCK_IO2_TOKEN     *Token,
+  IN     UINTN                   BufferSize,
+  IN     VOID                    *Buffer
+  );
+
+/**
+
+  FlushBlocksEx() operation for virtio-blk.
+
+  See
+  - UEFI Spec 2.3.1 + Errata C, 12.9 EFI Block I/O 2 Protocol,
+    EFI_BLOCK_IO2_PROTOCOL.FlushBlocksEx().
+  - Driver Writer's Guide for UEFI 2.3.1 v1.01, 24.2.4 FlushBlocks() and
+    FlushBlocksEx() Implementation.
+
+  The flush is handed to the host only after every request queued before it
+  has completed.
+
+**/
+
+EFI_STATUS
+EFIAPI
+VirtioBlkFlushBlocksEx (
+  IN     EFI_BLOCK_IO2_PROTOCOL  *This,
+  IN OUT EFI_BLOCK_IO2_TOKEN     *Token
+  );
+
 //
 // The purpose of the following scaffolding (EFI_COMPONENT_NAME_PROTOCOL and
 // EFI_COMPONENT_NAME2_PROTOCOL implementation) is to format the driver's name
@@ -8,6 +8,20 @@
 
 #include "VirtioFsDxe.h"
 
+//
+// The request and response buffers of a single FUSE_READ request, among those
+// that VirtioFsFuseReadFilePipelined() submits together.
+//
+typedef struct {
+  VIRTIO_FS_FUSE_REQUEST           CommonReq;
+  VIRTIO_FS_FUSE_READ_REQUEST      ReadReq;
+  VIRTIO_FS_IO_VECTOR              ReqIoVec[2];
+  VIRTIO_FS_SCATTER_GATHER_LIST    ReqSgList;
+  VIRTIO_FS_FUSE_RESPONSE          CommonResp;
+  VIRTIO_FS_IO_VECTOR              RespIoVec[2];
+  VIRTIO_FS_SCATTER_GATHER_LIST    RespSgList;
+} VIRTIO_FS_READ_CHUNK;
+
 /**
   Read a chunk from a regular file or a directory stream, by sending the
   FUSE_READ / FUSE_READDIRPLUS request to the Virtio Filesystem device.
@@ -203,3 +217,205 @@ VirtioFsFuseReadFileOrDir (
   *Size = (UINT32)TailBufferFill;
   return EFI_SUCCESS;
 }
+
+/**
+  Read a range of a regular file with several FUSE_READ requests in flight at
+  the same time.
+
+  The range is split into chunks of at most VIRTIO_FS_READ_CHUNK_SIZE bytes.
+  As many chunks as the virtio queue and VIRTIO_FS_MAX_EXCHANGES permit are
+  submitted to the Virtio Filesystem device together, so that the device can
+  service them in parallel; the rest of the range (if any) is not read.
+
+  The function may only be called after VirtioFsFuseInitSession() returns
+  successfully and before VirtioFsUninit() is called.
+
+  @param[in,out] VirtioFs  The Virtio Filesystem device to send the FUSE_READ
+                           requests to. On output, the FUSE request counter
+                           "VirtioFs->RequestId" will have been incremented
+                           once per chunk.
+
+  @param[in] NodeId        The inode number of the regular file to read from.
+
+  @param[in] FuseHandle    The open handle to the regular file to read from.
+
+  @param[in] Offset        The absolute file position at which to start
+                           reading.
+
+  @param[in,out] Size      On input, the number of bytes to read. On successful
+                           return, the number of bytes actually read, which may
+                           be smaller than the value on input. The bytes read
+                           are contiguous from Offset; a short read from a
+                           chunk (such as at EOF) hides any data that later
+                           chunks may have returned. EOF can be detected by
+                           passing in a nonzero Size, and finding a zero Size
+                           on output.
+
+  @param[out] Data         Buffer to read the bytes from the regular file into.
+                           The caller is responsible for providing room for (at
+                           least) as many bytes in Data as Size is on input.
+
+  @retval EFI_SUCCESS  Read successful. The caller is responsible for checking
+                       Size to learn the actual byte count transferred. If a
+                       chunk other than the first one failed, the bytes read
+                       before that chunk are reported as a successful short
+                       read.
+
+  @return              The "errno" value mapped to an EFI_STATUS code, if the
+                       Virtio Filesystem device explicitly reported an error
+                       for the first chunk.
+
+  @return              Error codes propagated from VirtioFsSgListsValidate(),
+                       VirtioFsFuseNewRequest(),
+                       VirtioFsSgListsSubmitMultiple(),
+                       VirtioFsFuseCheckResponse().
+**/
+EFI_STATUS
+VirtioFsFuseReadFilePipelined (
+  IN OUT VIRTIO_FS  *VirtioFs,
+  IN     UINT64     NodeId,
+  IN     UINT64     FuseHandle,
+  IN     UINT64     Offset,
+  IN OUT UINTN      *Size,
+  OUT VOID          *Data
+  )
+{
+  VIRTIO_FS_READ_CHUNK  Chunks[VIRTIO_FS_MAX_EXCHANGES];
+  VIRTIO_FS_EXCHANGE    Exchanges[VIRTIO_FS_MAX_EXCHANGES];
+  UINTN                 MaxChunks;
+  UINTN                 NumChunks;
+  UINTN                 ChunkIdx;
+  UINTN                 Queued;
+  UINTN                 Transferred;
+  EFI_STATUS            Status;
+
+  //
+  // Each FUSE_READ request takes four descriptors: request header, read
+  // request, response header, data.
+  //
+  MaxChunks = MIN (VIRTIO_FS_MAX_EXCHANGES, VirtioFs->QueueSize / 4);
+  if (MaxChunks == 0) {
+    MaxChunks = 1;
+  }
+
+  //
+  // Set up the chunks.
+  //
+  NumChunks = 0;
+  Queued    = 0;
+  while ((Queued < *Size) && (NumChunks < MaxChunks)) {
+    VIRTIO_FS_READ_CHUNK  *Chunk;
+    UINT32                ChunkSize;
+
+    Chunk     = &Chunks[NumChunks];
+    ChunkSize = (UINT32)MIN (*Size - Queued, VIRTIO_FS_READ_CHUNK_SIZE);
+
+    Chunk->ReqIoVec[0].Buffer = &Chunk->CommonReq;
+    Chunk->ReqIoVec[0].Size   = sizeof Chunk->CommonReq;
+    Chunk->ReqIoVec[1].Buffer = &Chunk->ReadReq;
+    Chunk->ReqIoVec[1].Size   = sizeof Chunk->ReadReq;
+    Chunk->ReqSgList.IoVec    = Chunk->ReqIoVec;
+    Chunk->ReqSgList.NumVec   = ARRAY_SIZE (Chunk->ReqIoVec);
+
+    Chunk->RespIoVec[0].Buffer = &Chunk->CommonResp;
+    Chunk->RespIoVec[0].Size   = sizeof Chunk->CommonResp;
+    Chunk->RespIoVec[1].Buffer = (UINT8 *)Data + Queued;
+    Chunk->RespIoVec[1].Size   = ChunkSize;
+    Chunk->RespSgList.IoVec    = Chunk->RespIoVec;
+    Chunk->RespSgList.NumVec   = ARRAY_SIZE (Chunk->RespIoVec);
+
+    Status = VirtioFsSgListsValidate (
+               VirtioFs,
+               &Chunk->ReqSgList,
+               &Chunk->RespSgList
+               );
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    Status = VirtioFsFuseNewRequest (
+               VirtioFs,
+               &Chunk->CommonReq,
+               Chunk->ReqSgList.TotalSize,
+               VirtioFsFuseOpRead,
+               NodeId
+               );
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    Chunk->ReadReq.FileHandle = FuseHandle;
+    Chunk->ReadReq.Offset     = Offset + Queued;
+    Chunk->ReadReq.Size       = ChunkSize;
+    Chunk->ReadReq.ReadFlags  = 0;
+    Chunk->ReadReq.LockOwner  = 0;
+    Chunk->ReadReq.Flags      = 0;
+    Chunk->ReadReq.Padding    = 0;
+
+    Exchanges[NumChunks].RequestSgList  = &Chunk->ReqSgList;
+    Exchanges[NumChunks].ResponseSgList = &Chunk->RespSgList;
+
+    NumChunks++;
+    Queued += ChunkSize;
+  }
+
+  if (NumChunks == 0) {
+    return EFI_SUCCESS;
+  }
+
+  //
+  // Submit all chunks at once.
+  //
+  Status = VirtioFsSgListsSubmitMultiple (VirtioFs, NumChunks, Exchanges);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  //
+  // Verify the responses, in file offset order. Stop at the first chunk that
+  // failed or came up short.
+  //
+  Transferred = 0;
+  for (ChunkIdx = 0; ChunkIdx < NumChunks; ChunkIdx++) {
+    VIRTIO_FS_READ_CHUNK  *Chunk;
+    UINTN                 TailBufferFill;
+
+    Chunk  = &Chunks[ChunkIdx];
+    Status = VirtioFsFuseCheckResponse (
+               &Chunk->RespSgList,
+               Chunk->CommonReq.Unique,
+               &TailBufferFill
+               );
+    if (EFI_ERROR (Status)) {
+      if (Status == EFI_DEVICE_ERROR) {
+        DEBUG ((
+          DEBUG_ERROR,
+          "%a: Label=\"%s\" NodeId=%Lu FuseHandle=%Lu "
+          "Offset=0x%Lx Size=0x%x Errno=%d\n",
+          __func__,
+          VirtioFs->Label,
+          NodeId,
+          FuseHandle,
+          Chunk->ReadReq.Offset,
+          Chunk->ReadReq.Size,
+          Chunk->CommonResp.Error
+          ));
+        Status = VirtioFsErrnoToEfiStatus (Chunk->CommonResp.Error);
+      }
+
+      break;
+    }
+
+    Transferred += TailBufferFill;
+    if (TailBufferFill < Chunk->RespIoVec[1].Size) {
+      break;
+    }
+  }
+
+  if ((Transferred == 0) && EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  *Size = Transferred;
+  return EFI_SUCCESS;
+}
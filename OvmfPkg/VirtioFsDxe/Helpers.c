@@ -6,11 +6,12 @@
   SPDX-License-Identifier: BSD-2-Clause-Patent
 **/
 
-#include <Library/BaseLib.h>             // StrLen()
-#include <Library/BaseMemoryLib.h>       // CopyMem()
-#include <Library/MemoryAllocationLib.h> // AllocatePool()
-#include <Library/TimeBaseLib.h>         // EpochToEfiTime()
-#include <Library/VirtioLib.h>           // Virtio10WriteFeatures()
+#include <Library/BaseLib.h>                   // StrLen()
+#include <Library/BaseMemoryLib.h>             // CopyMem()
+#include <Library/MemoryAllocationLib.h>       // AllocatePool()
+#include <Library/TimeBaseLib.h>               // EpochToEfiTime()
+#include <Library/UefiBootServicesTableLib.h>  // gBS
+#include <Library/VirtioLib.h>                 // Virtio10WriteFeatures()
 
 #include "VirtioFsDxe.h"
 
@@ -531,8 +532,7 @@ VirtioFsSgListsValidate (
                             more response bytes than ResponseSgList->TotalSize.
 
   @return                   Error codes propagated from
-                            VirtioMapAllBytesInSharedBuffer(), VirtioFlush(),
-                            or VirtioFs->Virtio->UnmapSharedBuffer().
+                            VirtioFsSgListsSubmitMultiple().
 **/
 EFI_STATUS
 VirtioFsSgListsSubmit (
@@ -541,157 +541,340 @@ VirtioFsSgListsSubmit (
   IN OUT VIRTIO_FS_SCATTER_GATHER_LIST  *ResponseSgList OPTIONAL
   )
 {
-  VIRTIO_FS_SCATTER_GATHER_LIST  *SgListParam[2];
-  VIRTIO_MAP_OPERATION           SgListVirtioMapOp[ARRAY_SIZE (SgListParam)];
-  UINT16                         SgListDescriptorFlag[ARRAY_SIZE (SgListParam)];
-  UINTN                          ListId;
-  VIRTIO_FS_SCATTER_GATHER_LIST  *SgList;
-  UINTN                          IoVecIdx;
-  VIRTIO_FS_IO_VECTOR            *IoVec;
-  EFI_STATUS                     Status;
-  DESC_INDICES                   Indices;
-  UINT32                         TotalBytesWrittenByDevice;
-  UINT32                         BytesPermittedForWrite;
-
-  SgListParam[0]          = RequestSgList;
+  VIRTIO_FS_EXCHANGE  Exchange;
+
+  Exchange.RequestSgList  = RequestSgList;
+  Exchange.ResponseSgList = ResponseSgList;
+  return VirtioFsSgListsSubmitMultiple (VirtioFs, 1, &Exchange);
+}
+
+/**
+  Submit several validated pairs of (request buffer list, response buffer list)
+  to the Virtio Filesystem device at once, and wait until the device completes
+  all of them.
+
+  The Virtio Filesystem device may process the exchanges concurrently, and in
+  any order. Submitting independent exchanges together (for example,
+  FUSE_READ requests for consecutive ranges of a file) saves the round trips
+  that submitting them one by one would cost.
+
+  On input, each pair of VIRTIO_FS_SCATTER_GATHER_LIST objects must have been
+  validated together, using the VirtioFsSgListsValidate() function.
+
+  On output, the fields listed at VirtioFsSgListsSubmit() are updated in each
+  pair.
+
+  The function may only be called after VirtioFsInit() returns successfully and
+  before VirtioFsUninit() is called.
+
+  @param[in,out] VirtioFs      The Virtio Filesystem device that the
+                               request-response exchanges should now be
+                               submitted to.
+
+  @param[in] NumExchanges      The number of elements in Exchanges.
+
+  @param[in,out] Exchanges     The request-response exchanges to submit. The
+                               ResponseSgList field of an element may be NULL
+                               if and only if NULL was passed to
+                               VirtioFsSgListsValidate() as ResponseSgList for
+                               the element.
+
+  @retval EFI_SUCCESS            All transfers complete. The caller should
+                                 investigate the VIRTIO_FS_IO_VECTOR.Transferred
+                                 fields in each ResponseSgList, like after
+                                 VirtioFsSgListsSubmit().
+
+  @retval EFI_INVALID_PARAMETER  NumExchanges is zero, or greater than
+                                 VIRTIO_FS_MAX_EXCHANGES.
+
+  @retval EFI_UNSUPPORTED        The exchanges together need more descriptors
+                                 than VirtioFs->QueueSize.
+
+  @retval EFI_DEVICE_ERROR       The Virtio Filesystem device reported
+                                 populating more response bytes than
+                                 ResponseSgList->TotalSize in an exchange, or it
+                                 reported the completion of a descriptor chain
+                                 that it had not been given.
+
+  @return                        Error codes propagated from
+                                 VirtioMapAllBytesInSharedBuffer(),
+                                 VirtioFs->Virtio->SetQueueNotify(), or
+                                 VirtioFs->Virtio->UnmapSharedBuffer().
+**/
+EFI_STATUS
+VirtioFsSgListsSubmitMultiple (
+  IN OUT VIRTIO_FS           *VirtioFs,
+  IN     UINTN               NumExchanges,
+  IN OUT VIRTIO_FS_EXCHANGE  *Exchanges
+  )
+{
+  VIRTIO_FS_SCATTER_GATHER_LIST   *SgListParam[2];
+  VIRTIO_MAP_OPERATION            SgListVirtioMapOp[ARRAY_SIZE (SgListParam)];
+  UINT16                          SgListDescriptorFlag[ARRAY_SIZE (SgListParam)];
+  UINT16                          HeadDescIdx[VIRTIO_FS_MAX_EXCHANGES];
+  BOOLEAN                         Completed[VIRTIO_FS_MAX_EXCHANGES];
+  UINT32                          UsedLen[VIRTIO_FS_MAX_EXCHANGES];
+  UINTN                           ExchangeIdx;
+  UINTN                           ListId;
+  VIRTIO_FS_SCATTER_GATHER_LIST   *SgList;
+  UINTN                           IoVecIdx;
+  VIRTIO_FS_IO_VECTOR             *IoVec;
+  EFI_STATUS                      Status;
+  DESC_INDICES                    Indices;
+  UINTN                           DescriptorsNeeded;
+  VRING                           *Ring;
+  UINT16                          NextAvailIdx;
+  UINT16                          UsedIdx;
+  UINTN                           PollPeriodUsecs;
+  volatile CONST VRING_USED_ELEM  *UsedElem;
+  UINT32                          TotalBytesWrittenByDevice;
+  UINT32                          BytesPermittedForWrite;
+
+  if ((NumExchanges == 0) || (NumExchanges > VIRTIO_FS_MAX_EXCHANGES)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // VirtioFsSgListsValidate() has checked each exchange in isolation; now
+  // make sure that all exchanges fit on the virtio queue at the same time.
+  //
+  DescriptorsNeeded = 0;
+  for (ExchangeIdx = 0; ExchangeIdx < NumExchanges; ExchangeIdx++) {
+    DescriptorsNeeded += Exchanges[ExchangeIdx].RequestSgList->NumVec;
+    if (Exchanges[ExchangeIdx].ResponseSgList != NULL) {
+      DescriptorsNeeded += Exchanges[ExchangeIdx].ResponseSgList->NumVec;
+    }
+  }
+
+  if (DescriptorsNeeded > VirtioFs->QueueSize) {
+    return EFI_UNSUPPORTED;
+  }
+
   SgListVirtioMapOp[0]    = VirtioOperationBusMasterRead;
   SgListDescriptorFlag[0] = 0;
 
-  SgListParam[1]          = ResponseSgList;
   SgListVirtioMapOp[1]    = VirtioOperationBusMasterWrite;
   SgListDescriptorFlag[1] = VRING_DESC_F_WRITE;
 
+  Ring   = &VirtioFs->Ring;
+  Status = EFI_SUCCESS;
+
   //
   // Map all IO Vectors.
   //
-  for (ListId = 0; ListId < ARRAY_SIZE (SgListParam); ListId++) {
-    SgList = SgListParam[ListId];
-    if (SgList == NULL) {
-      continue;
-    }
+  for (ExchangeIdx = 0; ExchangeIdx < NumExchanges; ExchangeIdx++) {
+    SgListParam[0] = Exchanges[ExchangeIdx].RequestSgList;
+    SgListParam[1] = Exchanges[ExchangeIdx].ResponseSgList;
 
-    for (IoVecIdx = 0; IoVecIdx < SgList->NumVec; IoVecIdx++) {
-      IoVec = &SgList->IoVec[IoVecIdx];
-      //
-      // Map this IO Vector.
-      //
-      Status = VirtioMapAllBytesInSharedBuffer (
-                 VirtioFs->Virtio,
-                 SgListVirtioMapOp[ListId],
-                 IoVec->Buffer,
-                 IoVec->Size,
-                 &IoVec->MappedAddress,
-                 &IoVec->Mapping
-                 );
-      if (EFI_ERROR (Status)) {
-        goto Unmap;
+    for (ListId = 0; ListId < ARRAY_SIZE (SgListParam); ListId++) {
+      SgList = SgListParam[ListId];
+      if (SgList == NULL) {
+        continue;
       }
 
-      IoVec->Mapped = TRUE;
+      for (IoVecIdx = 0; IoVecIdx < SgList->NumVec; IoVecIdx++) {
+        IoVec = &SgList->IoVec[IoVecIdx];
+        //
+        // Map this IO Vector.
+        //
+        Status = VirtioMapAllBytesInSharedBuffer (
+                   VirtioFs->Virtio,
+                   SgListVirtioMapOp[ListId],
+                   IoVec->Buffer,
+                   IoVec->Size,
+                   &IoVec->MappedAddress,
+                   &IoVec->Mapping
+                   );
+        if (EFI_ERROR (Status)) {
+          goto Unmap;
+        }
+
+        IoVec->Mapped = TRUE;
+      }
     }
   }
 
   //
-  // Compose the descriptor chain.
+  // Compose one descriptor chain per exchange. The chains are laid out
+  // back-to-back in the descriptor table.
   //
-  VirtioPrepare (&VirtioFs->Ring, &Indices);
-  for (ListId = 0; ListId < ARRAY_SIZE (SgListParam); ListId++) {
-    SgList = SgListParam[ListId];
-    if (SgList == NULL) {
-      continue;
-    }
+  VirtioPrepare (Ring, &Indices);
+  for (ExchangeIdx = 0; ExchangeIdx < NumExchanges; ExchangeIdx++) {
+    UINTN  LastListId;
 
-    for (IoVecIdx = 0; IoVecIdx < SgList->NumVec; IoVecIdx++) {
-      UINT16  NextFlag;
+    SgListParam[0] = Exchanges[ExchangeIdx].RequestSgList;
+    SgListParam[1] = Exchanges[ExchangeIdx].ResponseSgList;
+    LastListId     = (SgListParam[1] == NULL) ? 0 : 1;
 
-      IoVec = &SgList->IoVec[IoVecIdx];
-      //
-      // Set VRING_DESC_F_NEXT on all except the very last descriptor.
-      //
-      NextFlag = VRING_DESC_F_NEXT;
-      if ((ListId == ARRAY_SIZE (SgListParam) - 1) &&
-          (IoVecIdx == SgList->NumVec - 1))
-      {
-        NextFlag = 0;
+    HeadDescIdx[ExchangeIdx] = Indices.NextDescIdx % Ring->QueueSize;
+    Completed[ExchangeIdx]   = FALSE;
+
+    for (ListId = 0; ListId < ARRAY_SIZE (SgListParam); ListId++) {
+      SgList = SgListParam[ListId];
+      if (SgList == NULL) {
+        continue;
       }
 
-      VirtioAppendDesc (
-        &VirtioFs->Ring,
-        IoVec->MappedAddress,
-        (UINT32)IoVec->Size,
-        SgListDescriptorFlag[ListId] | NextFlag,
-        &Indices
-        );
+      for (IoVecIdx = 0; IoVecIdx < SgList->NumVec; IoVecIdx++) {
+        UINT16  NextFlag;
+
+        IoVec = &SgList->IoVec[IoVecIdx];
+        //
+        // Set VRING_DESC_F_NEXT on all except the very last descriptor of the
+        // exchange.
+        //
+        NextFlag = VRING_DESC_F_NEXT;
+        if ((ListId == LastListId) && (IoVecIdx == SgList->NumVec - 1)) {
+          NextFlag = 0;
+        }
+
+        VirtioAppendDesc (
+          Ring,
+          IoVec->MappedAddress,
+          (UINT32)IoVec->Size,
+          SgListDescriptorFlag[ListId] | NextFlag,
+          &Indices
+          );
+      }
     }
   }
 
   //
-  // Submit the descriptor chain.
+  // virtio-0.9.5, 2.4.1.2 Updating the Available Ring
   //
-  Status = VirtioFlush (
-             VirtioFs->Virtio,
-             VIRTIO_FS_REQUEST_QUEUE,
-             &VirtioFs->Ring,
-             &Indices,
-             &TotalBytesWrittenByDevice
-             );
-  if (EFI_ERROR (Status)) {
-    goto Unmap;
+  // Due to our lock-step progress, the host has consumed everything we had
+  // submitted earlier; it will produce the used elements for these chains
+  // starting at the current available index.
+  //
+  NextAvailIdx = *Ring->Avail.Idx;
+  UsedIdx      = NextAvailIdx;
+  for (ExchangeIdx = 0; ExchangeIdx < NumExchanges; ExchangeIdx++) {
+    Ring->Avail.Ring[NextAvailIdx++ % Ring->QueueSize] =
+      HeadDescIdx[ExchangeIdx];
   }
 
   //
-  // Sanity-check: the Virtio Filesystem device should not have written more
-  // bytes than what we offered buffers for.
+  // virtio-0.9.5, 2.4.1.3 Updating the Index Field
   //
-  if (ResponseSgList == NULL) {
-    BytesPermittedForWrite = 0;
-  } else {
-    BytesPermittedForWrite = ResponseSgList->TotalSize;
-  }
+  MemoryFence ();
+  *Ring->Avail.Idx = NextAvailIdx;
 
-  if (TotalBytesWrittenByDevice > BytesPermittedForWrite) {
-    Status = EFI_DEVICE_ERROR;
+  //
+  // virtio-0.9.5, 2.4.1.4 Notifying the Device -- a single notification
+  // covers all chains.
+  //
+  MemoryFence ();
+  Status = VirtioFs->Virtio->SetQueueNotify (
+                               VirtioFs->Virtio,
+                               VIRTIO_FS_REQUEST_QUEUE
+                               );
+  if (EFI_ERROR (Status)) {
     goto Unmap;
   }
 
   //
-  // Update the transfer sizes in the IO Vectors.
+  // virtio-0.9.5, 2.4.2 Receiving Used Buffers From the Device
   //
-  for (ListId = 0; ListId < ARRAY_SIZE (SgListParam); ListId++) {
-    SgList = SgListParam[ListId];
-    if (SgList == NULL) {
-      continue;
-    }
+  // Wait until the host processes all of our descriptor chains. Keep slowing
+  // down until we reach a poll period of slightly above 1 ms, like
+  // VirtioFlush() does.
+  //
+  PollPeriodUsecs = 1;
+  MemoryFence ();
+  while (*Ring->Used.Idx != NextAvailIdx) {
+    gBS->Stall (PollPeriodUsecs);
 
-    for (IoVecIdx = 0; IoVecIdx < SgList->NumVec; IoVecIdx++) {
-      IoVec = &SgList->IoVec[IoVecIdx];
-      if (SgListVirtioMapOp[ListId] == VirtioOperationBusMasterRead) {
-        //
-        // We report that the Virtio Filesystem device has read all buffers in
-        // the request.
-        //
-        IoVec->Transferred = IoVec->Size;
-      } else {
-        //
-        // Regarding the response, calculate how much of the current IO Vector
-        // has been populated by the Virtio Filesystem device. In
-        // "TotalBytesWrittenByDevice", VirtioFlush() reported the total count
-        // across all device-writeable descriptors, in the order they were
-        // chained on the ring.
-        //
-        IoVec->Transferred = MIN (
-                               (UINTN)TotalBytesWrittenByDevice,
-                               IoVec->Size
-                               );
-        TotalBytesWrittenByDevice -= (UINT32)IoVec->Transferred;
-      }
+    if (PollPeriodUsecs < 1024) {
+      PollPeriodUsecs *= 2;
     }
+
+    MemoryFence ();
   }
 
+  MemoryFence ();
+
   //
-  // By now, "TotalBytesWrittenByDevice" has been exhausted.
+  // The host may have completed the chains in any order; match each used
+  // element to its exchange via the head descriptor index.
   //
-  ASSERT (TotalBytesWrittenByDevice == 0);
+  for ( ; UsedIdx != NextAvailIdx; UsedIdx++) {
+    UsedElem = &Ring->Used.UsedElem[UsedIdx % Ring->QueueSize];
+    for (ExchangeIdx = 0; ExchangeIdx < NumExchanges; ExchangeIdx++) {
+      if (!Completed[ExchangeIdx] &&
+          (UsedElem->Id == HeadDescIdx[ExchangeIdx]))
+      {
+        break;
+      }
+    }
+
+    if (ExchangeIdx == NumExchanges) {
+      Status = EFI_DEVICE_ERROR;
+      goto Unmap;
+    }
+
+    Completed[ExchangeIdx] = TRUE;
+    UsedLen[ExchangeIdx]   = UsedElem->Len;
+  }
+
+  for (ExchangeIdx = 0; ExchangeIdx < NumExchanges; ExchangeIdx++) {
+    SgListParam[0]            = Exchanges[ExchangeIdx].RequestSgList;
+    SgListParam[1]            = Exchanges[ExchangeIdx].ResponseSgList;
+    TotalBytesWrittenByDevice = UsedLen[ExchangeIdx];
+
+    //
+    // Sanity-check: the Virtio Filesystem device should not have written more
+    // bytes than what we offered buffers for.
+    //
+    if (SgListParam[1] == NULL) {
+      BytesPermittedForWrite = 0;
+    } else {
+      BytesPermittedForWrite = SgListParam[1]->TotalSize;
+    }
+
+    if (TotalBytesWrittenByDevice > BytesPermittedForWrite) {
+      Status = EFI_DEVICE_ERROR;
+      goto Unmap;
+    }
+
+    //
+    // Update the transfer sizes in the IO Vectors.
+    //
+    for (ListId = 0; ListId < ARRAY_SIZE (SgListParam); ListId++) {
+      SgList = SgListParam[ListId];
+      if (SgList == NULL) {
+        continue;
+      }
+
+      for (IoVecIdx = 0; IoVecIdx < SgList->NumVec; IoVecIdx++) {
+        IoVec = &SgList->IoVec[IoVecIdx];
+        if (SgListVirtioMapOp[ListId] == VirtioOperationBusMasterRead) {
+          //
+          // We report that the Virtio Filesystem device has read all buffers
+          // in the request.
+          //
+          IoVec->Transferred = IoVec->Size;
+        } else {
+          //
+          // Regarding the response, calculate how much of the current IO
+          // Vector has been populated by the Virtio Filesystem device. The
+          // used element reported the total count across all
+          // device-writeable descriptors, in the order they were chained on
+          // the ring.
+          //
+          IoVec->Transferred = MIN (
+                                 (UINTN)TotalBytesWrittenByDevice,
+                                 IoVec->Size
+                                 );
+          TotalBytesWrittenByDevice -= (UINT32)IoVec->Transferred;
+        }
+      }
+    }
+
+    //
+    // By now, "TotalBytesWrittenByDevice" has been exhausted.
+    //
+    ASSERT (TotalBytesWrittenByDevice == 0);
+  }
 
   //
   // We've succeeded; fall through.
@@ -702,49 +885,54 @@ Unmap:
   // unmapping occurs in reverse order of mapping, in an attempt to avoid
   // memory fragmentation.
   //
-  ListId = ARRAY_SIZE (SgListParam);
-  while (ListId > 0) {
-    --ListId;
-    SgList = SgListParam[ListId];
-    if (SgList == NULL) {
-      continue;
-    }
-
-    IoVecIdx = SgList->NumVec;
-    while (IoVecIdx > 0) {
-      EFI_STATUS  UnmapStatus;
-
-      --IoVecIdx;
-      IoVec = &SgList->IoVec[IoVecIdx];
-      //
-      // Unmap this IO Vector, if it has been mapped.
-      //
-      if (!IoVec->Mapped) {
+  ExchangeIdx = NumExchanges;
+  while (ExchangeIdx > 0) {
+    --ExchangeIdx;
+    SgListParam[0] = Exchanges[ExchangeIdx].RequestSgList;
+    SgListParam[1] = Exchanges[ExchangeIdx].ResponseSgList;
+
+    ListId = ARRAY_SIZE (SgListParam);
+    while (ListId > 0) {
+      --ListId;
+      SgList = SgListParam[ListId];
+      if (SgList == NULL) {
         continue;
       }
 
-      UnmapStatus = VirtioFs->Virtio->UnmapSharedBuffer (
-                                        VirtioFs->Virtio,
-                                        IoVec->Mapping
-                                        );
-      //
-      // Re-set the following fields to the values they initially got from
-      // VirtioFsSgListsValidate() -- the above unmapping attempt is considered
-      // final, even if it fails.
-      //
-      IoVec->Mapped        = FALSE;
-      IoVec->MappedAddress = 0;
-      IoVec->Mapping       = NULL;
+      IoVecIdx = SgList->NumVec;
+      while (IoVecIdx > 0) {
+        EFI_STATUS  UnmapStatus;
 
-      //
-      // If we are on the success path, but the unmapping failed, we need to
-      // transparently flip to the failure path -- the caller must learn they
-      // should not consult the response buffers.
-      //
-      // The branch below can be taken at most once.
-      //
-      if (!EFI_ERROR (Status) && EFI_ERROR (UnmapStatus)) {
-        Status = UnmapStatus;
+        --IoVecIdx;
+        IoVec = &SgList->IoVec[IoVecIdx];
+        //
+        // Unmap this IO Vector, if it has been mapped.
+        //
+        if (!IoVec->Mapped) {
+          continue;
+        }
+
+        UnmapStatus = VirtioFs->Virtio->UnmapSharedBuffer (
+                                          VirtioFs->Virtio,
+                                          IoVec->Mapping
+                                          );
+        //
+        // Re-set the following fields to the values they initially got from
+        // VirtioFsSgListsValidate() -- the above unmapping attempt is
+        // considered final, even if it fails.
+        //
+        IoVec->Mapped        = FALSE;
+        IoVec->MappedAddress = 0;
+        IoVec->Mapping       = NULL;
+
+        //
+        // If we are on the success path, but the unmapping failed, we need to
+        // transparently flip to the failure path -- the caller must learn they
+        // should not consult the response buffers.
+        //
+        if (!EFI_ERROR (Status) && EFI_ERROR (UnmapStatus)) {
+          Status = UnmapStatus;
+        }
       }
     }
   }
@@ -752,6 +940,31 @@ Unmap:
   return Status;
 }
 
+/**
+  Drop the read-ahead windows of all files open on a Virtio Filesystem, after
+  (or before) the contents of a file on it changes.
+
+  The read-ahead window of a VIRTIO_FS_FILE caches file contents by inode
+  number, and several VIRTIO_FS_FILE objects may refer to the same inode; so
+  it is simplest to drop all windows.
+
+  @param[in,out] VirtioFs  The Virtio Filesystem whose open files should stop
+                           serving reads from their read-ahead windows.
+**/
+VOID
+VirtioFsDropReadAhead (
+  IN OUT VIRTIO_FS  *VirtioFs
+  )
+{
+  LIST_ENTRY      *Entry;
+  VIRTIO_FS_FILE  *VirtioFsFile;
+
+  BASE_LIST_FOR_EACH (Entry, &VirtioFs->OpenFiles) {
+    VirtioFsFile                = VIRTIO_FS_FILE_FROM_OPEN_FILES_ENTRY (Entry);
+    VirtioFsFile->ReadAheadSize = 0;
+  }
+}
+
 /**
   Set up the fields of a new VIRTIO_FS_FUSE_REQUEST object.
 
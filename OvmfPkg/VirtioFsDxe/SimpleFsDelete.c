@@ -111,6 +111,10 @@ VirtioFsSimpleFileDelete (
     FreePool (VirtioFsFile->FileInfoArray);
   }
 
+  if (VirtioFsFile->ReadAheadBuffer != NULL) {
+    FreePool (VirtioFsFile->ReadAheadBuffer);
+  }
+
   FreePool (VirtioFsFile);
   return Status;
 }
@@ -82,6 +82,9 @@ VirtioFsOpenVolume (
   VirtioFsFile->SingleFileInfoSize     = 0;
   VirtioFsFile->NumFileInfo            = 0;
   VirtioFsFile->NextFileInfo           = 0;
+  VirtioFsFile->ReadAheadBuffer        = NULL;
+  VirtioFsFile->ReadAheadOffset        = 0;
+  VirtioFsFile->ReadAheadSize          = 0;
 
   //
   // One more file open for the filesystem.
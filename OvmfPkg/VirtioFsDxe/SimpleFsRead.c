@@ -362,6 +362,104 @@ ReadFileInfoCache (
   return EFI_SUCCESS;
 }
 
+/**
+  Refill the read-ahead window of a regular file, starting at a given file
+  position.
+
+  @param[in,out] VirtioFsFile  The regular file whose read-ahead window should
+                               be refilled.
+
+  @param[in] Position          The absolute file position that the window
+                               should start at.
+
+  @retval EFI_SUCCESS           The window has been refilled. It is empty if
+                                Position is at or beyond EOF.
+
+  @retval EFI_OUT_OF_RESOURCES  The window buffer could not be allocated.
+
+  @return                       Error codes propagated from
+                                VirtioFsFuseReadFilePipelined(). The window is
+                                empty.
+**/
+STATIC
+EFI_STATUS
+RefillReadAhead (
+  IN OUT VIRTIO_FS_FILE  *VirtioFsFile,
+  IN     UINT64          Position
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       ReadSize;
+
+  if (VirtioFsFile->ReadAheadBuffer == NULL) {
+    VirtioFsFile->ReadAheadBuffer = AllocatePool (VIRTIO_FS_READ_AHEAD_SIZE);
+    if (VirtioFsFile->ReadAheadBuffer == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
+
+  VirtioFsFile->ReadAheadSize = 0;
+
+  ReadSize = VIRTIO_FS_READ_AHEAD_SIZE;
+  Status   = VirtioFsFuseReadFilePipelined (
+               VirtioFsFile->OwnerFs,
+               VirtioFsFile->NodeId,
+               VirtioFsFile->FuseHandle,
+               Position,
+               &ReadSize,
+               VirtioFsFile->ReadAheadBuffer
+               );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  VirtioFsFile->ReadAheadOffset = Position;
+  VirtioFsFile->ReadAheadSize   = ReadSize;
+  return EFI_SUCCESS;
+}
+
+/**
+  Copy as much as possible from the head of a caller's read request out of the
+  read-ahead window of a regular file.
+
+  @param[in] VirtioFsFile  The regular file whose read-ahead window should be
+                           consulted.
+
+  @param[in] Position      The absolute file position to copy from.
+
+  @param[in] Size          The number of bytes requested.
+
+  @param[out] Buffer       The buffer to copy the bytes into.
+
+  @return  The number of bytes copied. Zero if the window does not cover
+           Position.
+**/
+STATIC
+UINTN
+CopyFromReadAhead (
+  IN  VIRTIO_FS_FILE  *VirtioFsFile,
+  IN  UINT64          Position,
+  IN  UINTN           Size,
+  OUT VOID            *Buffer
+  )
+{
+  UINTN  WindowOffset;
+  UINTN  Copy;
+
+  if ((VirtioFsFile->ReadAheadSize == 0) ||
+      (Position < VirtioFsFile->ReadAheadOffset) ||
+      (Position - VirtioFsFile->ReadAheadOffset >=
+       VirtioFsFile->ReadAheadSize))
+  {
+    return 0;
+  }
+
+  WindowOffset = (UINTN)(Position - VirtioFsFile->ReadAheadOffset);
+  Copy         = MIN (Size, VirtioFsFile->ReadAheadSize - WindowOffset);
+  CopyMem (Buffer, VirtioFsFile->ReadAheadBuffer + WindowOffset, Copy);
+  return Copy;
+}
+
 /**
   Read from a regular file.
 **/
@@ -380,30 +478,77 @@ ReadRegularFile (
   UINTN                               Left;
 
   VirtioFs = VirtioFsFile->OwnerFs;
+  Left     = *BufferSize;
+
   //
-  // The UEFI spec forbids reads that start beyond the end of the file.
+  // Serve the head of the request from the read-ahead window, if the window
+  // covers it. The window is known to lie within the file, so the EOF check
+  // below is only necessary otherwise.
   //
-  Status = VirtioFsFuseGetAttr (VirtioFs, VirtioFsFile->NodeId, &FuseAttr);
-  if (EFI_ERROR (Status) || (VirtioFsFile->FilePosition > FuseAttr.Size)) {
-    return EFI_DEVICE_ERROR;
+  Transferred = CopyFromReadAhead (
+                  VirtioFsFile,
+                  VirtioFsFile->FilePosition,
+                  Left,
+                  Buffer
+                  );
+  Left -= Transferred;
+
+  if (Transferred == 0) {
+    //
+    // The UEFI spec forbids reads that start beyond the end of the file.
+    //
+    Status = VirtioFsFuseGetAttr (VirtioFs, VirtioFsFile->NodeId, &FuseAttr);
+    if (EFI_ERROR (Status) || (VirtioFsFile->FilePosition > FuseAttr.Size)) {
+      return EFI_DEVICE_ERROR;
+    }
   }
 
-  Status      = EFI_SUCCESS;
-  Transferred = 0;
-  Left        = *BufferSize;
+  Status = EFI_SUCCESS;
   while (Left > 0) {
-    UINT32  ReadSize;
+    UINT64  Position;
+    UINTN   ReadSize;
+
+    Position = VirtioFsFile->FilePosition + Transferred;
+
+    //
+    // Serve small reads through the read-ahead window, so that a sequence of
+    // them costs one batch of FUSE_READ requests per window, rather than one
+    // FUSE_READ per read. If the window buffer cannot be allocated, fall back
+    // to reading directly.
+    //
+    if (Left < VIRTIO_FS_READ_AHEAD_SIZE) {
+      Status = RefillReadAhead (VirtioFsFile, Position);
+      if (Status != EFI_OUT_OF_RESOURCES) {
+        if (EFI_ERROR (Status)) {
+          break;
+        }
+
+        ReadSize = CopyFromReadAhead (
+                     VirtioFsFile,
+                     Position,
+                     Left,
+                     (UINT8 *)Buffer + Transferred
+                     );
+        if (ReadSize == 0) {
+          break;
+        }
+
+        Transferred += ReadSize;
+        Left        -= ReadSize;
+        continue;
+      }
+    }
 
     //
-    // FUSE_READ cannot express a >=4GB buffer size.
+    // Read large requests directly into the caller's buffer, keeping several
+    // FUSE_READ requests in flight.
     //
-    ReadSize = (UINT32)MIN ((UINTN)MAX_UINT32, Left);
-    Status   = VirtioFsFuseReadFileOrDir (
+    ReadSize = Left;
+    Status   = VirtioFsFuseReadFilePipelined (
                  VirtioFs,
                  VirtioFsFile->NodeId,
                  VirtioFsFile->FuseHandle,
-                 FALSE,                                  // IsDir
-                 VirtioFsFile->FilePosition + Transferred,
+                 Position,
                  &ReadSize,
                  (UINT8 *)Buffer + Transferred
                  );
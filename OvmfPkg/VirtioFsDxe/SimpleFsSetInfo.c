@@ -446,6 +446,13 @@ UpdateAttributes (
     return EFI_ACCESS_DENIED;
   }
 
+  //
+  // Truncating or extending the file makes cached file contents stale.
+  //
+  if (UpdateFileSize) {
+    VirtioFsDropReadAhead (VirtioFs);
+  }
+
   //
   // Send the FUSE_SETATTR request now.
   //
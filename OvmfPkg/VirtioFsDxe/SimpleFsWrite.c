@@ -33,6 +33,11 @@ VirtioFsSimpleFileWrite (
     return EFI_ACCESS_DENIED;
   }
 
+  //
+  // Cached file contents are going to be stale.
+  //
+  VirtioFsDropReadAhead (VirtioFs);
+
   Status      = EFI_SUCCESS;
   Transferred = 0;
   Left        = *BufferSize;
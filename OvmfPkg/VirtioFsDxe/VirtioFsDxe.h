@@ -52,6 +52,26 @@
 //
 #define VIRTIO_FS_FILE_MAX_FILE_INFO  256
 
+//
+// Maximum number of request-response exchanges that
+// VirtioFsSgListsSubmitMultiple() can keep in flight at the same time.
+//
+#define VIRTIO_FS_MAX_EXCHANGES  8
+
+//
+// Size of the FUSE_READ requests that a large regular file read is split into,
+// so that several of them can be serviced by the Virtio Filesystem device in
+// parallel.
+//
+#define VIRTIO_FS_READ_CHUNK_SIZE  SIZE_256KB
+
+//
+// Size of the read-ahead window of a regular file. Reads smaller than this are
+// served from the window, which is refilled with a single batch of FUSE_READ
+// requests when needed.
+//
+#define VIRTIO_FS_READ_AHEAD_SIZE  SIZE_1MB
+
 //
 // Filesystem label encoded in UCS-2, transformed from the UTF-8 representation
 // in "VIRTIO_FS_CONFIG.Tag", and NUL-terminated. Only the printable ASCII code
@@ -109,10 +129,10 @@ typedef struct {
   EFI_PHYSICAL_ADDRESS    MappedAddress;
   VOID                    *Mapping;
   //
-  // Transferred is updated after VirtioFlush() returns successfully:
+  // Transferred is updated after the device completes the transfer:
   // - for VirtioOperationBusMasterRead, Transferred is set to Size;
   // - for VirtioOperationBusMasterWrite, Transferred is calculated from the
-  //   UsedLen output parameter of VirtioFlush().
+  //   length that the device reports in the used ring element.
   //
   UINTN                   Transferred;
 } VIRTIO_FS_IO_VECTOR;
@@ -133,6 +153,15 @@ typedef struct {
   UINT32                 TotalSize;
 } VIRTIO_FS_SCATTER_GATHER_LIST;
 
+//
+// Structure for describing one request-response exchange, for submitting
+// several exchanges to the Virtio Filesystem device at once.
+//
+typedef struct {
+  VIRTIO_FS_SCATTER_GATHER_LIST    *RequestSgList;
+  VIRTIO_FS_SCATTER_GATHER_LIST    *ResponseSgList;
+} VIRTIO_FS_EXCHANGE;
+
 //
 // Private context structure that exposes EFI_FILE_PROTOCOL on top of an open
 // FUSE file reference.
@@ -174,6 +203,19 @@ typedef struct {
   UINTN    SingleFileInfoSize;
   UINTN    NumFileInfo;
   UINTN    NextFileInfo;
+  //
+  // Read-ahead window for a regular file.
+  //
+  // Boot loaders tend to read kernels and initial RAM disks in small chunks;
+  // sending a FUSE_READ for each chunk would make the transfer round-trip
+  // bound. ReadAheadBuffer (VIRTIO_FS_READ_AHEAD_SIZE bytes, allocated on
+  // first use) caches ReadAheadSize bytes of the file, starting at
+  // ReadAheadOffset. The window is empty if ReadAheadSize is zero; writes
+  // empty it via VirtioFsDropReadAhead().
+  //
+  UINT8     *ReadAheadBuffer;
+  UINT64    ReadAheadOffset;
+  UINTN     ReadAheadSize;
 } VIRTIO_FS_FILE;
 
 #define VIRTIO_FS_FILE_FROM_SIMPLE_FILE(SimpleFileReference) \
@@ -218,6 +260,18 @@ VirtioFsSgListsSubmit (
   IN OUT VIRTIO_FS_SCATTER_GATHER_LIST  *ResponseSgList OPTIONAL
   );
 
+EFI_STATUS
+VirtioFsSgListsSubmitMultiple (
+  IN OUT VIRTIO_FS           *VirtioFs,
+  IN     UINTN               NumExchanges,
+  IN OUT VIRTIO_FS_EXCHANGE  *Exchanges
+  );
+
+VOID
+VirtioFsDropReadAhead (
+  IN OUT VIRTIO_FS  *VirtioFs
+  );
+
 EFI_STATUS
 VirtioFsFuseNewRequest (
   IN OUT VIRTIO_FS              *VirtioFs,
@@ -379,6 +433,16 @@ VirtioFsFuseReadFileOrDir (
   OUT VOID          *Data
   );
 
+EFI_STATUS
+VirtioFsFuseReadFilePipelined (
+  IN OUT VIRTIO_FS  *VirtioFs,
+  IN     UINT64     NodeId,
+  IN     UINT64     FuseHandle,
+  IN     UINT64     Offset,
+  IN OUT UINTN      *Size,
+  OUT VOID          *Data
+  );
+
 EFI_STATUS
 VirtioFsFuseWrite (
   IN OUT VIRTIO_FS  *VirtioFs,
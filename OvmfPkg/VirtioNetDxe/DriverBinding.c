@@ -12,6 +12,7 @@
 #include <Library/BaseMemoryLib.h>
 #include <Library/DevicePathLib.h>
 #include <Library/MemoryAllocationLib.h>
+#include <Library/PcdLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 
 #include "VirtioNet.h"
@@ -207,6 +208,17 @@ VirtioNetSnpPopulate (
   Dev->Snp.Receive        = &VirtioNetReceive;
   Dev->Snp.Mode           = &Dev->Snm;
 
+  //
+  // Lend received frames to the SNP client in place, unless we are running in
+  // a confidential computing guest. There the receive area is shared with the
+  // hypervisor, which could modify a frame while the network stack is parsing
+  // it; copying the frame out to private memory first is what protects
+  // against that.
+  //
+  if (PcdGet64 (PcdConfidentialComputingGuestAttr) == 0) {
+    Dev->RxLoan.Receive = &VirtioNetRxLoanReceive;
+  }
+
   Dev->Snm.State           = EfiSimpleNetworkStopped;
   Dev->Snm.HwAddressSize   = SIZE_OF_VNET (Mac);
   Dev->Snm.MediaHeaderSize = SIZE_OF_VNET (Mac) +       // dst MAC
@@ -539,6 +551,18 @@ VirtioNetDriverBindingStart (
     goto FreeMacDevicePath;
   }
 
+  if (Dev->RxLoan.Receive != NULL) {
+    Status = gBS->InstallProtocolInterface (
+                    &Dev->MacHandle,
+                    &gEdkiiSimpleNetworkRxLoanProtocolGuid,
+                    EFI_NATIVE_INTERFACE,
+                    &Dev->RxLoan
+                    );
+    if (EFI_ERROR (Status)) {
+      goto UninstallMultiple;
+    }
+  }
+
   //
   // make a note that we keep this device open with VirtIo for the sake of this
   // child
@@ -552,11 +576,20 @@ VirtioNetDriverBindingStart (
                   EFI_OPEN_PROTOCOL_BY_CHILD_CONTROLLER
                   );
   if (EFI_ERROR (Status)) {
-    goto UninstallMultiple;
+    goto UninstallRxLoan;
   }
 
   return EFI_SUCCESS;
 
+UninstallRxLoan:
+  if (Dev->RxLoan.Receive != NULL) {
+    gBS->UninstallProtocolInterface (
+           Dev->MacHandle,
+           &gEdkiiSimpleNetworkRxLoanProtocolGuid,
+           &Dev->RxLoan
+           );
+  }
+
 UninstallMultiple:
   gBS->UninstallMultipleProtocolInterfaces (
          Dev->MacHandle,
@@ -671,6 +704,14 @@ VirtioNetDriverBindingStop (
              This->DriverBindingHandle,
              Dev->MacHandle
              );
+      if (Dev->RxLoan.Receive != NULL) {
+        gBS->UninstallProtocolInterface (
+               Dev->MacHandle,
+               &gEdkiiSimpleNetworkRxLoanProtocolGuid,
+               &Dev->RxLoan
+               );
+      }
+
       gBS->UninstallMultipleProtocolInterfaces (
              Dev->MacHandle,
              &gEfiDevicePathProtocolGuid,
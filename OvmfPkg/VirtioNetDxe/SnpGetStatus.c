@@ -101,69 +101,90 @@ VirtioNetGetStatus (
   TxCurUsed = *Dev->TxRing.Used.Idx;
   MemoryFence ();
 
+  //
+  // Reap all transmit completions in one go: return the descriptors to the
+  // free stack and unmap the buffers, so that the caller can retrieve them
+  // below, and in subsequent calls, without us touching the ring again.
+  //
+  while (Dev->TxLastUsed != TxCurUsed) {
+    UINT16  UsedElemIdx;
+    UINT32  DescIdx;
+    VOID    *Buffer;
+
+    //
+    // fetch the first descriptor among those that the hypervisor reports
+    // completed
+    //
+    ASSERT (Dev->TxCurPending > 0);
+    ASSERT (Dev->TxCurPending + Dev->TxDoneCount <= Dev->TxMaxPending);
+
+    UsedElemIdx = Dev->TxLastUsed++ % Dev->TxRing.QueueSize;
+    DescIdx     = Dev->TxRing.Used.UsedElem[UsedElemIdx].Id;
+    ASSERT (DescIdx < (UINT32)(2 * Dev->TxMaxPending - 1));
+
+    //
+    // get the device address that has been enqueued for the caller's
+    // transmit buffer
+    //
+    DeviceAddress = Dev->TxRing.Desc[DescIdx + 1].Addr;
+
+    //
+    // now this descriptor can be used again to enqueue a transmit buffer
+    //
+    Dev->TxFreeStack[--Dev->TxCurPending] = (UINT16)DescIdx;
+
+    //
+    // Unmap the device address and perform the reverse mapping to find the
+    // caller buffer address.
+    //
+    Status = VirtioNetUnmapTxBuf (
+               Dev,
+               &Buffer,
+               DeviceAddress
+               );
+    if (EFI_ERROR (Status)) {
+      //
+      // VirtioNetUnmapTxBuf should never fail, if we have reached here
+      // that means our internal state has been corrupted
+      //
+      ASSERT (FALSE);
+      Status = EFI_DEVICE_ERROR;
+      goto Exit;
+    }
+
+    Dev->TxDone[(Dev->TxDoneHead + Dev->TxDoneCount++) % Dev->TxMaxPending] =
+      Buffer;
+  }
+
+  //
+  // keep the used event index just behind the used index, so that the device
+  // never finds a reason to interrupt us (VIRTIO_F_RING_EVENT_IDX)
+  //
+  *Dev->TxRing.Avail.UsedEvent = (UINT16)(Dev->TxLastUsed - 1);
+
   if (InterruptStatus != NULL) {
     //
     // report the receive interrupt if there is data available for reception,
     // report the transmit interrupt if we have transmitted at least one buffer
+    // that the caller has not collected yet
     //
     *InterruptStatus = 0;
     if (Dev->RxLastUsed != RxCurUsed) {
       *InterruptStatus |= EFI_SIMPLE_NETWORK_RECEIVE_INTERRUPT;
     }
 
-    if (Dev->TxLastUsed != TxCurUsed) {
-      ASSERT (Dev->TxCurPending > 0);
+    if (Dev->TxDoneCount > 0) {
       *InterruptStatus |= EFI_SIMPLE_NETWORK_TRANSMIT_INTERRUPT;
     }
   }
 
   if (TxBuf != NULL) {
-    if (Dev->TxLastUsed == TxCurUsed) {
+    if (Dev->TxDoneCount == 0) {
       *TxBuf = NULL;
     } else {
-      UINT16  UsedElemIdx;
-      UINT32  DescIdx;
-
-      //
-      // fetch the first descriptor among those that the hypervisor reports
-      // completed
-      //
-      ASSERT (Dev->TxCurPending > 0);
-      ASSERT (Dev->TxCurPending <= Dev->TxMaxPending);
-
-      UsedElemIdx = Dev->TxLastUsed++ % Dev->TxRing.QueueSize;
-      DescIdx     = Dev->TxRing.Used.UsedElem[UsedElemIdx].Id;
-      ASSERT (DescIdx < (UINT32)(2 * Dev->TxMaxPending - 1));
-
-      //
-      // get the device address that has been enqueued for the caller's
-      // transmit buffer
-      //
-      DeviceAddress = Dev->TxRing.Desc[DescIdx + 1].Addr;
-
-      //
-      // now this descriptor can be used again to enqueue a transmit buffer
-      //
-      Dev->TxFreeStack[--Dev->TxCurPending] = (UINT16)DescIdx;
-
-      //
-      // Unmap the device address and perform the reverse mapping to find the
-      // caller buffer address.
-      //
-      Status = VirtioNetUnmapTxBuf (
-                 Dev,
-                 TxBuf,
-                 DeviceAddress
-                 );
-      if (EFI_ERROR (Status)) {
-        //
-        // VirtioNetUnmapTxBuf should never fail, if we have reached here
-        // that means our internal state has been corrupted
-        //
-        ASSERT (FALSE);
-        Status = EFI_DEVICE_ERROR;
-        goto Exit;
-      }
+      *TxBuf           = Dev->TxDone[Dev->TxDoneHead];
+      Dev->TxDoneHead  = (UINT16)((Dev->TxDoneHead + 1) % Dev->TxMaxPending);
+      Dev->TxDoneCount--;
     }
   }
 
@@ -174,13 +174,25 @@ VirtioNetInitTx (
     return EFI_OUT_OF_RESOURCES;
   }
 
+  //
+  // Completed transmit buffers wait here, in completion order, until the
+  // caller collects them with VirtioNetGetStatus().
+  //
+  Dev->TxDoneHead  = 0;
+  Dev->TxDoneCount = 0;
+  Dev->TxDone      = AllocatePool (Dev->TxMaxPending * sizeof *Dev->TxDone);
+  if (Dev->TxDone == NULL) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto FreeTxFreeStack;
+  }
+
   Dev->TxBufCollection = OrderedCollectionInit (
                            VirtioNetTxBufMapInfoCompare,
                            VirtioNetTxBufDeviceAddressCompare
                            );
   if (Dev->TxBufCollection == NULL) {
     Status = EFI_OUT_OF_RESOURCES;
-    goto FreeTxFreeStack;
+    goto FreeTxDone;
   }
 
   //
@@ -257,13 +269,17 @@ VirtioNetInitTx (
   // virtio-0.9.5, 2.4.2 Receiving Used Buffers From the Device
   //
   MemoryFence ();
-  Dev->TxLastUsed = *Dev->TxRing.Used.Idx;
+  Dev->TxLastUsed  = *Dev->TxRing.Used.Idx;
+  Dev->TxKickedIdx = *Dev->TxRing.Avail.Idx;
   ASSERT (Dev->TxLastUsed == 0);
 
   //
-  // want no interrupt when a transmit completes
+  // want no interrupt when a transmit completes; with VIRTIO_F_RING_EVENT_IDX
+  // the flag is ignored, and the used event index, which we keep just behind
+  // the used index in VirtioNetGetStatus(), takes over its role
   //
-  *Dev->TxRing.Avail.Flags = (UINT16)VRING_AVAIL_F_NO_INTERRUPT;
+  *Dev->TxRing.Avail.Flags     = (UINT16)VRING_AVAIL_F_NO_INTERRUPT;
+  *Dev->TxRing.Avail.UsedEvent = (UINT16)(Dev->TxLastUsed - 1);
 
   return EFI_SUCCESS;
 
@@ -277,6 +293,9 @@ FreeTxSharedReqBuffer:
 UninitTxBufCollection:
   OrderedCollectionUninit (Dev->TxBufCollection);
 
+FreeTxDone:
+  FreePool (Dev->TxDone);
+
 FreeTxFreeStack:
   FreePool (Dev->TxFreeStack);
 
@@ -292,6 +311,7 @@ FreeTxFreeStack:
   The structures laid out and resources configured include:
   - destination area for the host to write virtio-net request headers and
     packet data into,
+  - bookkeeping for lending that area to the upper layer,
   - select polling over RX interrupt,
   - fully populate the RX queue with a static pattern of virtio descriptor
     chains.
@@ -299,6 +319,7 @@ FreeTxFreeStack:
   @param[in,out] Dev       The VNET_DEV driver instance about to enter the
                            EfiSimpleNetworkInitialized state.
 
+  @retval EFI_OUT_OF_RESOURCES  Memory allocation failed.
   @return                       Status codes from VIRTIO_CFG_WRITE() or
                                 VIRTIO_DEVICE_PROTOCOL.AllocateSharedPages or
                                 VirtioMapAllBytesInSharedBuffer().
@@ -314,13 +335,16 @@ VirtioNetInitRx (
 {
   EFI_STATUS            Status;
   UINTN                 VirtioNetReqSize;
+  UINTN                 RxBufPad;
   UINTN                 RxBufSize;
   UINT16                RxAlwaysPending;
+  UINT16                LoanMax;
   UINTN                 PktIdx;
   UINT16                DescIdx;
   UINTN                 NumBytes;
   EFI_PHYSICAL_ADDRESS  RxBufDeviceAddress;
   VOID                  *RxBuffer;
+  VNET_RX_LOAN_POOL     *Pool;
 
   //
   // In VirtIo 1.0, the NumBuffers field is mandatory. In 0.9.5, it depends on
@@ -336,8 +360,16 @@ VirtioNetInitRx (
   // - the recipient for the network data (which consists of Ethernet header
   //   and Ethernet payload).
   //
-  RxBufSize = VirtioNetReqSize +
-              (Dev->Snm.MediaHeaderSize + Dev->Snm.MaxPacketSize);
+  // Pad the start of each buffer so that the Ethernet payload is 4-byte
+  // aligned; frames lent through EDKII_SIMPLE_NETWORK_RX_LOAN_PROTOCOL are
+  // parsed in place.
+  //
+  RxBufPad  = (4 - ((VirtioNetReqSize + Dev->Snm.MediaHeaderSize) & 0x3)) & 0x3;
+  RxBufSize = ALIGN_VALUE (
+                RxBufPad + VirtioNetReqSize +
+                (Dev->Snm.MediaHeaderSize + Dev->Snm.MaxPacketSize),
+                4
+                );
 
   //
   // Limit the number of pending RX packets if the queue is big. The division
@@ -378,6 +410,32 @@ VirtioNetInitRx (
 
   Dev->RxBuf = RxBuffer;
 
+  //
+  // Each RX buffer may be lent out; set up the bookkeeping for that in a
+  // single allocation.
+  //
+  LoanMax = RxAlwaysPending / VNET_RX_LOAN_DIVISOR;
+  Pool    = AllocateZeroPool (
+              sizeof *Pool +
+              RxAlwaysPending * sizeof *Pool->Loans +
+              LoanMax * sizeof *Pool->ReturnStack
+              );
+  if (Pool == NULL) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto UnmapSharedBuffer;
+  }
+
+  Pool->LoanMax     = LoanMax;
+  Pool->Loans       = (VNET_RX_LOAN *)(Pool + 1);
+  Pool->ReturnStack = (UINT16 *)(Pool->Loans + RxAlwaysPending);
+  for (PktIdx = 0; PktIdx < RxAlwaysPending; ++PktIdx) {
+    Pool->Loans[PktIdx].Frame.Release = VirtioNetRxLoanRelease;
+    Pool->Loans[PktIdx].Pool          = Pool;
+    Pool->Loans[PktIdx].DescIdx       = (UINT16)(PktIdx * 2);
+  }
+
+  Dev->RxLoanPool = Pool;
+
   //
   // virtio-0.9.5, 2.4.2 Receiving Used Buffers From the Device
   //
@@ -388,16 +446,17 @@ VirtioNetInitRx (
   //
   // virtio-0.9.5, 2.4.2 Receiving Used Buffers From the Device:
   // the host should not send interrupts, we'll poll in VirtioNetReceive()
-  // and VirtioNetIsPacketAvailable().
+  // and VirtioNetIsPacketAvailable(). See VirtioNetInitTx() about the used
+  // event index.
   //
-  *Dev->RxRing.Avail.Flags = (UINT16)VRING_AVAIL_F_NO_INTERRUPT;
+  *Dev->RxRing.Avail.Flags     = (UINT16)VRING_AVAIL_F_NO_INTERRUPT;
+  *Dev->RxRing.Avail.UsedEvent = (UINT16)(Dev->RxLastUsed - 1);
 
   //
   // now set up a separate, two-part descriptor chain for each RX packet, and
   // link each chain into (from) the available ring as well
   //
-  DescIdx            = 0;
-  RxBufDeviceAddress = Dev->RxBufDeviceBase;
+  DescIdx = 0;
   for (PktIdx = 0; PktIdx < RxAlwaysPending; ++PktIdx) {
     //
     // virtio-0.9.5, 2.4.1.2 Updating the Available Ring
@@ -408,6 +467,8 @@ VirtioNetInitRx (
     //
     // virtio-0.9.5, 2.4.1.1 Placing Buffers into the Descriptor Table
     //
+    RxBufDeviceAddress = Dev->RxBufDeviceBase + PktIdx * RxBufSize + RxBufPad;
+
     Dev->RxRing.Desc[DescIdx].Addr  = RxBufDeviceAddress;
     Dev->RxRing.Desc[DescIdx].Len   = (UINT32)VirtioNetReqSize;
     Dev->RxRing.Desc[DescIdx].Flags = VRING_DESC_F_WRITE | VRING_DESC_F_NEXT;
@@ -415,9 +476,10 @@ VirtioNetInitRx (
     RxBufDeviceAddress             += Dev->RxRing.Desc[DescIdx++].Len;
 
     Dev->RxRing.Desc[DescIdx].Addr  = RxBufDeviceAddress;
-    Dev->RxRing.Desc[DescIdx].Len   = (UINT32)(RxBufSize - VirtioNetReqSize);
+    Dev->RxRing.Desc[DescIdx].Len   = (UINT32)(Dev->Snm.MediaHeaderSize +
+                                               Dev->Snm.MaxPacketSize);
     Dev->RxRing.Desc[DescIdx].Flags = VRING_DESC_F_WRITE;
-    RxBufDeviceAddress             += Dev->RxRing.Desc[DescIdx++].Len;
+    ++DescIdx;
   }
 
   //
@@ -425,6 +487,7 @@ VirtioNetInitRx (
   //
   MemoryFence ();
   *Dev->RxRing.Avail.Idx = RxAlwaysPending;
+  Dev->RxKickedIdx       = RxAlwaysPending;
 
   //
   // At this point reception may already be running. In order to make it sure,
@@ -438,11 +501,14 @@ VirtioNetInitRx (
   Status = Dev->VirtIo->SetQueueNotify (Dev->VirtIo, VIRTIO_NET_Q_RX);
   if (EFI_ERROR (Status)) {
     Dev->VirtIo->SetDeviceStatus (Dev->VirtIo, 0);
-    goto UnmapSharedBuffer;
+    goto FreeLoanPool;
   }
 
   return Status;
 
+FreeLoanPool:
+  FreePool (Pool);
+
 UnmapSharedBuffer:
   Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, Dev->RxBufMap);
 
@@ -558,7 +624,8 @@ VirtioNetInitialize (
     );
 
   Features &= VIRTIO_NET_F_MAC | VIRTIO_NET_F_STATUS | VIRTIO_F_VERSION_1 |
-              VIRTIO_F_IOMMU_PLATFORM;
+              VIRTIO_F_IOMMU_PLATFORM | VIRTIO_F_RING_EVENT_IDX;
+  Dev->EventIdx = (BOOLEAN)((Features & VIRTIO_F_RING_EVENT_IDX) != 0);
 
   //
   // In virtio-1.0, feature negotiation is expected to complete before queue
@@ -73,7 +73,6 @@ VirtioNetReceive (
   UINT32      RxLen;
   UINTN       OrigBufferSize;
   UINT8       *RxPtr;
-  UINT16      AvailIdx;
   EFI_STATUS  NotifyStatus;
   UINTN       RxBufOffset;
 
@@ -94,6 +93,16 @@ VirtioNetReceive (
       break;
   }
 
+  //
+  // Recycle the buffers of the frames that have been given back since the
+  // last call; the client may alternate between this function and
+  // VirtioNetRxLoanReceive().
+  //
+  Status = VirtioNetRecycleRxLoans (Dev);
+  if (EFI_ERROR (Status)) {
+    goto Exit;
+  }
+
   //
   // virtio-0.9.5, 2.4.2 Receiving Used Buffers From the Device
   //
@@ -102,7 +111,20 @@ VirtioNetReceive (
   MemoryFence ();
 
   if (Dev->RxLastUsed == RxCurUsed) {
-    Status = EFI_NOT_READY;
+    //
+    // Nothing left to receive; make sure the device learns about every
+    // buffer that we have returned to it.
+    //
+    Status = VirtioNetKick (
+               Dev,
+               VIRTIO_NET_Q_RX,
+               &Dev->RxRing,
+               &Dev->RxKickedIdx
+               );
+    if (!EFI_ERROR (Status)) {
+      Status = EFI_NOT_READY;
+    }
+
     goto Exit;
   }
 
@@ -166,17 +188,12 @@ RecycleDesc:
   ++Dev->RxLastUsed;
 
   //
-  // virtio-0.9.5, 2.4.1 Supplying Buffers to The Device
+  // keep the used event index just behind the used index, so that the device
+  // never finds a reason to interrupt us (VIRTIO_F_RING_EVENT_IDX)
   //
-  AvailIdx                                                   = *Dev->RxRing.Avail.Idx;
-  Dev->RxRing.Avail.Ring[AvailIdx++ % Dev->RxRing.QueueSize] =
-    (UINT16)DescIdx;
-
-  MemoryFence ();
-  *Dev->RxRing.Avail.Idx = AvailIdx;
+  *Dev->RxRing.Avail.UsedEvent = (UINT16)(Dev->RxLastUsed - 1);
 
-  MemoryFence ();
-  NotifyStatus = Dev->VirtIo->SetQueueNotify (Dev->VirtIo, VIRTIO_NET_Q_RX);
+  NotifyStatus = VirtioNetRecycleRxDesc (Dev, (UINT16)DescIdx);
   if (!EFI_ERROR (Status)) {
     // earlier error takes precedence
     Status = NotifyStatus;
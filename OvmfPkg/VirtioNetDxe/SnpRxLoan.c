@@ -0,0 +1,255 @@
+/** @file
+
+  Implementation of the EDKII_SIMPLE_NETWORK_RX_LOAN_PROTOCOL.Receive()
+  function and its private helpers if any.
+
+  Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Library/BaseLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+
+#include "VirtioNet.h"
+
+/**
+  Give the buffers of the frames that the SNP client has given back since the
+  previous call to the device.
+
+  This function may only be called by VirtioNetReceive() and
+  VirtioNetRxLoanReceive(), in the EfiSimpleNetworkInitialized state.
+
+  @param[in,out] Dev  The VNET_DEV driver instance owning the RX ring.
+
+  @return              Status codes from VirtioNetRecycleRxDesc().
+  @retval EFI_SUCCESS  All given back buffers have been recycled.
+*/
+EFI_STATUS
+EFIAPI
+VirtioNetRecycleRxLoans (
+  IN OUT VNET_DEV  *Dev
+  )
+{
+  VNET_RX_LOAN_POOL  *Pool;
+  EFI_TPL            OldTpl;
+  EFI_STATUS         Status;
+  EFI_STATUS         RecycleStatus;
+
+  Pool = Dev->RxLoanPool;
+
+  //
+  // Peeking at ReturnCount without raising the TPL is fine: a frame given
+  // back meanwhile will be picked up on the next call.
+  //
+  if (Pool->ReturnCount == 0) {
+    return EFI_SUCCESS;
+  }
+
+  Status = EFI_SUCCESS;
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  while (Pool->ReturnCount > 0) {
+    --Pool->ReturnCount;
+    --Pool->LoanCount;
+    RecycleStatus = VirtioNetRecycleRxDesc (
+                      Dev,
+                      Pool->ReturnStack[Pool->ReturnCount]
+                      );
+    if (!EFI_ERROR (Status)) {
+      // earlier error takes precedence
+      Status = RecycleStatus;
+    }
+  }
+
+  gBS->RestoreTPL (OldTpl);
+  return Status;
+}
+
+/**
+  Receive a frame from the network interface without copying it.
+
+  The frame stays in the receive area, and its buffer is withheld from the
+  device, until the SNP client calls VirtioNetRxLoanRelease() on it.
+
+  @param[in]   This               Pointer to the EDKII_SIMPLE_NETWORK_RX_LOAN_PROTOCOL instance.
+  @param[out]  Frame              On output, the received frame.
+
+  @retval EFI_SUCCESS             A frame has been received.
+  @retval EFI_NOT_STARTED         The network interface has not been started.
+  @retval EFI_NOT_READY           No frame has been received.
+  @retval EFI_OUT_OF_RESOURCES    Too many frames are on loan already. The next
+                                  frame can be received with
+                                  EFI_SIMPLE_NETWORK_PROTOCOL.Receive().
+  @retval EFI_DEVICE_ERROR        The network interface is not initialized, or
+                                  a malformed frame has been dropped.
+  @retval EFI_INVALID_PARAMETER   This or Frame is NULL.
+  @return                         Status codes from VirtioNetKick().
+**/
+EFI_STATUS
+EFIAPI
+VirtioNetRxLoanReceive (
+  IN  EDKII_SIMPLE_NETWORK_RX_LOAN_PROTOCOL  *This,
+  OUT EDKII_SIMPLE_NETWORK_RX_LOAN_FRAME     **Frame
+  )
+{
+  VNET_DEV           *Dev;
+  VNET_RX_LOAN_POOL  *Pool;
+  VNET_RX_LOAN       *Loan;
+  EFI_TPL            OldTpl;
+  EFI_STATUS         Status;
+  UINT16             RxCurUsed;
+  UINT16             UsedElemIdx;
+  UINT32             DescIdx;
+  UINT32             RxLen;
+
+  if ((This == NULL) || (Frame == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Dev    = VIRTIO_NET_FROM_RX_LOAN (This);
+  OldTpl = gBS->RaiseTPL (TPL_CALLBACK);
+  switch (Dev->Snm.State) {
+    case EfiSimpleNetworkStopped:
+      Status = EFI_NOT_STARTED;
+      goto Exit;
+    case EfiSimpleNetworkStarted:
+      Status = EFI_DEVICE_ERROR;
+      goto Exit;
+    default:
+      break;
+  }
+
+  Status = VirtioNetRecycleRxLoans (Dev);
+  if (EFI_ERROR (Status)) {
+    goto Exit;
+  }
+
+  //
+  // virtio-0.9.5, 2.4.2 Receiving Used Buffers From the Device
+  //
+  MemoryFence ();
+  RxCurUsed = *Dev->RxRing.Used.Idx;
+  MemoryFence ();
+
+  if (Dev->RxLastUsed == RxCurUsed) {
+    //
+    // Nothing left to receive; make sure the device learns about every
+    // buffer that we have returned to it.
+    //
+    Status = VirtioNetKick (
+               Dev,
+               VIRTIO_NET_Q_RX,
+               &Dev->RxRing,
+               &Dev->RxKickedIdx
+               );
+    if (!EFI_ERROR (Status)) {
+      Status = EFI_NOT_READY;
+    }
+
+    goto Exit;
+  }
+
+  Pool = Dev->RxLoanPool;
+  if (Pool->LoanCount >= Pool->LoanMax) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto Exit; // keep the packet for VirtioNetReceive()
+  }
+
+  UsedElemIdx = Dev->RxLastUsed % Dev->RxRing.QueueSize;
+  DescIdx     = Dev->RxRing.Used.UsedElem[UsedElemIdx].Id;
+  RxLen       = Dev->RxRing.Used.UsedElem[UsedElemIdx].Len;
+
+  //
+  // the virtio-net request header must be complete; we skip it
+  //
+  ASSERT (RxLen >= Dev->RxRing.Desc[DescIdx].Len);
+  RxLen -= Dev->RxRing.Desc[DescIdx].Len;
+  //
+  // the host must not have filled in more data than requested
+  //
+  ASSERT (RxLen <= Dev->RxRing.Desc[DescIdx + 1].Len);
+
+  ++Dev->RxLastUsed;
+
+  //
+  // keep the used event index just behind the used index, so that the device
+  // never finds a reason to interrupt us (VIRTIO_F_RING_EVENT_IDX)
+  //
+  *Dev->RxRing.Avail.UsedEvent = (UINT16)(Dev->RxLastUsed - 1);
+
+  if (RxLen < Dev->Snm.MediaHeaderSize) {
+    //
+    // drop useless short packet
+    //
+    Status = VirtioNetRecycleRxDesc (Dev, (UINT16)DescIdx);
+    if (!EFI_ERROR (Status)) {
+      Status = EFI_DEVICE_ERROR;
+    }
+
+    goto Exit;
+  }
+
+  //
+  // VirtioNetInitRx() set up the two-part descriptor chains in order, from
+  // the start of the descriptor table
+  //
+  Loan = &Pool->Loans[DescIdx / 2];
+  ASSERT (Loan->DescIdx == DescIdx);
+
+  Loan->Frame.Buffer = Dev->RxBuf +
+                       (UINTN)(Dev->RxRing.Desc[DescIdx + 1].Addr -
+                               Dev->RxBufDeviceBase);
+  Loan->Frame.Length = RxLen;
+  ++Pool->LoanCount;
+
+  *Frame = &Loan->Frame;
+  Status = EFI_SUCCESS;
+
+Exit:
+  gBS->RestoreTPL (OldTpl);
+  return Status;
+}
+
+/**
+  Give a frame lent by VirtioNetRxLoanReceive() back.
+
+  If the device is still running, the buffer of the frame is recycled by the
+  next VirtioNetReceive() or VirtioNetRxLoanReceive() call. Otherwise, this
+  function frees the pool that VirtioNetShutdownRx() has orphaned once the last
+  frame is back.
+
+  @param[in]  Frame               The frame returned by VirtioNetRxLoanReceive().
+**/
+VOID
+EFIAPI
+VirtioNetRxLoanRelease (
+  IN EDKII_SIMPLE_NETWORK_RX_LOAN_FRAME  *Frame
+  )
+{
+  VNET_RX_LOAN       *Loan;
+  VNET_RX_LOAN_POOL  *Pool;
+  EFI_TPL            OldTpl;
+  BOOLEAN            LastOrphan;
+
+  Loan = VNET_RX_LOAN_FROM_FRAME (Frame);
+  Pool = Loan->Pool;
+
+  OldTpl     = gBS->RaiseTPL (TPL_NOTIFY);
+  LastOrphan = FALSE;
+  if (Pool->Orphaned) {
+    ASSERT (Pool->LoanCount > 0);
+    --Pool->LoanCount;
+    LastOrphan = (BOOLEAN)(Pool->LoanCount == 0);
+  } else {
+    ASSERT (Pool->ReturnCount < Pool->LoanCount);
+    Pool->ReturnStack[Pool->ReturnCount++] = Loan->DescIdx;
+  }
+
+  gBS->RestoreTPL (OldTpl);
+
+  if (LastOrphan) {
+    FreePool (Pool);
+  }
+}
@@ -8,7 +8,9 @@
 
 **/
 
+#include <Library/BaseLib.h>
 #include <Library/MemoryAllocationLib.h>
+#include <Library/UefiBootServicesTableLib.h>
 
 #include "VirtioNet.h"
 
@@ -42,6 +44,39 @@ VirtioNetShutdownRx (
   IN OUT VNET_DEV  *Dev
   )
 {
+  VNET_RX_LOAN_POOL  *Pool;
+  EFI_TPL            OldTpl;
+  UINT16             OnLoan;
+
+  //
+  // Frames on loan may be given back at TPL_NOTIFY. The ones that have been
+  // given back already need not be recycled anymore.
+  //
+  Pool              = Dev->RxLoanPool;
+  OldTpl            = gBS->RaiseTPL (TPL_NOTIFY);
+  Pool->LoanCount  -= Pool->ReturnCount;
+  Pool->ReturnCount = 0;
+  OnLoan            = Pool->LoanCount;
+  Pool->Orphaned    = (BOOLEAN)(OnLoan > 0);
+  gBS->RestoreTPL (OldTpl);
+
+  if (OnLoan > 0) {
+    //
+    // The device has been reset, but the upper layer still holds frames in
+    // the receive area. Leave the area alone for good; the last
+    // VirtioNetRxLoanRelease() call frees the pool.
+    //
+    DEBUG ((
+      DEBUG_WARN,
+      "%a: %u RX buffer(s) on loan, leaking the receive area\n",
+      __func__,
+      OnLoan
+      ));
+    return;
+  }
+
+  FreePool (Pool);
+
   Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, Dev->RxBufMap);
   Dev->VirtIo->FreeSharedPages (
                  Dev->VirtIo,
@@ -80,9 +115,119 @@ VirtioNetShutdownTx (
 
   OrderedCollectionUninit (Dev->TxBufCollection);
 
+  FreePool (Dev->TxDone);
   FreePool (Dev->TxFreeStack);
 }
 
+/**
+  Notify the device about the buffers that have been added to the available
+  ring of a virtqueue since the last call, unless the device has asked for
+  suppressing such notifications.
+
+  With VIRTIO_F_RING_EVENT_IDX negotiated, the device publishes the available
+  index it wants to be woken up at; otherwise it may set the
+  VRING_USED_F_NO_NOTIFY flag while it processes the queue anyway. Either way,
+  skipping the notification saves a trap to the hypervisor.
+
+  @param[in]     Dev         The VNET_DEV driver instance owning the ring.
+  @param[in]     QueueIndex  The index of the virtqueue to notify.
+  @param[in]     Ring        The virtio ring whose available index the caller
+                             has just updated.
+  @param[in,out] KickedIdx   The available index at the time of the previous
+                             call for the same ring. On output, the current
+                             available index.
+
+  @return  Status codes from VIRTIO_DEVICE_PROTOCOL.SetQueueNotify().
+  @retval EFI_SUCCESS  The device has been notified, or it did not need to be.
+*/
+EFI_STATUS
+EFIAPI
+VirtioNetKick (
+  IN     VNET_DEV  *Dev,
+  IN     UINT16    QueueIndex,
+  IN     VRING     *Ring,
+  IN OUT UINT16    *KickedIdx
+  )
+{
+  UINT16   NewIdx;
+  UINT16   OldIdx;
+  BOOLEAN  NeedKick;
+
+  //
+  // the available index is never written by the host, we can read it back
+  // without a barrier; however the update of the index must be visible to
+  // the host before we look at its notification suppression state
+  //
+  NewIdx = *Ring->Avail.Idx;
+  OldIdx = *KickedIdx;
+  if (NewIdx == OldIdx) {
+    return EFI_SUCCESS;
+  }
+
+  *KickedIdx = NewIdx;
+
+  MemoryFence ();
+  if (Dev->EventIdx) {
+    //
+    // virtio-1.0, 2.4.7.2 Notifications: notify if the event index was
+    // passed while the available index moved from OldIdx to NewIdx
+    //
+    NeedKick = (BOOLEAN)((UINT16)(NewIdx - *Ring->Used.AvailEvent - 1) <
+                         (UINT16)(NewIdx - OldIdx));
+  } else {
+    //
+    // virtio-0.9.5, 2.4.1.4 Notifying the Device
+    //
+    NeedKick = (BOOLEAN)((*Ring->Used.Flags & VRING_USED_F_NO_NOTIFY) == 0);
+  }
+
+  if (!NeedKick) {
+    return EFI_SUCCESS;
+  }
+
+  return Dev->VirtIo->SetQueueNotify (Dev->VirtIo, QueueIndex);
+}
+
+/**
+  Give a receive buffer back to the device, by placing its descriptor chain on
+  the available ring.
+
+  Notifying the device is expensive, so it is only done once a batch of
+  buffers has been returned. The caller must notify the device when it finds
+  nothing left to receive (see the EFI_NOT_READY branch of
+  VirtioNetReceive()); the device never runs dry for long, as the SNP client
+  polls until there is nothing left to receive.
+
+  @param[in,out] Dev      The VNET_DEV driver instance owning the RX ring.
+  @param[in]     DescIdx  The head descriptor index of the receive buffer.
+
+  @return  Status codes from VirtioNetKick().
+*/
+EFI_STATUS
+EFIAPI
+VirtioNetRecycleRxDesc (
+  IN OUT VNET_DEV  *Dev,
+  IN     UINT16    DescIdx
+  )
+{
+  UINT16  AvailIdx;
+
+  //
+  // virtio-0.9.5, 2.4.1 Supplying Buffers to The Device
+  //
+  AvailIdx                                                   = *Dev->RxRing.Avail.Idx;
+  Dev->RxRing.Avail.Ring[AvailIdx++ % Dev->RxRing.QueueSize] = DescIdx;
+
+  MemoryFence ();
+  *Dev->RxRing.Avail.Idx = AvailIdx;
+
+  if ((UINT16)(AvailIdx - Dev->RxKickedIdx) < VNET_RX_KICK_BATCH) {
+    return EFI_SUCCESS;
+  }
+
+  return VirtioNetKick (Dev, VIRTIO_NET_Q_RX, &Dev->RxRing, &Dev->RxKickedIdx);
+}
+
 /**
   Release TX and RX VRING resources.
 
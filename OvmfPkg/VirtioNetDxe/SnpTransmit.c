@@ -101,10 +101,11 @@ VirtioNetTransmit (
   }
 
   //
-  // check if we have room for transmission
+  // check if we have room for transmission; completed buffers that the caller
+  // has not collected yet count against the limit
   //
-  ASSERT (Dev->TxCurPending <= Dev->TxMaxPending);
-  if (Dev->TxCurPending == Dev->TxMaxPending) {
+  ASSERT (Dev->TxCurPending + Dev->TxDoneCount <= Dev->TxMaxPending);
+  if (Dev->TxCurPending + Dev->TxDoneCount == Dev->TxMaxPending) {
     Status = EFI_NOT_READY;
     goto Exit;
   }
@@ -173,8 +174,12 @@ VirtioNetTransmit (
   MemoryFence ();
   *Dev->TxRing.Avail.Idx = AvailIdx;
 
-  MemoryFence ();
-  Status = Dev->VirtIo->SetQueueNotify (Dev->VirtIo, VIRTIO_NET_Q_TX);
+  Status = VirtioNetKick (
+             Dev,
+             VIRTIO_NET_Q_TX,
+             &Dev->TxRing,
+             &Dev->TxKickedIdx
+             );
 
 Exit:
   gBS->RestoreTPL (OldTpl);
@@ -20,6 +20,7 @@
 #include <Protocol/DevicePath.h>
 #include <Protocol/DriverBinding.h>
 #include <Protocol/SimpleNetwork.h>
+#include <Protocol/SimpleNetworkRxLoan.h>
 #include <Library/OrderedCollectionLib.h>
 
 #define VNET_SIG  SIGNATURE_32 ('V', 'N', 'E', 'T')
@@ -29,6 +30,53 @@
 //
 #define VNET_MAX_PENDING  64
 
+//
+// number of RX buffers that VirtioNetReceive() may hand back to the device
+// before it considers notifying the device about them
+//
+#define VNET_RX_KICK_BATCH  16
+
+//
+// RX buffers lent through EDKII_SIMPLE_NETWORK_RX_LOAN_PROTOCOL are out of the
+// device's reach until they are given back. Never lend more than this share
+// (1 / VNET_RX_LOAN_DIVISOR) of them, so that the device keeps receiving while
+// the upper layers hold on to some frames.
+//
+#define VNET_RX_LOAN_DIVISOR  2
+
+//
+// An RX buffer on loan.
+//
+typedef struct _VNET_RX_LOAN_POOL VNET_RX_LOAN_POOL;
+
+typedef struct {
+  EDKII_SIMPLE_NETWORK_RX_LOAN_FRAME    Frame;
+  VNET_RX_LOAN_POOL                     *Pool;
+  UINT16                                DescIdx;
+} VNET_RX_LOAN;
+
+#define VNET_RX_LOAN_FROM_FRAME(FramePointer) \
+        BASE_CR (FramePointer, VNET_RX_LOAN, Frame)
+
+//
+// The bookkeeping of RX buffers on loan. It is allocated separately from
+// VNET_DEV, because frames may be given back after SNP.Shutdown() -- in that
+// case VirtioNetShutdownRx() marks the pool orphaned and leaves the RX buffers
+// allocated, and the last VirtioNetRxLoanRelease() call frees the pool.
+//
+// Frames may be given back at up to TPL_NOTIFY, so ReturnCount and ReturnStack
+// are only accessed at TPL_NOTIFY. The same applies to LoanCount once the pool
+// is orphaned; before that, it only changes at TPL_CALLBACK.
+//
+struct _VNET_RX_LOAN_POOL {
+  BOOLEAN         Orphaned;
+  UINT16          LoanMax;      // at most this many RX buffers on loan
+  UINT16          LoanCount;    // RX buffers on loan or in ReturnStack
+  UINT16          ReturnCount;  // RX buffers given back, not yet recycled
+  UINT16          *ReturnStack; // head descriptor indices of the latter
+  VNET_RX_LOAN    *Loans;       // indexed by the head descriptor index / 2
+};
+
 //
 // State diagram:
 //
@@ -69,33 +117,41 @@ typedef struct {
   //
   //                          field              init function
   //                          ------------------ ------------------------------
-  UINT32                         Signature;      // VirtioNetDriverBindingStart
-  VIRTIO_DEVICE_PROTOCOL         *VirtIo;        // VirtioNetDriverBindingStart
-  EFI_SIMPLE_NETWORK_PROTOCOL    Snp;            // VirtioNetSnpPopulate
-  EFI_SIMPLE_NETWORK_MODE        Snm;            // VirtioNetSnpPopulate
-  EFI_EVENT                      ExitBoot;       // VirtioNetSnpPopulate
-  EFI_DEVICE_PATH_PROTOCOL       *MacDevicePath; // VirtioNetDriverBindingStart
-  EFI_HANDLE                     MacHandle;      // VirtioNetDriverBindingStart
-
-  VRING                          RxRing;          // VirtioNetInitRing
-  VOID                           *RxRingMap;      // VirtioRingMap and
-                                                  // VirtioNetInitRing
-  UINT8                          *RxBuf;          // VirtioNetInitRx
-  UINT16                         RxLastUsed;      // VirtioNetInitRx
-  UINTN                          RxBufNrPages;    // VirtioNetInitRx
-  EFI_PHYSICAL_ADDRESS           RxBufDeviceBase; // VirtioNetInitRx
-  VOID                           *RxBufMap;       // VirtioNetInitRx
-
-  VRING                          TxRing;           // VirtioNetInitRing
-  VOID                           *TxRingMap;       // VirtioRingMap and
-                                                   // VirtioNetInitRing
-  UINT16                         TxMaxPending;     // VirtioNetInitTx
-  UINT16                         TxCurPending;     // VirtioNetInitTx
-  UINT16                         *TxFreeStack;     // VirtioNetInitTx
-  VIRTIO_1_0_NET_REQ             *TxSharedReq;     // VirtioNetInitTx
-  VOID                           *TxSharedReqMap;  // VirtioNetInitTx
-  UINT16                         TxLastUsed;       // VirtioNetInitTx
-  ORDERED_COLLECTION             *TxBufCollection; // VirtioNetInitTx
+  UINT32                                   Signature;      // VirtioNetDriverBindingStart
+  VIRTIO_DEVICE_PROTOCOL                   *VirtIo;        // VirtioNetDriverBindingStart
+  EFI_SIMPLE_NETWORK_PROTOCOL              Snp;            // VirtioNetSnpPopulate
+  EFI_SIMPLE_NETWORK_MODE                  Snm;            // VirtioNetSnpPopulate
+  EDKII_SIMPLE_NETWORK_RX_LOAN_PROTOCOL    RxLoan;         // VirtioNetSnpPopulate
+  EFI_EVENT                                ExitBoot;       // VirtioNetSnpPopulate
+  EFI_DEVICE_PATH_PROTOCOL                 *MacDevicePath; // VirtioNetDriverBindingStart
+  EFI_HANDLE                               MacHandle;      // VirtioNetDriverBindingStart
+  BOOLEAN                                  EventIdx;       // VirtioNetInitialize
+
+  VRING                                    RxRing;          // VirtioNetInitRing
+  VOID                                     *RxRingMap;      // VirtioRingMap and
+                                                            // VirtioNetInitRing
+  UINT8                                    *RxBuf;          // VirtioNetInitRx
+  UINT16                                   RxLastUsed;      // VirtioNetInitRx
+  UINT16                                   RxKickedIdx;     // VirtioNetInitRx
+  UINTN                                    RxBufNrPages;    // VirtioNetInitRx
+  EFI_PHYSICAL_ADDRESS                     RxBufDeviceBase; // VirtioNetInitRx
+  VOID                                     *RxBufMap;       // VirtioNetInitRx
+  VNET_RX_LOAN_POOL                        *RxLoanPool;     // VirtioNetInitRx
+
+  VRING                                    TxRing;           // VirtioNetInitRing
+  VOID                                     *TxRingMap;       // VirtioRingMap and
+                                                             // VirtioNetInitRing
+  UINT16                                   TxMaxPending;     // VirtioNetInitTx
+  UINT16                                   TxCurPending;     // VirtioNetInitTx
+  UINT16                                   *TxFreeStack;     // VirtioNetInitTx
+  VIRTIO_1_0_NET_REQ                       *TxSharedReq;     // VirtioNetInitTx
+  VOID                                     *TxSharedReqMap;  // VirtioNetInitTx
+  UINT16                                   TxLastUsed;       // VirtioNetInitTx
+  UINT16                                   TxKickedIdx;      // VirtioNetInitTx
+  VOID                                     **TxDone;         // VirtioNetInitTx
+  UINT16                                   TxDoneHead;       // VirtioNetInitTx
+  UINT16                                   TxDoneCount;      // VirtioNetInitTx
+  ORDERED_COLLECTION                       *TxBufCollection; // VirtioNetInitTx
 } VNET_DEV;
 
 //
@@ -111,6 +167,9 @@ typedef struct {
 #define VIRTIO_NET_FROM_SNP(SnpPointer) \
         CR (SnpPointer, VNET_DEV, Snp, VNET_SIG)
 
+#define VIRTIO_NET_FROM_RX_LOAN(RxLoanPointer) \
+        CR (RxLoanPointer, VNET_DEV, RxLoan, VNET_SIG)
+
 #define VIRTIO_CFG_WRITE(Dev, Field, Value)  ((Dev)->VirtIo->WriteDevice (  \
                                                 (Dev)->VirtIo,              \
                                                 OFFSET_OF_VNET (Field),     \
@@ -252,6 +311,23 @@ VirtioNetReceive (
   OUT UINT16                      *Protocol   OPTIONAL
   );
 
+//
+// member function implementing the Simple Network Receive Loan Protocol, and
+// the function that receives loaned frames back
+//
+EFI_STATUS
+EFIAPI
+VirtioNetRxLoanReceive (
+  IN  EDKII_SIMPLE_NETWORK_RX_LOAN_PROTOCOL  *This,
+  OUT EDKII_SIMPLE_NETWORK_RX_LOAN_FRAME     **Frame
+  );
+
+VOID
+EFIAPI
+VirtioNetRxLoanRelease (
+  IN EDKII_SIMPLE_NETWORK_RX_LOAN_FRAME  *Frame
+  );
+
 //
 // utility functions shared by various SNP member functions
 //
@@ -267,6 +343,22 @@ VirtioNetShutdownTx (
   IN OUT VNET_DEV  *Dev
   );
 
+//
+// utility functions to give RX buffers back to the device
+//
+EFI_STATUS
+EFIAPI
+VirtioNetRecycleRxDesc (
+  IN OUT VNET_DEV  *Dev,
+  IN     UINT16    DescIdx
+  );
+
+EFI_STATUS
+EFIAPI
+VirtioNetRecycleRxLoans (
+  IN OUT VNET_DEV  *Dev
+  );
+
 VOID
 EFIAPI
 VirtioNetUninitRing (
@@ -275,6 +367,19 @@ VirtioNetUninitRing (
   IN     VOID      *RingMap
   );
 
+//
+// utility function to notify the device about new available buffers, unless
+// the device asked us not to
+//
+EFI_STATUS
+EFIAPI
+VirtioNetKick (
+  IN     VNET_DEV  *Dev,
+  IN     UINT16    QueueIndex,
+  IN     VRING     *Ring,
+  IN OUT UINT16    *KickedIdx
+  );
+
 //
 // utility functions to map caller-supplied Tx buffer system physical address
 // to a device address and vice versa
@@ -433,10 +433,7 @@ VirtioScsiPassThru (
   EFI_STATUS                 Status;
   volatile VIRTIO_SCSI_REQ   *Request;
   volatile VIRTIO_SCSI_RESP  *Response;
-  VOID                       *ResponseBuffer;
   DESC_INDICES               Indices;
-  VOID                       *RequestMapping;
-  VOID                       *ResponseMapping;
   VOID                       *InDataMapping;
   VOID                       *OutDataMapping;
   EFI_PHYSICAL_ADDRESS       RequestDeviceAddress;
@@ -456,11 +453,6 @@ VirtioScsiPassThru (
   InDataDeviceAddress  = 0;
   OutDataDeviceAddress = 0;
 
-  Request = AllocateZeroPool (sizeof (*Request));
-  if (Request == NULL) {
-    return EFI_OUT_OF_RESOURCES;
-  }
-
   Dev = VIRTIO_SCSI_FROM_PASS_THRU (This);
   CopyMem (&TargetValue, Target, sizeof TargetValue);
 
@@ -468,25 +460,19 @@ VirtioScsiPassThru (
   OutDataBufferIsMapped = FALSE;
   InDataNumPages        = 0;
 
-  Status = PopulateRequest (Dev, TargetValue, Lun, Packet, Request);
-  if (EFI_ERROR (Status)) {
-    goto FreeScsiRequest;
-  }
-
   //
-  // Map the virtio-scsi Request header buffer
+  // The request and response headers live in the shared buffer that
+  // VirtioScsiInit() mapped with BusMasterCommonBuffer.
   //
-  Status = VirtioMapAllBytesInSharedBuffer (
-             Dev->VirtIo,
-             VirtioOperationBusMasterRead,
-             (VOID *)Request,
-             sizeof (*Request),
-             &RequestDeviceAddress,
-             &RequestMapping
-             );
+  Request               = &Dev->SharedHdr->Request;
+  Response              = &Dev->SharedHdr->Response;
+  RequestDeviceAddress  = Dev->SharedHdrAddr + OFFSET_OF (VSCSI_SHARED_HDR, Request);
+  ResponseDeviceAddress = Dev->SharedHdrAddr + OFFSET_OF (VSCSI_SHARED_HDR, Response);
+
+  ZeroMem ((VOID *)Request, sizeof (*Request));
+  Status = PopulateRequest (Dev, TargetValue, Lun, Packet, Request);
   if (EFI_ERROR (Status)) {
-    Status = ReportHostAdapterError (Packet);
-    goto FreeScsiRequest;
+    return Status;
   }
 
   //
@@ -515,8 +501,7 @@ VirtioScsiPassThru (
                                     &InDataBuffer
                                     );
     if (EFI_ERROR (Status)) {
-      Status = ReportHostAdapterError (Packet);
-      goto UnmapRequestBuffer;
+      return ReportHostAdapterError (Packet);
     }
 
     ZeroMem (InDataBuffer, Packet->InTransferLength);
@@ -557,21 +542,8 @@ VirtioScsiPassThru (
 
   //
   // Response header is bi-direction (we preset with host status and expect
-  // the device to update it). Allocate a response buffer which can be mapped
-  // to access equally by both processor and device.
+  // the device to update it).
   //
-  Status = Dev->VirtIo->AllocateSharedPages (
-                          Dev->VirtIo,
-                          EFI_SIZE_TO_PAGES (sizeof *Response),
-                          &ResponseBuffer
-                          );
-  if (EFI_ERROR (Status)) {
-    Status = ReportHostAdapterError (Packet);
-    goto UnmapOutDataBuffer;
-  }
-
-  Response = ResponseBuffer;
-
   ZeroMem ((VOID *)Response, sizeof (*Response));
 
   //
@@ -579,23 +551,6 @@ VirtioScsiPassThru (
   //
   Response->Response = VIRTIO_SCSI_S_FAILURE;
 
-  //
-  // Map the response buffer with BusMasterCommonBuffer so that response
-  // buffer can be accessed by both host and device.
-  //
-  Status = VirtioMapAllBytesInSharedBuffer (
-             Dev->VirtIo,
-             VirtioOperationBusMasterCommonBuffer,
-             ResponseBuffer,
-             sizeof (*Response),
-             &ResponseDeviceAddress,
-             &ResponseMapping
-             );
-  if (EFI_ERROR (Status)) {
-    Status = ReportHostAdapterError (Packet);
-    goto FreeResponseBuffer;
-  }
-
   VirtioPrepare (&Dev->Ring, &Indices);
 
   //
@@ -665,7 +620,7 @@ VirtioScsiPassThru (
         ) != EFI_SUCCESS)
   {
     Status = ReportHostAdapterError (Packet);
-    goto UnmapResponseBuffer;
+    goto UnmapOutDataBuffer;
   }
 
   Status = ParseResponse (Packet, Response);
@@ -679,16 +634,6 @@ VirtioScsiPassThru (
     CopyMem (Packet->InDataBuffer, InDataBuffer, Packet->InTransferLength);
   }
 
-UnmapResponseBuffer:
-  Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, ResponseMapping);
-
-FreeResponseBuffer:
-  Dev->VirtIo->FreeSharedPages (
-                 Dev->VirtIo,
-                 EFI_SIZE_TO_PAGES (sizeof *Response),
-                 ResponseBuffer
-                 );
-
 UnmapOutDataBuffer:
   if (OutDataBufferIsMapped) {
     Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, OutDataMapping);
@@ -704,12 +649,6 @@ FreeInDataBuffer:
     Dev->VirtIo->FreeSharedPages (Dev->VirtIo, InDataNumPages, InDataBuffer);
   }
 
-UnmapRequestBuffer:
-  Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, RequestMapping);
-
-FreeScsiRequest:
-  FreePool ((VOID *)Request);
-
   return Status;
 }
 
@@ -940,6 +879,7 @@ VirtioScsiInit (
   UINT16      MaxChannel; // for validation only
   UINT32      NumQueues;  // for validation only
   UINT16      QueueSize;
+  VOID        *SharedHdrBuffer;
 
   //
   // Execute virtio-0.9.5, 2.2.1 Device Initialization Sequence.
@@ -1139,13 +1079,43 @@ VirtioScsiInit (
     goto UnmapQueue;
   }
 
+  //
+  // Allocate the request and response headers and map them with
+  // BusMasterCommonBuffer so that they can be accessed equally by both
+  // processor and device, for all requests.
+  //
+  Status = Dev->VirtIo->AllocateSharedPages (
+                          Dev->VirtIo,
+                          EFI_SIZE_TO_PAGES (sizeof *Dev->SharedHdr),
+                          &SharedHdrBuffer
+                          );
+  if (EFI_ERROR (Status)) {
+    goto UnmapQueue;
+  }
+
+  ZeroMem (SharedHdrBuffer, sizeof *Dev->SharedHdr);
+
+  Status = VirtioMapAllBytesInSharedBuffer (
+             Dev->VirtIo,
+             VirtioOperationBusMasterCommonBuffer,
+             SharedHdrBuffer,
+             sizeof *Dev->SharedHdr,
+             &Dev->SharedHdrAddr,
+             &Dev->SharedHdrMap
+             );
+  if (EFI_ERROR (Status)) {
+    goto FreeSharedHdr;
+  }
+
+  Dev->SharedHdr = SharedHdrBuffer;
+
   //
   // step 6 -- initialization complete
   //
   NextDevStat |= VSTAT_DRIVER_OK;
   Status       = Dev->VirtIo->SetDeviceStatus (Dev->VirtIo, NextDevStat);
   if (EFI_ERROR (Status)) {
-    goto UnmapQueue;
+    goto UnmapSharedHdr;
   }
 
   //
@@ -1181,6 +1151,17 @@ VirtioScsiInit (
 
   return EFI_SUCCESS;
 
+UnmapSharedHdr:
+  Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, Dev->SharedHdrMap);
+  Dev->SharedHdr = NULL;
+
+FreeSharedHdr:
+  Dev->VirtIo->FreeSharedPages (
+                 Dev->VirtIo,
+                 EFI_SIZE_TO_PAGES (sizeof *Dev->SharedHdr),
+                 SharedHdrBuffer
+                 );
+
 UnmapQueue:
   Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, Dev->RingMap);
 
@@ -1222,6 +1203,14 @@ VirtioScsiUninit (
   Dev->MaxLun         = 0;
   Dev->MaxSectors     = 0;
 
+  Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, Dev->SharedHdrMap);
+  Dev->VirtIo->FreeSharedPages (
+                 Dev->VirtIo,
+                 EFI_SIZE_TO_PAGES (sizeof *Dev->SharedHdr),
+                 Dev->SharedHdr
+                 );
+  Dev->SharedHdr = NULL;
+
   Dev->VirtIo->UnmapSharedBuffer (Dev->VirtIo, Dev->RingMap);
   VirtioRingUninit (Dev->VirtIo, &Dev->Ring);
 
@@ -17,6 +17,7 @@
 #include <Protocol/ScsiPassThruExt.h>
 
 #include <IndustryStandard/Virtio.h>
+#include <IndustryStandard/VirtioScsi.h>
 
 //
 // This driver supports 2-byte target identifiers and 4-byte LUN identifiers.
@@ -34,6 +35,16 @@
 
 #define VSCSI_SIG  SIGNATURE_32 ('V', 'S', 'C', 'S')
 
+//
+// The request and response headers of the request in flight. Due to the
+// lock-step progress of VirtioScsiPassThru(), one instance per device is
+// enough, and it is allocated and mapped only once, by VirtioScsiInit().
+//
+typedef struct {
+  VIRTIO_SCSI_REQ     Request;
+  VIRTIO_SCSI_RESP    Response;
+} VSCSI_SHARED_HDR;
+
 typedef struct {
   //
   // Parts of this structure are initialized / torn down in various functions
@@ -53,6 +64,9 @@ typedef struct {
   EFI_EXT_SCSI_PASS_THRU_PROTOCOL    PassThru;       // VirtioScsiInit      1
   EFI_EXT_SCSI_PASS_THRU_MODE        PassThruMode;   // VirtioScsiInit      1
   VOID                               *RingMap;       // VirtioRingMap       2
+  VSCSI_SHARED_HDR                   *SharedHdr;     // VirtioScsiInit      1
+  VOID                               *SharedHdrMap;  // VirtioScsiInit      1
+  EFI_PHYSICAL_ADDRESS               SharedHdrAddr;  // VirtioScsiInit      1
 } VSCSI_DEV;
 
 #define VIRTIO_SCSI_FROM_PASS_THRU(PassThruPointer) \
@@ -46,6 +46,13 @@ EFI_BLOCK_IO_PROTOCOL  gXenPvBlkDxeBlockIo = {
   XenPvBlkDxeBlockIoFlushBlocks             // FlushBlocks
 };
 
+//
+// Number of requests XenPvBlkDxeBlockIoReadWriteBlocks() keeps in flight. It
+// is well below the size of a single-page ring, and bounds the grant
+// references that one transfer holds.
+//
+#define XEN_PV_BLK_MAX_PENDING  8
+
 /**
   Read/Write BufferSize bytes from Lba into Buffer.
 
@@ -73,10 +80,13 @@ XenPvBlkDxeBlockIoReadWriteBlocks (
   IN     BOOLEAN                IsWrite
   )
 {
-  XEN_BLOCK_FRONT_IO  IoData;
-  EFI_BLOCK_IO_MEDIA  *Media = This->Media;
-  UINTN               Sector;
-  EFI_STATUS          Status;
+  XEN_BLOCK_FRONT_IO      IoData[XEN_PV_BLK_MAX_PENDING];
+  XEN_BLOCK_FRONT_DEVICE  *Dev;
+  EFI_BLOCK_IO_MEDIA      *Media = This->Media;
+  UINTN                   Sector;
+  EFI_STATUS              Status;
+  UINTN                   Count;
+  UINTN                   Index;
 
   if (Buffer == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -150,28 +160,56 @@ XenPvBlkDxeBlockIoReadWriteBlocks (
     return Status;
   }
 
-  IoData.Dev = XEN_BLOCK_FRONT_FROM_BLOCK_IO (This);
-  Sector     = (UINTN)MultU64x32 (Lba, Media->BlockSize / 512);
+  Dev    = XEN_BLOCK_FRONT_FROM_BLOCK_IO (This);
+  Sector = (UINTN)MultU64x32 (Lba, Media->BlockSize / 512);
+  Status = EFI_SUCCESS;
 
   while (BufferSize > 0) {
-    if (((UINTN)Buffer & EFI_PAGE_MASK) == 0) {
-      IoData.Size = MIN (
-                      BLKIF_MAX_SEGMENTS_PER_REQUEST * EFI_PAGE_SIZE,
-                      BufferSize
-                      );
-    } else {
-      IoData.Size = MIN (
-                      (BLKIF_MAX_SEGMENTS_PER_REQUEST - 1) * EFI_PAGE_SIZE,
-                      BufferSize
-                      );
+    //
+    // Queue up to XEN_PV_BLK_MAX_PENDING requests, so that the backend can
+    // work on the next ones while the previous ones complete.
+    //
+    for (Count = 0; (Count < XEN_PV_BLK_MAX_PENDING) && (BufferSize > 0); Count++) {
+      if (((UINTN)Buffer & EFI_PAGE_MASK) == 0) {
+        IoData[Count].Size = MIN (
+                               BLKIF_MAX_SEGMENTS_PER_REQUEST * EFI_PAGE_SIZE,
+                               BufferSize
+                               );
+      } else {
+        IoData[Count].Size = MIN (
+                               (BLKIF_MAX_SEGMENTS_PER_REQUEST - 1) * EFI_PAGE_SIZE,
+                               BufferSize
+                               );
+      }
+
+      IoData[Count].Dev    = Dev;
+      IoData[Count].Buffer = Buffer;
+      IoData[Count].Sector = Sector;
+      BufferSize          -= IoData[Count].Size;
+      Buffer               = (VOID *)((UINTN)Buffer + IoData[Count].Size);
+      Sector              += IoData[Count].Size / 512;
+
+      //
+      // Status value that correspond to an IO in progress.
+      //
+      IoData[Count].Status = EFI_ALREADY_STARTED;
+      XenPvBlockAsyncIo (&IoData[Count], IsWrite);
+    }
+
+    //
+    // The requests refer to IoData, so wait for all of them, even after an
+    // error.
+    //
+    for (Index = 0; Index < Count; Index++) {
+      while (IoData[Index].Status == EFI_ALREADY_STARTED) {
+        XenPvBlockAsyncIoPoll (Dev);
+      }
+
+      if (EFI_ERROR (IoData[Index].Status)) {
+        Status = IoData[Index].Status;
+      }
     }
 
-    IoData.Buffer = Buffer;
-    IoData.Sector = Sector;
-    BufferSize   -= IoData.Size;
-    Buffer        = (VOID *)((UINTN)Buffer + IoData.Size);
-    Sector       += IoData.Size / 512;
-    Status        = XenPvBlockIo (&IoData, IsWrite);
     if (EFI_ERROR (Status)) {
       DEBUG ((
         DEBUG_ERROR,
@@ -10,6 +10,7 @@
 #include <Library/BaseLib.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
 #include <Library/PrmContextBufferLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Protocol/PrmConfig.h>
@@ -127,16 +128,21 @@ GetModuleContextBuffers (
             ));
 
           *PrmModuleContextBuffers = &PrmConfigProtocol->ModuleContextBuffers;
-          return EFI_SUCCESS;
+          break;
         }
       } else {
         Status = FindContextBufferInModuleBuffers (Guid, &PrmConfigProtocol->ModuleContextBuffers, &PrmContextBuffer);
         if (!EFI_ERROR (Status)) {
           *PrmModuleContextBuffers = &PrmConfigProtocol->ModuleContextBuffers;
-          return EFI_SUCCESS;
+          break;
         }
       }
     }
+
+    FreePool (HandleBuffer);
+    if (*PrmModuleContextBuffers != NULL) {
+      return EFI_SUCCESS;
+    }
   }
 
   DEBUG ((
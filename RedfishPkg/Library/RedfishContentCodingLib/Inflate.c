@@ -0,0 +1,597 @@
+/** @file
+  Decoder of the DEFLATE compressed data format, as described in RFC 1951.
+
+  The decoder works on a complete compressed stream in memory, which is how
+  the Redfish payloads are received. Huffman codes are decoded canonically
+  from the count of codes of each length, which needs no decoding tables.
+
+  Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "RedfishContentCodingInternal.h"
+
+#define INFLATE_MAX_BITS              15
+#define INFLATE_MAX_LITERAL_LENGTH    286
+#define INFLATE_MAX_DISTANCE          30
+#define INFLATE_FIXED_LITERAL_LENGTH  288
+#define INFLATE_CODE_LENGTH_CODES     19
+#define INFLATE_END_OF_BLOCK          256
+#define INFLATE_LENGTH_CODES          29
+
+typedef struct {
+  //
+  // Number of symbols of each code length.
+  //
+  UINT16    Count[INFLATE_MAX_BITS + 1];
+  //
+  // Symbols ordered by their code.
+  //
+  UINT16    Symbol[INFLATE_FIXED_LITERAL_LENGTH];
+} INFLATE_HUFFMAN;
+
+typedef struct {
+  CONST UINT8    *Input;
+  UINTN          InputLength;
+  UINTN          InputPosition;
+  UINT32         BitBuffer;
+  UINTN          BitCount;
+  //
+  // Set when the compressed data ends before the decoder is done.
+  //
+  BOOLEAN        Truncated;
+  UINT8          *Output;
+  UINTN          OutputSize;
+  UINTN          OutputLength;
+} INFLATE_STATE;
+
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT16  mInflateLengthBase[INFLATE_LENGTH_CODES] = {
+  3,  4,  5,  6,  7,  8,  9,  10, 11, 13, 15, 17, 19, 23, 27,
+  31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  mInflateLengthExtra[INFLATE_LENGTH_CODES] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+  2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT16  mInflateDistanceBase[INFLATE_MAX_DISTANCE] = {
+  1,    2,    3,    4,    5,    7,     9,     13,    17,    25,
+  33,   49,   65,   97,   129,  193,   257,   385,   513,   769,
+  1025, 1537, 2049, 3073, 4097, 6145,  8193,  12289, 16385, 24577
+};
+
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  mInflateDistanceExtra[INFLATE_MAX_DISTANCE] = {
+  0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+  6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  mInflateCodeLengthOrder[INFLATE_CODE_LENGTH_CODES] = {
+  16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+};
+
+/**
+  Read bits from the compressed data, least significant bit first.
+
+  Past the end of the compressed data, zero bits are returned and the state
+  is marked as truncated.
+
+  @param[in, out]  State     The decoder state.
+  @param[in]       BitCount  Number of bits to read, at most 16.
+
+  @return The bits read.
+
+**/
+UINT32
+InflateGetBits (
+  IN OUT INFLATE_STATE  *State,
+  IN     UINTN          BitCount
+  )
+{
+  UINT32  Value;
+
+  while (State->BitCount < BitCount) {
+    if (State->InputPosition >= State->InputLength) {
+      State->Truncated = TRUE;
+      return 0;
+    }
+
+    State->BitBuffer |= (UINT32)State->Input[State->InputPosition++] << State->BitCount;
+    State->BitCount  += 8;
+  }
+
+  Value              = State->BitBuffer & ((1U << BitCount) - 1);
+  State->BitBuffer >>= BitCount;
+  State->BitCount   -= BitCount;
+
+  return Value;
+}
+
+/**
+  Make room in the output buffer for more decoded bytes.
+
+  @param[in, out]  State     The decoder state.
+  @param[in]       Length    Number of bytes to make room for.
+
+  @retval EFI_SUCCESS           There is room for Length more bytes.
+  @retval EFI_OUT_OF_RESOURCES  No memory for the decoded data.
+
+**/
+EFI_STATUS
+InflateReserveOutput (
+  IN OUT INFLATE_STATE  *State,
+  IN     UINTN          Length
+  )
+{
+  UINTN  NewSize;
+  UINT8  *NewOutput;
+
+  if (State->OutputSize - State->OutputLength >= Length) {
+    return EFI_SUCCESS;
+  }
+
+  if ((State->OutputSize > MAX_UINTN / 2) || (State->OutputLength > MAX_UINTN - Length)) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  NewSize = MAX (State->OutputSize * 2, State->OutputLength + Length);
+
+  NewOutput = ReallocatePool (State->OutputSize, NewSize, State->Output);
+  if (NewOutput == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  State->Output     = NewOutput;
+  State->OutputSize = NewSize;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Build a canonical Huffman code from the code lengths of its symbols.
+
+  @param[out]  Huffman       The Huffman code.
+  @param[in]   Lengths       The code length of each symbol. 0 means the
+                             symbol is not used.
+  @param[in]   SymbolCount   Number of symbols.
+
+  @retval 0            The code is complete.
+  @retval < 0          The code is over-subscribed, so it is invalid.
+  @retval > 0          The code is incomplete.
+
+**/
+INTN
+InflateBuildHuffman (
+  OUT INFLATE_HUFFMAN  *Huffman,
+  IN  CONST UINT8      *Lengths,
+  IN  UINTN            SymbolCount
+  )
+{
+  UINT16  Offset[INFLATE_MAX_BITS + 1];
+  UINTN   Symbol;
+  UINTN   Length;
+  INTN    Left;
+
+  ZeroMem (Huffman->Count, sizeof (Huffman->Count));
+  for (Symbol = 0; Symbol < SymbolCount; Symbol++) {
+    Huffman->Count[Lengths[Symbol]]++;
+  }
+
+  if (Huffman->Count[0] == SymbolCount) {
+    return 0;
+  }
+
+  Left = 1;
+  for (Length = 1; Length <= INFLATE_MAX_BITS; Length++) {
+    Left <<= 1;
+    Left  -= Huffman->Count[Length];
+    if (Left < 0) {
+      return Left;
+    }
+  }
+
+  Offset[1] = 0;
+  for (Length = 1; Length < INFLATE_MAX_BITS; Length++) {
+    Offset[Length + 1] = Offset[Length] + Huffman->Count[Length];
+  }
+
+  for (Symbol = 0; Symbol < SymbolCount; Symbol++) {
+    if (Lengths[Symbol] != 0) {
+      Huffman->Symbol[Offset[Lengths[Symbol]]++] = (UINT16)Symbol;
+    }
+  }
+
+  return Left;
+}
+
+/**
+  Decode one symbol of a Huffman code from the compressed data.
+
+  @param[in, out]  State     The decoder state.
+  @param[in]       Huffman   The Huffman code.
+
+  @return The symbol, or -1 when the compressed data holds no valid code.
+
+**/
+INTN
+InflateDecodeSymbol (
+  IN OUT INFLATE_STATE          *State,
+  IN     CONST INFLATE_HUFFMAN  *Huffman
+  )
+{
+  INTN   Code;
+  INTN   First;
+  INTN   Index;
+  INTN   Count;
+  UINTN  Length;
+
+  Code  = 0;
+  First = 0;
+  Index = 0;
+  for (Length = 1; Length <= INFLATE_MAX_BITS; Length++) {
+    Code |= (INTN)InflateGetBits (State, 1);
+    Count = Huffman->Count[Length];
+    if (Code - Count < First) {
+      return Huffman->Symbol[Index + (Code - First)];
+    }
+
+    Index  += Count;
+    First  += Count;
+    First <<= 1;
+    Code  <<= 1;
+  }
+
+  return -1;
+}
+
+/**
+  Decode a stored block, whose data is not compressed.
+
+  @param[in, out]  State     The decoder state.
+
+  @retval EFI_SUCCESS              The block is decoded.
+  @retval EFI_VOLUME_CORRUPTED     The block is malformed.
+  @retval EFI_OUT_OF_RESOURCES     No memory for the decoded data.
+
+**/
+EFI_STATUS
+InflateStoredBlock (
+  IN OUT INFLATE_STATE  *State
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       Length;
+
+  //
+  // The block starts at the next byte boundary.
+  //
+  State->BitBuffer = 0;
+  State->BitCount  = 0;
+
+  if (State->InputLength - State->InputPosition < 4) {
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  Length = State->Input[State->InputPosition] | (State->Input[State->InputPosition + 1] << 8);
+  if ((Length ^ 0xFFFF) != (UINTN)(State->Input[State->InputPosition + 2] | (State->Input[State->InputPosition + 3] << 8))) {
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  State->InputPosition += 4;
+  if (State->InputLength - State->InputPosition < Length) {
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  Status = InflateReserveOutput (State, Length);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  CopyMem (State->Output + State->OutputLength, State->Input + State->InputPosition, Length);
+  State->OutputLength  += Length;
+  State->InputPosition += Length;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Decode the literals and the length and distance pairs of a compressed
+  block, up to the end of the block.
+
+  @param[in, out]  State           The decoder state.
+  @param[in]       LiteralLength   The literal and length Huffman code.
+  @param[in]       Distance        The distance Huffman code.
+
+  @retval EFI_SUCCESS              The block is decoded.
+  @retval EFI_VOLUME_CORRUPTED     The block is malformed.
+  @retval EFI_OUT_OF_RESOURCES     No memory for the decoded data.
+
+**/
+EFI_STATUS
+InflateCodes (
+  IN OUT INFLATE_STATE          *State,
+  IN     CONST INFLATE_HUFFMAN  *LiteralLength,
+  IN     CONST INFLATE_HUFFMAN  *Distance
+  )
+{
+  EFI_STATUS  Status;
+  INTN        Symbol;
+  UINTN       Length;
+  UINTN       Offset;
+  UINT8       *Source;
+  UINT8       *Destination;
+
+  while (TRUE) {
+    Symbol = InflateDecodeSymbol (State, LiteralLength);
+    if ((Symbol < 0) || State->Truncated) {
+      return EFI_VOLUME_CORRUPTED;
+    }
+
+    if (Symbol < INFLATE_END_OF_BLOCK) {
+      Status = InflateReserveOutput (State, 1);
+      if (EFI_ERROR (Status)) {
+        return Status;
+      }
+
+      State->Output[State->OutputLength++] = (UINT8)Symbol;
+      continue;
+    }
+
+    if (Symbol == INFLATE_END_OF_BLOCK) {
+      return EFI_SUCCESS;
+    }
+
+    Symbol -= INFLATE_END_OF_BLOCK + 1;
+    if (Symbol >= INFLATE_LENGTH_CODES) {
+      return EFI_VOLUME_CORRUPTED;
+    }
+
+    Length = mInflateLengthBase[Symbol] + InflateGetBits (State, mInflateLengthExtra[Symbol]);
+
+    Symbol = InflateDecodeSymbol (State, Distance);
+    if ((Symbol < 0) || (Symbol >= INFLATE_MAX_DISTANCE)) {
+      return EFI_VOLUME_CORRUPTED;
+    }
+
+    Offset = mInflateDistanceBase[Symbol] + InflateGetBits (State, mInflateDistanceExtra[Symbol]);
+    if (State->Truncated || (Offset > State->OutputLength)) {
+      return EFI_VOLUME_CORRUPTED;
+    }
+
+    Status = InflateReserveOutput (State, Length);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    //
+    // The source and the destination may overlap, to repeat the last Offset
+    // bytes, so copy one byte at a time.
+    //
+    Destination          = State->Output + State->OutputLength;
+    Source               = Destination - Offset;
+    State->OutputLength += Length;
+    while (Length-- > 0) {
+      *Destination++ = *Source++;
+    }
+  }
+}
+
+/**
+  Decode a block compressed with the fixed Huffman codes.
+
+  @param[in, out]  State     The decoder state.
+
+  @retval EFI_SUCCESS              The block is decoded.
+  @retval EFI_VOLUME_CORRUPTED     The block is malformed.
+  @retval EFI_OUT_OF_RESOURCES     No memory for the decoded data.
+
+**/
+EFI_STATUS
+InflateFixedBlock (
+  IN OUT INFLATE_STATE  *State
+  )
+{
+  INFLATE_HUFFMAN  LiteralLength;
+  INFLATE_HUFFMAN  Distance;
+  UINT8            Lengths[INFLATE_FIXED_LITERAL_LENGTH];
+
+  SetMem (Lengths, 144, 8);
+  SetMem (Lengths + 144, 256 - 144, 9);
+  SetMem (Lengths + 256, 280 - 256, 7);
+  SetMem (Lengths + 280, INFLATE_FIXED_LITERAL_LENGTH - 280, 8);
+  InflateBuildHuffman (&LiteralLength, Lengths, INFLATE_FIXED_LITERAL_LENGTH);
+
+  SetMem (Lengths, INFLATE_MAX_DISTANCE, 5);
+  InflateBuildHuffman (&Distance, Lengths, INFLATE_MAX_DISTANCE);
+
+  return InflateCodes (State, &LiteralLength, &Distance);
+}
+
+/**
+  Decode a block compressed with the Huffman codes described in the block.
+
+  @param[in, out]  State     The decoder state.
+
+  @retval EFI_SUCCESS              The block is decoded.
+  @retval EFI_VOLUME_CORRUPTED     The block is malformed.
+  @retval EFI_OUT_OF_RESOURCES     No memory for the decoded data.
+
+**/
+EFI_STATUS
+InflateDynamicBlock (
+  IN OUT INFLATE_STATE  *State
+  )
+{
+  INFLATE_HUFFMAN  LiteralLength;
+  INFLATE_HUFFMAN  Distance;
+  UINT8            Lengths[INFLATE_MAX_LITERAL_LENGTH + INFLATE_MAX_DISTANCE];
+  UINTN            LiteralLengthCount;
+  UINTN            DistanceCount;
+  UINTN            CodeLengthCount;
+  UINTN            Index;
+  UINTN            Repeat;
+  UINT8            RepeatLength;
+  INTN             Symbol;
+  INTN             Left;
+
+  LiteralLengthCount = InflateGetBits (State, 5) + 257;
+  DistanceCount      = InflateGetBits (State, 5) + 1;
+  CodeLengthCount    = InflateGetBits (State, 4) + 4;
+  if ((LiteralLengthCount > INFLATE_MAX_LITERAL_LENGTH) || (DistanceCount > INFLATE_MAX_DISTANCE)) {
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  //
+  // Read the code lengths of the code that describes the code lengths of
+  // the literal and length code and of the distance code.
+  //
+  ZeroMem (Lengths, INFLATE_CODE_LENGTH_CODES);
+  for (Index = 0; Index < CodeLengthCount; Index++) {
+    Lengths[mInflateCodeLengthOrder[Index]] = (UINT8)InflateGetBits (State, 3);
+  }
+
+  if ((InflateBuildHuffman (&LiteralLength, Lengths, INFLATE_CODE_LENGTH_CODES) != 0) || State->Truncated) {
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  Index = 0;
+  while (Index < LiteralLengthCount + DistanceCount) {
+    Symbol = InflateDecodeSymbol (State, &LiteralLength);
+    if ((Symbol < 0) || State->Truncated) {
+      return EFI_VOLUME_CORRUPTED;
+    }
+
+    if (Symbol < 16) {
+      Lengths[Index++] = (UINT8)Symbol;
+      continue;
+    }
+
+    RepeatLength = 0;
+    if (Symbol == 16) {
+      if (Index == 0) {
+        return EFI_VOLUME_CORRUPTED;
+      }
+
+      RepeatLength = Lengths[Index - 1];
+      Repeat       = 3 + InflateGetBits (State, 2);
+    } else if (Symbol == 17) {
+      Repeat = 3 + InflateGetBits (State, 3);
+    } else {
+      Repeat = 11 + InflateGetBits (State, 7);
+    }
+
+    if (Index + Repeat > LiteralLengthCount + DistanceCount) {
+      return EFI_VOLUME_CORRUPTED;
+    }
+
+    SetMem (Lengths + Index, Repeat, RepeatLength);
+    Index += Repeat;
+  }
+
+  //
+  // A block without an end-of-block code cannot end.
+  //
+  if (Lengths[INFLATE_END_OF_BLOCK] == 0) {
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  //
+  // Incomplete codes are only allowed when they have a single code.
+  //
+  Left = InflateBuildHuffman (&LiteralLength, Lengths, LiteralLengthCount);
+  if ((Left < 0) || ((Left > 0) && (LiteralLengthCount - LiteralLength.Count[0] != 1))) {
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  Left = InflateBuildHuffman (&Distance, Lengths + LiteralLengthCount, DistanceCount);
+  if ((Left < 0) || ((Left > 0) && (DistanceCount - Distance.Count[0] != 1))) {
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  return InflateCodes (State, &LiteralLength, &Distance);
+}
+
+/**
+  Decode data in the DEFLATE compressed data format, as described in RFC 1951.
+
+  @param[in]   Input           The compressed data.
+  @param[in]   InputLength     The length of the compressed data.
+  @param[in]   OutputSizeHint  The expected length of the decoded data, or 0
+                               if it is not known.
+  @param[out]  Output          Pointer to receive the decoded data. It must be
+                               freed by the caller with FreePool().
+  @param[out]  OutputLength    Length of the decoded data.
+  @param[out]  ConsumedLength  Number of bytes of Input the compressed data
+                               takes up.
+
+  @retval EFI_SUCCESS              The data is decoded.
+  @retval EFI_VOLUME_CORRUPTED     The compressed data is malformed.
+  @retval EFI_OUT_OF_RESOURCES     No memory for the decoded data.
+
+**/
+EFI_STATUS
+InflateData (
+  IN  CONST UINT8  *Input,
+  IN  UINTN        InputLength,
+  IN  UINTN        OutputSizeHint,
+  OUT UINT8        **Output,
+  OUT UINTN        *OutputLength,
+  OUT UINTN        *ConsumedLength
+  )
+{
+  EFI_STATUS     Status;
+  INFLATE_STATE  State;
+  BOOLEAN        LastBlock;
+
+  ZeroMem (&State, sizeof (State));
+  State.Input       = Input;
+  State.InputLength = InputLength;
+
+  if (OutputSizeHint == 0) {
+    OutputSizeHint = (InputLength < MAX_UINTN / INFLATE_INITIAL_RATIO) ? InputLength * INFLATE_INITIAL_RATIO : InputLength;
+  }
+
+  State.OutputSize = MAX (OutputSizeHint, 1);
+  State.Output     = AllocatePool (State.OutputSize);
+  if (State.Output == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  do {
+    LastBlock = (BOOLEAN)(InflateGetBits (&State, 1) == 1);
+    switch (InflateGetBits (&State, 2)) {
+      case 0:
+        Status = InflateStoredBlock (&State);
+        break;
+
+      case 1:
+        Status = InflateFixedBlock (&State);
+        break;
+
+      case 2:
+        Status = InflateDynamicBlock (&State);
+        break;
+
+      default:
+        Status = EFI_VOLUME_CORRUPTED;
+        break;
+    }
+
+    if (!EFI_ERROR (Status) && State.Truncated) {
+      Status = EFI_VOLUME_CORRUPTED;
+    }
+
+    if (EFI_ERROR (Status)) {
+      FreePool (State.Output);
+      return Status;
+    }
+  } while (!LastBlock);
+
+  *Output         = State.Output;
+  *OutputLength   = State.OutputLength;
+  *ConsumedLength = State.InputPosition;
+
+  return EFI_SUCCESS;
+}
@@ -0,0 +1,56 @@
+/** @file
+  Internal definitions of RedfishContentCodingLib.
+
+  Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef REDFISH_CONTENT_CODING_INTERNAL_H_
+#define REDFISH_CONTENT_CODING_INTERNAL_H_
+
+#include <Uefi.h>
+#include <IndustryStandard/Http11.h>
+
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/RedfishContentCodingLib.h>
+
+//
+// The output buffer of the decoder starts with this many times the size of
+// the compressed data, when the size of the decoded data is not known.
+//
+#define INFLATE_INITIAL_RATIO  4
+
+/**
+  Decode data in the DEFLATE compressed data format, as described in RFC 1951.
+
+  @param[in]   Input           The compressed data.
+  @param[in]   InputLength     The length of the compressed data.
+  @param[in]   OutputSizeHint  The expected length of the decoded data, or 0
+                               if it is not known.
+  @param[out]  Output          Pointer to receive the decoded data. It must be
+                               freed by the caller with FreePool().
+  @param[out]  OutputLength    Length of the decoded data.
+  @param[out]  ConsumedLength  Number of bytes of Input the compressed data
+                               takes up.
+
+  @retval EFI_SUCCESS              The data is decoded.
+  @retval EFI_VOLUME_CORRUPTED     The compressed data is malformed.
+  @retval EFI_OUT_OF_RESOURCES     No memory for the decoded data.
+
+**/
+EFI_STATUS
+InflateData (
+  IN  CONST UINT8  *Input,
+  IN  UINTN        InputLength,
+  IN  UINTN        OutputSizeHint,
+  OUT UINT8        **Output,
+  OUT UINTN        *OutputLength,
+  OUT UINTN        *ConsumedLength
+  );
+
+#endif
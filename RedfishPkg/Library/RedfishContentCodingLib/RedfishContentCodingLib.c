@@ -0,0 +1,351 @@
+/** @file
+  RedfishContentCodingLib instance that decodes the gzip and deflate content
+  codings of HTTP, as described in RFC 1952 and RFC 1950.
+
+  Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "RedfishContentCodingInternal.h"
+
+#define GZIP_HEADER_SIZE    10
+#define GZIP_TRAILER_SIZE   8
+#define GZIP_ID1            0x1F
+#define GZIP_ID2            0x8B
+#define GZIP_CM_DEFLATE     8
+#define GZIP_FLAG_FHCRC     BIT1
+#define GZIP_FLAG_FEXTRA    BIT2
+#define GZIP_FLAG_FNAME     BIT3
+#define GZIP_FLAG_FCOMMENT  BIT4
+
+#define ZLIB_HEADER_SIZE   2
+#define ZLIB_TRAILER_SIZE  4
+#define ZLIB_CM_DEFLATE    8
+#define ZLIB_FLAG_FDICT    BIT5
+#define ZLIB_ADLER32_BASE  65521
+
+/**
+  Skip a zero-terminated string of a gzip header.
+
+  @param[in]       Content        The gzip data.
+  @param[in]       ContentLength  The length of the gzip data.
+  @param[in, out]  Position       On input, the position of the string. On
+                                  output, the position after its terminator.
+
+  @retval EFI_SUCCESS              The string is skipped.
+  @retval EFI_VOLUME_CORRUPTED     The string has no terminator.
+
+**/
+EFI_STATUS
+GzipSkipString (
+  IN     CONST UINT8  *Content,
+  IN     UINTN        ContentLength,
+  IN OUT UINTN        *Position
+  )
+{
+  while (*Position < ContentLength) {
+    if (Content[(*Position)++] == 0) {
+      return EFI_SUCCESS;
+    }
+  }
+
+  return EFI_VOLUME_CORRUPTED;
+}
+
+/**
+  Decode data in the gzip file format, as described in RFC 1952.
+
+  @param[in]   Content         The gzip data.
+  @param[in]   ContentLength   The length of the gzip data.
+  @param[out]  Decoded         Pointer to receive the decoded data.
+  @param[out]  DecodedLength   Length of the decoded data.
+
+  @retval EFI_SUCCESS              The data is decoded.
+  @retval EFI_VOLUME_CORRUPTED     The gzip data is malformed.
+  @retval EFI_CRC_ERROR            The decoded data does not match its CRC.
+  @retval EFI_OUT_OF_RESOURCES     No memory for the decoded data.
+
+**/
+EFI_STATUS
+GzipDecode (
+  IN  CONST UINT8  *Content,
+  IN  UINTN        ContentLength,
+  OUT UINT8        **Decoded,
+  OUT UINTN        *DecodedLength
+  )
+{
+  EFI_STATUS   Status;
+  UINTN        Position;
+  UINTN        Consumed;
+  UINT8        Flags;
+  CONST UINT8  *Trailer;
+  UINT32       Size;
+
+  if ((ContentLength < GZIP_HEADER_SIZE + GZIP_TRAILER_SIZE) ||
+      (Content[0] != GZIP_ID1) || (Content[1] != GZIP_ID2) || (Content[2] != GZIP_CM_DEFLATE))
+  {
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  Flags    = Content[3];
+  Position = GZIP_HEADER_SIZE;
+  if ((Flags & GZIP_FLAG_FEXTRA) != 0) {
+    if (ContentLength - Position < 2) {
+      return EFI_VOLUME_CORRUPTED;
+    }
+
+    Position += 2 + (Content[Position] | (Content[Position + 1] << 8));
+    if (Position > ContentLength) {
+      return EFI_VOLUME_CORRUPTED;
+    }
+  }
+
+  if ((Flags & GZIP_FLAG_FNAME) != 0) {
+    Status = GzipSkipString (Content, ContentLength, &Position);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
+
+  if ((Flags & GZIP_FLAG_FCOMMENT) != 0) {
+    Status = GzipSkipString (Content, ContentLength, &Position);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
+
+  if ((Flags & GZIP_FLAG_FHCRC) != 0) {
+    Position += 2;
+  }
+
+  if ((Position > ContentLength) || (ContentLength - Position < GZIP_TRAILER_SIZE)) {
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  //
+  // ISIZE is the length of the decoded data modulo 2^32, which is a good
+  // guess of the size of the output buffer.
+  //
+  Size   = ReadUnaligned32 ((UINT32 *)(Content + ContentLength - 4));
+  Status = InflateData (
+             Content + Position,
+             ContentLength - Position - GZIP_TRAILER_SIZE,
+             Size,
+             Decoded,
+             DecodedLength,
+             &Consumed
+             );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Trailer = Content + Position + Consumed;
+  if ((ReadUnaligned32 ((UINT32 *)Trailer) != CalculateCrc32 (*Decoded, *DecodedLength)) ||
+      (ReadUnaligned32 ((UINT32 *)(Trailer + 4)) != (UINT32)*DecodedLength))
+  {
+    FreePool (*Decoded);
+    *Decoded = NULL;
+    return EFI_CRC_ERROR;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Calculate the Adler-32 checksum of data, as described in RFC 1950.
+
+  @param[in]  Data        The data.
+  @param[in]  DataLength  The length of the data.
+
+  @return The Adler-32 checksum.
+
+**/
+UINT32
+CalculateAdler32 (
+  IN CONST UINT8  *Data,
+  IN UINTN        DataLength
+  )
+{
+  UINT32  Sum1;
+  UINT32  Sum2;
+  UINTN   Chunk;
+
+  Sum1 = 1;
+  Sum2 = 0;
+  while (DataLength > 0) {
+    //
+    // 5552 bytes is the most that can be summed before Sum2 overflows.
+    //
+    Chunk       = MIN (DataLength, 5552);
+    DataLength -= Chunk;
+    while (Chunk-- > 0) {
+      Sum1 += *Data++;
+      Sum2 += Sum1;
+    }
+
+    Sum1 %= ZLIB_ADLER32_BASE;
+    Sum2 %= ZLIB_ADLER32_BASE;
+  }
+
+  return (Sum2 << 16) | Sum1;
+}
+
+/**
+  Decode data of the deflate content coding.
+
+  The content coding is the zlib format of RFC 1950, but some servers send the
+  raw DEFLATE data of RFC 1951 instead. Both are accepted.
+
+  @param[in]   Content         The deflate data.
+  @param[in]   ContentLength   The length of the deflate data.
+  @param[out]  Decoded         Pointer to receive the decoded data.
+  @param[out]  DecodedLength   Length of the decoded data.
+
+  @retval EFI_SUCCESS              The data is decoded.
+  @retval EFI_VOLUME_CORRUPTED     The deflate data is malformed.
+  @retval EFI_CRC_ERROR            The decoded data does not match its checksum.
+  @retval EFI_OUT_OF_RESOURCES     No memory for the decoded data.
+
+**/
+EFI_STATUS
+DeflateDecode (
+  IN  CONST UINT8  *Content,
+  IN  UINTN        ContentLength,
+  OUT UINT8        **Decoded,
+  OUT UINTN        *DecodedLength
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       Consumed;
+  UINT32      Adler32;
+
+  if ((ContentLength < ZLIB_HEADER_SIZE + ZLIB_TRAILER_SIZE) ||
+      ((Content[0] & 0x0F) != ZLIB_CM_DEFLATE) || ((Content[0] >> 4) > 7) ||
+      ((Content[1] & ZLIB_FLAG_FDICT) != 0) || ((((UINTN)Content[0] << 8) | Content[1]) % 31 != 0))
+  {
+    return InflateData (Content, ContentLength, 0, Decoded, DecodedLength, &Consumed);
+  }
+
+  Status = InflateData (
+             Content + ZLIB_HEADER_SIZE,
+             ContentLength - ZLIB_HEADER_SIZE - ZLIB_TRAILER_SIZE,
+             0,
+             Decoded,
+             DecodedLength,
+             &Consumed
+             );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Adler32 = SwapBytes32 (ReadUnaligned32 ((UINT32 *)(Content + ZLIB_HEADER_SIZE + Consumed)));
+  if (Adler32 != CalculateAdler32 (*Decoded, *DecodedLength)) {
+    FreePool (*Decoded);
+    *Decoded = NULL;
+    return EFI_CRC_ERROR;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  This is the function to encode the content use the
+  algorithm indicated in ContentEncodedValue. The naming of
+  ContentEncodedValue is follow HTTP spec or could be a
+  platform-specific value.
+
+  Encoding is not supported by this instance. Request content is small, so
+  callers send it with the identity coding instead.
+
+  @param[in]   ContentEncodedValue   HTTP conent encoded value.
+  @param[in]   OriginalContent       Original content.
+  @param[in]   OriginalContentLength The length of original content.
+  @param[out]  EncodedContentPointer Pointer to receive the encoded content pointer.
+  @param[out]  EncodedContentLength  Length of encoded content.
+
+  @retval EFI_UNSUPPORTED          No supported encoding funciton,
+
+**/
+EFI_STATUS
+RedfishContentEncode  (
+  IN CHAR8   *ContentEncodedValue,
+  IN CHAR8   *OriginalContent,
+  IN UINTN   OriginalContentLength,
+  OUT VOID   **EncodedContentPointer,
+  OUT UINTN  *EncodedLength
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+/**
+  This is the function to decode the content use the
+  algorithm indicated in ContentEncodedValue. The naming of
+  ContentEncodedValue is follow HTTP spec or could be a
+  platform-specific value.
+
+  @param[in]   ContentDecodedValue   HTTP conent decoded value.
+                                     The value could be one of below.
+                                       - HTTP_CONTENT_ENCODING_IDENTITY "identity"
+                                       - HTTP_CONTENT_ENCODING_GZIP     "gzip"
+                                       - HTTP_CONTENT_ENCODING_DEFLATE  "deflate"
+  @param[in]   ContentPointer        Original content.
+  @param[in]   ContentLength         The length of original content.
+  @param[out]  DecodedContentPointer Pointer to receive decoded content pointer.
+                                     It must be freed by the caller with FreePool().
+  @param[out]  DecodedContentLength  Length of decoded content.
+
+  @retval EFI_SUCCESS              Content is decoded successfully.
+  @retval EFI_UNSUPPORTED          No supported decoding funciton,
+  @retval EFI_INVALID_PARAMETER    One of the given parameter is invalid.
+  @retval EFI_VOLUME_CORRUPTED     The content is malformed.
+  @retval EFI_CRC_ERROR            The decoded content does not match its checksum.
+  @retval EFI_OUT_OF_RESOURCES     No memory for the decoded content.
+
+**/
+EFI_STATUS
+RedfishContentDecode (
+  IN CHAR8   *ContentEncodedValue,
+  IN VOID    *ContentPointer,
+  IN UINTN   ContentLength,
+  OUT VOID   **DecodedContentPointer,
+  OUT UINTN  *DecodedLength
+  )
+{
+  EFI_STATUS  Status;
+  UINT8       *Decoded;
+
+  if ((ContentEncodedValue == NULL) || (ContentPointer == NULL) ||
+      (DecodedContentPointer == NULL) || (DecodedLength == NULL))
+  {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Decoded = NULL;
+  if (AsciiStriCmp (ContentEncodedValue, HTTP_CONTENT_ENCODING_IDENTITY) == 0) {
+    Decoded = AllocateCopyPool (ContentLength, ContentPointer);
+    if (Decoded == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    *DecodedLength = ContentLength;
+    Status         = EFI_SUCCESS;
+  } else if (AsciiStriCmp (ContentEncodedValue, HTTP_CONTENT_ENCODING_GZIP) == 0) {
+    Status = GzipDecode (ContentPointer, ContentLength, &Decoded, DecodedLength);
+  } else if (AsciiStriCmp (ContentEncodedValue, HTTP_CONTENT_ENCODING_DEFLATE) == 0) {
+    Status = DeflateDecode (ContentPointer, ContentLength, &Decoded, DecodedLength);
+  } else {
+    return EFI_UNSUPPORTED;
+  }
+
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a: Failed to decode %a content: %r\n", __func__, ContentEncodedValue, Status));
+    return Status;
+  }
+
+  *DecodedContentPointer = Decoded;
+
+  return EFI_SUCCESS;
+}
@@ -189,11 +189,15 @@ ReleaseRedfishPayload (
 }
 
 /**
-  This function creat new payload. Server and JsonObj are
-  copied to newly created payload.
+  This function creat new payload. Server is copied to newly
+  created payload. JsonValue is either copied, or shared with the
+  caller by taking a reference to it.
 
   @param[in]  Service          Pointer to Service instance.
   @param[in]  JsonValue        Pointer to JSON value.
+  @param[in]  CopyJsonValue    TRUE to copy JsonValue. FALSE to take a
+                               reference to JsonValue, for a caller which
+                               does not use JsonValue after releasing it.
 
   @retval     REDFISH_PAYLOAD_PRIVATE  Newly created payload.
   @retval     NULL                     Error occurs.
@@ -202,7 +206,8 @@ ReleaseRedfishPayload (
 REDFISH_PAYLOAD_PRIVATE *
 CreateRedfishPayload (
   IN REDFISH_SERVICE_PRIVATE  *Service,
-  IN EDKII_JSON_VALUE         JsonValue
+  IN EDKII_JSON_VALUE         JsonValue,
+  IN BOOLEAN                  CopyJsonValue
   )
 {
   REDFISH_PAYLOAD_PRIVATE  *NewPayload;
@@ -222,7 +227,12 @@ CreateRedfishPayload (
     goto ON_ERROR;
   }
 
-  NewPayload->JsonValue = JsonValueClone (JsonValue);
+  if (CopyJsonValue) {
+    NewPayload->JsonValue = JsonValueClone (JsonValue);
+  } else {
+    NewPayload->JsonValue = JsonIncreaseReference (JsonValue);
+  }
+
   if (NewPayload->JsonValue == NULL) {
     goto ON_ERROR;
   }
@@ -308,7 +318,7 @@ CopyRedfishResponse (
       goto ON_ERROR;
     }
 
-    DstResponse->Payload = CreateRedfishPayload (Payload->Service, Payload->JsonValue);
+    DstResponse->Payload = CreateRedfishPayload (Payload->Service, Payload->JsonValue, TRUE);
     if (DstResponse->Payload  == NULL) {
       goto ON_ERROR;
     }
@@ -481,6 +491,79 @@ FindHttpCacheData (
   return NULL;
 }
 
+/**
+  Build the request to get the resource of a cached response only when it
+  has changed on Redfish service since, by the entity tag of the response.
+
+  @param[in]    CacheData           The cached response of the resource.
+  @param[in]    Request             Additional request context from caller.
+                                    This is optional.
+  @param[out]   ConditionalRequest  The conditional request. Caller releases
+                                    ConditionalRequest->Headers by FreePool().
+
+  @retval EFI_SUCCESS           The conditional request is built.
+  @retval EFI_NOT_FOUND         The cached response has no entity tag, or
+                                caller's request is conditional already.
+  @retval EFI_OUT_OF_RESOURCES  No memory available.
+
+**/
+EFI_STATUS
+BuildConditionalRequest (
+  IN  REDFISH_HTTP_CACHE_DATA  *CacheData,
+  IN  REDFISH_REQUEST          *Request OPTIONAL,
+  OUT REDFISH_REQUEST          *ConditionalRequest
+  )
+{
+  EFI_HTTP_HEADER  *ETagHeader;
+  EFI_HTTP_HEADER  *Headers;
+  UINTN            HeaderCount;
+
+  if ((CacheData == NULL) || (CacheData->Response == NULL) || (ConditionalRequest == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  ETagHeader = HttpFindHeader (CacheData->Response->HeaderCount, CacheData->Response->Headers, HTTP_HEADER_ETAG);
+  if ((ETagHeader == NULL) || IS_EMPTY_STRING (ETagHeader->FieldValue)) {
+    return EFI_NOT_FOUND;
+  }
+
+  HeaderCount = 0;
+  if (Request != NULL) {
+    if ((HttpFindHeader (Request->HeaderCount, Request->Headers, HTTP_HEADER_IF_NONE_MATCH) != NULL) ||
+        (HttpFindHeader (Request->HeaderCount, Request->Headers, HTTP_HEADER_IF_MATCH) != NULL))
+    {
+      return EFI_NOT_FOUND;
+    }
+
+    HeaderCount = Request->HeaderCount;
+    CopyMem (ConditionalRequest, Request, sizeof (REDFISH_REQUEST));
+  } else {
+    ZeroMem (ConditionalRequest, sizeof (REDFISH_REQUEST));
+  }
+
+  //
+  // The header fields are copied again when the request message is built,
+  // so the new header array only refers to the strings of caller's request
+  // and of the cached response.
+  //
+  Headers = AllocatePool ((HeaderCount + 1) * sizeof (EFI_HTTP_HEADER));
+  if (Headers == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  if (HeaderCount > 0) {
+    CopyMem (Headers, Request->Headers, HeaderCount * sizeof (EFI_HTTP_HEADER));
+  }
+
+  Headers[HeaderCount].FieldName  = HTTP_HEADER_IF_NONE_MATCH;
+  Headers[HeaderCount].FieldValue = ETagHeader->FieldValue;
+
+  ConditionalRequest->Headers     = Headers;
+  ConditionalRequest->HeaderCount = HeaderCount + 1;
+
+  return EFI_SUCCESS;
+}
+
 /**
   Search on given ListHeader and return cache data with minimum hit count.
 
@@ -556,6 +639,61 @@ DeleteHttpCacheData (
   return ReleaseHttpCacheData (Data);
 }
 
+/**
+  Check if the Cache-Control header of HTTP response has given directive.
+
+  @param[in]    Response   HTTP response.
+  @param[in]    Directive  The cache directive to look for, such as "no-store".
+
+  @retval TRUE    The directive is found.
+  @retval FALSE   The directive is not found.
+
+**/
+BOOLEAN
+HttpCacheControlHasDirective (
+  IN  REDFISH_RESPONSE  *Response,
+  IN  CHAR8             *Directive
+  )
+{
+  EFI_HTTP_HEADER  *Header;
+  CHAR8            *Value;
+  UINTN            Index;
+
+  Header = HttpFindHeader (Response->HeaderCount, Response->Headers, HTTP_HEADER_CACHE_CONTROL);
+  if ((Header == NULL) || (Header->FieldValue == NULL)) {
+    return FALSE;
+  }
+
+  //
+  // The value is a comma separated list of case-insensitive directives,
+  // some of which have an argument after "=".
+  //
+  Value = Header->FieldValue;
+  while (*Value != '\0') {
+    while ((*Value == ' ') || (*Value == '\t') || (*Value == ',')) {
+      Value++;
+    }
+
+    for (Index = 0; Directive[Index] != '\0'; Index++) {
+      if (AsciiCharToUpper (Value[Index]) != AsciiCharToUpper (Directive[Index])) {
+        break;
+      }
+    }
+
+    if ((Directive[Index] == '\0') &&
+        ((Value[Index] == '\0') || (Value[Index] == ',') || (Value[Index] == '=') || (Value[Index] == ' ') || (Value[Index] == '\t')))
+    {
+      return TRUE;
+    }
+
+    while ((*Value != '\0') && (*Value != ',')) {
+      Value++;
+    }
+  }
+
+  return FALSE;
+}
+
 /**
   Add new cache by given URI and HTTP response to specify List.
 
@@ -591,6 +729,14 @@ AddHttpCacheData (
     DeleteHttpCacheData (List, OldData);
   }
 
+  //
+  // Redfish service does not allow this response to be kept.
+  //
+  if (HttpCacheControlHasDirective (Response, REDFISH_HTTP_CACHE_NO_STORE)) {
+    DEBUG ((REDFISH_HTTP_CACHE_DEBUG, "%a: not cached by %a: %s\n", __func__, REDFISH_HTTP_CACHE_NO_STORE, Uri));
+    return EFI_SUCCESS;
+  }
+
   //
   // Check capacity
   //
@@ -617,6 +763,8 @@ AddHttpCacheData (
     return EFI_OUT_OF_RESOURCES;
   }
 
+  NewData->Revalidate = HttpCacheControlHasDirective (Response, REDFISH_HTTP_CACHE_NO_CACHE);
+
   InsertTailList (&List->Head, &NewData->List);
   ++List->Count;
 
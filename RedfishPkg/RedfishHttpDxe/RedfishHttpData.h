@@ -17,6 +17,8 @@
 #define REDFISH_HTTP_SERVICE_SIGNATURE  SIGNATURE_32 ('r', 'f', 's', 'v')
 #define REDFISH_HTTP_PAYLOAD_SIGNATURE  SIGNATURE_32 ('r', 'f', 'p', 'l')
 #define REDFISH_HTTP_BASIC_AUTH_STR     "Basic "
+#define REDFISH_HTTP_CACHE_NO_STORE     "no-store"
+#define REDFISH_HTTP_CACHE_NO_CACHE     "no-cache"
 
 ///
 /// REDFISH_SERVICE_PRIVATE definition.
@@ -47,6 +49,11 @@ typedef struct {
   LIST_ENTRY          List;
   EFI_STRING          Uri;
   UINTN               HitCount;
+  //
+  // Set when Redfish service asks to check the response is still current
+  // before it is used again.
+  //
+  BOOLEAN             Revalidate;
   REDFISH_RESPONSE    *Response;
 } REDFISH_HTTP_CACHE_DATA;
 
@@ -105,6 +112,29 @@ FindHttpCacheData (
   IN  EFI_STRING  Uri
   );
 
+/**
+  Build the request to get the resource of a cached response only when it
+  has changed on Redfish service since, by the entity tag of the response.
+
+  @param[in]    CacheData           The cached response of the resource.
+  @param[in]    Request             Additional request context from caller.
+                                    This is optional.
+  @param[out]   ConditionalRequest  The conditional request. Caller releases
+                                    ConditionalRequest->Headers by FreePool().
+
+  @retval EFI_SUCCESS           The conditional request is built.
+  @retval EFI_NOT_FOUND         The cached response has no entity tag, or
+                                caller's request is conditional already.
+  @retval EFI_OUT_OF_RESOURCES  No memory available.
+
+**/
+EFI_STATUS
+BuildConditionalRequest (
+  IN  REDFISH_HTTP_CACHE_DATA  *CacheData,
+  IN  REDFISH_REQUEST          *Request OPTIONAL,
+  OUT REDFISH_REQUEST          *ConditionalRequest
+  );
+
 /**
   This function copy the data in SrcResponse to DstResponse.
 
@@ -184,11 +214,15 @@ ReleaseRedfishPayload (
   );
 
 /**
-  This function creat new payload. Server and JsonObj are
-  copied to newly created payload.
+  This function creat new payload. Server is copied to newly
+  created payload. JsonValue is either copied, or shared with the
+  caller by taking a reference to it.
 
   @param[in]  Service          Pointer to Service instance.
-  @param[in]  JsonObj          Pointer to JSON object.
+  @param[in]  JsonValue        Pointer to JSON value.
+  @param[in]  CopyJsonValue    TRUE to copy JsonValue. FALSE to take a
+                               reference to JsonValue, for a caller which
+                               does not use JsonValue after releasing it.
 
   @retval     REDFISH_PAYLOAD_PRIVATE  Newly created payload.
   @retval     NULL             Error occurs.
@@ -197,7 +231,8 @@ ReleaseRedfishPayload (
 REDFISH_PAYLOAD_PRIVATE *
 CreateRedfishPayload (
   IN REDFISH_SERVICE_PRIVATE  *Service,
-  IN EDKII_JSON_VALUE         JsonValue
+  IN EDKII_JSON_VALUE         JsonValue,
+  IN BOOLEAN                  CopyJsonValue
   );
 
 /**
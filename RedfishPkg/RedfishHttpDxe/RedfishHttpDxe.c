@@ -528,6 +528,7 @@ RedfishGetResource (
   REDFISH_HTTP_CACHE_DATA     *CacheData;
   UINTN                       RetryCount;
   REDFISH_HTTP_CACHE_PRIVATE  *Private;
+  REDFISH_REQUEST             ConditionalRequest;
 
   if ((This == NULL) || (Service == NULL) || (Response == NULL) || IS_EMPTY_STRING (Uri)) {
     return EFI_INVALID_PARAMETER;
@@ -548,18 +549,30 @@ RedfishGetResource (
   //
   // Search for cache list.
   //
-  if (UseCache) {
+  if (!Private->CacheDisabled) {
     CacheData = FindHttpCacheData (&Private->CacheList.Head, Uri);
-    if (CacheData != NULL) {
-      DEBUG ((REDFISH_HTTP_CACHE_DEBUG_REQUEST, "%a: cache hit! %s\n", __func__, Uri));
+  }
 
-      //
-      // Copy cached response to caller's buffer.
-      //
-      Status               = CopyRedfishResponse (CacheData->Response, Response);
-      CacheData->HitCount += 1;
-      return Status;
-    }
+  if (UseCache && (CacheData != NULL) && !CacheData->Revalidate) {
+    DEBUG ((REDFISH_HTTP_CACHE_DEBUG_REQUEST, "%a: cache hit! %s\n", __func__, Uri));
+
+    //
+    // Copy cached response to caller's buffer.
+    //
+    Status               = CopyRedfishResponse (CacheData->Response, Response);
+    CacheData->HitCount += 1;
+    return Status;
+  }
+
+  //
+  // Caller needs the latest resource, or Redfish service asks to revalidate
+  // the cached one. When it is cached with an entity tag, ask Redfish service
+  // to only send the resource if it has changed.
+  //
+  if ((CacheData != NULL) && !EFI_ERROR (BuildConditionalRequest (CacheData, Request, &ConditionalRequest))) {
+    Request = &ConditionalRequest;
+  } else {
+    CacheData = NULL;
   }
 
   //
@@ -603,6 +616,18 @@ RedfishGetResource (
     }
   } while (TRUE);
 
+  if ((CacheData != NULL) && (Response->StatusCode != NULL) && (*Response->StatusCode == HTTP_STATUS_304_NOT_MODIFIED)) {
+    DEBUG ((REDFISH_HTTP_CACHE_DEBUG_REQUEST, "%a: not modified, use cache: %s\n", __func__, Uri));
+
+    //
+    // Copy cached response to caller's buffer.
+    //
+    This->FreeResponse (This, Response);
+    Status               = CopyRedfishResponse (CacheData->Response, Response);
+    CacheData->HitCount += 1;
+    goto ON_RELEASE;
+  }
+
   if (EFI_ERROR (Status)) {
     DEBUG_CODE (
       DumpRedfishResponse (NULL, DEBUG_ERROR, Response);
@@ -632,6 +657,10 @@ RedfishGetResource (
 
 ON_RELEASE:
 
+  if (Request == &ConditionalRequest) {
+    FreePool (ConditionalRequest.Headers);
+  }
+
   return Status;
 }
 
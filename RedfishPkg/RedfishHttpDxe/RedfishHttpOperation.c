@@ -228,6 +228,7 @@ BuildRequestMessage (
   UINTN                  ContentLength;
   BOOLEAN                HasContent;
   BOOLEAN                DoContentEncoding;
+  CHAR8                  *AcceptEncoding;
 
   RequestMsg        = NULL;
   RequestData       = NULL;
@@ -240,6 +241,7 @@ BuildRequestMessage (
   Headers           = NULL;
   HasContent        = FALSE;
   DoContentEncoding = FALSE;
+  AcceptEncoding    = (CHAR8 *)PcdGetPtr (PcdRedfishServiceAcceptEncoding);
 
   if ((ServicePrivate == NULL) || (IS_EMPTY_STRING (Uri))) {
     return NULL;
@@ -274,6 +276,10 @@ BuildRequestMessage (
     HeaderCount += Request->HeaderCount;
   }
 
+  if (!IS_EMPTY_STRING (AcceptEncoding)) {
+    HeaderCount++;
+  }
+
   //
   // Check and see if we will do content encoding or not
   //
@@ -342,6 +348,17 @@ BuildRequestMessage (
     goto ON_ERROR;
   }
 
+  //
+  // Ask for a compressed response. It is decoded by RedfishContentCodingLib
+  // in ParseResponseMessage().
+  //
+  if (!IS_EMPTY_STRING (AcceptEncoding)) {
+    Status = HttpSetFieldNameAndValue (&Headers[HeaderIndex++], HTTP_HEADER_ACCEPT_ENCODING, AcceptEncoding);
+    if (EFI_ERROR (Status)) {
+      goto ON_ERROR;
+    }
+  }
+
   //
   // Handle content header
   //
@@ -572,7 +589,11 @@ ParseResponseMessage (
     }
 
     if (!JsonValueIsNull (JsonData)) {
-      RedfishResponse->Payload = CreateRedfishPayload (ServicePrivate, JsonData);
+      //
+      // JsonData is released below, so the payload can take it over
+      // instead of copying the whole document.
+      //
+      RedfishResponse->Payload = CreateRedfishPayload (ServicePrivate, JsonData, FALSE);
       if (RedfishResponse->Payload == NULL) {
         DEBUG ((DEBUG_ERROR, "%a: Failed to create payload\n.", __func__));
       }
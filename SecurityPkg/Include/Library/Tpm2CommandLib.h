@@ -11,6 +11,14 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include <IndustryStandard/Tpm20.h>
 
+///
+/// A PCR extend whose submission to the TPM has been deferred.
+///
+typedef struct {
+  TPMI_DH_PCR           PcrHandle;
+  TPML_DIGEST_VALUES    Digests;
+} TPM2_PCR_EXTEND_QUEUE_ENTRY;
+
 /**
   This command starts a hash or an Event sequence.
   If hashAlg is an implemented hash, then a hash sequence is started.
@@ -506,6 +514,46 @@ Tpm2PcrExtend (
   IN      TPML_DIGEST_VALUES  *Digests
   );
 
+/**
+  Defer the PCR extends of Tpm2PcrExtend() in the caller module.
+
+  From now on Tpm2PcrExtend() adds the PCR extend to the queue and returns, the
+  queued PCR extends are submitted to the TPM in order by Tpm2PcrExtendQueueFlush(),
+  when the queue is full, and before any command of this library that reads or
+  extends PCRs, or shuts down the TPM. The caller is responsible for flushing the
+  queue before the PCR values may be observed through other means.
+
+  This function may only be called by modules whose global variables are writable.
+
+  @param[in] Queue       Buffer to hold the deferred PCR extends.
+  @param[in] QueueSize   Number of entries in Queue.
+
+  @retval EFI_SUCCESS            The PCR extends are deferred.
+  @retval EFI_INVALID_PARAMETER  Queue is NULL or QueueSize is 0.
+  @retval EFI_ALREADY_STARTED    The PCR extends are already deferred.
+**/
+EFI_STATUS
+EFIAPI
+Tpm2PcrExtendQueueStart (
+  IN      TPM2_PCR_EXTEND_QUEUE_ENTRY  *Queue,
+  IN      UINTN                        QueueSize
+  );
+
+/**
+  Submit the deferred PCR extends to the TPM, in the order they were requested.
+
+  If a PCR extend is unsuccessful, the remaining deferred PCR extends are dropped.
+
+  @retval EFI_SUCCESS      All deferred PCR extends have been submitted, or no
+                           PCR extend is deferred.
+  @retval EFI_DEVICE_ERROR Unexpected device behavior.
+**/
+EFI_STATUS
+EFIAPI
+Tpm2PcrExtendQueueFlush (
+  VOID
+  );
+
 /**
   This command is used to cause an update to the indicated PCR.
   The data in eventData is hashed using the hash algorithm associated with each bank in which the
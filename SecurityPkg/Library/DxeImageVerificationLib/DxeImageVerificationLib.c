@@ -36,6 +36,13 @@ UINT8  *mImageBase = NULL;
 UINT8  mImageDigest[MAX_DIGEST_SIZE];
 UINTN  mImageDigestSize;
 
+//
+// Digests of current PE/COFF image that have been calculated, so that an
+// image with several signatures is hashed only once per algorithm.
+//
+BOOLEAN  mImageDigestCached[HASHALG_MAX];
+UINT8    mImageDigestCache[HASHALG_MAX][MAX_DIGEST_SIZE];
+
 //
 // Notify string for authorization UI.
 //
@@ -71,6 +78,15 @@ HASH_TABLE  mHash[] = {
 
 EFI_STRING  mHashTypeStr;
 
+//
+// Signature databases read for current PE/COFF image.
+//
+SIGNATURE_DATABASE  mSignatureDatabase[] = {
+  { EFI_IMAGE_SECURITY_DATABASE,  FALSE, EFI_NOT_FOUND, NULL, 0 },
+  { EFI_IMAGE_SECURITY_DATABASE1, FALSE, EFI_NOT_FOUND, NULL, 0 },
+  { EFI_IMAGE_SECURITY_DATABASE2, FALSE, EFI_NOT_FOUND, NULL, 0 }
+};
+
 /**
   SecureBoot Hook for processing image verification.
 
@@ -347,7 +363,13 @@ HashPeImage (
   }
 
   mHashTypeStr = mHash[HashAlg].Name;
-  CtxSize      = mHash[HashAlg].GetContextSize ();
+
+  if (mImageDigestCached[HashAlg]) {
+    CopyMem (mImageDigest, mImageDigestCache[HashAlg], mImageDigestSize);
+    return TRUE;
+  }
+
+  CtxSize = mHash[HashAlg].GetContextSize ();
 
   HashCtx = AllocatePool (CtxSize);
   if (HashCtx == NULL) {
@@ -592,6 +614,10 @@ HashPeImage (
   }
 
   Status = mHash[HashAlg].HashFinal (HashCtx, mImageDigest);
+  if (Status) {
+    CopyMem (mImageDigestCache[HashAlg], mImageDigest, mImageDigestSize);
+    mImageDigestCached[HashAlg] = TRUE;
+  }
 
 Done:
   if (HashCtx != NULL) {
@@ -965,6 +991,107 @@ Done:
   return Status;
 }
 
+/**
+  Discard the signature databases read for the previous image, so that the
+  databases are read again for the next image.
+
+**/
+VOID
+ResetSignatureDatabases (
+  VOID
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < ARRAY_SIZE (mSignatureDatabase); Index++) {
+    if (mSignatureDatabase[Index].Data != NULL) {
+      FreePool (mSignatureDatabase[Index].Data);
+    }
+
+    mSignatureDatabase[Index].Valid    = FALSE;
+    mSignatureDatabase[Index].Status   = EFI_NOT_FOUND;
+    mSignatureDatabase[Index].Data     = NULL;
+    mSignatureDatabase[Index].DataSize = 0;
+  }
+}
+
+/**
+  Get the content of a signature database variable.
+
+  Each database is read at most once for each image, the returned data
+  remains valid until the next image is verified and must not be freed.
+
+  @param[in]  VariableName        Name of database variable.
+  @param[out] Data                Content of the database.
+  @param[out] DataSize            Size of the content of the database.
+
+  @retval EFI_SUCCESS             The content of the database is returned.
+  @retval EFI_NOT_FOUND           The database does not exist.
+  @retval EFI_OUT_OF_RESOURCES    Failed to allocate memory for the content.
+  @retval Others                  Failed to read the database.
+
+**/
+EFI_STATUS
+GetSignatureDatabase (
+  IN  CHAR16  *VariableName,
+  OUT UINT8   **Data,
+  OUT UINTN   *DataSize
+  )
+{
+  SIGNATURE_DATABASE  *Database;
+  UINTN               Index;
+  EFI_STATUS          Status;
+
+  *Data     = NULL;
+  *DataSize = 0;
+
+  Database = NULL;
+  for (Index = 0; Index < ARRAY_SIZE (mSignatureDatabase); Index++) {
+    if (StrCmp (VariableName, mSignatureDatabase[Index].VariableName) == 0) {
+      Database = &mSignatureDatabase[Index];
+      break;
+    }
+  }
+
+  ASSERT (Database != NULL);
+  if (Database == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (!Database->Valid) {
+    Database->DataSize = 0;
+    Status             = gRT->GetVariable (VariableName, &gEfiImageSecurityDatabaseGuid, NULL, &Database->DataSize, NULL);
+    if (Status == EFI_BUFFER_TOO_SMALL) {
+      Database->Data = (UINT8 *)AllocateZeroPool (Database->DataSize);
+      if (Database->Data == NULL) {
+        return EFI_OUT_OF_RESOURCES;
+      }
+
+      Status = gRT->GetVariable (VariableName, &gEfiImageSecurityDatabaseGuid, NULL, &Database->DataSize, Database->Data);
+      if (EFI_ERROR (Status)) {
+        FreePool (Database->Data);
+        Database->Data = NULL;
+      }
+    } else {
+      ASSERT (EFI_ERROR (Status));
+      if (!EFI_ERROR (Status)) {
+        Status = EFI_NOT_FOUND;
+      }
+    }
+
+    if (EFI_ERROR (Status)) {
+      Database->DataSize = 0;
+    }
+
+    Database->Status = Status;
+    Database->Valid  = TRUE;
+  }
+
+  *Data     = Database->Data;
+  *DataSize = Database->DataSize;
+  return Database->Status;
+}
+
 /**
   Check whether signature is in specified database.
 
@@ -999,10 +1126,8 @@ IsSignatureFoundInDatabase (
   // Read signature database variable.
   //
   *IsFound = FALSE;
-  Data     = NULL;
-  DataSize = 0;
-  Status   = gRT->GetVariable (VariableName, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, NULL);
-  if (Status != EFI_BUFFER_TOO_SMALL) {
+  Status   = GetSignatureDatabase (VariableName, &Data, &DataSize);
+  if (EFI_ERROR (Status)) {
     if (Status == EFI_NOT_FOUND) {
       //
       // No database, no need to search.
@@ -1013,16 +1138,6 @@ IsSignatureFoundInDatabase (
     return Status;
   }
 
-  Data = (UINT8 *)AllocateZeroPool (DataSize);
-  if (Data == NULL) {
-    return EFI_OUT_OF_RESOURCES;
-  }
-
-  Status = gRT->GetVariable (VariableName, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, Data);
-  if (EFI_ERROR (Status)) {
-    goto Done;
-  }
-
   //
   // Enumerate all signature data in SigDB to check if signature exists for executable.
   //
@@ -1059,11 +1174,6 @@ IsSignatureFoundInDatabase (
     CertList  = (EFI_SIGNATURE_LIST *)((UINT8 *)CertList + CertList->SignatureListSize);
   }
 
-Done:
-  if (Data != NULL) {
-    FreePool (Data);
-  }
-
   return Status;
 }
 
@@ -1175,18 +1285,7 @@ PassTimestampCheck (
   // RevocationTime is non-zero, the certificate should be considered to be revoked from that time and onwards.
   // Using the dbt to get the trusted TSA certificates.
   //
-  DbtDataSize = 0;
-  Status      = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE2, &gEfiImageSecurityDatabaseGuid, NULL, &DbtDataSize, NULL);
-  if (Status != EFI_BUFFER_TOO_SMALL) {
-    goto Done;
-  }
-
-  DbtData = (UINT8 *)AllocateZeroPool (DbtDataSize);
-  if (DbtData == NULL) {
-    goto Done;
-  }
-
-  Status = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE2, &gEfiImageSecurityDatabaseGuid, NULL, &DbtDataSize, (VOID *)DbtData);
+  Status = GetSignatureDatabase (EFI_IMAGE_SECURITY_DATABASE2, &DbtData, &DbtDataSize);
   if (EFI_ERROR (Status)) {
     goto Done;
   }
@@ -1224,10 +1323,6 @@ PassTimestampCheck (
   }
 
 Done:
-  if (DbtData != NULL) {
-    FreePool (DbtData);
-  }
-
   return VerifyStatus;
 }
 
@@ -1288,10 +1383,8 @@ IsForbiddenByDbx (
   //
   // The image will not be forbidden if dbx can't be got.
   //
-  DataSize = 0;
-  Status   = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE1, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, NULL);
-  ASSERT (EFI_ERROR (Status));
-  if (Status != EFI_BUFFER_TOO_SMALL) {
+  Status = GetSignatureDatabase (EFI_IMAGE_SECURITY_DATABASE1, &Data, &DataSize);
+  if (EFI_ERROR (Status)) {
     if (Status == EFI_NOT_FOUND) {
       //
       // Evidently not in dbx if the database doesn't exist.
@@ -1302,16 +1395,6 @@ IsForbiddenByDbx (
     return IsForbidden;
   }
 
-  Data = (UINT8 *)AllocateZeroPool (DataSize);
-  if (Data == NULL) {
-    return IsForbidden;
-  }
-
-  Status = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE1, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, (VOID *)Data);
-  if (EFI_ERROR (Status)) {
-    goto Done;
-  }
-
   //
   // Verify image signature with RAW X509 certificates in DBX database.
   // If passed, the image will be forbidden.
@@ -1418,10 +1501,6 @@ IsForbiddenByDbx (
   IsForbidden = FALSE;
 
 Done:
-  if (Data != NULL) {
-    FreePool (Data);
-  }
-
   Pkcs7FreeSigners (CertBuffer);
   Pkcs7FreeSigners (TrustedCert);
 
@@ -1471,21 +1550,9 @@ IsAllowedByDb (
   // Fetch 'db' content. If 'db' doesn't exist or encounters problem to get the
   // data, return not-allowed-by-db (FALSE).
   //
-  DataSize = 0;
-  Status   = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, NULL);
-  ASSERT (EFI_ERROR (Status));
-  if (Status != EFI_BUFFER_TOO_SMALL) {
-    return VerifyStatus;
-  }
-
-  Data = (UINT8 *)AllocateZeroPool (DataSize);
-  if (Data == NULL) {
-    return VerifyStatus;
-  }
-
-  Status = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE, &gEfiImageSecurityDatabaseGuid, NULL, &DataSize, (VOID *)Data);
+  Status = GetSignatureDatabase (EFI_IMAGE_SECURITY_DATABASE, &Data, &DataSize);
   if (EFI_ERROR (Status)) {
-    goto Done;
+    return VerifyStatus;
   }
 
   //
@@ -1493,30 +1560,9 @@ IsAllowedByDb (
   // If any other errors occurred, no need to check 'db' but just return
   // not-allowed-by-db (FALSE) to avoid bypass.
   //
-  DbxDataSize = 0;
-  Status      = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE1, &gEfiImageSecurityDatabaseGuid, NULL, &DbxDataSize, NULL);
-  ASSERT (EFI_ERROR (Status));
-  if (Status != EFI_BUFFER_TOO_SMALL) {
-    if (Status != EFI_NOT_FOUND) {
-      goto Done;
-    }
-
-    //
-    // 'dbx' does not exist. Continue to check 'db'.
-    //
-  } else {
-    //
-    // 'dbx' exists. Get its content.
-    //
-    DbxData = (UINT8 *)AllocateZeroPool (DbxDataSize);
-    if (DbxData == NULL) {
-      goto Done;
-    }
-
-    Status = gRT->GetVariable (EFI_IMAGE_SECURITY_DATABASE1, &gEfiImageSecurityDatabaseGuid, NULL, &DbxDataSize, (VOID *)DbxData);
-    if (EFI_ERROR (Status)) {
-      goto Done;
-    }
+  Status = GetSignatureDatabase (EFI_IMAGE_SECURITY_DATABASE1, &DbxData, &DbxDataSize);
+  if (EFI_ERROR (Status) && (Status != EFI_NOT_FOUND)) {
+    goto Done;
   }
 
   //
@@ -1595,14 +1641,6 @@ Done:
     SecureBootHook (EFI_IMAGE_SECURITY_DATABASE, &gEfiImageSecurityDatabaseGuid, CertList->SignatureSize, CertData);
   }
 
-  if (Data != NULL) {
-    FreePool (Data);
-  }
-
-  if (DbxData != NULL) {
-    FreePool (DbxData);
-  }
-
   return VerifyStatus;
 }
 
@@ -1777,6 +1815,8 @@ DxeImageVerificationHandler (
 
   mImageBase = (UINT8 *)FileBuffer;
   mImageSize = FileSize;
+  ZeroMem (mImageDigestCached, sizeof (mImageDigestCached));
+  ResetSignatureDatabases ();
 
   ZeroMem (&ImageContext, sizeof (ImageContext));
   ImageContext.Handle    = (VOID *)FileBuffer;
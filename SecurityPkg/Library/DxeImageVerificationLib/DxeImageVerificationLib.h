@@ -195,4 +195,15 @@ typedef struct {
   HASH_FINAL               HashFinal;
 } HASH_TABLE;
 
+//
+// Content of a signature database variable, read once for each image.
+//
+typedef struct {
+  CHAR16        *VariableName;
+  BOOLEAN       Valid;
+  EFI_STATUS    Status;
+  UINT8         *Data;
+  UINTN         DataSize;
+} SIGNATURE_DATABASE;
+
 #endif
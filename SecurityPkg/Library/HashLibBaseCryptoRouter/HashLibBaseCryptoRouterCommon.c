@@ -15,6 +15,12 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/HashLib.h>
 #include <Protocol/Tcg2Protocol.h>
 
+//
+// Data is hashed in chunks that stay in the cache while they pass through
+// all hash interfaces.
+//
+#define HASH_UPDATE_CHUNK_SIZE  SIZE_64KB
+
 typedef struct {
   EFI_GUID    Guid;
   UINT32      Mask;
@@ -72,3 +78,54 @@ Tpm2SetHashToDigestList (
     );
   DigestList->count++;
 }
+
+/**
+  The function updates the hash sequences of all hash interfaces in HashMask
+  with the same data.
+
+  The data is passed to the hash interfaces in chunks of HASH_UPDATE_CHUNK_SIZE
+  bytes. Each chunk is hashed by all hash interfaces before the next one, so
+  that measuring into several PCR banks reads the data from memory only once.
+
+  @param HashInterface      Hash interface array
+  @param HashInterfaceCount Number of hash interfaces in the array
+  @param HashMask           Mask of hash interfaces to update
+  @param HashCtx            Hash context array, one for each hash interface
+  @param DataToHash         Data to be hashed
+  @param DataToHashLen      Data size
+**/
+VOID
+EFIAPI
+Tpm2HashUpdateAll (
+  IN HASH_INTERFACE  *HashInterface,
+  IN UINTN           HashInterfaceCount,
+  IN UINT32          HashMask,
+  IN HASH_HANDLE     *HashCtx,
+  IN VOID            *DataToHash,
+  IN UINTN           DataToHashLen
+  )
+{
+  BOOLEAN  Active[HASH_COUNT];
+  UINTN    Index;
+  UINT8    *Data;
+  UINTN    Size;
+
+  ASSERT (HashInterfaceCount <= HASH_COUNT);
+
+  for (Index = 0; Index < HashInterfaceCount; Index++) {
+    Active[Index] = (BOOLEAN)((Tpm2GetHashMaskFromAlgo (&HashInterface[Index].HashGuid) & HashMask) != 0);
+  }
+
+  Data = DataToHash;
+  do {
+    Size = MIN (DataToHashLen, HASH_UPDATE_CHUNK_SIZE);
+    for (Index = 0; Index < HashInterfaceCount; Index++) {
+      if (Active[Index]) {
+        HashInterface[Index].HashUpdate (HashCtx[Index], Data, Size);
+      }
+    }
+
+    Data          += Size;
+    DataToHashLen -= Size;
+  } while (DataToHashLen != 0);
+}
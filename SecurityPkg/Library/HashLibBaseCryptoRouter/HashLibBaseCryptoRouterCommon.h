@@ -35,4 +35,26 @@ Tpm2SetHashToDigestList (
   IN TPML_DIGEST_VALUES      *Digest
   );
 
+/**
+  The function updates the hash sequences of all hash interfaces in HashMask
+  with the same data.
+
+  @param HashInterface      Hash interface array
+  @param HashInterfaceCount Number of hash interfaces in the array
+  @param HashMask           Mask of hash interfaces to update
+  @param HashCtx            Hash context array, one for each hash interface
+  @param DataToHash         Data to be hashed
+  @param DataToHashLen      Data size
+**/
+VOID
+EFIAPI
+Tpm2HashUpdateAll (
+  IN HASH_INTERFACE  *HashInterface,
+  IN UINTN           HashInterfaceCount,
+  IN UINT32          HashMask,
+  IN HASH_HANDLE     *HashCtx,
+  IN VOID            *DataToHash,
+  IN UINTN           DataToHashLen
+  );
+
 #endif
@@ -1651,19 +1651,23 @@ OpalGetTryLimit (
 
 /**
 
-  Get the support attribute info.
+  Get the support attribute info and the locking info from a single level 0 discovery.
 
   @param[in]      Session             OPAL_SESSION with OPAL_UID_LOCKING_SP to retrieve info.
   @param[out]     SupportedAttributes Return the support attribute info.
   @param[out]     OpalBaseComId       Return the base com id info.
+  @param[out]     LockingFeature      Return the Locking info. It is zeroed if the device has
+                                      no locking feature descriptor. This is an optional
+                                      parameter that may be NULL.
 
 **/
 TCG_RESULT
 EFIAPI
-OpalGetSupportedAttributesInfo (
-  IN  OPAL_SESSION                 *Session,
-  OUT OPAL_DISK_SUPPORT_ATTRIBUTE  *SupportedAttributes,
-  OUT UINT16                       *OpalBaseComId
+OpalGetSupportedAttributesAndLockingInfo (
+  IN  OPAL_SESSION                    *Session,
+  OUT OPAL_DISK_SUPPORT_ATTRIBUTE     *SupportedAttributes,
+  OUT UINT16                          *OpalBaseComId,
+  OUT TCG_LOCKING_FEATURE_DESCRIPTOR  *LockingFeature OPTIONAL
   )
 {
   UINT8                             Buffer[BUFFER_SIZE];
@@ -1680,6 +1684,10 @@ OpalGetSupportedAttributesInfo (
 
   ZeroMem (Buffer, BUFFER_SIZE);
   ZeroMem (SupportedAttributes, sizeof (OPAL_DISK_SUPPORT_ATTRIBUTE));
+  if (LockingFeature != NULL) {
+    ZeroMem (LockingFeature, sizeof (TCG_LOCKING_FEATURE_DESCRIPTOR));
+  }
+
   ASSERT (sizeof (Buffer) >= sizeof (TCG_SUPPORTED_SECURITY_PROTOCOLS));
 
   //
@@ -1818,6 +1826,9 @@ OpalGetSupportedAttributesInfo (
   if ((Feat != NULL) && (Size >= sizeof (TCG_LOCKING_FEATURE_DESCRIPTOR))) {
     SupportedAttributes->MediaEncryption = Feat->Locking.MediaEncryption;
     DEBUG ((DEBUG_INFO, "SupportedAttributes->MediaEncryption 0x%X \n", SupportedAttributes->MediaEncryption));
+    if (LockingFeature != NULL) {
+      CopyMem (LockingFeature, &Feat->Locking, sizeof (TCG_LOCKING_FEATURE_DESCRIPTOR));
+    }
   }
 
   Size = 0;
@@ -1848,6 +1859,26 @@ OpalGetSupportedAttributesInfo (
   return TcgResultSuccess;
 }
 
+/**
+
+  Get the support attribute info.
+
+  @param[in]      Session             OPAL_SESSION with OPAL_UID_LOCKING_SP to retrieve info.
+  @param[out]     SupportedAttributes Return the support attribute info.
+  @param[out]     OpalBaseComId       Return the base com id info.
+
+**/
+TCG_RESULT
+EFIAPI
+OpalGetSupportedAttributesInfo (
+  IN  OPAL_SESSION                 *Session,
+  OUT OPAL_DISK_SUPPORT_ATTRIBUTE  *SupportedAttributes,
+  OUT UINT16                       *OpalBaseComId
+  )
+{
+  return OpalGetSupportedAttributesAndLockingInfo (Session, SupportedAttributes, OpalBaseComId, NULL);
+}
+
 /**
 
   Get the support attribute info.
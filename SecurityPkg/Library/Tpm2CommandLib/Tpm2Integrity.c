@@ -76,10 +76,17 @@ typedef struct {
 
 #pragma pack()
 
+//
+// The queue of deferred PCR extends, Tpm2PcrExtendQueueStart() sets it up.
+// Entries [mTpm2PcrExtendQueueHead, mTpm2PcrExtendQueueTail) are pending.
+//
+GLOBAL_REMOVE_IF_UNREFERENCED TPM2_PCR_EXTEND_QUEUE_ENTRY  *mTpm2PcrExtendQueue    = NULL;
+GLOBAL_REMOVE_IF_UNREFERENCED UINTN                        mTpm2PcrExtendQueueSize = 0;
+GLOBAL_REMOVE_IF_UNREFERENCED UINTN                        mTpm2PcrExtendQueueHead = 0;
+GLOBAL_REMOVE_IF_UNREFERENCED UINTN                        mTpm2PcrExtendQueueTail = 0;
+
 /**
-  This command is used to cause an update to the indicated PCR.
-  The digests parameter contains one or more tagged digest value identified by an algorithm ID.
-  For each digest, the PCR associated with pcrHandle is Extended into the bank identified by the tag (hashAlg).
+  Submit TPM2_PCR_Extend for the indicated PCR to the TPM.
 
   @param[in] PcrHandle   Handle of the PCR
   @param[in] Digests     List of tagged digest values to be extended
@@ -87,9 +94,9 @@ typedef struct {
   @retval EFI_SUCCESS      Operation completed successfully.
   @retval EFI_DEVICE_ERROR Unexpected device behavior.
 **/
+STATIC
 EFI_STATUS
-EFIAPI
-Tpm2PcrExtend (
+InternalTpm2PcrExtend (
   IN      TPMI_DH_PCR         PcrHandle,
   IN      TPML_DIGEST_VALUES  *Digests
   )
@@ -203,6 +210,125 @@ Tpm2PcrExtend (
   return EFI_SUCCESS;
 }
 
+/**
+  This command is used to cause an update to the indicated PCR.
+  The digests parameter contains one or more tagged digest value identified by an algorithm ID.
+  For each digest, the PCR associated with pcrHandle is Extended into the bank identified by the tag (hashAlg).
+
+  @param[in] PcrHandle   Handle of the PCR
+  @param[in] Digests     List of tagged digest values to be extended
+
+  @retval EFI_SUCCESS      Operation completed successfully.
+  @retval EFI_DEVICE_ERROR Unexpected device behavior.
+**/
+EFI_STATUS
+EFIAPI
+Tpm2PcrExtend (
+  IN      TPMI_DH_PCR         PcrHandle,
+  IN      TPML_DIGEST_VALUES  *Digests
+  )
+{
+  EFI_STATUS                   Status;
+  TPM2_PCR_EXTEND_QUEUE_ENTRY  *Entry;
+
+  if (mTpm2PcrExtendQueue == NULL) {
+    return InternalTpm2PcrExtend (PcrHandle, Digests);
+  }
+
+  if (mTpm2PcrExtendQueueTail - mTpm2PcrExtendQueueHead == mTpm2PcrExtendQueueSize) {
+    Status = Tpm2PcrExtendQueueFlush ();
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
+
+  Entry            = &mTpm2PcrExtendQueue[mTpm2PcrExtendQueueTail % mTpm2PcrExtendQueueSize];
+  Entry->PcrHandle = PcrHandle;
+  CopyMem (&Entry->Digests, Digests, sizeof (*Digests));
+  mTpm2PcrExtendQueueTail++;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Defer the PCR extends of Tpm2PcrExtend() in the caller module.
+
+  From now on Tpm2PcrExtend() adds the PCR extend to the queue and returns, the
+  queued PCR extends are submitted to the TPM in order by Tpm2PcrExtendQueueFlush(),
+  when the queue is full, and before any command of this library that reads or
+  extends PCRs, or shuts down the TPM. The caller is responsible for flushing the
+  queue before the PCR values may be observed through other means.
+
+  This function may only be called by modules whose global variables are writable.
+
+  @param[in] Queue       Buffer to hold the deferred PCR extends.
+  @param[in] QueueSize   Number of entries in Queue.
+
+  @retval EFI_SUCCESS            The PCR extends are deferred.
+  @retval EFI_INVALID_PARAMETER  Queue is NULL or QueueSize is 0.
+  @retval EFI_ALREADY_STARTED    The PCR extends are already deferred.
+**/
+EFI_STATUS
+EFIAPI
+Tpm2PcrExtendQueueStart (
+  IN      TPM2_PCR_EXTEND_QUEUE_ENTRY  *Queue,
+  IN      UINTN                        QueueSize
+  )
+{
+  if ((Queue == NULL) || (QueueSize == 0)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (mTpm2PcrExtendQueue != NULL) {
+    return EFI_ALREADY_STARTED;
+  }
+
+  mTpm2PcrExtendQueueSize = QueueSize;
+  mTpm2PcrExtendQueueHead = 0;
+  mTpm2PcrExtendQueueTail = 0;
+  mTpm2PcrExtendQueue     = Queue;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Submit the deferred PCR extends to the TPM, in the order they were requested.
+
+  If a PCR extend is unsuccessful, the remaining deferred PCR extends are dropped.
+
+  @retval EFI_SUCCESS      All deferred PCR extends have been submitted, or no
+                           PCR extend is deferred.
+  @retval EFI_DEVICE_ERROR Unexpected device behavior.
+**/
+EFI_STATUS
+EFIAPI
+Tpm2PcrExtendQueueFlush (
+  VOID
+  )
+{
+  EFI_STATUS                   Status;
+  TPM2_PCR_EXTEND_QUEUE_ENTRY  *Entry;
+
+  while (mTpm2PcrExtendQueueHead != mTpm2PcrExtendQueueTail) {
+    //
+    // Dequeue the entry before submitting it, so that a nested flush, e.g. from
+    // the PCR read that follows an extend in DEBUG builds, continues with the
+    // next entry.
+    //
+    Entry = &mTpm2PcrExtendQueue[mTpm2PcrExtendQueueHead % mTpm2PcrExtendQueueSize];
+    mTpm2PcrExtendQueueHead++;
+
+    Status = InternalTpm2PcrExtend (Entry->PcrHandle, &Entry->Digests);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "Tpm2PcrExtendQueueFlush: Drop %d deferred PCR extends\n", (UINT32)(mTpm2PcrExtendQueueTail - mTpm2PcrExtendQueueHead)));
+      mTpm2PcrExtendQueueHead = mTpm2PcrExtendQueueTail;
+      return Status;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
 /**
   This command is used to cause an update to the indicated PCR.
   The data in eventData is hashed using the hash algorithm associated with each bank in which the
@@ -237,6 +363,14 @@ Tpm2PcrEvent (
   UINT32                   SessionInfoSize;
   UINT16                   DigestSize;
 
+  //
+  // Submit the deferred PCR extends first, to keep the PCR values in order.
+  //
+  Status = Tpm2PcrExtendQueueFlush ();
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
   Cmd.Header.tag         = SwapBytes16 (TPM_ST_SESSIONS);
   Cmd.Header.commandCode = SwapBytes32 (TPM_CC_PCR_Event);
   Cmd.PcrHandle          = SwapBytes32 (PcrHandle);
@@ -350,6 +484,14 @@ Tpm2PcrRead (
   TPML_DIGEST             *PcrValuesOut;
   TPM2B_DIGEST            *Digests;
 
+  //
+  // Submit the deferred PCR extends first, to keep the PCR values in order.
+  //
+  Status = Tpm2PcrExtendQueueFlush ();
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
   //
   // Construct command
   //
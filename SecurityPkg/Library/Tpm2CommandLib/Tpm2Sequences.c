@@ -296,6 +296,14 @@ Tpm2EventSequenceComplete (
   UINT32                                 ResultBufSize;
   UINT16                                 DigestSize;
 
+  //
+  // Submit the deferred PCR extends first, to keep the PCR values in order.
+  //
+  Status = Tpm2PcrExtendQueueFlush ();
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
   ZeroMem (&Cmd, sizeof (Cmd));
 
   //
@@ -101,6 +101,11 @@ Tpm2Shutdown (
   TPM2_SHUTDOWN_RESPONSE  Res;
   UINT32                  ResultBufSize;
 
+  //
+  // Submit the deferred PCR extends, the TPM may save the PCR values on shutdown.
+  //
+  Tpm2PcrExtendQueueFlush ();
+
   Cmd.Header.tag         = SwapBytes16 (TPM_ST_NO_SESSIONS);
   Cmd.Header.paramSize   = SwapBytes32 (sizeof (Cmd));
   Cmd.Header.commandCode = SwapBytes32 (TPM_CC_Shutdown);
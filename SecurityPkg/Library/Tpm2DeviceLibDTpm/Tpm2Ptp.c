@@ -39,6 +39,13 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 //
 #define RETRY_CNT_MAX  3
 
+//
+// Register polling starts with a short delay, and doubles it up to the max
+// delay, so that fast status changes are noticed early.
+//
+#define PTP_POLL_DELAY_MIN  1
+#define PTP_POLL_DELAY_MAX  30
+
 /**
   Check whether TPM PTP register exist.
 
@@ -86,19 +93,82 @@ PtpCrbWaitRegisterBits (
 {
   UINT32  RegRead;
   UINT32  WaitTime;
+  UINT32  Delay;
 
-  for (WaitTime = 0; WaitTime < TimeOut; WaitTime += 30) {
+  WaitTime = 0;
+  Delay    = PTP_POLL_DELAY_MIN;
+  while (WaitTime < TimeOut) {
     RegRead = MmioRead32 ((UINTN)Register);
     if (((RegRead & BitSet) == BitSet) && ((RegRead & BitClear) == 0)) {
       return EFI_SUCCESS;
     }
 
-    MicroSecondDelay (30);
+    MicroSecondDelay (Delay);
+    WaitTime += Delay;
+    Delay     = MIN (Delay * 2, PTP_POLL_DELAY_MAX);
   }
 
   return EFI_TIMEOUT;
 }
 
+/**
+  Copy data to the CRB data buffer, using 4-byte accesses where possible.
+
+  @param[in] Register  Address in the CRB data buffer to copy the data to.
+  @param[in] Buffer    Data to copy.
+  @param[in] Size      Size of data.
+**/
+VOID
+PtpCrbWriteBuffer (
+  IN      UINT8   *Register,
+  IN      UINT8   *Buffer,
+  IN      UINT32  Size
+  )
+{
+  for ( ; (Size > 0) && (((UINTN)Register & (sizeof (UINT32) - 1)) != 0); Size--) {
+    MmioWrite8 ((UINTN)Register++, *Buffer++);
+  }
+
+  for ( ; Size >= sizeof (UINT32); Size -= sizeof (UINT32)) {
+    MmioWrite32 ((UINTN)Register, ReadUnaligned32 ((UINT32 *)Buffer));
+    Register += sizeof (UINT32);
+    Buffer   += sizeof (UINT32);
+  }
+
+  for ( ; Size > 0; Size--) {
+    MmioWrite8 ((UINTN)Register++, *Buffer++);
+  }
+}
+
+/**
+  Copy data from the CRB data buffer, using 4-byte accesses where possible.
+
+  @param[in]  Register  Address in the CRB data buffer to copy the data from.
+  @param[out] Buffer    Buffer to receive the data.
+  @param[in]  Size      Size of data.
+**/
+VOID
+PtpCrbReadBuffer (
+  IN      UINT8   *Register,
+  OUT     UINT8   *Buffer,
+  IN      UINT32  Size
+  )
+{
+  for ( ; (Size > 0) && (((UINTN)Register & (sizeof (UINT32) - 1)) != 0); Size--) {
+    *Buffer++ = MmioRead8 ((UINTN)Register++);
+  }
+
+  for ( ; Size >= sizeof (UINT32); Size -= sizeof (UINT32)) {
+    WriteUnaligned32 ((UINT32 *)Buffer, MmioRead32 ((UINTN)Register));
+    Register += sizeof (UINT32);
+    Buffer   += sizeof (UINT32);
+  }
+
+  for ( ; Size > 0; Size--) {
+    *Buffer++ = MmioRead8 ((UINTN)Register++);
+  }
+}
+
 /**
   Get the control of TPM chip.
 
@@ -264,9 +334,7 @@ PtpCrbTpmCommand (
   // first byte of a command to the Command Buffer and the receipt of a write
   // of 1 to Start.
   //
-  for (Index = 0; Index < SizeIn; Index++) {
-    MmioWrite8 ((UINTN)&CrbReg->CrbDataBuffer[Index], BufferIn[Index]);
-  }
+  PtpCrbWriteBuffer (CrbReg->CrbDataBuffer, BufferIn, SizeIn);
 
   MmioWrite32 ((UINTN)&CrbReg->CrbControlCommandAddressHigh, (UINT32)RShiftU64 ((UINTN)CrbReg->CrbDataBuffer, 32));
   MmioWrite32 ((UINTN)&CrbReg->CrbControlCommandAddressLow, (UINT32)(UINTN)CrbReg->CrbDataBuffer);
@@ -320,9 +388,7 @@ PtpCrbTpmCommand (
   //
   // Get response data header
   //
-  for (Index = 0; Index < sizeof (TPM2_RESPONSE_HEADER); Index++) {
-    BufferOut[Index] = MmioRead8 ((UINTN)&CrbReg->CrbDataBuffer[Index]);
-  }
+  PtpCrbReadBuffer (CrbReg->CrbDataBuffer, BufferOut, sizeof (TPM2_RESPONSE_HEADER));
 
   DEBUG_CODE_BEGIN ();
   DEBUG ((DEBUG_VERBOSE, "PtpCrbTpmCommand ReceiveHeader - "));
@@ -357,8 +423,12 @@ PtpCrbTpmCommand (
   //
   // Continue reading the remaining data
   //
-  for (Index = sizeof (TPM2_RESPONSE_HEADER); Index < TpmOutSize; Index++) {
-    BufferOut[Index] = MmioRead8 ((UINTN)&CrbReg->CrbDataBuffer[Index]);
+  if (TpmOutSize > sizeof (TPM2_RESPONSE_HEADER)) {
+    PtpCrbReadBuffer (
+      &CrbReg->CrbDataBuffer[sizeof (TPM2_RESPONSE_HEADER)],
+      BufferOut + sizeof (TPM2_RESPONSE_HEADER),
+      TpmOutSize - sizeof (TPM2_RESPONSE_HEADER)
+      );
   }
 
   DEBUG_CODE_BEGIN ();
@@ -17,10 +17,18 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/Tpm2DeviceLib.h>
 #include <Library/PcdLib.h>
 
+#include <IndustryStandard/TpmPtp.h>
 #include <IndustryStandard/TpmTis.h>
 
 #define TIS_TIMEOUT_MAX  (90000 * 1000)             // 90s
 
+//
+// Register polling starts with a short delay, and doubles it up to the max
+// delay, so that fast status changes are noticed early.
+//
+#define TIS_POLL_DELAY_MIN  1
+#define TIS_POLL_DELAY_MAX  30
+
 //
 // Max TPM command/response length
 //
@@ -66,14 +74,19 @@ TisPcWaitRegisterBits (
 {
   UINT8   RegRead;
   UINT32  WaitTime;
+  UINT32  Delay;
 
-  for (WaitTime = 0; WaitTime < TimeOut; WaitTime += 30) {
+  WaitTime = 0;
+  Delay    = TIS_POLL_DELAY_MIN;
+  while (WaitTime < TimeOut) {
     RegRead = MmioRead8 ((UINTN)Register);
     if (((RegRead & BitSet) == BitSet) && ((RegRead & BitClear) == 0)) {
       return EFI_SUCCESS;
     }
 
-    MicroSecondDelay (30);
+    MicroSecondDelay (Delay);
+    WaitTime += Delay;
+    Delay     = MIN (Delay * 2, TIS_POLL_DELAY_MAX);
   }
 
   return EFI_TIMEOUT;
@@ -97,6 +110,7 @@ TisPcReadBurstCount (
   )
 {
   UINT32  WaitTime;
+  UINT32  Delay;
   UINT8   DataByte0;
   UINT8   DataByte1;
 
@@ -105,6 +119,7 @@ TisPcReadBurstCount (
   }
 
   WaitTime = 0;
+  Delay    = TIS_POLL_DELAY_MIN;
   do {
     //
     // TIS_PC_REGISTERS_PTR->burstCount is UINT16, but it is not 2bytes aligned,
@@ -117,8 +132,9 @@ TisPcReadBurstCount (
       return EFI_SUCCESS;
     }
 
-    MicroSecondDelay (30);
-    WaitTime += 30;
+    MicroSecondDelay (Delay);
+    WaitTime += Delay;
+    Delay     = MIN (Delay * 2, TIS_POLL_DELAY_MAX);
   } while (WaitTime < TIS_TIMEOUT_D);
 
   return EFI_TIMEOUT;
@@ -191,6 +207,87 @@ TisPcRequestUseTpm (
   return Status;
 }
 
+/**
+  Check whether the TPM FIFO supports 4-byte accesses to the data FIFO.
+
+  TIS 1.3 and PTP FIFO TPMs that support transfers larger than one byte
+  accept 4-byte accesses to the data FIFO register.
+
+  @param[in] TisReg  Pointer to TIS register.
+
+  @retval    TRUE    4-byte accesses are supported.
+  @retval    FALSE   Only 1-byte accesses are supported.
+**/
+BOOLEAN
+TisPcIsWideFifo (
+  IN      TIS_PC_REGISTERS_PTR  TisReg
+  )
+{
+  PTP_FIFO_INTERFACE_CAPABILITY  InterfaceCapability;
+
+  InterfaceCapability.Uint32 = MmioRead32 ((UINTN)&TisReg->IntfCapability);
+  return (BOOLEAN)((InterfaceCapability.Bits.InterfaceVersion >= INTERFACE_CAPABILITY_INTERFACE_VERSION_TIS_13) &&
+                   (InterfaceCapability.Bits.DataTransferSizeSupport != 0));
+}
+
+/**
+  Write data to the data FIFO of the TPM.
+
+  @param[in] TisReg    Pointer to TIS register.
+  @param[in] WideFifo  TRUE if 4-byte accesses to the data FIFO are supported.
+  @param[in] Buffer    Data to write.
+  @param[in] Size      Size of data, no larger than the burst count.
+**/
+VOID
+TisPcWriteFifo (
+  IN      TIS_PC_REGISTERS_PTR  TisReg,
+  IN      BOOLEAN               WideFifo,
+  IN      UINT8                 *Buffer,
+  IN      UINT32                Size
+  )
+{
+  if (WideFifo) {
+    for ( ; Size >= sizeof (UINT32); Size -= sizeof (UINT32)) {
+      MmioWrite32 ((UINTN)&TisReg->DataFifo, ReadUnaligned32 ((UINT32 *)Buffer));
+      Buffer += sizeof (UINT32);
+    }
+  }
+
+  for ( ; Size > 0; Size--) {
+    MmioWrite8 ((UINTN)&TisReg->DataFifo, *Buffer);
+    Buffer++;
+  }
+}
+
+/**
+  Read data from the data FIFO of the TPM.
+
+  @param[in]  TisReg    Pointer to TIS register.
+  @param[in]  WideFifo  TRUE if 4-byte accesses to the data FIFO are supported.
+  @param[out] Buffer    Buffer to receive the data.
+  @param[in]  Size      Size of data, no larger than the burst count.
+**/
+VOID
+TisPcReadFifo (
+  IN      TIS_PC_REGISTERS_PTR  TisReg,
+  IN      BOOLEAN               WideFifo,
+  OUT     UINT8                 *Buffer,
+  IN      UINT32                Size
+  )
+{
+  if (WideFifo) {
+    for ( ; Size >= sizeof (UINT32); Size -= sizeof (UINT32)) {
+      WriteUnaligned32 ((UINT32 *)Buffer, MmioRead32 ((UINTN)&TisReg->DataFifo));
+      Buffer += sizeof (UINT32);
+    }
+  }
+
+  for ( ; Size > 0; Size--) {
+    *Buffer = MmioRead8 ((UINTN)&TisReg->DataFifo);
+    Buffer++;
+  }
+}
+
 /**
   Send a command to TPM for execution and return response data.
 
@@ -221,6 +318,8 @@ Tpm2TisTpmCommand (
   UINT32      TpmOutSize;
   UINT16      Data16;
   UINT32      Data32;
+  UINT32      Size;
+  BOOLEAN     WideFifo;
 
   DEBUG_CODE_BEGIN ();
   UINTN  DebugSize;
@@ -253,6 +352,8 @@ Tpm2TisTpmCommand (
     return EFI_DEVICE_ERROR;
   }
 
+  WideFifo = TisPcIsWideFifo (TisReg);
+
   //
   // Send the command data to Tpm
   //
@@ -264,10 +365,9 @@ Tpm2TisTpmCommand (
       goto Exit;
     }
 
-    for ( ; BurstCount > 0 && Index < SizeIn; BurstCount--) {
-      MmioWrite8 ((UINTN)&TisReg->DataFifo, *(BufferIn + Index));
-      Index++;
-    }
+    Size = MIN (BurstCount, SizeIn - Index);
+    TisPcWriteFifo (TisReg, WideFifo, BufferIn + Index, Size);
+    Index += Size;
   }
 
   //
@@ -338,13 +438,10 @@ Tpm2TisTpmCommand (
       goto Exit;
     }
 
-    for ( ; BurstCount > 0; BurstCount--) {
-      *(BufferOut + Index) = MmioRead8 ((UINTN)&TisReg->DataFifo);
-      Index++;
-      if (Index == sizeof (TPM2_RESPONSE_HEADER)) {
-        break;
-      }
-    }
+    Size = MIN (BurstCount, sizeof (TPM2_RESPONSE_HEADER) - Index);
+    TisPcReadFifo (TisReg, WideFifo, BufferOut + Index, Size);
+    Index      += Size;
+    BurstCount -= (UINT16)Size;
   }
 
   DEBUG_CODE_BEGIN ();
@@ -378,20 +475,18 @@ Tpm2TisTpmCommand (
   // Continue reading the remaining data
   //
   while ( Index < TpmOutSize ) {
-    for ( ; BurstCount > 0; BurstCount--) {
-      *(BufferOut + Index) = MmioRead8 ((UINTN)&TisReg->DataFifo);
-      Index++;
-      if (Index == TpmOutSize) {
-        Status = EFI_SUCCESS;
+    if (BurstCount == 0) {
+      Status = TisPcReadBurstCount (TisReg, &BurstCount);
+      if (EFI_ERROR (Status)) {
+        Status = EFI_DEVICE_ERROR;
         goto Exit;
       }
     }
 
-    Status = TisPcReadBurstCount (TisReg, &BurstCount);
-    if (EFI_ERROR (Status)) {
-      Status = EFI_DEVICE_ERROR;
-      goto Exit;
-    }
+    Size = MIN (BurstCount, TpmOutSize - Index);
+    TisPcReadFifo (TisReg, WideFifo, BufferOut + Index, Size);
+    Index      += Size;
+    BurstCount -= (UINT16)Size;
   }
 
 Exit:
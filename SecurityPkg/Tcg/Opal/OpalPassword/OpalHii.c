@@ -1271,7 +1271,12 @@ OpalDiskInitialize (
   Session.Sscp    = Dev->Sscp;
   Session.MediaId = Dev->MediaId;
 
-  TcgResult = OpalGetSupportedAttributesInfo (&Session, &Dev->OpalDisk.SupportedAttributes, &Dev->OpalDisk.OpalBaseComId);
+  TcgResult = OpalGetSupportedAttributesAndLockingInfo (
+                &Session,
+                &Dev->OpalDisk.SupportedAttributes,
+                &Dev->OpalDisk.OpalBaseComId,
+                &Dev->OpalDisk.LockingFeature
+                );
   if (TcgResult != TcgResultSuccess) {
     return EFI_DEVICE_ERROR;
   }
@@ -1297,7 +1302,10 @@ OpalDiskInitialize (
     Dev->OpalDisk.EstimateTimeCost = RemovalMechanishLists[ActiveDataRemovalMechanism];
   }
 
-  return OpalDiskUpdateStatus (&Dev->OpalDisk);
+  //
+  // The locking info came with the level 0 discovery above, only the ownership is left.
+  //
+  return OpalDiskUpdateOwnerShip (&Dev->OpalDisk);
 }
 
 /**
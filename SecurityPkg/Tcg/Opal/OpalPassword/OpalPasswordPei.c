@@ -234,18 +234,12 @@ IsOpalDeviceLocked (
   Session.Sscp    = &OpalDev->Sscp;
   Session.MediaId = 0;
 
-  Ret = OpalGetSupportedAttributesInfo (&Session, &SupportedAttributes, &OpalBaseComId);
+  Ret = OpalGetSupportedAttributesAndLockingInfo (&Session, &SupportedAttributes, &OpalBaseComId, &LockingFeature);
   if (Ret != TcgResultSuccess) {
     return FALSE;
   }
 
-  Session.OpalBaseComId = OpalBaseComId;
-  *BlockSidSupported    = SupportedAttributes.BlockSid == 1 ? TRUE : FALSE;
-
-  Ret = OpalGetLockingInfo (&Session, &LockingFeature);
-  if (Ret != TcgResultSuccess) {
-    return FALSE;
-  }
+  *BlockSidSupported = SupportedAttributes.BlockSid == 1 ? TRUE : FALSE;
 
   return OpalDeviceLocked (&SupportedAttributes, &LockingFeature);
 }
@@ -56,6 +56,11 @@ typedef struct {
 #define  TCG2_DEFAULT_MAX_COMMAND_SIZE   0x1000
 #define  TCG2_DEFAULT_MAX_RESPONSE_SIZE  0x1000
 
+//
+// Number of PCR extends that are deferred when PcdTcg2DeferPcrExtend is TRUE.
+//
+#define  TCG2_DEFERRED_PCR_EXTEND_COUNT  64
+
 typedef struct {
   EFI_GUID                     *EventGuid;
   EFI_TCG2_EVENT_LOG_FORMAT    LogFormat;
@@ -116,6 +121,32 @@ VARIABLE_TYPE  mVariableType[] = {
 
 EFI_HANDLE  mImageHandle;
 
+/**
+  Submit the PCR extends that have been deferred to the TPM.
+
+  @retval EFI_SUCCESS       All deferred PCR extends have been submitted.
+  @retval EFI_DEVICE_ERROR  A PCR extend was unsuccessful, the TPM is disabled.
+**/
+EFI_STATUS
+FlushDeferredPcrExtends (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+
+  Status = Tpm2PcrExtendQueueFlush ();
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "FlushDeferredPcrExtends - %r. Disable TPM.\n", Status));
+    mTcgDxeData.BsCap.TPMPresentFlag = FALSE;
+    REPORT_STATUS_CODE (
+      EFI_ERROR_CODE | EFI_ERROR_MINOR,
+      (PcdGet32 (PcdStatusCodeSubClassTpmDevice) | EFI_P_EC_INTERFACE_ERROR)
+      );
+  }
+
+  return Status;
+}
+
 /**
   Measure PE image into TPM log based on the authenticode image hashing in
   PE/COFF Specification 8.0 Appendix A.
@@ -1427,6 +1458,14 @@ Tcg2SubmitCommand (
     return EFI_INVALID_PARAMETER;
   }
 
+  //
+  // The command may observe the PCR values.
+  //
+  Status = FlushDeferredPcrExtends ();
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
   Status = Tpm2SubmitCommand (
              InputParameterBlockSize,
              InputParameterBlock,
@@ -2548,6 +2587,11 @@ OnReadyToBoot (
     }
   }
 
+  //
+  // Control is about to be handed to the boot option.
+  //
+  FlushDeferredPcrExtends ();
+
   DEBUG ((DEBUG_INFO, "TPM2 Tcg2Dxe Measure Data when ReadyToBoot\n"));
   //
   // Increase boot attempt counter.
@@ -2595,6 +2639,8 @@ OnExitBootServices (
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "%a not Measured. Error!\n", EFI_EXIT_BOOT_SERVICES_SUCCEEDED));
   }
+
+  FlushDeferredPcrExtends ();
 }
 
 /**
@@ -2625,6 +2671,8 @@ OnExitBootServicesFailed (
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "%a not Measured. Error!\n", EFI_EXIT_BOOT_SERVICES_FAILED));
   }
+
+  FlushDeferredPcrExtends ();
 }
 
 /**
@@ -2736,6 +2784,7 @@ DriverEntry (
   EFI_TCG2_EVENT_ALGORITHM_BITMAP  TpmHashAlgorithmBitmap;
   UINT32                           ActivePCRBanks;
   UINT32                           NumberOfPCRBanks;
+  TPM2_PCR_EXTEND_QUEUE_ENTRY      *PcrExtendQueue;
 
   mImageHandle = ImageHandle;
 
@@ -2849,6 +2898,19 @@ DriverEntry (
     Status = SetupEventLog ();
     ASSERT_EFI_ERROR (Status);
 
+    //
+    // Defer the PCR extends of the measurements, they are submitted to the TPM
+    // before any TPM command is submitted through the protocol, and at
+    // ReadyToBoot and ExitBootServices.
+    //
+    if (PcdGetBool (PcdTcg2DeferPcrExtend)) {
+      PcrExtendQueue = AllocatePool (TCG2_DEFERRED_PCR_EXTEND_COUNT * sizeof (TPM2_PCR_EXTEND_QUEUE_ENTRY));
+      if (PcrExtendQueue != NULL) {
+        Status = Tpm2PcrExtendQueueStart (PcrExtendQueue, TCG2_DEFERRED_PCR_EXTEND_COUNT);
+        ASSERT_EFI_ERROR (Status);
+      }
+    }
+
     //
     // Measure handoff tables, Boot#### variables etc.
     //
@@ -1280,7 +1280,8 @@ LocateStartupScript (
 /**
   Handles all interaction with the default startup script.
 
-  this will check that the correct command line parameters were passed, handle the delay, and then start running the script.
+  this will check that the correct command line parameters were passed, find the script, handle the delay, and then start running the script.
+  There is no delay when there is no script to run.
 
   @param ImagePath              the path to the image for shell.  first place to look for the startup script
   @param FilePath               the path to the file for shell.  second place to look for the startup script.
@@ -1345,6 +1346,15 @@ DoStartupScript (
     return (EFI_SUCCESS);
   }
 
+  //
+  // Do not make the user wait for a startup script that does not exist.
+  // Startup script is not mandatory, so return success.
+  //
+  FileStringPath = LocateStartupScript (ImagePath, FilePath);
+  if (FileStringPath == NULL) {
+    return (EFI_SUCCESS);
+  }
+
   gST->ConOut->EnableCursor (gST->ConOut, FALSE);
   //
   // print out our warning and see if they press a key
@@ -1368,27 +1378,20 @@ DoStartupScript (
   // ESC was pressed
   //
   if ((Status == EFI_SUCCESS) && (Key.UnicodeChar == 0) && (Key.ScanCode == SCAN_ESC)) {
+    FreePool (FileStringPath);
     return (EFI_SUCCESS);
   }
 
-  FileStringPath = LocateStartupScript (ImagePath, FilePath);
-  if (FileStringPath != NULL) {
-    FullFileStringPath = FullyQualifyPath (FileStringPath);
-    if (FullFileStringPath == NULL) {
-      Status = RunScriptFile (FileStringPath, NULL, FileStringPath, ShellInfoObject.NewShellParametersProtocol);
-    } else {
-      Status = RunScriptFile (FullFileStringPath, NULL, FullFileStringPath, ShellInfoObject.NewShellParametersProtocol);
-      FreePool (FullFileStringPath);
-    }
-
-    FreePool (FileStringPath);
+  FullFileStringPath = FullyQualifyPath (FileStringPath);
+  if (FullFileStringPath == NULL) {
+    Status = RunScriptFile (FileStringPath, NULL, FileStringPath, ShellInfoObject.NewShellParametersProtocol);
   } else {
-    //
-    // we return success since startup script is not mandatory.
-    //
-    Status = EFI_SUCCESS;
+    Status = RunScriptFile (FullFileStringPath, NULL, FullFileStringPath, ShellInfoObject.NewShellParametersProtocol);
+    FreePool (FullFileStringPath);
   }
 
+  FreePool (FileStringPath);
+
   return (Status);
 }
 
@@ -80,6 +80,7 @@ STATIC CONST SHELL_PARAM_ITEM  ParamList[] = {
   { L"-A", TypeFlag  }, // -A   All, Cooked
   { L"-R", TypeFlag  }, // -R   RAW All
   { L"-s", TypeFlag  }, // -s   Summary
+  { L"-d", TypeFlag  }, // -d   Time by Driver
   { L"-x", TypeFlag  }, // -x   eXclude Cumulative Items
   { L"-i", TypeFlag  }, // -i   Display Identifier
   { L"-c", TypeValue }, // -c   Display cumulative data.
@@ -686,6 +687,7 @@ RunDp (
   BOOLEAN        RawMode;
   BOOLEAN        ExcludeMode;
   BOOLEAN        CumulativeMode;
+  BOOLEAN        DriverMode;
   CONST CHAR16   *CustomCumulativeToken;
   PERF_CUM_DATA  *CustomCumulativeData;
   UINTN          NameSize;
@@ -700,6 +702,7 @@ RunDp (
   RawMode              = FALSE;
   ExcludeMode          = FALSE;
   CumulativeMode       = FALSE;
+  DriverMode           = FALSE;
   CustomCumulativeData = NULL;
   ShellStatus          = SHELL_SUCCESS;
 
@@ -731,6 +734,7 @@ RunDp (
   ExcludeMode    = ShellCommandLineGetFlag (ParamPackage, L"-x");
   mShowId        = ShellCommandLineGetFlag (ParamPackage, L"-i");
   CumulativeMode = ShellCommandLineGetFlag (ParamPackage, L"-c");
+  DriverMode     = ShellCommandLineGetFlag (ParamPackage, L"-d");
 
   if (AllMode && RawMode) {
     ShellPrintHiiEx (-1, -1, NULL, STRING_TOKEN (STR_DP_CONFLICT_ARG), mDpHiiHandle, L"-A", L"-R");
@@ -910,6 +914,7 @@ RunDp (
   ****                      Default is 0 for All and Raw mode
   ****                      Default is DEFAULT_THRESHOLD for "Cooked" mode
   ****    n Number2Display  Used by All and Raw mode.  Otherwise ignored.
+  ****    d Driver      --  A, R and S options are ignored
   ****    A All         --  R and S options are ignored
   ****    R Raw         --  S option is ignored
   ****    s Summary     --  Modifies "Cooked" output only
@@ -918,6 +923,15 @@ RunDp (
   GatherStatistics (CustomCumulativeData);
   if (CumulativeMode) {
     ProcessCumulative (CustomCumulativeData);
+  } else if (DriverMode) {
+    Status = ProcessDriverTimes ();
+    if (Status == EFI_ABORTED) {
+      ShellStatus = SHELL_ABORTED;
+      goto Done;
+    } else if (Status == EFI_OUT_OF_RESOURCES) {
+      ShellStatus = SHELL_OUT_OF_RESOURCES;
+      goto Done;
+    }
   } else if (AllMode) {
     Status = DumpAllTrace (Number2Display, ExcludeMode);
     if (Status == EFI_ABORTED) {
@@ -38,7 +38,7 @@
 extern EFI_HII_HANDLE  mDpHiiHandle;
 
 #define DP_MAJOR_VERSION  2
-#define DP_MINOR_VERSION  5
+#define DP_MINOR_VERSION  6
 
 /**
   * The value assigned to DP_DEBUG controls which debug output
@@ -108,6 +108,15 @@ typedef struct {
   UINT32    Count;                        ///< Number of measurements accumulated.
 } PROFILE_RECORD;
 
+typedef struct {
+  CONST VOID    *Handle;                  ///< Image handle of the driver.
+  UINT64        LoadImage;                ///< Time spent in LoadImage().
+  UINT64        StartImage;               ///< Time spent in the entry point.
+  UINT64        Support;                  ///< Time spent in the Supported() calls.
+  UINT64        Start;                    ///< Time spent in the Start() calls.
+  UINT64        Total;                    ///< Sum of the times above.
+} DRIVER_TIME_RECORD;
+
 /**
   Dump performance data.
 
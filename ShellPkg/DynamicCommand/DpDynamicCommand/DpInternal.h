@@ -267,6 +267,24 @@ ProcessHandles (
   IN BOOLEAN  ExcludeFlag
   );
 
+/**
+  Gather and print the time of each driver.
+
+  The LoadImage, StartImage, DB:Support and DB:Start measurements are added up
+  by driver image handle, and the drivers are displayed by decreasing total
+  time. Drivers whose total time is less than mInterestThreshold microseconds
+  are not displayed.
+
+  @retval EFI_SUCCESS             The operation was successful.
+  @retval EFI_ABORTED             The user aborts the operation.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to gather the driver times.
+  @return Others                  from a call to gBS->LocateHandleBuffer().
+**/
+EFI_STATUS
+ProcessDriverTimes (
+  VOID
+  );
+
 /**
   Gather and print PEIM data.
 
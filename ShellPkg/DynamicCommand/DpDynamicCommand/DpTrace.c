@@ -735,6 +735,204 @@ ProcessHandles (
   return Status;
 }
 
+/**
+  Compare two driver time records by their total time, the longest first.
+
+  @param[in] Buffer1    The first DRIVER_TIME_RECORD.
+  @param[in] Buffer2    The second DRIVER_TIME_RECORD.
+
+  @retval <0    Buffer1 has the longer total time.
+  @retval 0     Both have the same total time.
+  @retval >0    Buffer2 has the longer total time.
+**/
+INTN
+EFIAPI
+CompareDriverTime (
+  IN CONST VOID  *Buffer1,
+  IN CONST VOID  *Buffer2
+  )
+{
+  UINT64  Total1;
+  UINT64  Total2;
+
+  Total1 = ((CONST DRIVER_TIME_RECORD *)Buffer1)->Total;
+  Total2 = ((CONST DRIVER_TIME_RECORD *)Buffer2)->Total;
+  if (Total1 > Total2) {
+    return -1;
+  } else if (Total1 < Total2) {
+    return 1;
+  }
+
+  return 0;
+}
+
+/**
+  Gather and print the time of each driver.
+
+  The LoadImage, StartImage, DB:Support and DB:Start measurements are added up
+  by driver image handle, and the drivers are displayed by decreasing total
+  time. Drivers whose total time is less than mInterestThreshold microseconds
+  are not displayed.
+
+  @retval EFI_SUCCESS             The operation was successful.
+  @retval EFI_ABORTED             The user aborts the operation.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to gather the driver times.
+  @return Others                  from a call to gBS->LocateHandleBuffer().
+**/
+EFI_STATUS
+ProcessDriverTimes (
+  VOID
+  )
+{
+  MEASUREMENT_RECORD  Measurement;
+  DRIVER_TIME_RECORD  *DriverTimes;
+  DRIVER_TIME_RECORD  *DriverTime;
+  UINTN               DriverCount;
+  UINT64              *Field;
+  UINT64              Duration;
+  UINT64              Total;
+  EFI_HANDLE          *HandleBuffer;
+  EFI_STRING          StringPtr;
+  EFI_STRING          StringPtrUnknown;
+  UINTN               Index;
+  UINTN               HandleIndex;
+  UINTN               LogEntryKey;
+  UINTN               HandleCount;
+  EFI_STATUS          Status;
+
+  StringPtrUnknown = HiiGetString (mDpHiiHandle, STRING_TOKEN (STR_ALIT_UNKNOWN), NULL);
+  StringPtr        = HiiGetString (mDpHiiHandle, STRING_TOKEN (STR_DP_SECTION_DRIVER_TIMES), NULL);
+  ShellPrintHiiEx (
+    -1,
+    -1,
+    NULL,
+    STRING_TOKEN (STR_DP_SECTION_HEADER),
+    mDpHiiHandle,
+    (StringPtr == NULL) ? StringPtrUnknown : StringPtr
+    );
+  FreePool (StringPtr);
+  FreePool (StringPtrUnknown);
+
+  Status = gBS->LocateHandleBuffer (AllHandles, NULL, NULL, &HandleCount, &HandleBuffer);
+  if (EFI_ERROR (Status)) {
+    ShellPrintHiiEx (-1, -1, NULL, STRING_TOKEN (STR_DP_HANDLES_ERROR), mDpHiiHandle, Status);
+    return Status;
+  }
+
+  DriverTimes = AllocateZeroPool ((mMeasurementNum + 1) * sizeof (DRIVER_TIME_RECORD));
+  if (DriverTimes == NULL) {
+    FreePool (HandleBuffer);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  //
+  // Add up the durations of the measurements of each driver.
+  //
+  DriverCount = 0;
+  LogEntryKey = 0;
+  while ((LogEntryKey = GetPerformanceMeasurementRecord (
+                          LogEntryKey,
+                          &Measurement.Handle,
+                          &Measurement.Token,
+                          &Measurement.Module,
+                          &Measurement.StartTimeStamp,
+                          &Measurement.EndTimeStamp,
+                          &Measurement.Identifier
+                          )) != 0)
+  {
+    if ((Measurement.EndTimeStamp == 0) || (Measurement.Handle == NULL) ||
+        (Measurement.Token == NULL) || !IsCorePerf (&Measurement))
+    {
+      continue;
+    }
+
+    for (Index = 0; Index < DriverCount; Index++) {
+      if (DriverTimes[Index].Handle == Measurement.Handle) {
+        break;
+      }
+    }
+
+    DriverTime = &DriverTimes[Index];
+    if (AsciiStrCmp (Measurement.Token, ALit_LOAD_IMAGE) == 0) {
+      Field = &DriverTime->LoadImage;
+    } else if (AsciiStrCmp (Measurement.Token, ALit_START_IMAGE) == 0) {
+      Field = &DriverTime->StartImage;
+    } else if (AsciiStrCmp (Measurement.Token, ALit_DB_SUPPORT) == 0) {
+      Field = &DriverTime->Support;
+    } else if (AsciiStrCmp (Measurement.Token, ALit_DB_START) == 0) {
+      Field = &DriverTime->Start;
+    } else {
+      continue;
+    }
+
+    if (Index == DriverCount) {
+      DriverTime->Handle = Measurement.Handle;
+      DriverCount++;
+    }
+
+    Duration           = GetDuration (&Measurement);
+    *Field            += Duration;
+    DriverTime->Total += Duration;
+  }
+
+  PerformQuickSort (DriverTimes, DriverCount, sizeof (DRIVER_TIME_RECORD), CompareDriverTime);
+
+  ShellPrintHiiEx (-1, -1, NULL, STRING_TOKEN (STR_DP_DRIVER_TIME_SECTION), mDpHiiHandle);
+  ShellPrintHiiEx (-1, -1, NULL, STRING_TOKEN (STR_DP_DASHES), mDpHiiHandle);
+
+  for (Index = 0; Index < DriverCount; Index++) {
+    DriverTime = &DriverTimes[Index];
+    Total      = DurationInMicroSeconds (DriverTime->Total);
+    if (Total < mInterestThreshold) {
+      //
+      // The records are sorted, so the remaining ones are below the threshold too.
+      //
+      break;
+    }
+
+    mGaugeString[0] = 0;    // Empty driver name by default
+    for (HandleIndex = 0; HandleIndex < HandleCount; HandleIndex++) {
+      if (DriverTime->Handle == HandleBuffer[HandleIndex]) {
+        DpGetNameFromHandle (HandleBuffer[HandleIndex]); // Name is put into mGaugeString
+        break;
+      }
+    }
+
+    if (mGaugeString[0] == 0) {
+      //
+      // The driver is unloaded, so its name is not known anymore.
+      //
+      continue;
+    }
+
+    // Ensure that the name fits in its column.
+    mGaugeString[17] = 0;
+    ShellPrintHiiEx (
+      -1,
+      -1,
+      NULL,
+      STRING_TOKEN (STR_DP_DRIVER_TIME_VARS),
+      mDpHiiHandle,
+      Index + 1,  // 1 based, rank of the driver
+      mGaugeString,
+      DurationInMicroSeconds (DriverTime->LoadImage),
+      DurationInMicroSeconds (DriverTime->StartImage),
+      DurationInMicroSeconds (DriverTime->Support),
+      DurationInMicroSeconds (DriverTime->Start),
+      Total
+      );
+
+    if (ShellGetExecutionBreakFlag ()) {
+      Status = EFI_ABORTED;
+      break;
+    }
+  }
+
+  FreePool (DriverTimes);
+  FreePool (HandleBuffer);
+  return Status;
+}
+
 /**
   Gather and print PEIM data.
 
@@ -176,6 +176,9 @@ VerifyChecksum (
 /**
   This function performs a raw data dump of the ACPI table.
 
+  The hexadecimal dump of each line is collected in a buffer and printed
+  along with the ASCII dump, so that a line is only one call to Print ().
+
   @param [in] Ptr     Pointer to the start of the table buffer.
   @param [in] Length  The length of the buffer.
 **/
@@ -186,13 +189,16 @@ DumpRaw (
   IN UINT32  Length
   )
 {
-  UINTN  ByteCount;
-  UINTN  PartLineChars;
-  UINTN  AsciiBufferIndex;
-  CHAR8  AsciiBuffer[17];
+  STATIC CONST CHAR16  HexDigits[] = L"0123456789ABCDEF";
+  UINTN                ByteCount;
+  UINTN                AsciiBufferIndex;
+  UINTN                HexBufferIndex;
+  CHAR8                AsciiBuffer[17];
+  CHAR16               HexBuffer[51];
 
   ByteCount        = 0;
   AsciiBufferIndex = 0;
+  HexBufferIndex   = 0;
 
   Print (L"Address  : 0x%p\n", Ptr);
   Print (L"Length   : %d\n", Length);
@@ -200,10 +206,13 @@ DumpRaw (
   while (ByteCount < Length) {
     if ((ByteCount & 0x0F) == 0) {
       AsciiBuffer[AsciiBufferIndex] = '\0';
-      Print (L"  %a\n%08X : ", AsciiBuffer, ByteCount);
+      HexBuffer[HexBufferIndex]     = L'\0';
+      Print (L"%s  %a\n%08X : ", HexBuffer, AsciiBuffer, ByteCount);
       AsciiBufferIndex = 0;
+      HexBufferIndex   = 0;
     } else if ((ByteCount & 0x07) == 0) {
-      Print (L"- ");
+      HexBuffer[HexBufferIndex++] = L'-';
+      HexBuffer[HexBufferIndex++] = L' ';
     }
 
     if ((*Ptr >= ' ') && (*Ptr < 0x7F)) {
@@ -212,29 +221,26 @@ DumpRaw (
       AsciiBuffer[AsciiBufferIndex++] = '.';
     }
 
-    Print (L"%02X ", *Ptr++);
+    HexBuffer[HexBufferIndex++] = HexDigits[*Ptr >> 4];
+    HexBuffer[HexBufferIndex++] = HexDigits[*Ptr & 0x0F];
+    HexBuffer[HexBufferIndex++] = L' ';
+    Ptr++;
 
     ByteCount++;
   }
 
   // Justify the final line using spaces before printing
   // the ASCII data.
-  PartLineChars = (Length & 0x0F);
-  if (PartLineChars != 0) {
-    PartLineChars = 48 - (PartLineChars * 3);
-    if ((Length & 0x0F) <= 8) {
-      PartLineChars += 2;
-    }
-
-    while (PartLineChars > 0) {
-      Print (L" ");
-      PartLineChars--;
+  if (HexBufferIndex != 0) {
+    while (HexBufferIndex < (ARRAY_SIZE (HexBuffer) - 1)) {
+      HexBuffer[HexBufferIndex++] = L' ';
     }
   }
 
-  // Print ASCII data for the final line.
+  // Print the final line.
   AsciiBuffer[AsciiBufferIndex] = '\0';
-  Print (L"  %a\n\n", AsciiBuffer);
+  HexBuffer[HexBufferIndex]     = L'\0';
+  Print (L"%s  %a\n\n", HexBuffer, AsciiBuffer);
 }
 
 /**
@@ -11,6 +11,14 @@
 #include <Guid/FileSystemInfo.h>
 #include <Guid/FileSystemVolumeLabelInfo.h>
 
+//
+// Size of the buffer used to copy the data of a file. It is larger than
+// PcdShellFileOperationSize as every read and write of a file system is a
+// request to the storage device, and the small requests are slow on USB mass
+// storage devices.
+//
+#define CP_BUFFER_SIZE  SIZE_1MB
+
 /**
   Function to take a list of files to copy and a destination location and do
   the verification and copying of those files to that location.  This function
@@ -61,6 +69,7 @@ CopySingleFile (
 {
   VOID                  *Response;
   UINTN                 ReadSize;
+  UINTN                 BufferSize;
   SHELL_FILE_HANDLE     SourceHandle;
   SHELL_FILE_HANDLE     DestHandle;
   EFI_STATUS            Status;
@@ -84,7 +93,6 @@ CopySingleFile (
   DestVolumeInfo = NULL;
   ShellStatus    = SHELL_SUCCESS;
 
-  ReadSize = PcdGet32 (PcdShellFileOperationSize);
   // Why bother copying a file to itself
   if (StrCmp (Source, Dest) == 0) {
     return (SHELL_SUCCESS);
@@ -225,13 +233,20 @@ CopySingleFile (
       //
       // copy data between files
       //
-      Buffer = AllocateZeroPool (ReadSize);
+      BufferSize = MAX (PcdGet32 (PcdShellFileOperationSize), CP_BUFFER_SIZE);
+      Buffer     = AllocatePool (BufferSize);
+      if (Buffer == NULL) {
+        BufferSize = PcdGet32 (PcdShellFileOperationSize);
+        Buffer     = AllocatePool (BufferSize);
+      }
+
       if (Buffer == NULL) {
         ShellPrintHiiEx (-1, -1, NULL, STRING_TOKEN (STR_GEN_OUT_MEM), gShellLevel2HiiHandle, CmdName);
         return SHELL_OUT_OF_RESOURCES;
       }
 
-      while (ReadSize == PcdGet32 (PcdShellFileOperationSize) && !EFI_ERROR (Status)) {
+      ReadSize = BufferSize;
+      while (ReadSize == BufferSize && !EFI_ERROR (Status)) {
         Status = ShellReadFile (SourceHandle, &ReadSize, Buffer);
         if (!EFI_ERROR (Status)) {
           Status = ShellWriteFile (DestHandle, &ReadSize, Buffer);
@@ -246,6 +261,8 @@ CopySingleFile (
           break;
         }
       }
+
+      FreePool (Buffer);
     }
 
     SHELL_FREE_NON_NULL (DestVolumeInfo);
@@ -22,11 +22,17 @@
 typedef struct {
   UINTN         Signature;
   LIST_ENTRY    AllEntries; // All entries
+  LIST_ENTRY    HashLink;   // Link on the hash bucket of HandlerType
 
   EFI_GUID      HandlerType; // Type of interrupt
   LIST_ENTRY    MmiHandlers; // All handlers
 } MMI_ENTRY;
 
+//
+// Number of hash buckets of the MMI entries, must be a power of 2
+//
+#define MMI_ENTRY_HASH_SIZE  32
+
 #define MMI_HANDLER_SIGNATURE  SIGNATURE_32('m','m','i','h')
 
 typedef struct {
@@ -45,6 +51,40 @@ UINTN  mMmiManageCallingDepth = 0;
 LIST_ENTRY  mRootMmiHandlerList = INITIALIZE_LIST_HEAD_VARIABLE (mRootMmiHandlerList);
 LIST_ENTRY  mMmiEntryList       = INITIALIZE_LIST_HEAD_VARIABLE (mMmiEntryList);
 
+//
+// The MMI entries hashed by HandlerType, so that MmiManage() does not have to
+// compare the GUID of every registered entry. The buckets are initialized
+// when they are first used.
+//
+LIST_ENTRY  mMmiEntryHashList[MMI_ENTRY_HASH_SIZE];
+
+/**
+  Returns the hash bucket of the MMI entries of a handler type.
+
+  @param  HandlerType  The type of the interrupt
+
+  @return The list head of the hash bucket.
+
+**/
+LIST_ENTRY *
+GetMmiEntryHashBucket (
+  IN CONST EFI_GUID  *HandlerType
+  )
+{
+  LIST_ENTRY  *Bucket;
+
+  Bucket = &mMmiEntryHashList[
+                              (ReadUnaligned32 ((CONST UINT32 *)HandlerType) ^
+                               ReadUnaligned32 ((CONST UINT32 *)&HandlerType->Data4[4])) &
+                              (MMI_ENTRY_HASH_SIZE - 1)
+           ];
+  if (Bucket->ForwardLink == NULL) {
+    InitializeListHead (Bucket);
+  }
+
+  return Bucket;
+}
+
 /**
   Remove MmiHandler and free the memory it used.
   If MmiEntry is empty, remove MmiEntry and free the memory it used.
@@ -71,6 +111,7 @@ RemoveMmiHandler (
   if (MmiEntry != NULL) {
     if (IsListEmpty (&MmiEntry->MmiHandlers)) {
       RemoveEntryList (&MmiEntry->AllEntries);
+      RemoveEntryList (&MmiEntry->HashLink);
       FreePool (MmiEntry);
       return TRUE;
     }
@@ -95,19 +136,21 @@ MmCoreFindMmiEntry (
   IN BOOLEAN   Create
   )
 {
+  LIST_ENTRY  *Bucket;
   LIST_ENTRY  *Link;
   MMI_ENTRY   *Item;
   MMI_ENTRY   *MmiEntry;
 
   //
-  // Search the MMI entry list for the matching GUID
+  // Search the hash bucket of the MMI entries for the matching GUID
   //
   MmiEntry = NULL;
-  for (Link = mMmiEntryList.ForwardLink;
-       Link != &mMmiEntryList;
+  Bucket   = GetMmiEntryHashBucket (HandlerType);
+  for (Link = Bucket->ForwardLink;
+       Link != Bucket;
        Link = Link->ForwardLink)
   {
-    Item = CR (Link, MMI_ENTRY, AllEntries, MMI_ENTRY_SIGNATURE);
+    Item = CR (Link, MMI_ENTRY, HashLink, MMI_ENTRY_SIGNATURE);
     if (CompareGuid (&Item->HandlerType, HandlerType)) {
       //
       // This is the MMI entry
@@ -132,9 +175,10 @@ MmCoreFindMmiEntry (
       InitializeListHead (&MmiEntry->MmiHandlers);
 
       //
-      // Add it to MMI entry list
+      // Add it to MMI entry list and to its hash bucket
       //
       InsertTailList (&mMmiEntryList, &MmiEntry->AllEntries);
+      InsertTailList (Bucket, &MmiEntry->HashLink);
     }
   }
 
@@ -87,8 +87,9 @@ PAGE_ATTRIBUTE_TABLE  mPageAttributeTable[] = {
   { Page1G, SIZE_1GB, PAGING_1G_ADDRESS_MASK_64 },
 };
 
-PAGE_TABLE_POOL                *mPageTablePool    = NULL;
-BOOLEAN                        mPageTablePoolLock = FALSE;
+PAGE_TABLE_POOL                *mPageTablePool      = NULL;
+BOOLEAN                        mPageTablePoolLock  = FALSE;
+VOID                           *mFreePageTablePages = NULL;
 PAGE_TABLE_LIB_PAGING_CONTEXT  mPagingContext;
 EFI_SMM_BASE2_PROTOCOL         *mSmmBase2 = NULL;
 
@@ -1217,6 +1218,15 @@ AllocatePageTableMemory (
     return NULL;
   }
 
+  //
+  // Reuse a page freed by page table compaction if possible.
+  //
+  if ((Pages == 1) && (mFreePageTablePages != NULL)) {
+    Buffer              = mFreePageTablePages;
+    mFreePageTablePages = *(VOID **)Buffer;
+    return Buffer;
+  }
+
   //
   // Renew the pool if necessary.
   //
@@ -1236,6 +1246,308 @@ AllocatePageTableMemory (
   return Buffer;
 }
 
+/**
+  Give a page of a page table that is no longer used back for page table use.
+
+  Only the pages allocated from the page table pool are reused. Other pages,
+  such as those of the page table created before this driver, are left alone.
+
+  The caller must make sure that the page table pool is writable.
+
+  @param[in] Buffer      The page that is no longer used.
+**/
+VOID
+FreePageTableMemory (
+  IN VOID  *Buffer
+  )
+{
+  PAGE_TABLE_POOL  *Pool;
+  UINTN            PoolSize;
+
+  Pool = mPageTablePool;
+  if (Pool == NULL) {
+    return;
+  }
+
+  do {
+    PoolSize = Pool->Offset + EFI_PAGES_TO_SIZE (Pool->FreePages);
+    if (((UINTN)Buffer >= (UINTN)Pool) && ((UINTN)Buffer < (UINTN)Pool + PoolSize)) {
+      *(VOID **)Buffer    = mFreePageTablePages;
+      mFreePageTablePages = Buffer;
+      return;
+    }
+
+    Pool = Pool->NextPool;
+  } while (Pool != mPageTablePool);
+}
+
+/**
+  Replace a non-leaf page entry with a leaf entry mapping a large page, if all
+  the entries of the page table it points to map contiguous memory with the
+  same attributes.
+
+  The access rights of the new leaf entry are those the non-leaf entry grants
+  to the memory in combination with those of the child entries.
+
+  @param[in, out] PageEntry        The non-leaf page entry.
+  @param[in]      ChildAttribute   The page attribute of the child entries, Page4K or Page2M.
+  @param[in]      AddressEncMask   The memory encryption mask of the page entries.
+
+  @retval TRUE   The page entry is replaced with a large page.
+  @retval FALSE  The page entry is unchanged.
+**/
+BOOLEAN
+MergePageTable (
+  IN OUT UINT64          *PageEntry,
+  IN     PAGE_ATTRIBUTE  ChildAttribute,
+  IN     UINT64          AddressEncMask
+  )
+{
+  UINT64  *PageTable;
+  UINT64  ChildLength;
+  UINT64  FirstEntry;
+  UINT64  NewPageEntry;
+  UINTN   Index;
+
+  PageTable   = (UINT64 *)(UINTN)(*PageEntry & ~AddressEncMask & PAGING_4K_ADDRESS_MASK_64);
+  ChildLength = PageAttributeToLength (ChildAttribute);
+  FirstEntry  = PageTable[0];
+
+  if ((FirstEntry & IA32_PG_P) == 0) {
+    return FALSE;
+  }
+
+  if ((ChildAttribute == Page2M) && ((FirstEntry & IA32_PG_PS) == 0)) {
+    return FALSE;
+  }
+
+  if ((FirstEntry & ~AddressEncMask & PAGING_4K_ADDRESS_MASK_64 & (ChildLength * 512 - 1)) != 0) {
+    return FALSE;
+  }
+
+  //
+  // The CPU may set Accessed and Dirty differently in each entry.
+  //
+  for (Index = 1; Index < SIZE_4KB / sizeof (UINT64); Index++) {
+    if ((PageTable[Index] & ~(UINT64)(IA32_PG_A | IA32_PG_D)) !=
+        (FirstEntry & ~(UINT64)(IA32_PG_A | IA32_PG_D)) + ChildLength * Index)
+    {
+      return FALSE;
+    }
+  }
+
+  NewPageEntry = FirstEntry | IA32_PG_PS;
+  if (ChildAttribute == Page4K) {
+    NewPageEntry &= ~(UINT64)IA32_PG_PAT_4K;
+    if ((FirstEntry & IA32_PG_PAT_4K) != 0) {
+      NewPageEntry |= IA32_PG_PAT_2M;
+    }
+  }
+
+  if ((*PageEntry & IA32_PG_RW) == 0) {
+    NewPageEntry &= ~(UINT64)IA32_PG_RW;
+  }
+
+  if ((*PageEntry & IA32_PG_U) == 0) {
+    NewPageEntry &= ~(UINT64)IA32_PG_U;
+  }
+
+  NewPageEntry |= *PageEntry & IA32_PG_NX;
+
+  *PageEntry = NewPageEntry;
+  FreePageTableMemory (PageTable);
+  return TRUE;
+}
+
+/**
+  Merge the page tables under a page directory pointer table into 2M pages,
+  and into 1G pages if supported.
+
+  @param[in]      L3PageTable      The page directory pointer table.
+  @param[in]      EntryCount       The number of entries of the page directory pointer table.
+  @param[in]      Page1GSupport    TRUE if 1G pages are supported.
+  @param[in]      AddressEncMask   The memory encryption mask of the page entries.
+  @param[in, out] MergedCount      Increased by the number of page tables merged.
+**/
+VOID
+CompactPageDirectoryPointerTable (
+  IN     UINT64   *L3PageTable,
+  IN     UINTN    EntryCount,
+  IN     BOOLEAN  Page1GSupport,
+  IN     UINT64   AddressEncMask,
+  IN OUT UINTN    *MergedCount
+  )
+{
+  UINTN   Index3;
+  UINTN   Index2;
+  UINT64  *L2PageTable;
+
+  for (Index3 = 0; Index3 < EntryCount; Index3++) {
+    if (((L3PageTable[Index3] & IA32_PG_P) == 0) || ((L3PageTable[Index3] & IA32_PG_PS) != 0)) {
+      continue;
+    }
+
+    L2PageTable = (UINT64 *)(UINTN)(L3PageTable[Index3] & ~AddressEncMask & PAGING_4K_ADDRESS_MASK_64);
+    for (Index2 = 0; Index2 < SIZE_4KB / sizeof (UINT64); Index2++) {
+      if (((L2PageTable[Index2] & IA32_PG_P) == 0) || ((L2PageTable[Index2] & IA32_PG_PS) != 0)) {
+        continue;
+      }
+
+      if (MergePageTable (&L2PageTable[Index2], Page4K, AddressEncMask)) {
+        (*MergedCount)++;
+      }
+    }
+
+    if (Page1GSupport && MergePageTable (&L3PageTable[Index3], Page2M, AddressEncMask)) {
+      (*MergedCount)++;
+    }
+  }
+}
+
+/**
+  Merge the page tables under a page map level 4 table into large pages.
+
+  @param[in]      L4PageTable      The page map level 4 table.
+  @param[in]      Page1GSupport    TRUE if 1G pages are supported.
+  @param[in]      AddressEncMask   The memory encryption mask of the page entries.
+  @param[in, out] MergedCount      Increased by the number of page tables merged.
+**/
+VOID
+CompactPageMapLevel4Table (
+  IN     UINT64   *L4PageTable,
+  IN     BOOLEAN  Page1GSupport,
+  IN     UINT64   AddressEncMask,
+  IN OUT UINTN    *MergedCount
+  )
+{
+  UINTN  Index4;
+
+  for (Index4 = 0; Index4 < SIZE_4KB / sizeof (UINT64); Index4++) {
+    if ((L4PageTable[Index4] & IA32_PG_P) != 0) {
+      CompactPageDirectoryPointerTable (
+        (UINT64 *)(UINTN)(L4PageTable[Index4] & ~AddressEncMask & PAGING_4K_ADDRESS_MASK_64),
+        SIZE_4KB / sizeof (UINT64),
+        Page1GSupport,
+        AddressEncMask,
+        MergedCount
+        );
+    }
+  }
+}
+
+/**
+  Merge the page tables of the current paging context back into large pages
+  wherever the pages they map are contiguous and have the same attributes.
+
+  Setting memory attributes splits large pages into 4K pages, but the pages are
+  never merged again when the attributes become the same. This function undoes
+  such splits, which reduces the TLB pressure. The page table pages that are no
+  longer used are reused for later splits.
+**/
+VOID
+CompactPageTable (
+  VOID
+  )
+{
+  PAGE_TABLE_LIB_PAGING_CONTEXT  CurrentPagingContext;
+  UINT64                         AddressEncMask;
+  UINT64                         *L5PageTable;
+  UINTN                          Index5;
+  UINTN                          MergedCount;
+  BOOLEAN                        Page1GSupport;
+  BOOLEAN                        IsWpEnabled;
+
+  if (IsInSmm ()) {
+    return;
+  }
+
+  GetCurrentPagingContext (&CurrentPagingContext);
+
+  //
+  // Make sure AddressEncMask is contained to smallest supported address field.
+  //
+  AddressEncMask = PcdGet64 (PcdPteMemoryEncryptionAddressOrMask) & PAGING_1G_ADDRESS_MASK_64;
+  if (AddressEncMask == 0) {
+    AddressEncMask = PcdGet64 (PcdTdxSharedBitMask) & PAGING_1G_ADDRESS_MASK_64;
+  }
+
+  IsWpEnabled = IsReadOnlyPageWriteProtected ();
+  if (IsWpEnabled) {
+    DisableReadOnlyPageWriteProtect ();
+  }
+
+  MergedCount = 0;
+  if (CurrentPagingContext.MachineType == IMAGE_FILE_MACHINE_X64) {
+    ASSERT (CurrentPagingContext.ContextData.X64.PageTableBase != 0);
+    Page1GSupport = (BOOLEAN)((CurrentPagingContext.ContextData.X64.Attributes & PAGE_TABLE_LIB_PAGING_CONTEXT_IA32_X64_ATTRIBUTES_PAGE_1G_SUPPORT) != 0);
+    if ((CurrentPagingContext.ContextData.X64.Attributes & PAGE_TABLE_LIB_PAGING_CONTEXT_IA32_X64_ATTRIBUTES_5_LEVEL) != 0) {
+      L5PageTable = (UINT64 *)(UINTN)CurrentPagingContext.ContextData.X64.PageTableBase;
+      for (Index5 = 0; Index5 < SIZE_4KB / sizeof (UINT64); Index5++) {
+        if ((L5PageTable[Index5] & IA32_PG_P) != 0) {
+          CompactPageMapLevel4Table (
+            (UINT64 *)(UINTN)(L5PageTable[Index5] & ~AddressEncMask & PAGING_4K_ADDRESS_MASK_64),
+            Page1GSupport,
+            AddressEncMask,
+            &MergedCount
+            );
+        }
+      }
+    } else {
+      CompactPageMapLevel4Table (
+        (UINT64 *)(UINTN)CurrentPagingContext.ContextData.X64.PageTableBase,
+        Page1GSupport,
+        AddressEncMask,
+        &MergedCount
+        );
+    }
+  } else if ((CurrentPagingContext.ContextData.Ia32.PageTableBase != 0) &&
+             ((CurrentPagingContext.ContextData.Ia32.Attributes & PAGE_TABLE_LIB_PAGING_CONTEXT_IA32_X64_ATTRIBUTES_PAE) != 0))
+  {
+    //
+    // No 1G pages with PAE paging.
+    //
+    CompactPageDirectoryPointerTable (
+      (UINT64 *)(UINTN)CurrentPagingContext.ContextData.Ia32.PageTableBase,
+      4,
+      FALSE,
+      AddressEncMask,
+      &MergedCount
+      );
+  }
+
+  if (IsWpEnabled) {
+    EnableReadOnlyPageWriteProtect ();
+  }
+
+  if (MergedCount != 0) {
+    //
+    // Note: Since APs will always init CR3 register in HLT loop mode or do
+    // TLB flush in MWAIT loop mode, there's no need to flush TLB for them
+    // here.
+    //
+    CpuFlushTlb ();
+  }
+
+  DEBUG ((DEBUG_INFO, "CompactPageTable: %lu page tables merged into large pages\n", (UINT64)MergedCount));
+}
+
+/**
+  Notification function of the ReadyToBoot event group, which compacts the page
+  table before the boot option runs.
+
+  @param[in] Event     The Event that is being processed.
+  @param[in] Context   The Event Context.
+**/
+VOID
+EFIAPI
+CompactPageTableOnReadyToBoot (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  CompactPageTable ();
+}
+
 /**
   Special handler for #DB exception, which will restore the page attributes
   (not-present). It should work with #PF handler which will set pages to
@@ -1405,6 +1717,8 @@ InitializePageTableLib (
   PAGE_TABLE_LIB_PAGING_CONTEXT  CurrentPagingContext;
   UINT32                         *Attributes;
   UINTN                          *PageTableBase;
+  EFI_STATUS                     Status;
+  EFI_EVENT                      ReadyToBootEvent;
 
   GetCurrentPagingContext (&CurrentPagingContext);
 
@@ -1419,6 +1733,14 @@ InitializePageTableLib (
     DisableReadOnlyPageWriteProtect ();
     InitializePageTablePool (1);
     EnableReadOnlyPageWriteProtect ();
+
+    Status = EfiCreateEventReadyToBootEx (
+               TPL_CALLBACK,
+               CompactPageTableOnReadyToBoot,
+               NULL,
+               &ReadyToBootEvent
+               );
+    ASSERT_EFI_ERROR (Status);
   }
 
   if (HEAP_GUARD_NONSTOP_MODE || NULL_DETECTION_NONSTOP_MODE) {
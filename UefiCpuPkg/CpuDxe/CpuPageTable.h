@@ -117,6 +117,15 @@ InitializePageTableLib (
   VOID
   );
 
+/**
+  Merge the page tables of the current paging context back into large pages
+  wherever the pages they map are contiguous and have the same attributes.
+**/
+VOID
+CompactPageTable (
+  VOID
+  );
+
 /**
   This API provides a way to allocate memory for page table.
 
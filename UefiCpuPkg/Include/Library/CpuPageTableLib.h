@@ -111,6 +111,61 @@ PageTableMap (
   OUT    BOOLEAN             *IsModified   OPTIONAL
   );
 
+typedef struct {
+  UINT64                LinearAddress;
+  UINT64                Length;
+  IA32_MAP_ATTRIBUTE    Attribute;
+  IA32_MAP_ATTRIBUTE    Mask;
+} IA32_MAP_UPDATE;
+
+/**
+  Create or update page table to apply a batch of updates, each of which maps
+  [LinearAddress, LinearAddress + Length) with the specified attribute.
+
+  The updates are applied in one call: the required buffer size is determined
+  for all of them at once, and the caller only needs to flush the TLB once. The
+  updates that continue each other with the same attribute and mask are applied
+  as one range, so large pages that they cover entirely are kept.
+
+  @param[in, out] PageTable      The pointer to the page table to update, or pointer to NULL if a new page table is to be created.
+                                 If not pointer to NULL, the value it points to won't be changed in this function.
+  @param[in]      PagingMode     The paging mode.
+  @param[in]      Buffer         The free buffer to be used for page table creation/updating.
+  @param[in, out] BufferSize     The buffer size.
+                                 On return, the remaining buffer size.
+                                 The free buffer is used from the end so caller can supply the same Buffer pointer with an updated
+                                 BufferSize in the second call to this API.
+                                 The required buffer size may be larger than what the updates end up using, so the
+                                 remaining buffer size is not necessarily 0 on return.
+  @param[in]      Updates        The page table updates, sorted by LinearAddress. The updates must not overlap.
+                                 Updates with a Length of 0 are ignored.
+  @param[in]      UpdateCount    The number of page table updates.
+  @param[out]     IsModified     TRUE means page table is modified by software or hardware. FALSE means page table is not modified by software.
+                                 If the output IsModified is FALSE, there is possibility that the page table is changed by hardware. It is ok
+                                 because page table can be changed by hardware anytime, and caller don't need to Flush TLB.
+
+  @retval RETURN_UNSUPPORTED        PagingMode is not supported.
+  @retval RETURN_INVALID_PARAMETER  PageTable or BufferSize is NULL, or UpdateCount is not 0 but Updates is NULL.
+  @retval RETURN_INVALID_PARAMETER  The updates are not sorted, or they overlap.
+  @retval RETURN_INVALID_PARAMETER  The attribute and mask of an update are invalid, see PageTableMap().
+  @retval RETURN_INVALID_PARAMETER  *BufferSize is not multiple of 4KB.
+  @retval RETURN_BUFFER_TOO_SMALL   The buffer is too small for page table creation/updating.
+                                    BufferSize is updated to indicate the expected buffer size.
+                                    Caller may still get RETURN_BUFFER_TOO_SMALL with the new BufferSize.
+  @retval RETURN_SUCCESS            PageTable is created/updated successfully or all the updates have a Length of 0.
+**/
+RETURN_STATUS
+EFIAPI
+PageTableMapBatch (
+  IN OUT UINTN            *PageTable  OPTIONAL,
+  IN     PAGING_MODE      PagingMode,
+  IN     VOID             *Buffer,
+  IN OUT UINTN            *BufferSize,
+  IN     IA32_MAP_UPDATE  *Updates,
+  IN     UINTN            UpdateCount,
+  OUT    BOOLEAN          *IsModified   OPTIONAL
+  );
+
 typedef struct {
   UINT64                LinearAddress;
   UINT64                Length;
@@ -0,0 +1,61 @@
+/** @file
+  Header file for MP Task Library.
+
+  The library runs a set of independent tasks on all enabled logical
+  processors. The tasks are split evenly between the processors up front,
+  and a processor that runs out of tasks steals half of the remaining tasks
+  of another processor, so that uneven task durations do not leave
+  processors idle.
+
+  Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef MP_TASK_LIB_H_
+#define MP_TASK_LIB_H_
+
+/**
+  The procedure that runs one task.
+
+  The procedure may run on any enabled logical processor, so it must follow
+  the restrictions of EFI_AP_PROCEDURE. Concurrent calls always get
+  different task indexes.
+
+  @param[in, out] Context    The context passed to MpTaskParallelFor().
+  @param[in]      TaskIndex  The index of the task to run.
+**/
+typedef
+VOID
+(EFIAPI *MP_TASK_PROCEDURE)(
+  IN OUT VOID  *Context,
+  IN     UINTN  TaskIndex
+  );
+
+/**
+  Run Procedure once for every task index from 0 to TaskCount - 1, using all
+  enabled logical processors, and return when all tasks have finished.
+
+  The order in which the tasks run is not defined. When the MP services are
+  not available, or when there is only one enabled logical processor, all
+  tasks run on the calling processor.
+
+  This function must be called on the BSP. In DXE it must be called at a TPL
+  below TPL_NOTIFY.
+
+  @param[in]      TaskCount  The number of tasks.
+  @param[in]      Procedure  The procedure that runs one task.
+  @param[in, out] Context    The context passed to Procedure.
+
+  @retval RETURN_SUCCESS            All tasks have finished.
+  @retval RETURN_INVALID_PARAMETER  Procedure is NULL.
+**/
+RETURN_STATUS
+EFIAPI
+MpTaskParallelFor (
+  IN     UINTN              TaskCount,
+  IN     MP_TASK_PROCEDURE  Procedure,
+  IN OUT VOID               *Context OPTIONAL
+  );
+
+#endif
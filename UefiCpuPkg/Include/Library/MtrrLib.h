@@ -218,6 +218,7 @@ MtrrGetAllMtrrs (
 
   Note: The behavior of this function is to program everything in MtrrSetting to hardware.
         MTRR might not be enabled due to enable bit is clear in MtrrSetting->MtrrDefType.
+        Nothing is programmed when the MTRRs already hold MtrrSetting and the cache is enabled.
 
   @param[in]  MtrrSetting  A buffer holding all MTRRs content.
 
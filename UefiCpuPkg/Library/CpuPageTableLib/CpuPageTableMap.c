@@ -647,6 +647,68 @@ PageTableLibMapInLevel (
   return RETURN_SUCCESS;
 }
 
+/**
+  Get the next range of a batch of page table updates. The updates that follow
+  the first one of the range are merged into the range as long as they continue
+  it with the same attribute and mask.
+
+  @param[in]      Updates      The page table updates.
+  @param[in]      UpdateCount  The number of page table updates.
+  @param[in, out] Index        On input, the index of the update to start from.
+                               On output, the index of the update after the range.
+  @param[out]     Length       The length of the range.
+
+  @return The first update of the range, or NULL if no update is left.
+**/
+IA32_MAP_UPDATE *
+PageTableLibGetBatchRange (
+  IN     IA32_MAP_UPDATE  *Updates,
+  IN     UINTN            UpdateCount,
+  IN OUT UINTN            *Index,
+  OUT    UINT64           *Length
+  )
+{
+  IA32_MAP_UPDATE  *First;
+  IA32_MAP_UPDATE  *Next;
+  UINT64           Mask;
+
+  while ((*Index < UpdateCount) && (Updates[*Index].Length == 0)) {
+    (*Index)++;
+  }
+
+  if (*Index == UpdateCount) {
+    return NULL;
+  }
+
+  First   = &Updates[*Index];
+  Mask    = First->Mask.Uint64;
+  *Length = First->Length;
+
+  for ((*Index)++; *Index < UpdateCount; (*Index)++) {
+    Next = &Updates[*Index];
+    if (Next->Length == 0) {
+      continue;
+    }
+
+    if ((Next->LinearAddress != First->LinearAddress + *Length) ||
+        (Next->Mask.Uint64 != Mask) ||
+        ((IA32_MAP_ATTRIBUTE_ATTRIBUTES (&Next->Attribute) & Mask) != (IA32_MAP_ATTRIBUTE_ATTRIBUTES (&First->Attribute) & Mask)))
+    {
+      break;
+    }
+
+    if (((Mask & IA32_MAP_ATTRIBUTE_PAGE_TABLE_BASE_ADDRESS_MASK) != 0) &&
+        (IA32_MAP_ATTRIBUTE_PAGE_TABLE_BASE_ADDRESS (&Next->Attribute) != IA32_MAP_ATTRIBUTE_PAGE_TABLE_BASE_ADDRESS (&First->Attribute) + *Length))
+    {
+      break;
+    }
+
+    *Length += Next->Length;
+  }
+
+  return First;
+}
+
 /**
   Create or update page table to map [LinearAddress, LinearAddress + Length) with specified attribute.
 
@@ -694,6 +756,79 @@ PageTableMap (
   IN     IA32_MAP_ATTRIBUTE  *Mask,
   OUT    BOOLEAN             *IsModified   OPTIONAL
   )
+{
+  IA32_MAP_UPDATE  Update;
+
+  if (Length == 0) {
+    return RETURN_SUCCESS;
+  }
+
+  if ((PagingMode == Paging32bit) || (PagingMode >= PagingModeMax)) {
+    //
+    // 32bit paging is never supported.
+    //
+    return RETURN_UNSUPPORTED;
+  }
+
+  if ((Attribute == NULL) || (Mask == NULL)) {
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  Update.LinearAddress = LinearAddress;
+  Update.Length        = Length;
+  Update.Attribute     = *Attribute;
+  Update.Mask          = *Mask;
+
+  return PageTableMapBatch (PageTable, PagingMode, Buffer, BufferSize, &Update, 1, IsModified);
+}
+
+/**
+  Create or update page table to apply a batch of updates, each of which maps
+  [LinearAddress, LinearAddress + Length) with the specified attribute.
+
+  The updates are applied in one call: the required buffer size is determined
+  for all of them at once, and the caller only needs to flush the TLB once. The
+  updates that continue each other with the same attribute and mask are applied
+  as one range, so large pages that they cover entirely are kept.
+
+  @param[in, out] PageTable      The pointer to the page table to update, or pointer to NULL if a new page table is to be created.
+                                 If not pointer to NULL, the value it points to won't be changed in this function.
+  @param[in]      PagingMode     The paging mode.
+  @param[in]      Buffer         The free buffer to be used for page table creation/updating.
+  @param[in, out] BufferSize     The buffer size.
+                                 On return, the remaining buffer size.
+                                 The free buffer is used from the end so caller can supply the same Buffer pointer with an updated
+                                 BufferSize in the second call to this API.
+                                 The required buffer size may be larger than what the updates end up using, so the
+                                 remaining buffer size is not necessarily 0 on return.
+  @param[in]      Updates        The page table updates, sorted by LinearAddress. The updates must not overlap.
+                                 Updates with a Length of 0 are ignored.
+  @param[in]      UpdateCount    The number of page table updates.
+  @param[out]     IsModified     TRUE means page table is modified by software or hardware. FALSE means page table is not modified by software.
+                                 If the output IsModified is FALSE, there is possibility that the page table is changed by hardware. It is ok
+                                 because page table can be changed by hardware anytime, and caller don't need to Flush TLB.
+
+  @retval RETURN_UNSUPPORTED        PagingMode is not supported.
+  @retval RETURN_INVALID_PARAMETER  PageTable or BufferSize is NULL, or UpdateCount is not 0 but Updates is NULL.
+  @retval RETURN_INVALID_PARAMETER  The updates are not sorted, or they overlap.
+  @retval RETURN_INVALID_PARAMETER  The attribute and mask of an update are invalid, see PageTableMap().
+  @retval RETURN_INVALID_PARAMETER  *BufferSize is not multiple of 4KB.
+  @retval RETURN_BUFFER_TOO_SMALL   The buffer is too small for page table creation/updating.
+                                    BufferSize is updated to indicate the expected buffer size.
+                                    Caller may still get RETURN_BUFFER_TOO_SMALL with the new BufferSize.
+  @retval RETURN_SUCCESS            PageTable is created/updated successfully or all the updates have a Length of 0.
+**/
+RETURN_STATUS
+EFIAPI
+PageTableMapBatch (
+  IN OUT UINTN            *PageTable  OPTIONAL,
+  IN     PAGING_MODE      PagingMode,
+  IN     VOID             *Buffer,
+  IN OUT UINTN            *BufferSize,
+  IN     IA32_MAP_UPDATE  *Updates,
+  IN     UINTN            UpdateCount,
+  OUT    BOOLEAN          *IsModified   OPTIONAL
+  )
 {
   RETURN_STATUS       Status;
   IA32_PAGING_ENTRY   TopPagingEntry;
@@ -706,10 +841,10 @@ PageTableMap (
   UINTN               Index;
   IA32_PAGING_ENTRY   *PagingEntry;
   UINT8               BufferInStack[SIZE_4KB - 1 + MAX_PAE_PDPTE_NUM * sizeof (IA32_PAGING_ENTRY)];
-
-  if (Length == 0) {
-    return RETURN_SUCCESS;
-  }
+  IA32_MAP_UPDATE     *Update;
+  UINT64              Length;
+  UINT64              PreviousEnd;
+  BOOLEAN             IsEmpty;
 
   if ((PagingMode == Paging32bit) || (PagingMode >= PagingModeMax)) {
     //
@@ -718,7 +853,7 @@ PageTableMap (
     return RETURN_UNSUPPORTED;
   }
 
-  if ((PageTable == NULL) || (BufferSize == NULL) || (Attribute == NULL) || (Mask == NULL)) {
+  if ((PageTable == NULL) || (BufferSize == NULL) || ((UpdateCount != 0) && (Updates == NULL))) {
     return RETURN_INVALID_PARAMETER;
   }
 
@@ -729,34 +864,53 @@ PageTableMap (
     return RETURN_INVALID_PARAMETER;
   }
 
-  if (((UINTN)LinearAddress % SIZE_4KB != 0) || ((UINTN)Length % SIZE_4KB != 0)) {
-    //
-    // LinearAddress and Length should be multiple of 4K.
-    //
-    return RETURN_INVALID_PARAMETER;
-  }
-
-  if ((*BufferSize != 0) && (Buffer == NULL)) {
-    return RETURN_INVALID_PARAMETER;
-  }
-
-  //
-  // If to map [LinearAddress, LinearAddress + Length] as non-present,
-  // all attributes except Present should not be provided.
-  //
-  if ((Attribute->Bits.Present == 0) && (Mask->Bits.Present == 1) && (Mask->Uint64 > 1)) {
-    return RETURN_INVALID_PARAMETER;
-  }
-
   MaxLeafLevel     = (IA32_PAGE_LEVEL)(UINT8)PagingMode;
   MaxLevel         = (IA32_PAGE_LEVEL)(UINT8)(PagingMode >> 8);
   MaxLinearAddress = (PagingMode == PagingPae) ? LShiftU64 (1, 32) : LShiftU64 (1, 12 + MaxLevel * 9);
 
-  if ((LinearAddress > MaxLinearAddress) || (Length > MaxLinearAddress - LinearAddress)) {
+  IsEmpty     = TRUE;
+  PreviousEnd = 0;
+  for (Index = 0; Index < UpdateCount; Index++) {
+    Update = &Updates[Index];
+    if (Update->Length == 0) {
+      continue;
+    }
+
+    if (((UINTN)Update->LinearAddress % SIZE_4KB != 0) || ((UINTN)Update->Length % SIZE_4KB != 0)) {
+      //
+      // LinearAddress and Length should be multiple of 4K.
+      //
+      return RETURN_INVALID_PARAMETER;
+    }
+
     //
-    // Maximum linear address is (1 << 32), (1 << 48) or (1 << 57)
+    // If to map [LinearAddress, LinearAddress + Length] as non-present,
+    // all attributes except Present should not be provided.
     //
-    return RETURN_INVALID_PARAMETER;
+    if ((Update->Attribute.Bits.Present == 0) && (Update->Mask.Bits.Present == 1) && (Update->Mask.Uint64 > 1)) {
+      return RETURN_INVALID_PARAMETER;
+    }
+
+    if ((Update->LinearAddress > MaxLinearAddress) || (Update->Length > MaxLinearAddress - Update->LinearAddress)) {
+      //
+      // Maximum linear address is (1 << 32), (1 << 48) or (1 << 57)
+      //
+      return RETURN_INVALID_PARAMETER;
+    }
+
+    if (!IsEmpty && (Update->LinearAddress < PreviousEnd)) {
+      //
+      // The updates should be sorted and should not overlap.
+      //
+      return RETURN_INVALID_PARAMETER;
+    }
+
+    IsEmpty     = FALSE;
+    PreviousEnd = Update->LinearAddress + Update->Length;
+  }
+
+  if (IsEmpty) {
+    return RETURN_SUCCESS;
   }
 
   TopPagingEntry.Uintn = *PageTable;
@@ -797,26 +951,31 @@ PageTableMap (
 
   //
   // Query the required buffer size without modifying the page table.
+  // The size is queried for each range as if it were the only one, so it may
+  // count the same page table split more than once.
   //
   RequiredSize = 0;
-  Status       = PageTableLibMapInLevel (
-                   &TopPagingEntry,
-                   &ParentAttribute,
-                   FALSE,
-                   NULL,
-                   &RequiredSize,
-                   MaxLevel,
-                   MaxLeafLevel,
-                   LinearAddress,
-                   Length,
-                   0,
-                   Attribute,
-                   Mask,
-                   IsModified
-                   );
-  ASSERT (*IsModified == FALSE);
-  if (RETURN_ERROR (Status)) {
-    return Status;
+  Index        = 0;
+  while ((Update = PageTableLibGetBatchRange (Updates, UpdateCount, &Index, &Length)) != NULL) {
+    Status = PageTableLibMapInLevel (
+               &TopPagingEntry,
+               &ParentAttribute,
+               FALSE,
+               NULL,
+               &RequiredSize,
+               MaxLevel,
+               MaxLeafLevel,
+               Update->LinearAddress,
+               Length,
+               0,
+               &Update->Attribute,
+               &Update->Mask,
+               IsModified
+               );
+    ASSERT (*IsModified == FALSE);
+    if (RETURN_ERROR (Status)) {
+      return Status;
+    }
   }
 
   RequiredSize = -RequiredSize;
@@ -833,21 +992,28 @@ PageTableMap (
   //
   // Update the page table when the supplied buffer is sufficient.
   //
-  Status = PageTableLibMapInLevel (
-             &TopPagingEntry,
-             &ParentAttribute,
-             TRUE,
-             Buffer,
-             (INTN *)BufferSize,
-             MaxLevel,
-             MaxLeafLevel,
-             LinearAddress,
-             Length,
-             0,
-             Attribute,
-             Mask,
-             IsModified
-             );
+  Status = RETURN_SUCCESS;
+  Index  = 0;
+  while ((Update = PageTableLibGetBatchRange (Updates, UpdateCount, &Index, &Length)) != NULL) {
+    Status = PageTableLibMapInLevel (
+               &TopPagingEntry,
+               &ParentAttribute,
+               TRUE,
+               Buffer,
+               (INTN *)BufferSize,
+               MaxLevel,
+               MaxLeafLevel,
+               Update->LinearAddress,
+               Length,
+               0,
+               &Update->Attribute,
+               &Update->Mask,
+               IsModified
+               );
+    if (RETURN_ERROR (Status)) {
+      break;
+    }
+  }
 
   if (!RETURN_ERROR (Status)) {
     PagingEntry = (IA32_PAGING_ENTRY *)(UINTN)(TopPagingEntry.Uintn & IA32_PE_BASE_ADDRESS_MASK_40);
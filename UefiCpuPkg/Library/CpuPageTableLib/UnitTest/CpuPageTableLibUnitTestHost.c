@@ -821,6 +821,123 @@ TestCaseToCheckMapMaskAndAttr (
   return UNIT_TEST_PASSED;
 }
 
+/**
+  Check that a batch of updates is applied as coalesced ranges.
+
+  @param[in]  Context    [Optional] An optional parameter that enables:
+                         1) test-case reuse with varied parameters and
+                         2) test-case re-entry for Target tests that need a
+                         reboot.  This parameter is a VOID* and it is the
+                         responsibility of the test author to ensure that the
+                         contents are well understood by all test cases that may
+                         consume it.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+TestCaseManualBatchUpdate (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINTN               PageTable;
+  PAGING_MODE         PagingMode;
+  VOID                *Buffer;
+  UINTN               PageTableBufferSize;
+  IA32_MAP_ATTRIBUTE  MapAttribute;
+  IA32_MAP_ATTRIBUTE  MapMask;
+  IA32_MAP_UPDATE     Updates[4];
+  IA32_MAP_UPDATE     Swap;
+  RETURN_STATUS       Status;
+  UNIT_TEST_STATUS    TestStatus;
+  IA32_MAP_ENTRY      *Map;
+  UINTN               MapCount;
+  UINTN               Index;
+
+  PagingMode                = Paging4Level;
+  PageTableBufferSize       = 0;
+  PageTable                 = 0;
+  Buffer                    = NULL;
+  MapAttribute.Uint64       = 0;
+  MapAttribute.Bits.Present = 1;
+  MapMask.Uint64            = MAX_UINT64;
+  //
+  // Create Page table to cover [0, 2G] with 2M pages.
+  //
+  Status = PageTableMap (&PageTable, PagingMode, Buffer, &PageTableBufferSize, 0, SIZE_2GB, &MapAttribute, &MapMask, NULL);
+  UT_ASSERT_EQUAL (Status, RETURN_BUFFER_TOO_SMALL);
+  Buffer = AllocatePages (EFI_SIZE_TO_PAGES (PageTableBufferSize));
+  Status = PageTableMap (&PageTable, PagingMode, Buffer, &PageTableBufferSize, 0, SIZE_2GB, &MapAttribute, &MapMask, NULL);
+  UT_ASSERT_EQUAL (Status, RETURN_SUCCESS);
+
+  //
+  // Set [1G, 1G + 2M] and [1G + 4M, 1G + 4M + 4K] as non-present.
+  // The first range is given in three contiguous pieces.
+  //
+  ZeroMem (Updates, sizeof (Updates));
+  for (Index = 0; Index < ARRAY_SIZE (Updates); Index++) {
+    Updates[Index].Mask.Bits.Present = 1;
+  }
+
+  Updates[0].LinearAddress = SIZE_1GB;
+  Updates[0].Length        = SIZE_4KB;
+  Updates[1].LinearAddress = SIZE_1GB + SIZE_4KB;
+  Updates[1].Length        = SIZE_1MB - SIZE_4KB;
+  Updates[2].LinearAddress = SIZE_1GB + SIZE_1MB;
+  Updates[2].Length        = SIZE_1MB;
+  Updates[3].LinearAddress = SIZE_1GB + SIZE_4MB;
+  Updates[3].Length        = SIZE_4KB;
+
+  //
+  // The updates should be sorted.
+  //
+  Swap       = Updates[0];
+  Updates[0] = Updates[3];
+  Updates[3] = Swap;
+
+  PageTableBufferSize = 0;
+  Status              = PageTableMapBatch (&PageTable, PagingMode, NULL, &PageTableBufferSize, Updates, ARRAY_SIZE (Updates), NULL);
+  UT_ASSERT_EQUAL (Status, RETURN_INVALID_PARAMETER);
+  Updates[3] = Updates[0];
+  Updates[0] = Swap;
+
+  //
+  // The 2M page covered by the pieces is not split. Only the 2M page of the last range is.
+  //
+  PageTableBufferSize = 0;
+  Status              = PageTableMapBatch (&PageTable, PagingMode, NULL, &PageTableBufferSize, Updates, ARRAY_SIZE (Updates), NULL);
+  UT_ASSERT_EQUAL (Status, RETURN_BUFFER_TOO_SMALL);
+  UT_ASSERT_EQUAL (PageTableBufferSize, SIZE_4KB);
+  Buffer = AllocatePages (EFI_SIZE_TO_PAGES (PageTableBufferSize));
+  Status = PageTableMapBatch (&PageTable, PagingMode, Buffer, &PageTableBufferSize, Updates, ARRAY_SIZE (Updates), NULL);
+  UT_ASSERT_EQUAL (Status, RETURN_SUCCESS);
+  TestStatus = IsPageTableValid (PageTable, PagingMode);
+  if (TestStatus != UNIT_TEST_PASSED) {
+    return TestStatus;
+  }
+
+  MapCount = 0;
+  Status   = PageTableParse (PageTable, PagingMode, NULL, &MapCount);
+  UT_ASSERT_EQUAL (Status, RETURN_BUFFER_TOO_SMALL);
+  Map    = AllocatePages (EFI_SIZE_TO_PAGES (MapCount* sizeof (IA32_MAP_ENTRY)));
+  Status = PageTableParse (PageTable, PagingMode, Map, &MapCount);
+  UT_ASSERT_EQUAL (Status, RETURN_SUCCESS);
+
+  //
+  // There should be three present ranges [0, 1G], [1G + 2M, 1G + 4M] and [1G + 4M + 4K, 2G]
+  //
+  UT_ASSERT_EQUAL (MapCount, 3);
+  UT_ASSERT_EQUAL (Map[0].LinearAddress, 0);
+  UT_ASSERT_EQUAL (Map[0].Length, SIZE_1GB);
+  UT_ASSERT_EQUAL (Map[1].LinearAddress, SIZE_1GB + SIZE_2MB);
+  UT_ASSERT_EQUAL (Map[1].Length, SIZE_2MB);
+  UT_ASSERT_EQUAL (Map[2].LinearAddress, SIZE_1GB + SIZE_4MB + SIZE_4KB);
+  UT_ASSERT_EQUAL (Map[2].Length, SIZE_1GB - SIZE_4MB - SIZE_4KB);
+  return UNIT_TEST_PASSED;
+}
+
 /**
   Initialize the unit test framework, suite, and unit tests for the
   sample unit tests and run the unit tests.
@@ -871,6 +988,7 @@ UefiTestMain (
   AddTestCase (ManualTestCase, "Check if the parent entry has different Nx attribute", "Manual Test Case6", TestCaseManualChangeNx, NULL, NULL, NULL);
   AddTestCase (ManualTestCase, "Check if the needed size is expected", "Manual Test Case7", TestCaseManualSizeNotMatch, NULL, NULL, NULL);
   AddTestCase (ManualTestCase, "Check MapMask when creating new page table or mapping not-present range", "Manual Test Case8", TestCaseToCheckMapMaskAndAttr, NULL, NULL, NULL);
+  AddTestCase (ManualTestCase, "Check a batch of updates is applied as coalesced ranges", "Manual Test Case9", TestCaseManualBatchUpdate, NULL, NULL, NULL);
   //
   // Populate the Random Test Cases.
   //
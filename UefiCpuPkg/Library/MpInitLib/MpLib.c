@@ -517,6 +517,12 @@ CollectProcessorCount (
   CPU_INFO_IN_HOB  *CpuInfoInHob;
   BOOLEAN          X2Apic;
 
+  //
+  // If the BSP already runs in x2APIC mode, APs follow it during the 1st
+  // wakeup, and no separate wakeup is needed to enable x2APIC mode below.
+  //
+  CpuMpData->X2ApicOnFirstWakeup = (BOOLEAN)(GetApicMode () == LOCAL_APIC_MODE_X2APIC);
+
   //
   // Send 1st broadcast IPI to APs to wakeup APs
   //
@@ -551,7 +557,7 @@ CollectProcessorCount (
     }
   }
 
-  if (X2Apic) {
+  if (X2Apic && !CpuMpData->X2ApicOnFirstWakeup) {
     DEBUG ((DEBUG_INFO, "Force x2APIC mode!\n"));
     //
     // Wakeup all APs to enable x2APIC mode
@@ -737,6 +743,10 @@ ApWakeupFunction (
   AP_STACK_DATA     *ApStackData;
   UINT32            OriginalValue;
 
+  if ((CpuMpData->InitFlag == ApInitConfig) && CpuMpData->X2ApicOnFirstWakeup) {
+    SetApicMode (LOCAL_APIC_MODE_X2APIC);
+  }
+
   //
   // AP's local APIC settings will be lost after received INIT IPI
   // We need to re-initialize them at here
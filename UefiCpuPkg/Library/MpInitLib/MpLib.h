@@ -305,6 +305,12 @@ struct _CPU_MP_DATA {
   //
   BOOLEAN        WakeUpByInitSipiSipi;
 
+  //
+  // Whether APs switch to x2APIC mode when they are waken up for the
+  // first time, because the BSP already runs in x2APIC mode.
+  //
+  BOOLEAN        X2ApicOnFirstWakeup;
+
   BOOLEAN        SevEsIsEnabled;
   BOOLEAN        SevSnpIsEnabled;
   BOOLEAN        UseSevEsAPMethod;
@@ -0,0 +1,101 @@
+/** @file
+  Provides the MP services to MP Task Library in DXE phase.
+
+  Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "InternalMpTaskLib.h"
+#include <Library/UefiBootServicesTableLib.h>
+
+/**
+  Get EFI_MP_SERVICES_PROTOCOL pointer.
+
+  @param[out] MpServices    A pointer to the buffer where EFI_MP_SERVICES_PROTOCOL is stored
+
+  @retval EFI_SUCCESS       EFI_MP_SERVICES_PROTOCOL interface is returned
+  @retval EFI_NOT_FOUND     EFI_MP_SERVICES_PROTOCOL interface is not found
+**/
+EFI_STATUS
+MpTaskGetMpServices (
+  OUT MP_SERVICES  *MpServices
+  )
+{
+  return gBS->LocateProtocol (&gEfiMpServiceProtocolGuid, NULL, (VOID **)&MpServices->Protocol);
+}
+
+/**
+  Get the number of enabled logical processors in the platform.
+
+  @param[in]  MpServices          MP_SERVICES structure.
+
+  @retval  Return the number of enabled logical processors.
+**/
+UINTN
+MpTaskGetNumberOfEnabledProcessors (
+  IN MP_SERVICES  MpServices
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       NumberOfProcessors;
+  UINTN       NumberOfEnabledProcessors;
+
+  Status = MpServices.Protocol->GetNumberOfProcessors (MpServices.Protocol, &NumberOfProcessors, &NumberOfEnabledProcessors);
+  if (EFI_ERROR (Status)) {
+    return 1;
+  }
+
+  return NumberOfEnabledProcessors;
+}
+
+/**
+  Run a procedure on all enabled logical processors, including the caller,
+  and wait for all of them to finish.
+
+  The APs are started in non-blocking mode so that the BSP runs the procedure
+  at the same time.
+
+  @param[in]  MpServices          MP_SERVICES structure.
+  @param[in]  Procedure           A pointer to the function to be run on enabled logical processors.
+  @param[in]  ProcedureArgument   The parameter passed into Procedure for all enabled logical processors.
+**/
+VOID
+MpTaskStartupAllCPUs (
+  IN MP_SERVICES       MpServices,
+  IN EFI_AP_PROCEDURE  Procedure,
+  IN VOID              *ProcedureArgument
+  )
+{
+  EFI_STATUS  Status;
+  EFI_EVENT   Event;
+
+  Status = gBS->CreateEvent (0, TPL_CALLBACK, NULL, NULL, &Event);
+  if (EFI_ERROR (Status)) {
+    Event = NULL;
+  } else {
+    Status = MpServices.Protocol->StartupAllAPs (MpServices.Protocol, Procedure, FALSE, Event, 0, ProcedureArgument, NULL);
+    if (EFI_ERROR (Status)) {
+      gBS->CloseEvent (Event);
+      Event = NULL;
+    }
+  }
+
+  if (Event == NULL) {
+    //
+    // Non-blocking mode is not available, let the APs finish first. The
+    // procedure on the BSP then takes over whatever is left.
+    //
+    MpServices.Protocol->StartupAllAPs (MpServices.Protocol, Procedure, FALSE, NULL, 0, ProcedureArgument, NULL);
+  }
+
+  Procedure (ProcedureArgument);
+
+  if (Event != NULL) {
+    while (gBS->CheckEvent (Event) == EFI_NOT_READY) {
+      CpuPause ();
+    }
+
+    gBS->CloseEvent (Event);
+  }
+}
@@ -0,0 +1,85 @@
+/** @file
+  Internal header file for MP Task Library.
+
+  Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef INTERNAL_MP_TASK_LIB_H_
+#define INTERNAL_MP_TASK_LIB_H_
+
+#include <PiPei.h>
+#include <Ppi/MpServices2.h>
+#include <Protocol/MpService.h>
+#include <Library/BaseLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/SynchronizationLib.h>
+#include <Library/MpTaskLib.h>
+
+typedef union {
+  EDKII_PEI_MP_SERVICES2_PPI    *Ppi;
+  EFI_MP_SERVICES_PROTOCOL      *Protocol;
+} MP_SERVICES;
+
+//
+// The tasks that are left to one processor, from Begin to End - 1.
+// The owner takes tasks from Begin, other processors steal from End.
+//
+typedef struct {
+  SPIN_LOCK         Lock;
+  volatile UINTN    Begin;
+  volatile UINTN    End;
+} MP_TASK_QUEUE;
+
+typedef struct {
+  MP_TASK_PROCEDURE    Procedure;
+  VOID                 *Context;
+  UINT8                *Queues;
+  UINTN                QueueSize;
+  UINTN                QueueCount;
+  volatile UINT32      NextQueue;
+} MP_TASK_SCHEDULER;
+
+/**
+  Get MP_SERVICES pointer.
+
+  @param[out] MpServices    A pointer to the buffer where MP_SERVICES is stored.
+
+  @retval EFI_SUCCESS       MP_SERVICES is returned.
+  @retval EFI_NOT_FOUND     The MP services are not available.
+**/
+EFI_STATUS
+MpTaskGetMpServices (
+  OUT MP_SERVICES  *MpServices
+  );
+
+/**
+  Get the number of enabled logical processors in the platform.
+
+  @param[in]  MpServices          MP_SERVICES structure.
+
+  @retval  Return the number of enabled logical processors.
+**/
+UINTN
+MpTaskGetNumberOfEnabledProcessors (
+  IN MP_SERVICES  MpServices
+  );
+
+/**
+  Run a procedure on all enabled logical processors, including the caller,
+  and wait for all of them to finish.
+
+  @param[in]  MpServices          MP_SERVICES structure.
+  @param[in]  Procedure           A pointer to the function to be run on enabled logical processors.
+  @param[in]  ProcedureArgument   The parameter passed into Procedure for all enabled logical processors.
+**/
+VOID
+MpTaskStartupAllCPUs (
+  IN MP_SERVICES       MpServices,
+  IN EFI_AP_PROCEDURE  Procedure,
+  IN VOID              *ProcedureArgument
+  );
+
+#endif
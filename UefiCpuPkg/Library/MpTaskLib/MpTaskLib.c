@@ -0,0 +1,225 @@
+/** @file
+  Runs independent tasks on all enabled logical processors with work stealing.
+
+  Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "InternalMpTaskLib.h"
+
+/**
+  Get the task queue of a processor.
+
+  @param[in]  Scheduler  The scheduler.
+  @param[in]  Index      The index of the queue.
+
+  @return The task queue.
+**/
+MP_TASK_QUEUE *
+MpTaskGetQueue (
+  IN MP_TASK_SCHEDULER  *Scheduler,
+  IN UINTN              Index
+  )
+{
+  return (MP_TASK_QUEUE *)(Scheduler->Queues + Index * Scheduler->QueueSize);
+}
+
+/**
+  Take the next task from the front of a task queue.
+
+  @param[in]  Queue      The task queue.
+  @param[out] TaskIndex  The index of the task taken.
+
+  @retval TRUE   A task has been taken.
+  @retval FALSE  The task queue is empty.
+**/
+BOOLEAN
+MpTaskPop (
+  IN  MP_TASK_QUEUE  *Queue,
+  OUT UINTN          *TaskIndex
+  )
+{
+  BOOLEAN  Found;
+
+  Found = FALSE;
+  AcquireSpinLock (&Queue->Lock);
+  if (Queue->Begin < Queue->End) {
+    *TaskIndex = Queue->Begin++;
+    Found      = TRUE;
+  }
+
+  ReleaseSpinLock (&Queue->Lock);
+  return Found;
+}
+
+/**
+  Move half of the remaining tasks of another processor to the empty task
+  queue of the calling processor.
+
+  @param[in]  Scheduler  The scheduler.
+  @param[in]  Self       The index of the queue of the calling processor.
+
+  @retval TRUE   Tasks have been moved.
+  @retval FALSE  No other processor has tasks left.
+**/
+BOOLEAN
+MpTaskSteal (
+  IN MP_TASK_SCHEDULER  *Scheduler,
+  IN UINTN              Self
+  )
+{
+  UINTN          Offset;
+  MP_TASK_QUEUE  *Victim;
+  MP_TASK_QUEUE  *Queue;
+  UINTN          Remaining;
+  UINTN          Taken;
+  UINTN          Begin;
+
+  for (Offset = 1; Offset < Scheduler->QueueCount; Offset++) {
+    Victim = MpTaskGetQueue (Scheduler, (Self + Offset) % Scheduler->QueueCount);
+    if (Victim->Begin >= Victim->End) {
+      continue;
+    }
+
+    Taken = 0;
+    AcquireSpinLock (&Victim->Lock);
+    if (Victim->Begin < Victim->End) {
+      Remaining    = Victim->End - Victim->Begin;
+      Taken        = Remaining - Remaining / 2;
+      Victim->End -= Taken;
+    }
+
+    Begin = Victim->End;
+    ReleaseSpinLock (&Victim->Lock);
+
+    if (Taken == 0) {
+      continue;
+    }
+
+    Queue = MpTaskGetQueue (Scheduler, Self);
+    AcquireSpinLock (&Queue->Lock);
+    Queue->Begin = Begin;
+    Queue->End   = Begin + Taken;
+    ReleaseSpinLock (&Queue->Lock);
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
+/**
+  Run tasks on one logical processor until no processor has tasks left.
+
+  @param[in, out] Buffer  The scheduler.
+**/
+VOID
+EFIAPI
+MpTaskWorker (
+  IN OUT VOID  *Buffer
+  )
+{
+  MP_TASK_SCHEDULER  *Scheduler;
+  UINTN              Self;
+  MP_TASK_QUEUE      *Queue;
+  UINTN              TaskIndex;
+
+  Scheduler = (MP_TASK_SCHEDULER *)Buffer;
+  Self      = InterlockedIncrement (&Scheduler->NextQueue) - 1;
+  if (Self >= Scheduler->QueueCount) {
+    return;
+  }
+
+  Queue = MpTaskGetQueue (Scheduler, Self);
+  do {
+    while (MpTaskPop (Queue, &TaskIndex)) {
+      Scheduler->Procedure (Scheduler->Context, TaskIndex);
+    }
+  } while (MpTaskSteal (Scheduler, Self));
+}
+
+/**
+  Run Procedure once for every task index from 0 to TaskCount - 1, using all
+  enabled logical processors, and return when all tasks have finished.
+
+  The order in which the tasks run is not defined. When the MP services are
+  not available, or when there is only one enabled logical processor, all
+  tasks run on the calling processor.
+
+  This function must be called on the BSP. In DXE it must be called at a TPL
+  below TPL_NOTIFY.
+
+  @param[in]      TaskCount  The number of tasks.
+  @param[in]      Procedure  The procedure that runs one task.
+  @param[in, out] Context    The context passed to Procedure.
+
+  @retval RETURN_SUCCESS            All tasks have finished.
+  @retval RETURN_INVALID_PARAMETER  Procedure is NULL.
+**/
+RETURN_STATUS
+EFIAPI
+MpTaskParallelFor (
+  IN     UINTN              TaskCount,
+  IN     MP_TASK_PROCEDURE  Procedure,
+  IN OUT VOID               *Context OPTIONAL
+  )
+{
+  EFI_STATUS         Status;
+  MP_SERVICES        MpServices;
+  MP_TASK_SCHEDULER  Scheduler;
+  MP_TASK_QUEUE      *Queue;
+  UINTN              TaskIndex;
+  UINTN              Index;
+  UINTN              Chunk;
+  UINTN              Extra;
+
+  if (Procedure == NULL) {
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  Scheduler.QueueCount = 1;
+  Status               = MpTaskGetMpServices (&MpServices);
+  if (!EFI_ERROR (Status)) {
+    Scheduler.QueueCount = MIN (MpTaskGetNumberOfEnabledProcessors (MpServices), TaskCount);
+  }
+
+  Scheduler.Queues = NULL;
+  if (Scheduler.QueueCount > 1) {
+    //
+    // Keep every queue in its own cache line.
+    //
+    Scheduler.QueueSize = ALIGN_VALUE (sizeof (MP_TASK_QUEUE), GetSpinLockProperties ());
+    Scheduler.Queues    = AllocatePool (Scheduler.QueueSize * Scheduler.QueueCount);
+  }
+
+  if (Scheduler.Queues == NULL) {
+    for (TaskIndex = 0; TaskIndex < TaskCount; TaskIndex++) {
+      Procedure (Context, TaskIndex);
+    }
+
+    return RETURN_SUCCESS;
+  }
+
+  //
+  // Split the tasks evenly between the processors.
+  //
+  Chunk     = TaskCount / Scheduler.QueueCount;
+  Extra     = TaskCount % Scheduler.QueueCount;
+  TaskIndex = 0;
+  for (Index = 0; Index < Scheduler.QueueCount; Index++) {
+    Queue = MpTaskGetQueue (&Scheduler, Index);
+    InitializeSpinLock (&Queue->Lock);
+    Queue->Begin = TaskIndex;
+    TaskIndex   += Chunk + ((Index < Extra) ? 1 : 0);
+    Queue->End   = TaskIndex;
+  }
+
+  Scheduler.Procedure = Procedure;
+  Scheduler.Context   = Context;
+  Scheduler.NextQueue = 0;
+
+  MpTaskStartupAllCPUs (MpServices, MpTaskWorker, &Scheduler);
+
+  FreePool (Scheduler.Queues);
+  return RETURN_SUCCESS;
+}
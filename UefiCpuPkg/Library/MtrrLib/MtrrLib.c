@@ -2885,11 +2885,66 @@ MtrrGetAllMtrrs (
   return MtrrSetting;
 }
 
+/**
+  Check if the processor already runs with the given MTRR settings.
+
+  Programming the MTRRs is costly: the cache is disabled and flushed, and the
+  TLBs are flushed. It is not needed when the settings are already in effect and
+  the cache is enabled, which is the common case when the same precomputed
+  settings are applied again, such as on each processor on every boot.
+
+  @param[in]  MtrrSetting         A buffer holding all MTRRs content.
+  @param[in]  FixedMtrrSupported  TRUE if the fixed MTRRs are supported.
+  @param[in]  VariableMtrrCount   The number of variable MTRRs.
+
+  @retval TRUE   The settings are already in effect.
+  @retval FALSE  The MTRRs need to be programmed.
+**/
+BOOLEAN
+MtrrLibIsMtrrSettingInEffect (
+  IN MTRR_SETTINGS  *MtrrSetting,
+  IN BOOLEAN        FixedMtrrSupported,
+  IN UINT32         VariableMtrrCount
+  )
+{
+  IA32_CR0  Cr0;
+  UINT32    Index;
+
+  Cr0.UintN = AsmReadCr0 ();
+  if ((Cr0.Bits.CD != 0) || (Cr0.Bits.NW != 0)) {
+    return FALSE;
+  }
+
+  if (AsmReadMsr64 (MSR_IA32_MTRR_DEF_TYPE) != MtrrSetting->MtrrDefType) {
+    return FALSE;
+  }
+
+  if (FixedMtrrSupported) {
+    for (Index = 0; Index < MTRR_NUMBER_OF_FIXED_MTRR; Index++) {
+      if (AsmReadMsr64 (mMtrrLibFixedMtrrTable[Index].Msr) != MtrrSetting->Fixed.Mtrr[Index]) {
+        return FALSE;
+      }
+    }
+  }
+
+  ASSERT (VariableMtrrCount <= ARRAY_SIZE (MtrrSetting->Variables.Mtrr));
+  for (Index = 0; Index < VariableMtrrCount; Index++) {
+    if ((AsmReadMsr64 (MSR_IA32_MTRR_PHYSBASE0 + (Index << 1)) != MtrrSetting->Variables.Mtrr[Index].Base) ||
+        (AsmReadMsr64 (MSR_IA32_MTRR_PHYSMASK0 + (Index << 1)) != MtrrSetting->Variables.Mtrr[Index].Mask))
+    {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
 /**
   This function sets all MTRRs includes Variable and Fixed.
 
   The behavior of this function is to program everything in MtrrSetting to hardware.
   MTRRs might not be enabled because the enable bit is clear in MtrrSetting->MtrrDefType.
+  Nothing is programmed when the MTRRs already hold MtrrSetting and the cache is enabled.
 
   @param[in]  MtrrSetting  A buffer holding all MTRRs content.
 
@@ -2903,11 +2958,16 @@ MtrrSetAllMtrrs (
   )
 {
   BOOLEAN                          FixedMtrrSupported;
+  UINT32                           VariableMtrrCount;
   MSR_IA32_MTRR_DEF_TYPE_REGISTER  *MtrrDefType;
   MTRR_CONTEXT                     MtrrContext;
 
   MtrrDefType = (MSR_IA32_MTRR_DEF_TYPE_REGISTER *)&MtrrSetting->MtrrDefType;
-  if (!MtrrLibIsMtrrSupported (&FixedMtrrSupported, NULL)) {
+  if (!MtrrLibIsMtrrSupported (&FixedMtrrSupported, &VariableMtrrCount)) {
+    return MtrrSetting;
+  }
+
+  if (MtrrLibIsMtrrSettingInEffect (MtrrSetting, FixedMtrrSupported, VariableMtrrCount)) {
     return MtrrSetting;
   }
 
@@ -574,6 +574,10 @@ BSPHandler (
   //
   PerformPreTasks ();
 
+  if (FeaturePcdGet (PcdSmiLatencyHistogramEnable)) {
+    SmmCpuLatencyHistogramEnd (CpuIndex, SMM_CPU_LATENCY_PHASE_RENDEZVOUS);
+  }
+
   //
   // Invoke SMM Foundation EntryPoint with the processor information context.
   //
@@ -584,6 +588,10 @@ BSPHandler (
   //
   WaitForAllAPsNotBusy (TRUE);
 
+  if (FeaturePcdGet (PcdSmiLatencyHistogramEnable)) {
+    SmmCpuLatencyHistogramEnd (CpuIndex, SMM_CPU_LATENCY_PHASE_HANDLER);
+  }
+
   //
   // Perform the remaining tasks
   //
@@ -840,6 +848,10 @@ APHandler (
     SmmCpuSyncReleaseBsp (mSmmMpSyncData->SyncContext, CpuIndex, BspIndex);
   }
 
+  if (FeaturePcdGet (PcdSmiLatencyHistogramEnable)) {
+    SmmCpuLatencyHistogramEnd (CpuIndex, SMM_CPU_LATENCY_PHASE_RENDEZVOUS);
+  }
+
   while (TRUE) {
     //
     // Wait for something to happen
@@ -880,6 +892,10 @@ APHandler (
     ReleaseSpinLock (mSmmMpSyncData->CpuData[CpuIndex].Busy);
   }
 
+  if (FeaturePcdGet (PcdSmiLatencyHistogramEnable)) {
+    SmmCpuLatencyHistogramEnd (CpuIndex, SMM_CPU_LATENCY_PHASE_HANDLER);
+  }
+
   if (SmmCpuFeaturesNeedConfigureMtrrs ()) {
     //
     // Notify BSP the readiness of this AP to program MTRRs
@@ -1541,6 +1557,10 @@ SmiRendezvous (
     return;
   }
 
+  if (FeaturePcdGet (PcdSmiLatencyHistogramEnable)) {
+    SmmCpuLatencyHistogramBegin (CpuIndex);
+  }
+
   //
   // Call the user register Startup function first.
   //
@@ -1714,6 +1734,10 @@ Exit:
     MpPerfEnd (CpuIndex, SMM_MP_PERF_PROCEDURE_ID (SmmRendezvousExit));
     );
 
+  if (FeaturePcdGet (PcdSmiLatencyHistogramEnable)) {
+    SmmCpuLatencyHistogramEnd (CpuIndex, SMM_CPU_LATENCY_PHASE_EXIT);
+  }
+
   //
   // Restore Cr2
   //
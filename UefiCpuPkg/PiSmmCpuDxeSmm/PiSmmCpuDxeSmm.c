@@ -913,6 +913,10 @@ PiCpuSmmEntry (
     InitializeMpPerf (gSmmCpuPrivate->SmmCoreEntryContext.NumberOfCpus);
     );
 
+  if (FeaturePcdGet (PcdSmiLatencyHistogramEnable)) {
+    InitializeSmmCpuLatencyHistogram (gSmmCpuPrivate->SmmCoreEntryContext.NumberOfCpus);
+  }
+
   //
   // The CPU save state and code for the SMI entry point are tiled within an SMRAM
   // allocated buffer.  The minimum size of this buffer for a uniprocessor system
@@ -27,6 +27,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Guid/PiSmmMemoryAttributesTable.h>
 #include <Guid/SmmBaseHob.h>
 #include <Guid/MpInformation2.h>
+#include <Guid/SmiLatencyHistogram.h>
 
 #include <Library/BaseLib.h>
 #include <Library/IoLib.h>
@@ -55,6 +56,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/CpuPageTableLib.h>
 #include <Library/MmSaveStateLib.h>
 #include <Library/SmmCpuSyncLib.h>
+#include <Library/SmmMemLib.h>
 
 #include <AcpiCpuData.h>
 #include <CpuHotPlugData.h>
@@ -65,6 +67,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include "CpuService.h"
 #include "SmmProfile.h"
 #include "SmmMpPerf.h"
+#include "SmmCpuLatencyHistogram.h"
 
 //
 // CET definition
@@ -535,6 +538,19 @@ StartSyncTimer (
   VOID
   );
 
+/**
+  Get the number of ticks the SMM AP Sync Timer has run since Timer.
+
+  @param Timer    The start timer from the begin.
+
+  @return The number of performance counter ticks since Timer.
+**/
+UINT64
+EFIAPI
+GetSyncTimerElapsed (
+  IN      UINT64  Timer
+  );
+
 /**
   Check if the SMM AP Sync Timer is timeout specified by Timeout.
 
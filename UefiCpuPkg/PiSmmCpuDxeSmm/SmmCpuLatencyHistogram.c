@@ -0,0 +1,283 @@
+/** @file
+SMM CPU latency histogram implementation
+
+Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "PiSmmCpuDxeSmm.h"
+
+typedef struct {
+  //
+  // The sync timer value at the start of the current phase.
+  //
+  UINT64    PhaseStart;
+  //
+  // The SMM_CPU_LATENCY_PHASE_* phase the processor is in.
+  //
+  UINTN     Phase;
+} SMM_CPU_LATENCY_PHASE_STATE;
+
+//
+// Each element holds the histograms for one processor.
+//
+GLOBAL_REMOVE_IF_UNREFERENCED
+SMM_CPU_LATENCY_HISTOGRAM  *mSmmCpuLatencyHistogram = NULL;
+GLOBAL_REMOVE_IF_UNREFERENCED
+SMM_CPU_LATENCY_PHASE_STATE  *mSmmCpuLatencyPhaseState = NULL;
+GLOBAL_REMOVE_IF_UNREFERENCED
+UINTN  mSmmCpuLatencyHistogramCount = 0;
+
+/**
+  Start timing the SMI phases of a processor. Called when it enters the SMI.
+
+  @param CpuIndex        The index of the CPU.
+**/
+VOID
+SmmCpuLatencyHistogramBegin (
+  IN UINTN  CpuIndex
+  )
+{
+  if (mSmmCpuLatencyPhaseState == NULL) {
+    return;
+  }
+
+  mSmmCpuLatencyPhaseState[CpuIndex].Phase      = SMM_CPU_LATENCY_PHASE_RENDEZVOUS;
+  mSmmCpuLatencyPhaseState[CpuIndex].PhaseStart = StartSyncTimer ();
+}
+
+/**
+  Record the time of an SMI phase of a processor, and start timing the next one.
+
+  The phase is only recorded if the processor went through all the phases
+  before it in the current SMI.
+
+  @param CpuIndex        The index of the CPU.
+  @param Phase           The SMM_CPU_LATENCY_PHASE_* phase that ends.
+**/
+VOID
+SmmCpuLatencyHistogramEnd (
+  IN UINTN  CpuIndex,
+  IN UINTN  Phase
+  )
+{
+  SMM_CPU_LATENCY_PHASE_STATE  *State;
+  SMI_LATENCY_HISTOGRAM        *Histogram;
+  UINT64                       NanoSeconds;
+  UINTN                        Bucket;
+
+  if (mSmmCpuLatencyPhaseState == NULL) {
+    return;
+  }
+
+  State = &mSmmCpuLatencyPhaseState[CpuIndex];
+  if (State->Phase != Phase) {
+    return;
+  }
+
+  NanoSeconds       = GetTimeInNanoSecond (GetSyncTimerElapsed (State->PhaseStart));
+  State->PhaseStart = StartSyncTimer ();
+  State->Phase      = Phase + 1;
+
+  Bucket = (NanoSeconds < 2) ? 0 : (UINTN)HighBitSet64 (NanoSeconds);
+  if (Bucket >= SMI_LATENCY_HISTOGRAM_BUCKET_COUNT) {
+    Bucket = SMI_LATENCY_HISTOGRAM_BUCKET_COUNT - 1;
+  }
+
+  Histogram = &mSmmCpuLatencyHistogram[CpuIndex].Phase[Phase];
+  Histogram->Count++;
+  Histogram->TotalNanoSeconds += NanoSeconds;
+  if (NanoSeconds > Histogram->MaxNanoSeconds) {
+    Histogram->MaxNanoSeconds = NanoSeconds;
+  }
+
+  Histogram->Bucket[Bucket]++;
+}
+
+/**
+  Clear the histograms of all processors.
+**/
+VOID
+SmmCpuLatencyHistogramReset (
+  VOID
+  )
+{
+  UINTN  CpuIndex;
+
+  ZeroMem (mSmmCpuLatencyHistogram, mSmmCpuLatencyHistogramCount * sizeof (*mSmmCpuLatencyHistogram));
+  for (CpuIndex = 0; CpuIndex < mSmmCpuLatencyHistogramCount; CpuIndex++) {
+    mSmmCpuLatencyHistogram[CpuIndex].CpuIndex = (UINT32)CpuIndex;
+  }
+}
+
+/**
+  SMM CPU latency histogram handler to get data by offset.
+
+  @param ParameterGetDataByOffset   The parameter of SMI latency histogram get data by offset.
+
+**/
+VOID
+SmmCpuLatencyHistogramGetDataByOffset (
+  IN SMI_LATENCY_HISTOGRAM_PARAMETER_GET_DATA_BY_OFFSET  *ParameterGetDataByOffset
+  )
+{
+  SMI_LATENCY_HISTOGRAM_PARAMETER_GET_DATA_BY_OFFSET  GetDataByOffset;
+  UINT64                                              DataSize;
+
+  CopyMem (&GetDataByOffset, ParameterGetDataByOffset, sizeof (GetDataByOffset));
+
+  //
+  // Sanity check
+  //
+  if (!SmmIsBufferOutsideSmmValid ((UINTN)GetDataByOffset.DataBuffer, (UINTN)GetDataByOffset.DataSize)) {
+    DEBUG ((DEBUG_ERROR, "SmmCpuLatencyHistogramGetDataByOffset: SMM CPU latency histogram get data in SMRAM or overflow!\n"));
+    ParameterGetDataByOffset->Header.ReturnStatus = (UINT64)(INT64)(INTN)EFI_ACCESS_DENIED;
+    return;
+  }
+
+  DataSize = mSmmCpuLatencyHistogramCount * sizeof (*mSmmCpuLatencyHistogram);
+  if (GetDataByOffset.DataOffset >= DataSize) {
+    GetDataByOffset.DataOffset = DataSize;
+    GetDataByOffset.DataSize   = 0;
+  } else {
+    if (DataSize - GetDataByOffset.DataOffset < GetDataByOffset.DataSize) {
+      GetDataByOffset.DataSize = DataSize - GetDataByOffset.DataOffset;
+    }
+
+    CopyMem (
+      (VOID *)(UINTN)GetDataByOffset.DataBuffer,
+      (UINT8 *)mSmmCpuLatencyHistogram + GetDataByOffset.DataOffset,
+      (UINTN)GetDataByOffset.DataSize
+      );
+    GetDataByOffset.DataOffset += GetDataByOffset.DataSize;
+  }
+
+  CopyMem (ParameterGetDataByOffset, &GetDataByOffset, sizeof (GetDataByOffset));
+  ParameterGetDataByOffset->Header.ReturnStatus = 0;
+}
+
+/**
+  Dispatch function for the SMM CPU latency histogram communication.
+
+  Caution: This function may receive untrusted input.
+  Communicate buffer and buffer size are external input, so this function will do basic validation.
+
+  @param DispatchHandle  The unique handle assigned to this handler by SmiHandlerRegister().
+  @param Context         Points to an optional handler context which was specified when the
+                         handler was registered.
+  @param CommBuffer      A pointer to a collection of data in memory that will
+                         be conveyed from a non-SMM environment into an SMM environment.
+  @param CommBufferSize  The size of the CommBuffer.
+
+  @retval EFI_SUCCESS Command is handled successfully.
+**/
+EFI_STATUS
+EFIAPI
+SmmCpuLatencyHistogramHandler (
+  IN EFI_HANDLE  DispatchHandle,
+  IN CONST VOID  *Context         OPTIONAL,
+  IN OUT VOID    *CommBuffer      OPTIONAL,
+  IN OUT UINTN   *CommBufferSize  OPTIONAL
+  )
+{
+  SMI_LATENCY_HISTOGRAM_PARAMETER_HEADER  *ParameterHeader;
+  UINTN                                   TempCommBufferSize;
+
+  //
+  // If input is invalid, stop processing this SMI
+  //
+  if ((CommBuffer == NULL) || (CommBufferSize == NULL)) {
+    return EFI_SUCCESS;
+  }
+
+  TempCommBufferSize = *CommBufferSize;
+
+  if (TempCommBufferSize < sizeof (SMI_LATENCY_HISTOGRAM_PARAMETER_HEADER)) {
+    DEBUG ((DEBUG_ERROR, "SmmCpuLatencyHistogramHandler: SMM communication buffer size invalid!\n"));
+    return EFI_SUCCESS;
+  }
+
+  if (!SmmIsBufferOutsideSmmValid ((UINTN)CommBuffer, TempCommBufferSize)) {
+    DEBUG ((DEBUG_ERROR, "SmmCpuLatencyHistogramHandler: SMM communication buffer in SMRAM or overflow!\n"));
+    return EFI_SUCCESS;
+  }
+
+  ParameterHeader               = (SMI_LATENCY_HISTOGRAM_PARAMETER_HEADER *)((UINTN)CommBuffer);
+  ParameterHeader->ReturnStatus = (UINT64)-1;
+
+  switch (ParameterHeader->Command) {
+    case SMI_LATENCY_HISTOGRAM_COMMAND_GET_INFO:
+      if (TempCommBufferSize != sizeof (SMI_LATENCY_HISTOGRAM_PARAMETER_GET_INFO)) {
+        DEBUG ((DEBUG_ERROR, "SmmCpuLatencyHistogramHandler: SMM communication buffer size invalid!\n"));
+        return EFI_SUCCESS;
+      }
+
+      ((SMI_LATENCY_HISTOGRAM_PARAMETER_GET_INFO *)(UINTN)CommBuffer)->DataSize = mSmmCpuLatencyHistogramCount * sizeof (*mSmmCpuLatencyHistogram);
+      ParameterHeader->ReturnStatus                                             = 0;
+      break;
+    case SMI_LATENCY_HISTOGRAM_COMMAND_GET_DATA_BY_OFFSET:
+      if (TempCommBufferSize != sizeof (SMI_LATENCY_HISTOGRAM_PARAMETER_GET_DATA_BY_OFFSET)) {
+        DEBUG ((DEBUG_ERROR, "SmmCpuLatencyHistogramHandler: SMM communication buffer size invalid!\n"));
+        return EFI_SUCCESS;
+      }
+
+      SmmCpuLatencyHistogramGetDataByOffset ((SMI_LATENCY_HISTOGRAM_PARAMETER_GET_DATA_BY_OFFSET *)(UINTN)CommBuffer);
+      break;
+    case SMI_LATENCY_HISTOGRAM_COMMAND_RESET:
+      SmmCpuLatencyHistogramReset ();
+      ParameterHeader->ReturnStatus = 0;
+      break;
+    default:
+      break;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Initialize the SMI phase latency histograms of the processors and register
+  the gSmmCpuLatencyHistogramGuid SMI handler to read them.
+
+  @param NumberofCpus    Number of processors in the platform.
+**/
+VOID
+InitializeSmmCpuLatencyHistogram (
+  IN UINTN  NumberofCpus
+  )
+{
+  EFI_STATUS  Status;
+  EFI_HANDLE  DispatchHandle;
+
+  mSmmCpuLatencyHistogram  = AllocateZeroPool (NumberofCpus * sizeof (*mSmmCpuLatencyHistogram));
+  mSmmCpuLatencyPhaseState = AllocateZeroPool (NumberofCpus * sizeof (*mSmmCpuLatencyPhaseState));
+  if ((mSmmCpuLatencyHistogram == NULL) || (mSmmCpuLatencyPhaseState == NULL)) {
+    ASSERT (FALSE);
+    if (mSmmCpuLatencyHistogram != NULL) {
+      FreePool (mSmmCpuLatencyHistogram);
+      mSmmCpuLatencyHistogram = NULL;
+    }
+
+    if (mSmmCpuLatencyPhaseState != NULL) {
+      FreePool (mSmmCpuLatencyPhaseState);
+      mSmmCpuLatencyPhaseState = NULL;
+    }
+
+    return;
+  }
+
+  //
+  // No phase is recorded until the processor enters an SMI.
+  //
+  mSmmCpuLatencyHistogramCount = NumberofCpus;
+  SetMem (mSmmCpuLatencyPhaseState, NumberofCpus * sizeof (*mSmmCpuLatencyPhaseState), 0xFF);
+  SmmCpuLatencyHistogramReset ();
+
+  Status = gSmst->SmiHandlerRegister (
+                    SmmCpuLatencyHistogramHandler,
+                    &gSmmCpuLatencyHistogramGuid,
+                    &DispatchHandle
+                    );
+  ASSERT_EFI_ERROR (Status);
+}
@@ -0,0 +1,49 @@
+/** @file
+SMM CPU latency histogram implementation
+
+Copyright (c) 2024, Intel Corporation. All rights reserved.<BR>
+
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef SMM_CPU_LATENCY_HISTOGRAM_H_
+#define SMM_CPU_LATENCY_HISTOGRAM_H_
+
+/**
+  Initialize the SMI phase latency histograms of the processors and register
+  the gSmmCpuLatencyHistogramGuid SMI handler to read them.
+
+  @param NumberofCpus    Number of processors in the platform.
+**/
+VOID
+InitializeSmmCpuLatencyHistogram (
+  IN UINTN  NumberofCpus
+  );
+
+/**
+  Start timing the SMI phases of a processor. Called when it enters the SMI.
+
+  @param CpuIndex        The index of the CPU.
+**/
+VOID
+SmmCpuLatencyHistogramBegin (
+  IN UINTN  CpuIndex
+  );
+
+/**
+  Record the time of an SMI phase of a processor, and start timing the next one.
+
+  The phase is only recorded if the processor went through all the phases
+  before it in the current SMI.
+
+  @param CpuIndex        The index of the CPU.
+  @param Phase           The SMM_CPU_LATENCY_PHASE_* phase that ends.
+**/
+VOID
+SmmCpuLatencyHistogramEnd (
+  IN UINTN  CpuIndex,
+  IN UINTN  Phase
+  );
+
+#endif
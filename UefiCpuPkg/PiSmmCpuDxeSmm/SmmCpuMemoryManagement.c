@@ -1399,6 +1399,121 @@ GetUefiMemoryMap (
   GetUefiMemoryAttributesTable ();
 }
 
+/**
+  Add a memory range to the ranges to be marked as not present.
+
+  If there is no array to add the range to, the range is marked as not present
+  right away.
+
+  @param[in, out] Ranges       The ranges to be marked as not present, or NULL.
+  @param[in, out] RangeCount   The number of ranges in Ranges.
+  @param[in]      BaseAddress  The start address of the memory range.
+  @param[in]      Length       The size in bytes of the memory range.
+
+  @retval EFI_SUCCESS    The range is added, or is marked as not present.
+  @retval others         The range could not be marked as not present.
+**/
+EFI_STATUS
+AddNotPresentRange (
+  IN OUT IA32_MAP_UPDATE       *Ranges  OPTIONAL,
+  IN OUT UINTN                 *RangeCount,
+  IN     EFI_PHYSICAL_ADDRESS  BaseAddress,
+  IN     UINT64                Length
+  )
+{
+  if (Ranges == NULL) {
+    return SmmSetMemoryAttributes (BaseAddress, Length, EFI_MEMORY_RP);
+  }
+
+  Ranges[*RangeCount].LinearAddress = BaseAddress;
+  Ranges[*RangeCount].Length        = Length;
+  (*RangeCount)++;
+  return EFI_SUCCESS;
+}
+
+/**
+  Mark memory ranges as not present in the current page table.
+
+  All the ranges are applied in one page table update, so the TLB of all
+  processors is flushed once, and contiguous ranges are mapped together, which
+  keeps the large pages that they cover entirely.
+
+  @param[in, out] Ranges       The ranges, sorted by address and not overlapping.
+                               Only LinearAddress and Length need to be set.
+  @param[in]      RangeCount   The number of ranges in Ranges.
+**/
+VOID
+SmmSetMemoryRangesNotPresent (
+  IN OUT IA32_MAP_UPDATE  *Ranges,
+  IN     UINTN            RangeCount
+  )
+{
+  RETURN_STATUS         Status;
+  UINTN                 PageTableBase;
+  UINTN                 PageTableBufferSize;
+  VOID                  *PageTableBuffer;
+  EFI_PHYSICAL_ADDRESS  MaximumSupportMemAddress;
+  BOOLEAN               IsModified;
+  UINTN                 Index;
+
+  if (RangeCount == 0) {
+    return;
+  }
+
+  MaximumSupportMemAddress = (EFI_PHYSICAL_ADDRESS)(UINTN)(LShiftU64 (1, mPhysicalAddressBits) - 1);
+  for (Index = 0; Index < RangeCount; Index++) {
+    ASSERT ((Ranges[Index].LinearAddress & (SIZE_4KB - 1)) == 0);
+    ASSERT ((Ranges[Index].Length & (SIZE_4KB - 1)) == 0);
+
+    //
+    // When map a range to non-present, all attributes except Present should not be provided.
+    //
+    Ranges[Index].Attribute.Uint64  = 0;
+    Ranges[Index].Mask.Uint64       = 0;
+    Ranges[Index].Mask.Bits.Present = 1;
+    if ((Ranges[Index].Length > MaximumSupportMemAddress) ||
+        (Ranges[Index].LinearAddress > MaximumSupportMemAddress - (Ranges[Index].Length - 1)))
+    {
+      //
+      // The range is not supported by the processor, leave it unchanged.
+      //
+      Ranges[Index].Length = 0;
+    }
+  }
+
+  PageTableBase       = AsmReadCr3 () & PAGING_4K_ADDRESS_MASK_64;
+  PageTableBufferSize = 0;
+  Status              = PageTableMapBatch (&PageTableBase, mPagingMode, NULL, &PageTableBufferSize, Ranges, RangeCount, &IsModified);
+
+  if (Status == RETURN_BUFFER_TOO_SMALL) {
+    PageTableBuffer = AllocatePageTableMemory (EFI_SIZE_TO_PAGES (PageTableBufferSize));
+    ASSERT (PageTableBuffer != NULL);
+    Status = PageTableMapBatch (&PageTableBase, mPagingMode, PageTableBuffer, &PageTableBufferSize, Ranges, RangeCount, &IsModified);
+  }
+
+  if (Status == RETURN_INVALID_PARAMETER) {
+    //
+    // The ranges are not sorted. Mark them one by one.
+    //
+    DEBUG ((DEBUG_WARN, "SmmSetMemoryRangesNotPresent: Ranges are not sorted\n"));
+    for (Index = 0; Index < RangeCount; Index++) {
+      if (Ranges[Index].Length != 0) {
+        SmmSetMemoryAttributes (Ranges[Index].LinearAddress, Ranges[Index].Length, EFI_MEMORY_RP);
+      }
+    }
+
+    return;
+  }
+
+  ASSERT_RETURN_ERROR (Status);
+  if (!RETURN_ERROR (Status) && IsModified) {
+    //
+    // Flush TLB as last step
+    //
+    FlushTlbForAll ();
+  }
+}
+
 /**
   This function sets UEFI memory attribute according to UEFI memory map.
 
@@ -1418,6 +1533,9 @@ SetUefiMemMapAttributes (
   EFI_MEMORY_DESCRIPTOR  *Entry;
   BOOLEAN                WriteProtect;
   BOOLEAN                CetEnabled;
+  IA32_MAP_UPDATE        *Ranges;
+  UINTN                  RangeCount;
+  UINTN                  MaxRangeCount;
 
   PERF_FUNCTION_BEGIN ();
 
@@ -1425,15 +1543,35 @@ SetUefiMemMapAttributes (
 
   WRITE_UNPROTECT_RO_PAGES (WriteProtect, CetEnabled);
 
+  //
+  // The ranges of each list are marked as not present in one page table update.
+  // If there is no memory for the ranges, they are marked one by one.
+  //
+  MaxRangeCount = mGcdMemNumberOfDesc;
+  if (mUefiMemoryMap != NULL) {
+    MaxRangeCount = MAX (MaxRangeCount, mUefiMemoryMapSize / mUefiDescriptorSize);
+  }
+
+  if (mUefiMemoryAttributesTable != NULL) {
+    MaxRangeCount = MAX (MaxRangeCount, mUefiMemoryAttributesTable->NumberOfEntries);
+  }
+
+  Ranges = NULL;
+  if (MaxRangeCount != 0) {
+    Ranges = AllocatePool (MaxRangeCount * sizeof (IA32_MAP_UPDATE));
+  }
+
   if (mUefiMemoryMap != NULL) {
     MemoryMapEntryCount = mUefiMemoryMapSize/mUefiDescriptorSize;
     MemoryMap           = mUefiMemoryMap;
+    RangeCount          = 0;
     for (Index = 0; Index < MemoryMapEntryCount; Index++) {
       if (IsUefiPageNotPresent (MemoryMap)) {
-        Status = SmmSetMemoryAttributes (
+        Status = AddNotPresentRange (
+                   Ranges,
+                   &RangeCount,
                    MemoryMap->PhysicalStart,
-                   EFI_PAGES_TO_SIZE ((UINTN)MemoryMap->NumberOfPages),
-                   EFI_MEMORY_RP
+                   EFI_PAGES_TO_SIZE ((UINTN)MemoryMap->NumberOfPages)
                    );
         DEBUG ((
           DEBUG_INFO,
@@ -1446,6 +1584,8 @@ SetUefiMemMapAttributes (
 
       MemoryMap = NEXT_MEMORY_DESCRIPTOR (MemoryMap, mUefiDescriptorSize);
     }
+
+    SmmSetMemoryRangesNotPresent (Ranges, RangeCount);
   }
 
   //
@@ -1456,11 +1596,13 @@ SetUefiMemMapAttributes (
   // Set untested memory as not present.
   //
   if (mGcdMemSpace != NULL) {
+    RangeCount = 0;
     for (Index = 0; Index < mGcdMemNumberOfDesc; Index++) {
-      Status = SmmSetMemoryAttributes (
+      Status = AddNotPresentRange (
+                 Ranges,
+                 &RangeCount,
                  mGcdMemSpace[Index].BaseAddress,
-                 mGcdMemSpace[Index].Length,
-                 EFI_MEMORY_RP
+                 mGcdMemSpace[Index].Length
                  );
       DEBUG ((
         DEBUG_INFO,
@@ -1470,6 +1612,8 @@ SetUefiMemMapAttributes (
         Status
         ));
     }
+
+    SmmSetMemoryRangesNotPresent (Ranges, RangeCount);
   }
 
   //
@@ -1480,14 +1624,16 @@ SetUefiMemMapAttributes (
   // Set UEFI runtime memory with EFI_MEMORY_RO as not present.
   //
   if (mUefiMemoryAttributesTable != NULL) {
-    Entry = (EFI_MEMORY_DESCRIPTOR *)(mUefiMemoryAttributesTable + 1);
+    Entry      = (EFI_MEMORY_DESCRIPTOR *)(mUefiMemoryAttributesTable + 1);
+    RangeCount = 0;
     for (Index = 0; Index < mUefiMemoryAttributesTable->NumberOfEntries; Index++) {
       if ((Entry->Type == EfiRuntimeServicesCode) || (Entry->Type == EfiRuntimeServicesData)) {
         if ((Entry->Attribute & EFI_MEMORY_RO) != 0) {
-          Status = SmmSetMemoryAttributes (
+          Status = AddNotPresentRange (
+                     Ranges,
+                     &RangeCount,
                      Entry->PhysicalStart,
-                     EFI_PAGES_TO_SIZE ((UINTN)Entry->NumberOfPages),
-                     EFI_MEMORY_RP
+                     EFI_PAGES_TO_SIZE ((UINTN)Entry->NumberOfPages)
                      );
           DEBUG ((
             DEBUG_INFO,
@@ -1501,6 +1647,12 @@ SetUefiMemMapAttributes (
 
       Entry = NEXT_MEMORY_DESCRIPTOR (Entry, mUefiMemoryAttributesTable->DescriptorSize);
     }
+
+    SmmSetMemoryRangesNotPresent (Ranges, RangeCount);
+  }
+
+  if (Ranges != NULL) {
+    FreePool (Ranges);
   }
 
   WRITE_PROTECT_RO_PAGES (WriteProtect, CetEnabled);
@@ -66,17 +66,16 @@ StartSyncTimer (
 }
 
 /**
-  Check if the SMM AP Sync Timer is timeout specified by Timeout.
+  Get the number of ticks the SMM AP Sync Timer has run since Timer.
 
   @param Timer    The start timer from the begin.
-  @param Timeout  The timeout ticker to wait.
 
+  @return The number of performance counter ticks since Timer.
 **/
-BOOLEAN
+UINT64
 EFIAPI
-IsSyncTimerTimeout (
-  IN      UINT64  Timer,
-  IN      UINT64  Timeout
+GetSyncTimerElapsed (
+  IN      UINT64  Timer
   )
 {
   UINT64  CurrentTimer;
@@ -114,5 +113,22 @@ IsSyncTimerTimeout (
     }
   }
 
-  return (BOOLEAN)(Delta >= Timeout);
+  return Delta;
+}
+
+/**
+  Check if the SMM AP Sync Timer is timeout specified by Timeout.
+
+  @param Timer    The start timer from the begin.
+  @param Timeout  The timeout ticker to wait.
+
+**/
+BOOLEAN
+EFIAPI
+IsSyncTimerTimeout (
+  IN      UINT64  Timer,
+  IN      UINT64  Timeout
+  )
+{
+  return (BOOLEAN)(GetSyncTimerElapsed (Timer) >= Timeout);
 }